@@ -14,6 +14,7 @@
 
 #include "open_spiel/action_view.h"
 
+#include <cstdint>
 #include <vector>
 
 #include "open_spiel/spiel.h"
@@ -35,7 +36,7 @@ std::vector<std::vector<Action>> CollectActions(const State& state) {
 }
 
 ActionView::ActionView(const Player current_player,
-                       const std::vector<std::vector<Action>> legal_actions)
+                       std::vector<std::vector<Action>> legal_actions)
     : current_player(current_player), legal_actions(std::move(legal_actions)) {}
 
 ActionView::ActionView(const State& state)
@@ -139,4 +140,15 @@ FixedActionsIterator::FixedActionsIterator(int fixed_action, int num_actions,
       i_(i),
       j_(j) {}
 
+// ActionViewCache
+
+const ActionView& ActionViewCache::GetView(const State& state) {
+  const uint64_t key = state.Key();
+  auto iter = views_.find(key);
+  if (iter == views_.end()) {
+    iter = views_.try_emplace(key, state).first;
+  }
+  return iter->second;
+}
+
 }  // namespace open_spiel
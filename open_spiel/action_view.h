@@ -15,8 +15,10 @@
 #ifndef OPEN_SPIEL_ACTION_VIEW_
 #define OPEN_SPIEL_ACTION_VIEW_
 
+#include <cstdint>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/node_hash_map.h"
 #include "open_spiel/spiel.h"
 
 // ActionView provides a number of iterators that are useful for dealing
@@ -75,7 +77,7 @@ struct ActionView {
   explicit ActionView(const State& state);
   // Construct a custom action view.
   ActionView(const Player current_player,
-             const std::vector<std::vector<Action>> legal_actions);
+             std::vector<std::vector<Action>> legal_actions);
 
   int num_players() const { return legal_actions.size(); }
   int num_actions(Player pl) const { return legal_actions.at(pl).size(); }
@@ -96,6 +98,26 @@ struct ActionView {
   FixedActions fixed_action(Player player, int action_index) const;
 };
 
+// Caches ActionViews across repeated queries of the same states, keyed by
+// State::Key(). Traversals that visit states more than once (policy
+// evaluation, best response) pay the per-player legal-action collection only
+// on the first visit; games with small repeating legal sets (goofspiel,
+// blotto) hit the cache almost always. Returned references stay valid until
+// Clear(). Distinct states that collide on the 64-bit key would share a view;
+// as with other Key()-based caches this is vanishingly unlikely.
+class ActionViewCache {
+ public:
+  const ActionView& GetView(const State& state);
+
+  int size() const { return views_.size(); }
+  void Clear() { views_.clear(); }
+
+ private:
+  // node_hash_map: views are neither movable (const members) nor allowed to
+  // relocate while callers hold references.
+  absl::node_hash_map<uint64_t, ActionView> views_;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_ACTION_VIEW_
@@ -29,9 +29,11 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
 #include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/abseil-cpp/absl/time/clock.h"
 #include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/algorithms/alpha_zero_torch/device_manager.h"
+#include "open_spiel/algorithms/alpha_zero_torch/trajectory_file.h"
 #include "open_spiel/algorithms/alpha_zero_torch/vpevaluator.h"
 #include "open_spiel/algorithms/alpha_zero_torch/vpnet.h"
 #include "open_spiel/algorithms/mcts.h"
@@ -43,8 +45,10 @@
 #include "open_spiel/utils/json.h"
 #include "open_spiel/utils/logger.h"
 #include "open_spiel/utils/lru_cache.h"
+#include "open_spiel/utils/mmap_circular_buffer.h"
 #include "open_spiel/utils/serializable_circular_buffer.h"
 #include "open_spiel/utils/stats.h"
+#include "open_spiel/utils/tensor_compression.h"
 #include "open_spiel/utils/thread.h"
 #include "open_spiel/utils/threaded_queue.h"
 
@@ -175,6 +179,146 @@ std::unique_ptr<MCTSBot> InitAZBot(const AlphaZeroConfig& config,
       /*dont_return_chance_node*/ true);
 }
 
+// Interleaves config.games_per_actor self-play games on a single thread.
+// Each round it advances every game to the point where its current search
+// has a leaf waiting for evaluation (chance nodes, terminal backups and
+// finished moves are handled inline), then evaluates all the collected
+// leaves with one EvaluateBatch call. A handful of such threads keeps the
+// inference queue full without one OS thread per concurrent game.
+void InterleavedActor(const open_spiel::Game& game,
+                      const AlphaZeroConfig& config, int num, Logger* logger,
+                      ThreadedQueue<Trajectory>* trajectory_queue,
+                      std::shared_ptr<VPNetEvaluator> vp_eval,
+                      StopToken* stop) {
+  std::mt19937 rng(absl::ToUnixNanos(absl::Now()) + num);
+  absl::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  struct GameSlot {
+    std::unique_ptr<open_spiel::State> state;
+    std::vector<std::unique_ptr<MCTSBot>> bots;
+    Trajectory trajectory;
+    std::vector<std::string> history;
+    double cutoff = 0;
+    int game_num = 0;
+    bool searching = false;
+  };
+
+  int next_game_num = 1;
+  auto new_game = [&](GameSlot* slot) {
+    slot->state = game.NewInitialState();
+    slot->trajectory = Trajectory();
+    slot->history.clear();
+    slot->cutoff =
+        (dist(rng) < config.cutoff_probability ? config.cutoff_value
+                                               : game.MaxUtility() + 1);
+    slot->game_num = next_game_num++;
+    slot->searching = false;
+  };
+
+  std::vector<GameSlot> slots(config.games_per_actor);
+  for (GameSlot& slot : slots) {
+    slot.bots.reserve(2);
+    for (int player = 0; player < 2; player++) {
+      slot.bots.push_back(InitAZBot(config, game, vp_eval, false));
+    }
+    new_game(&slot);
+  }
+
+  std::vector<const open_spiel::State*> leaves;
+  std::vector<MCTSBot*> leaf_bots;
+  leaves.reserve(slots.size() * config.inflight_per_game);
+  leaf_bots.reserve(slots.size() * config.inflight_per_game);
+  while (!stop->StopRequested()) {
+    leaves.clear();
+    leaf_bots.clear();
+    for (GameSlot& slot : slots) {
+      while (!stop->StopRequested()) {
+        open_spiel::State& state = *slot.state;
+        if (state.IsChanceNode()) {
+          open_spiel::ActionsAndProbs outcomes = state.ChanceOutcomes();
+          state.ApplyAction(open_spiel::SampleAction(outcomes, rng).first);
+          continue;
+        }
+        open_spiel::Player player = state.CurrentPlayer();
+        MCTSBot* bot = slot.bots[player].get();
+        if (!slot.searching) {
+          bot->StartSearch(state);
+          slot.searching = true;
+        }
+        // Keep up to inflight_per_game simulations of this search suspended
+        // at once; each suspended simulation contributes a leaf to the
+        // batch, deepening it beyond one leaf per game.
+        int collected = 0;
+        while (collected < config.inflight_per_game) {
+          const open_spiel::State* leaf = bot->CollectLeaf();
+          if (leaf == nullptr) break;
+          leaves.push_back(leaf);
+          leaf_bots.push_back(bot);
+          ++collected;
+        }
+        if (collected > 0) {
+          break;  // This game is parked until the batch is evaluated.
+        }
+
+        // The search is done: choose the move and advance the game, exactly
+        // as PlayGame does.
+        std::unique_ptr<SearchNode> root = bot->FinishSearch();
+        slot.searching = false;
+        open_spiel::ActionsAndProbs policy;
+        policy.reserve(root->children.size());
+        for (const SearchNode& c : root->children) {
+          policy.emplace_back(
+              c.action, std::pow(c.explore_count, 1.0 / config.temperature));
+        }
+        NormalizePolicy(&policy);
+        open_spiel::Action action;
+        if (slot.history.size() >= config.temperature_drop) {
+          action = root->BestChild().action;
+        } else {
+          action = open_spiel::SampleAction(policy, rng).first;
+        }
+
+        double root_value = root->total_reward / root->explore_count;
+        slot.trajectory.states.push_back(Trajectory::State{
+            state.ObservationTensor(), player, state.LegalActions(), action,
+            std::move(policy), root_value});
+        slot.history.push_back(state.ActionToString(player, action));
+        state.ApplyAction(action);
+
+        bool game_over = false;
+        if (state.IsTerminal()) {
+          slot.trajectory.returns = state.Returns();
+          game_over = true;
+        } else if (std::abs(root_value) > slot.cutoff) {
+          slot.trajectory.returns.resize(2);
+          slot.trajectory.returns[player] = root_value;
+          slot.trajectory.returns[1 - player] = -root_value;
+          game_over = true;
+        }
+        if (game_over) {
+          logger->Print("Game %d: Returns: %s; Actions: %s", slot.game_num,
+                        absl::StrJoin(slot.trajectory.returns, " "),
+                        absl::StrJoin(slot.history, " "));
+          if (!trajectory_queue->Push(std::move(slot.trajectory),
+                                      absl::Seconds(10))) {
+            logger->Print("Failed to push a trajectory after 10 seconds.");
+          }
+          new_game(&slot);
+        }
+      }
+    }
+
+    if (leaves.empty()) {  // Almost certainly StopRequested.
+      continue;
+    }
+    std::vector<std::vector<double>> values = vp_eval->EvaluateBatch(
+        absl::Span<const open_spiel::State* const>(leaves));
+    for (int i = 0; i < leaf_bots.size(); ++i) {
+      leaf_bots[i]->ProvideLeafValue(values[i]);
+    }
+  }
+}
+
 // An actor thread runner that generates games and returns trajectories.
 void actor(const open_spiel::Game& game, const AlphaZeroConfig& config, int num,
            ThreadedQueue<Trajectory>* trajectory_queue,
@@ -185,6 +329,12 @@ void actor(const open_spiel::Game& game, const AlphaZeroConfig& config, int num,
   } else {
     logger.reset(new NoopLogger());
   }
+  if (config.games_per_actor > 1) {
+    InterleavedActor(game, config, num, logger.get(), trajectory_queue,
+                     vp_eval, stop);
+    logger->Print("Got a quit.");
+    return;
+  }
   std::mt19937 rng(absl::ToUnixNanos(absl::Now()));
   absl::uniform_real_distribution<double> dist(0.0, 1.0);
   std::vector<std::unique_ptr<MCTSBot>> bots;
@@ -295,6 +445,99 @@ void evaluator(const open_spiel::Game& game, const AlphaZeroConfig& config,
   logger.Print("Got a quit.");
 }
 
+// The learner's replay window, either in RAM (the default, saved and loaded
+// explicitly as replay_buffer.data) or memory-mapped from disk when
+// config.replay_buffer_path is set, in which case the file is the buffer and
+// recovery is automatic.
+// A TrainInputs record as the replay buffer stores it: the observation
+// tensor is kept in the CompressTensor() encoding, which bit-packs the
+// (overwhelmingly binary, for games like chess and go) observation planes at
+// one bit per element instead of a four-byte float.
+struct PackedTrainInputs {
+  std::vector<Action> legal_actions;
+  std::string observations;
+  ActionsAndProbs policy;
+  double value;
+
+  NOP_STRUCTURE(PackedTrainInputs, legal_actions, observations, policy,
+                value);
+};
+
+PackedTrainInputs Pack(const VPNetModel::TrainInputs& inputs) {
+  return PackedTrainInputs{inputs.legal_actions,
+                           CompressTensor(inputs.observations), inputs.policy,
+                           inputs.value};
+}
+
+VPNetModel::TrainInputs Unpack(const PackedTrainInputs& packed,
+                               int observation_size) {
+  VPNetModel::TrainInputs inputs;
+  inputs.legal_actions = packed.legal_actions;
+  inputs.observations.resize(observation_size);
+  DecompressTensor(packed.observations, absl::MakeSpan(inputs.observations));
+  inputs.policy = packed.policy;
+  inputs.value = packed.value;
+  return inputs;
+}
+
+class ReplayBuffer {
+ public:
+  ReplayBuffer(const AlphaZeroConfig& config, const open_spiel::Game& game)
+      : observation_size_(game.ObservationTensorSize()) {
+    if (config.replay_buffer_path.empty()) {
+      ram_ = std::make_unique<SerializableCircularBuffer<PackedTrainInputs>>(
+          config.replay_buffer_size);
+    } else {
+      // A generous bound on the serialized size of one record: the packed
+      // observation (raw floats in the worst, non-binary case) plus the
+      // legal action and policy lists, with room for the encoding overhead.
+      // An overrun is a fatal error, so a too-small bound fails loudly, not
+      // silently.
+      int64_t max_record_size = 256 + 5 * game.ObservationTensorSize() +
+                                32 * game.NumDistinctActions();
+      disk_ = std::make_unique<MmapCircularBuffer<PackedTrainInputs>>(
+          config.replay_buffer_path, config.replay_buffer_size,
+          max_record_size);
+    }
+  }
+
+  // The disk buffer recovers its contents by itself when reopened.
+  void Load(const std::string& path) {
+    if (ram_) ram_->LoadBuffer(path);
+  }
+  void Save(const std::string& path) {
+    if (ram_) {
+      ram_->SaveBuffer(path);
+    } else {
+      disk_->Flush();
+    }
+  }
+
+  void Add(const VPNetModel::TrainInputs& inputs) {
+    ram_ ? ram_->Add(Pack(inputs)) : disk_->Add(Pack(inputs));
+  }
+  // Observations are unpacked back to floats as the batch is assembled.
+  std::vector<VPNetModel::TrainInputs> Sample(std::mt19937* rng, int num) {
+    std::vector<PackedTrainInputs> packed =
+        ram_ ? ram_->Sample(rng, num) : disk_->Sample(rng, num);
+    std::vector<VPNetModel::TrainInputs> samples;
+    samples.reserve(packed.size());
+    for (const PackedTrainInputs& p : packed) {
+      samples.push_back(Unpack(p, observation_size_));
+    }
+    return samples;
+  }
+  int64_t Size() const { return ram_ ? ram_->Size() : disk_->Size(); }
+  int64_t TotalAdded() const {
+    return ram_ ? ram_->TotalAdded() : disk_->TotalAdded();
+  }
+
+ private:
+  const int observation_size_;
+  std::unique_ptr<SerializableCircularBuffer<PackedTrainInputs>> ram_;
+  std::unique_ptr<MmapCircularBuffer<PackedTrainInputs>> disk_;
+};
+
 void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
              DeviceManager* device_manager,
              std::shared_ptr<VPNetEvaluator> eval,
@@ -310,10 +553,21 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
   logger.Print("Running the learner on device %d: %s", device_id,
                device_manager->Get(0, device_id)->Device());
 
-  SerializableCircularBuffer<VPNetModel::TrainInputs> replay_buffer(
-      config.replay_buffer_size);
+  ReplayBuffer replay_buffer(config, game);
   if (start_info.start_step > 1) {
-    replay_buffer.LoadBuffer(config.path + "/replay_buffer.data");
+    replay_buffer.Load(config.path + "/replay_buffer.data");
+  }
+  std::unique_ptr<TrajectoryWriter> trajectory_writer;
+  if (!config.trajectories_path.empty()) {
+    if (!file::Exists(config.trajectories_path)) {
+      file::Mkdirs(config.trajectories_path);
+    }
+    // A fresh file per run, named by the starting step, so a resumed run
+    // doesn't clobber the trajectories of the one it continues.
+    trajectory_writer = std::make_unique<TrajectoryWriter>(
+        absl::StrCat(config.trajectories_path, "/trajectories-",
+                     start_info.start_step, ".traj"),
+        game.ObservationTensorSize(), game.NumDistinctActions());
   }
   int learn_rate = config.replay_buffer_size / config.replay_buffer_reuse;
   int64_t total_trajectories = start_info.total_trajectories;
@@ -358,9 +612,11 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
         outcomes.Add(p1_outcome > 0 ? 0 : (p1_outcome < 0 ? 1 : 2));
 
         for (const Trajectory::State& state : trajectory->states) {
-          replay_buffer.Add(VPNetModel::TrainInputs{state.legal_actions,
-                                                    state.observation,
-                                                    state.policy, p1_outcome});
+          VPNetModel::TrainInputs sample{state.legal_actions,
+                                         state.observation, state.policy,
+                                         p1_outcome};
+          if (trajectory_writer) trajectory_writer->Add(sample);
+          replay_buffer.Add(sample);
           num_states += 1;
         }
 
@@ -394,7 +650,8 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
 
     last = now;
 
-    replay_buffer.SaveBuffer(config.path + "/replay_buffer.data");
+    replay_buffer.Save(config.path + "/replay_buffer.data");
+    if (trajectory_writer) trajectory_writer->Flush();
 
     VPNetModel::LossInfo losses;
     {  // Extra scope to return the device for use for inference asap.
@@ -535,9 +792,12 @@ bool AlphaZero(AlphaZeroConfig config, StopToken* stop, bool resuming) {
 
   std::cout << "Playing game: " << config.game << std::endl;
 
+  config.games_per_actor = std::max(1, config.games_per_actor);
+
+  // Each interleaved game can have one inference outstanding at a time.
   config.inference_batch_size = std::max(
-      1,
-      std::min(config.inference_batch_size, config.actors + config.evaluators));
+      1, std::min(config.inference_batch_size,
+                  config.actors * config.games_per_actor + config.evaluators));
 
   config.inference_threads =
       std::max(1, std::min(config.inference_threads,
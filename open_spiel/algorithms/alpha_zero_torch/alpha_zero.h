@@ -45,6 +45,14 @@ struct AlphaZeroConfig {
   int inference_cache;
   int replay_buffer_size;
   int replay_buffer_reuse;
+  // When non-empty, the replay buffer is memory-mapped at this path instead
+  // of held in RAM, so the window size is bounded by disk. The file persists
+  // across runs (including crashes) and replaces replay_buffer.data.
+  std::string replay_buffer_path;
+  // When non-empty, the learner also appends every training sample to a
+  // columnar trajectory file under this directory (see trajectory_file.h),
+  // for offline reuse of the training data.
+  std::string trajectories_path;
   int checkpoint_freq;
   int evaluation_window;
 
@@ -58,6 +66,13 @@ struct AlphaZeroConfig {
   double cutoff_value;
 
   int actors;
+  int games_per_actor;
+  // Number of simulations each interleaved search keeps suspended awaiting
+  // evaluation (see MCTSBot::CollectLeaf). Values above 1 deepen inference
+  // batches without more games or threads, at the cost of more descents
+  // running under stale (virtual-loss) statistics. Only used when
+  // games_per_actor > 1.
+  int inflight_per_game;
   int evaluators;
   int eval_levels;
   int max_steps;
@@ -80,6 +95,8 @@ struct AlphaZeroConfig {
         {"inference_cache", inference_cache},
         {"replay_buffer_size", replay_buffer_size},
         {"replay_buffer_reuse", replay_buffer_reuse},
+        {"replay_buffer_path", replay_buffer_path},
+        {"trajectories_path", trajectories_path},
         {"checkpoint_freq", checkpoint_freq},
         {"evaluation_window", evaluation_window},
         {"uct_c", uct_c},
@@ -91,6 +108,8 @@ struct AlphaZeroConfig {
         {"cutoff_probability", cutoff_probability},
         {"cutoff_value", cutoff_value},
         {"actors", actors},
+        {"games_per_actor", games_per_actor},
+        {"inflight_per_game", inflight_per_game},
         {"evaluators", evaluators},
         {"eval_levels", eval_levels},
         {"max_steps", max_steps},
@@ -114,6 +133,14 @@ struct AlphaZeroConfig {
     inference_cache = config_json.at("inference_cache").GetInt();
     replay_buffer_size = config_json.at("replay_buffer_size").GetInt();
     replay_buffer_reuse = config_json.at("replay_buffer_reuse").GetInt();
+    // Not present in configs written before this option existed.
+    replay_buffer_path = config_json.count("replay_buffer_path")
+                             ? config_json.at("replay_buffer_path").GetString()
+                             : "";
+    // Not present in configs written before this option existed.
+    trajectories_path = config_json.count("trajectories_path")
+                            ? config_json.at("trajectories_path").GetString()
+                            : "";
     checkpoint_freq = config_json.at("checkpoint_freq").GetInt();
     evaluation_window = config_json.at("evaluation_window").GetInt();
     uct_c = config_json.at("uct_c").GetDouble();
@@ -125,6 +152,13 @@ struct AlphaZeroConfig {
     cutoff_probability = config_json.at("cutoff_probability").GetDouble();
     cutoff_value = config_json.at("cutoff_value").GetDouble();
     actors = config_json.at("actors").GetInt();
+    // Not present in configs written before this option existed.
+    games_per_actor = config_json.count("games_per_actor")
+                          ? config_json.at("games_per_actor").GetInt()
+                          : 1;
+    inflight_per_game = config_json.count("inflight_per_game")
+                            ? config_json.at("inflight_per_game").GetInt()
+                            : 1;
     evaluators = config_json.at("evaluators").GetInt();
     eval_levels = config_json.at("eval_levels").GetInt();
     max_steps = config_json.at("max_steps").GetInt();
@@ -15,10 +15,14 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_DEVICE_MANAGER_H_
 #define OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_DEVICE_MANAGER_H_
 
+#include <memory>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/algorithms/alpha_zero_torch/vpnet.h"
+#include "open_spiel/spiel_utils.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -27,17 +31,18 @@ namespace torch_az {
 // Keeps track of a bunch of VPNet models, intended to be one per device, and
 // gives them out based on usage. When you request a device you specify how much
 // work you're going to give it, which is assumed done once the loan is
-// returned.
+// returned. Routing accounts for both the outstanding work per device and a
+// per-request latency EWMA measured over returned loans, so a slow card in a
+// heterogeneous set receives proportionally less work instead of an equal
+// share. Devices can be added or disabled while loans are outstanding.
 class DeviceManager {
  public:
-  DeviceManager() {
-    learning_ = false;
-    multiple_devices_ = false;
-  }
+  DeviceManager() { learning_ = false; }
 
-  void AddDevice(VPNetModel model) {  // Not thread safe.
-    devices.emplace_back(Device{std::move(model)});
-    multiple_devices_ = devices.size() > 1;
+  // Thread safe; devices may be added while loans are outstanding.
+  void AddDevice(VPNetModel model) {
+    absl::MutexLock lock(&m_);
+    devices.push_back(std::make_unique<Device>(Device{std::move(model)}));
   }
 
   // Acts as a pointer to the model, but lets the manager know when you're done.
@@ -49,64 +54,109 @@ class DeviceManager {
     DeviceLoan(const DeviceLoan&) = delete;
     DeviceLoan& operator=(const DeviceLoan&) = delete;
 
-    ~DeviceLoan() { manager_->Return(device_id_, requests_); }
+    ~DeviceLoan() { manager_->Return(device_id_, requests_, start_); }
     VPNetModel* operator->() { return model_; }
 
    private:
     DeviceLoan(DeviceManager* manager, VPNetModel* model, int device_id,
-               int requests)
+               int requests, absl::Time start)
         : manager_(manager),
           model_(model),
           device_id_(device_id),
-          requests_(requests) {}
+          requests_(requests),
+          start_(start) {}
     DeviceManager* manager_;
     VPNetModel* model_;
     int device_id_;
     int requests_;
+    absl::Time start_;
     friend DeviceManager;
   };
 
-  // Gives the device with the fewest outstanding requests.
+  // Gives the enabled device with the lowest estimated drain time: outstanding
+  // requests plus the new ones, weighted by that device's latency EWMA. An
+  // unmeasured device scores zero, so new devices are probed immediately.
+  // Passing an explicit device_id bypasses routing (and the enabled check).
   DeviceLoan Get(int requests, int device_id = -1) {
     absl::MutexLock lock(&m_);
     if (device_id < 0) {
-      // The starting device changes depending on if we are allowed to
-      // use the first device or not.
-      device_id = 0 + (learning_ && multiple_devices_);
-      for (int i = 1 + (learning_ && multiple_devices_); i < devices.size();
-           ++i) {
-        if (devices[i].requests < devices[device_id].requests) {
-          device_id = i;
-        }
-      }
+      device_id = PickDevice(requests);
     }
-    devices[device_id].requests += requests;
-    return DeviceLoan(this, &devices[device_id].model, device_id, requests);
+    Device& device = *devices[device_id];
+    device.requests += requests;
+    return DeviceLoan(this, &device.model, device_id, requests, absl::Now());
+  }
+
+  // Enable or disable a device for anonymous Get() routing, e.g. to drain a
+  // card mid-run before reconfiguring or dropping it. Outstanding loans are
+  // unaffected, and explicit Get(requests, device_id) still works.
+  void SetDeviceEnabled(int device_id, bool enabled) {
+    absl::MutexLock lock(&m_);
+    devices[device_id]->enabled = enabled;
   }
 
   // A member to ensure that when device:0 is learning and there are
   // multiple devices available, that device:0 does not take on any
   // inference requests from the actors and evaluators. These inference
   // requests should be dealt with by the other available devices.
-  void SetLearning(bool value) { learning_ = value; }
+  void SetLearning(bool value) {
+    absl::MutexLock lock(&m_);
+    learning_ = value;
+  }
 
-  int Count() const { return devices.size(); }
+  int Count() const {
+    absl::MutexLock lock(&m_);
+    return devices.size();
+  }
 
  private:
-  void Return(int device_id, int requests) {
+  int PickDevice(int requests) const {  // Requires m_ to be held.
+    bool skip_first = learning_ && devices.size() > 1;
+    int device_id = -1;
+    double best_score = 0;
+    for (int i = skip_first ? 1 : 0; i < devices.size(); ++i) {
+      const Device& device = *devices[i];
+      if (!device.enabled) continue;
+      double score = (device.requests + requests) * device.latency_ewma_us;
+      if (device_id < 0 || score < best_score) {
+        device_id = i;
+        best_score = score;
+      }
+    }
+    if (device_id < 0 && skip_first && devices[0]->enabled) {
+      device_id = 0;  // Better to share the learner's device than to stall.
+    }
+    if (device_id < 0) {
+      SpielFatalError("DeviceManager: no enabled devices.");
+    }
+    return device_id;
+  }
+
+  void Return(int device_id, int requests, absl::Time start) {
     absl::MutexLock lock(&m_);
-    devices[device_id].requests -= requests;
+    Device& device = *devices[device_id];
+    device.requests -= requests;
+    if (requests > 0) {
+      double per_request_us =
+          absl::ToDoubleMicroseconds(absl::Now() - start) / requests;
+      device.latency_ewma_us =
+          device.latency_ewma_us == 0
+              ? per_request_us
+              : 0.9 * device.latency_ewma_us + 0.1 * per_request_us;
+    }
   }
 
   struct Device {
     VPNetModel model;
     int requests = 0;
+    bool enabled = true;
+    double latency_ewma_us = 0;  // Per request, over completed loans.
   };
 
   bool learning_;
-  bool multiple_devices_;
-  std::vector<Device> devices;
-  absl::Mutex m_;
+  // unique_ptr so outstanding DeviceLoan pointers survive AddDevice.
+  std::vector<std::unique_ptr<Device>> devices;
+  mutable absl::Mutex m_;
 };
 
 }  // namespace torch_az
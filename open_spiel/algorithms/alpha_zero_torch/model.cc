@@ -23,6 +23,27 @@
 namespace open_spiel {
 namespace algorithms {
 namespace torch_az {
+namespace {
+
+// Folds a batch normalization layer into the preceding convolution, so that
+// the convolution alone computes BN(CONV(x)). With
+//   scale = gamma / sqrt(running_var + eps)
+// the fused convolution has weights W * scale (per output channel) and bias
+// (b - running_mean) * scale + beta. Only valid in eval mode, where the
+// normalization uses the running statistics.
+void FoldBatchNormIntoConv(torch::nn::Conv2d& conv,
+                           torch::nn::BatchNorm2d& batch_norm) {
+  torch::NoGradGuard no_grad;
+  torch::Tensor scale =
+      batch_norm->weight /
+      torch::sqrt(batch_norm->running_var + batch_norm->options.eps());
+  conv->weight.mul_(scale.view({-1, 1, 1, 1}));
+  conv->bias.sub_(batch_norm->running_mean)
+      .mul_(scale)
+      .add_(batch_norm->bias);
+}
+
+}  // namespace
 
 std::istream& operator>>(std::istream& stream, ModelConfig& config) {
   int channels;
@@ -75,11 +96,18 @@ ResInputBlockImpl::ResInputBlockImpl(const ResInputBlockConfig& config)
 
 torch::Tensor ResInputBlockImpl::forward(torch::Tensor x) {
   torch::Tensor output = x.view({-1, channels_, height_, width_});
-  output = torch::relu(batch_norm_(conv_(output)));
+  output = fused_ ? torch::relu(conv_(output))
+                  : torch::relu(batch_norm_(conv_(output)));
 
   return output;
 }
 
+void ResInputBlockImpl::FuseBatchNorm() {
+  if (fused_) return;
+  FoldBatchNormIntoConv(conv_, batch_norm_);
+  fused_ = true;
+}
+
 ResTorsoBlockImpl::ResTorsoBlockImpl(const ResTorsoBlockConfig& config,
                                      int layer)
     : conv1_(torch::nn::Conv2dOptions(
@@ -125,14 +153,22 @@ ResTorsoBlockImpl::ResTorsoBlockImpl(const ResTorsoBlockConfig& config,
 torch::Tensor ResTorsoBlockImpl::forward(torch::Tensor x) {
   torch::Tensor residual = x;
 
-  torch::Tensor output = torch::relu(batch_norm1_(conv1_(x)));
-  output = batch_norm2_(conv2_(output));
+  torch::Tensor output = fused_ ? torch::relu(conv1_(x))
+                                : torch::relu(batch_norm1_(conv1_(x)));
+  output = fused_ ? conv2_(output) : batch_norm2_(conv2_(output));
   output += residual;
   output = torch::relu(output);
 
   return output;
 }
 
+void ResTorsoBlockImpl::FuseBatchNorm() {
+  if (fused_) return;
+  FoldBatchNormIntoConv(conv1_, batch_norm1_);
+  FoldBatchNormIntoConv(conv2_, batch_norm2_);
+  fused_ = true;
+}
+
 ResOutputBlockImpl::ResOutputBlockImpl(const ResOutputBlockConfig& config)
     : value_conv_(torch::nn::Conv2dOptions(
                       /*input_channels=*/config.input_channels,
@@ -193,13 +229,16 @@ ResOutputBlockImpl::ResOutputBlockImpl(const ResOutputBlockConfig& config)
 
 std::vector<torch::Tensor> ResOutputBlockImpl::forward(torch::Tensor x,
                                                        torch::Tensor mask) {
-  torch::Tensor value_output = torch::relu(value_batch_norm_(value_conv_(x)));
+  torch::Tensor value_output =
+      fused_ ? torch::relu(value_conv_(x))
+             : torch::relu(value_batch_norm_(value_conv_(x)));
   value_output = value_output.view({-1, value_observation_size_});
   value_output = torch::relu(value_linear1_(value_output));
   value_output = torch::tanh(value_linear2_(value_output));
 
   torch::Tensor policy_logits =
-      torch::relu(policy_batch_norm_(policy_conv_(x)));
+      fused_ ? torch::relu(policy_conv_(x))
+             : torch::relu(policy_batch_norm_(policy_conv_(x)));
   policy_logits = policy_logits.view({-1, policy_observation_size_});
   policy_logits = policy_linear_(policy_logits);
   policy_logits = torch::where(mask, policy_logits,
@@ -208,6 +247,13 @@ std::vector<torch::Tensor> ResOutputBlockImpl::forward(torch::Tensor x,
   return {value_output, policy_logits};
 }
 
+void ResOutputBlockImpl::FuseBatchNorm() {
+  if (fused_) return;
+  FoldBatchNormIntoConv(value_conv_, value_batch_norm_);
+  FoldBatchNormIntoConv(policy_conv_, policy_batch_norm_);
+  fused_ = true;
+}
+
 MLPBlockImpl::MLPBlockImpl(const int in_features, const int out_features)
     : linear_(torch::nn::LinearOptions(
                          /*in_features=*/in_features,
@@ -369,6 +415,24 @@ std::vector<torch::Tensor> ModelImpl::losses(torch::Tensor inputs,
   return {policy_loss, value_loss, l2_regularization_loss};
 }
 
+void ModelImpl::FreezeAndFuse() {
+  // The fold is only valid in eval mode, where the batch normalizations use
+  // their running statistics.
+  this->eval();
+  if (this->nn_model_ == "resnet") {
+    layers_[0]->as<ResInputBlock>()->FuseBatchNorm();
+    for (int i = 1; i <= num_torso_blocks_; i++) {
+      layers_[i]->as<ResTorsoBlock>()->FuseBatchNorm();
+    }
+    layers_[num_torso_blocks_ + 1]->as<ResOutputBlock>()->FuseBatchNorm();
+  }
+  // The MLP model has no normalization layers to fuse; only freezing
+  // applies.
+  for (auto& parameter : this->parameters()) {
+    parameter.set_requires_grad(false);
+  }
+}
+
 std::vector<torch::Tensor> ModelImpl::forward_(torch::Tensor x,
                                                torch::Tensor mask) {
   std::vector<torch::Tensor> output;
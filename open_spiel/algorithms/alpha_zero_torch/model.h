@@ -83,11 +83,16 @@ class ResInputBlockImpl : public torch::nn::Module {
  public:
   ResInputBlockImpl(const ResInputBlockConfig& config);
   torch::Tensor forward(torch::Tensor x);
+  // Folds the batch normalization into the convolution's weights, after
+  // which forward skips the normalization. Inference-only: the fused block
+  // can no longer be trained. See ModelImpl::FreezeAndFuse.
+  void FuseBatchNorm();
 
  private:
   int channels_;
   int height_;
   int width_;
+  bool fused_ = false;
   torch::nn::Conv2d conv_;
   torch::nn::BatchNorm2d batch_norm_;
 };
@@ -108,8 +113,12 @@ class ResTorsoBlockImpl : public torch::nn::Module {
  public:
   ResTorsoBlockImpl(const ResTorsoBlockConfig& config, int layer);
   torch::Tensor forward(torch::Tensor x);
+  // As in ResInputBlockImpl: fold both batch normalizations into their
+  // convolutions for inference.
+  void FuseBatchNorm();
 
  private:
+  bool fused_ = false;
   torch::nn::Conv2d conv1_;
   torch::nn::Conv2d conv2_;
   torch::nn::BatchNorm2d batch_norm1_;
@@ -141,8 +150,12 @@ class ResOutputBlockImpl : public torch::nn::Module {
  public:
   ResOutputBlockImpl(const ResOutputBlockConfig& config);
   std::vector<torch::Tensor> forward(torch::Tensor x, torch::Tensor mask);
+  // As in ResInputBlockImpl: fold both heads' batch normalizations into
+  // their convolutions for inference.
+  void FuseBatchNorm();
 
  private:
+  bool fused_ = false;
   torch::nn::Conv2d value_conv_;
   torch::nn::BatchNorm2d value_batch_norm_;
   torch::nn::Linear value_linear1_;
@@ -188,6 +201,12 @@ class ModelImpl : public torch::nn::Module {
   std::vector<torch::Tensor> losses(torch::Tensor inputs, torch::Tensor masks,
                                     torch::Tensor policy_targets,
                                     torch::Tensor value_targets);
+  // Turns the model into an inference-only copy: puts it in eval mode,
+  // folds every batch normalization into the preceding convolution so each
+  // CONV+BN pair becomes one convolution, and disables gradients on all
+  // parameters. Intended for a copy of the training model (see
+  // VPNetModel); a fused model must not be trained further.
+  void FreezeAndFuse();
 
  private:
   std::vector<torch::Tensor> forward_(torch::Tensor x, torch::Tensor mask);
@@ -0,0 +1,249 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/alpha_zero_torch/trajectory_file.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace torch_az {
+namespace {
+
+constexpr uint64_t kMagic = 0x31304A4152545350;  // "PSTRAJ01", little-endian.
+constexpr uint32_t kVersion = 1;
+
+struct FileHeader {
+  uint64_t magic = kMagic;
+  uint32_t version = kVersion;
+  int32_t observation_size = 0;
+  int32_t num_distinct_actions = 0;
+  int32_t padding = 0;  // Keeps the int64 fields naturally aligned.
+  int64_t chunk_rows = 0;
+  int64_t num_rows = 0;
+};
+
+int64_t ChunkBytes(int observation_size, int num_distinct_actions,
+                   int64_t chunk_rows) {
+  return chunk_rows * (observation_size * sizeof(float) +
+                       num_distinct_actions * sizeof(float) +
+                       num_distinct_actions * sizeof(uint8_t) + sizeof(float));
+}
+
+template <typename T>
+absl::string_view AsBytes(const std::vector<T>& buffer) {
+  return absl::string_view(reinterpret_cast<const char*>(buffer.data()),
+                           buffer.size() * sizeof(T));
+}
+
+}  // namespace
+
+TrajectoryWriter::TrajectoryWriter(const std::string& path,
+                                   int observation_size,
+                                   int num_distinct_actions,
+                                   int64_t chunk_rows)
+    : observation_size_(observation_size),
+      num_distinct_actions_(num_distinct_actions),
+      chunk_rows_(chunk_rows),
+      file_(path, "wb") {
+  SPIEL_CHECK_GT(observation_size_, 0);
+  SPIEL_CHECK_GT(num_distinct_actions_, 0);
+  // A multiple of four keeps every float column 4-byte aligned for mmap
+  // readers, despite the byte-sized mask column before the values.
+  SPIEL_CHECK_GT(chunk_rows_, 0);
+  SPIEL_CHECK_EQ(chunk_rows_ % 4, 0);
+  observations_.reserve(chunk_rows_ * observation_size_);
+  policies_.reserve(chunk_rows_ * num_distinct_actions_);
+  legal_masks_.reserve(chunk_rows_ * num_distinct_actions_);
+  values_.reserve(chunk_rows_);
+  Flush();  // Writes the header, so even an empty file is readable.
+}
+
+TrajectoryWriter::~TrajectoryWriter() { Flush(); }
+
+void TrajectoryWriter::Add(const VPNetModel::TrainInputs& sample) {
+  SPIEL_CHECK_EQ(sample.observations.size(),
+                 static_cast<size_t>(observation_size_));
+  observations_.insert(observations_.end(), sample.observations.begin(),
+                       sample.observations.end());
+  size_t policy_start = policies_.size();
+  policies_.resize(policy_start + num_distinct_actions_, 0);
+  for (const auto& [action, prob] : sample.policy) {
+    SPIEL_CHECK_GE(action, 0);
+    SPIEL_CHECK_LT(action, num_distinct_actions_);
+    policies_[policy_start + action] = prob;
+  }
+  size_t mask_start = legal_masks_.size();
+  legal_masks_.resize(mask_start + num_distinct_actions_, 0);
+  for (Action action : sample.legal_actions) {
+    SPIEL_CHECK_GE(action, 0);
+    SPIEL_CHECK_LT(action, num_distinct_actions_);
+    legal_masks_[mask_start + action] = 1;
+  }
+  values_.push_back(sample.value);
+
+  ++num_rows_;
+  if (++rows_in_chunk_ == chunk_rows_) {
+    WriteChunk();
+    observations_.clear();
+    policies_.clear();
+    legal_masks_.clear();
+    values_.clear();
+    rows_in_chunk_ = 0;
+  }
+}
+
+void TrajectoryWriter::WriteChunk() {
+  // A partial chunk is padded with zero rows up to the fixed chunk size.
+  observations_.resize(chunk_rows_ * observation_size_, 0);
+  policies_.resize(chunk_rows_ * num_distinct_actions_, 0);
+  legal_masks_.resize(chunk_rows_ * num_distinct_actions_, 0);
+  values_.resize(chunk_rows_, 0);
+  file_.Write(AsBytes(observations_));
+  file_.Write(AsBytes(policies_));
+  file_.Write(AsBytes(legal_masks_));
+  file_.Write(AsBytes(values_));
+}
+
+void TrajectoryWriter::Flush() {
+  int64_t chunk_start =
+      sizeof(FileHeader) +
+      ((num_rows_ - rows_in_chunk_) / chunk_rows_) *
+          ChunkBytes(observation_size_, num_distinct_actions_, chunk_rows_);
+  if (rows_in_chunk_ > 0) {
+    WriteChunk();
+    // The padded rows were only written to keep the file readable; shrink
+    // the buffers back so later Adds overwrite the padding.
+    observations_.resize(rows_in_chunk_ * observation_size_);
+    policies_.resize(rows_in_chunk_ * num_distinct_actions_);
+    legal_masks_.resize(rows_in_chunk_ * num_distinct_actions_);
+    values_.resize(rows_in_chunk_);
+  }
+  FileHeader header;
+  header.observation_size = observation_size_;
+  header.num_distinct_actions = num_distinct_actions_;
+  header.chunk_rows = chunk_rows_;
+  header.num_rows = num_rows_;
+  file_.Seek(0);
+  file_.Write(absl::string_view(reinterpret_cast<const char*>(&header),
+                                sizeof(header)));
+  file_.Flush();
+  // Position the file so the next chunk write lands on the current chunk.
+  file_.Seek(chunk_start);
+}
+
+TrajectoryReader::TrajectoryReader(const std::string& path) : file_(path) {
+  absl::string_view contents = file_.contents();
+  if (contents.size() < sizeof(FileHeader)) {
+    SpielFatalError(absl::StrFormat(
+        "%s is too small (%d bytes) to be a trajectory file.", path,
+        contents.size()));
+  }
+  FileHeader header;
+  std::memcpy(&header, contents.data(), sizeof(header));
+  if (header.magic != kMagic) {
+    SpielFatalError(absl::StrFormat("%s is not a trajectory file.", path));
+  }
+  if (header.version != kVersion) {
+    SpielFatalError(absl::StrFormat(
+        "%s has unsupported trajectory file version %d; expected %d.", path,
+        header.version, kVersion));
+  }
+  observation_size_ = header.observation_size;
+  num_distinct_actions_ = header.num_distinct_actions;
+  chunk_rows_ = header.chunk_rows;
+  num_rows_ = header.num_rows;
+  chunk_bytes_ =
+      ChunkBytes(observation_size_, num_distinct_actions_, chunk_rows_);
+  int64_t num_chunks = (num_rows_ + chunk_rows_ - 1) / chunk_rows_;
+  int64_t expected_size = sizeof(FileHeader) + num_chunks * chunk_bytes_;
+  if (static_cast<int64_t>(contents.size()) < expected_size) {
+    SpielFatalError(absl::StrFormat(
+        "%s is truncated: %d bytes, expected at least %d for %d rows.", path,
+        contents.size(), expected_size, num_rows_));
+  }
+}
+
+const char* TrajectoryReader::ChunkStart(int64_t row) const {
+  SPIEL_CHECK_GE(row, 0);
+  SPIEL_CHECK_LT(row, num_rows_);
+  return file_.contents().data() + sizeof(FileHeader) +
+         (row / chunk_rows_) * chunk_bytes_;
+}
+
+int64_t TrajectoryReader::RowInChunk(int64_t row) const {
+  return row % chunk_rows_;
+}
+
+const float* TrajectoryReader::Observation(int64_t row) const {
+  return reinterpret_cast<const float*>(ChunkStart(row)) +
+         RowInChunk(row) * observation_size_;
+}
+
+const float* TrajectoryReader::Policy(int64_t row) const {
+  return reinterpret_cast<const float*>(
+             ChunkStart(row) + chunk_rows_ * observation_size_ *
+                                   sizeof(float)) +
+         RowInChunk(row) * num_distinct_actions_;
+}
+
+const uint8_t* TrajectoryReader::LegalMask(int64_t row) const {
+  return reinterpret_cast<const uint8_t*>(
+             ChunkStart(row) +
+             chunk_rows_ * (observation_size_ + num_distinct_actions_) *
+                 sizeof(float)) +
+         RowInChunk(row) * num_distinct_actions_;
+}
+
+float TrajectoryReader::Value(int64_t row) const {
+  const char* values =
+      ChunkStart(row) +
+      chunk_rows_ * (observation_size_ + num_distinct_actions_) *
+          sizeof(float) +
+      chunk_rows_ * num_distinct_actions_ * sizeof(uint8_t);
+  return reinterpret_cast<const float*>(values)[RowInChunk(row)];
+}
+
+std::vector<VPNetModel::TrainInputs> TrajectoryReader::ReadBatch(
+    absl::Span<const int64_t> rows) const {
+  std::vector<VPNetModel::TrainInputs> batch;
+  batch.reserve(rows.size());
+  for (int64_t row : rows) {
+    VPNetModel::TrainInputs sample;
+    const float* observation = Observation(row);
+    sample.observations.assign(observation, observation + observation_size_);
+    const float* policy = Policy(row);
+    const uint8_t* mask = LegalMask(row);
+    for (Action action = 0; action < num_distinct_actions_; ++action) {
+      if (mask[action]) {
+        sample.legal_actions.push_back(action);
+        sample.policy.emplace_back(action, policy[action]);
+      }
+    }
+    sample.value = Value(row);
+    batch.push_back(std::move(sample));
+  }
+  return batch;
+}
+
+}  // namespace torch_az
+}  // namespace algorithms
+}  // namespace open_spiel
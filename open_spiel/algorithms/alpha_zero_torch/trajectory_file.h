@@ -0,0 +1,118 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_TRAJECTORY_FILE_H_
+#define OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_TRAJECTORY_FILE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/algorithms/alpha_zero_torch/vpnet.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace torch_az {
+
+// A columnar binary file of training samples, as an alternative to replaying
+// JSON lines: one row per state, with the observation, the dense policy, the
+// legal-action mask and the value stored as typed columns. Rows are grouped
+// into fixed-size chunks and each column is contiguous within its chunk, so
+// a reader picking random rows for a batch faults in only the pages of the
+// columns it touches, with no parsing at all.
+//
+// File layout (native byte order; a file is not portable across
+// architectures, like the mmap'd replay buffer):
+//   FileHeader
+//   per chunk: float   observations[chunk_rows * observation_size]
+//              float   policies    [chunk_rows * num_distinct_actions]
+//              uint8_t legal_masks [chunk_rows * num_distinct_actions]
+//              float   values      [chunk_rows]
+// Rows of the last chunk beyond num_rows are zero padding.
+
+// Appends samples to a new trajectory file. Add buffers one chunk in memory;
+// full chunks are written out as they complete, and Flush (or the
+// destructor) writes the partial last chunk and the up-to-date header, so a
+// flushed file is always readable.
+class TrajectoryWriter {
+ public:
+  TrajectoryWriter(const std::string& path, int observation_size,
+                   int num_distinct_actions, int64_t chunk_rows = 4096);
+  ~TrajectoryWriter();  // Flushes.
+
+  // The file handle is owned exclusively.
+  TrajectoryWriter(const TrajectoryWriter&) = delete;
+  TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+  void Add(const VPNetModel::TrainInputs& sample);
+  void Flush();
+
+  int64_t num_rows() const { return num_rows_; }
+
+ private:
+  void WriteChunk();
+
+  const int observation_size_;
+  const int num_distinct_actions_;
+  const int64_t chunk_rows_;
+  file::File file_;
+  int64_t num_rows_ = 0;
+  int64_t rows_in_chunk_ = 0;
+  // Column buffers for the chunk being built.
+  std::vector<float> observations_;
+  std::vector<float> policies_;
+  std::vector<uint8_t> legal_masks_;
+  std::vector<float> values_;
+};
+
+// Reads a trajectory file through a memory mapping. Row accessors return
+// pointers into the mapping (valid for the reader's lifetime); ReadBatch
+// reconstructs TrainInputs rows for VPNetModel::Learn.
+class TrajectoryReader {
+ public:
+  explicit TrajectoryReader(const std::string& path);
+
+  int64_t num_rows() const { return num_rows_; }
+  int observation_size() const { return observation_size_; }
+  int num_distinct_actions() const { return num_distinct_actions_; }
+
+  // Zero-copy column access for the given row.
+  const float* Observation(int64_t row) const;
+  const float* Policy(int64_t row) const;
+  const uint8_t* LegalMask(int64_t row) const;
+  float Value(int64_t row) const;
+
+  // Assembles the given rows into TrainInputs, e.g. for a training batch.
+  std::vector<VPNetModel::TrainInputs> ReadBatch(
+      absl::Span<const int64_t> rows) const;
+
+ private:
+  const char* ChunkStart(int64_t row) const;
+  int64_t RowInChunk(int64_t row) const;
+
+  file::MappedFile file_;
+  int observation_size_ = 0;
+  int num_distinct_actions_ = 0;
+  int64_t chunk_rows_ = 0;
+  int64_t num_rows_ = 0;
+  int64_t chunk_bytes_ = 0;
+};
+
+}  // namespace torch_az
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_TRAJECTORY_FILE_H_
@@ -0,0 +1,136 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/alpha_zero_torch/trajectory_file.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "open_spiel/algorithms/alpha_zero_torch/vpnet.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace torch_az {
+namespace {
+
+const char* kFilename = "trajectory_file_test.traj";
+constexpr int kObsSize = 6;
+constexpr int kNumActions = 5;
+constexpr int64_t kChunkRows = 8;  // Small, so the tests cross chunks.
+
+VPNetModel::TrainInputs MakeSample(int i) {
+  VPNetModel::TrainInputs sample;
+  // Ascending, matching the order in which the reader rebuilds them.
+  sample.legal_actions = {i % kNumActions, (i + 2) % kNumActions};
+  std::sort(sample.legal_actions.begin(), sample.legal_actions.end());
+  sample.observations.resize(kObsSize);
+  for (int j = 0; j < kObsSize; ++j) {
+    sample.observations[j] = i + 0.25f * j;
+  }
+  double prob = 1.0 / sample.legal_actions.size();
+  for (Action action : sample.legal_actions) {
+    sample.policy.emplace_back(action, prob);
+  }
+  sample.value = (i % 2 == 0) ? 1 : -1;
+  return sample;
+}
+
+void CheckSample(const VPNetModel::TrainInputs& actual, int i) {
+  VPNetModel::TrainInputs expected = MakeSample(i);
+  SPIEL_CHECK_EQ(actual.legal_actions, expected.legal_actions);
+  SPIEL_CHECK_EQ(actual.observations.size(), expected.observations.size());
+  for (int j = 0; j < kObsSize; ++j) {
+    SPIEL_CHECK_FLOAT_EQ(actual.observations[j], expected.observations[j]);
+  }
+  SPIEL_CHECK_EQ(actual.policy.size(), expected.policy.size());
+  for (int j = 0; j < static_cast<int>(expected.policy.size()); ++j) {
+    SPIEL_CHECK_EQ(actual.policy[j].first, expected.policy[j].first);
+    SPIEL_CHECK_FLOAT_EQ(actual.policy[j].second, expected.policy[j].second);
+  }
+  SPIEL_CHECK_FLOAT_EQ(actual.value, expected.value);
+}
+
+void TestRoundTrip() {
+  if (file::Exists(kFilename)) file::Remove(kFilename);
+  constexpr int kNumRows = 30;  // Three full chunks plus a partial one.
+  {
+    TrajectoryWriter writer(kFilename, kObsSize, kNumActions, kChunkRows);
+    for (int i = 0; i < kNumRows; ++i) {
+      writer.Add(MakeSample(i));
+    }
+    SPIEL_CHECK_EQ(writer.num_rows(), kNumRows);
+    // The destructor flushes the partial last chunk.
+  }
+
+  TrajectoryReader reader(kFilename);
+  SPIEL_CHECK_EQ(reader.num_rows(), kNumRows);
+  SPIEL_CHECK_EQ(reader.observation_size(), kObsSize);
+  SPIEL_CHECK_EQ(reader.num_distinct_actions(), kNumActions);
+
+  std::vector<int64_t> rows;
+  for (int i = 0; i < kNumRows; ++i) rows.push_back(i);
+  std::vector<VPNetModel::TrainInputs> batch = reader.ReadBatch(rows);
+  SPIEL_CHECK_EQ(batch.size(), kNumRows);
+  for (int i = 0; i < kNumRows; ++i) {
+    CheckSample(batch[i], i);
+  }
+
+  // Spot-check the zero-copy accessors against row 13.
+  SPIEL_CHECK_FLOAT_EQ(reader.Observation(13)[2], 13 + 0.25f * 2);
+  SPIEL_CHECK_EQ(reader.LegalMask(13)[13 % kNumActions], 1);
+  SPIEL_CHECK_FLOAT_EQ(reader.Value(13), -1);
+  file::Remove(kFilename);
+}
+
+void TestAddAfterFlush() {
+  if (file::Exists(kFilename)) file::Remove(kFilename);
+  TrajectoryWriter writer(kFilename, kObsSize, kNumActions, kChunkRows);
+  constexpr int kNumRows = 21;
+  for (int i = 0; i < kNumRows; ++i) {
+    writer.Add(MakeSample(i));
+    // Flushing mid-chunk must not corrupt rows added afterwards.
+    if (i % 5 == 0) writer.Flush();
+  }
+  writer.Flush();
+
+  TrajectoryReader reader(kFilename);
+  SPIEL_CHECK_EQ(reader.num_rows(), kNumRows);
+  for (int i = 0; i < kNumRows; ++i) {
+    std::vector<VPNetModel::TrainInputs> batch = reader.ReadBatch({i});
+    CheckSample(batch[0], i);
+  }
+  file::Remove(kFilename);
+}
+
+void TestEmptyFileIsReadable() {
+  if (file::Exists(kFilename)) file::Remove(kFilename);
+  { TrajectoryWriter writer(kFilename, kObsSize, kNumActions, kChunkRows); }
+  TrajectoryReader reader(kFilename);
+  SPIEL_CHECK_EQ(reader.num_rows(), 0);
+  file::Remove(kFilename);
+}
+
+}  // namespace
+}  // namespace torch_az
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::torch_az::TestRoundTrip();
+  open_spiel::algorithms::torch_az::TestAddAfterFlush();
+  open_spiel::algorithms::torch_az::TestEmptyFileIsReadable();
+}
@@ -14,29 +14,42 @@
 
 #include "open_spiel/algorithms/alpha_zero_torch/vpevaluator.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 
 #include "open_spiel/abseil-cpp/absl/hash/hash.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
 #include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/utils/profiler.h"
 #include "open_spiel/utils/stats.h"
 
+namespace {
+
+// Never flush a partial batch in less than this, to avoid degenerating into
+// per-state inference under a very fast (e.g. cached or CPU-tiny) model.
+constexpr int64_t kMinFlushDeadlineUs = 50;
+
+}  // namespace
+
 namespace open_spiel {
 namespace algorithms {
 namespace torch_az {
 
 VPNetEvaluator::VPNetEvaluator(DeviceManager* device_manager, int batch_size,
-                               int threads, int cache_size, int cache_shards)
+                               int threads, int cache_size, int cache_shards,
+                               int64_t max_flush_deadline_us)
     : device_manager_(*device_manager),
       batch_size_(batch_size),
       queue_(batch_size * threads * 4),
+      max_flush_deadline_us_(
+          std::max<int64_t>(kMinFlushDeadlineUs, max_flush_deadline_us)),
+      adaptive_deadline_us_(max_flush_deadline_us_),
       batch_size_hist_(batch_size + 1) {
-  cache_shards = std::max(1, cache_shards);
-  cache_.reserve(cache_shards);
-  for (int i = 0; i < cache_shards; ++i) {
-    cache_.push_back(
-        std::make_unique<LRUCache<uint64_t, VPNetModel::InferenceOutputs>>(
-            cache_size / cache_shards));
+  if (cache_size > 0) {
+    cache_ = std::make_unique<
+        ShardedLRUCache<uint64_t, VPNetModel::InferenceOutputs>>(
+        cache_size, std::max(1, cache_shards));
   }
   if (batch_size_ <= 1) {
     threads = 0;
@@ -57,17 +70,13 @@ VPNetEvaluator::~VPNetEvaluator() {
 }
 
 void VPNetEvaluator::ClearCache() {
-  for (auto& c : cache_) {
-    c->Clear();
+  if (cache_) {
+    cache_->Clear();
   }
 }
 
 LRUCacheInfo VPNetEvaluator::CacheInfo() {
-  LRUCacheInfo info;
-  for (auto& c : cache_) {
-    info += c->Info();
-  }
-  return info;
+  return cache_ ? cache_->Info() : LRUCacheInfo();
 }
 
 std::vector<double> VPNetEvaluator::Evaluate(const State& state) {
@@ -76,6 +85,53 @@ std::vector<double> VPNetEvaluator::Evaluate(const State& state) {
   return {p0value, -p0value};
 }
 
+std::vector<std::vector<double>> VPNetEvaluator::EvaluateBatch(
+    absl::Span<const State* const> states) {
+  SPIEL_PROF_SCOPE("VPNetEvaluator::EvaluateBatch");
+  std::vector<std::vector<double>> values(states.size());
+  if (batch_size_ <= 1 || states.size() <= 1) {
+    for (int i = 0; i < states.size(); ++i) {
+      values[i] = Evaluate(*states[i]);
+    }
+    return values;
+  }
+  struct Pending {
+    int index;
+    uint64_t key;
+    std::promise<VPNetModel::InferenceOutputs> prom;
+    std::future<VPNetModel::InferenceOutputs> fut;
+  };
+  // unique_ptr so the promise addresses handed to the queue stay stable.
+  std::vector<std::unique_ptr<Pending>> pending;
+  for (int i = 0; i < states.size(); ++i) {
+    VPNetModel::InferenceInputs inputs = {states[i]->LegalActions(),
+                                          states[i]->ObservationTensor()};
+    auto p = std::make_unique<Pending>();
+    p->index = i;
+    if (cache_) {
+      p->key = absl::Hash<VPNetModel::InferenceInputs>{}(inputs);
+      absl::optional<const VPNetModel::InferenceOutputs> opt_outputs =
+          cache_->Get(p->key);
+      if (opt_outputs) {
+        // TODO(author5): currently assumes zero-sum.
+        values[i] = {opt_outputs->value, -opt_outputs->value};
+        continue;
+      }
+    }
+    p->fut = p->prom.get_future();
+    queue_.Push(QueueItem{inputs, &p->prom});
+    pending.push_back(std::move(p));
+  }
+  for (std::unique_ptr<Pending>& p : pending) {
+    VPNetModel::InferenceOutputs outputs = p->fut.get();
+    if (cache_) {
+      cache_->Set(p->key, outputs);
+    }
+    values[p->index] = {outputs.value, -outputs.value};
+  }
+  return values;
+}
+
 open_spiel::ActionsAndProbs VPNetEvaluator::Prior(const State& state) {
   if (state.IsChanceNode()) {
     return state.ChanceOutcomes();
@@ -85,16 +141,15 @@ open_spiel::ActionsAndProbs VPNetEvaluator::Prior(const State& state) {
 }
 
 VPNetModel::InferenceOutputs VPNetEvaluator::Inference(const State& state) {
+  SPIEL_PROF_SCOPE("VPNetEvaluator::Inference");
   VPNetModel::InferenceInputs inputs = {state.LegalActions(),
                                         state.ObservationTensor()};
 
   uint64_t key;
-  int cache_shard;
-  if (!cache_.empty()) {
+  if (cache_) {
     key = absl::Hash<VPNetModel::InferenceInputs>{}(inputs);
-    cache_shard = key % cache_.size();
     absl::optional<const VPNetModel::InferenceOutputs> opt_outputs =
-        cache_[cache_shard]->Get(key);
+        cache_->Get(key);
     if (opt_outputs) {
       return *opt_outputs;
     }
@@ -108,8 +163,8 @@ VPNetModel::InferenceOutputs VPNetEvaluator::Inference(const State& state) {
     queue_.Push(QueueItem{inputs, &prom});
     outputs = fut.get();
   }
-  if (!cache_.empty()) {
-    cache_[cache_shard]->Set(key, outputs);
+  if (cache_) {
+    cache_->Set(key, outputs);
   }
   return outputs;
 }
@@ -131,7 +186,12 @@ void VPNetEvaluator::Runner() {
           break;
         }
         if (inputs.empty()) {
-          deadline = absl::Now() + absl::Milliseconds(1);
+          // Wait for stragglers, but no longer than a fraction of a typical
+          // inference call; past that point flushing a partial batch is
+          // cheaper than stalling the actors that are already enqueued.
+          deadline = absl::Now() + absl::Microseconds(
+                                       adaptive_deadline_us_.load(
+                                           std::memory_order_relaxed));
         }
         inputs.push_back(item->inputs);
         promises.push_back(item->prom);
@@ -142,17 +202,31 @@ void VPNetEvaluator::Runner() {
       continue;
     }
 
+    absl::Time inference_start = absl::Now();
+    std::vector<VPNetModel::InferenceOutputs> outputs =
+        device_manager_.Get(inputs.size())->Inference(inputs);
+    int64_t latency_us = absl::ToInt64Microseconds(
+        absl::Now() - inference_start);
+    for (int i = 0; i < promises.size(); ++i) {
+      promises[i]->set_value(outputs[i]);
+    }
+
     {
       absl::MutexLock lock(&stats_m_);
       batch_size_stats_.Add(inputs.size());
       batch_size_hist_.Add(inputs.size());
+      batch_occupancy_stats_.Add(
+          static_cast<double>(inputs.size()) / batch_size_);
+      inference_latency_ewma_us_ =
+          inference_latency_ewma_us_ == 0
+              ? latency_us
+              : 0.9 * inference_latency_ewma_us_ + 0.1 * latency_us;
+      adaptive_deadline_us_.store(
+          std::clamp(static_cast<int64_t>(inference_latency_ewma_us_ / 2),
+                     kMinFlushDeadlineUs, max_flush_deadline_us_),
+          std::memory_order_relaxed);
     }
 
-    std::vector<VPNetModel::InferenceOutputs> outputs =
-        device_manager_.Get(inputs.size())->Inference(inputs);
-    for (int i = 0; i < promises.size(); ++i) {
-      promises[i]->set_value(outputs[i]);
-    }
     inputs.clear();
     promises.clear();
   }
@@ -162,6 +236,7 @@ void VPNetEvaluator::ResetBatchSizeStats() {
   absl::MutexLock lock(&stats_m_);
   batch_size_stats_.Reset();
   batch_size_hist_.Reset();
+  batch_occupancy_stats_.Reset();
 }
 
 open_spiel::BasicStats VPNetEvaluator::BatchSizeStats() {
@@ -174,6 +249,11 @@ open_spiel::HistogramNumbered VPNetEvaluator::BatchSizeHistogram() {
   return batch_size_hist_;
 }
 
+open_spiel::BasicStats VPNetEvaluator::BatchOccupancyStats() {
+  absl::MutexLock lock(&stats_m_);
+  return batch_occupancy_stats_;
+}
+
 }  // namespace torch_az
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -15,6 +15,8 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_VPEVALUATOR_H_
 #define OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_VPEVALUATOR_H_
 
+#include <atomic>
+#include <cstdint>
 #include <future>  // NOLINT
 #include <vector>
 
@@ -34,13 +36,24 @@ namespace torch_az {
 
 class VPNetEvaluator : public Evaluator {
  public:
+  // max_flush_deadline_us bounds how long a partially full batch may wait for
+  // more work before being flushed to the device. The effective deadline is
+  // adapted online: it tracks roughly half the observed inference latency, so
+  // short batches are not delayed longer than they would take to evaluate.
   explicit VPNetEvaluator(DeviceManager* device_manager, int batch_size,
-                          int threads, int cache_size, int cache_shards = 1);
+                          int threads, int cache_size, int cache_shards = 1,
+                          int64_t max_flush_deadline_us = 1000);
   ~VPNetEvaluator() override;
 
   // Return a value of this state for each player.
   std::vector<double> Evaluate(const State& state) override;
 
+  // Return values for a batch of states. All cache misses are enqueued before
+  // any result is awaited, so the whole batch can be served by one (or a few)
+  // device calls even when issued from a single thread.
+  std::vector<std::vector<double>> EvaluateBatch(
+      absl::Span<const State* const> states) override;
+
   // Return a policy: the probability of the current player playing each action.
   ActionsAndProbs Prior(const State& state) override;
 
@@ -51,13 +64,17 @@ class VPNetEvaluator : public Evaluator {
   open_spiel::BasicStats BatchSizeStats();
   open_spiel::HistogramNumbered BatchSizeHistogram();
 
+  // Fraction of the configured batch size filled per inference call, in [0, 1].
+  open_spiel::BasicStats BatchOccupancyStats();
+
  private:
   VPNetModel::InferenceOutputs Inference(const State& state);
 
   void Runner();
 
   DeviceManager& device_manager_;
-  std::vector<std::unique_ptr<LRUCache<uint64_t, VPNetModel::InferenceOutputs>>>
+  // Null when caching is disabled (cache_size <= 0).
+  std::unique_ptr<ShardedLRUCache<uint64_t, VPNetModel::InferenceOutputs>>
       cache_;
   const int batch_size_;
 
@@ -71,9 +88,16 @@ class VPNetEvaluator : public Evaluator {
   std::vector<Thread> inference_threads_;
   absl::Mutex inference_queue_m_;  // Only one thread at a time should pop.
 
+  // Adaptive flush deadline, in microseconds. Written by whichever runner
+  // thread last timed an inference call, read before each partial-batch wait.
+  const int64_t max_flush_deadline_us_;
+  std::atomic<int64_t> adaptive_deadline_us_;
+
   absl::Mutex stats_m_;
   open_spiel::BasicStats batch_size_stats_;
   open_spiel::HistogramNumbered batch_size_hist_;
+  open_spiel::BasicStats batch_occupancy_stats_;
+  double inference_latency_ewma_us_ = 0;  // Guarded by stats_m_.
 };
 
 }  // namespace torch_az
@@ -22,6 +22,7 @@
 #include <memory>
 #include <numeric>
 #include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -109,8 +110,12 @@ bool CreateGraphDef(const Game& game, double learning_rate, double weight_decay,
 }
 
 VPNetModel::VPNetModel(const Game &game, const std::string &path,
-                       const std::string &file_name, const std::string &device)
+                       const std::string &file_name, const std::string &device,
+                       bool use_fused_inference,
+                       InferencePrecision inference_precision)
     : device_(device), path_(path),
+      use_fused_inference_(use_fused_inference),
+      inference_precision_(inference_precision),
       flat_input_size_(game.ObservationTensorSize()),
       num_actions_(game.NumDistinctActions()),
       model_config_(LoadModelConfig(path, file_name)),
@@ -146,10 +151,41 @@ void VPNetModel::LoadCheckpoint(const std::string& path) {
   torch::load(model_, absl::StrCat(path, ".pt"), torch_device_);
   torch::load(model_optimizer_, absl::StrCat(path, "-optimizer.pt"),
               torch_device_);
+  fused_model_stale_ = true;
+}
+
+torch::Dtype VPNetModel::InferenceDtype() const {
+  switch (inference_precision_) {
+    case InferencePrecision::kFloat32:
+      return torch::kFloat32;
+    case InferencePrecision::kFloat16:
+      return torch::kFloat16;
+    case InferencePrecision::kBFloat16:
+      return torch::kBFloat16;
+  }
+  SpielFatalError("Unknown inference precision.");
+}
+
+void VPNetModel::RefreshInferenceModel() {
+  if (inference_model_.is_empty()) {
+    inference_model_ = Model(model_config_, TorchDeviceName(device_));
+    inference_model_->to(torch_device_);
+  }
+  std::stringstream stream;
+  torch::save(model_, stream);
+  torch::load(inference_model_, stream);
+  inference_model_->FreezeAndFuse();
+  if (inference_precision_ != InferencePrecision::kFloat32) {
+    inference_model_->to(InferenceDtype());
+  }
+  fused_model_stale_ = false;
 }
 
 std::vector<VPNetModel::InferenceOutputs> VPNetModel::Inference(
     const std::vector<InferenceInputs>& inputs) {
+  // Inference never needs the autograd graph.
+  torch::NoGradGuard no_grad;
+
   int inference_batch_size = inputs.size();
 
   // Torch tensors by default use a dense, row-aligned memory layout.
@@ -175,9 +211,24 @@ std::vector<VPNetModel::InferenceOutputs> VPNetModel::Inference(
   }
 
   // Run the inference.
-  model_->eval();
-  std::vector<torch::Tensor> torch_outputs =
-      model_(torch_inf_inputs, torch_inf_legal_mask);
+  std::vector<torch::Tensor> torch_outputs;
+  if (UseInferenceCopy()) {
+    if (fused_model_stale_) {
+      RefreshInferenceModel();
+    }
+    if (inference_precision_ != InferencePrecision::kFloat32) {
+      torch_inf_inputs = torch_inf_inputs.to(InferenceDtype());
+    }
+    torch_outputs = inference_model_(torch_inf_inputs, torch_inf_legal_mask);
+    if (inference_precision_ != InferencePrecision::kFloat32) {
+      // Hand results back to the callers in full precision.
+      torch_outputs[0] = torch_outputs[0].to(torch::kFloat32);
+      torch_outputs[1] = torch_outputs[1].to(torch::kFloat32);
+    }
+  } else {
+    model_->eval();
+    torch_outputs = model_(torch_inf_inputs, torch_inf_legal_mask);
+  }
 
   torch::Tensor value_batch = torch_outputs[0];
   torch::Tensor policy_batch = torch_outputs[1];
@@ -253,6 +304,8 @@ VPNetModel::LossInfo VPNetModel::Learn(const std::vector<TrainInputs>& inputs) {
 
   model_optimizer_.step();
 
+  fused_model_stale_ = true;
+
   return LossInfo(torch_outputs[0].item<float>(),
                   torch_outputs[1].item<float>(),
                   torch_outputs[2].item<float>());
@@ -79,7 +79,9 @@ std::vector<VPNetModel::TrainInputs> SolveGame() {
 }
 
 VPNetModel BuildModel(const Game& game, const std::string& nn_model,
-                      bool create_graph) {
+                      bool create_graph, bool use_fused_inference = false,
+                      VPNetModel::InferencePrecision inference_precision =
+                          VPNetModel::InferencePrecision::kFloat32) {
   std::string tmp_dir = open_spiel::file::GetTmpDir();
   std::string filename =
       absl::StrCat("open_spiel_vpnet_test_", nn_model, ".pb");
@@ -95,7 +97,8 @@ VPNetModel BuildModel(const Game& game, const std::string& nn_model,
   std::string model_path = absl::StrCat(tmp_dir, "/", filename);
   SPIEL_CHECK_TRUE(file::Exists(model_path));
 
-  VPNetModel model(game, tmp_dir, filename, "/cpu:0");
+  VPNetModel model(game, tmp_dir, filename, "/cpu:0", use_fused_inference,
+                   inference_precision);
 
   return model;
 }
@@ -121,6 +124,73 @@ void TestModelCreation(const std::string& nn_model) {
   model.Learn(train_inputs);
 }
 
+// The fused inference path computes the same values as the eager path.
+void TestFusedInference(const std::string& nn_model) {
+  std::cout << "TestFusedInference: " << nn_model << std::endl;
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  VPNetModel model = BuildModel(*game, nn_model, false);
+  VPNetModel fused_model =
+      BuildModel(*game, nn_model, false, /*use_fused_inference=*/true);
+
+  std::unique_ptr<open_spiel::State> state = game->NewInitialState();
+  std::vector<Action> legal_actions = state->LegalActions();
+  std::vector<float> obs = state->ObservationTensor();
+
+  // Train a little so the batch norm statistics differ from their
+  // initialization, then give both models the same weights.
+  std::vector<VPNetModel::TrainInputs> train_inputs;
+  train_inputs.emplace_back(VPNetModel::TrainInputs{
+      legal_actions, obs, ActionsAndProbs({{legal_actions[0], 1}}), 0});
+  for (int i = 0; i < 10; i++) {
+    model.Learn(train_inputs);
+  }
+  fused_model.LoadCheckpoint(model.SaveCheckpoint(/*step=*/0));
+
+  VPNetModel::InferenceInputs inputs = {legal_actions, obs};
+  std::vector<VPNetModel::InferenceOutputs> expected =
+      model.Inference(std::vector{inputs});
+  std::vector<VPNetModel::InferenceOutputs> actual =
+      fused_model.Inference(std::vector{inputs});
+  SPIEL_CHECK_EQ(expected.size(), actual.size());
+  SPIEL_CHECK_FLOAT_NEAR(actual[0].value, expected[0].value, 1e-4);
+  SPIEL_CHECK_EQ(expected[0].policy.size(), actual[0].policy.size());
+  for (int i = 0; i < expected[0].policy.size(); ++i) {
+    SPIEL_CHECK_EQ(actual[0].policy[i].first, expected[0].policy[i].first);
+    SPIEL_CHECK_FLOAT_NEAR(actual[0].policy[i].second,
+                           expected[0].policy[i].second, 1e-4);
+  }
+}
+
+// Reduced-precision inference stays close to the FP32 results. BF16 is used
+// because it also runs on CPU.
+void TestReducedPrecisionInference(const std::string& nn_model) {
+  std::cout << "TestReducedPrecisionInference: " << nn_model << std::endl;
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  VPNetModel model = BuildModel(*game, nn_model, false);
+  VPNetModel bf16_model =
+      BuildModel(*game, nn_model, false, /*use_fused_inference=*/false,
+                 VPNetModel::InferencePrecision::kBFloat16);
+
+  std::unique_ptr<open_spiel::State> state = game->NewInitialState();
+  std::vector<Action> legal_actions = state->LegalActions();
+  std::vector<float> obs = state->ObservationTensor();
+  bf16_model.LoadCheckpoint(model.SaveCheckpoint(/*step=*/0));
+
+  VPNetModel::InferenceInputs inputs = {legal_actions, obs};
+  std::vector<VPNetModel::InferenceOutputs> expected =
+      model.Inference(std::vector{inputs});
+  std::vector<VPNetModel::InferenceOutputs> actual =
+      bf16_model.Inference(std::vector{inputs});
+  SPIEL_CHECK_EQ(expected.size(), actual.size());
+  SPIEL_CHECK_FLOAT_NEAR(actual[0].value, expected[0].value, 0.05);
+  SPIEL_CHECK_EQ(expected[0].policy.size(), actual[0].policy.size());
+  for (int i = 0; i < expected[0].policy.size(); ++i) {
+    SPIEL_CHECK_EQ(actual[0].policy[i].first, expected[0].policy[i].first);
+    SPIEL_CHECK_FLOAT_NEAR(actual[0].policy[i].second,
+                           expected[0].policy[i].second, 0.05);
+  }
+}
+
 // Can learn a single trajectory
 void TestModelLearnsSimple(const std::string& nn_model) {
   std::cout << "TestModelLearnsSimple: " << nn_model << std::endl;
@@ -205,6 +275,8 @@ int main(int argc, char** argv) {
   // Tests below here reuse the graphs created above. Graph creation is slow
   // due to calling a separate python process.
 
+  open_spiel::algorithms::torch_az::TestFusedInference("resnet");
+  open_spiel::algorithms::torch_az::TestReducedPrecisionInference("resnet");
   open_spiel::algorithms::torch_az::TestModelLearnsSimple("resnet");
 
   auto train_inputs = open_spiel::algorithms::torch_az::SolveGame();
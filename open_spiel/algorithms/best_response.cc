@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/btree_set.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/algorithms/history_tree.h"
 #include "open_spiel/policy.h"
@@ -72,6 +73,87 @@ TabularBestResponse::TabularBestResponse(
   }
 }
 
+void TabularBestResponse::SetPolicy(const Policy* policy) {
+  policy_ = policy;
+
+  // Find the opponent infosets whose policy actually changed since the last
+  // call. On the first call nothing has been snapshotted yet, so every
+  // opponent infoset counts as changed and the caches are cleared wholesale,
+  // as before.
+  absl::flat_hash_set<std::string> changed_infostates;
+  for (auto& [infostate, infoset] : infosets_) {
+    HistoryNode* node = infoset[0].first;
+    if (node->GetType() != StateType::kDecision ||
+        node->GetState()->CurrentPlayer() == best_responder_) {
+      continue;
+    }
+    ActionsAndProbs state_policy = policy_->GetStatePolicy(*node->GetState());
+    auto it = policy_snapshots_.find(infostate);
+    if (it == policy_snapshots_.end() || it->second != state_policy) {
+      changed_infostates.insert(infostate);
+      policy_snapshots_[infostate] = std::move(state_policy);
+    }
+  }
+  if (changed_infostates.empty()) return;
+
+  // Best responses are chosen per infoset, not per history, so staleness
+  // spreads beyond the subtrees below the changed opponent infosets: once any
+  // history of a best-responder infoset is stale, the infoset's best action
+  // may change, which stales its sibling histories and their ancestors --
+  // possibly reaching further best-responder infosets. Iterate the sweep
+  // until the set of stale infosets stops growing; erasure is idempotent, so
+  // re-running it as the set grows is harmless.
+  absl::flat_hash_set<std::string> stale_infosets;
+  while (true) {
+    const size_t num_stale = stale_infosets.size();
+    InvalidateStaleEntries(tree_.Root(), changed_infostates,
+                           /*ancestor_changed=*/false, &stale_infosets);
+    if (stale_infosets.size() == num_stale) break;
+  }
+
+  // The counter-factual reach probabilities stored in the infosets depend on
+  // the opponent policy, so they are rebuilt against the new one. The history
+  // nodes themselves are reused.
+  infosets_ = GetAllInfoSets(root_->Clone(), best_responder_, policy_, &tree_);
+}
+
+bool TabularBestResponse::InvalidateStaleEntries(
+    HistoryNode* node,
+    const absl::flat_hash_set<std::string>& changed_infostates,
+    bool ancestor_changed,
+    absl::flat_hash_set<std::string>* stale_infosets) {
+  const bool best_responder_node =
+      node->GetType() == StateType::kDecision &&
+      node->GetState()->CurrentPlayer() == best_responder_;
+  // A changed opponent infoset stales its whole subtree; a stale
+  // best-responder infoset stales only its member histories and (through the
+  // return value) their ancestors, since the values below them are computed
+  // under unchanged policies.
+  const bool subtree_stale =
+      ancestor_changed || changed_infostates.contains(node->GetInfoState());
+  bool dirty =
+      subtree_stale ||
+      (best_responder_node && stale_infosets->contains(node->GetInfoState()));
+  bool descendant_dirty = false;
+  for (Action action : node->GetChildActions()) {
+    HistoryNode* child = node->GetChild(action).second;
+    if (child == nullptr)
+      SpielFatalError("InvalidateStaleEntries: node is null.");
+    descendant_dirty |= InvalidateStaleEntries(child, changed_infostates,
+                                               subtree_stale, stale_infosets);
+  }
+  dirty = dirty || descendant_dirty;
+  if (dirty) {
+    value_cache_.erase(node->GetHistory());
+    if (best_responder_node) {
+      stale_infosets->insert(node->GetInfoState());
+      best_response_policy_.erase(node->GetInfoState());
+      best_response_actions_.erase(node->GetInfoState());
+    }
+  }
+  return dirty;
+}
+
 double TabularBestResponse::HandleTerminalCase(const HistoryNode& node) const {
   return node.GetValue();
 }
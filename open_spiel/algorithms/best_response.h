@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
 #include "open_spiel/algorithms/history_tree.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
@@ -108,17 +109,19 @@ class TabularBestResponse {
       SpielFatalError(
           "TabularBestResponse is returning the max-entropy best-response but "
           "deterministic best-response is requested.");
-    // If the best_response_policy_ cache is empty, we fill it by
-    // calculating all best responses, starting at the root.
-    if (best_response_actions_.empty()) Value(*root_);
+    // Fill any stale or missing cache entries by (re)calculating best
+    // responses from the root. This is a single lookup when everything is
+    // cached, and recomputes exactly the entries that SetPolicy invalidated.
+    Value(*root_);
     return best_response_actions_;
   }
 
   // Returns the computed best response as a policy object.
   TabularPolicy GetBestResponsePolicy() {
-    // If the best_response_policy_ cache is empty, we fill it by calculating
-    // all best responses, starting at the root.
-    if (best_response_policy_.empty()) Value(*root_);
+    // Fill any stale or missing cache entries by (re)calculating best
+    // responses from the root. This is a single lookup when everything is
+    // cached, and recomputes exactly the entries that SetPolicy invalidated.
+    Value(*root_);
     return TabularPolicy(best_response_policy_);
   }
 
@@ -130,16 +133,14 @@ class TabularBestResponse {
   // Changes the policy that we are calculating a best response to. This is
   // useful as a large amount of the data structures can be reused, causing
   // the calculation to be quicker than if we had to re-initialize the class.
-  void SetPolicy(const Policy* policy) {
-    policy_ = policy;
-    value_cache_.clear();
-    best_response_actions_.clear();
-    best_response_policy_.clear();
-    // TODO(author1): Replace this with something that traverses the tree
-    // and rebuilds the probabilities.
-    infosets_ =
-        GetAllInfoSets(root_->Clone(), best_responder_, policy_, &tree_);
-  }
+  // Cached values are also kept wherever the new policy agrees with the old
+  // one: only the entries at opponent infosets whose policy actually changed,
+  // below them (where the counter-factual reach probabilities change) and
+  // above them (where the values change) are dropped and recomputed on the
+  // next query. For callers that update a few infosets per iteration (e.g.
+  // CFR-BR or RNR loops), repeated best-response computation only pays for
+  // the changed part of the tree.
+  void SetPolicy(const Policy* policy);
 
   // Set the policy given a policy table. This stores the table internally.
   void SetPolicy(
@@ -164,6 +165,19 @@ class TabularBestResponse {
   // have nothing to do.
   double HandleTerminalCase(const HistoryNode& node) const;
 
+  // Drops the cache entries that a policy change at changed_infostates can
+  // affect: entries at and below those infosets, entries at their ancestors,
+  // and -- because best responses are chosen per infoset -- the entries of
+  // every history sharing an infoset with a dropped best-responder history.
+  // Best-responder infosets dropped so far accumulate in stale_infosets;
+  // SetPolicy re-runs the sweep until that set reaches a fixed point.
+  // Returns whether anything in the subtree rooted at node was dropped, so
+  // ancestors know to drop their own entries.
+  bool InvalidateStaleEntries(
+      HistoryNode* node,
+      const absl::flat_hash_set<std::string>& changed_infostates,
+      bool ancestor_changed, absl::flat_hash_set<std::string>* stale_infosets);
+
   Player best_responder_;
 
   // Used to store a specific policy if not passed in from the caller.
@@ -201,6 +215,11 @@ class TabularBestResponse {
   // biased deterministic best-response.
   std::unordered_map<std::string, Action> best_response_actions_;
 
+  // The opponent policy seen by the last SetPolicy call, per infostate, used
+  // to detect which infosets actually changed. Empty until the first call,
+  // so the first SetPolicy treats every opponent infoset as changed.
+  absl::flat_hash_map<std::string, ActionsAndProbs> policy_snapshots_;
+
   // Caches all values calculated so far (for each history).
   std::unordered_map<std::string, double> value_cache_;
   std::unique_ptr<State> root_;
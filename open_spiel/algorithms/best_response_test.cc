@@ -506,6 +506,38 @@ void KuhnPokerExploitabilityDescentMinimalSimulationPid0() {
   }
 }
 
+void KuhnPokerIncrementalSetPolicyMatchesFreshComputation() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  auto best_responder = Player{1};
+  TabularPolicy policy = GetUniformPolicy(*game);
+  TabularBestResponse response(*game, best_responder, &policy);
+  response.Value(*game->NewInitialState());
+
+  // Change the policy at a single opponent infoset. Only the part of the
+  // tree that change can affect is recomputed; the result must match a
+  // best response built from scratch against the modified policy.
+  TabularPolicy modified_policy = GetUniformPolicy(*game);
+  modified_policy.SetStatePolicy("0", {{0, 0.25}, {1, 0.75}});
+  response.SetPolicy(&modified_policy);
+
+  TabularBestResponse fresh_response(*game, best_responder, &modified_policy);
+  SPIEL_CHECK_FLOAT_EQ(response.Value(*game->NewInitialState()),
+                       fresh_response.Value(*game->NewInitialState()));
+  std::unordered_map<std::string, Action> incremental_actions =
+      response.GetBestResponseActions();
+  std::unordered_map<std::string, Action> fresh_actions =
+      fresh_response.GetBestResponseActions();
+  SPIEL_CHECK_EQ(incremental_actions.size(), fresh_actions.size());
+  for (const auto& [infostate, action] : fresh_actions) {
+    SPIEL_CHECK_EQ(incremental_actions.at(infostate), action);
+  }
+
+  // Setting the same policy again changes nothing and keeps the caches warm.
+  response.SetPolicy(&modified_policy);
+  SPIEL_CHECK_FLOAT_EQ(response.Value(*game->NewInitialState()),
+                       fresh_response.Value(*game->NewInitialState()));
+}
+
 void CheckBestResponseValuesAgainstGoldenValues(
     const Game& game, Player best_responder, const TabularPolicy& policy,
     const std::vector<std::pair<std::string, double>>& golden_values) {
@@ -591,4 +623,6 @@ int main(int argc, char** argv) {
   // Verifies that the code automatically generates the best response actions
   // after swapping policies.
   open_spiel::algorithms::KuhnPokerUniformBestResponseAfterSwitchingPolicies();
+  open_spiel::algorithms::
+      KuhnPokerIncrementalSetPolicyMatchesFreshComputation();
 }
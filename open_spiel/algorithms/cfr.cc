@@ -23,6 +23,7 @@
 #include "open_spiel/abseil-cpp/absl/strings/numbers.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/profiler.h"
 #include "open_spiel/utils/serialization.h"
 
 namespace open_spiel {
@@ -236,7 +237,8 @@ void CFRSolverBase::InitializeInfostateNodes(const State& state) {
     return;
   }
   if (state.IsChanceNode()) {
-    for (const auto& action_prob : state.ChanceOutcomes()) {
+    ActionsAndProbs scratch;
+    for (const auto& action_prob : ChanceOutcomesRef(state, &scratch)) {
       InitializeInfostateNodes(*state.Child(action_prob.first));
     }
     return;
@@ -260,30 +262,72 @@ void CFRSolverBase::InitializeInfostateNodes(const State& state) {
   }
 }
 
+int64_t CFRSolverBase::InfoStateValuesMemoryFootprint() const {
+  // flat_hash_map stores one control byte plus one slot (key + value pair)
+  // per bucket; count capacity, not just size, since the empty buckets are
+  // held too.
+  int64_t bytes =
+      sizeof(info_states_) +
+      info_states_.capacity() *
+          (1 + sizeof(CFRInfoStateValuesTable::value_type));
+  for (const auto& [info_state, values] : info_states_) {
+    // Short keys live inline in the std::string and are already counted.
+    if (info_state.capacity() > sizeof(std::string)) {
+      bytes += info_state.capacity();
+    }
+    bytes += values.MemoryFootprint() - sizeof(CFRInfoStateValues);
+  }
+  return bytes;
+}
+
 void CFRSolverBase::EvaluateAndUpdatePolicy() {
+  SPIEL_PROF_SCOPE("CFRSolverBase::EvaluateAndUpdatePolicy");
   ++iteration_;
+  // The regret-matching-plus clamp and regret-matching refresh that
+  // logically end each update pass are applied lazily, per infostate, on the
+  // entry's next touch (see RefreshInfoState); advancing the generation is
+  // all that marks them pending. This keeps per-iteration cost proportional
+  // to the infostates actually visited (zero-reach subtrees are pruned from
+  // the walk) instead of sweeping the whole table.
   if (alternating_updates_) {
     for (int player = 0; player < game_->NumPlayers(); player++) {
       ComputeCounterFactualRegret(*root_state_, player, root_reach_probs_,
                                   nullptr);
-      if (regret_matching_plus_) {
-        ApplyRegretMatchingPlusReset();
-      }
-      ApplyRegretMatching();
+      ++update_generation_;
     }
   } else {
     ComputeCounterFactualRegret(*root_state_, absl::nullopt, root_reach_probs_,
                                 nullptr);
-    if (regret_matching_plus_) {
-      ApplyRegretMatchingPlusReset();
+    ++update_generation_;
+  }
+}
+
+void CFRSolverBase::RefreshInfoState(CFRInfoStateValues* is_vals) const {
+  if (is_vals->last_refresh == update_generation_) return;
+  // One clamp stands in for the clamp of every missed pass: with no
+  // intervening increments, clamping is idempotent.
+  if (regret_matching_plus_) {
+    for (double& regret : is_vals->cumulative_regrets) {
+      regret = std::max(regret, 0.0);
     }
-    ApplyRegretMatching();
+  }
+  is_vals->ApplyRegretMatching();
+  is_vals->last_refresh = update_generation_;
+}
+
+void CFRSolverBase::FlushLazyUpdates() const {
+  if (update_generation_ == 0) return;
+  for (auto& entry : info_states_) {
+    RefreshInfoState(&entry.second);
   }
 }
 
 std::string CFRSolverBase::Serialize(int double_precision,
                                      std::string delimiter) const {
   SPIEL_CHECK_GE(double_precision, -1);
+  // Materialize any deferred clamps/refreshes so the serialized table does
+  // not depend on when entries were last touched.
+  FlushLazyUpdates();
   std::string str = "";
   // Meta section
   absl::StrAppend(&str,
@@ -336,7 +380,11 @@ std::vector<double> CFRSolverBase::ComputeCounterFactualRegret(
     return state.Returns();
   }
   if (state.IsChanceNode()) {
-    ActionsAndProbs actions_and_probs = state.ChanceOutcomes();
+    // Games with fixed chance distributions share them game-wide, so this
+    // usually copies nothing.
+    ActionsAndProbs scratch;
+    const ActionsAndProbs& actions_and_probs =
+        ChanceOutcomesRef(state, &scratch);
     std::vector<double> dist(actions_and_probs.size(), 0);
     std::vector<Action> outcomes(actions_and_probs.size(), 0);
     for (int oidx = 0; oidx < actions_and_probs.size(); ++oidx) {
@@ -375,33 +423,34 @@ std::vector<double> CFRSolverBase::ComputeCounterFactualRegret(
           state, alternating_player, reach_probabilities, current_player,
           info_state_policy, legal_actions, &child_utilities, policy_overrides);
 
-  // Perform regret and average strategy updates.
+  // Perform regret and average strategy updates. The entry is updated in
+  // place (copying CFRInfoStateValues in and out costs two allocations per
+  // vector per node visit), with the per-action weights hoisted so both
+  // accumulations are simple vectorizable multiply-add loops.
   if (!alternating_player || *alternating_player == current_player) {
-    CFRInfoStateValues is_vals = info_states_[info_state];
+    CFRInfoStateValues& is_vals = info_states_[info_state];
     SPIEL_CHECK_FALSE(is_vals.empty());
+    // Any clamp deferred from a previous pass must land before this pass's
+    // increments (GetPolicy already refreshed the entry on the common path;
+    // this covers the policy-override path used by CFR-BR).
+    RefreshInfoState(&is_vals);
 
     const double self_reach_prob = reach_probabilities[current_player];
     const double cfr_reach_prob =
         CounterFactualReachProb(reach_probabilities, current_player);
+    const double policy_weight = linear_averaging_
+                                     ? iteration_ * self_reach_prob
+                                     : self_reach_prob;
+    const double baseline = state_value[current_player];
 
     for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
       // Update regrets.
-      double cfr_regret = cfr_reach_prob *
-                          (child_utilities[aidx] - state_value[current_player]);
-
-      is_vals.cumulative_regrets[aidx] += cfr_regret;
-
+      is_vals.cumulative_regrets[aidx] +=
+          cfr_reach_prob * (child_utilities[aidx] - baseline);
       // Update average policy.
-      if (linear_averaging_) {
-        is_vals.cumulative_policy[aidx] +=
-            iteration_ * self_reach_prob * info_state_policy[aidx];
-      } else {
-        is_vals.cumulative_policy[aidx] +=
-            self_reach_prob * info_state_policy[aidx];
-      }
+      is_vals.cumulative_policy[aidx] +=
+          policy_weight * info_state_policy[aidx];
     }
-
-    info_states_[info_state] = is_vals;
   }
 
   return state_value;
@@ -489,6 +538,7 @@ std::vector<double> CFRSolverBase::GetPolicy(
   SPIEL_CHECK_FALSE(entry == info_states_.end());
   SPIEL_CHECK_FALSE(entry->second.empty());
   SPIEL_CHECK_FALSE(entry->second.current_policy.empty());
+  RefreshInfoState(&entry->second);
   return entry->second.current_policy;
 }
 
@@ -594,22 +644,24 @@ void CFRInfoStateValues::ApplyRegretMatchingAllPositive(double delta) {
 }
 
 void CFRInfoStateValues::ApplyRegretMatching() {
+  // Both loops are written branch-free (clamping via std::max, division
+  // replaced by a hoisted reciprocal) so that compilers can vectorize them;
+  // for wide action sets this is the hottest kernel in tabular CFR.
+  const int n = num_actions();
   double sum_positive_regrets = 0.0;
-
-  for (int aidx = 0; aidx < num_actions(); ++aidx) {
-    if (cumulative_regrets[aidx] > 0) {
-      sum_positive_regrets += cumulative_regrets[aidx];
-    }
+  for (int aidx = 0; aidx < n; ++aidx) {
+    sum_positive_regrets += std::max(cumulative_regrets[aidx], 0.0);
   }
 
-  for (int aidx = 0; aidx < num_actions(); ++aidx) {
-    if (sum_positive_regrets > 0) {
-      current_policy[aidx] =
-          cumulative_regrets[aidx] > 0
-              ? cumulative_regrets[aidx] / sum_positive_regrets
-              : 0;
-    } else {
-      current_policy[aidx] = 1.0 / legal_actions.size();
+  if (sum_positive_regrets > 0) {
+    const double inv_sum = 1.0 / sum_positive_regrets;
+    for (int aidx = 0; aidx < n; ++aidx) {
+      current_policy[aidx] = std::max(cumulative_regrets[aidx], 0.0) * inv_sum;
+    }
+  } else {
+    const double uniform = 1.0 / n;
+    for (int aidx = 0; aidx < n; ++aidx) {
+      current_policy[aidx] = uniform;
     }
   }
 }
@@ -682,10 +734,9 @@ void DeserializeCFRInfoStateValuesTable(absl::string_view serialized,
 //  performed as an additional step.
 void CFRSolverBase::ApplyRegretMatchingPlusReset() {
   for (auto& entry : info_states_) {
-    for (int aidx = 0; aidx < entry.second.num_actions(); ++aidx) {
-      if (entry.second.cumulative_regrets[aidx] < 0) {
-        entry.second.cumulative_regrets[aidx] = 0;
-      }
+    // Branch-free clamp so the loop vectorizes.
+    for (double& regret : entry.second.cumulative_regrets) {
+      regret = std::max(regret, 0.0);
     }
   }
 }
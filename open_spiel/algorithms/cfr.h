@@ -18,9 +18,9 @@
 #include <memory>
 #include <random>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
@@ -71,6 +71,15 @@ struct CFRInfoStateValues {
   bool empty() const { return legal_actions.empty(); }
   int num_actions() const { return legal_actions.size(); }
 
+  // Approximate bytes held by this entry (object plus heap), for memory
+  // telemetry.
+  int64_t MemoryFootprint() const {
+    return sizeof(*this) + legal_actions.capacity() * sizeof(Action) +
+           (cumulative_regrets.capacity() + cumulative_policy.capacity() +
+            current_policy.capacity()) *
+               sizeof(double);
+  }
+
   // A string representation of the information state values.
   std::string ToString() const;
 
@@ -95,13 +104,32 @@ struct CFRInfoStateValues {
   std::vector<double> cumulative_regrets;
   std::vector<double> cumulative_policy;
   std::vector<double> current_policy;
+
+  // The update generation this entry was last refreshed at; used by
+  // CFRSolverBase's lazy sweeps. Not serialized.
+  int last_refresh = 0;
 };
 
 CFRInfoStateValues DeserializeCFRInfoStateValues(absl::string_view serialized);
 
-// A type for tables holding CFR values.
+// A type for tables holding CFR values. An open-addressing flat map rather
+// than std::unordered_map: entries are stored inline in the backing array
+// with no per-entry heap node, which removes a pointer chase per lookup and
+// tens of bytes of overhead per infoset — significant for games with very
+// large infostate counts. Note that unlike std::unordered_map, references
+// into the table are invalidated by insertion (iterating and erasing remain
+// fine), so do not hold an entry reference across an insert.
 using CFRInfoStateValuesTable =
-    std::unordered_map<std::string, CFRInfoStateValues>;
+    absl::flat_hash_map<std::string, CFRInfoStateValues>;
+
+// A variant keyed on State::InformationStateKey() rather than the infostate
+// string. Hashing and comparing 64-bit keys is much cheaper than hashing
+// strings, and the table does not retain a copy of every key string, which
+// for large games (e.g. universal_poker) saves gigabytes. Keys can collide
+// with vanishingly small probability, so code using this table should verify
+// lookups against InformationStateString() under SPIEL_DCHECK.
+using HashedCFRInfoStateValuesTable =
+    absl::flat_hash_map<uint64_t, CFRInfoStateValues>;
 
 // The result parameter is passed by pointer in order to avoid copying/moving
 // the string once the table is fully serialized (CFRInfoStateValuesTable
@@ -215,15 +243,36 @@ class CFRSolverBase {
   // The returned policy instance should only be used during the lifetime of
   // the CFRSolver object.
   std::shared_ptr<Policy> CurrentPolicy() const {
+    FlushLazyUpdates();
     return std::make_shared<CFRCurrentPolicy>(info_states_, nullptr);
   }
 
   TabularPolicy TabularCurrentPolicy() const {
+    FlushLazyUpdates();
     CFRCurrentPolicy policy(info_states_, nullptr);
     return policy.AsTabular();
   }
 
-  CFRInfoStateValuesTable& InfoStateValuesTable() { return info_states_; }
+  CFRInfoStateValuesTable& InfoStateValuesTable() {
+    FlushLazyUpdates();
+    return info_states_;
+  }
+
+  // Approximate bytes held by the info-state table (keys, entries and hash
+  // table overhead), for logging solver memory growth. O(table size).
+  int64_t InfoStateValuesMemoryFootprint() const;
+
+  // EvaluateAndUpdatePolicy() defers the per-iteration regret-matching-plus
+  // clamp and current-policy refresh for each infostate until it is next
+  // touched by a tree walk, which avoids a full-table sweep per update pass.
+  // This computes identical updates (clamping is idempotent and regret
+  // matching only reads the positive part of the regrets), but entries that
+  // have not been touched since their last deferred operation hold a stale
+  // current_policy. This method applies all pending deferred operations; it
+  // is called before the table is exposed through the accessors above and
+  // before serialization, so only code reaching into info_states_ directly
+  // needs to call it explicitly.
+  void FlushLazyUpdates() const;
 
   // See comments above CFRInfoStateValues::Serialize(double_precision) for
   // notes about the double_precision parameter.
@@ -235,7 +284,10 @@ class CFRSolverBase {
 
   // Iteration to support linear_policy.
   int iteration_ = 0;
-  CFRInfoStateValuesTable info_states_;
+  // Mutable so that FlushLazyUpdates() can apply deferred refreshes from the
+  // const accessors; deferred operations never change the values observables
+  // are computed from, only when they are materialized.
+  mutable CFRInfoStateValuesTable info_states_;
   const std::unique_ptr<State> root_state_;
   const std::vector<double> root_reach_probs_;
 
@@ -287,6 +339,10 @@ class CFRSolverBase {
 
   void ApplyRegretMatchingPlusReset();
 
+  // Applies any regret-matching-plus clamp and current-policy refresh that
+  // was deferred for this entry since it was last touched.
+  void RefreshInfoState(CFRInfoStateValues* is_vals) const;
+
   std::vector<double> RegretMatching(const std::string& info_state,
                                      const std::vector<Action>& legal_actions);
 
@@ -300,6 +356,10 @@ class CFRSolverBase {
 
   const int chance_player_;
 
+  // Incremented after every update pass; entries whose last_refresh lags
+  // behind have a pending deferred clamp/refresh. See FlushLazyUpdates().
+  int update_generation_ = 0;
+
   // CFR generally does not use this random number generator. However, this is
   // used for random initial regrets (and could be useful for some helper
   // methods for debugging).
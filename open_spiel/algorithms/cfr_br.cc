@@ -14,8 +14,11 @@
 
 #include "open_spiel/algorithms/cfr_br.h"
 
+#include <vector>
+
 #include "open_spiel/algorithms/cfr.h"
 #include "open_spiel/policy.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -53,19 +56,26 @@ void CFRBRSolver::EvaluateAndUpdatePolicy() {
   std::vector<TabularPolicy> br_policies(game_->NumPlayers());
   std::shared_ptr<Policy> current_policy = CurrentPolicy();
 
-  // Set all the player's policies first.
+  // Compute each player's best response concurrently. Each
+  // TabularBestResponse owns its history tree and caches, and the shared
+  // current policy is only read here, so the per-player computations are
+  // independent.
+  std::vector<Thread> br_threads;
+  br_threads.reserve(game_->NumPlayers());
   for (int p = 0; p < game_->NumPlayers(); ++p) {
-    // Need to have an exception here because the CFR policy objects are
-    // wrappers around information that is contained in a table, and those do
-    // not exist until there's been a tree traversal to compute regrets below.
-    if (iteration_ > 1) {
-      best_response_computers_[p]->SetPolicy(current_policy.get());
-    }
+    br_threads.emplace_back([this, p, &br_policies, &current_policy]() {
+      // Need to have an exception here because the CFR policy objects are
+      // wrappers around information that is contained in a table, and those
+      // do not exist until there's been a tree traversal to compute regrets
+      // below.
+      if (iteration_ > 1) {
+        best_response_computers_[p]->SetPolicy(current_policy.get());
+      }
+      br_policies[p] = best_response_computers_[p]->GetBestResponsePolicy();
+    });
   }
-
-  // Now, for each player compute a best response
-  for (int p = 0; p < game_->NumPlayers(); ++p) {
-    br_policies[p] = best_response_computers_[p]->GetBestResponsePolicy();
+  for (auto& thread : br_threads) {
+    thread.join();
   }
 
   for (int p = 0; p < game_->NumPlayers(); ++p) {
@@ -0,0 +1,163 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/cfr_checkpoint.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+constexpr char kCheckpointMagic[8] = {'O', 'S', 'C', 'F', 'R', 'C', 'K', 'P'};
+constexpr uint32_t kCheckpointVersion = 1;
+
+// Appends the raw bytes of a trivially-copyable value / vector to `buffer`.
+template <typename T>
+void AppendRaw(const T& value, std::string* buffer) {
+  buffer->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+void AppendRawVector(const std::vector<T>& values, std::string* buffer) {
+  buffer->append(reinterpret_cast<const char*>(values.data()),
+                 values.size() * sizeof(T));
+}
+
+// A sequential reader over the loaded file contents that dies on truncation.
+class CheckpointReader {
+ public:
+  explicit CheckpointReader(std::string contents)
+      : contents_(std::move(contents)) {}
+
+  template <typename T>
+  T ReadRaw() {
+    T value;
+    std::memcpy(&value, Consume(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  void ReadRawVector(int64_t count, std::vector<T>* out) {
+    out->resize(count);
+    std::memcpy(out->data(), Consume(count * sizeof(T)), count * sizeof(T));
+  }
+
+  std::string ReadString(int64_t length) {
+    return std::string(Consume(length), length);
+  }
+
+  bool AtEnd() const { return offset_ == contents_.size(); }
+
+ private:
+  const char* Consume(int64_t num_bytes) {
+    if (offset_ + num_bytes > contents_.size()) {
+      SpielFatalError("LoadCFRCheckpoint: unexpected end of file.");
+    }
+    const char* ptr = contents_.data() + offset_;
+    offset_ += num_bytes;
+    return ptr;
+  }
+
+  std::string contents_;
+  int64_t offset_ = 0;
+};
+
+}  // namespace
+
+void SaveCFRCheckpoint(const std::string& filename,
+                       const std::string& solver_type,
+                       const std::string& serialized_game, int iteration,
+                       const CFRInfoStateValuesTable& info_states) {
+  file::File out(filename, "wb");
+
+  std::string buffer;
+  buffer.append(kCheckpointMagic, sizeof(kCheckpointMagic));
+  AppendRaw(kCheckpointVersion, &buffer);
+  AppendRaw<int64_t>(solver_type.size(), &buffer);
+  buffer.append(solver_type);
+  AppendRaw<int64_t>(serialized_game.size(), &buffer);
+  buffer.append(serialized_game);
+  AppendRaw<int64_t>(iteration, &buffer);
+  AppendRaw<int64_t>(info_states.size(), &buffer);
+  SPIEL_CHECK_TRUE(out.Write(buffer));
+
+  // One record per infostate, written as produced; the buffer is reused so
+  // peak memory stays at a single record regardless of table size.
+  for (const auto& [info_state, values] : info_states) {
+    buffer.clear();
+    AppendRaw<int64_t>(info_state.size(), &buffer);
+    buffer.append(info_state);
+    AppendRaw<int64_t>(values.num_actions(), &buffer);
+    AppendRawVector(values.legal_actions, &buffer);
+    AppendRawVector(values.cumulative_regrets, &buffer);
+    AppendRawVector(values.cumulative_policy, &buffer);
+    AppendRawVector(values.current_policy, &buffer);
+    SPIEL_CHECK_TRUE(out.Write(buffer));
+  }
+  SPIEL_CHECK_TRUE(out.Flush());
+}
+
+CFRCheckpoint LoadCFRCheckpoint(const std::string& filename) {
+  CheckpointReader reader(file::ReadContentsFromFile(filename, "rb"));
+
+  const std::string magic = reader.ReadString(sizeof(kCheckpointMagic));
+  if (magic != std::string(kCheckpointMagic, sizeof(kCheckpointMagic))) {
+    SpielFatalError(
+        absl::StrCat("LoadCFRCheckpoint: '", filename,
+                     "' is not a CFR checkpoint (bad magic)."));
+  }
+  const uint32_t version = reader.ReadRaw<uint32_t>();
+  if (version != kCheckpointVersion) {
+    SpielFatalError(absl::StrCat("LoadCFRCheckpoint: unsupported version ",
+                                 version, " (expected ", kCheckpointVersion,
+                                 ")."));
+  }
+
+  CFRCheckpoint checkpoint;
+  checkpoint.solver_type = reader.ReadString(reader.ReadRaw<int64_t>());
+  checkpoint.serialized_game = reader.ReadString(reader.ReadRaw<int64_t>());
+  checkpoint.iteration = reader.ReadRaw<int64_t>();
+  const int64_t num_entries = reader.ReadRaw<int64_t>();
+  SPIEL_CHECK_GE(num_entries, 0);
+
+  checkpoint.info_states.reserve(num_entries);
+  for (int64_t i = 0; i < num_entries; ++i) {
+    std::string info_state = reader.ReadString(reader.ReadRaw<int64_t>());
+    const int64_t num_actions = reader.ReadRaw<int64_t>();
+    SPIEL_CHECK_GE(num_actions, 0);
+    CFRInfoStateValues values;
+    reader.ReadRawVector(num_actions, &values.legal_actions);
+    reader.ReadRawVector(num_actions, &values.cumulative_regrets);
+    reader.ReadRawVector(num_actions, &values.cumulative_policy);
+    reader.ReadRawVector(num_actions, &values.current_policy);
+    checkpoint.info_states.emplace(std::move(info_state), std::move(values));
+  }
+  if (!reader.AtEnd()) {
+    SpielFatalError("LoadCFRCheckpoint: trailing bytes after last record.");
+  }
+  return checkpoint;
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
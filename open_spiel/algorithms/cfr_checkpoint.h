@@ -0,0 +1,67 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_CFR_CHECKPOINT_H_
+#define OPEN_SPIEL_ALGORITHMS_CFR_CHECKPOINT_H_
+
+#include <string>
+
+#include "open_spiel/algorithms/cfr.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// A binary, versioned checkpoint format for CFR solver state, intended for
+// large solves where the text format produced by CFRSolverBase::Serialize()
+// is too slow (stringifying every double) and doubles peak memory (the whole
+// checkpoint is materialized as one string before being written).
+//
+// The file layout is a fixed header (magic, format version, solver type,
+// serialized game, iteration count, entry count) followed by one
+// variable-length record per infostate holding the key string, the legal
+// actions, and the raw bytes of the three value vectors. Records are written
+// to the file as they are produced, so saving never materializes more than
+// one record in memory, and loading is a single sequential pass. Numeric
+// fields are stored in host byte order; checkpoints are not portable between
+// hosts of different endianness.
+
+// The in-memory image of a checkpoint file.
+struct CFRCheckpoint {
+  // Name of the solver class that produced the checkpoint, as reported by
+  // SerializeThisType() (e.g. "CFRSolver"); informational.
+  std::string solver_type;
+  // The game, in the format produced by Game::Serialize().
+  std::string serialized_game;
+  int iteration = 0;
+  CFRInfoStateValuesTable info_states;
+};
+
+// Writes a checkpoint to `filename`, replacing any existing file. Dies on
+// I/O errors.
+void SaveCFRCheckpoint(const std::string& filename,
+                       const std::string& solver_type,
+                       const std::string& serialized_game, int iteration,
+                       const CFRInfoStateValuesTable& info_states);
+
+// Reads a checkpoint written by SaveCFRCheckpoint. Dies if the file is
+// missing, truncated, or was written by an incompatible format version.
+// To resume a solve, construct the matching solver with the deserialized
+// game and checkpoint.iteration, then move checkpoint.info_states into
+// solver.InfoStateValuesTable().
+CFRCheckpoint LoadCFRCheckpoint(const std::string& filename);
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_CFR_CHECKPOINT_H_
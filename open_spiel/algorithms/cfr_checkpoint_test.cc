@@ -0,0 +1,78 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/cfr_checkpoint.h"
+
+#include <memory>
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/algorithms/tabular_exploitability.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void CheckpointRoundTripTest_KuhnPoker() {
+  const std::string filename =
+      absl::StrCat(file::GetTmpDir(), "/cfr_checkpoint_test.ckpt");
+
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  for (int i = 0; i < 100; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  SaveCFRCheckpoint(filename, "CFRSolver", game->Serialize(),
+                    /*iteration=*/100, solver.InfoStateValuesTable());
+
+  CFRCheckpoint checkpoint = LoadCFRCheckpoint(filename);
+  SPIEL_CHECK_EQ(checkpoint.solver_type, "CFRSolver");
+  SPIEL_CHECK_EQ(checkpoint.iteration, 100);
+  SPIEL_CHECK_EQ(checkpoint.info_states.size(),
+                 solver.InfoStateValuesTable().size());
+  for (const auto& [info_state, values] : solver.InfoStateValuesTable()) {
+    const auto it = checkpoint.info_states.find(info_state);
+    SPIEL_CHECK_TRUE(it != checkpoint.info_states.end());
+    SPIEL_CHECK_TRUE(it->second.legal_actions == values.legal_actions);
+    // Raw-byte storage must round-trip doubles exactly.
+    SPIEL_CHECK_TRUE(it->second.cumulative_regrets ==
+                     values.cumulative_regrets);
+    SPIEL_CHECK_TRUE(it->second.cumulative_policy == values.cumulative_policy);
+    SPIEL_CHECK_TRUE(it->second.current_policy == values.current_policy);
+  }
+
+  // Resume from the checkpoint and check the restored solver converges on.
+  std::shared_ptr<const Game> restored_game =
+      DeserializeGame(checkpoint.serialized_game);
+  CFRSolver restored(restored_game, checkpoint.iteration);
+  restored.InfoStateValuesTable() = std::move(checkpoint.info_states);
+  for (int i = 0; i < 200; i++) {
+    restored.EvaluateAndUpdatePolicy();
+  }
+  SPIEL_CHECK_LE(Exploitability(*restored_game, *restored.AveragePolicy()),
+                 0.05);
+
+  SPIEL_CHECK_TRUE(file::Remove(filename));
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::CheckpointRoundTripTest_KuhnPoker();
+}
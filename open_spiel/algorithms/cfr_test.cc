@@ -102,6 +102,29 @@ void CFRPlusTest_KuhnPoker() {
   CheckExploitabilityKuhnPoker(*game, *average_policy);
 }
 
+void CFRPlusTest_LazySweepsFlushed() {
+  // EvaluateAndUpdatePolicy defers the RM+ clamp and regret-matching refresh
+  // per infostate; the table accessors must surface fully materialized
+  // values: clamped regrets and a current policy that regret matching over
+  // those regrets reproduces.
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CFRPlusSolver solver(*game);
+  for (int i = 0; i < 10; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  for (const auto& [info_state, values] : solver.InfoStateValuesTable()) {
+    for (double regret : values.cumulative_regrets) {
+      SPIEL_CHECK_GE(regret, 0);
+    }
+    CFRInfoStateValues rematched = values;
+    rematched.ApplyRegretMatching();
+    for (int aidx = 0; aidx < values.num_actions(); ++aidx) {
+      SPIEL_CHECK_FLOAT_EQ(values.current_policy[aidx],
+                           rematched.current_policy[aidx]);
+    }
+  }
+}
+
 void CFRTest_KuhnPokerRunsWithThreePlayers(bool linear_averaging,
                                            bool regret_matching_plus,
                                            bool alternating_updates) {
@@ -265,6 +288,7 @@ int main(int argc, char** argv) {
   algorithms::CFRTest_KuhnPoker();
   algorithms::CFRTest_IIGoof4();
   algorithms::CFRPlusTest_KuhnPoker();
+  algorithms::CFRPlusTest_LazySweepsFlushed();
   algorithms::CFRTest_KuhnPokerRunsWithThreePlayers(
       /*linear_averaging=*/false,
       /*regret_matching_plus=*/false,
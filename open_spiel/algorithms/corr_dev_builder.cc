@@ -14,6 +14,11 @@
 
 #include "open_spiel/algorithms/corr_dev_builder.h"
 
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -24,14 +29,17 @@ CorrDevBuilder::CorrDevBuilder(int seed) : rng_(seed), total_weight_(0.0) {}
 
 void CorrDevBuilder::AddDeterminsticJointPolicy(const TabularPolicy& policy,
                                                 double weight) {
-  std::string key = policy.ToStringSorted();
-  auto iter = policy_weights_.find(key);
-  if (iter == policy_weights_.end()) {
-    policy_weights_[key] = weight;
-    policy_map_[key] = policy;
+  // The canonical string is only used to compute the key; it is not
+  // retained. A 64-bit collision would merge two distinct policies' weights;
+  // debug builds verify that the stored policy matches.
+  const uint64_t key = absl::Hash<std::string>()(policy.ToStringSorted());
+  WeightedPolicy& entry = policies_[key];
+  if (entry.policy == nullptr) {
+    entry.policy = std::make_shared<const TabularPolicy>(policy);
   } else {
-    iter->second += weight;
+    SPIEL_DCHECK_TRUE(entry.policy->PolicyTable() == policy.PolicyTable());
   }
+  entry.weight += weight;
   total_weight_ += weight;
 }
 
@@ -96,11 +104,11 @@ void CorrDevBuilder::AddMixedJointPolicy(const TabularPolicy& policy,
 CorrelationDevice CorrDevBuilder::GetCorrelationDevice() const {
   SPIEL_CHECK_GT(total_weight_, 0);
   CorrelationDevice corr_dev;
+  corr_dev.reserve(policies_.size());
   double sum_weight = 0;
-  for (const auto& key_and_policy : policy_map_) {
-    double weight = policy_weights_.at(key_and_policy.first);
-    sum_weight += weight;
-    corr_dev.push_back({weight / total_weight_, key_and_policy.second});
+  for (const auto& [key, entry] : policies_) {
+    sum_weight += entry.weight;
+    corr_dev.push_back({entry.weight / total_weight_, *entry.policy});
   }
   SPIEL_CHECK_TRUE(Near(sum_weight, total_weight_));
   return corr_dev;
@@ -15,6 +15,8 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_CORR_DEV_AGGREGATOR_H_
 #define OPEN_SPIEL_ALGORITHMS_CORR_DEV_AGGREGATOR_H_
 
+#include <cstdint>
+#include <memory>
 #include <random>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
@@ -69,10 +71,18 @@ class CorrDevBuilder {
   std::mt19937 rng_;
   double total_weight_;
 
-  // Each of these uses keys that have a canonical stringified policy as the
-  // key (e.g. complete policies with sorted keys).
-  absl::flat_hash_map<std::string, double> policy_weights_;
-  absl::flat_hash_map<std::string, TabularPolicy> policy_map_;
+  // Distinct deterministic joint policies, keyed by a 64-bit hash of their
+  // canonical stringified form (complete policies with sorted keys). Only
+  // the hash is retained, not the canonical string, and duplicate inserts
+  // merge their weights instead of storing another copy, so sampled builders
+  // that generate thousands of near-duplicate policies keep one table per
+  // distinct policy. The stored policies are shared, not copied, until
+  // GetCorrelationDevice materializes the device.
+  struct WeightedPolicy {
+    double weight = 0.0;
+    std::shared_ptr<const TabularPolicy> policy;
+  };
+  absl::flat_hash_map<uint64_t, WeightedPolicy> policies_;
 };
 
 // Helper functions to extract a distribution over deterministic strategies
@@ -14,11 +14,15 @@
 
 #include "open_spiel/algorithms/corr_dist.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <numeric>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/strings/numbers.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
@@ -36,6 +40,7 @@
 #include "open_spiel/game_transforms/turn_based_simultaneous_game.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -100,6 +105,26 @@ CorrelationDevice ConvertCorrelationDevice(
 
   return new_mu;
 }
+
+// Runs fn(i) for i in [0, num_items) on up to num_threads threads, striding
+// the indices across the workers. fn must be safe to call concurrently for
+// distinct i.
+void ParallelFor(int num_items, int num_threads,
+                 const std::function<void(int)>& fn) {
+  num_threads = std::min(num_threads, num_items);
+  if (num_threads <= 1) {
+    for (int i = 0; i < num_items; ++i) fn(i);
+    return;
+  }
+  std::vector<Thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([t, num_items, num_threads, &fn]() {
+      for (int i = t; i < num_items; i += num_threads) fn(i);
+    });
+  }
+  for (Thread& thread : threads) thread.join();
+}
 }  // namespace
 
 // Helper function to return a correlation device that is a uniform distribution
@@ -127,13 +152,44 @@ std::string ToString(const CorrelationDevice& corr_dev) {
 
 std::vector<double> ExpectedValues(const Game& game,
                                    const CorrelationDevice& mu) {
+  return ExpectedValues(game, mu, /*num_threads=*/1);
+}
+
+std::vector<double> ExpectedValues(const Game& game,
+                                   const CorrelationDevice& mu,
+                                   int num_threads,
+                                   ExpectedValuesCache* cache) {
   CheckCorrelationDeviceProbDist(mu);
+
+  // Resolve cache hits up front; the per-policy values are independent of
+  // the weights, so only the misses need a game traversal.
+  std::vector<uint64_t> hashes(mu.size(), 0);
+  std::vector<const std::vector<double>*> hits(mu.size(), nullptr);
+  if (cache != nullptr) {
+    for (int i = 0; i < mu.size(); ++i) {
+      hashes[i] = absl::Hash<std::string>()(mu[i].second.ToStringSorted());
+      auto iter = cache->find(hashes[i]);
+      if (iter != cache->end()) hits[i] = &iter->second;
+    }
+  }
+
+  std::vector<std::vector<double>> item_values(mu.size());
+  ParallelFor(mu.size(), num_threads, [&](int i) {
+    if (hits[i] != nullptr) {
+      item_values[i] = *hits[i];
+    } else {
+      item_values[i] =
+          ExpectedReturns(*game.NewInitialState(), mu[i].second, -1, false);
+    }
+  });
+
   std::vector<double> values(game.NumPlayers(), 0);
-  for (const std::pair<double, TabularPolicy>& item : mu) {
-    std::vector<double> item_values =
-        ExpectedReturns(*game.NewInitialState(), item.second, -1, false);
+  for (int i = 0; i < mu.size(); ++i) {
     for (Player p = 0; p < game.NumPlayers(); ++p) {
-      values[p] += item.first * item_values[p];
+      values[p] += mu[i].first * item_values[i][p];
+    }
+    if (cache != nullptr && hits[i] == nullptr) {
+      (*cache)[hashes[i]] = std::move(item_values[i]);
     }
   }
   return values;
@@ -289,7 +345,7 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu, int player,
 
 CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
                      const float prob_cut_threshold,
-                     const float action_value_tolerance) {
+                     const float action_value_tolerance, int num_threads) {
   // Check for proper probability distribution.
   CheckCorrelationDeviceProbDist(mu);
   CorrDistConfig config;
@@ -312,13 +368,16 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
 
   CCETabularPolicy policy;
 
-  std::unique_ptr<State> root = cce_game->NewInitialState();
-  for (auto p = Player{0}; p < cce_game->NumPlayers(); ++p) {
+  // The auxiliary game is built once above and shared by the per-player best
+  // responses; each worker uses its own root state.
+  ParallelFor(cce_game->NumPlayers(), num_threads, [&](int p) {
+    std::unique_ptr<State> root = cce_game->NewInitialState();
     TabularBestResponse best_response(*cce_game, p, &policy, prob_cut_threshold,
                                       action_value_tolerance);
     dist_info.best_response_values[p] = best_response.Value(*root);
     dist_info.best_response_policies[p] = best_response.GetBestResponsePolicy();
-  }
+  });
+  std::unique_ptr<State> root = cce_game->NewInitialState();
   dist_info.on_policy_values = ExpectedReturns(*root, policy, -1, false);
   SPIEL_CHECK_EQ(dist_info.best_response_values.size(),
                  dist_info.on_policy_values.size());
@@ -333,7 +392,7 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
 }
 
 CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
-                    const float action_value_tolerance) {
+                    const float action_value_tolerance, int num_threads) {
   // Check for proper probability distribution.
   CheckCorrelationDeviceProbDist(mu);
   CorrDistConfig config;
@@ -351,8 +410,10 @@ CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
 
   // For similar reasons as in CCEDist, we must manually do NashConv.
 
-  std::unique_ptr<State> root = ce_game->NewInitialState();
-  for (auto p = Player{0}; p < ce_game->NumPlayers(); ++p) {
+  // One shared auxiliary game; per-player best responses run in parallel,
+  // each on its own root state, writing only to their own player's slots.
+  ParallelFor(ce_game->NumPlayers(), num_threads, [&](int p) {
+    std::unique_ptr<State> root = ce_game->NewInitialState();
     TabularBestResponse best_response(*ce_game, p, &policy, -1.0,
                                       action_value_tolerance);
     dist_info.best_response_values[p] = best_response.Value(*root);
@@ -381,8 +442,9 @@ CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
       dist_info.conditional_best_response_policies[p].push_back(
           signal_and_policy.second);
     }
-  }
+  });
 
+  std::unique_ptr<State> root = ce_game->NewInitialState();
   dist_info.on_policy_values = ExpectedReturns(*root, policy, -1, false);
   SPIEL_CHECK_EQ(dist_info.best_response_values.size(),
                  dist_info.on_policy_values.size());
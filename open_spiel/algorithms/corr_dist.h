@@ -15,8 +15,10 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_CORR_DIST_H_
 #define OPEN_SPIEL_ALGORITHMS_CORR_DIST_H_
 
+#include <cstdint>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
@@ -105,9 +107,22 @@ struct CorrDistConfig {
   std::string recommendation_delimiter = " R-*-=-*-R ";
 };
 
+// Caches the expected values of individual joint policies, keyed by a hash
+// of their canonical string form. The per-policy values do not depend on the
+// distribution weights, so re-evaluating a correlation device whose weights
+// changed (but whose support did not) becomes a weighted sum over cached
+// entries, with no game traversals.
+using ExpectedValuesCache = absl::flat_hash_map<uint64_t, std::vector<double>>;
+
 // Return the expected values (one per player) of a correlation device.
+// The overload taking num_threads fans the per-policy evaluations out across
+// that many threads, and consults/fills the cache if one is given.
 std::vector<double> ExpectedValues(const Game& game,
                                    const CorrelationDevice& mu);
+std::vector<double> ExpectedValues(const Game& game,
+                                   const CorrelationDevice& mu,
+                                   int num_threads,
+                                   ExpectedValuesCache* cache = nullptr);
 std::vector<double> ExpectedValues(const Game& game,
                                    const NormalFormCorrelationDevice& mu);
 
@@ -161,9 +176,12 @@ struct CorrDistInfo {
 // determines which policies the opponents follow (never revealed). Note that
 // the policies in this correlation device *can* be mixed. If values is
 // non-null, then it is filled with the deviation incentive of each player.
+// The auxiliary game is built once and shared by the per-player best
+// responses, which run on up to num_threads threads.
 CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
                      const float prob_cut_threshold = -1.0,
-                     const float action_value_tolerance = -1.0);
+                     const float action_value_tolerance = -1.0,
+                     int num_threads = 1);
 CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu, int player,
                      const float prob_cut_threshold = -1.0,
                      const float action_value_tolerance = -1.0);
@@ -175,9 +193,11 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu, int player,
 // over mixed policies, then first convert the correlation device using the
 // helper functions DeterminizeCorrDev or SampledDeterminizeCorrDev in
 // corr_dev_builder.h. If values is non-null, then it is filled with the
-// deviation incentive of each player.
+// deviation incentive of each player. Like CCEDist, the per-player best
+// responses share one auxiliary game and run on up to num_threads threads.
 CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
-                    const float action_value_tolerance = -1.0);
+                    const float action_value_tolerance = -1.0,
+                    int num_threads = 1);
 
 }  // namespace algorithms
 }  // namespace open_spiel
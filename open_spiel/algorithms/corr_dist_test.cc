@@ -375,6 +375,23 @@ void TestCCECEDistCFRGoofSpiel() {
     std::cout << "num_iterations: " << num_iterations
               << ", approximate ce_dist: " << ce_dist_info.dist_value
               << std::endl;
+
+    // Parallel and cached evaluation agree with the sequential one.
+    CorrDistInfo parallel_cce_dist_info =
+        CCEDist(*game, mu, /*prob_cut_threshold=*/-1.0,
+                /*action_value_tolerance=*/-1.0, /*num_threads=*/2);
+    SPIEL_CHECK_FLOAT_EQ(parallel_cce_dist_info.dist_value,
+                         cce_dist_info.dist_value);
+    std::vector<double> values = ExpectedValues(*game, mu);
+    ExpectedValuesCache cache;
+    std::vector<double> parallel_values =
+        ExpectedValues(*game, mu, /*num_threads=*/2, &cache);
+    std::vector<double> cached_values =
+        ExpectedValues(*game, mu, /*num_threads=*/2, &cache);
+    for (int p = 0; p < values.size(); ++p) {
+      SPIEL_CHECK_FLOAT_EQ(values[p], parallel_values[p]);
+      SPIEL_CHECK_FLOAT_EQ(values[p], cached_values[p]);
+    }
   }
 }
 }  // namespace
@@ -107,10 +107,51 @@ bool DeterministicTabularPolicy::NextPolicy() {
   return false;
 }
 
+bool DeterministicTabularPolicy::NextPolicyGrayCode(
+    std::string* changed_infostate, Action* changed_action) {
+  // Loopless reflected mixed-radix Gray-code generation (Knuth TAOCP
+  // 7.2.1.1, Algorithm H): each step moves one digit by +/-1 and flips that
+  // digit's direction when it hits either end of its range; the focus
+  // pointers select which digit moves without any scanning.
+  if (!gray_initialized_) {
+    gray_entries_.clear();
+    for (auto iter = table_.begin(); iter != table_.end(); ++iter) {
+      if (iter->second.legal_actions_.size() > 1) {
+        gray_entries_.push_back(iter);
+      }
+    }
+    gray_directions_.assign(gray_entries_.size(), 1);
+    gray_focus_.resize(gray_entries_.size() + 1);
+    for (int i = 0; i < static_cast<int>(gray_focus_.size()); ++i) {
+      gray_focus_[i] = i;
+    }
+    gray_initialized_ = true;
+  }
+
+  const int num_entries = gray_entries_.size();
+  int j = gray_focus_[0];
+  gray_focus_[0] = 0;
+  if (j == num_entries) return false;
+
+  LegalsWithIndex& entry = gray_entries_[j]->second;
+  entry.index += gray_directions_[j];
+  if (entry.index == 0 ||
+      entry.index == static_cast<int>(entry.legal_actions_.size()) - 1) {
+    gray_directions_[j] = -gray_directions_[j];
+    gray_focus_[j] = gray_focus_[j + 1];
+    gray_focus_[j + 1] = j + 1;
+  }
+
+  if (changed_infostate != nullptr) *changed_infostate = gray_entries_[j]->first;
+  if (changed_action != nullptr) *changed_action = entry.GetAction();
+  return true;
+}
+
 void DeterministicTabularPolicy::ResetDefaultPolicy() {
   for (auto& info_state_entry : table_) {
     info_state_entry.second.index = 0;
   }
+  gray_initialized_ = false;
 }
 
 void DeterministicTabularPolicy::CreateTable(const Game& game, Player player) {
@@ -98,6 +98,18 @@ class DeterministicTabularPolicy : public Policy {
   // there exists a next policy in the order), otherwise returns false.
   bool NextPolicy();
 
+  // Advances to the next deterministic policy in a mixed-radix Gray-code
+  // order instead: exactly one information state's action changes per step.
+  // When non-null, changed_infostate / changed_action receive the key of that
+  // information state and its new action, so downstream evaluators can update
+  // incrementally instead of re-walking the game. Visits exactly the same set
+  // of policies as NextPolicy, in a different order. The enumeration must
+  // start from the first policy (a freshly-constructed default policy, or
+  // after ResetDefaultPolicy), and must not be interleaved with NextPolicy.
+  // Returns false when the whole space has been visited.
+  bool NextPolicyGrayCode(std::string* changed_infostate = nullptr,
+                          Action* changed_action = nullptr);
+
   // Resets the policy to the first one in the total order defined above: all
   // actions set to their first legal action (index = 0 in the legal actions
   // list).
@@ -112,6 +124,14 @@ class DeterministicTabularPolicy : public Policy {
 
   std::map<std::string, LegalsWithIndex> table_;
   Player player_;
+
+  // State of the Gray-code enumeration (Knuth TAOCP 7.2.1.1, Algorithm H),
+  // initialized lazily on the first NextPolicyGrayCode call. Only entries
+  // with more than one legal action take part; the rest can never change.
+  std::vector<std::map<std::string, LegalsWithIndex>::iterator> gray_entries_;
+  std::vector<int> gray_directions_;
+  std::vector<int> gray_focus_;
+  bool gray_initialized_ = false;
 };
 
 }  // namespace algorithms
@@ -14,6 +14,9 @@
 
 #include "open_spiel/algorithms/deterministic_policy.h"
 
+#include <set>
+#include <string>
+
 #include "open_spiel/games/kuhn_poker/kuhn_poker.h"
 #include "open_spiel/games/leduc_poker/leduc_poker.h"
 
@@ -40,6 +43,30 @@ void KuhnDeterministicPolicyTest() {
   SPIEL_CHECK_EQ(p1_policies, 64);  // 2^6
 }
 
+void KuhnGrayCodePolicyTest() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+
+  // The Gray-code order visits all 2^6 policies, each differing from the
+  // previous one in exactly one information state.
+  DeterministicTabularPolicy policy(*game, Player{0});
+  std::set<std::string> seen = {policy.ToString(":")};
+  std::string changed_infostate;
+  Action changed_action;
+  while (policy.NextPolicyGrayCode(&changed_infostate, &changed_action)) {
+    SPIEL_CHECK_EQ(policy.GetAction(changed_infostate), changed_action);
+    seen.insert(policy.ToString(":"));
+  }
+  SPIEL_CHECK_EQ(seen.size(), 64);  // 2^6
+
+  // After a reset, the enumeration starts over.
+  policy.ResetDefaultPolicy();
+  int num_policies = 1;
+  while (policy.NextPolicyGrayCode()) {
+    num_policies += 1;
+  }
+  SPIEL_CHECK_EQ(num_policies, 64);
+}
+
 void NumDeterministicPoliciesTest() {
   // In Kuhn, each player has 6 information states with 2 actions each.
   std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
@@ -58,5 +85,6 @@ void NumDeterministicPoliciesTest() {
 
 int main(int argc, char** argv) {
   open_spiel::algorithms::KuhnDeterministicPolicyTest();
+  open_spiel::algorithms::KuhnGrayCodePolicyTest();
   open_spiel::algorithms::NumDeterministicPoliciesTest();
 }
@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
@@ -60,16 +61,21 @@ DQN::DQN(const DQNSettings& settings)
       epsilon_end_(settings.epsilon_end),
       epsilon_decay_duration_(settings.epsilon_decay_duration),
       replay_buffer_(settings.replay_buffer_capacity),
+      importance_sampling_beta_(settings.importance_sampling_beta),
+      priority_epsilon_(settings.priority_epsilon),
       q_network_(input_size_, hidden_layers_sizes_, num_actions_),
       target_q_network_(input_size_, hidden_layers_sizes_, num_actions_),
       optimizer_(q_network_->parameters(),
                  torch::optim::SGDOptions(settings.learning_rate)),
       loss_str_(settings.loss_str),
-      exists_prev_(false),
-      prev_state_(nullptr),
-      prev_action_(0),
       step_counter_(0),
-      rng_(settings.seed) {}
+      rng_(settings.seed) {
+  if (settings.use_prioritized_replay) {
+    prioritized_replay_buffer_ =
+        std::make_unique<PrioritizedReplayBuffer<Transition>>(
+            settings.replay_buffer_capacity, settings.priority_exponent);
+  }
+}
 
 std::vector<float> DQN::GetInfoState(const State& state,
                                      Player player_id,
@@ -82,8 +88,15 @@ std::vector<float> DQN::GetInfoState(const State& state,
 }
 
 Action DQN::Step(const State& state, bool is_evaluation) {
+  return Step(state, /*env_id=*/0, is_evaluation);
+}
+
+Action DQN::Step(const State& state, int env_id, bool is_evaluation) {
   // Chance nodes should be handled externally to the agent.
   SPIEL_CHECK_TRUE(!state.IsChanceNode());
+  SPIEL_CHECK_GE(env_id, 0);
+  if (env_id >= prev_steps_.size()) prev_steps_.resize(env_id + 1);
+  PrevEnvStep& prev = prev_steps_[env_id];
 
   Action action;
   if (!state.IsTerminal() &&
@@ -109,20 +122,20 @@ Action DQN::Step(const State& state, bool is_evaluation) {
       torch::save(q_network_, stream);
       torch::load(target_q_network_, stream);
     }
-    if (exists_prev_) {
-      AddTransition(*prev_state_, prev_action_, state);
+    if (prev.exists) {
+      AddTransition(*prev.state, prev.action, state);
     }
   }
 
   if (state.IsTerminal()) {
-    exists_prev_ = false;
-    prev_action_ = 0;
-    prev_state_ = nullptr;
+    prev.exists = false;
+    prev.action = 0;
+    prev.state = nullptr;
     return kInvalidAction;
   } else {
-    exists_prev_ = true;
-    prev_state_ = state.Clone();
-    prev_action_ = action;
+    prev.exists = true;
+    prev.state = state.Clone();
+    prev.action = action;
   }
 
   return action;
@@ -133,12 +146,16 @@ void DQN::AddTransition(const State& prev_state,
                         const State& state) {
   Transition transition = {
     /*info_state=*/GetInfoState(prev_state, player_id_, use_observation_),
-    /*action=*/prev_action_,
+    /*action=*/prev_action,
     /*reward=*/state.PlayerReward(player_id_),
     /*next_info_state=*/GetInfoState(state, player_id_, use_observation_),
     /*is_final_step=*/state.IsTerminal(),
     /*legal_actions_mask=*/state.LegalActionsMask()};
-  replay_buffer_.Add(transition);
+  if (prioritized_replay_buffer_) {
+    prioritized_replay_buffer_->Add(transition);
+  } else {
+    replay_buffer_.Add(transition);
+  }
 }
 
 Action DQN::EpsilonGreedy(std::vector<float> info_state,
@@ -160,6 +177,8 @@ Action DQN::EpsilonGreedy(std::vector<float> info_state,
     }
     action = SampleAction(actions_probs, rng_).first;
   } else {
+    // The greedy forward pass never needs the autograd graph.
+    torch::NoGradGuard no_grad;
     torch::Tensor info_state_tensor =
         torch::from_blob(info_state.data(), {info_state.size()},
                          torch::dtype(torch::kFloat32))
@@ -192,10 +211,23 @@ double DQN::GetEpsilon(bool is_evaluation, int power) {
 }
 
 void DQN::Learn() {
-  if (replay_buffer_.Size() < batch_size_
-      || replay_buffer_.Size() < min_buffer_size_to_learn_) return;
-  std::vector<Transition> transition = replay_buffer_.Sample(&rng_,
-                                                             batch_size_);
+  const int buffer_size = prioritized_replay_buffer_
+                              ? prioritized_replay_buffer_->Size()
+                              : replay_buffer_.Size();
+  if (buffer_size < batch_size_
+      || buffer_size < min_buffer_size_to_learn_) return;
+  std::vector<Transition> transition;
+  std::vector<int> sampled_indices;
+  std::vector<float> sample_weights;
+  if (prioritized_replay_buffer_) {
+    PrioritizedSample<Transition> sample = prioritized_replay_buffer_->Sample(
+        &rng_, batch_size_, importance_sampling_beta_);
+    transition = std::move(sample.items);
+    sampled_indices = std::move(sample.indices);
+    sample_weights.assign(sample.weights.begin(), sample.weights.end());
+  } else {
+    transition = replay_buffer_.Sample(&rng_, batch_size_);
+  }
   std::vector<torch::Tensor> info_states;
   std::vector<torch::Tensor> next_info_states;
   std::vector<torch::Tensor> legal_actions_mask;
@@ -258,16 +290,37 @@ void DQN::Learn() {
                      actions_tensor});
 
   optimizer_.zero_grad();
-  torch::Tensor value_loss;
+  torch::Tensor per_sample_loss;
   if (loss_str_ == "mse") {
-    torch::nn::MSELoss mse_loss;
-    value_loss = mse_loss(predictions.squeeze(1), target);
+    torch::nn::MSELoss mse_loss(
+        torch::nn::MSELossOptions().reduction(torch::kNone));
+    per_sample_loss = mse_loss(predictions.squeeze(1), target);
   } else if (loss_str_ == "huber") {
-    torch::nn::SmoothL1Loss l1_loss;
-    value_loss = l1_loss(predictions.squeeze(1), target);
+    torch::nn::SmoothL1Loss l1_loss(
+        torch::nn::SmoothL1LossOptions().reduction(torch::kNone));
+    per_sample_loss = l1_loss(predictions.squeeze(1), target);
   } else {
     SpielFatalError("Not implemented, choose from 'mse', 'huber'.");
   }
+  torch::Tensor value_loss;
+  if (prioritized_replay_buffer_) {
+    // Importance sampling weights correct for the nonuniform sampling, and
+    // the new |td_error| of each sampled transition becomes its priority.
+    torch::Tensor weights_tensor = torch::from_blob(
+        sample_weights.data(),
+        {batch_size_},
+        torch::TensorOptions().dtype(torch::kFloat32)).clone();
+    value_loss = (per_sample_loss * weights_tensor).mean();
+    torch::Tensor td_errors =
+        (predictions.squeeze(1) - target).detach().abs();
+    for (int i = 0; i < batch_size_; ++i) {
+      prioritized_replay_buffer_->SetPriority(
+          sampled_indices[i],
+          td_errors[i].item<double>() + priority_epsilon_);
+    }
+  } else {
+    value_loss = per_sample_loss.mean();
+  }
   value_loss.backward();
   optimizer_.step();
 }
@@ -330,6 +383,71 @@ std::vector<double> RunEpisodes(std::mt19937* rng, const Game& game,
   return total_returns;
 }
 
+std::vector<double> RunParallelEpisodes(std::mt19937* rng, const Game& game,
+                                        const std::vector<Agent*>& agents,
+                                        int num_episodes, int num_envs,
+                                        bool is_evaluation) {
+  SPIEL_CHECK_GE(num_episodes, 1);
+  SPIEL_CHECK_GE(num_envs, 1);
+  SPIEL_CHECK_EQ(agents.size(), game.NumPlayers());
+  std::vector<double> total_returns(game.NumPlayers(), 0.0);
+
+  // One live state per environment; a slot is empty once no more episodes
+  // need starting.
+  std::vector<std::unique_ptr<State>> envs(num_envs);
+  int episodes_started = 0;
+  int episodes_done = 0;
+  for (int e = 0; e < num_envs && episodes_started < num_episodes; ++e) {
+    envs[e] = game.NewInitialState();
+    ++episodes_started;
+  }
+
+  while (episodes_done < num_episodes) {
+    // Apply one move in each live environment per pass.
+    for (int e = 0; e < num_envs; ++e) {
+      State* state = envs[e].get();
+      if (state == nullptr) continue;
+      if (state->IsChanceNode()) {
+        Action action = open_spiel::SampleAction(state->ChanceOutcomes(),
+                                                 absl::Uniform(*rng, 0.0, 1.0))
+                            .first;
+        state->ApplyAction(action);
+      } else if (state->IsSimultaneousNode()) {
+        std::vector<Action> joint_action(game.NumPlayers());
+        for (Player p = 0; p < game.NumPlayers(); ++p) {
+          joint_action[p] = agents[p]->Step(*state, e, is_evaluation);
+        }
+        state->ApplyActions(joint_action);
+      } else {
+        Action action =
+            agents[state->CurrentPlayer()]->Step(*state, e, is_evaluation);
+        state->ApplyAction(action);
+      }
+
+      if (state->IsTerminal()) {
+        std::vector<double> episode_returns = state->Returns();
+        for (Player p = 0; p < game.NumPlayers(); ++p) {
+          agents[p]->Step(*state, e, is_evaluation);
+          total_returns[p] += episode_returns[p];
+        }
+        ++episodes_done;
+        if (episodes_started < num_episodes) {
+          envs[e] = game.NewInitialState();
+          ++episodes_started;
+        } else {
+          envs[e] = nullptr;
+        }
+      }
+    }
+  }
+
+  for (Player p = 0; p < game.NumPlayers(); ++p) {
+    total_returns[p] /= num_episodes;
+  }
+
+  return total_returns;
+}
+
 }  // namespace torch_dqn
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -28,6 +28,7 @@
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/circular_buffer.h"
+#include "open_spiel/utils/prioritized_replay_buffer.h"
 
 // Note: This implementation has only been lightly tested on a few small games.
 
@@ -62,6 +63,14 @@ struct DQNSettings {
   double epsilon_end = 0.1;
   int epsilon_decay_duration = 1000000;
   std::string loss_str = "mse";
+  // Prioritized experience replay (Schaul et al., 2016). When enabled,
+  // transitions are sampled proportionally to |td_error|^priority_exponent
+  // and the loss is weighted by normalized importance sampling weights with
+  // exponent importance_sampling_beta.
+  bool use_prioritized_replay = false;
+  double priority_exponent = 0.6;
+  double importance_sampling_beta = 0.4;
+  double priority_epsilon = 1e-6;
 };
 
 // TODO(author5): make this into a proper general RL env/agent API as we have
@@ -72,6 +81,13 @@ class Agent {
  public:
   virtual ~Agent() = default;
   virtual Action Step(const State& state, bool is_evaluation = false) = 0;
+
+  // Step for agents driven over several interleaved environments, as done by
+  // RunParallelEpisodes. Agents that keep no per-environment state can ignore
+  // env_id; the default forwards to the single-environment Step.
+  virtual Action Step(const State& state, int env_id, bool is_evaluation) {
+    return Step(state, is_evaluation);
+  }
 };
 
 // Run a number of episodes with the given agents and return the average return
@@ -81,10 +97,21 @@ std::vector<double> RunEpisodes(std::mt19937* rng, const Game& game,
                                 const std::vector<Agent*>& agents,
                                 int num_episodes, bool is_evaluation);
 
+// As RunEpisodes, but steps num_envs environments in a round-robin, applying
+// one move in each environment per pass. Learning agents then see transitions
+// interleaved from several episodes between learn steps, which keeps the
+// learner fed instead of idling on one environment. Exactly num_episodes
+// episodes are completed in total.
+std::vector<double> RunParallelEpisodes(std::mt19937* rng, const Game& game,
+                                        const std::vector<Agent*>& agents,
+                                        int num_episodes, int num_envs,
+                                        bool is_evaluation);
+
 class RandomAgent : public Agent {
  public:
   RandomAgent(Player player, int seed) : player_(player), rng_(seed) {}
   virtual ~RandomAgent() = default;
+  using Agent::Step;
   Action Step(const State& state, bool is_evaluation = false) override;
 
  private:
@@ -98,6 +125,7 @@ class DQN : public Agent {
   DQN(const DQNSettings& settings);
   virtual ~DQN() = default;
   Action Step(const State& state, bool is_evaluation = false) override;
+  Action Step(const State& state, int env_id, bool is_evaluation) override;
 
   double GetEpsilon(bool is_evaluation, int power = 1.0);
   int seed() const { return seed_; }
@@ -110,6 +138,14 @@ class DQN : public Agent {
             const std::string& optimizer_data_path = "");
 
  private:
+  // The previous decision point of one environment, so that the agent can be
+  // stepped over several interleaved environments at once.
+  struct PrevEnvStep {
+    bool exists = false;
+    std::unique_ptr<State> state;
+    Action action = 0;
+  };
+
   std::vector<float> GetInfoState(const State& state, Player player_id,
                                   bool use_observation);
   void AddTransition(const State& prev_state, Action prev_action,
@@ -132,11 +168,14 @@ class DQN : public Agent {
   double epsilon_end_;
   double epsilon_decay_duration_;
   CircularBuffer<Transition> replay_buffer_;
+  // Set instead of replay_buffer_ when use_prioritized_replay is enabled.
+  std::unique_ptr<PrioritizedReplayBuffer<Transition>>
+      prioritized_replay_buffer_;
+  double importance_sampling_beta_;
+  double priority_epsilon_;
   int batch_size_;
   int step_counter_;
-  bool exists_prev_;
-  std::unique_ptr<State> prev_state_;
-  Action prev_action_;
+  std::vector<PrevEnvStep> prev_steps_;
   int input_size_;
   std::string loss_str_;
   MLP q_network_;
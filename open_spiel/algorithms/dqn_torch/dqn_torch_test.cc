@@ -69,6 +69,38 @@ void TestSimpleGame() {
   SPIEL_CHECK_GE(total_reward, 120);
 }
 
+void TestPrioritizedReplayParallelEnvs() {
+  std::shared_ptr<const Game> game = efg_game::LoadEFGGame(
+      efg_game::GetSimpleForkEFGData());
+  SPIEL_CHECK_TRUE(game != nullptr);
+  DQNSettings settings = {
+      /*seed*/ kSeed,
+      /*use_observation*/ game->GetType().provides_observation_tensor,
+      /*player_id*/ 0,
+      /*state_representation_size*/ game->InformationStateTensorSize(),
+      /*num_actions*/ game->NumDistinctActions(),
+      /*hidden_layers_sizes*/ {16},
+      /*replay_buffer_capacity*/ 100,
+      /*batch_size*/ 5,
+      /*learning_rate*/ 0.01,
+      /*update_target_network_every*/ 20,
+      /*learn_every*/ 5,
+      /*discount_factor*/ 1.0,
+      /*min_buffer_size_to_learn*/ 5,
+      /*epsilon_start*/ 0.02,
+      /*epsilon_end*/ 0.01};
+  settings.use_prioritized_replay = true;
+  DQN dqn(settings);
+  std::vector<Agent*> agents = {&dqn};
+  std::mt19937 rng(kSeed);
+  RunParallelEpisodes(&rng, *game, agents, /*num_episodes=*/150,
+                      /*num_envs=*/4, /*is_evaluation=*/false);
+  std::vector<double> avg_returns = RunParallelEpisodes(
+      &rng, *game, agents, /*num_episodes=*/20, /*num_envs=*/4,
+      /*is_evaluation=*/true);
+  SPIEL_CHECK_GE(avg_returns[0], 0.8);
+}
+
 void TestTicTacToe() {
   std::shared_ptr<const Game> game = open_spiel::LoadGame("tic_tac_toe");
   SPIEL_CHECK_TRUE(game != nullptr);
@@ -158,6 +190,7 @@ namespace torch_dqn = open_spiel::algorithms::torch_dqn;
 int main(int args, char** argv) {
   torch::manual_seed(torch_dqn::kSeed);
   torch_dqn::TestSimpleGame();
+  torch_dqn::TestPrioritizedReplayParallelEnvs();
   torch_dqn::TestTicTacToe();
   torch_dqn::TestHanabi();
   return 0;
@@ -14,14 +14,22 @@
 
 #include "open_spiel/algorithms/evaluate_bots.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
 #include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 
@@ -30,6 +38,7 @@ std::vector<double> EvaluateBots(State* state, const std::vector<Bot*>& bots,
   const int num_players = bots.size();
   std::mt19937 rng(seed);
   std::vector<Action> joint_actions(bots.size());
+  BotResponse response;  // Reused across all steps to avoid per-step allocs.
   if (state->History().empty()) {
     for (auto bot : bots) bot->Restart();
   } else {
@@ -45,13 +54,15 @@ std::vector<double> EvaluateBots(State* state, const std::vector<Bot*>& bots,
         if (state->LegalActions(p).empty()) {
           joint_actions[p] = kInvalidAction;
         } else {
-          joint_actions[p] = bots[p]->Step(*state);
+          bots[p]->StepInto(*state, &response);
+          joint_actions[p] = response.action;
         }
       }
       state->ApplyActions(joint_actions);
     } else {
       Player current_player = state->CurrentPlayer();
-      Action action = bots[current_player]->Step(*state);
+      bots[current_player]->StepInto(*state, &response);
+      Action action = response.action;
       for (Player p = 0; p < num_players; ++p) {
         if (p != current_player) {
           bots[p]->InformAction(*state, current_player, action);
@@ -80,4 +91,86 @@ std::vector<double> EvaluateBots(const Game& game,
   return EvaluateBots(game, bots, seed);
 }
 
+double TournamentResults::EpisodesPerSecond() const {
+  double seconds = absl::ToDoubleSeconds(wall_time);
+  return seconds > 0 ? num_episodes / seconds : 0;
+}
+
+double TournamentResults::ConfidenceInterval95(Player player) const {
+  const BasicStats& stats = returns[player];
+  if (stats.Num() <= 1) return 0;
+  return 1.96 * stats.StdDev() / std::sqrt(static_cast<double>(stats.Num()));
+}
+
+std::string TournamentResults::ToString() const {
+  std::string out = absl::StrCat(
+      num_episodes, " episodes in ", absl::FormatDuration(wall_time), " (",
+      EpisodesPerSecond(), " episodes/sec)");
+  for (Player p = 0; p < returns.size(); ++p) {
+    absl::StrAppend(&out, "\nplayer ", p, ": ", returns[p].Avg(), " +- ",
+                    ConfidenceInterval95(p));
+  }
+  return out;
+}
+
+TournamentResults EvaluateBotsParallel(std::shared_ptr<const Game> game,
+                                       const TournamentBotFactory& bot_factory,
+                                       int num_episodes, int seed,
+                                       int num_threads) {
+  SPIEL_CHECK_GE(num_episodes, 0);
+  SPIEL_CHECK_GE(num_threads, 1);
+  const int num_players = game->NumPlayers();
+
+  // Each worker owns its bots and its stats; episodes are claimed from a
+  // shared counter so threads stay busy even when episode lengths vary.
+  std::atomic<int> next_episode{0};
+  std::vector<std::vector<BasicStats>> thread_returns(
+      num_threads, std::vector<BasicStats>(num_players));
+  const absl::Time start = absl::Now();
+
+  auto worker = [&](int thread_num) {
+    std::vector<std::unique_ptr<Bot>> bots;
+    std::vector<Bot*> bot_ptrs;
+    bots.reserve(num_players);
+    for (Player p = 0; p < num_players; ++p) {
+      bots.push_back(bot_factory(
+          *game, p,
+          static_cast<uint32_t>(seed) + thread_num * num_players + p + 1));
+      bot_ptrs.push_back(bots.back().get());
+    }
+    std::vector<BasicStats>& stats = thread_returns[thread_num];
+    while (true) {
+      int episode = next_episode.fetch_add(1, std::memory_order_relaxed);
+      if (episode >= num_episodes) break;
+      std::vector<double> returns =
+          EvaluateBots(*game, bot_ptrs, seed + episode);
+      for (Player p = 0; p < num_players; ++p) {
+        stats[p].Add(returns[p]);
+      }
+    }
+  };
+
+  if (num_threads == 1) {
+    worker(0);
+  } else {
+    std::vector<Thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&worker, t]() { worker(t); });
+    }
+    for (Thread& thread : threads) thread.join();
+  }
+
+  TournamentResults results;
+  results.num_episodes = num_episodes;
+  results.returns.resize(num_players);
+  results.wall_time = absl::Now() - start;
+  for (const std::vector<BasicStats>& stats : thread_returns) {
+    for (Player p = 0; p < num_players; ++p) {
+      results.returns[p] += stats[p];
+    }
+  }
+  return results;
+}
+
 }  // namespace open_spiel
@@ -15,10 +15,16 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_EVALUATE_BOTS_H_
 #define OPEN_SPIEL_ALGORITHMS_EVALUATE_BOTS_H_
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
+#include "open_spiel/utils/stats.h"
 
 namespace open_spiel {
 
@@ -37,6 +43,37 @@ std::vector<double> EvaluateBots(const Game& game,
 std::vector<double> EvaluateBots(const Game& game,
                                  const std::vector<Bot*>& bots);
 
+// Creates the bot that will sit in seat `player`. The tournament runner calls
+// it once per worker thread per seat with a distinct `seed`, so each thread
+// plays with its own bot instances and rng streams and the bots themselves
+// never have to be thread-safe. (Not to be confused with the BotFactory
+// class in spiel_bots.h, which backs the registered-bot registry.)
+using TournamentBotFactory = std::function<std::unique_ptr<Bot>(
+    const Game& game, Player player, uint32_t seed)>;
+
+struct TournamentResults {
+  // Number of episodes actually played.
+  int num_episodes = 0;
+  // Per-player stats over the episode returns.
+  std::vector<BasicStats> returns;
+  absl::Duration wall_time;
+
+  double EpisodesPerSecond() const;
+  // Half-width of the 95% confidence interval on the player's mean return.
+  double ConfidenceInterval95(Player player) const;
+  std::string ToString() const;
+};
+
+// Plays `num_episodes` episodes of bot-vs-bot evaluation spread over
+// `num_threads` worker threads and aggregates the returns. Episode i is
+// played with chance seed `seed + i` regardless of which thread runs it, so
+// the set of episodes (though not their pairing with bot instances) is
+// independent of the thread count.
+TournamentResults EvaluateBotsParallel(std::shared_ptr<const Game> game,
+                                       const TournamentBotFactory& bot_factory,
+                                       int num_episodes, int seed,
+                                       int num_threads);
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_ALGORITHMS_EVALUATE_BOTS_H_
@@ -70,10 +70,62 @@ void BotTest_RandomVsRandomPolicy() {
   SPIEL_CHECK_FLOAT_NEAR(average_results[1], -0.125, 0.01);
 }
 
+void BotTest_ParallelTournament() {
+  auto game = LoadGame("kuhn_poker");
+  constexpr int num_episodes = 20000;
+  TournamentResults results = EvaluateBotsParallel(
+      game,
+      [](const Game& game, Player player, uint32_t seed) {
+        return MakeUniformRandomBot(player, seed);
+      },
+      num_episodes, /*seed=*/1234, /*num_threads=*/4);
+
+  SPIEL_CHECK_EQ(results.num_episodes, num_episodes);
+  SPIEL_CHECK_EQ(results.returns.size(), 2);
+  SPIEL_CHECK_EQ(results.returns[0].Num(), num_episodes);
+  SPIEL_CHECK_GT(results.EpisodesPerSecond(), 0);
+  SPIEL_CHECK_GT(results.ConfidenceInterval95(0), 0);
+  SPIEL_CHECK_LT(results.ConfidenceInterval95(0), 0.05);
+  SPIEL_CHECK_FLOAT_NEAR(results.returns[0].Avg(), 0.125, 0.02);
+  SPIEL_CHECK_FLOAT_NEAR(results.returns[1].Avg(), -0.125, 0.02);
+}
+
+// StepInto must behave exactly like StepWithPolicy, including the random
+// number consumption, so a bot stepped through either interface plays the
+// same game.
+void BotTest_StepIntoMatchesStepWithPolicy() {
+  auto game = LoadGame("kuhn_poker");
+  std::vector<std::unique_ptr<Bot>> bots_step;
+  std::vector<std::unique_ptr<Bot>> bots_step_into;
+  for (Player p = 0; p < game->NumPlayers(); ++p) {
+    bots_step.push_back(MakeUniformRandomBot(p, /*seed=*/1234 + p));
+    bots_step_into.push_back(MakeUniformRandomBot(p, /*seed=*/1234 + p));
+  }
+  BotResponse response;
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (!state->IsTerminal()) {
+      if (state->IsChanceNode()) {
+        state->ApplyAction(state->LegalActions()[0]);
+        continue;
+      }
+      Player player = state->CurrentPlayer();
+      std::pair<ActionsAndProbs, Action> step =
+          bots_step[player]->StepWithPolicy(*state);
+      bots_step_into[player]->StepInto(*state, &response);
+      SPIEL_CHECK_EQ(step.second, response.action);
+      SPIEL_CHECK_TRUE(step.first == response.policy);
+      state->ApplyAction(response.action);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::BotTest_RandomVsRandom();
   open_spiel::BotTest_RandomVsRandomPolicy();
+  open_spiel::BotTest_ParallelTournament();
+  open_spiel::BotTest_StepIntoMatchesStepWithPolicy();
 }
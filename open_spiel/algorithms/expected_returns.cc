@@ -14,13 +14,18 @@
 
 #include "open_spiel/algorithms/expected_returns.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/simultaneous_move_game.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -219,6 +224,260 @@ std::vector<double> ExpectedReturnsImpl(
   return values;
 }
 
+// Memoized full-tree analogue of the string-keyed ExpectedReturnsImpl above.
+// Subtree values under a fixed policy (and fixed prob_cut_threshold) are a
+// function of the history alone, so they are cached under State::Key().
+// Lookups consult the shared, read-only `cache` first and then the worker's
+// private `new_entries`; new values only ever go into `new_entries`, which
+// keeps concurrent workers from mutating a map another worker is reading.
+// `policy_dependent` is set if any policy lookup happened in the subtree;
+// chance-only subtrees are stored with kPolicyIndependentReturns so they
+// survive policy version bumps. Both cache pointers are null when memoization
+// is disabled.
+std::vector<double> MemoizedReturnsImpl(
+    const State& state,
+    const std::function<ActionsAndProbs(Player, const std::string&)>&
+        policy_func,
+    float prob_cut_threshold, uint64_t policy_version,
+    const ExpectedReturnsCache* cache, ExpectedReturnsCache* new_entries,
+    bool* policy_dependent) {
+  if (state.IsTerminal()) {
+    return state.Rewards();
+  }
+  const uint64_t key = state.Key();
+  if (cache != nullptr) {
+    auto iter = cache->find(key);
+    if (iter == cache->end()) {
+      iter = new_entries->find(key);
+      if (iter == new_entries->end()) iter = cache->end();
+    }
+    if (iter != cache->end() &&
+        (iter->second.policy_version == policy_version ||
+         iter->second.policy_version == kPolicyIndependentReturns)) {
+      if (iter->second.policy_version != kPolicyIndependentReturns) {
+        *policy_dependent = true;
+      }
+      return iter->second.values;
+    }
+  }
+
+  const int num_players = state.NumPlayers();
+  std::vector<double> values(num_players, 0.0);
+  bool subtree_policy_dependent = false;
+  if (state.IsChanceNode()) {
+    for (const auto& action_and_prob : state.ChanceOutcomes()) {
+      if (action_and_prob.second <= prob_cut_threshold) continue;
+      std::unique_ptr<State> child = state.Child(action_and_prob.first);
+      std::vector<double> child_values = MemoizedReturnsImpl(
+          *child, policy_func, prob_cut_threshold, policy_version, cache,
+          new_entries, &subtree_policy_dependent);
+      for (auto p = Player{0}; p < num_players; ++p) {
+        values[p] += action_and_prob.second * child_values[p];
+      }
+    }
+  } else if (state.IsSimultaneousNode()) {
+    subtree_policy_dependent = true;
+    values = state.Rewards();
+    auto smstate = dynamic_cast<const SimMoveState*>(&state);
+    SPIEL_CHECK_TRUE(smstate != nullptr);
+    std::vector<ActionsAndProbs> state_policies(num_players);
+    for (auto p = Player{0}; p < num_players; ++p) {
+      state_policies[p] = policy_func(p, state.InformationStateString(p));
+      if (state_policies[p].empty()) {
+        SpielFatalError("Error in MemoizedReturnsImpl; infostate not found.");
+      }
+    }
+    for (const Action flat_action : smstate->LegalActions()) {
+      std::vector<Action> actions =
+          smstate->FlatJointActionToActions(flat_action);
+      double joint_action_prob = 1.0;
+      for (auto p = Player{0}; p < num_players; ++p) {
+        double player_action_prob = GetProb(state_policies[p], actions[p]);
+        SPIEL_CHECK_GE(player_action_prob, 0.0);
+        SPIEL_CHECK_LE(player_action_prob, 1.0);
+        joint_action_prob *= player_action_prob;
+        if (joint_action_prob <= prob_cut_threshold) {
+          break;
+        }
+      }
+      if (joint_action_prob > prob_cut_threshold) {
+        std::unique_ptr<State> child = state.Clone();
+        child->ApplyActions(actions);
+        std::vector<double> child_values = MemoizedReturnsImpl(
+            *child, policy_func, prob_cut_threshold, policy_version, cache,
+            new_entries, &subtree_policy_dependent);
+        for (auto p = Player{0}; p < num_players; ++p) {
+          values[p] += joint_action_prob * child_values[p];
+        }
+      }
+    }
+  } else {
+    // Turn-based decision node.
+    subtree_policy_dependent = true;
+    Player player = state.CurrentPlayer();
+    ActionsAndProbs state_policy =
+        policy_func(player, state.InformationStateString());
+    if (state_policy.empty()) {
+      SpielFatalError("Error in MemoizedReturnsImpl; infostate not found.");
+    }
+    values = state.Rewards();
+    float total_prob = 0.0;
+    for (const Action action : state.LegalActions()) {
+      double action_prob = GetProb(state_policy, action);
+      SPIEL_CHECK_LE(action_prob, 1.0);
+      if (action_prob > prob_cut_threshold) {
+        SPIEL_CHECK_GE(action_prob, 0.0);
+        total_prob += action_prob;
+        std::unique_ptr<State> child = state.Child(action);
+        std::vector<double> child_values = MemoizedReturnsImpl(
+            *child, policy_func, prob_cut_threshold, policy_version, cache,
+            new_entries, &subtree_policy_dependent);
+        for (auto p = Player{0}; p < num_players; ++p) {
+          values[p] += action_prob * child_values[p];
+        }
+      }
+    }
+    SPIEL_CHECK_GT(total_prob, 0.0);
+  }
+  SPIEL_CHECK_EQ(values.size(), state.NumPlayers());
+  if (new_entries != nullptr) {
+    (*new_entries)[key] = {
+        subtree_policy_dependent ? policy_version : kPolicyIndependentReturns,
+        values};
+  }
+  if (subtree_policy_dependent) *policy_dependent = true;
+  return values;
+}
+
+// Shared implementation of the MemoizedExpectedReturns overloads.
+std::vector<double> MemoizedExpectedReturnsImpl(
+    const State& state,
+    const std::function<ActionsAndProbs(Player, const std::string&)>&
+        policy_func,
+    ExpectedReturnsCache* cache, uint64_t policy_version, int num_threads,
+    float prob_cut_threshold) {
+  SPIEL_CHECK_NE(policy_version, kPolicyIndependentReturns);
+  if (num_threads <= 1) {
+    ExpectedReturnsCache new_entries;
+    bool policy_dependent = false;
+    std::vector<double> values = MemoizedReturnsImpl(
+        state, policy_func, prob_cut_threshold, policy_version, cache,
+        cache != nullptr ? &new_entries : nullptr, &policy_dependent);
+    if (cache != nullptr) {
+      for (auto& entry : new_entries) {
+        (*cache)[entry.first] = std::move(entry.second);
+      }
+    }
+    return values;
+  }
+
+  if (state.IsTerminal()) {
+    return state.Rewards();
+  }
+
+  // Expand the root's children once, then spread the subtree evaluations over
+  // worker threads. Each worker records its new cache entries privately so the
+  // shared cache is only read concurrently; the private maps are merged after
+  // the join.
+  const int num_players = state.NumPlayers();
+  std::vector<double> values(num_players, 0.0);
+  std::vector<std::unique_ptr<State>> children;
+  std::vector<double> weights;
+  if (state.IsChanceNode()) {
+    for (const auto& action_and_prob : state.ChanceOutcomes()) {
+      if (action_and_prob.second <= prob_cut_threshold) continue;
+      children.push_back(state.Child(action_and_prob.first));
+      weights.push_back(action_and_prob.second);
+    }
+  } else if (state.IsSimultaneousNode()) {
+    values = state.Rewards();
+    auto smstate = dynamic_cast<const SimMoveState*>(&state);
+    SPIEL_CHECK_TRUE(smstate != nullptr);
+    std::vector<ActionsAndProbs> state_policies(num_players);
+    for (auto p = Player{0}; p < num_players; ++p) {
+      state_policies[p] = policy_func(p, state.InformationStateString(p));
+      if (state_policies[p].empty()) {
+        SpielFatalError(
+            "Error in MemoizedExpectedReturns; infostate not found.");
+      }
+    }
+    for (const Action flat_action : smstate->LegalActions()) {
+      std::vector<Action> actions =
+          smstate->FlatJointActionToActions(flat_action);
+      double joint_action_prob = 1.0;
+      for (auto p = Player{0}; p < num_players; ++p) {
+        double player_action_prob = GetProb(state_policies[p], actions[p]);
+        SPIEL_CHECK_GE(player_action_prob, 0.0);
+        SPIEL_CHECK_LE(player_action_prob, 1.0);
+        joint_action_prob *= player_action_prob;
+        if (joint_action_prob <= prob_cut_threshold) {
+          break;
+        }
+      }
+      if (joint_action_prob > prob_cut_threshold) {
+        std::unique_ptr<State> child = state.Clone();
+        child->ApplyActions(actions);
+        children.push_back(std::move(child));
+        weights.push_back(joint_action_prob);
+      }
+    }
+  } else {
+    Player player = state.CurrentPlayer();
+    ActionsAndProbs state_policy =
+        policy_func(player, state.InformationStateString());
+    if (state_policy.empty()) {
+      SpielFatalError("Error in MemoizedExpectedReturns; infostate not found.");
+    }
+    values = state.Rewards();
+    float total_prob = 0.0;
+    for (const Action action : state.LegalActions()) {
+      double action_prob = GetProb(state_policy, action);
+      SPIEL_CHECK_LE(action_prob, 1.0);
+      if (action_prob > prob_cut_threshold) {
+        SPIEL_CHECK_GE(action_prob, 0.0);
+        total_prob += action_prob;
+        children.push_back(state.Child(action));
+        weights.push_back(action_prob);
+      }
+    }
+    SPIEL_CHECK_GT(total_prob, 0.0);
+  }
+
+  const int num_workers =
+      std::min<int>(num_threads, static_cast<int>(children.size()));
+  std::vector<std::vector<double>> child_values(children.size());
+  std::vector<ExpectedReturnsCache> worker_entries(std::max(num_workers, 1));
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers.emplace_back([&, w]() {
+      ExpectedReturnsCache* new_entries =
+          cache != nullptr ? &worker_entries[w] : nullptr;
+      bool policy_dependent = false;
+      for (int i = w; i < static_cast<int>(children.size());
+           i += num_workers) {
+        child_values[i] = MemoizedReturnsImpl(
+            *children[i], policy_func, prob_cut_threshold, policy_version,
+            cache, new_entries, &policy_dependent);
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+  if (cache != nullptr) {
+    for (ExpectedReturnsCache& entries : worker_entries) {
+      for (auto& entry : entries) {
+        (*cache)[entry.first] = std::move(entry.second);
+      }
+    }
+  }
+  for (int i = 0; i < static_cast<int>(children.size()); ++i) {
+    for (auto p = Player{0}; p < num_players; ++p) {
+      values[p] += weights[i] * child_values[i][p];
+    }
+  }
+  return values;
+}
+
 std::vector<double> ExpectedReturnsOfDeterministicPoliciesFromSeedsImpl(
   const State& state,
   const std::vector<int>& policy_seeds,
@@ -342,6 +601,29 @@ std::vector<double> ExpectedReturns(const State& state,
   }
 }
 
+std::vector<double> MemoizedExpectedReturns(
+    const State& state, const Policy& joint_policy,
+    ExpectedReturnsCache* cache, uint64_t policy_version, int num_threads,
+    float prob_cut_threshold) {
+  return MemoizedExpectedReturnsImpl(
+      state,
+      [&joint_policy](Player player, const std::string& info_state) {
+        return joint_policy.GetStatePolicy(info_state);
+      },
+      cache, policy_version, num_threads, prob_cut_threshold);
+}
+
+std::vector<double> MemoizedExpectedReturns(
+    const State& state, const std::vector<const Policy*>& policies,
+    ExpectedReturnsCache* cache, uint64_t policy_version, int num_threads,
+    float prob_cut_threshold) {
+  return MemoizedExpectedReturnsImpl(
+      state,
+      [&policies](Player player, const std::string& info_state) {
+        return policies[player]->GetStatePolicy(info_state);
+      },
+      cache, policy_version, num_threads, prob_cut_threshold);
+}
 
 std::vector<double> ExpectedReturnsOfDeterministicPoliciesFromSeeds(
     const State& state, const std::vector<int>& policy_seeds) {
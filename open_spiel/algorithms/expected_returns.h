@@ -15,8 +15,11 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_EXPECTED_RETURNS_H_
 #define OPEN_SPIEL_ALGORITHMS_EXPECTED_RETURNS_H_
 
+#include <cstdint>
+#include <limits>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 
@@ -49,6 +52,46 @@ std::vector<double> ExpectedReturns(const State& state,
                                     bool use_infostate_get_policy = true,
                                     float prob_cut_threshold = 0.0);
 
+// A cache of subtree values for MemoizedExpectedReturns, keyed by
+// State::Key(). Each entry is tagged with the policy version it was computed
+// under: a lookup only hits when the caller-supplied version matches, so
+// bumping the version lazily invalidates every policy-dependent entry without
+// an O(n) clear. Subtrees that contain no decision nodes (chance leading
+// directly to terminals) do not depend on the policy at all; their entries are
+// tagged kPolicyIndependentReturns and remain valid across versions.
+inline constexpr uint64_t kPolicyIndependentReturns =
+    std::numeric_limits<uint64_t>::max();
+struct CachedSubtreeReturns {
+  uint64_t policy_version;
+  std::vector<double> values;
+};
+using ExpectedReturnsCache = absl::flat_hash_map<uint64_t, CachedSubtreeReturns>;
+
+// Full-tree variant of ExpectedReturns (no depth limit; cached subtree values
+// would not compose across different remaining depths) with subtree-value
+// memoization and parallel evaluation of the subtrees rooted at the starting
+// state's children.
+//
+// The caller owns the cache and the policy version: pass the same version as
+// the previous call if the policy is unchanged (full reuse), or a new value
+// after modifying it. ExpectedReturns cannot tell which information states a
+// policy change touched, so a version bump recomputes all policy-dependent
+// subtrees; chance-only subtrees are reused regardless. Passing a null cache
+// disables memoization. With num_threads > 1 the policy must be safe for
+// concurrent reads (tabular policies are); worker threads read the shared
+// cache and record new entries privately, which are merged after the join.
+std::vector<double> MemoizedExpectedReturns(
+    const State& state, const Policy& joint_policy,
+    ExpectedReturnsCache* cache, uint64_t policy_version,
+    int num_threads = 1, float prob_cut_threshold = 0.0);
+
+// As above, but with one policy per player, as in the first ExpectedReturns
+// overload.
+std::vector<double> MemoizedExpectedReturns(
+    const State& state, const std::vector<const Policy*>& policies,
+    ExpectedReturnsCache* cache, uint64_t policy_version,
+    int num_threads = 1, float prob_cut_threshold = 0.0);
+
 // Computes the (undiscounted) expected returns from random deterministic
 // policies which are specified using a seed. There should be a policy_seed per
 // player. Optionally any number of policies can be provided which override
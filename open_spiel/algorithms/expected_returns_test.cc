@@ -0,0 +1,84 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/expected_returns.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void CheckSameReturns(const std::vector<double>& actual,
+                      const std::vector<double>& expected) {
+  SPIEL_CHECK_EQ(actual.size(), expected.size());
+  for (int p = 0; p < actual.size(); ++p) {
+    SPIEL_CHECK_FLOAT_EQ(actual[p], expected[p]);
+  }
+}
+
+void MemoizedExpectedReturnsTest(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  std::unique_ptr<State> root = game->NewInitialState();
+  TabularPolicy uniform = GetUniformPolicy(*game);
+  TabularPolicy dirichlet = GetFlatDirichletPolicy(*game, /*seed=*/7);
+
+  std::vector<double> expected = ExpectedReturns(*root, uniform, -1);
+  ExpectedReturnsCache cache;
+
+  // Without a cache, with a cold cache, and with a warm cache.
+  CheckSameReturns(
+      MemoizedExpectedReturns(*root, uniform, nullptr, /*policy_version=*/0),
+      expected);
+  CheckSameReturns(
+      MemoizedExpectedReturns(*root, uniform, &cache, /*policy_version=*/0),
+      expected);
+  SPIEL_CHECK_GT(cache.size(), 0);
+  CheckSameReturns(
+      MemoizedExpectedReturns(*root, uniform, &cache, /*policy_version=*/0),
+      expected);
+
+  // A version bump invalidates the policy-dependent entries: the same cache
+  // must produce the new policy's values, also when evaluated in parallel.
+  expected = ExpectedReturns(*root, dirichlet, -1);
+  CheckSameReturns(
+      MemoizedExpectedReturns(*root, dirichlet, &cache, /*policy_version=*/1),
+      expected);
+  CheckSameReturns(
+      MemoizedExpectedReturns(*root, dirichlet, &cache, /*policy_version=*/1,
+                              /*num_threads=*/2),
+      expected);
+
+  // Parallel evaluation from scratch.
+  ExpectedReturnsCache parallel_cache;
+  CheckSameReturns(
+      MemoizedExpectedReturns(*root, dirichlet, &parallel_cache,
+                              /*policy_version=*/1, /*num_threads=*/2),
+      expected);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::MemoizedExpectedReturnsTest("kuhn_poker");
+  open_spiel::algorithms::MemoizedExpectedReturnsTest("leduc_poker");
+}
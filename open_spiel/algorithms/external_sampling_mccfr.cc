@@ -14,15 +14,18 @@
 
 #include "open_spiel/algorithms/external_sampling_mccfr.h"
 
+#include <atomic>
 #include <memory>
 #include <numeric>
 #include <random>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
 #include "open_spiel/algorithms/cfr.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -79,6 +82,47 @@ void ExternalSamplingMCCFRSolver::RunIteration(std::mt19937* rng) {
   }
 }
 
+void ExternalSamplingMCCFRSolver::RunIterations(int num_iterations,
+                                                int num_threads) {
+  SPIEL_CHECK_GE(num_iterations, 1);
+  SPIEL_CHECK_GE(num_threads, 1);
+  // The full averaging variant does a whole-tree pass per iteration, which
+  // does not decompose into independent sampled traversals; run it serially.
+  if (num_threads == 1 || avg_type_ == AverageType::kFull) {
+    for (int i = 0; i < num_iterations; ++i) RunIteration();
+    return;
+  }
+
+  // Seed the workers from the solver's generator so runs remain reproducible
+  // for a fixed seed and thread count.
+  std::vector<std::mt19937> worker_rngs;
+  worker_rngs.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    worker_rngs.emplace_back((*rng_)());
+  }
+
+  std::atomic<int> next_iteration{0};
+  std::vector<CFRInfoStateValuesTable> thread_deltas(num_threads);
+  std::vector<Thread> workers;
+  workers.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    workers.emplace_back([this, t, num_iterations, &next_iteration,
+                          &worker_rngs, &thread_deltas]() {
+      for (int i = next_iteration++; i < num_iterations;
+           i = next_iteration++) {
+        for (auto p = Player{0}; p < game_->NumPlayers(); ++p) {
+          UpdateRegretsWithDeltas(*game_->NewInitialState(), p,
+                                  &worker_rngs[t], &thread_deltas[t]);
+        }
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+  for (const CFRInfoStateValuesTable& deltas : thread_deltas) {
+    MergeDeltas(deltas);
+  }
+}
+
 std::string ExternalSamplingMCCFRSolver::Serialize(
     int double_precision, std::string delimiter) const {
   SPIEL_CHECK_GE(double_precision, -1);
@@ -125,7 +169,9 @@ double ExternalSamplingMCCFRSolver::UpdateRegrets(const State& state,
   if (state.IsTerminal()) {
     return state.PlayerReturn(player);
   } else if (state.IsChanceNode()) {
-    Action action = SampleAction(state.ChanceOutcomes(), dist_(*rng)).first;
+    ActionsAndProbs scratch;
+    Action action =
+        SampleAction(ChanceOutcomesRef(state, &scratch), dist_(*rng)).first;
     return UpdateRegrets(*state.Child(action), player, rng);
   } else if (state.IsSimultaneousNode()) {
     SpielFatalError(
@@ -185,6 +231,106 @@ double ExternalSamplingMCCFRSolver::UpdateRegrets(const State& state,
   return value;
 }
 
+double ExternalSamplingMCCFRSolver::UpdateRegretsWithDeltas(
+    const State& state, Player player, std::mt19937* rng,
+    CFRInfoStateValuesTable* deltas) const {
+  if (state.IsTerminal()) {
+    return state.PlayerReturn(player);
+  } else if (state.IsChanceNode()) {
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    ActionsAndProbs scratch;
+    Action action =
+        SampleAction(ChanceOutcomesRef(state, &scratch), dist(*rng)).first;
+    return UpdateRegretsWithDeltas(*state.Child(action), player, rng, deltas);
+  } else if (state.IsSimultaneousNode()) {
+    SpielFatalError(
+        "Simultaneous moves not supported. Use "
+        "TurnBasedSimultaneousGame to convert the game first.");
+  }
+
+  Player cur_player = state.CurrentPlayer();
+  std::string is_key = state.InformationStateString(cur_player);
+  std::vector<Action> legal_actions = state.LegalActions();
+
+  // The effective entry is the frozen shared value (or the default for keys
+  // not seen before this batch) plus the increments accumulated locally so
+  // far; regret matching is applied to that sum, as the serial traversal
+  // would after writing the same increments through.
+  CFRInfoStateValues info_state_copy;
+  const auto shared_iter = info_states_.find(is_key);
+  if (shared_iter != info_states_.end()) {
+    info_state_copy = shared_iter->second;
+  } else {
+    info_state_copy = CFRInfoStateValues(legal_actions, kInitialTableValues);
+  }
+  const auto delta_iter = deltas->find(is_key);
+  if (delta_iter != deltas->end()) {
+    for (int aidx = 0; aidx < info_state_copy.num_actions(); ++aidx) {
+      info_state_copy.cumulative_regrets[aidx] +=
+          delta_iter->second.cumulative_regrets[aidx];
+    }
+  }
+  info_state_copy.ApplyRegretMatching();
+
+  double value = 0;
+  std::vector<double> child_values(legal_actions.size(), 0);
+
+  if (cur_player != player) {
+    // Sample at opponent nodes.
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    int aidx = info_state_copy.SampleActionIndex(0.0, dist(*rng));
+    value = UpdateRegretsWithDeltas(*state.Child(legal_actions[aidx]), player,
+                                    rng, deltas);
+  } else {
+    // Walk over all actions at my nodes
+    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+      child_values[aidx] = UpdateRegretsWithDeltas(
+          *state.Child(legal_actions[aidx]), player, rng, deltas);
+      value += info_state_copy.current_policy[aidx] * child_values[aidx];
+    }
+  }
+
+  // Now the regret and avg strategy updates, into the delta table. Fresh
+  // delta entries start at zero; the default initial table values are added
+  // when the deltas are merged.
+  auto iter =
+      deltas->insert({is_key, CFRInfoStateValues(legal_actions)}).first;
+  CFRInfoStateValues& delta_vals = iter->second;
+
+  if (cur_player == player) {
+    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+      delta_vals.cumulative_regrets[aidx] += (child_values[aidx] - value);
+    }
+  }
+
+  if (avg_type_ == AverageType::kSimple &&
+      cur_player == ((player + 1) % game_->NumPlayers())) {
+    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+      delta_vals.cumulative_policy[aidx] +=
+          info_state_copy.current_policy[aidx];
+    }
+  }
+
+  return value;
+}
+
+void ExternalSamplingMCCFRSolver::MergeDeltas(
+    const CFRInfoStateValuesTable& deltas) {
+  for (const auto& [is_key, delta_vals] : deltas) {
+    auto iter =
+        info_states_
+            .insert({is_key, CFRInfoStateValues(delta_vals.legal_actions,
+                                                kInitialTableValues)})
+            .first;
+    CFRInfoStateValues& info_state = iter->second;
+    for (int aidx = 0; aidx < delta_vals.num_actions(); ++aidx) {
+      info_state.cumulative_regrets[aidx] +=
+          delta_vals.cumulative_regrets[aidx];
+      info_state.cumulative_policy[aidx] += delta_vals.cumulative_policy[aidx];
+    }
+  }
+}
+
 void ExternalSamplingMCCFRSolver::FullUpdateAverage(
     const State& state, const std::vector<double>& reach_probs) {
   if (state.IsTerminal()) {
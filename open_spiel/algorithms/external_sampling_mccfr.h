@@ -85,6 +85,18 @@ class ExternalSamplingMCCFRSolver {
   // Same as above, but uses the specified random number generator instead.
   void RunIteration(std::mt19937* rng);
 
+  // Runs num_iterations iterations with the sampling traversals distributed
+  // over num_threads worker threads. Each worker accumulates its regret and
+  // average-policy increments into a thread-local delta table while reading
+  // a frozen snapshot of the shared table; the deltas are merged once all
+  // workers have joined. Workers therefore do not observe each other's
+  // updates within one call, so for the regrets to propagate into the
+  // sampling policy at a reasonable rate, prefer several calls with a modest
+  // num_iterations over one call with a large one. AverageType::kFull
+  // requires a full-tree pass per iteration and falls back to running
+  // serially.
+  void RunIterations(int num_iterations, int num_threads);
+
   CFRInfoStateValuesTable& InfoStateValuesTable() { return info_states_; }
 
   // Computes the average policy, containing the policy for all players.
@@ -103,6 +115,14 @@ class ExternalSamplingMCCFRSolver {
   double UpdateRegrets(const State& state, Player player, std::mt19937* rng);
   void FullUpdateAverage(const State& state,
                          const std::vector<double>& reach_probs);
+  // As UpdateRegrets, but reads info_states_ without modifying it and
+  // accumulates all increments into `deltas`; used by the worker threads of
+  // RunIterations.
+  double UpdateRegretsWithDeltas(const State& state, Player player,
+                                 std::mt19937* rng,
+                                 CFRInfoStateValuesTable* deltas) const;
+  // Adds a worker's accumulated increments to the shared table.
+  void MergeDeltas(const CFRInfoStateValuesTable& deltas);
 
   std::shared_ptr<const Game> game_;
   std::unique_ptr<std::mt19937> rng_;
@@ -63,6 +63,21 @@ void MCCFR_KuhnPoker3PTest(std::mt19937* rng) {
             << NashConv(*game, *full_average_policy) << std::endl;
 }
 
+void MCCFR_ParallelIterationsTest() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  ExternalSamplingMCCFRSolver solver(*game, kSeed);
+  // Several short parallel batches so merged regrets feed back into the
+  // sampling policy between batches.
+  for (int batch = 0; batch < 20; ++batch) {
+    solver.RunIterations(/*num_iterations=*/50, /*num_threads=*/4);
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  double nash_conv = NashConv(*game, *average_policy, true);
+  std::cout << "Kuhn (parallel, 4 threads) NashConv = " << nash_conv
+            << std::endl;
+  SPIEL_CHECK_LE(nash_conv, 0.05);
+}
+
 void MCCFR_SerializationTest() {
   auto game = LoadGame("kuhn_poker");
   ExternalSamplingMCCFRSolver solver = ExternalSamplingMCCFRSolver(*game);
@@ -106,5 +121,6 @@ int main(int argc, char** argv) {
   algorithms::MCCFR_2PGameTest("leduc_poker", &rng, 1000, 2.5);
   algorithms::MCCFR_2PGameTest("liars_dice", &rng, 100, 1.6);
   algorithms::MCCFR_KuhnPoker3PTest(&rng);
+  algorithms::MCCFR_ParallelIterationsTest();
   algorithms::MCCFR_SerializationTest();
 }
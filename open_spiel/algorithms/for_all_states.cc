@@ -0,0 +1,39 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/for_all_states.h"
+
+#include <string>
+
+#include "open_spiel/algorithms/tree_walk.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+void ForAllStates(const Game& game, const StateVisitor& visitor,
+                  int depth_limit, bool include_terminals,
+                  bool include_chance_states) {
+  TreeWalkConfig config;
+  config.depth_limit = depth_limit;
+  config.include_terminals = include_terminals;
+  config.include_chance_states = include_chance_states;
+  TreeWalk(game,
+           [&visitor](const std::string& key, const State& state, int depth) {
+             visitor(state);
+           },
+           config);
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
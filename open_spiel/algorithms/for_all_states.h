@@ -0,0 +1,50 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_FOR_ALL_STATES_H_
+#define OPEN_SPIEL_ALGORITHMS_FOR_ALL_STATES_H_
+
+#include <functional>
+
+#include "open_spiel/spiel.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// Called once per visited state. The state is only valid for the duration of
+// the call; clone it if it needs to outlive the visit.
+using StateVisitor = std::function<void(const State& state)>;
+
+// Does a (depth-limited) tree walk of the game and calls the visitor once
+// for every history encountered, without materializing any collection of
+// states. This is a thin serial wrapper over TreeWalk (see tree_walk.h) and
+// the traversal underlying GetAllHistories, GetAllInformationStates and
+// GetLegalActionsMap; consumers that only aggregate (count, index, hash)
+// should use it directly so they never hold the full set in memory.
+//
+// Chance states are traversed through regardless of include_chance_states;
+// the flag only controls whether the visitor sees them. Terminal states are
+// visited (when included) even when they sit one past the depth limit, as
+// the recursion only cuts off below non-terminal states.
+//
+// Note: negative depth limit means no limit, 0 means only root, etc..
+// Currently only works for sequential games.
+void ForAllStates(const Game& game, const StateVisitor& visitor,
+                  int depth_limit = -1, bool include_terminals = false,
+                  bool include_chance_states = false);
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_FOR_ALL_STATES_H_
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
 #include "open_spiel/spiel.h"
@@ -133,7 +134,83 @@ FSICFRSolver::FSICFRSolver(const Game& game, int seed,
       total_iterations_(0),
       chance_outcome_ranges_(chance_outcome_ranges),
       sampled_chance_outcomes_(game.NumPlayers()),
-      graph_(graph) {}
+      graph_(graph) {
+  Compile();
+}
+
+void FSICFRSolver::Compile() {
+  num_nodes_ = graph_->size();
+  SPIEL_CHECK_GT(num_nodes_, 0);
+
+  topo_to_graph_id_.resize(num_nodes_, -1);
+  graph_id_to_topo_.resize(num_nodes_, -1);
+  for (int n = 0; n < num_nodes_; ++n) {
+    int node_id = graph_->ordered_node_id(n);
+    topo_to_graph_id_[n] = node_id;
+    graph_id_to_topo_[node_id] = n;
+  }
+
+  opp_chance_stride_ = *std::max_element(chance_outcome_ranges_.begin(),
+                                         chance_outcome_ranges_.end());
+
+  terminal_.resize(num_nodes_);
+  player_.resize(num_nodes_);
+  chance_id_.resize(num_nodes_);
+  p0_utility_.resize(num_nodes_);
+  node_T_.assign(num_nodes_, 0);
+  node_visits_.assign(num_nodes_, 0);
+  node_v_.assign(num_nodes_, 0.0);
+  psum0_.assign(num_nodes_, 0.0);
+  psum1_.assign(num_nodes_, 0.0);
+  action_begin_.resize(num_nodes_ + 1);
+
+  // First sweep: node scalars and the action slot ranges.
+  int num_slots = 0;
+  int max_actions = 0;
+  for (int n = 0; n < num_nodes_; ++n) {
+    FSICFRNode* node = graph_->GetNode(topo_to_graph_id_[n]);
+    action_begin_[n] = num_slots;
+    terminal_[n] = node->terminal ? 1 : 0;
+    player_[n] = node->player;
+    chance_id_[n] = node->chance_id;
+    p0_utility_[n] = node->p0_utility;
+    if (node->terminal) {
+      SPIEL_CHECK_TRUE(node->p0_utility == -1 || node->p0_utility == 1);
+    } else {
+      num_slots += node->legal_actions.size();
+      max_actions = std::max<int>(max_actions, node->legal_actions.size());
+    }
+  }
+  action_begin_[num_nodes_] = num_slots;
+
+  regrets_.assign(num_slots, 0.0);
+  strategy_.assign(num_slots, 0.0);
+  ssum_.assign(num_slots, 0.0);
+  child_ids_.assign(static_cast<size_t>(num_slots) * opp_chance_stride_, -1);
+  action_values_.assign(max_actions, 0.0);
+
+  // Second sweep: per-action slabs and the flattened children maps.
+  for (int n = 0; n < num_nodes_; ++n) {
+    FSICFRNode* node = graph_->GetNode(topo_to_graph_id_[n]);
+    if (node->terminal) continue;
+    int begin = action_begin_[n];
+    for (int a = 0; a < node->legal_actions.size(); ++a) {
+      regrets_[begin + a] = node->regrets[a];
+      strategy_[begin + a] = node->strategy[a];
+      ssum_[begin + a] = node->ssum[a];
+    }
+    for (const auto& [edge, child_id] : node->children) {
+      auto iter = std::find(node->legal_actions.begin(),
+                            node->legal_actions.end(), edge.first);
+      SPIEL_CHECK_TRUE(iter != node->legal_actions.end());
+      int a = iter - node->legal_actions.begin();
+      SPIEL_CHECK_GE(edge.second, 0);
+      SPIEL_CHECK_LT(edge.second, opp_chance_stride_);
+      child_ids_[static_cast<size_t>(begin + a) * opp_chance_stride_ +
+                 edge.second] = graph_id_to_topo_[child_id];
+    }
+  }
+}
 
 void FSICFRSolver::RunIteration() {
   // Predetermine chance outcomes (one per player).
@@ -156,89 +233,113 @@ void FSICFRSolver::RunIterations(int n) {
 
 void FSICFRSolver::ForwardPass() {
   bool done_first = false;
-  for (int idx = 0; idx < graph_->size(); ++idx) {
-    int node_id = graph_->ordered_node_id(idx);
-    FSICFRNode* node = graph_->GetNode(node_id);
-    if (!node->terminal &&
-        node->chance_id == sampled_chance_outcomes_[node->player]) {
-      if (!done_first) {
-        node->visits = 1;
-        node->psum = {1.0, 1.0};
-        done_first = true;
+  for (int n = 0; n < num_nodes_; ++n) {
+    if (terminal_[n] ||
+        chance_id_[n] != sampled_chance_outcomes_[player_[n]]) {
+      continue;
+    }
+    if (!done_first) {
+      node_visits_[n] = 1;
+      psum0_[n] = 1.0;
+      psum1_[n] = 1.0;
+      done_first = true;
+    }
+    const int begin = action_begin_[n];
+    const int end = action_begin_[n + 1];
+    // Regret matching over the node's slab.
+    double pos_rsum = 0.0;
+    for (int i = begin; i < end; ++i) {
+      pos_rsum += std::max(0.0, regrets_[i]);
+    }
+    if (pos_rsum > 0) {
+      const double inv_rsum = 1.0 / pos_rsum;
+      for (int i = begin; i < end; ++i) {
+        strategy_[i] = std::max(0.0, regrets_[i]) * inv_rsum;
       }
-      node->ApplyRegretMatching();
-      double my_reach = node->psum[node->player];
-      int opp_chance_id = sampled_chance_outcomes_[1 - node->player];
-      for (int a = 0; a < node->legal_actions.size(); ++a) {
-        node->ssum[a] += my_reach * node->strategy[a];
-        Action action = node->legal_actions[a];
-        auto iter = node->children.find({action, opp_chance_id});
-        SPIEL_CHECK_TRUE(iter != node->children.end());
-        int child_id = iter->second;
-        FSICFRNode* child = graph_->GetNode(child_id);
-        if (!child->terminal) {
-          child->visits += node->visits;
-          SPIEL_CHECK_GT(child->visits, 0);
-          for (int p : {0, 1}) {
-            child->psum[p] +=
-                node->psum[p] * (node->player == p ? node->strategy[a] : 1.0);
-            SPIEL_CHECK_GE(child->psum[p], 0);
-          }
-        }
+    } else {
+      const double uniform = 1.0 / (end - begin);
+      for (int i = begin; i < end; ++i) {
+        strategy_[i] = uniform;
+      }
+    }
+    const int player = player_[n];
+    const double my_reach = player == 0 ? psum0_[n] : psum1_[n];
+    for (int i = begin; i < end; ++i) {
+      ssum_[i] += my_reach * strategy_[i];
+    }
+    const int opp_chance_id = sampled_chance_outcomes_[1 - player];
+    const int visits = node_visits_[n];
+    const double psum0 = psum0_[n];
+    const double psum1 = psum1_[n];
+    for (int i = begin; i < end; ++i) {
+      const int child = child_ids_[static_cast<size_t>(i) * opp_chance_stride_ +
+                                   opp_chance_id];
+      SPIEL_DCHECK_GE(child, 0);
+      if (!terminal_[child]) {
+        node_visits_[child] += visits;
+        psum0_[child] += psum0 * (player == 0 ? strategy_[i] : 1.0);
+        psum1_[child] += psum1 * (player == 1 ? strategy_[i] : 1.0);
       }
     }
   }
 }
 
 void FSICFRSolver::BackwardPass() {
-  for (int idx = graph_->size() - 1; idx >= 0; --idx) {
-    int node_id = graph_->ordered_node_id(idx);
-    FSICFRNode* node = graph_->GetNode(node_id);
-    if (!node->terminal &&
-        node->chance_id == sampled_chance_outcomes_[node->player]) {
-      node->v = 0;
-      int opp_chance_id = sampled_chance_outcomes_[1 - node->player];
-      std::vector<double> values(node->legal_actions.size(), 0);
-      double opp_reach = node->psum[1 - node->player];
-      for (int a = 0; a < node->legal_actions.size(); ++a) {
-        Action action = node->legal_actions[a];
-        auto iter = node->children.find({action, opp_chance_id});
-        SPIEL_CHECK_TRUE(iter != node->children.end());
-        int child_id = iter->second;
-        FSICFRNode* child = graph_->GetNode(child_id);
-        if (child->terminal) {
-          SPIEL_CHECK_TRUE(child->p0_utility == -1 || child->p0_utility == 1);
-          values[a] =
-              node->player == 0 ? child->p0_utility : -child->p0_utility;
-        } else {
-          values[a] = node->player == child->player ? child->v : -child->v;
-        }
-        node->v += node->strategy[a] * values[a];
-      }
-      for (int a = 0; a < node->legal_actions.size(); ++a) {
-        node->regrets[a] = (node->T * node->regrets[a] +
-                            node->visits * opp_reach * (values[a] - node->v)) /
-                           (node->T + node->visits);
+  for (int n = num_nodes_ - 1; n >= 0; --n) {
+    if (terminal_[n] ||
+        chance_id_[n] != sampled_chance_outcomes_[player_[n]]) {
+      continue;
+    }
+    const int begin = action_begin_[n];
+    const int num_actions = action_begin_[n + 1] - begin;
+    const int player = player_[n];
+    const int opp_chance_id = sampled_chance_outcomes_[1 - player];
+    const double opp_reach = player == 0 ? psum1_[n] : psum0_[n];
+    double value = 0.0;
+    for (int a = 0; a < num_actions; ++a) {
+      const int child =
+          child_ids_[static_cast<size_t>(begin + a) * opp_chance_stride_ +
+                     opp_chance_id];
+      SPIEL_DCHECK_GE(child, 0);
+      double child_value;
+      if (terminal_[child]) {
+        child_value = player == 0 ? p0_utility_[child] : -p0_utility_[child];
+      } else {
+        child_value = player == player_[child] ? node_v_[child] : -node_v_[child];
       }
-      node->T += node->visits;
-      node->visits = 0;
-      node->psum[0] = 0;
-      node->psum[1] = 0;
+      action_values_[a] = child_value;
+      value += strategy_[begin + a] * child_value;
     }
+    node_v_[n] = value;
+    const int T = node_T_[n];
+    const int visits = node_visits_[n];
+    const double visit_weight = visits * opp_reach;
+    for (int a = 0; a < num_actions; ++a) {
+      regrets_[begin + a] =
+          (T * regrets_[begin + a] + visit_weight * (action_values_[a] - value)) /
+          (T + visits);
+    }
+    node_T_[n] += visits;
+    node_visits_[n] = 0;
+    psum0_[n] = 0.0;
+    psum1_[n] = 0.0;
   }
 }
 
 TabularPolicy FSICFRSolver::GetAveragePolicy() const {
   TabularPolicy policy;
-  for (int idx = 0; idx < graph_->size(); ++idx) {
-    FSICFRNode* node = graph_->GetNode(idx);
+  for (int node_id = 0; node_id < graph_->size(); ++node_id) {
+    FSICFRNode* node = graph_->GetNode(node_id);
     if (!node->terminal) {
+      const int n = graph_id_to_topo_[node_id];
+      const int begin = action_begin_[n];
       ActionsAndProbs state_policy;
-      double denom = std::accumulate(node->ssum.begin(), node->ssum.end(), 0.0);
+      double denom = std::accumulate(ssum_.begin() + begin,
+                                     ssum_.begin() + action_begin_[n + 1], 0.0);
       SPIEL_CHECK_GE(denom, 0.0);
       for (int a = 0; a < node->legal_actions.size(); ++a) {
         Action action = node->legal_actions[a];
-        double prob = denom > 0 ? node->ssum[a] / denom
+        double prob = denom > 0 ? ssum_[begin + a] / denom
                                 : 1.0 / node->legal_actions.size();
         SPIEL_CHECK_PROB(prob);
         state_policy.push_back({action, prob});
@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_FSICFR_H_
 #define OPEN_SPIEL_ALGORITHMS_FSICFR_H_
 
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -113,6 +114,9 @@ class FSICFRGraph {
 
 class FSICFRSolver {
  public:
+  // The graph must be fully built and top-sorted: the solver compiles it
+  // into a struct-of-arrays form at construction (see Compile()) and the
+  // iterations run purely over those arrays.
   FSICFRSolver(const Game& game, int seed,
                const std::vector<int>& chance_outcome_ranges,
                const FSICFRGraph* graph);
@@ -122,6 +126,13 @@ class FSICFRSolver {
   TabularPolicy GetAveragePolicy() const;
 
  private:
+  // Flattens the top-sorted graph into the parallel arrays below. Node
+  // scalars become one array per field indexed by topological position, the
+  // per-action vectors become contiguous slabs indexed via action_begin_,
+  // and the children hash maps become one child-index lookup table, so the
+  // forward and backward passes are linear sweeps with no pointer chasing
+  // or hashing.
+  void Compile();
   void ForwardPass();
   void BackwardPass();
 
@@ -138,6 +149,35 @@ class FSICFRSolver {
 
   // The FSICFR graph.
   const FSICFRGraph* graph_;
+
+  // Compiled graph, all indexed by topological position n.
+  int num_nodes_ = 0;
+  std::vector<uint8_t> terminal_;
+  std::vector<int> player_;
+  std::vector<int> chance_id_;
+  std::vector<double> p0_utility_;
+  std::vector<int> node_T_;
+  std::vector<int> node_visits_;
+  std::vector<double> node_v_;
+  std::vector<double> psum0_;
+  std::vector<double> psum1_;
+  // Action slot ranges: node n's actions occupy slots
+  // [action_begin_[n], action_begin_[n + 1]).
+  std::vector<int> action_begin_;
+  // Per-action slabs, indexed by action slot.
+  std::vector<double> regrets_;
+  std::vector<double> strategy_;
+  std::vector<double> ssum_;
+  // child_ids_[slot * opp_chance_stride_ + opp_chance_id] is the topological
+  // position of the child, or -1 where no edge exists.
+  int opp_chance_stride_ = 0;
+  std::vector<int> child_ids_;
+  // Mappings between graph node ids and topological positions.
+  std::vector<int> topo_to_graph_id_;
+  std::vector<int> graph_id_to_topo_;
+  // Scratch buffer for the backward pass (one entry per action slot of the
+  // widest node).
+  std::vector<double> action_values_;
 };
 
 }  // namespace algorithms
@@ -14,6 +14,7 @@
 
 #include "open_spiel/algorithms/get_all_histories.h"
 
+#include "open_spiel/algorithms/for_all_states.h"
 #include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -34,4 +35,12 @@ int main(int argc, char **argv) {
                                           /*include_terminals=*/false,
                                           /*include_chance_states=*/true);
   SPIEL_CHECK_EQ(histories.size(), kTTTNumPartialHistories);
+
+  // The streaming visitor sees the same histories, without materializing
+  // them.
+  int num_visited = 0;
+  algorithms::ForAllStates(
+      *game, [&num_visited](const open_spiel::State& state) { ++num_visited; },
+      -1, /*include_terminals=*/true, /*include_chance_states=*/true);
+  SPIEL_CHECK_EQ(num_visited, kTTTNumTotalHistories);
 }
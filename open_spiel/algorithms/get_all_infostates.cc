@@ -16,48 +16,26 @@
 
 #include <algorithm>
 
+#include "open_spiel/algorithms/for_all_states.h"
+
 namespace open_spiel {
 namespace algorithms {
-namespace {
-
-// Get all the information states. Note that there might contain duplicates.
-void GetSubgameInformationStates(
-    State* state, std::vector<std::vector<std::string>>* all_info_states,
-    int depth_limit, int depth) {
-  if (state->IsTerminal()) {
-    return;
-  }
-
-  if (depth_limit >= 0 && depth > depth_limit) {
-    return;
-  }
-
-  for (auto action : state->LegalActions()) {
-    auto next_state = state->Clone();
-    next_state->ApplyAction(action);
-
-    if (!state->IsChanceNode()) {
-      int player = state->CurrentPlayer();
-      SPIEL_CHECK_GE(player, 0);
-      SPIEL_CHECK_LT(player, state->NumPlayers());
-      (*all_info_states)[player].push_back(state->InformationStateString());
-    }
-
-    GetSubgameInformationStates(next_state.get(), all_info_states, depth_limit,
-                                depth + 1);
-  }
-}
-
-}  // namespace
 
 std::vector<std::vector<std::string>> GetAllInformationStates(const Game& game,
                                                               int depth_limit) {
-  // Get the root state.
-  std::unique_ptr<State> state = game.NewInitialState();
   std::vector<std::vector<std::string>> all_infostates(game.NumPlayers());
 
-  // Then, do a recursive tree walk to fill up the vector.
-  GetSubgameInformationStates(state.get(), &all_infostates, depth_limit, 0);
+  // Do a recursive tree walk to fill up the vector. Note that this might
+  // collect duplicates; they are removed below.
+  ForAllStates(
+      game,
+      [&all_infostates](const State& state) {
+        int player = state.CurrentPlayer();
+        SPIEL_CHECK_GE(player, 0);
+        SPIEL_CHECK_LT(player, state.NumPlayers());
+        all_infostates[player].push_back(state.InformationStateString());
+      },
+      depth_limit);
 
   // Remove duplicates by sorting the info states and calling std::unique.
   for (Player p = 0; p < all_infostates.size(); ++p) {
@@ -14,58 +14,28 @@
 
 #include "open_spiel/algorithms/get_all_states.h"
 
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/algorithms/tree_walk.h"
+
 namespace open_spiel {
 namespace algorithms {
 namespace {
 
-// Walk a subgame and return all states contained in the subgames. This does
-// a recursive tree walk, therefore all valid sequences must have finite number
-// of actions. The state collection is key-indexed by the state's string
-// representation so that duplicates are not added.
-// Requires State::Clone() to be implemented.
-// Use with extreme caution!
-// Currently not implemented for simultaneous games.
-void GetSubgameStates(State* state,
-                      std::map<std::string, std::unique_ptr<State>>* all_states,
-                      int depth_limit, int depth, bool include_terminals,
-                      bool include_chance_states,
-                      bool stop_at_duplicates) {
-  if (state->IsTerminal()) {
-    if (include_terminals) {
-      // Include if not already present and then terminate recursion.
-      std::string key = state->ToString();
-      if (all_states->find(key) == all_states->end()) {
-        (*all_states)[key] = state->Clone();
-      }
-    }
-    return;
-  }
-
-  if (depth_limit >= 0 && depth > depth_limit) {
-    return;
-  }
-
-  if (!state->IsChanceNode() || include_chance_states) {
-    // Decision node; add only if not already present
-    std::string key = state->ToString();
-    if (all_states->find(key) == all_states->end()) {
-      (*all_states)[key] = state->Clone();
-    } else {
-      // Duplicate node.
-      if (stop_at_duplicates) {
-        // Terminate, do not explore the same node twice
-        return;
-      }
-    }
-  }
-
-  for (auto action : state->LegalActions()) {
-    auto next_state = state->Clone();
-    next_state->ApplyAction(action);
-    GetSubgameStates(next_state.get(), all_states, depth_limit, depth + 1,
-                     include_terminals, include_chance_states,
-                     stop_at_duplicates);
-  }
+TreeWalkConfig MakeConfig(int depth_limit, bool include_terminals,
+                          bool include_chance_states, bool stop_at_duplicates,
+                          int num_threads) {
+  TreeWalkConfig config;
+  config.depth_limit = depth_limit;
+  config.include_terminals = include_terminals;
+  config.include_chance_states = include_chance_states;
+  // The walk's dedup guarantees the visitor sees each key exactly once, so
+  // the collection visitors below insert without checking.
+  config.dedup = stop_at_duplicates ? TreeWalkDedup::kStopAtDuplicates
+                                    : TreeWalkDedup::kVisitOnce;
+  config.num_threads = num_threads;
+  return config;
 }
 
 }  // namespace
@@ -73,16 +43,67 @@ void GetSubgameStates(State* state,
 std::map<std::string, std::unique_ptr<State>> GetAllStates(
     const Game& game, int depth_limit, bool include_terminals,
     bool include_chance_states, bool stop_at_duplicates) {
-  // Get the root state.
-  std::unique_ptr<State> state = game.NewInitialState();
   std::map<std::string, std::unique_ptr<State>> all_states;
+  TreeWalk(
+      game,
+      [&all_states](const std::string& key, const State& state, int depth) {
+        std::unique_ptr<State> clone = state.Clone();
+        clone->ShrinkToFit();  // These states may be retained by the millions.
+        all_states[key] = std::move(clone);
+      },
+      MakeConfig(depth_limit, include_terminals, include_chance_states,
+                 stop_at_duplicates, /*num_threads=*/1));
+
+  if (all_states.empty()) {
+    SpielFatalError("GetAllStates returned 0 states!");
+  }
 
-  // Then, do a recursive tree walk to fill up the map.
-  GetSubgameStates(state.get(), &all_states, depth_limit, 0, include_terminals,
-                   include_chance_states, stop_at_duplicates);
+  return all_states;
+}
+
+std::map<std::string, std::unique_ptr<State>> GetAllStatesParallel(
+    const Game& game, int depth_limit, bool include_terminals,
+    bool include_chance_states, bool stop_at_duplicates, int num_threads) {
+  std::map<std::string, std::unique_ptr<State>> all_states;
+  absl::Mutex out_mutex;
+  // The output mutex only serializes the map insert; cloning stays parallel.
+  TreeWalk(
+      game,
+      [&all_states, &out_mutex](const std::string& key, const State& state,
+                                int depth) {
+        std::unique_ptr<State> clone = state.Clone();
+        clone->ShrinkToFit();  // These states may be retained by the millions.
+        absl::MutexLock lock(&out_mutex);
+        all_states[key] = std::move(clone);
+      },
+      MakeConfig(depth_limit, include_terminals, include_chance_states,
+                 stop_at_duplicates, num_threads));
+
+  if (all_states.empty()) {
+    SpielFatalError("GetAllStatesParallel returned 0 states!");
+  }
+
+  return all_states;
+}
+
+std::map<std::string, std::string> GetAllSerializedStates(
+    const Game& game, int depth_limit, bool include_terminals,
+    bool include_chance_states, bool stop_at_duplicates, int num_threads) {
+  std::map<std::string, std::string> all_states;
+  absl::Mutex out_mutex;
+  TreeWalk(
+      game,
+      [&all_states, &out_mutex](const std::string& key, const State& state,
+                                int depth) {
+        std::string serialized = state.Serialize();
+        absl::MutexLock lock(&out_mutex);
+        all_states[key] = std::move(serialized);
+      },
+      MakeConfig(depth_limit, include_terminals, include_chance_states,
+                 stop_at_duplicates, num_threads));
 
   if (all_states.empty()) {
-    SpielFatalError("GetSubgameStates returned 0 states!");
+    SpielFatalError("GetAllSerializedStates returned 0 states!");
   }
 
   return all_states;
@@ -44,6 +44,27 @@ std::map<std::string, std::unique_ptr<State>> GetAllStates(
     const Game& game, int depth_limit, bool include_terminals,
     bool include_chance_states, bool stop_at_duplicates = false);
 
+// Parallel version of GetAllStates. The first few plies are expanded
+// serially into a frontier of subtree roots, which num_threads workers then
+// walk, picking up the next unclaimed subtree as they finish one, so the
+// load balances dynamically. Deduplication goes through a shared hash set
+// sharded by key so workers only contend when they hit the same shard.
+// Results are identical to GetAllStates (the returned map is ordered as
+// before); only the work is spread over threads.
+std::map<std::string, std::unique_ptr<State>> GetAllStatesParallel(
+    const Game& game, int depth_limit, bool include_terminals,
+    bool include_chance_states, bool stop_at_duplicates = false,
+    int num_threads = 4);
+
+// As GetAllStatesParallel, but stores each state as its Serialize() string
+// rather than as a live State object, which is far more compact for games
+// where retaining millions of State objects does not fit in memory. Revive
+// individual states with Game::DeserializeState.
+std::map<std::string, std::string> GetAllSerializedStates(
+    const Game& game, int depth_limit, bool include_terminals,
+    bool include_chance_states, bool stop_at_duplicates = false,
+    int num_threads = 4);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
@@ -26,4 +26,21 @@ int main(int argc, char **argv) {
   auto states = algorithms::GetAllStates(*game, -1, /*include_terminals=*/true,
                                          /*include_chance_states=*/true);
   SPIEL_CHECK_EQ(states.size(), ttt::kNumberStates);
+
+  auto parallel_states = algorithms::GetAllStatesParallel(
+      *game, -1, /*include_terminals=*/true, /*include_chance_states=*/true,
+      /*stop_at_duplicates=*/false, /*num_threads=*/4);
+  SPIEL_CHECK_EQ(parallel_states.size(), states.size());
+  for (const auto& [key, state] : parallel_states) {
+    SPIEL_CHECK_TRUE(states.find(key) != states.end());
+  }
+
+  auto serialized_states = algorithms::GetAllSerializedStates(
+      *game, -1, /*include_terminals=*/true, /*include_chance_states=*/true,
+      /*stop_at_duplicates=*/false, /*num_threads=*/4);
+  SPIEL_CHECK_EQ(serialized_states.size(), states.size());
+  const auto& [first_key, first_serialized] = *serialized_states.begin();
+  std::unique_ptr<open_spiel::State> revived =
+      game->DeserializeState(first_serialized);
+  SPIEL_CHECK_EQ(revived->ToString(), first_key);
 }
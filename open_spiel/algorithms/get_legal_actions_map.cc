@@ -14,26 +14,17 @@
 
 #include "open_spiel/algorithms/get_legal_actions_map.h"
 
+#include "open_spiel/algorithms/for_all_states.h"
+
 namespace open_spiel {
 namespace algorithms {
 namespace {
 
-// Do the tree traversal to fill the map. This function does a depth-first
-// search of all the subtrees to fill the map for all the information states.
+// Fill the map with the information states of one visited state.
 void FillMap(const State& state,
              std::unordered_map<std::string, std::vector<Action>>* map,
-             int depth_limit, int depth, Player player) {
-  if (state.IsTerminal()) {
-    return;
-  }
-
-  if (depth_limit >= 0 && depth > depth_limit) {
-    return;
-  }
-
-  if (state.IsChanceNode()) {
-    // Do nothing at chance nodes (no information states).
-  } else if (state.IsSimultaneousNode()) {
+             Player player) {
+  if (state.IsSimultaneousNode()) {
     // Many players can play at this node.
     for (auto p = Player{0}; p < state.NumPlayers(); ++p) {
       if (player == kInvalidPlayer || p == player) {
@@ -56,12 +47,6 @@ void FillMap(const State& state,
       }
     }
   }
-
-  // Recursively fill the map for each subtree below.
-  for (auto action : state.LegalActions()) {
-    std::unique_ptr<State> next_state = state.Child(action);
-    FillMap(*next_state, map, depth_limit, depth + 1, player);
-  }
 }
 
 }  // namespace
@@ -69,8 +54,13 @@ void FillMap(const State& state,
 std::unordered_map<std::string, std::vector<Action>> GetLegalActionsMap(
     const Game& game, int depth_limit, Player player) {
   std::unordered_map<std::string, std::vector<Action>> map;
-  std::unique_ptr<State> initial_state = game.NewInitialState();
-  FillMap(*initial_state, &map, depth_limit, 0, player);
+  // Do the tree traversal to fill the map for all the information states.
+  // Chance nodes are traversed through but contribute nothing (no
+  // information states).
+  ForAllStates(
+      game,
+      [&map, player](const State& state) { FillMap(state, &map, player); },
+      depth_limit);
   return map;
 }
 
@@ -18,6 +18,7 @@
 #include <limits>
 #include <unordered_set>
 
+#include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -25,13 +26,16 @@ namespace open_spiel {
 namespace algorithms {
 namespace {
 
-std::unique_ptr<HistoryNode> RecursivelyBuildGameTree(
+HistoryNode* RecursivelyBuildGameTree(
     std::unique_ptr<State> state, Player player_id,
-    absl::flat_hash_map<std::string, HistoryNode*>* state_to_node) {
-  std::unique_ptr<HistoryNode> node(
-      new HistoryNode(player_id, std::move(state)));
+    std::vector<std::unique_ptr<HistoryNode>>* nodes,
+    absl::flat_hash_map<absl::string_view, HistoryNode*>* state_to_node) {
   if (state_to_node == nullptr) SpielFatalError("state_to_node is null.");
-  (*state_to_node)[node->GetHistory()] = node.get();
+  int node_id = nodes->size();
+  nodes->push_back(
+      std::make_unique<HistoryNode>(node_id, player_id, std::move(state)));
+  HistoryNode* node = nodes->back().get();
+  (*state_to_node)[node->GetHistory()] = node;
   State* state_ptr = node->GetState();
   switch (node->GetType()) {
     case StateType::kMeanField: {
@@ -45,9 +49,9 @@ std::unique_ptr<HistoryNode> RecursivelyBuildGameTree(
           SpielFatalError("Can't add child; child is null.");
         }
         probability_sum += prob;
-        std::unique_ptr<HistoryNode> child_node = RecursivelyBuildGameTree(
-            std::move(child), player_id, state_to_node);
-        node->AddChild(outcome, {prob, std::move(child_node)});
+        HistoryNode* child_node = RecursivelyBuildGameTree(
+            std::move(child), player_id, nodes, state_to_node);
+        node->AddChild(outcome, {prob, child_node});
       }
       SPIEL_CHECK_FLOAT_EQ(probability_sum, 1.0);
       break;
@@ -63,8 +67,9 @@ std::unique_ptr<HistoryNode> RecursivelyBuildGameTree(
         // *counter-factual* probabilities, which ignore the probability of
         // the player that we are playing as.
         node->AddChild(legal_action,
-                       {1., RecursivelyBuildGameTree(
-                                std::move(child), player_id, state_to_node)});
+                       {1., RecursivelyBuildGameTree(std::move(child),
+                                                     player_id, nodes,
+                                                     state_to_node)});
       }
       break;
     }
@@ -79,8 +84,10 @@ std::unique_ptr<HistoryNode> RecursivelyBuildGameTree(
 
 }  // namespace
 
-HistoryNode::HistoryNode(Player player_id, std::unique_ptr<State> game_state)
-    : state_(std::move(game_state)),
+HistoryNode::HistoryNode(int node_id, Player player_id,
+                         std::unique_ptr<State> game_state)
+    : id_(node_id),
+      state_(std::move(game_state)),
       history_(state_->HistoryString()),
       type_(state_->GetType()) {
   // Unless it's the opposing player's turn, we always view the game from the
@@ -95,47 +102,87 @@ HistoryNode::HistoryNode(Player player_id, std::unique_ptr<State> game_state)
     infostate_ = state_->InformationStateString(player_id);
   }
   // Compute & store the legal actions so we can check that all actions we're
-  // adding are legal.
-  for (Action action : state_->LegalActions()) legal_actions_.insert(action);
+  // adding are legal. Sorted, so that an action's child slot can be found by
+  // binary search.
+  legal_actions_ = state_->LegalActions();
+  absl::c_sort(legal_actions_);
+  children_.resize(legal_actions_.size(), {0.0, nullptr});
   if (type_ == StateType::kTerminal) value_ = state_->PlayerReturn(player_id);
 }
 
-void HistoryNode::AddChild(
-    Action outcome, std::pair<double, std::unique_ptr<HistoryNode>> child) {
-  if (!legal_actions_.count(outcome)) SpielFatalError("Child is not legal.");
+// Returns the index of the action in the (sorted) legal action list, or -1 if
+// the action is not legal here.
+int HistoryNode::ChildIndex(Action outcome) const {
+  auto it = absl::c_lower_bound(legal_actions_, outcome);
+  if (it == legal_actions_.end() || *it != outcome) return -1;
+  return it - legal_actions_.begin();
+}
+
+Action HistoryNode::NumChildren() const {
+  return absl::c_count_if(children_,
+                          [](const std::pair<double, HistoryNode*>& child) {
+                            return child.second != nullptr;
+                          });
+}
+
+void HistoryNode::AddChild(Action outcome,
+                           std::pair<double, HistoryNode*> child) {
+  int index = ChildIndex(outcome);
+  if (index < 0) SpielFatalError("Child is not legal.");
   if (child.second == nullptr) {
     SpielFatalError("Error inserting child; child is null.");
   }
   SPIEL_CHECK_PROB_TOLERANCE(child.first, ProbabilityDefaultTolerance());
-  child_info_[outcome] = std::move(child);
-  if (child_info_.size() > legal_actions_.size()) {
-    SpielFatalError("More children than legal actions.");
-  }
+  children_[index] = child;
 }
 
 std::pair<double, HistoryNode*> HistoryNode::GetChild(Action outcome) {
-  auto it = child_info_.find(outcome);
-  if (it == child_info_.end()) {
+  int index = ChildIndex(outcome);
+  if (index < 0 || children_[index].second == nullptr) {
     SpielFatalError("Error getting child; action not found.");
   }
-  // it->second.first is the probability associated with outcome, so as it is a
+  const std::pair<double, HistoryNode*>& child = children_[index];
+  // child.first is the probability associated with outcome, so as it is a
   // probability, it must be in [0, 1].
-  SPIEL_CHECK_PROB_TOLERANCE(it->second.first, ProbabilityDefaultTolerance());
-  std::pair<double, HistoryNode*> child =
-      std::make_pair(it->second.first, it->second.second.get());
-  if (child.second == nullptr) {
-    SpielFatalError("Error getting child; child is null.");
-  }
+  SPIEL_CHECK_PROB_TOLERANCE(child.first, ProbabilityDefaultTolerance());
   return child;
 }
 
 std::vector<Action> HistoryNode::GetChildActions() const {
   std::vector<Action> actions;
-  actions.reserve(child_info_.size());
-  for (const auto& [action, _] : child_info_) actions.push_back(action);
+  actions.reserve(children_.size());
+  for (int i = 0; i < static_cast<int>(children_.size()); ++i) {
+    if (children_[i].second != nullptr) actions.push_back(legal_actions_[i]);
+  }
   return actions;
 }
 
+int64_t HistoryNode::MemoryFootprint() const {
+  int64_t bytes = sizeof(*this);
+  if (state_ != nullptr) bytes += state_->MemoryFootprint();
+  // Small strings live inside the std::string object already counted above.
+  if (infostate_.capacity() > sizeof(std::string)) {
+    bytes += infostate_.capacity();
+  }
+  if (history_.capacity() > sizeof(std::string)) bytes += history_.capacity();
+  bytes += legal_actions_.capacity() * sizeof(Action);
+  bytes += children_.capacity() * sizeof(std::pair<double, HistoryNode*>);
+  return bytes;
+}
+
+int64_t HistoryTree::MemoryFootprint() const {
+  int64_t bytes = sizeof(*this);
+  bytes += nodes_.capacity() * sizeof(std::unique_ptr<HistoryNode>);
+  for (const std::unique_ptr<HistoryNode>& node : nodes_) {
+    bytes += node->MemoryFootprint();
+  }
+  // The map's keys are views into strings owned by the nodes, so only the
+  // table itself is counted here.
+  bytes += state_to_node_.capacity() *
+           (sizeof(std::pair<absl::string_view, HistoryNode*>) + 1);
+  return bytes;
+}
+
 HistoryNode* HistoryTree::GetByHistory(const std::string& history) {
   auto it = state_to_node_.find(history);
   if (it == state_to_node_.end()) {
@@ -147,14 +194,16 @@ HistoryNode* HistoryTree::GetByHistory(const std::string& history) {
 std::vector<std::string> HistoryTree::GetHistories() {
   std::vector<std::string> histories;
   histories.reserve(state_to_node_.size());
-  for (const auto& [history, _] : state_to_node_) histories.push_back(history);
+  for (const auto& [history, _] : state_to_node_) {
+    histories.push_back(std::string(history));
+  }
   return histories;
 }
 
 // Builds game tree consisting of all decision nodes for player_id.
 HistoryTree::HistoryTree(std::unique_ptr<State> state, Player player_id) {
-  root_ =
-      RecursivelyBuildGameTree(std::move(state), player_id, &state_to_node_);
+  RecursivelyBuildGameTree(std::move(state), player_id, &nodes_,
+                           &state_to_node_);
 }
 
 ActionsAndProbs GetSuccessorsWithProbs(const State& state,
@@ -21,9 +21,8 @@
 #include <utility>
 #include <vector>
 
-#include "open_spiel/abseil-cpp/absl/container/btree_map.h"
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
-#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -41,7 +40,11 @@ class HistoryNode {
   static constexpr const char* kChanceNodeInfostateString = "Chance Node";
   static constexpr const char* kTerminalNodeInfostateString = "Terminal node";
 
-  HistoryNode(Player player_id, std::unique_ptr<State> game_state);
+  HistoryNode(int node_id, Player player_id, std::unique_ptr<State> game_state);
+
+  // Sequential id assigned by the owning HistoryTree; the node's index into
+  // the tree's flat node storage.
+  int id() const { return id_; }
 
   State* GetState() { return state_.get(); }
 
@@ -53,27 +56,32 @@ class HistoryNode {
 
   double GetValue() const { return value_; }
 
-  Action NumChildren() const { return child_info_.size(); }
+  Action NumChildren() const;
 
-  void AddChild(Action outcome,
-                std::pair<double, std::unique_ptr<HistoryNode>> child);
+  // The child is owned by the HistoryTree, not by its parent node.
+  void AddChild(Action outcome, std::pair<double, HistoryNode*> child);
 
   std::vector<Action> GetChildActions() const;
 
   std::pair<double, HistoryNode*> GetChild(Action outcome);
 
+  // Approximate bytes held by this node, including its owned State.
+  int64_t MemoryFootprint() const;
+
  private:
+  int ChildIndex(Action outcome) const;
+
+  int id_;
   std::unique_ptr<State> state_;
   std::string infostate_;
   std::string history_;
   StateType type_;
   double value_;
 
-  // Map from legal actions to transition probabilities. Uses a map as we need
-  // to preserve the order of the actions.
-  absl::flat_hash_set<Action> legal_actions_;
-  absl::btree_map<Action, std::pair<double, std::unique_ptr<HistoryNode>>>
-      child_info_;
+  // The legal actions, sorted; children are stored in a flat vector parallel
+  // to this one, indexed by the action's position in it.
+  std::vector<Action> legal_actions_;
+  std::vector<std::pair<double, HistoryNode*>> children_;
 };
 
 // History here refers to the fact that we're using histories- i.e.
@@ -89,7 +97,7 @@ class HistoryTree {
   // viewed from the perspective of the player making the decision.
   HistoryTree(std::unique_ptr<State> state, Player player_id);
 
-  HistoryNode* Root() { return root_.get(); }
+  HistoryNode* Root() { return nodes_.front().get(); }
 
   HistoryNode* GetByHistory(const std::string& history);
   HistoryNode* GetByHistory(const State& state) {
@@ -101,11 +109,18 @@ class HistoryTree {
 
   Action NumHistories() { return state_to_node_.size(); }
 
+  // Approximate bytes held by the whole tree (nodes, their states, and the
+  // history lookup table), for logging memory growth on large games. O(nodes).
+  int64_t MemoryFootprint() const;
+
  private:
-  std::unique_ptr<HistoryNode> root_;
+  // All nodes, in creation (pre-)order; a node's index here is its id. The
+  // root is nodes_[0].
+  std::vector<std::unique_ptr<HistoryNode>> nodes_;
 
-  // Maps histories to HistoryNodes.
-  absl::flat_hash_map<std::string, HistoryNode*> state_to_node_;
+  // Maps histories to HistoryNodes. The keys are views into the history
+  // strings owned by the nodes, which are stable for the tree's lifetime.
+  absl::flat_hash_map<absl::string_view, HistoryNode*> state_to_node_;
 };
 
 // Returns a map of infostate strings to a vector of history nodes with
@@ -232,7 +232,9 @@ void TestGetAllInfoSetsMatchesInfoStates() {
             SpielFatalError("Legal action found that's not a child action.");
           }
           std::unique_ptr<State> child = node_state->Child(legal_action);
-          HistoryNode child_node = HistoryNode(Player{0}, std::move(child));
+          // The node is free-standing, not part of a tree, so any id works.
+          HistoryNode child_node =
+              HistoryNode(/*node_id=*/0, Player{0}, std::move(child));
           if (node->GetType() != StateType::kChance) {
             Player child_player = child_node.GetState()->CurrentPlayer();
             if (node_state->CurrentPlayer() == child_player) {
@@ -0,0 +1,247 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/infostate_cfr.h"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+InfostateCFRSolver::InfostateCFRSolver(const Game& game,
+                                       bool regret_matching_plus)
+    : regret_matching_plus_(regret_matching_plus) {
+  SPIEL_CHECK_EQ(game.NumPlayers(), 2);
+  std::vector<std::vector<Action>> terminal_histories[2];
+  {
+    std::shared_ptr<InfostateTree> tree0 = MakeInfostateTree(game, 0);
+    std::shared_ptr<InfostateTree> tree1 = MakeInfostateTree(game, 1);
+    CompileTree(*tree0, &trees_[0], &terminal_histories[0]);
+    CompileTree(*tree1, &trees_[1], &terminal_histories[1]);
+    // The trees (and the States they hold) are released here; the iterations
+    // only touch the flat arrays.
+  }
+  MatchTerminals(terminal_histories[0], terminal_histories[1]);
+}
+
+void InfostateCFRSolver::CompileTree(
+    const InfostateTree& tree, FlatTree* flat,
+    std::vector<std::vector<Action>>* terminal_histories) {
+  // Index the nodes in topological order: nodes_at_depths lists parents
+  // before children.
+  absl::flat_hash_map<const InfostateNode*, int> node_index;
+  for (const std::vector<InfostateNode*>& depth_nodes :
+       tree.nodes_at_depths()) {
+    for (const InfostateNode* node : depth_nodes) {
+      node_index[node] = flat->num_nodes++;
+    }
+  }
+
+  flat->parent.assign(flat->num_nodes, -1);
+  flat->edge_slot.assign(flat->num_nodes, -1);
+  // Per-node first slot for decision nodes, used to compute edge slots.
+  std::vector<int> node_slot_begin(flat->num_nodes, -1);
+
+  for (const std::vector<InfostateNode*>& depth_nodes :
+       tree.nodes_at_depths()) {
+    for (const InfostateNode* node : depth_nodes) {
+      const int n = node_index.at(node);
+      const InfostateNode* parent = node->parent();
+      if (parent != nullptr) {
+        const int parent_index = node_index.at(parent);
+        flat->parent[n] = parent_index;
+        if (parent->type() == kDecisionInfostateNode) {
+          flat->edge_slot[n] =
+              node_slot_begin[parent_index] + node->incoming_index();
+        }
+      }
+      if (node->type() == kDecisionInfostateNode && !node->is_leaf_node()) {
+        node_slot_begin[n] = flat->num_slots;
+        flat->decision_node.push_back(n);
+        flat->decision_slot_begin.push_back(flat->num_slots);
+        flat->decision_infostate.push_back(node->infostate_string());
+        flat->decision_actions.push_back(node->legal_actions());
+        flat->num_slots += node->legal_actions().size();
+      } else if (node->type() == kTerminalInfostateNode) {
+        flat->terminal_node.push_back(n);
+        flat->terminal_value.push_back(node->terminal_utility() *
+                                       node->terminal_chance_reach_prob());
+        terminal_histories->push_back(node->TerminalHistory());
+      }
+    }
+  }
+
+  flat->terminal_match.assign(flat->terminal_node.size(), -1);
+  flat->regrets.assign(flat->num_slots, 0.0);
+  flat->current_policy.assign(flat->num_slots, 0.0);
+  flat->cumulative_policy.assign(flat->num_slots, 0.0);
+  flat->action_values.assign(flat->num_slots, 0.0);
+  flat->reach.assign(flat->num_nodes, 0.0);
+  flat->values.assign(flat->num_nodes, 0.0);
+}
+
+void InfostateCFRSolver::MatchTerminals(
+    const std::vector<std::vector<Action>>& terminal_histories0,
+    const std::vector<std::vector<Action>>& terminal_histories1) {
+  SPIEL_CHECK_EQ(terminal_histories0.size(), terminal_histories1.size());
+  absl::flat_hash_map<std::vector<Action>, int> history_to_position;
+  history_to_position.reserve(terminal_histories1.size());
+  for (int t = 0; t < terminal_histories1.size(); ++t) {
+    history_to_position[terminal_histories1[t]] = t;
+  }
+  for (int t0 = 0; t0 < terminal_histories0.size(); ++t0) {
+    auto iter = history_to_position.find(terminal_histories0[t0]);
+    SPIEL_CHECK_TRUE(iter != history_to_position.end());
+    const int t1 = iter->second;
+    trees_[0].terminal_match[t0] = trees_[1].terminal_node[t1];
+    trees_[1].terminal_match[t1] = trees_[0].terminal_node[t0];
+  }
+}
+
+void InfostateCFRSolver::RunIteration() {
+  ++iteration_;
+  // The current policies are fixed from the regrets first, so the two value
+  // passes both evaluate against the same joint policy.
+  ApplyRegretMatching(&trees_[0]);
+  ApplyRegretMatching(&trees_[1]);
+  TopDownReachPass(&trees_[0]);
+  TopDownReachPass(&trees_[1]);
+  BottomUpValuePass(&trees_[0], trees_[1]);
+  BottomUpValuePass(&trees_[1], trees_[0]);
+}
+
+void InfostateCFRSolver::RunIterations(int iterations) {
+  for (int i = 0; i < iterations; ++i) {
+    RunIteration();
+  }
+}
+
+void InfostateCFRSolver::ApplyRegretMatching(FlatTree* flat) {
+  for (int d = 0; d < flat->decision_node.size(); ++d) {
+    const int begin = flat->decision_slot_begin[d];
+    const int end = flat->decision_slot_end(d);
+    double pos_rsum = 0.0;
+    for (int s = begin; s < end; ++s) {
+      pos_rsum += std::max(0.0, flat->regrets[s]);
+    }
+    if (pos_rsum > 0) {
+      const double inv_rsum = 1.0 / pos_rsum;
+      for (int s = begin; s < end; ++s) {
+        flat->current_policy[s] = std::max(0.0, flat->regrets[s]) * inv_rsum;
+      }
+    } else {
+      const double uniform = 1.0 / (end - begin);
+      for (int s = begin; s < end; ++s) {
+        flat->current_policy[s] = uniform;
+      }
+    }
+  }
+}
+
+void InfostateCFRSolver::TopDownReachPass(FlatTree* flat) {
+  flat->reach[0] = 1.0;
+  for (int n = 1; n < flat->num_nodes; ++n) {
+    const int s = flat->edge_slot[n];
+    flat->reach[n] = flat->reach[flat->parent[n]] *
+                     (s >= 0 ? flat->current_policy[s] : 1.0);
+  }
+}
+
+void InfostateCFRSolver::BottomUpValuePass(FlatTree* flat,
+                                           const FlatTree& opponent) {
+  // Leaf counterfactual values: own terminal utility (chance reach included)
+  // weighted by the opponent's reach of the matching terminal.
+  std::fill(flat->values.begin(), flat->values.end(), 0.0);
+  for (int t = 0; t < flat->terminal_node.size(); ++t) {
+    flat->values[flat->terminal_node[t]] =
+        flat->terminal_value[t] * opponent.reach[flat->terminal_match[t]];
+  }
+
+  // Propagate values to the root; children of decision nodes are action
+  // values, recorded for the regret update below.
+  for (int n = flat->num_nodes - 1; n >= 1; --n) {
+    const int s = flat->edge_slot[n];
+    const double value = flat->values[n];
+    if (s >= 0) {
+      flat->action_values[s] = value;
+      flat->values[flat->parent[n]] += flat->current_policy[s] * value;
+    } else {
+      flat->values[flat->parent[n]] += value;
+    }
+  }
+
+  // Regret and average policy accumulation.
+  for (int d = 0; d < flat->decision_node.size(); ++d) {
+    const int node = flat->decision_node[d];
+    const int begin = flat->decision_slot_begin[d];
+    const int end = flat->decision_slot_end(d);
+    const double node_value = flat->values[node];
+    const double reach_weight = flat->reach[node];
+    for (int s = begin; s < end; ++s) {
+      flat->regrets[s] += flat->action_values[s] - node_value;
+      flat->cumulative_policy[s] += reach_weight * flat->current_policy[s];
+    }
+  }
+
+  if (regret_matching_plus_) {
+    for (double& regret : flat->regrets) {
+      regret = std::max(regret, 0.0);
+    }
+  }
+}
+
+TabularPolicy InfostateCFRSolver::PolicyFromSlabs(
+    const std::vector<double>& slots0,
+    const std::vector<double>& slots1) const {
+  TabularPolicy policy;
+  const std::vector<double>* slots[2] = {&slots0, &slots1};
+  for (int p = 0; p < 2; ++p) {
+    const FlatTree& flat = trees_[p];
+    for (int d = 0; d < flat.decision_node.size(); ++d) {
+      const int begin = flat.decision_slot_begin[d];
+      const int end = flat.decision_slot_end(d);
+      const double denom = std::accumulate(slots[p]->begin() + begin,
+                                           slots[p]->begin() + end, 0.0);
+      ActionsAndProbs state_policy;
+      state_policy.reserve(end - begin);
+      for (int i = 0; i < end - begin; ++i) {
+        const double prob = denom > 0 ? (*slots[p])[begin + i] / denom
+                                      : 1.0 / (end - begin);
+        SPIEL_CHECK_PROB(prob);
+        state_policy.push_back({flat.decision_actions[d][i], prob});
+      }
+      policy.SetStatePolicy(flat.decision_infostate[d], state_policy);
+    }
+  }
+  return policy;
+}
+
+TabularPolicy InfostateCFRSolver::AveragePolicy() const {
+  return PolicyFromSlabs(trees_[0].cumulative_policy,
+                         trees_[1].cumulative_policy);
+}
+
+TabularPolicy InfostateCFRSolver::CurrentPolicy() const {
+  return PolicyFromSlabs(trees_[0].current_policy, trees_[1].current_policy);
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,137 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_INFOSTATE_CFR_H_
+#define OPEN_SPIEL_ALGORITHMS_INFOSTATE_CFR_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open_spiel/algorithms/infostate_tree.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+
+// A counterfactual regret minimization solver that compiles the game into
+// flat arrays once, at construction, and then runs iterations purely over
+// those arrays.
+//
+// The compilation builds an `InfostateTree` for each player and flattens it
+// in topological order: the tree structure becomes parent-index and
+// edge-slot arrays, terminal nodes become (utility * chance reach) values
+// paired with the index of the matching terminal in the opponent's tree,
+// and the per-infostate regrets and policies become contiguous slabs indexed
+// by "slot" (one slot per decision-infostate action). An iteration is then
+// three linear sweeps per player -- regret matching over the slabs, a
+// top-down reach pass, and a bottom-up counterfactual value pass -- with no
+// State objects touched and no string lookups. The trees (and the States
+// they hold) are released once compilation is done.
+//
+// This performs simultaneous-move updates for both players each iteration
+// (vanilla CFR), optionally with regret matching+. It only supports
+// two-player games; the terminal utilities are taken from each player's own
+// tree, so general-sum games work as well.
+
+namespace open_spiel {
+namespace algorithms {
+
+class InfostateCFRSolver {
+ public:
+  explicit InfostateCFRSolver(const Game& game,
+                              bool regret_matching_plus = false);
+
+  void RunIteration();
+  void RunIterations(int iterations);
+
+  // Returns the average policy (normalized cumulative policy) over all
+  // decision infostates of both players.
+  TabularPolicy AveragePolicy() const;
+
+  // Returns the current policy (from regret matching) over all decision
+  // infostates of both players.
+  TabularPolicy CurrentPolicy() const;
+
+  int iteration() const { return iteration_; }
+
+ private:
+  // The flat, compiled form of one player's infostate tree. Nodes are
+  // indexed in topological order (parents precede children); "slots" index
+  // the per-action slabs, with each decision infostate owning a contiguous
+  // slot range.
+  struct FlatTree {
+    int num_nodes = 0;
+    int num_slots = 0;
+
+    // Structure arrays, indexed by node.
+    std::vector<int> parent;     // Parent node index; -1 for the root.
+    std::vector<int> edge_slot;  // Slot of the edge from the parent if the
+                                 // parent is a decision node, otherwise -1.
+
+    // Terminal arrays, one entry per terminal node.
+    std::vector<int> terminal_node;      // Node index of the terminal.
+    std::vector<double> terminal_value;  // Utility * chance reach.
+    std::vector<int> terminal_match;     // Matching node index in the
+                                         // opponent's tree.
+
+    // Decision-infostate arrays, one entry per decision infostate.
+    std::vector<int> decision_node;        // Node index.
+    std::vector<int> decision_slot_begin;  // First slot; the range ends at
+                                           // the next entry (or num_slots).
+    std::vector<std::string> decision_infostate;
+    std::vector<std::vector<Action>> decision_actions;
+
+    // Per-action slabs, indexed by slot.
+    std::vector<double> regrets;
+    std::vector<double> current_policy;
+    std::vector<double> cumulative_policy;
+    std::vector<double> action_values;  // Scratch for the bottom-up pass.
+
+    // Per-node scratch, reused across iterations.
+    std::vector<double> reach;   // Own-policy reach probabilities.
+    std::vector<double> values;  // Counterfactual values.
+
+    int decision_slot_end(int d) const {
+      return d + 1 < static_cast<int>(decision_slot_begin.size())
+                 ? decision_slot_begin[d + 1]
+                 : num_slots;
+    }
+  };
+
+  // Flattens one player's infostate tree. The terminal histories are
+  // returned (aligned with the terminal arrays) for cross-tree matching.
+  void CompileTree(const InfostateTree& tree, FlatTree* flat,
+                   std::vector<std::vector<Action>>* terminal_histories);
+  // Fills in terminal_match on both trees by pairing terminals with the same
+  // terminal history.
+  void MatchTerminals(
+      const std::vector<std::vector<Action>>& terminal_histories0,
+      const std::vector<std::vector<Action>>& terminal_histories1);
+
+  // The three sweeps of an iteration, for one player.
+  void ApplyRegretMatching(FlatTree* flat);
+  void TopDownReachPass(FlatTree* flat);
+  void BottomUpValuePass(FlatTree* flat, const FlatTree& opponent);
+
+  TabularPolicy PolicyFromSlabs(const std::vector<double>& slabs0,
+                                const std::vector<double>& slabs1) const;
+
+  const bool regret_matching_plus_;
+  int iteration_ = 0;
+  FlatTree trees_[2];
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_INFOSTATE_CFR_H_
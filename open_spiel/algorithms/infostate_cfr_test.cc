@@ -0,0 +1,67 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/infostate_cfr.h"
+
+#include <iostream>
+
+#include "open_spiel/algorithms/tabular_exploitability.h"
+#include "open_spiel/games/kuhn_poker/kuhn_poker.h"
+#include "open_spiel/games/leduc_poker/leduc_poker.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void InfostateCFRTest_KuhnPoker() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  InfostateCFRSolver solver(*game);
+  solver.RunIterations(300);
+  const TabularPolicy average_policy = solver.AveragePolicy();
+  const double exploitability = Exploitability(*game, average_policy);
+  std::cout << "Kuhn exploitability: " << exploitability << std::endl;
+  SPIEL_CHECK_LE(exploitability, 0.05);
+}
+
+void InfostateCFRPlusTest_KuhnPoker() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  InfostateCFRSolver solver(*game, /*regret_matching_plus=*/true);
+  solver.RunIterations(200);
+  const TabularPolicy average_policy = solver.AveragePolicy();
+  const double exploitability = Exploitability(*game, average_policy);
+  std::cout << "Kuhn (RM+) exploitability: " << exploitability << std::endl;
+  SPIEL_CHECK_LE(exploitability, 0.05);
+}
+
+void InfostateCFRTest_LeducPoker() {
+  std::shared_ptr<const Game> game = LoadGame("leduc_poker");
+  InfostateCFRSolver solver(*game);
+  solver.RunIterations(100);
+  const TabularPolicy average_policy = solver.AveragePolicy();
+  const double nash_conv = NashConv(*game, average_policy, true);
+  std::cout << "Leduc NashConv: " << nash_conv << std::endl;
+  SPIEL_CHECK_LE(nash_conv, 1.0);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::InfostateCFRTest_KuhnPoker();
+  open_spiel::algorithms::InfostateCFRPlusTest_KuhnPoker();
+  open_spiel::algorithms::InfostateCFRTest_LeducPoker();
+}
@@ -188,6 +188,7 @@ InfostateTree::InfostateTree(const std::vector<const State*>& start_states,
   nodes_at_depths_.resize(tree_height() + 1);
   CollectNodesAtDepth(mutable_root(), 0);
   LabelNodesWithIds();
+  CompileFlatStructure();
 }
 
 void InfostateTree::RebalanceTree() {
@@ -594,34 +595,69 @@ std::pair<size_t, size_t> InfostateTree::CollectStartEndSequenceIds(
   }
 }
 
+void InfostateTree::CompileFlatStructure() {
+  // Child sequence ranges, indexed by sequence id.
+  seq_children_start_.resize(num_sequences());
+  seq_children_end_.resize(num_sequences());
+  for (size_t s = 0; s < num_sequences(); ++s) {
+    const InfostateNode* node = sequences_[s];
+    seq_children_start_[s] = node->start_sequence_id().id();
+    seq_children_end_[s] = node->end_sequence_id().id();
+  }
+
+  // Per-depth child offsets and node kinds. The nodes at each depth are laid
+  // out so that the children of consecutive nodes are consecutive at the
+  // next depth.
+  depth_child_offsets_.resize(tree_height_);
+  depth_is_decision_.resize(tree_height_);
+  for (size_t d = 0; d < tree_height_; ++d) {
+    const std::vector<InfostateNode*>& nodes = nodes_at_depths_[d];
+    depth_child_offsets_[d].resize(nodes.size() + 1);
+    depth_is_decision_[d].resize(nodes.size());
+    size_t offset = 0;
+    depth_child_offsets_[d][0] = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      offset += nodes[i]->num_children();
+      depth_child_offsets_[d][i + 1] = offset;
+      depth_is_decision_[d][i] = nodes[i]->type() == kDecisionInfostateNode;
+    }
+    SPIEL_DCHECK_EQ(offset, nodes_at_depths_[d + 1].size());
+  }
+}
+
 std::pair<double, SfStrategy> InfostateTree::BestResponse(
     TreeplexVector<double>&& gradient) const {
   SPIEL_CHECK_EQ(this, gradient.tree());
   SPIEL_CHECK_EQ(num_sequences(), gradient.size());
   SfStrategy response(this);
+  double* grad = gradient.data();
+  double* resp = response.data();
+  const size_t empty_seq = empty_sequence().id();
 
   // 1. Compute counterfactual best response
   // (i.e. in all infostates, even unreachable ones)
-  SequenceId current(0, this);
+  // The child sequences of s occupy [start, end) with end <= s, so a single
+  // forward pass over the flat ranges propagates the maxima up the tree.
+  size_t current = 0;
   const double init_value = -std::numeric_limits<double>::infinity();
-  while (current.id() <= empty_sequence().id()) {
+  while (current <= empty_seq) {
     double max_value = init_value;
-    SequenceId max_id = current;
-    const InfostateNode* node = observation_infostate(current);
-    for (current = node->start_sequence_id();
-         current != node->end_sequence_id(); current.next()) {
-      if (gradient[current] > max_value) {
-        max_value = gradient[current];
+    size_t max_id = current;
+    const size_t s = current;
+    const size_t end = seq_children_end_[s];
+    for (current = seq_children_start_[s]; current != end; ++current) {
+      if (grad[current] > max_value) {
+        max_value = grad[current];
         max_id = current;
       }
     }
     if (init_value != max_value) {
-      gradient[node->sequence_id()] += max_value;
-      response[max_id] = 1.;
+      grad[s] += max_value;
+      resp[max_id] = 1.;
     }
-    current.next();
+    ++current;
   }
-  SPIEL_CHECK_EQ(current.id(), empty_sequence().id() + 1);
+  SPIEL_CHECK_EQ(current, empty_seq + 1);
 
   // 2. Prune away unreachable subtrees.
   //
@@ -629,58 +665,55 @@ std::pair<double, SfStrategy> InfostateTree::BestResponse(
   // Instead we make a more cache-friendly double pass through the response
   // vector: we increment the visited path by 1, resulting in a value of 2.
   // Then we zero-out all values but 2.
-  current = empty_sequence();
-  response[current] = 2.;
-  while (!IsLeafSequence(current)) {
-    for (SequenceId seq : observation_infostate(current)->AllSequenceIds()) {
-      if (response[seq] == 1.) {
+  current = empty_seq;
+  resp[current] = 2.;
+  while (seq_children_start_[current] != seq_children_end_[current]) {
+    const size_t end = seq_children_end_[current];
+    for (size_t seq = seq_children_start_[current]; seq != end; ++seq) {
+      if (resp[seq] == 1.) {
         current = seq;
-        response[seq] += 1.;
+        resp[seq] += 1.;
         break;
       }
     }
   }
-  for (SequenceId seq : response.range()) {
-    response[seq] = response[seq] == 2. ? 1. : 0.;
+  for (size_t seq = 0; seq <= empty_seq; ++seq) {
+    resp[seq] = resp[seq] == 2. ? 1. : 0.;
   }
   SPIEL_DCHECK_TRUE(IsValidSfStrategy(response));
-  return {gradient[empty_sequence()], response};
+  return {grad[empty_seq], response};
 }
 
 double InfostateTree::BestResponseValue(LeafVector<double>&& gradient) const {
-  // Loop over all heights.
+  double* grad = gradient.data();
+  // Loop over all heights. Each pass reduces the values at depth d + 1 into
+  // their parents at depth d, in place over the prefix of the same array;
+  // parent i writes index i only after reading its children at indices >= i.
   for (int d = tree_height_ - 1; d >= 0; d--) {
-    int left_offset = 0;
+    const std::vector<size_t>& offsets = depth_child_offsets_[d];
+    const std::vector<char>& is_decision = depth_is_decision_[d];
+    const size_t num_nodes = is_decision.size();
     // Loop over all parents of current nodes.
-    for (int parent_idx = 0; parent_idx < nodes_at_depths_[d].size();
-         parent_idx++) {
-      const InfostateNode* node = nodes_at_depths_[d][parent_idx];
-      const int num_children = node->num_children();
-      const Range<LeafId> children_range =
-          gradient.range(left_offset, left_offset + num_children);
-      const LeafId parent_id(parent_idx, this);
-
-      if (node->type() == kDecisionInfostateNode) {
+    for (size_t parent_idx = 0; parent_idx < num_nodes; parent_idx++) {
+      const size_t begin = offsets[parent_idx];
+      const size_t end = offsets[parent_idx + 1];
+
+      if (is_decision[parent_idx]) {
         double max_value = std::numeric_limits<double>::min();
-        for (LeafId id : children_range) {
-          max_value = std::fmax(max_value, gradient[id]);
+        for (size_t i = begin; i != end; ++i) {
+          max_value = std::fmax(max_value, grad[i]);
         }
-        gradient[parent_id] = max_value;
+        grad[parent_idx] = max_value;
       } else {
-        SPIEL_DCHECK_EQ(node->type(), kObservationInfostateNode);
         double sum_value = 0.;
-        for (LeafId id : children_range) {
-          sum_value += gradient[id];
+        for (size_t i = begin; i != end; ++i) {
+          sum_value += grad[i];
         }
-        gradient[parent_id] = sum_value;
+        grad[parent_idx] = sum_value;
       }
-      left_offset += num_children;
     }
-    // Check that we passed over all of the children.
-    SPIEL_DCHECK_EQ(left_offset, nodes_at_depths_[d + 1].size());
   }
-  const LeafId root_id(0, this);
-  return gradient[root_id];
+  return grad[0];
 }
 
 DecisionId InfostateTree::DecisionIdFromInfostateString(
@@ -405,6 +405,23 @@ class InfostateTree final {
   // The last vector corresponds to the leaf nodes.
   std::vector<std::vector<InfostateNode*>> nodes_at_depths_;
 
+  // Flat ("compiled") tree structure, derived once after the ids are
+  // assigned, so that the hot sequence-form operations run as tight loops
+  // over contiguous arrays instead of walking the node objects.
+  //
+  // For each sequence id s, the child sequences of s form the contiguous
+  // range [seq_children_start_[s], seq_children_end_[s]). The range is
+  // empty (start == end) for leaf sequences.
+  std::vector<size_t> seq_children_start_;
+  std::vector<size_t> seq_children_end_;
+  // For each depth d < tree_height and i-th node at that depth: its children
+  // occupy [depth_child_offsets_[d][i], depth_child_offsets_[d][i + 1])
+  // among the nodes at depth d + 1, and depth_is_decision_[d][i] says
+  // whether the node maximizes (decision node) or sums (observation node)
+  // over them.
+  std::vector<std::vector<size_t>> depth_child_offsets_;
+  std::vector<std::vector<char>> depth_is_decision_;
+
   // Utility functions whenever we create a new node for the tree.
   std::unique_ptr<InfostateNode> MakeNode(InfostateNode* parent,
                                           InfostateNodeType type,
@@ -438,6 +455,8 @@ class InfostateTree final {
 
   void CollectNodesAtDepth(InfostateNode* node, size_t depth);
   void LabelNodesWithIds();
+  // Fills the flat arrays above; must run after LabelNodesWithIds.
+  void CompileFlatStructure();
   std::pair<size_t, size_t> CollectStartEndSequenceIds(
       InfostateNode* node, const SequenceId parent_sequence);
 };
@@ -683,6 +702,11 @@ class TreeVector {
     return os << vec_ << " (for player " << tree_->acting_player() << ')';
   }
   size_t size() const { return vec_.size(); }
+  // Raw access to the underlying contiguous storage. Used by the flat
+  // (compiled) tree kernels, where indexing through typed ids in the inner
+  // loops would get in the way of vectorization.
+  T* data() { return vec_.data(); }
+  const T* data() const { return vec_.data(); }
   Range<Id> range() { return Range<Id>(0, vec_.size(), tree_); }
   Range<Id> range(size_t from, size_t to) { return Range<Id>(from, to, tree_); }
   const InfostateTree* tree() const { return tree_; }
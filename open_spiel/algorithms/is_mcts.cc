@@ -15,6 +15,9 @@
 #include "open_spiel/algorithms/is_mcts.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>  // NOLINT
+#include <mutex>  // NOLINT
 #include <numeric>
 
 #include "open_spiel/abseil-cpp/absl/random/discrete_distribution.h"
@@ -22,6 +25,7 @@
 #include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -77,11 +81,15 @@ ActionsAndProbs ISMCTSBot::RunSearch(const State& state) {
 
   auto root_infostate_key = GetStateKey(state);
 
-  for (int sim = 0; sim < max_simulations_; ++sim) {
-    std::unique_ptr<State> sampled_root_state = SampleRootState(state);
-    SPIEL_CHECK_TRUE(root_infostate_key == GetStateKey(*sampled_root_state));
-    SPIEL_CHECK_TRUE(sampled_root_state != nullptr);
-    RunSimulation(sampled_root_state.get());
+  if (num_search_threads_ > 1) {
+    ParallelRunSearch(state, root_infostate_key);
+  } else {
+    for (int sim = 0; sim < max_simulations_; ++sim) {
+      std::unique_ptr<State> sampled_root_state = SampleRootState(state);
+      SPIEL_CHECK_TRUE(root_infostate_key == GetStateKey(*sampled_root_state));
+      SPIEL_CHECK_TRUE(sampled_root_state != nullptr);
+      RunSimulation(sampled_root_state.get());
+    }
   }
 
   if (allow_inconsistent_action_sets_) {
@@ -111,6 +119,13 @@ std::pair<ActionsAndProbs, Action> ISMCTSBot::StepWithPolicy(
   return {policy, sampled_action};
 }
 
+void ISMCTSBot::StepInto(const State& state, BotResponse* response) {
+  // The search policy is built fresh by RunSearch; moving it into the
+  // response avoids the extra copy StepWithPolicy makes.
+  response->policy = RunSearch(state);
+  response->action = SampleAction(response->policy, RandomNumber()).first;
+}
+
 ActionsAndProbs ISMCTSBot::GetFinalPolicy(const State& state,
                                           ISMCTSNode* node) const {
   ActionsAndProbs policy;
@@ -182,9 +197,9 @@ ActionsAndProbs ISMCTSBot::GetFinalPolicy(const State& state,
 
 std::unique_ptr<State> ISMCTSBot::SampleRootState(const State& state) {
   if (max_world_samples_ == kUnlimitedNumWorldSamples) {
-    return ResampleFromInfostate(state);
+    return ResampleFromInfostate(state, &rng_);
   } else if (root_samples_.size() < max_world_samples_) {
-    root_samples_.push_back(ResampleFromInfostate(state));
+    root_samples_.push_back(ResampleFromInfostate(state, &rng_));
     return root_samples_.back()->Clone();
   } else if (root_samples_.size() == max_world_samples_) {
     int idx = absl::Uniform(rng_, 0u, root_samples_.size());
@@ -194,15 +209,15 @@ std::unique_ptr<State> ISMCTSBot::SampleRootState(const State& state) {
   }
 }
 
-std::unique_ptr<State> ISMCTSBot::ResampleFromInfostate(const State& state) {
+std::unique_ptr<State> ISMCTSBot::ResampleFromInfostate(const State& state,
+                                                        std::mt19937* rng) {
+  auto random_number = [rng]() { return absl::Uniform(*rng, 0.0, 1.0); };
   if (resampler_cb_) {
-    return resampler_cb_(state, state.CurrentPlayer(),
-                         [this]() { return RandomNumber(); });
+    return resampler_cb_(state, state.CurrentPlayer(), random_number);
   } else {
     // Try domain-specific implementation
     // (could be not implemented in some games).
-    return state.ResampleFromInfostate(state.CurrentPlayer(),
-                                       [this]() { return RandomNumber(); });
+    return state.ResampleFromInfostate(state.CurrentPlayer(), random_number);
   }
 }
 
@@ -256,7 +271,8 @@ void ISMCTSBot::ExpandIfNecessary(ISMCTSNode* node, Action action) const {
 }
 
 Action ISMCTSBot::SelectActionTreePolicy(
-    ISMCTSNode* node, const std::vector<Action>& legal_actions) {
+    ISMCTSNode* node, const std::vector<Action>& legal_actions,
+    std::mt19937* rng) {
   // Check to see if we are allowing inconsistent action sets.
   if (allow_inconsistent_action_sets_) {
     // If so, it could mean that the node has actions with child info that are
@@ -265,18 +281,18 @@ Action ISMCTSBot::SelectActionTreePolicy(
     if (temp_node.total_visits == 0) {
       // If we've filtered everything, return a random action.
       Action action =
-          legal_actions[absl::Uniform(rng_, 0u, legal_actions.size())];
+          legal_actions[absl::Uniform(*rng, 0u, legal_actions.size())];
       ExpandIfNecessary(node, action);
       return action;
     } else {
-      return SelectActionUCB(&temp_node);
+      return SelectActionUCB(&temp_node, rng);
     }
   } else {
-    return SelectActionUCB(node);
+    return SelectActionUCB(node, rng);
   }
 }
 
-Action ISMCTSBot::SelectActionUCB(ISMCTSNode* node) {
+Action ISMCTSBot::SelectActionUCB(ISMCTSNode* node, std::mt19937* rng) {
   std::vector<Action> candidates;
   double max_value = -std::numeric_limits<double>::infinity();
 
@@ -307,12 +323,13 @@ Action ISMCTSBot::SelectActionUCB(ISMCTSNode* node) {
   if (candidates.size() == 1) {
     return candidates[0];
   } else {
-    return candidates[absl::Uniform(rng_, 0u, candidates.size())];
+    return candidates[absl::Uniform(*rng, 0u, candidates.size())];
   }
 }
 
 Action ISMCTSBot::CheckExpand(ISMCTSNode* node,
-                              const std::vector<Action>& legal_actions) {
+                              const std::vector<Action>& legal_actions,
+                              std::mt19937* rng) {
   // Fast check in the common/default case.
   if (!allow_inconsistent_action_sets_ &&
       node->child_info.size() == legal_actions.size()) {
@@ -321,7 +338,7 @@ Action ISMCTSBot::CheckExpand(ISMCTSNode* node,
 
   // Shuffle the legal actions to remove the bias from the move order.
   std::vector<Action> legal_actions_copy = legal_actions;
-  std::shuffle(legal_actions_copy.begin(), legal_actions_copy.end(), rng_);
+  std::shuffle(legal_actions_copy.begin(), legal_actions_copy.end(), *rng);
   for (Action action : legal_actions_copy) {
     if (node->child_info.find(action) == node->child_info.end()) {
       return action;
@@ -351,13 +368,13 @@ std::vector<double> ISMCTSBot::RunSimulation(State* state) {
     return evaluator_->Evaluate(*state);
   } else {
     // Apply tree policy.
-    Action chosen_action = CheckExpand(node, legal_actions);
+    Action chosen_action = CheckExpand(node, legal_actions, &rng_);
     if (chosen_action != kInvalidAction) {
       // Expand.
       ExpandIfNecessary(node, chosen_action);
     } else {
       // No expansion, so use the tree policy to select.
-      chosen_action = SelectActionTreePolicy(node, legal_actions);
+      chosen_action = SelectActionTreePolicy(node, legal_actions, &rng_);
     }
 
     SPIEL_CHECK_NE(chosen_action, kInvalidAction);
@@ -376,5 +393,166 @@ std::vector<double> ISMCTSBot::RunSimulation(State* state) {
   }
 }
 
+std::vector<double> ISMCTSBot::RunSimulationConcurrent(State* state,
+                                                       std::mt19937* rng,
+                                                       std::mutex* tree_mutex) {
+  struct PathEntry {
+    ISMCTSNode* node;
+    Action action;
+    Player player;
+  };
+  std::vector<PathEntry> visit_path;
+  std::vector<double> returns;
+
+  while (true) {
+    if (state->IsTerminal()) {
+      returns = state->Returns();
+      break;
+    }
+    if (state->IsChanceNode()) {
+      Action chance_action =
+          SampleAction(state->ChanceOutcomes(), absl::Uniform(*rng, 0.0, 1.0))
+              .first;
+      state->ApplyAction(chance_action);
+      continue;
+    }
+
+    std::vector<Action> legal_actions = state->LegalActions();
+    Player cur_player = state->CurrentPlayer();
+    Action chosen_action = kInvalidAction;
+    bool at_leaf = false;
+    {
+      std::lock_guard<std::mutex> lock(*tree_mutex);
+      ISMCTSNode* node = LookupOrCreateNode(*state);
+      SPIEL_CHECK_TRUE(node != nullptr);
+      if (node->total_visits == kUnexpandedVisitCount) {
+        // Newly created node, so we've just stepped out of the tree.
+        node->total_visits = 0;  // Expand the node.
+        at_leaf = true;
+      } else {
+        chosen_action = CheckExpand(node, legal_actions, rng);
+        if (chosen_action != kInvalidAction) {
+          // Expand.
+          ExpandIfNecessary(node, chosen_action);
+        } else {
+          // No expansion, so use the tree policy to select.
+          chosen_action = SelectActionTreePolicy(node, legal_actions, rng);
+        }
+        SPIEL_CHECK_NE(chosen_action, kInvalidAction);
+        // As in RunSimulation, the visit is counted before the value comes
+        // back. Under concurrency this doubles as a virtual loss: in-flight
+        // actions look visited-but-unrewarded, so other workers tend to
+        // descend different lines.
+        node->total_visits++;
+        node->child_info[chosen_action].visits++;
+        visit_path.push_back(PathEntry{node, chosen_action, cur_player});
+      }
+    }
+
+    if (at_leaf) {
+      // Evaluation is where the time goes, so it runs without the lock.
+      returns = evaluator_->Evaluate(*state);
+      break;
+    }
+    state->ApplyAction(chosen_action);
+  }
+
+  std::lock_guard<std::mutex> lock(*tree_mutex);
+  for (const PathEntry& entry : visit_path) {
+    entry.node->child_info[entry.action].return_sum += returns[entry.player];
+  }
+  return returns;
+}
+
+void ISMCTSBot::ParallelRunSearch(const State& state,
+                                  const ISMCTSStateKey& root_infostate_key) {
+  std::mutex tree_mutex;
+  std::atomic<int> num_started(0);
+
+  // With a bounded number of world samples, draw them all up front so the
+  // workers only ever clone from the (then read-only) sample list.
+  if (max_world_samples_ != kUnlimitedNumWorldSamples) {
+    while (root_samples_.size() < max_world_samples_) {
+      root_samples_.push_back(ResampleFromInfostate(state, &rng_));
+    }
+  }
+
+  // The determinization pool. A producer thread keeps it topped up so that
+  // workers usually find a pre-resampled world state waiting; a worker that
+  // finds the pool empty resamples on its own rather than wait.
+  const bool use_pool = determinization_pool_size_ > 0 &&
+                        max_world_samples_ == kUnlimitedNumWorldSamples;
+  std::mutex pool_mutex;
+  std::condition_variable pool_cv;
+  std::vector<std::unique_ptr<State>> pool;
+  std::atomic<bool> pool_done(false);
+
+  std::unique_ptr<Thread> producer;
+  if (use_pool) {
+    std::mt19937 producer_rng(rng_());
+    producer = std::make_unique<Thread>([this, &state, &pool_mutex, &pool_cv,
+                                         &pool, &pool_done,
+                                         producer_rng]() mutable {
+      while (!pool_done.load()) {
+        std::unique_ptr<State> sample =
+            ResampleFromInfostate(state, &producer_rng);
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        pool_cv.wait(lock, [this, &pool, &pool_done]() {
+          return static_cast<int>(pool.size()) < determinization_pool_size_ ||
+                 pool_done.load();
+        });
+        if (pool_done.load()) break;
+        pool.push_back(std::move(sample));
+      }
+    });
+  }
+
+  std::vector<Thread> workers;
+  workers.reserve(num_search_threads_);
+  for (int t = 0; t < num_search_threads_; ++t) {
+    std::mt19937 worker_rng(rng_());
+    workers.emplace_back([this, &state, &root_infostate_key, &tree_mutex,
+                          &pool_mutex, &pool_cv, &pool, &num_started, use_pool,
+                          worker_rng]() mutable {
+      while (num_started.fetch_add(1) < max_simulations_) {
+        std::unique_ptr<State> sampled_root_state;
+        if (max_world_samples_ != kUnlimitedNumWorldSamples) {
+          int idx = absl::Uniform(worker_rng, 0u, root_samples_.size());
+          sampled_root_state = root_samples_[idx]->Clone();
+        } else {
+          if (use_pool) {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            if (!pool.empty()) {
+              sampled_root_state = std::move(pool.back());
+              pool.pop_back();
+              pool_cv.notify_one();
+            }
+          }
+          if (sampled_root_state == nullptr) {
+            sampled_root_state = ResampleFromInfostate(state, &worker_rng);
+          }
+        }
+        SPIEL_CHECK_TRUE(sampled_root_state != nullptr);
+        SPIEL_CHECK_TRUE(root_infostate_key ==
+                         GetStateKey(*sampled_root_state));
+        RunSimulationConcurrent(sampled_root_state.get(), &worker_rng,
+                                &tree_mutex);
+      }
+    });
+  }
+
+  for (Thread& worker : workers) {
+    worker.join();
+  }
+  if (producer != nullptr) {
+    {
+      std::lock_guard<std::mutex> lock(pool_mutex);
+      pool_done.store(true);
+    }
+    pool_cv.notify_all();
+    producer->join();
+  }
+}
+
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_ALGORITHMS_IS_MCTS_H_
 
 #include <memory>
+#include <mutex>
 #include <random>
 #include <string>
 #include <utility>
@@ -92,6 +93,7 @@ class ISMCTSBot : public Bot {
   ActionsAndProbs GetPolicy(const State& state) override;
   std::pair<ActionsAndProbs, Action> StepWithPolicy(
       const State& state) override;
+  void StepInto(const State& state, BotResponse* response) override;
 
   ActionsAndProbs RunSearch(const State& state);
 
@@ -101,6 +103,31 @@ class ISMCTSBot : public Bot {
   // Set a custom resampling function.
   void SetResampler(InfostateResampler cb) { resampler_cb_ = cb; }
 
+  // Sets the number of worker threads used by RunSearch. With more than one
+  // thread, simulations run concurrently over the shared tree: node lookups,
+  // selection and visit updates are serialized by a tree mutex, while leaf
+  // evaluation and root resampling (the expensive parts) run in parallel.
+  // Each worker draws from its own RNG seeded from the bot's, so a seeded bot
+  // is still deterministic in the seeds it hands out, but results are not
+  // reproducible across thread counts. The evaluator, any resampler set via
+  // SetResampler, and the game's ResampleFromInfostate must be safe to call
+  // concurrently (as RandomRolloutEvaluator is).
+  void SetNumSearchThreads(int num_search_threads) {
+    SPIEL_CHECK_GE(num_search_threads, 1);
+    num_search_threads_ = num_search_threads;
+  }
+
+  // Sets the target size of the determinization pool used by the parallel
+  // search. When positive (and the number of world samples is unlimited), a
+  // background thread keeps up to this many pre-resampled world states ready,
+  // so workers rarely pay for ResampleFromInfostate on their own simulation;
+  // a worker that finds the pool empty resamples itself rather than wait.
+  // Ignored in single-threaded search.
+  void SetDeterminizationPoolSize(int pool_size) {
+    SPIEL_CHECK_GE(pool_size, 0);
+    determinization_pool_size_ = pool_size;
+  }
+
  private:
   void Reset();
   double RandomNumber();
@@ -109,21 +136,23 @@ class ISMCTSBot : public Bot {
   std::unique_ptr<State> SampleRootState(const State& state);
   // Dispatch to either domain-specific implementation,
   // or a specially supplied one via SetResampler()
-  std::unique_ptr<State> ResampleFromInfostate(const State& state);
+  std::unique_ptr<State> ResampleFromInfostate(const State& state,
+                                               std::mt19937* rng);
   ISMCTSNode* CreateNewNode(const State& state);
   ISMCTSNode* LookupNode(const State& state);
   ISMCTSNode* LookupOrCreateNode(const State& state);
   Action SelectActionTreePolicy(ISMCTSNode* node,
-                                const std::vector<Action>& legal_actions);
-  Action SelectActionUCB(ISMCTSNode* node);
+                                const std::vector<Action>& legal_actions,
+                                std::mt19937* rng);
+  Action SelectActionUCB(ISMCTSNode* node, std::mt19937* rng);
   ActionsAndProbs GetFinalPolicy(const State& state, ISMCTSNode* node) const;
   void ExpandIfNecessary(ISMCTSNode* node, Action action) const;
 
   // Check if an expansion is possible (i.e. node does not contain all the
   // actions). If so, returns an action not yet in the children. Otherwise,
   // returns kInvalidAction.
-  Action CheckExpand(ISMCTSNode* node,
-                     const std::vector<Action>& legal_actions);
+  Action CheckExpand(ISMCTSNode* node, const std::vector<Action>& legal_actions,
+                     std::mt19937* rng);
 
   // Returns a copy of the node with any actions not in specified legal actions
   // removed.
@@ -133,6 +162,18 @@ class ISMCTSBot : public Bot {
   // Run a simulation, returning the player returns.
   std::vector<double> RunSimulation(State* state);
 
+  // Iterative variant of RunSimulation for the parallel search: tree reads
+  // and updates take the tree mutex, evaluation runs without it. Counting a
+  // visit before its value arrives doubles as a virtual loss, spreading
+  // concurrent workers over different lines.
+  std::vector<double> RunSimulationConcurrent(State* state, std::mt19937* rng,
+                                              std::mutex* tree_mutex);
+
+  // Runs the simulations of one search on num_search_threads_ workers,
+  // optionally fed by a background determinization pool.
+  void ParallelRunSearch(const State& state,
+                         const ISMCTSStateKey& root_infostate_key);
+
   std::mt19937 rng_;
   std::shared_ptr<Evaluator> evaluator_;
   absl::flat_hash_map<ISMCTSStateKey, ISMCTSNode*> nodes_;
@@ -150,6 +191,8 @@ class ISMCTSBot : public Bot {
   const bool allow_inconsistent_action_sets_;
   ISMCTSNode* root_node_;
   InfostateResampler resampler_cb_;
+  int num_search_threads_ = 1;
+  int determinization_pool_size_ = 0;
 };
 
 }  // namespace algorithms
@@ -98,6 +98,28 @@ void ISMCTS_LeducObservationTest() {
   PlayGame(*game, bot.get(), &rng);
 }
 
+void ISMCTS_ParallelSearchTest() {
+  std::mt19937 rng(kSeed);
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  auto evaluator =
+      std::make_shared<algorithms::RandomRolloutEvaluator>(1, kSeed);
+
+  auto bot = std::make_unique<algorithms::ISMCTSBot>(
+      kSeed, evaluator, 5.0, 1000);
+  bot->SetNumSearchThreads(4);
+  bot->SetDeterminizationPoolSize(16);
+  std::cout << "Testing kuhn_poker, parallel bot" << std::endl;
+  PlayGame(*game, bot.get(), &rng);
+
+  // Also with a bounded number of world samples, which are drawn up front.
+  auto bot2 = std::make_unique<algorithms::ISMCTSBot>(
+      kSeed, evaluator, 5.0, 1000, 10,
+      algorithms::ISMCTSFinalPolicyType::kNormalizedVisitCount, false, false);
+  bot2->SetNumSearchThreads(4);
+  std::cout << "Testing kuhn_poker, parallel bot, bounded samples" << std::endl;
+  PlayGame(*game, bot2.get(), &rng);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -105,4 +127,5 @@ int main(int argc, char** argv) {
   open_spiel::ISMCTS_BasicPlayGameTest_Kuhn();
   open_spiel::ISMCTS_BasicPlayGameTest_Leduc();
   open_spiel::ISMCTS_LeducObservationTest();
+  open_spiel::ISMCTS_ParallelSearchTest();
 }
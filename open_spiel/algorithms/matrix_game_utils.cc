@@ -14,12 +14,18 @@
 
 #include "open_spiel/algorithms/matrix_game_utils.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "open_spiel/algorithms/deterministic_policy.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/simultaneous_move_game.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -92,38 +98,149 @@ std::shared_ptr<const MatrixGame> AsMatrixGame(const NormalFormGame* game) {
 }
 
 std::shared_ptr<const MatrixGame> ExtensiveToMatrixGame(const Game& game) {
+  return ExtensiveToMatrixGameParallel(game, /*num_threads=*/1);
+}
+
+std::shared_ptr<const MatrixGame> ExtensiveToMatrixGameParallel(
+    const Game& game, int num_threads) {
   SPIEL_CHECK_EQ(game.NumPlayers(), 2);
+  SPIEL_CHECK_GE(num_threads, 1);
 
+  GameType type = game.GetType();
+
+  // Enumerate the strategy names once up front; the row count also fixes the
+  // workers' slice boundaries.
   std::vector<std::string> row_names;
   std::vector<std::string> col_names;
-  std::vector<std::vector<double>> row_player_utils;
-  std::vector<std::vector<double>> col_player_utils;
+  {
+    DeterministicTabularPolicy row_policy(game, 0);
+    do {
+      row_names.push_back(row_policy.ToString(" --- "));
+    } while (row_policy.NextPolicy());
+    DeterministicTabularPolicy col_policy(game, 1);
+    do {
+      col_names.push_back(col_policy.ToString(" --- "));
+    } while (col_policy.NextPolicy());
+  }
+  const int num_rows = row_names.size();
+  const int num_cols = col_names.size();
+
+  std::vector<std::vector<double>> row_player_utils(num_rows);
+  std::vector<std::vector<double>> col_player_utils(num_rows);
+
+  const auto evaluate_rows = [&game, num_cols, &row_player_utils,
+                              &col_player_utils](int start, int end) {
+    // Worker-local cache. Chance-only subtree values are policy-independent
+    // and survive every version bump, so they are evaluated once per worker
+    // rather than once per cell; the version bump per cell invalidates the
+    // policy-dependent entries.
+    ExpectedReturnsCache cache;
+    uint64_t policy_version = 0;
+    DeterministicTabularPolicy row_policy(game, 0);
+    for (int r = 0; r < start; ++r) {
+      SPIEL_CHECK_TRUE(row_policy.NextPolicy());
+    }
+    DeterministicTabularPolicy col_policy(game, 1);
+    std::unique_ptr<State> root = game.NewInitialState();
+    for (int r = start; r < end; ++r) {
+      col_policy.ResetDefaultPolicy();
+      std::vector<double> row_utils;
+      std::vector<double> col_utils;
+      row_utils.reserve(num_cols);
+      col_utils.reserve(num_cols);
+      for (int c = 0; c < num_cols; ++c) {
+        std::vector<double> returns =
+            MemoizedExpectedReturns(*root, {&row_policy, &col_policy}, &cache,
+                                    ++policy_version);
+        row_utils.push_back(returns[0]);
+        col_utils.push_back(returns[1]);
+        if (c + 1 < num_cols) SPIEL_CHECK_TRUE(col_policy.NextPolicy());
+      }
+      row_player_utils[r] = std::move(row_utils);
+      col_player_utils[r] = std::move(col_utils);
+      if (r + 1 < end) SPIEL_CHECK_TRUE(row_policy.NextPolicy());
+    }
+  };
+
+  num_threads = std::min(num_threads, num_rows);
+  if (num_threads <= 1) {
+    evaluate_rows(0, num_rows);
+  } else {
+    std::vector<Thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      const int start = t * num_rows / num_threads;
+      const int end = (t + 1) * num_rows / num_threads;
+      threads.emplace_back(
+          [&evaluate_rows, start, end]() { evaluate_rows(start, end); });
+    }
+    for (Thread& thread : threads) thread.join();
+  }
 
-  GameType type = game.GetType();
+  return matrix_game::CreateMatrixGame(type.short_name, type.long_name,
+                                       row_names, col_names, row_player_utils,
+                                       col_player_utils);
+}
 
-  std::vector<DeterministicTabularPolicy> policies = {
-      DeterministicTabularPolicy(game, 0), DeterministicTabularPolicy(game, 1)};
+std::shared_ptr<const MatrixGame> CollapseDuplicateStrategies(
+    const MatrixGame& game) {
+  const int num_rows = game.NumRows();
+  const int num_cols = game.NumCols();
+
+  // Two strategies are duplicates when both players' payoffs agree against
+  // every opponent strategy (of the original game; collapsing rows cannot
+  // make previously distinct columns equal, and vice versa).
+  std::vector<int> kept_rows;
+  {
+    std::map<std::vector<double>, int> seen;
+    for (int r = 0; r < num_rows; ++r) {
+      std::vector<double> payoffs;
+      payoffs.reserve(2 * num_cols);
+      for (int c = 0; c < num_cols; ++c) {
+        payoffs.push_back(game.RowUtility(r, c));
+        payoffs.push_back(game.ColUtility(r, c));
+      }
+      if (seen.emplace(std::move(payoffs), r).second) kept_rows.push_back(r);
+    }
+  }
+  std::vector<int> kept_cols;
+  {
+    std::map<std::vector<double>, int> seen;
+    for (int c = 0; c < num_cols; ++c) {
+      std::vector<double> payoffs;
+      payoffs.reserve(2 * num_rows);
+      for (int r = 0; r < num_rows; ++r) {
+        payoffs.push_back(game.RowUtility(r, c));
+        payoffs.push_back(game.ColUtility(r, c));
+      }
+      if (seen.emplace(std::move(payoffs), c).second) kept_cols.push_back(c);
+    }
+  }
 
-  bool first_row = true;
-  do {
-    policies[1].ResetDefaultPolicy();
-    row_names.push_back(policies[0].ToString(" --- "));
+  GameType type = game.GetType();
+  std::vector<std::string> row_names;
+  std::vector<std::string> col_names;
+  row_names.reserve(kept_rows.size());
+  col_names.reserve(kept_cols.size());
+  for (int r : kept_rows) row_names.push_back(game.RowActionName(r));
+  for (int c : kept_cols) col_names.push_back(game.ColActionName(c));
+
+  std::vector<std::vector<double>> row_player_utils;
+  std::vector<std::vector<double>> col_player_utils;
+  row_player_utils.reserve(kept_rows.size());
+  col_player_utils.reserve(kept_rows.size());
+  for (int r : kept_rows) {
     std::vector<double> row_utils;
     std::vector<double> col_utils;
-    do {
-      if (first_row) {
-        col_names.push_back(policies[1].ToString(" --- "));
-      }
-      std::unique_ptr<State> state = game.NewInitialState();
-      std::vector<double> returns =
-          ExpectedReturns(*state, {&policies[0], &policies[1]}, -1);
-      row_utils.push_back(returns[0]);
-      col_utils.push_back(returns[1]);
-    } while (policies[1].NextPolicy());
-    first_row = false;
-    row_player_utils.push_back(row_utils);
-    col_player_utils.push_back(col_utils);
-  } while (policies[0].NextPolicy());
+    row_utils.reserve(kept_cols.size());
+    col_utils.reserve(kept_cols.size());
+    for (int c : kept_cols) {
+      row_utils.push_back(game.RowUtility(r, c));
+      col_utils.push_back(game.ColUtility(r, c));
+    }
+    row_player_utils.push_back(std::move(row_utils));
+    col_player_utils.push_back(std::move(col_utils));
+  }
 
   return matrix_game::CreateMatrixGame(type.short_name, type.long_name,
                                        row_names, col_names, row_player_utils,
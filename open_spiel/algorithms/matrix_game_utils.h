@@ -55,6 +55,26 @@ std::shared_ptr<const matrix_game::MatrixGame> AsMatrixGame(const Game* game);
 std::shared_ptr<const matrix_game::MatrixGame> ExtensiveToMatrixGame(
     const Game& game);
 
+// As ExtensiveToMatrixGame, but evaluates the payoff cells on `num_threads`
+// worker threads, each taking a contiguous slice of rows, and shares
+// expected-return caching across cells: subtrees containing only chance and
+// terminal nodes are policy-independent, so each worker evaluates them once
+// rather than once per cell. Produces exactly the same matrix game as
+// ExtensiveToMatrixGame.
+std::shared_ptr<const matrix_game::MatrixGame> ExtensiveToMatrixGameParallel(
+    const Game& game, int num_threads = 1);
+
+// Returns a reduced copy of `game` with payoff-duplicate strategies
+// collapsed: rows (and, independently, columns) whose payoffs for both
+// players agree everywhere are represented once, keeping the first
+// strategy's name. Most of the exponential blow-up of ExtensiveToMatrixGame
+// is deterministic policies that differ only in unreachable information
+// states, and those produce exactly such duplicates, so the reduced game is
+// typically orders of magnitude smaller while preserving the payoff
+// structure for equilibrium analysis.
+std::shared_ptr<const matrix_game::MatrixGame> CollapseDuplicateStrategies(
+    const matrix_game::MatrixGame& game);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
@@ -46,6 +46,67 @@ void ExtensiveToMatrixGameTest() {
   SPIEL_CHECK_EQ(kuhn_matrix_game->NumCols(), 64);
 }
 
+void ExtensiveToMatrixGameParallelTest() {
+  // The parallel conversion must produce exactly the same game, cell by cell,
+  // as the serial one.
+  std::shared_ptr<const Game> kuhn_game = LoadGame("kuhn_poker");
+  std::shared_ptr<const matrix_game::MatrixGame> serial =
+      ExtensiveToMatrixGame(*kuhn_game);
+  std::shared_ptr<const matrix_game::MatrixGame> parallel =
+      ExtensiveToMatrixGameParallel(*kuhn_game, /*num_threads=*/3);
+  SPIEL_CHECK_EQ(serial->NumRows(), parallel->NumRows());
+  SPIEL_CHECK_EQ(serial->NumCols(), parallel->NumCols());
+  for (int r = 0; r < serial->NumRows(); ++r) {
+    SPIEL_CHECK_EQ(serial->RowActionName(r), parallel->RowActionName(r));
+    for (int c = 0; c < serial->NumCols(); ++c) {
+      SPIEL_CHECK_EQ(serial->RowUtility(r, c), parallel->RowUtility(r, c));
+      SPIEL_CHECK_EQ(serial->ColUtility(r, c), parallel->ColUtility(r, c));
+    }
+  }
+}
+
+void CollapseDuplicateStrategiesTest() {
+  // Several of Kuhn's 64 deterministic row policies differ only in
+  // unreachable information states, so collapsing must shrink the rows;
+  // the column player has no duplicates, so the columns merely may not
+  // grow. Every kept strategy keeps its payoffs against every kept
+  // opponent strategy.
+  std::shared_ptr<const Game> kuhn_game = LoadGame("kuhn_poker");
+  std::shared_ptr<const matrix_game::MatrixGame> full =
+      ExtensiveToMatrixGame(*kuhn_game);
+  std::shared_ptr<const matrix_game::MatrixGame> reduced =
+      CollapseDuplicateStrategies(*full);
+  SPIEL_CHECK_LT(reduced->NumRows(), full->NumRows());
+  SPIEL_CHECK_LE(reduced->NumCols(), full->NumCols());
+
+  // Map each kept strategy name back to its index in the full game and check
+  // the payoffs are unchanged.
+  for (int r = 0; r < reduced->NumRows(); ++r) {
+    int full_r = -1;
+    for (int i = 0; i < full->NumRows(); ++i) {
+      if (full->RowActionName(i) == reduced->RowActionName(r)) {
+        full_r = i;
+        break;
+      }
+    }
+    SPIEL_CHECK_GE(full_r, 0);
+    for (int c = 0; c < reduced->NumCols(); ++c) {
+      int full_c = -1;
+      for (int i = 0; i < full->NumCols(); ++i) {
+        if (full->ColActionName(i) == reduced->ColActionName(c)) {
+          full_c = i;
+          break;
+        }
+      }
+      SPIEL_CHECK_GE(full_c, 0);
+      SPIEL_CHECK_EQ(reduced->RowUtility(r, c),
+                     full->RowUtility(full_r, full_c));
+      SPIEL_CHECK_EQ(reduced->ColUtility(r, c),
+                     full->ColUtility(full_r, full_c));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -53,4 +114,6 @@ void ExtensiveToMatrixGameTest() {
 int main(int argc, char** argv) {
   open_spiel::algorithms::ConvertToMatrixGameTest();
   open_spiel::algorithms::ExtensiveToMatrixGameTest();
+  open_spiel::algorithms::ExtensiveToMatrixGameParallelTest();
+  open_spiel::algorithms::CollapseDuplicateStrategiesTest();
 }
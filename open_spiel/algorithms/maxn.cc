@@ -14,6 +14,7 @@
 
 #include "open_spiel/algorithms/maxn.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -23,22 +24,38 @@
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
 namespace {
 
-std::vector<double> _maxn(
-    const State* state, int depth,
-    std::function<double(const State&, Player player)> value_function,
-    Action* best_action) {
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Search-wide configuration, threaded through the recursion by pointer so
+// that the recursion does not copy the value function at every node.
+struct MaxNContext {
+  std::function<double(const State&, Player player)> value_function;
+  bool use_undo;
+  MaxNTranspositionTable* table;  // May be nullptr.
+  bool use_pruning;
+  double min_utility;
+  double max_utility;
+  double utility_sum;  // Only meaningful when use_pruning is true.
+};
+
+// `bound` is the shallow-pruning cutoff: once the moving player here is
+// guaranteed at least `bound`, the parent player can never prefer this line
+// and the remaining siblings need not be searched.
+std::vector<double> _maxn(State* state, int depth, double bound,
+                          Action* best_action, MaxNContext* ctx) {
   const int num_players = state->NumPlayers();
 
   if (state->IsTerminal()) {
     return state->Returns();
   }
 
-  if (depth == 0 && !value_function) {
+  if (depth == 0 && !ctx->value_function) {
     SpielFatalError(
         "We assume we can walk the full depth of the tree. "
         "Try increasing depth or provide a value_function.");
@@ -47,7 +64,7 @@ std::vector<double> _maxn(
   if (depth == 0) {
     std::vector<double> values(num_players);
     for (Player p = 0; p < num_players; ++p) {
-      values[p] = value_function(*state, p);
+      values[p] = ctx->value_function(*state, p);
     }
     return values;
   }
@@ -56,33 +73,86 @@ std::vector<double> _maxn(
   if (state->IsChanceNode()) {
     std::vector<double> values(num_players, 0.0);
     for (const auto& actionprob : state->ChanceOutcomes()) {
-      std::unique_ptr<State> child_state = state->Child(actionprob.first);
-      std::vector<double> child_values =
-          _maxn(child_state.get(), depth, value_function,
-                /*best_action=*/nullptr);
+      std::vector<double> child_values;
+      // No pruning bound below a chance node: expectations mix the lines.
+      if (ctx->use_undo) {
+        state->ApplyAction(actionprob.first);
+        child_values = _maxn(state, depth, /*bound=*/kInfinity,
+                             /*best_action=*/nullptr, ctx);
+        state->UndoAction(player, actionprob.first);
+      } else {
+        std::unique_ptr<State> child_state = state->Child(actionprob.first);
+        child_values = _maxn(child_state.get(), depth, /*bound=*/kInfinity,
+                             /*best_action=*/nullptr, ctx);
+      }
       for (Player p = 0; p < num_players; ++p) {
         values[p] += actionprob.second * child_values[p];
       }
     }
     return values;
   } else {
-    double value = -std::numeric_limits<double>::infinity();
+    const uint64_t key = ctx->table != nullptr ? state->Key() : 0;
+    if (ctx->table != nullptr) {
+      if (const MaxNTranspositionTable::Entry* entry = ctx->table->Lookup(key)) {
+        if (entry->depth >= depth) {
+          if (best_action != nullptr) *best_action = entry->best_action;
+          return entry->values;
+        }
+      }
+    }
+
+    double value = -kInfinity;
     std::vector<double> values(num_players, 0);
+    Action local_best = kInvalidAction;
+    bool pruned = false;
 
     for (Action action : state->LegalActions()) {
-      std::unique_ptr<State> child_state = state->Child(action);
-      std::vector<double> child_values =
-          _maxn(child_state.get(),
-                /*depth=*/depth - 1, value_function,
-                /*best_action=*/nullptr);
+      // Once this node's player is guaranteed `value`, a line is only worth
+      // continuing for the child's player while their value stays below
+      // utility_sum - (n-2) * min_utility - value; beyond that, this node's
+      // player can no longer get more than `value` out of it.
+      const double child_bound =
+          ctx->use_pruning
+              ? ctx->utility_sum - (num_players - 2) * ctx->min_utility - value
+              : kInfinity;
+      std::vector<double> child_values;
+      if (ctx->use_undo) {
+        state->ApplyAction(action);
+        child_values = _maxn(state, /*depth=*/depth - 1, child_bound,
+                             /*best_action=*/nullptr, ctx);
+        state->UndoAction(player, action);
+      } else {
+        std::unique_ptr<State> child_state = state->Child(action);
+        child_values = _maxn(child_state.get(), /*depth=*/depth - 1,
+                             child_bound, /*best_action=*/nullptr, ctx);
+      }
 
       if (child_values[player] > value) {
         value = child_values[player];
-        values = child_values;
+        values = std::move(child_values);
+        local_best = action;
         if (best_action != nullptr) {
           *best_action = action;
         }
       }
+
+      if (ctx->use_pruning) {
+        // Immediate pruning: nothing can strictly beat the maximum utility,
+        // so the remaining siblings could never change the result. This cut
+        // is exact.
+        if (value >= ctx->max_utility) break;
+        // Shallow pruning: the parent will not take this line anyway.
+        if (value >= bound) {
+          pruned = true;
+          break;
+        }
+      }
+    }
+
+    // Only exact results enter the table: a shallow cutoff leaves the true
+    // max^n values of this node unresolved.
+    if (ctx->table != nullptr && !pruned) {
+      ctx->table->Store(key, {values, depth, local_best});
     }
     return values;
   }
@@ -92,7 +162,8 @@ std::vector<double> _maxn(
 std::pair<std::vector<double>, Action> MaxNSearch(
     const Game& game, const State* state,
     std::function<double(const State&, Player player)> value_function,
-    int depth_limit) {
+    int depth_limit, bool use_undo, MaxNTranspositionTable* transposition_table,
+    bool use_shallow_pruning, int num_threads) {
   GameType game_info = game.GetType();
   SPIEL_CHECK_TRUE(
       game_info.chance_mode == GameType::ChanceMode::kDeterministic ||
@@ -100,6 +171,19 @@ std::pair<std::vector<double>, Action> MaxNSearch(
   // Do not check perfect information. Used by PIMC.
   SPIEL_CHECK_EQ(game_info.dynamics, GameType::Dynamics::kSequential);
   SPIEL_CHECK_EQ(game_info.reward_model, GameType::RewardModel::kTerminal);
+  SPIEL_CHECK_GE(num_threads, 1);
+  if (use_shallow_pruning) {
+    // Shallow pruning is only sound when the sum of utilities is bounded.
+    SPIEL_CHECK_TRUE(game.UtilitySum().has_value());
+  }
+
+  MaxNContext context{std::move(value_function),
+                      use_undo,
+                      transposition_table,
+                      use_shallow_pruning,
+                      game.MinUtility(),
+                      game.MaxUtility(),
+                      game.UtilitySum().value_or(0.0)};
 
   std::unique_ptr<State> search_root;
   if (state == nullptr) {
@@ -110,10 +194,55 @@ std::pair<std::vector<double>, Action> MaxNSearch(
 
   SPIEL_CHECK_FALSE(search_root->IsChanceNode());
 
-  Action best_action = kInvalidAction;
-  std::vector<double> values = _maxn(search_root.get(), /*depth=*/depth_limit,
-                                     value_function, &best_action);
+  if (num_threads == 1) {
+    Action best_action = kInvalidAction;
+    std::vector<double> values =
+        _maxn(search_root.get(), /*depth=*/depth_limit, /*bound=*/kInfinity,
+              &best_action, &context);
+    return {values, best_action};
+  }
 
+  // Parallel root split: each worker searches a contiguous slice of the root
+  // actions on its own clone, with a worker-local transposition table (the
+  // table is not thread-safe). Shallow pruning still applies within each
+  // subtree, but not across the root actions.
+  const std::vector<Action> root_actions = search_root->LegalActions();
+  std::vector<std::vector<double>> action_values(root_actions.size());
+  const State* root = search_root.get();
+  num_threads = std::min<int>(num_threads, root_actions.size());
+  std::vector<Thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    const int start = t * static_cast<int>(root_actions.size()) / num_threads;
+    const int end =
+        (t + 1) * static_cast<int>(root_actions.size()) / num_threads;
+    threads.emplace_back([root, &root_actions, &action_values, &context,
+                          transposition_table, depth_limit, start, end]() {
+      MaxNTranspositionTable local_table;
+      MaxNContext worker_context = context;
+      worker_context.table =
+          transposition_table != nullptr ? &local_table : nullptr;
+      for (int i = start; i < end; ++i) {
+        std::unique_ptr<State> child = root->Child(root_actions[i]);
+        action_values[i] =
+            _maxn(child.get(), /*depth=*/depth_limit - 1, /*bound=*/kInfinity,
+                  /*best_action=*/nullptr, &worker_context);
+      }
+    });
+  }
+  for (Thread& thread : threads) thread.join();
+
+  const Player root_player = search_root->CurrentPlayer();
+  double value = -kInfinity;
+  std::vector<double> values;
+  Action best_action = kInvalidAction;
+  for (int i = 0; i < root_actions.size(); ++i) {
+    if (action_values[i][root_player] > value) {
+      value = action_values[i][root_player];
+      values = std::move(action_values[i]);
+      best_action = root_actions[i];
+    }
+  }
   return {values, best_action};
 }
 
@@ -15,19 +15,85 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_MAXN_H_
 #define OPEN_SPIEL_ALGORITHMS_MAXN_H_
 
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
 namespace algorithms {
 
+// A transposition table for max^n search, keyed on State::Key(). Unlike the
+// alpha-beta table (minimax.h), entries hold the full value vector, since
+// max^n propagates every player's value, and only exact (unpruned) results
+// are stored, so there is no bound classification. Replacement is
+// depth-preferred and the table is capped at `max_entries`. A table may be
+// shared across searches as long as the value function stays the same.
+class MaxNTranspositionTable {
+ public:
+  struct Entry {
+    std::vector<double> values;
+    int depth;
+    Action best_action;
+  };
+
+  explicit MaxNTranspositionTable(int64_t max_entries = int64_t{1} << 22)
+      : max_entries_(max_entries) {}
+
+  // Returns the entry for `key`, or nullptr if absent. The pointer is
+  // invalidated by the next Store().
+  const Entry* Lookup(uint64_t key) const {
+    auto it = table_.find(key);
+    return it == table_.end() ? nullptr : &it->second;
+  }
+
+  // Depth-preferred replacement: an existing entry is only overwritten by a
+  // result searched at least as deep.
+  void Store(uint64_t key, Entry entry) {
+    auto it = table_.find(key);
+    if (it != table_.end()) {
+      if (entry.depth >= it->second.depth) it->second = std::move(entry);
+    } else if (static_cast<int64_t>(table_.size()) < max_entries_) {
+      table_.emplace(key, std::move(entry));
+    }
+  }
+
+  int64_t Size() const { return table_.size(); }
+  void Clear() { table_.clear(); }
+
+ private:
+  int64_t max_entries_;
+  absl::flat_hash_map<uint64_t, Entry> table_;
+};
+
+// Runs a max^n search to the given depth from `state` (or the initial state
+// if null). When `use_undo` is true, the tree is traversed by applying and
+// undoing actions on a single state instead of cloning at every node; this
+// requires the game to implement State::UndoAction.
+//
+// Optionally:
+//  - `transposition_table` memoizes exact subtree evaluations across the
+//    search (and across searches, when an external table is passed in),
+//    keyed on State::Key(). Only share a table between searches that use the
+//    same value function.
+//  - `use_shallow_pruning` enables immediate pruning (stop once the moving
+//    player reaches MaxUtility) and shallow pruning, which cuts lines the
+//    parent player can never prefer. Shallow pruning is only sound for
+//    bounded-sum games -- UtilitySum() must have a value -- and, when
+//    searching depth-limited, for value functions that respect
+//    MinUtility()/MaxUtility().
+//  - `num_threads` > 1 splits the root actions over that many worker
+//    threads, each searching its slice on its own clone of the root with a
+//    worker-local transposition table (the table is not thread-safe).
 std::pair<std::vector<double>, Action> MaxNSearch(
     const Game& game, const State* state,
     std::function<double(const State&, Player player)> value_function,
-    int depth_limit);
+    int depth_limit, bool use_undo = false,
+    MaxNTranspositionTable* transposition_table = nullptr,
+    bool use_shallow_pruning = false, int num_threads = 1);
 
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -0,0 +1,90 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/maxn.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void MaxNSearchTest_TicTacToe() {
+  // Two-player zero-sum: max^n coincides with minimax, and perfect play
+  // draws.
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::pair<std::vector<double>, Action> values_and_action =
+      MaxNSearch(*game, nullptr, {}, /*depth_limit=*/10);
+  SPIEL_CHECK_EQ(values_and_action.first[0], 0.0);
+  SPIEL_CHECK_EQ(values_and_action.first[1], 0.0);
+}
+
+// Table hits, pruning cutoffs and the parallel root split must not change
+// the value the search returns for the player to move.
+void MaxNSearchTest_ConfigurationsAgree(const std::string& game_name,
+                                        int depth_limit) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  std::unique_ptr<State> root = game->NewInitialState();
+  while (root->IsChanceNode()) root->ApplyAction(root->LegalActions()[0]);
+  const Player root_player = root->CurrentPlayer();
+
+  const double baseline =
+      MaxNSearch(*game, root.get(), {}, depth_limit).first[root_player];
+
+  MaxNTranspositionTable table;
+  const double with_table =
+      MaxNSearch(*game, root.get(), {}, depth_limit, /*use_undo=*/false,
+                 &table)
+          .first[root_player];
+  SPIEL_CHECK_EQ(baseline, with_table);
+  SPIEL_CHECK_GT(table.Size(), 0);
+
+  // A second search through the warm table must agree as well.
+  const double with_warm_table =
+      MaxNSearch(*game, root.get(), {}, depth_limit, /*use_undo=*/false,
+                 &table)
+          .first[root_player];
+  SPIEL_CHECK_EQ(baseline, with_warm_table);
+
+  const double with_pruning =
+      MaxNSearch(*game, root.get(), {}, depth_limit, /*use_undo=*/false,
+                 /*transposition_table=*/nullptr, /*use_shallow_pruning=*/true)
+          .first[root_player];
+  SPIEL_CHECK_EQ(baseline, with_pruning);
+
+  const double parallel =
+      MaxNSearch(*game, root.get(), {}, depth_limit, /*use_undo=*/false,
+                 /*transposition_table=*/nullptr, /*use_shallow_pruning=*/false,
+                 /*num_threads=*/3)
+          .first[root_player];
+  SPIEL_CHECK_EQ(baseline, parallel);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+namespace alg = open_spiel::algorithms;
+int main() {
+  alg::MaxNSearchTest_TicTacToe();
+  alg::MaxNSearchTest_ConfigurationsAgree("tic_tac_toe", /*depth_limit=*/10);
+  // A multiplayer (3-player) game with chance nodes.
+  alg::MaxNSearchTest_ConfigurationsAgree("kuhn_poker(players=3)",
+                                          /*depth_limit=*/20);
+}
@@ -15,9 +15,11 @@
 #include "open_spiel/algorithms/mcts.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <vector>
 
@@ -30,6 +32,8 @@
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/profiler.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -41,17 +45,24 @@ int MemoryUsedMb(int nodes) {
 }
 
 std::vector<double> RandomRolloutEvaluator::Evaluate(const State& state) {
+  // Draw a seed from the shared generator and run the rollouts on a local
+  // one, so that concurrent Evaluate calls do not race.
+  std::mt19937 rng;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rng.seed(rng_());
+  }
   std::vector<double> result;
   for (int i = 0; i < n_rollouts_; ++i) {
     std::unique_ptr<State> working_state = state.Clone();
     while (!working_state->IsTerminal()) {
       if (working_state->IsChanceNode()) {
         ActionsAndProbs outcomes = working_state->ChanceOutcomes();
-        working_state->ApplyAction(SampleAction(outcomes, rng_).first);
+        working_state->ApplyAction(SampleAction(outcomes, rng).first);
       } else {
         std::vector<Action> actions = working_state->LegalActions();
         working_state->ApplyAction(
-            actions[absl::Uniform(rng_, 0u, actions.size())]);
+            actions[absl::Uniform(rng, 0u, actions.size())]);
       }
     }
 
@@ -71,6 +82,28 @@ std::vector<double> RandomRolloutEvaluator::Evaluate(const State& state) {
   return result;
 }
 
+std::vector<std::vector<double>> RandomRolloutEvaluator::EvaluateBatch(
+    absl::Span<const State* const> states) {
+  std::vector<std::vector<double>> values(states.size());
+  if (states.size() <= 1) {
+    for (int i = 0; i < states.size(); ++i) {
+      values[i] = Evaluate(*states[i]);
+    }
+    return values;
+  }
+  // Evaluate is thread-safe, so run each state's rollouts on its own thread.
+  std::vector<Thread> workers;
+  workers.reserve(states.size());
+  for (int i = 0; i < states.size(); ++i) {
+    workers.emplace_back(
+        [this, i, &states, &values]() { values[i] = Evaluate(*states[i]); });
+  }
+  for (Thread& worker : workers) {
+    worker.join();
+  }
+  return values;
+}
+
 ActionsAndProbs RandomRolloutEvaluator::Prior(const State& state) {
   // Returns equal probability for all actions.
   if (state.IsChanceNode()) {
@@ -229,12 +262,15 @@ MCTSBot::MCTSBot(const Game& game, std::shared_ptr<Evaluator> evaluator,
 }
 
 Action MCTSBot::Step(const State& state) {
+  SPIEL_PROF_SCOPE("MCTSBot::Step");
   absl::Time start = absl::Now();
   std::unique_ptr<SearchNode> root = MCTSearch(state);
 
   if (max_simulations_ <= 1) {
     // sample from prior
-    return root->SampleFromPrior(state, evaluator_.get(), &rng_);
+    Action action = root->SampleFromPrior(state, evaluator_.get(), &rng_);
+    RecycleTree(root.get());
+    return action;
   } else {
     // return best action
     const SearchNode& best = root->BestChild();
@@ -259,7 +295,20 @@ Action MCTSBot::Step(const State& state) {
         std::cerr << best.ChildrenStr(*chosen_state) << std::endl;
       }
     }
-    return best.action;
+    Action action = best.action;
+    if (tree_reuse_) {
+      // Keep the tree for the next Step. The tree is rooted at `state`, i.e.
+      // before the chosen action, so the retained history must not include
+      // the action: MaybeReuseSubtree descends through it like any other
+      // action observed since this call.
+      retained_history_ = state.History();
+      retained_root_ = std::move(root);
+    } else {
+      // The tree is owned by this Step call; recycle its children buffers
+      // for the next search before it is destroyed.
+      RecycleTree(root.get());
+    }
+    return action;
   }
 }
 
@@ -268,6 +317,23 @@ std::pair<ActionsAndProbs, Action> MCTSBot::StepWithPolicy(const State& state) {
   return {{{action, 1.}}, action};
 }
 
+void MCTSBot::StepInto(const State& state, BotResponse* response) {
+  response->action = Step(state);
+  response->policy.clear();
+  response->policy.emplace_back(response->action, 1.);
+}
+
+void MCTSBot::Ponder(const State& state) {
+  SPIEL_CHECK_TRUE(tree_reuse_);
+  std::unique_ptr<SearchNode> root = MCTSearch(state);
+  // Retain the whole tree rooted at `state` itself: MCTSearch already
+  // continues a retained tree whose history matches, so repeated Ponder
+  // calls on the same state keep growing one tree, and the next Step
+  // re-roots into whichever subtree the game actually reached.
+  retained_history_ = state.History();
+  retained_root_ = std::move(root);
+}
+
 std::unique_ptr<State> MCTSBot::ApplyTreePolicy(
     SearchNode* root, const State& state,
     std::vector<SearchNode*>* visit_path) {
@@ -291,6 +357,11 @@ std::unique_ptr<State> MCTSBot::ApplyTreePolicy(
       // Reduce bias from move generation order.
       std::shuffle(legal_actions.begin(), legal_actions.end(), rng_);
       Player player = working_state->CurrentPlayer();
+      if (!child_buffer_pool_.empty()) {
+        // Reuse a recycled buffer (already cleared) to avoid an allocation.
+        current_node->children = std::move(child_buffer_pool_.back());
+        child_buffer_pool_.pop_back();
+      }
       current_node->children.reserve(legal_actions.size());
       for (auto [action, prior] : legal_actions) {
         current_node->children.emplace_back(action, player, prior);
@@ -348,11 +419,334 @@ std::unique_ptr<State> MCTSBot::ApplyTreePolicy(
   return working_state;
 }
 
+void MCTSBot::BackupValues(std::vector<SearchNode*>* visit_path,
+                           const std::vector<double>& returns, bool solved) {
+  while (!visit_path->empty()) {
+    int decision_node_idx = visit_path->size() - 1;
+    SearchNode* node = (*visit_path)[decision_node_idx];
+
+    // If it's a chance node, find the parent player id.
+    while ((*visit_path)[decision_node_idx]->player == kChancePlayerId) {
+      decision_node_idx--;
+    }
+
+    node->total_reward += returns[(*visit_path)[decision_node_idx]->player];
+    node->explore_count += 1;
+    visit_path->pop_back();
+
+    // Back up solved results as well.
+    if (solved && !node->children.empty()) {
+      Player player = node->children[0].player;
+      if (player == kChancePlayerId) {
+        // Only back up chance nodes if all have the same outcome.
+        // An alternative would be to back up the weighted average of
+        // outcomes if all children are solved, but that is less clear.
+        const std::vector<double>& outcome = node->children[0].outcome;
+        if (!outcome.empty() &&
+            std::all_of(node->children.begin() + 1, node->children.end(),
+                        [&outcome](const SearchNode& c) {
+                          return c.outcome == outcome;
+                        })) {
+          node->outcome = outcome;
+        } else {
+          solved = false;
+        }
+      } else {
+        // If any have max utility (won?), or all children are solved,
+        // choose the one best for the player choosing.
+        const SearchNode* best = nullptr;
+        bool all_solved = true;
+        for (const SearchNode& child : node->children) {
+          if (child.outcome.empty()) {
+            all_solved = false;
+          } else if (best == nullptr ||
+                     child.outcome[player] > best->outcome[player]) {
+            best = &child;
+          }
+        }
+        if (best != nullptr &&
+            (all_solved || best->outcome[player] == max_utility_)) {
+          node->outcome = best->outcome;
+        } else {
+          solved = false;
+        }
+      }
+    }
+  }
+}
+
+void MCTSBot::ParallelMCTSearch(SearchNode* root, const State& state) {
+  std::mutex tree_mutex;
+  std::atomic<int> num_started(0);
+  std::atomic<bool> stop(false);
+  std::vector<Thread> workers;
+  workers.reserve(num_search_threads_);
+  for (int t = 0; t < num_search_threads_; ++t) {
+    workers.emplace_back([this, root, &state, &tree_mutex, &num_started,
+                          &stop]() {
+      std::vector<SearchNode*> visit_path;
+      std::vector<double> returns;
+      visit_path.reserve(64);
+      while (!stop.load() && num_started.fetch_add(1) < max_simulations_) {
+        visit_path.clear();
+        returns.clear();
+
+        std::unique_ptr<State> working_state;
+        {
+          std::lock_guard<std::mutex> lock(tree_mutex);
+          working_state = ApplyTreePolicy(root, state, &visit_path);
+          // Apply a virtual loss along the path so concurrent workers are
+          // discouraged from descending the same line while this leaf is
+          // being evaluated.
+          for (SearchNode* node : visit_path) {
+            node->explore_count += 1;
+            node->total_reward -= max_utility_;
+          }
+        }
+
+        // Leaf evaluation runs without the lock; this is where the time
+        // goes, so it is the part that parallelizes.
+        bool solved = false;
+        const bool terminal = working_state->IsTerminal();
+        if (terminal) {
+          returns = working_state->Returns();
+          solved = solve_;
+        } else {
+          returns = evaluator_->Evaluate(*working_state);
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(tree_mutex);
+          // Replace the virtual loss with the real update.
+          for (SearchNode* node : visit_path) {
+            node->explore_count -= 1;
+            node->total_reward += max_utility_;
+          }
+          if (terminal) {
+            visit_path.back()->outcome = returns;
+          }
+          BackupValues(&visit_path, returns, solved);
+          if (!root->outcome.empty() ||  // Full game tree is solved.
+              root->children.size() == 1) {
+            stop.store(true);
+          }
+        }
+      }
+    });
+  }
+  for (Thread& worker : workers) {
+    worker.join();
+  }
+}
+
+void MCTSBot::BatchedMCTSearch(SearchNode* root, const State& state) {
+  struct PendingLeaf {
+    std::vector<SearchNode*> visit_path;
+    std::unique_ptr<State> working_state;
+    bool terminal = false;
+    std::vector<double> returns;
+  };
+  std::vector<PendingLeaf> pending;
+  std::vector<const State*> to_evaluate;
+  int simulations_done = 0;
+  while (simulations_done < max_simulations_) {
+    const int batch_size =
+        std::min(leaf_batch_size_, max_simulations_ - simulations_done);
+    pending.clear();
+    pending.reserve(batch_size);
+    to_evaluate.clear();
+    // Collect the batch of leaves, applying a virtual loss along each visit
+    // path so the descents spread over different lines.
+    for (int b = 0; b < batch_size; ++b) {
+      PendingLeaf leaf;
+      leaf.working_state = ApplyTreePolicy(root, state, &leaf.visit_path);
+      for (SearchNode* node : leaf.visit_path) {
+        node->explore_count += 1;
+        node->total_reward -= max_utility_;
+      }
+      leaf.terminal = leaf.working_state->IsTerminal();
+      if (leaf.terminal) {
+        leaf.returns = leaf.working_state->Returns();
+      } else {
+        to_evaluate.push_back(leaf.working_state.get());
+      }
+      pending.push_back(std::move(leaf));
+    }
+
+    // Evaluate all non-terminal leaves with a single call.
+    std::vector<std::vector<double>> values;
+    if (!to_evaluate.empty()) {
+      values = evaluator_->EvaluateBatch(
+          absl::Span<const State* const>(to_evaluate));
+      SPIEL_CHECK_EQ(values.size(), to_evaluate.size());
+    }
+
+    // Replace the virtual losses with the real updates.
+    int value_idx = 0;
+    for (PendingLeaf& leaf : pending) {
+      for (SearchNode* node : leaf.visit_path) {
+        node->explore_count -= 1;
+        node->total_reward += max_utility_;
+      }
+      bool solved = false;
+      if (leaf.terminal) {
+        leaf.visit_path.back()->outcome = leaf.returns;
+        solved = solve_;
+      } else {
+        leaf.returns = std::move(values[value_idx++]);
+      }
+      BackupValues(&leaf.visit_path, leaf.returns, solved);
+      ++simulations_done;
+    }
+
+    if (!root->outcome.empty() ||  // Full game tree is solved.
+        root->children.size() == 1) {
+      return;
+    }
+    if (max_nodes_ > 1 && nodes_ >= max_nodes_) {
+      // No descents are outstanding between batches, so garbage collection
+      // is safe here, as in the single-simulation search.
+      GarbageCollect(root);
+      gc_limit_ *= (nodes_ > max_nodes_ / 2 ? 1.25 : 0.9);
+      gc_limit_ = std::max(MIN_GC_LIMIT, gc_limit_);
+    }
+  }
+}
+
+std::unique_ptr<SearchNode> MCTSBot::MaybeReuseSubtree(const State& state) {
+  if (!tree_reuse_ || retained_root_ == nullptr) {
+    return nullptr;
+  }
+  std::unique_ptr<SearchNode> retained = std::move(retained_root_);
+  const std::vector<Action> history = state.History();
+  if (history.size() < retained_history_.size() ||
+      !std::equal(retained_history_.begin(), retained_history_.end(),
+                  history.begin())) {
+    RecycleTree(retained.get());
+    return nullptr;
+  }
+  // Descend along the actions observed since the last Step.
+  SearchNode* node = retained.get();
+  for (size_t i = retained_history_.size(); i < history.size(); ++i) {
+    SearchNode* next = nullptr;
+    for (SearchNode& child : node->children) {
+      if (child.action == history[i]) {
+        next = &child;
+        break;
+      }
+    }
+    if (next == nullptr || next->explore_count == 0) {
+      RecycleTree(retained.get());
+      return nullptr;
+    }
+    node = next;
+  }
+  // Transplant the matching subtree into a fresh root and recycle the rest.
+  auto root = std::make_unique<SearchNode>(kInvalidAction,
+                                           state.CurrentPlayer(), 1);
+  root->explore_count = node->explore_count;
+  root->total_reward = node->total_reward;
+  root->outcome = node->outcome;
+  root->children = std::move(node->children);
+  RecycleTree(retained.get());
+  return root;
+}
+
+void MCTSBot::StartSearch(const State& state) {
+  SPIEL_CHECK_TRUE(incremental_ == nullptr);
+  nodes_ = 1;
+  gc_limit_ = MIN_GC_LIMIT;
+  incremental_ = std::make_unique<IncrementalSearch>();
+  incremental_->root = MaybeReuseSubtree(state);
+  if (incremental_->root == nullptr) {
+    incremental_->root = std::make_unique<SearchNode>(kInvalidAction,
+                                                      state.CurrentPlayer(), 1);
+  }
+  incremental_->root_state = state.Clone();
+}
+
+const State* MCTSBot::CollectLeaf() {
+  SPIEL_CHECK_TRUE(incremental_ != nullptr);
+  IncrementalSearch& search = *incremental_;
+  // In-flight simulations count against the budget so a caller keeping many
+  // suspended does not overshoot max_simulations_.
+  while (!search.done &&
+         search.simulations_done + static_cast<int>(search.pending.size()) <
+             max_simulations_) {
+    std::vector<SearchNode*> visit_path;
+    std::unique_ptr<State> working_state =
+        ApplyTreePolicy(search.root.get(), *search.root_state, &visit_path);
+    if (working_state->IsTerminal()) {
+      // Terminal leaves need no evaluation; back them up immediately and
+      // keep going until a leaf needs the caller.
+      std::vector<double> returns = working_state->Returns();
+      visit_path.back()->outcome = returns;
+      BackupValues(&visit_path, returns, solve_);
+      ++search.simulations_done;
+      if (!search.root->outcome.empty() ||  // Full game tree is solved.
+          search.root->children.size() == 1) {
+        search.done = true;
+      }
+      continue;
+    }
+    // Park this simulation under a virtual loss until its value arrives.
+    for (SearchNode* node : visit_path) {
+      node->explore_count += 1;
+      node->total_reward -= max_utility_;
+    }
+    IncrementalSearch::PendingSimulation pending;
+    pending.visit_path = std::move(visit_path);
+    pending.state = std::move(working_state);
+    search.pending.push_back(std::move(pending));
+    return search.pending.back().state.get();
+  }
+  return nullptr;
+}
+
+void MCTSBot::ProvideLeafValue(const std::vector<double>& values) {
+  SPIEL_CHECK_TRUE(incremental_ != nullptr);
+  SPIEL_CHECK_FALSE(incremental_->pending.empty());
+  IncrementalSearch& search = *incremental_;
+  IncrementalSearch::PendingSimulation pending =
+      std::move(search.pending.front());
+  search.pending.pop_front();
+  for (SearchNode* node : pending.visit_path) {
+    node->explore_count -= 1;
+    node->total_reward += max_utility_;
+  }
+  BackupValues(&pending.visit_path, values, /*solved=*/false);
+  ++search.simulations_done;
+  if (!search.root->outcome.empty() ||  // Full game tree is solved.
+      search.root->children.size() == 1) {
+    search.done = true;
+  }
+}
+
+std::unique_ptr<SearchNode> MCTSBot::FinishSearch() {
+  SPIEL_CHECK_TRUE(incremental_ != nullptr);
+  SPIEL_CHECK_TRUE(incremental_->pending.empty());
+  std::unique_ptr<SearchNode> root = std::move(incremental_->root);
+  incremental_.reset();
+  return root;
+}
+
 std::unique_ptr<SearchNode> MCTSBot::MCTSearch(const State& state) {
+  SPIEL_PROF_SCOPE("MCTSBot::MCTSearch");
   nodes_ = 1;
   gc_limit_ = MIN_GC_LIMIT;
-  auto root = std::make_unique<SearchNode>(kInvalidAction,
-                                           state.CurrentPlayer(), 1);
+  std::unique_ptr<SearchNode> root = MaybeReuseSubtree(state);
+  if (root == nullptr) {
+    root = std::make_unique<SearchNode>(kInvalidAction, state.CurrentPlayer(),
+                                        1);
+  }
+  if (num_search_threads_ > 1) {
+    ParallelMCTSearch(root.get(), state);
+    return root;
+  }
+  if (leaf_batch_size_ > 1) {
+    BatchedMCTSearch(root.get(), state);
+    return root;
+  }
   std::vector<SearchNode*> visit_path;
   std::vector<double> returns;
   visit_path.reserve(64);
@@ -374,58 +768,7 @@ std::unique_ptr<SearchNode> MCTSBot::MCTSearch(const State& state) {
     }
 
     // Propagate values back.
-    while (!visit_path.empty()) {
-      int decision_node_idx = visit_path.size() - 1;
-      SearchNode* node = visit_path[decision_node_idx];
-
-      // If it's a chance node, find the parent player id.
-      while (visit_path[decision_node_idx]->player == kChancePlayerId) {
-        decision_node_idx--;
-      }
-
-      node->total_reward += returns[visit_path[decision_node_idx]->player];
-      node->explore_count += 1;
-      visit_path.pop_back();
-
-      // Back up solved results as well.
-      if (solved && !node->children.empty()) {
-        Player player = node->children[0].player;
-        if (player == kChancePlayerId) {
-          // Only back up chance nodes if all have the same outcome.
-          // An alternative would be to back up the weighted average of
-          // outcomes if all children are solved, but that is less clear.
-          const std::vector<double>& outcome = node->children[0].outcome;
-          if (!outcome.empty() &&
-              std::all_of(node->children.begin() + 1, node->children.end(),
-                          [&outcome](const SearchNode& c) {
-                            return c.outcome == outcome;
-                          })) {
-            node->outcome = outcome;
-          } else {
-            solved = false;
-          }
-        } else {
-          // If any have max utility (won?), or all children are solved,
-          // choose the one best for the player choosing.
-          const SearchNode* best = nullptr;
-          bool all_solved = true;
-          for (const SearchNode& child : node->children) {
-            if (child.outcome.empty()) {
-              all_solved = false;
-            } else if (best == nullptr ||
-                       child.outcome[player] > best->outcome[player]) {
-              best = &child;
-            }
-          }
-          if (best != nullptr &&
-              (all_solved || best->outcome[player] == max_utility_)) {
-            node->outcome = best->outcome;
-          } else {
-            solved = false;
-          }
-        }
-      }
-    }
+    BackupValues(&visit_path, returns, solved);
 
     if (!root->outcome.empty() ||  // Full game tree is solved.
         root->children.size() == 1) {
@@ -459,6 +802,18 @@ std::unique_ptr<SearchNode> MCTSBot::MCTSearch(const State& state) {
   return root;
 }
 
+void MCTSBot::RecycleTree(SearchNode* node) {
+  for (SearchNode& child : node->children) {
+    RecycleTree(&child);
+  }
+  if (node->children.capacity() > 0) {
+    // The grandchildren buffers have already been moved out above, so
+    // clearing only destroys empty nodes.
+    node->children.clear();
+    child_buffer_pool_.push_back(std::move(node->children));
+  }
+}
+
 void MCTSBot::GarbageCollect(SearchNode* node) {
   if (node->children.empty()) {
     return;
@@ -17,12 +17,15 @@
 
 #include <stdint.h>
 
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
 
@@ -87,6 +90,21 @@ class Evaluator {
   // Return a value of this state for each player.
   virtual std::vector<double> Evaluate(const State& state) = 0;
 
+  // Return values for a batch of states, one vector per state. The default
+  // implementation evaluates the states one at a time; evaluators with
+  // per-call overhead (e.g. neural network evaluators, or rollouts that can
+  // run concurrently) should override this to handle the whole batch at
+  // once.
+  virtual std::vector<std::vector<double>> EvaluateBatch(
+      absl::Span<const State* const> states) {
+    std::vector<std::vector<double>> values;
+    values.reserve(states.size());
+    for (const State* state : states) {
+      values.push_back(Evaluate(*state));
+    }
+    return values;
+  }
+
   // Return a policy: the probability of the current player playing each action.
   virtual ActionsAndProbs Prior(const State& state) = 0;
 };
@@ -94,6 +112,8 @@ class Evaluator {
 // A simple evaluator that returns the average outcome of playing random actions
 // from the given state until the end of the game.
 // n_rollouts is the number of random outcomes to be considered.
+// Evaluate is safe to call concurrently: each call draws an independent seed
+// from the shared generator and runs its rollouts on a local one.
 class RandomRolloutEvaluator : public Evaluator {
  public:
   explicit RandomRolloutEvaluator(int n_rollouts, int seed)
@@ -102,12 +122,17 @@ class RandomRolloutEvaluator : public Evaluator {
   // Runs random games, returning the average returns.
   std::vector<double> Evaluate(const State& state) override;
 
+  // Runs the rollouts for each state on its own thread.
+  std::vector<std::vector<double>> EvaluateBatch(
+      absl::Span<const State* const> states) override;
+
   // Returns equal probability for each action.
   ActionsAndProbs Prior(const State& state) override;
 
  private:
   int n_rollouts_;
   std::mt19937 rng_;
+  std::mutex mutex_;  // Guards rng_.
 };
 
 // A node in the search tree for MCTS
@@ -169,8 +194,17 @@ class MCTSBot : public Bot {
       bool dont_return_chance_node = false);
   ~MCTSBot() = default;
 
-  void Restart() override {}
-  void RestartAt(const State& state) override {}
+  void Restart() override {
+    retained_root_.reset();
+    retained_history_.clear();
+    child_buffer_pool_.clear();
+    incremental_.reset();
+  }
+  void RestartAt(const State& state) override {
+    retained_root_.reset();
+    retained_history_.clear();
+    incremental_.reset();
+  }
   // Run MCTS for one step, choosing the action, and printing some information.
   Action Step(const State& state) override;
 
@@ -180,9 +214,86 @@ class MCTSBot : public Bot {
   std::pair<ActionsAndProbs, Action> StepWithPolicy(
       const State& state) override;
 
+  // Implements StepInto: equivalent to Step, writing the single-action
+  // policy into the reusable response buffer.
+  void StepInto(const State& state, BotResponse* response) override;
+
   // Run MCTS on a given state, and return the resulting search tree.
   std::unique_ptr<SearchNode> MCTSearch(const State& state);
 
+  // Runs one search budget rooted at `state` and retains the tree, without
+  // choosing an action. Intended for thinking on the opponent's time: a
+  // front-end can call Ponder repeatedly while waiting for the opponent's
+  // move, growing one tree across calls, and the next Step re-roots into the
+  // subtree matching whatever actions were actually played. Requires tree
+  // reuse to be enabled.
+  void Ponder(const State& state);
+
+  // Sets the simulation budget used by subsequent searches. Useful for time
+  // controls, where a front-end converts the remaining clock time into a
+  // simulation count using a measured simulation rate.
+  void SetMaxSimulations(int max_simulations) {
+    SPIEL_CHECK_GE(max_simulations, 1);
+    max_simulations_ = max_simulations;
+  }
+
+  // Incremental search interface, decoupling leaf evaluation from the tree
+  // walk so one thread can interleave many independent searches (e.g. one
+  // per concurrent self-play game) and evaluate their leaves together:
+  //   bot->StartSearch(state);
+  //   while (const State* leaf = bot->CollectLeaf()) {
+  //     // ... gather leaves from other bots' searches, evaluate as a batch.
+  //     bot->ProvideLeafValue(values_for_leaf);
+  //   }
+  //   std::unique_ptr<SearchNode> root = bot->FinishSearch();
+  // Terminal leaves are backed up internally, so CollectLeaf only returns
+  // states that need evaluation, and nullptr once the simulation budget is
+  // spent (in-flight simulations count against it) or the root is solved.
+  // A search is effectively a set of suspended simulations: CollectLeaf may
+  // be called several times in a row to keep multiple simulations in flight,
+  // each parked under a virtual loss, and ProvideLeafValue answers the
+  // oldest outstanding one. Deeper in-flight windows fill evaluator batches
+  // from fewer concurrent searches at the cost of more duplicated descents.
+  // All outstanding leaves must be answered before FinishSearch.
+  void StartSearch(const State& state);
+  const State* CollectLeaf();
+  void ProvideLeafValue(const std::vector<double>& values);
+  std::unique_ptr<SearchNode> FinishSearch();
+
+  // Sets the number of worker threads used by MCTSearch. With more than one
+  // thread, simulations run concurrently over the shared tree: descent,
+  // expansion and value backup are serialized by a tree mutex, and a virtual
+  // loss is applied to the visit path in between so concurrent workers spread
+  // over different lines, while leaf evaluation (the expensive part) runs in
+  // parallel. The evaluator must be safe to call concurrently (as
+  // RandomRolloutEvaluator is). Garbage collection under max_memory_mb is
+  // only performed in single-threaded search.
+  void SetNumSearchThreads(int num_search_threads) {
+    SPIEL_CHECK_GE(num_search_threads, 1);
+    num_search_threads_ = num_search_threads;
+  }
+
+  // Enables tree reuse across Step calls: the search tree is kept after each
+  // Step, and the next Step re-roots it into the subtree matching the actions
+  // observed since (own move, opponent replies, chance outcomes), so the
+  // simulations already spent on that subtree are kept. Falls back to a fresh
+  // tree whenever the history does not match (e.g. after Restart/RestartAt,
+  // or when the relevant subtree was never expanded). Only effective for
+  // Step-driven play; trees returned by MCTSearch directly are never
+  // retained.
+  void SetTreeReuse(bool tree_reuse) { tree_reuse_ = tree_reuse; }
+
+  // Sets the leaf evaluation batch size. With a batch size greater than one,
+  // the (single-threaded) search collects that many leaves per step --
+  // descending with a virtual loss so the descents spread over different
+  // lines -- and evaluates them with a single Evaluator::EvaluateBatch call,
+  // amortizing per-call evaluation cost. Ignored when the parallel search
+  // mode (SetNumSearchThreads) is active.
+  void SetLeafBatchSize(int leaf_batch_size) {
+    SPIEL_CHECK_GE(leaf_batch_size, 1);
+    leaf_batch_size_ = leaf_batch_size;
+  }
+
  private:
   // Applies the UCT policy to play the game until reaching a leaf node.
   //
@@ -200,10 +311,35 @@ class MCTSBot : public Bot {
   std::unique_ptr<State> ApplyTreePolicy(SearchNode* root, const State& state,
                                          std::vector<SearchNode*>* visit_path);
 
+  // Runs the simulations of one search on num_search_threads_ workers.
+  void ParallelMCTSearch(SearchNode* root, const State& state);
+
+  // Runs the simulations of one search with leaves collected and evaluated
+  // in batches of leaf_batch_size_.
+  void BatchedMCTSearch(SearchNode* root, const State& state);
+
+  // If tree reuse is on and the retained tree has an expanded subtree
+  // matching the actions taken since the last Step, returns that subtree as
+  // a new root (recycling the rest of the tree); otherwise returns null.
+  std::unique_ptr<SearchNode> MaybeReuseSubtree(const State& state);
+
+  // Backs up the returns (and solved outcomes) along the visit path.
+  // The path is consumed.
+  void BackupValues(std::vector<SearchNode*>* visit_path,
+                    const std::vector<double>& returns, bool solved);
+
   void GarbageCollect(SearchNode* node);
 
+  // Moves every node's children buffer of a finished search tree into
+  // child_buffer_pool_ so the heap allocations can be reused by the next
+  // search instead of being returned to the allocator.
+  void RecycleTree(SearchNode* node);
+
   double uct_c_;
   int max_simulations_;
+  int num_search_threads_ = 1;
+  int leaf_batch_size_ = 1;
+  bool tree_reuse_ = false;
   int max_nodes_;  // Max nodes allowed in the tree
   int nodes_;  // Nodes used in the tree.
   int gc_limit_;
@@ -216,6 +352,40 @@ class MCTSBot : public Bot {
   std::mt19937 rng_;
   const ChildSelectionPolicy child_selection_policy_;
   std::shared_ptr<Evaluator> evaluator_;
+
+  // Recycled children buffers, harvested from the previous search tree at the
+  // end of Step. Node expansion takes a buffer from here (keeping its heap
+  // allocation) instead of allocating a fresh vector, which removes almost
+  // all allocator traffic from steady-state search. Sibling groups stay
+  // contiguous as before; Restart() releases the pooled memory.
+  std::vector<std::vector<SearchNode>> child_buffer_pool_;
+
+  // The tree retained by the last Step when tree reuse is on, together with
+  // the history (including the chosen action) of the state it was rooted at.
+  std::unique_ptr<SearchNode> retained_root_;
+  std::vector<Action> retained_history_;
+
+  // State of a search in progress via the incremental interface
+  // (StartSearch / CollectLeaf / ProvideLeafValue / FinishSearch).
+  struct IncrementalSearch {
+    // A simulation suspended at its leaf, awaiting a value. Its visit path
+    // carries a virtual loss until it is answered. Node pointers stay valid
+    // while suspended: children buffers are filled once at expansion and
+    // never resized, and garbage collection does not run mid-search.
+    struct PendingSimulation {
+      std::vector<SearchNode*> visit_path;
+      std::unique_ptr<State> state;
+    };
+
+    std::unique_ptr<SearchNode> root;
+    std::unique_ptr<State> root_state;
+    // Suspended simulations, oldest first; ProvideLeafValue resumes the
+    // front one.
+    std::deque<PendingSimulation> pending;
+    int simulations_done = 0;
+    bool done = false;
+  };
+  std::unique_ptr<IncrementalSearch> incremental_;
 };
 
 // Returns a vector of noise sampled from a dirichlet distribution. See:
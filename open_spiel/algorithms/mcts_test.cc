@@ -152,6 +152,120 @@ void MCTSTest_SolveWin() {
   SPIEL_CHECK_EQ(state->ActionToString(best.player, best.action), "x(0,2)");
 }
 
+void MCTSTest_CanPlayTicTacToe_Parallel() {
+  auto game = LoadGame("tic_tac_toe");
+  int max_simulations = 100;
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  auto bot0 = std::make_unique<algorithms::MCTSBot>(
+      *game, evaluator, UCT_C, max_simulations,
+      /*max_memory_mb=*/5, /*solve=*/true, /*seed=*/42, /*verbose=*/false);
+  auto bot1 = std::make_unique<algorithms::MCTSBot>(
+      *game, evaluator, UCT_C, max_simulations,
+      /*max_memory_mb=*/5, /*solve=*/true, /*seed=*/43, /*verbose=*/false);
+  bot0->SetNumSearchThreads(4);
+  bot1->SetNumSearchThreads(4);
+  auto results =
+      EvaluateBots(game->NewInitialState().get(), {bot0.get(), bot1.get()}, 42);
+  SPIEL_CHECK_EQ(results[0] + results[1], 0);
+}
+
+void MCTSTest_CanPlayTicTacToe_TreeReuse() {
+  auto game = LoadGame("tic_tac_toe");
+  int max_simulations = 100;
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  auto bot0 = std::make_unique<algorithms::MCTSBot>(
+      *game, evaluator, UCT_C, max_simulations,
+      /*max_memory_mb=*/5, /*solve=*/true, /*seed=*/42, /*verbose=*/false);
+  auto bot1 = std::make_unique<algorithms::MCTSBot>(
+      *game, evaluator, UCT_C, max_simulations,
+      /*max_memory_mb=*/5, /*solve=*/true, /*seed=*/43, /*verbose=*/false);
+  bot0->SetTreeReuse(true);
+  bot1->SetTreeReuse(true);
+  for (int i = 0; i < 2; ++i) {  // The second game exercises Restart.
+    bot0->Restart();
+    bot1->Restart();
+    auto results = EvaluateBots(game->NewInitialState().get(),
+                                {bot0.get(), bot1.get()}, 42);
+    SPIEL_CHECK_EQ(results[0] + results[1], 0);
+  }
+}
+
+void MCTSTest_CanPlayTicTacToe_BatchedLeaves() {
+  auto game = LoadGame("tic_tac_toe");
+  int max_simulations = 100;
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  auto bot0 = std::make_unique<algorithms::MCTSBot>(
+      *game, evaluator, UCT_C, max_simulations,
+      /*max_memory_mb=*/5, /*solve=*/true, /*seed=*/42, /*verbose=*/false);
+  auto bot1 = std::make_unique<algorithms::MCTSBot>(
+      *game, evaluator, UCT_C, max_simulations,
+      /*max_memory_mb=*/5, /*solve=*/true, /*seed=*/43, /*verbose=*/false);
+  bot0->SetLeafBatchSize(8);
+  bot1->SetLeafBatchSize(8);
+  auto results =
+      EvaluateBots(game->NewInitialState().get(), {bot0.get(), bot1.get()}, 42);
+  SPIEL_CHECK_EQ(results[0] + results[1], 0);
+}
+
+void MCTSTest_IncrementalSearch() {
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  algorithms::MCTSBot bot(*game, evaluator, UCT_C,
+                          /*max_simulations=*/100,
+                          /*max_memory_mb=*/5,
+                          /*solve=*/true,
+                          /*seed=*/42,
+                          /*verbose=*/false);
+  // Drive every move's search through the incremental interface, playing
+  // the evaluator's role between CollectLeaf and ProvideLeafValue.
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (!state->IsTerminal()) {
+    bot.StartSearch(*state);
+    while (const State* leaf = bot.CollectLeaf()) {
+      bot.ProvideLeafValue(evaluator->Evaluate(*leaf));
+    }
+    std::unique_ptr<algorithms::SearchNode> root = bot.FinishSearch();
+    state->ApplyAction(root->BestChild().action);
+  }
+  SPIEL_CHECK_EQ(state->Returns()[0] + state->Returns()[1], 0);
+}
+
+void MCTSTest_IncrementalSearch_MultipleInflight() {
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  constexpr int max_simulations = 100;
+  algorithms::MCTSBot bot(*game, evaluator, UCT_C, max_simulations,
+                          /*max_memory_mb=*/5,
+                          /*solve=*/true,
+                          /*seed=*/42,
+                          /*verbose=*/false);
+  // Keep up to 8 simulations suspended at once, answering them oldest
+  // first, as a multiplexing scheduler would.
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (!state->IsTerminal()) {
+    bot.StartSearch(*state);
+    std::vector<const State*> inflight;
+    while (true) {
+      while (inflight.size() < 8) {
+        const State* leaf = bot.CollectLeaf();
+        if (leaf == nullptr) break;
+        inflight.push_back(leaf);
+      }
+      if (inflight.empty()) break;
+      for (const State* leaf : inflight) {
+        bot.ProvideLeafValue(evaluator->Evaluate(*leaf));
+      }
+      inflight.clear();
+    }
+    std::unique_ptr<algorithms::SearchNode> root = bot.FinishSearch();
+    // In-flight simulations count against the budget, so it is not
+    // overshot.
+    SPIEL_CHECK_LE(root->explore_count, max_simulations);
+    state->ApplyAction(root->BestChild().action);
+  }
+  SPIEL_CHECK_EQ(state->Returns()[0] + state->Returns()[1], 0);
+}
+
 void MCTSTest_GarbageCollect() {
   auto game = LoadGame("tic_tac_toe");
   std::unique_ptr<State> state = game->NewInitialState();
@@ -179,5 +293,10 @@ int main(int argc, char** argv) {
   open_spiel::MCTSTest_SolveDraw();
   open_spiel::MCTSTest_SolveLoss();
   open_spiel::MCTSTest_SolveWin();
+  open_spiel::MCTSTest_CanPlayTicTacToe_Parallel();
+  open_spiel::MCTSTest_CanPlayTicTacToe_TreeReuse();
+  open_spiel::MCTSTest_CanPlayTicTacToe_BatchedLeaves();
+  open_spiel::MCTSTest_IncrementalSearch();
+  open_spiel::MCTSTest_IncrementalSearch_MultipleInflight();
   open_spiel::MCTSTest_GarbageCollect();
 }
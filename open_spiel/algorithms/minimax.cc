@@ -15,8 +15,10 @@
 #include "open_spiel/algorithms/minimax.h"
 
 #include <algorithm>  // std::max
+#include <array>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -136,6 +138,132 @@ double _alpha_beta(State* state, int depth, double alpha, double beta,
   }
 }
 
+// Killer moves: moves that caused a cutoff at this ply, tried early at
+// sibling nodes. Two per ply, most recent first.
+struct KillerMoves {
+  std::array<Action, 2> moves = {kInvalidAction, kInvalidAction};
+  void Add(Action action) {
+    if (moves[0] != action) {
+      moves[1] = moves[0];
+      moves[0] = action;
+    }
+  }
+};
+
+// Moves the transposition-table move and the killer moves (when present in
+// `actions`) to the front, in that order, preserving the game's order for
+// the rest.
+void OrderMoves(Action tt_move, const KillerMoves& killers,
+                std::vector<Action>* actions) {
+  int front = 0;
+  auto promote = [&front, actions](Action move) {
+    if (move == kInvalidAction) return;
+    auto it = std::find(actions->begin() + front, actions->end(), move);
+    if (it != actions->end()) {
+      std::rotate(actions->begin() + front, it, it + 1);
+      ++front;
+    }
+  };
+  promote(tt_move);
+  promote(killers.moves[0]);
+  promote(killers.moves[1]);
+}
+
+// Alpha-beta with a transposition table, killer moves and TT-move-first
+// ordering. Same contract as _alpha_beta otherwise; `ply` is the distance
+// from the search root, indexing the killer table.
+double _alpha_beta_with_table(
+    State* state, int depth, double alpha, double beta,
+    const std::function<double(const State&)>& value_function,
+    Player maximizing_player, Action* best_action, bool use_undo,
+    TranspositionTable* table, std::vector<KillerMoves>* killers, int ply) {
+  if (state->IsTerminal()) {
+    return state->PlayerReturn(maximizing_player);
+  }
+  if (depth == 0) {
+    return value_function(*state);
+  }
+
+  const double original_alpha = alpha;
+  const double original_beta = beta;
+  const uint64_t key = state->Key();
+  Action tt_move = kInvalidAction;
+  if (const TranspositionTable::Entry* entry = table->Lookup(key)) {
+    tt_move = entry->best_action;
+    if (entry->depth >= depth) {
+      switch (entry->bound) {
+        case TranspositionTable::Bound::kExact:
+          if (best_action != nullptr) *best_action = entry->best_action;
+          return entry->value;
+        case TranspositionTable::Bound::kLowerBound:
+          alpha = std::max(alpha, entry->value);
+          break;
+        case TranspositionTable::Bound::kUpperBound:
+          beta = std::min(beta, entry->value);
+          break;
+      }
+      if (alpha >= beta) {
+        if (best_action != nullptr) *best_action = entry->best_action;
+        return entry->value;
+      }
+    }
+  }
+
+  std::vector<Action> actions = state->LegalActions();
+  OrderMoves(tt_move, (*killers)[ply], &actions);
+
+  Player player = state->CurrentPlayer();
+  const bool maximizing = (player == maximizing_player);
+  double value = maximizing ? -std::numeric_limits<double>::infinity()
+                            : std::numeric_limits<double>::infinity();
+  Action local_best = kInvalidAction;
+
+  for (Action action : actions) {
+    double child_value = 0;
+    if (use_undo) {
+      state->ApplyAction(action);
+      child_value = _alpha_beta_with_table(
+          state, /*depth=*/depth - 1, alpha, beta, value_function,
+          maximizing_player, /*best_action=*/nullptr, use_undo, table, killers,
+          ply + 1);
+      state->UndoAction(player, action);
+    } else {
+      std::unique_ptr<State> child_state = state->Child(action);
+      child_value = _alpha_beta_with_table(
+          child_state.get(), /*depth=*/depth - 1, alpha, beta, value_function,
+          maximizing_player, /*best_action=*/nullptr, use_undo, table, killers,
+          ply + 1);
+    }
+
+    if (maximizing ? child_value > value : child_value < value) {
+      value = child_value;
+      local_best = action;
+      if (best_action != nullptr) {
+        *best_action = action;
+      }
+    }
+
+    if (maximizing) {
+      alpha = std::max(alpha, value);
+    } else {
+      beta = std::min(beta, value);
+    }
+    if (alpha >= beta) {
+      (*killers)[ply].Add(action);
+      break;  // cut-off
+    }
+  }
+
+  // Classify the result against the original window: a fail-low is an upper
+  // bound on the true value, a fail-high a lower bound.
+  TranspositionTable::Bound bound =
+      value <= original_alpha ? TranspositionTable::Bound::kUpperBound
+      : value >= original_beta ? TranspositionTable::Bound::kLowerBound
+                               : TranspositionTable::Bound::kExact;
+  table->Store(key, {value, depth, bound, local_best});
+  return value;
+}
+
 // Expectiminimax algorithm.
 //
 // Runs expectiminimax until the specified depth.
@@ -255,6 +383,54 @@ std::pair<double, Action> AlphaBetaSearch(
   return {value, best_action};
 }
 
+std::pair<double, Action> IterativeDeepeningAlphaBetaSearch(
+    const Game& game, const State* state,
+    std::function<double(const State&)> value_function, int depth_limit,
+    Player maximizing_player, TranspositionTable* transposition_table,
+    bool use_undo) {
+  SPIEL_CHECK_LE(game.NumPlayers(), 2);
+  SPIEL_CHECK_GE(depth_limit, 1);
+  // The intermediate iterations stop short of terminal states, so a value
+  // function is not optional here.
+  SPIEL_CHECK_TRUE(static_cast<bool>(value_function));
+
+  // Same setup checks as AlphaBetaSearch; see the comment there about
+  // imperfect information.
+  GameType game_info = game.GetType();
+  SPIEL_CHECK_EQ(game_info.chance_mode, GameType::ChanceMode::kDeterministic);
+  SPIEL_CHECK_EQ(game_info.dynamics, GameType::Dynamics::kSequential);
+  SPIEL_CHECK_EQ(game_info.utility, GameType::Utility::kZeroSum);
+  SPIEL_CHECK_EQ(game_info.reward_model, GameType::RewardModel::kTerminal);
+
+  std::unique_ptr<State> search_root;
+  if (state == nullptr) {
+    search_root = game.NewInitialState();
+  } else {
+    search_root = state->Clone();
+  }
+
+  if (maximizing_player == kInvalidPlayer) {
+    maximizing_player = search_root->CurrentPlayer();
+  }
+
+  TranspositionTable local_table;
+  TranspositionTable* table =
+      transposition_table != nullptr ? transposition_table : &local_table;
+
+  double infinity = std::numeric_limits<double>::infinity();
+  double value = 0;
+  Action best_action = kInvalidAction;
+  std::vector<KillerMoves> killers(depth_limit + 1);
+  for (int depth = 1; depth <= depth_limit; ++depth) {
+    value = _alpha_beta_with_table(
+        search_root.get(), depth, /*alpha=*/-infinity, /*beta=*/infinity,
+        value_function, maximizing_player, &best_action, use_undo, table,
+        &killers, /*ply=*/0);
+  }
+
+  return {value, best_action};
+}
+
 std::pair<double, Action> ExpectiminimaxSearch(
     const Game& game, const State* state,
     std::function<double(const State&)> value_function, int depth_limit,
@@ -15,14 +15,64 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_MINMAX_H_
 #define OPEN_SPIEL_ALGORITHMS_MINMAX_H_
 
+#include <cstdint>
 #include <memory>
 #include <utility>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
 namespace algorithms {
 
+// A transposition table for alpha-beta search, keyed on State::Key().
+// Entries record the depth they were searched to, whether the value is exact
+// or only a bound (from an alpha/beta cutoff), and the best move found, which
+// later searches use for move ordering. A table may be shared across
+// searches -- e.g. across the iterations of iterative deepening, or across
+// the moves of a game -- as long as the value function and maximizing player
+// stay the same.
+class TranspositionTable {
+ public:
+  enum class Bound { kExact, kLowerBound, kUpperBound };
+  struct Entry {
+    double value;
+    int depth;
+    Bound bound;
+    Action best_action;
+  };
+
+  // `max_entries` caps memory; once the table is full, only entries for
+  // already-present keys are updated.
+  explicit TranspositionTable(int64_t max_entries = int64_t{1} << 22)
+      : max_entries_(max_entries) {}
+
+  // Returns the entry for `key`, or nullptr if absent. The pointer is
+  // invalidated by the next Store().
+  const Entry* Lookup(uint64_t key) const {
+    auto it = table_.find(key);
+    return it == table_.end() ? nullptr : &it->second;
+  }
+
+  // Depth-preferred replacement: an existing entry is only overwritten by a
+  // result searched at least as deep.
+  void Store(uint64_t key, const Entry& entry) {
+    auto it = table_.find(key);
+    if (it != table_.end()) {
+      if (entry.depth >= it->second.depth) it->second = entry;
+    } else if (static_cast<int64_t>(table_.size()) < max_entries_) {
+      table_.emplace(key, entry);
+    }
+  }
+
+  int64_t Size() const { return table_.size(); }
+  void Clear() { table_.clear(); }
+
+ private:
+  int64_t max_entries_;
+  absl::flat_hash_map<uint64_t, Entry> table_;
+};
+
 // Solves deterministic, 2-players, perfect-information 0-sum game.
 //
 // Arguments:
@@ -47,6 +97,26 @@ std::pair<double, Action> AlphaBetaSearch(
     std::function<double(const State&)> value_function, int depth_limit,
     Player maximizing_player, bool use_undo = true);
 
+// Iterative-deepening alpha-beta for the same class of games as
+// `AlphaBetaSearch`. Searches depth 1, 2, ..., `depth_limit`, sharing a
+// transposition table across iterations: table hits cut off repeated
+// positions, the previous iteration's best move is searched first at each
+// node, and two killer moves per ply are tried next. Together these
+// typically buy several plies of effective depth over `AlphaBetaSearch` for
+// the same node budget.
+//
+// A `value_function` is required, since the intermediate iterations stop
+// short of terminal states. Pass an external `transposition_table` to share
+// entries across calls (e.g. across the moves of a game); with nullptr a
+// fresh table is used for the one search. The table is keyed on
+// State::Key() and its values depend on the value function and maximizing
+// player, so only share it across searches where those match.
+std::pair<double, Action> IterativeDeepeningAlphaBetaSearch(
+    const Game& game, const State* state,
+    std::function<double(const State&)> value_function, int depth_limit,
+    Player maximizing_player,
+    TranspositionTable* transposition_table = nullptr, bool use_undo = true);
+
 // Solves stochastic, 2-players, perfect-information 0-sum game.
 //
 // Arguments:
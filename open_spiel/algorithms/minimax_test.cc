@@ -72,6 +72,47 @@ int FirstPlayerAdvantage(const State& state) {
   return pstate.score(0) - pstate.score(1);
 }
 
+void IterativeDeepeningSearchTest_TicTacToe() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  // An exact evaluator, so horizon cutoffs in the shallow iterations return
+  // true values and the search results must match full-depth alpha-beta.
+  auto exact_value = [&game](const State& state) {
+    return AlphaBetaSearch(*game, &state, {}, -1, Player{0}).first;
+  };
+
+  // One table shared across all three searches: same value function, same
+  // maximizing player.
+  TranspositionTable table;
+
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::pair<double, Action> value_and_action = IterativeDeepeningAlphaBetaSearch(
+      *game, state.get(), exact_value, 9, Player{0}, &table);
+  SPIEL_CHECK_EQ(0.0, value_and_action.first);
+
+  // .o.
+  // .x.
+  // ...
+  state->ApplyAction(4);
+  state->ApplyAction(1);
+  value_and_action = IterativeDeepeningAlphaBetaSearch(
+      *game, state.get(), exact_value, 9, Player{0}, &table);
+  SPIEL_CHECK_EQ(1.0, value_and_action.first);
+
+  // ...
+  // xox
+  // ..o
+  state = game->NewInitialState();
+  state->ApplyAction(5);
+  state->ApplyAction(4);
+  state->ApplyAction(3);
+  state->ApplyAction(8);
+  value_and_action = IterativeDeepeningAlphaBetaSearch(
+      *game, state.get(), exact_value, 9, Player{0}, &table);
+  SPIEL_CHECK_EQ(-1.0, value_and_action.first);
+
+  SPIEL_CHECK_GT(table.Size(), 0);
+}
+
 void ExpectiminimaxSearchTest_Pig() {
   std::shared_ptr<const Game> game =
       LoadGame("pig", {{"diceoutcomes", GameParameter(3)}});
@@ -89,5 +130,6 @@ int main(int argc, char **argv) {
   open_spiel::algorithms::AlphaBetaSearchTest_TicTacToe();
   open_spiel::algorithms::AlphaBetaSearchTest_TicTacToe_Win();
   open_spiel::algorithms::AlphaBetaSearchTest_TicTacToe_Loss();
+  open_spiel::algorithms::IterativeDeepeningSearchTest_TicTacToe();
   open_spiel::algorithms::ExpectiminimaxSearchTest_Pig();
 }
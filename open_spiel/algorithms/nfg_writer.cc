@@ -14,35 +14,61 @@
 
 #include "open_spiel/algorithms/nfg_writer.h"
 
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 
-#include "open_spiel/abseil-cpp/absl/strings/ascii.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
-#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
-#include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/normal_form_game.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/file.h"
+#include "open_spiel/utils/format_double.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
-const std::string GameToNFGString(const Game& game) {
-  // NFG 1 R "Selten (IJGT, 75), Figure 2, normal form"
-  // { "Player 1" "Player 2" } { 3 2 }
-  // 1 1 0 2 0 2 1 1 0 3 2 0
-  const auto* nfg = dynamic_cast<const NormalFormGame*>(&game);
-  if (nfg == nullptr) {
-    SpielFatalError("Must be a normal-form game");
+namespace {
+
+// Appends one payoff. Most exported games have integral payoffs, which take
+// a fast integer path; everything else uses the shared shortest-round-trip
+// formatter. Format parsing otherwise dominates the cost of large exports.
+void AppendPayoff(double value, std::string* out) {
+  // Doubles represent integers exactly up to 2^53; stay well inside that so
+  // the cast below is exact. Negative zero must print as "-0".
+  if (std::abs(value) < 9.0e15 &&
+      value == static_cast<int64_t>(value) &&
+      !(value == 0 && std::signbit(value))) {
+    absl::StrAppend(out, static_cast<int64_t>(value));
+  } else {
+    AppendShortestDouble(value, out);
   }
+}
 
-  int num_players = nfg->NumPlayers();
-  std::vector<std::vector<Action>> legal_actions(num_players);
-  std::unique_ptr<State> initial_state = nfg->NewInitialState();
-  for (Player player = 0; player < num_players; ++player) {
-    legal_actions[player] = initial_state->LegalActions(player);
+// Appends the payoff row for one flat joint action (one line of the payoff
+// listing), space-separated with a trailing newline.
+void AppendPayoffRow(const State& initial_state, Action flat_joint_action,
+                     std::string* out) {
+  std::vector<double> returns =
+      initial_state.Child(flat_joint_action)->Returns();
+  for (Player p = 0; p < returns.size(); ++p) {
+    if (p > 0) out->push_back(' ');
+    AppendPayoff(returns[p], out);
   }
+  out->push_back('\n');
+}
+
+// The prologue: format line, player names, and the shape of the payoff
+// listing, up to and including the blank line preceding the payoffs.
+std::string NFGPrologue(const NormalFormGame& nfg, const State& initial_state) {
+  // NFG 1 R "Selten (IJGT, 75), Figure 2, normal form"
+  // { "Player 1" "Player 2" } { 3 2 }
+  int num_players = nfg.NumPlayers();
 
   // Line 1.
   std::string nfg_text =
-      absl::StrCat("NFG 1 R \"OpenSpiel export of ", nfg->ToString(), "\"\n");
+      absl::StrCat("NFG 1 R \"OpenSpiel export of ", nfg.ToString(), "\"\n");
 
   // Line 2.
   absl::StrAppend(&nfg_text, "{");
@@ -51,22 +77,98 @@ const std::string GameToNFGString(const Game& game) {
   }
   absl::StrAppend(&nfg_text, " } {");
   for (Player p = 0; p < num_players; ++p) {
-    absl::StrAppend(&nfg_text, " ", legal_actions[p].size());
+    absl::StrAppend(&nfg_text, " ", initial_state.LegalActions(p).size());
   }
   absl::StrAppend(&nfg_text, " }\n\n");
+  return nfg_text;
+}
+
+const NormalFormGame& ToNormalFormGame(const Game& game) {
+  const auto* nfg = dynamic_cast<const NormalFormGame*>(&game);
+  if (nfg == nullptr) {
+    SpielFatalError("Must be a normal-form game");
+  }
+  return *nfg;
+}
+
+}  // namespace
+
+const std::string GameToNFGString(const Game& game) {
+  const NormalFormGame& nfg = ToNormalFormGame(game);
+  std::unique_ptr<State> initial_state = nfg.NewInitialState();
+  std::string nfg_text = NFGPrologue(nfg, *initial_state);
 
   // Now the payoffs.
-  for (auto flat_joint_action : initial_state->LegalActions()) {
-    std::vector<double> returns =
-        initial_state->Child(flat_joint_action)->Returns();
-    for (Player p = 0; p < returns.size(); ++p) {
-      absl::StrAppendFormat(&nfg_text, "%.15g ", returns[p]);
-    }
-    absl::StripAsciiWhitespace(&nfg_text);
-    absl::StrAppend(&nfg_text, "\n");
+  for (Action flat_joint_action : initial_state->LegalActions()) {
+    AppendPayoffRow(*initial_state, flat_joint_action, &nfg_text);
   }
 
   return nfg_text;
 }
 
+void GameToNFGFile(const Game& game, const std::string& filename,
+                   int num_threads) {
+  const NormalFormGame& nfg = ToNormalFormGame(game);
+  std::unique_ptr<State> initial_state = nfg.NewInitialState();
+  const std::vector<Action> joint_actions = initial_state->LegalActions();
+
+  file::File out(filename, "w");
+  out.SetBufferSize(1 << 20);
+  SPIEL_CHECK_TRUE(out.Write(NFGPrologue(nfg, *initial_state)));
+
+  const int num_workers = std::max<int64_t>(
+      1, std::min<int64_t>(num_threads,
+                           static_cast<int64_t>(joint_actions.size())));
+  if (num_workers <= 1) {
+    std::string row;
+    for (Action flat_joint_action : joint_actions) {
+      row.clear();
+      AppendPayoffRow(*initial_state, flat_joint_action, &row);
+      SPIEL_CHECK_TRUE(out.Write(row));
+    }
+    return;
+  }
+
+  // Rows are formatted a block at a time: each worker formats a contiguous
+  // slice of the block into its own buffer (against its own root state; see
+  // State's legal-action cache) and the buffers are written out in order, so
+  // the file is byte-identical to the serial export and memory stays bounded
+  // by the block size regardless of the size of the game.
+  constexpr int64_t kRowsPerBlock = 1 << 14;
+  std::vector<std::unique_ptr<State>> worker_states;
+  worker_states.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    worker_states.push_back(nfg.NewInitialState());
+  }
+  std::vector<std::string> buffers(num_workers);
+  const int64_t num_rows = joint_actions.size();
+  for (int64_t block_begin = 0; block_begin < num_rows;
+       block_begin += kRowsPerBlock) {
+    const int64_t block_end =
+        std::min<int64_t>(block_begin + kRowsPerBlock, num_rows);
+    const int64_t rows_per_worker =
+        (block_end - block_begin + num_workers - 1) / num_workers;
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int w = 0; w < num_workers; ++w) {
+      const int64_t begin =
+          std::min<int64_t>(block_begin + w * rows_per_worker, block_end);
+      const int64_t end =
+          std::min<int64_t>(begin + rows_per_worker, block_end);
+      State* state = worker_states[w].get();
+      std::string* buffer = &buffers[w];
+      workers.emplace_back([state, buffer, &joint_actions, begin, end]() {
+        buffer->clear();
+        for (int64_t row = begin; row < end; ++row) {
+          AppendPayoffRow(*state, joint_actions[row], buffer);
+        }
+      });
+    }
+    for (Thread& worker : workers) worker.join();
+    for (int w = 0; w < num_workers; ++w) {
+      SPIEL_CHECK_TRUE(out.Write(buffers[w]));
+    }
+  }
+}
+
 }  // namespace open_spiel
@@ -27,6 +27,15 @@ namespace open_spiel {
 // Get the string representation of this normal-form game.
 const std::string GameToNFGString(const Game& game);
 
+// Writes the same representation directly to the file at filename, without
+// materializing the whole payoff listing in memory: rows are streamed through
+// a buffered file::File, so memory use is constant in the size of the game.
+// With num_threads > 1, blocks of rows are formatted by that many worker
+// threads and written in file order; the output is byte-identical to
+// GameToNFGString.
+void GameToNFGFile(const Game& game, const std::string& filename,
+                   int num_threads = 1);
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_ALGORITHMS_NFG_WRITER_H_
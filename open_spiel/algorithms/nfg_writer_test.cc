@@ -14,8 +14,11 @@
 
 #include "open_spiel/algorithms/nfg_writer.h"
 
+#include <string>
+
 #include "open_spiel/normal_form_game.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/file.h"
 
 namespace open_spiel {
 namespace {
@@ -75,6 +78,21 @@ void BasicNFSWriterTestMP3P() {
   std::string mp3p_nfg_text = GameToNFGString(*mp3p);
   SPIEL_CHECK_EQ(mp3p_nfg_text, kMP3PNFG);
 }
+void NFGWriterToFileTest() {
+  // The streaming file export must be byte-identical to the string export,
+  // with and without worker threads.
+  std::string filename = file::GetTmpDir() + "/nfg_writer_test.nfg";
+  for (const char* game_name : {"matrix_rps", "matching_pennies_3p"}) {
+    std::shared_ptr<const Game> game = LoadGame(game_name);
+    std::string nfg_text = GameToNFGString(*game);
+    for (int num_threads : {1, 3}) {
+      GameToNFGFile(*game, filename, num_threads);
+      SPIEL_CHECK_EQ(file::ReadContentsFromFile(filename, "r"), nfg_text);
+    }
+  }
+  file::Remove(filename);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -82,4 +100,5 @@ int main(int argc, char** argv) {
   open_spiel::BasicNFSWriterTestRPS();
   open_spiel::BasicNFSWriterTestPD();
   open_spiel::BasicNFSWriterTestMP3P();
+  open_spiel::NFGWriterToFileTest();
 }
@@ -14,7 +14,9 @@
 
 #include "open_spiel/algorithms/observation_history.h"
 
+#include <cstdint>
 #include <string>
+#include <tuple>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
@@ -193,6 +195,85 @@ std::string ActionObservationHistory::ToString() const {
   return s;
 }
 
+// -----------------------------------------------------------------------------
+// ObservationInterner & CompactActionObservationHistory
+// -----------------------------------------------------------------------------
+
+int ObservationInterner::Intern(absl::string_view observation) {
+  auto [iter, inserted] = ids_.emplace(observation, observations_.size());
+  if (inserted) observations_.push_back(&iter->first);
+  return iter->second;
+}
+
+CompactActionObservationHistory::CompactActionObservationHistory(
+    Player player, const State& target, ObservationInterner* interner)
+    : player_(player), interner_(interner) {
+  SPIEL_CHECK_GE(player_, 0);
+  SPIEL_CHECK_LT(player_, target.NumPlayers());
+  SPIEL_CHECK_TRUE(target.GetGame()->GetType().provides_observation_string);
+
+  const std::vector<State::PlayerAction>& history = target.FullHistory();
+  history_.reserve(history.size() + 1);
+  hash_chain_.reserve(history.size() + 1);
+
+  std::unique_ptr<State> state = target.GetGame()->NewInitialState();
+  Extend(absl::nullopt, state->ObservationString(player));
+  for (const auto& [history_player, action] : history) {
+    const bool is_acting = state->CurrentPlayer() == player;
+    state->ApplyAction(action);
+    Extend(is_acting ? absl::optional<Action>(action) : absl::nullopt,
+           state->ObservationString(player));
+  }
+}
+
+CompactActionObservationHistory::CompactActionObservationHistory(
+    Player player, absl::string_view initial_observation,
+    ObservationInterner* interner)
+    : player_(player), interner_(interner) {
+  SPIEL_CHECK_GE(player_, 0);
+  Extend(absl::nullopt, initial_observation);
+}
+
+void CompactActionObservationHistory::Extend(absl::optional<Action> action,
+                                             absl::string_view observation) {
+  const int id = interner_->Intern(observation);
+  const uint64_t previous = hash_chain_.empty() ? 0 : hash_chain_.back();
+  // kInvalidAction marks "not acting"; it can never be a real action.
+  hash_chain_.push_back(absl::Hash<std::tuple<uint64_t, Action, int>>()(
+      {previous, action.value_or(kInvalidAction), id}));
+  history_.emplace_back(action, id);
+}
+
+void CompactActionObservationHistory::RemoveLast() {
+  SPIEL_CHECK_GT(history_.size(), 1);  // The initial observation stays.
+  history_.pop_back();
+  hash_chain_.pop_back();
+}
+
+ActionObservationHistory
+CompactActionObservationHistory::ToActionObservationHistory() const {
+  std::vector<std::pair<absl::optional<Action>, std::string>> history;
+  history.reserve(history_.size());
+  for (const auto& [action, id] : history_) {
+    history.emplace_back(action, interner_->StringOf(id));
+  }
+  return ActionObservationHistory(player_, std::move(history));
+}
+
+std::string CompactActionObservationHistory::ToString() const {
+  std::string s;
+  for (int i = 0; i < history_.size(); i++) {
+    if (i > 0) absl::StrAppend(&s, ", ");
+    absl::StrAppend(&s, "(action=",
+                    (history_[i].first == absl::nullopt
+                         ? "None"
+                         : std::to_string(*history_[i].first)),
+                    ", observation=\"", interner_->StringOf(history_[i].second),
+                    "\")");
+  }
+  return s;
+}
+
 // -----------------------------------------------------------------------------
 // PublicObservationHistory
 // -----------------------------------------------------------------------------
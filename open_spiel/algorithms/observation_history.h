@@ -15,11 +15,15 @@
 #ifndef OPEN_SPIEL_FOG_OBSERVATION_HISTORY_H_
 #define OPEN_SPIEL_FOG_OBSERVATION_HISTORY_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/node_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
@@ -143,6 +147,88 @@ class ActionObservationHistory {
                                             int until_time) const;
 };
 
+// Interns observation strings into dense ids so that long histories store one
+// int per step instead of a copy of the observation string. Typically shared
+// between all the CompactActionObservationHistory objects of a run; ids are
+// only meaningful relative to their interner.
+class ObservationInterner {
+ public:
+  int Intern(absl::string_view observation);
+  const std::string& StringOf(int id) const { return *observations_.at(id); }
+  int size() const { return observations_.size(); }
+
+ private:
+  // node_hash_map: StringOf hands out pointers to the keys, which must
+  // survive rehashing.
+  absl::node_hash_map<std::string, int> ids_;
+  std::vector<const std::string*> observations_;
+};
+
+// A compact Action-Observation history for long games (hearts/backgammon
+// depths). Observations are stored as interned ids and the history is
+// identified by a rolling 64-bit hash which Extend/RemoveLast maintain
+// incrementally, so using one as a table key hashes a single integer instead
+// of every observation string. Equality compares the rolling hash first and
+// then verifies the (action, observation-id) sequence, so a hash collision
+// cannot produce a false positive.
+class CompactActionObservationHistory {
+ public:
+  // Collects the player's Action-Observation history at the target state,
+  // like ActionObservationHistory, but interning the observations. The
+  // interner must outlive this object.
+  CompactActionObservationHistory(Player player, const State& target,
+                                  ObservationInterner* interner);
+
+  // Constructs a history at the initial state, holding just the initial
+  // observation.
+  CompactActionObservationHistory(Player player,
+                                  absl::string_view initial_observation,
+                                  ObservationInterner* interner);
+
+  Player GetPlayer() const { return player_; }
+  int MoveNumber() const { return history_.size() - 1; }
+  bool CorrespondsToInitialState() const { return MoveNumber() == 0; }
+
+  // The rolling hash identifying this history (within its interner).
+  uint64_t Hash() const { return hash_chain_.back(); }
+
+  // Returns the action at the given time, or nullopt if the player was not
+  // acting. Root node has time 0.
+  absl::optional<Action> ActionAt(int time) const {
+    return history_.at(time).first;
+  }
+  // Returns the player's observation at the given time.
+  const std::string& ObservationAt(int time) const {
+    return interner_->StringOf(history_.at(time).second);
+  }
+
+  void Extend(absl::optional<Action> action, absl::string_view observation);
+  void RemoveLast();
+
+  // Expands back into the string-backed representation.
+  ActionObservationHistory ToActionObservationHistory() const;
+
+  std::string ToString() const;
+
+  bool operator==(const CompactActionObservationHistory& other) const {
+    return Hash() == other.Hash() && player_ == other.player_ &&
+           history_ == other.history_;
+  }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const CompactActionObservationHistory& aoh) {
+    return H::combine(std::move(h), aoh.player_, aoh.Hash());
+  }
+
+ private:
+  Player player_;
+  ObservationInterner* interner_;
+  std::vector<std::pair<absl::optional<Action>, int>> history_;
+  // hash_chain_[t] identifies the prefix up to time t; RemoveLast pops it,
+  // so the rolling hash is maintained in O(1) in both directions.
+  std::vector<uint64_t> hash_chain_;
+};
+
 // Public-observation histories partition the game tree according to available
 // public information into a corresponding public tree. Public observation
 // history identifies the current public state (a node in the public tree),
@@ -91,9 +91,56 @@ void CheckKuhnPokerObservationHistory() {
                                      {NONE, "122"}}));
 }
 
+void CheckCompactActionObservationHistory() {
+  using AOH = ActionObservationHistory;
+  using CompactAOH = CompactActionObservationHistory;
+
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  ObservationInterner interner;
+
+  std::unique_ptr<State> s = game->NewInitialState();
+  for (Action action : {2, 1, 0, 1, 1}) s->ApplyAction(action);
+
+  // The compact history expands back to the string-backed one.
+  CompactAOH compact0(0, *s, &interner);
+  CompactAOH compact1(1, *s, &interner);
+  SPIEL_CHECK_EQ(compact0.ToActionObservationHistory(), AOH(0, *s));
+  SPIEL_CHECK_EQ(compact1.ToActionObservationHistory(), AOH(1, *s));
+  SPIEL_CHECK_EQ(compact0.ToString(), AOH(0, *s).ToString());
+  SPIEL_CHECK_EQ(compact0.MoveNumber(), s->MoveNumber());
+  SPIEL_CHECK_FALSE(compact0 == compact1);
+
+  // Repeated observations share one interned string.
+  SPIEL_CHECK_LT(interner.size(), 2 * (s->MoveNumber() + 1));
+
+  // The rolling hash is incrementally consistent: extending step by step
+  // reaches the same hash, and RemoveLast unwinds it exactly.
+  std::unique_ptr<State> replay = game->NewInitialState();
+  CompactAOH incremental(0, replay->ObservationString(0), &interner);
+  std::vector<uint64_t> hashes = {incremental.Hash()};
+  for (Action action : {2, 1, 0, 1, 1}) {
+    const bool is_acting = replay->CurrentPlayer() == 0;
+    replay->ApplyAction(action);
+    incremental.Extend(is_acting ? absl::optional<Action>(action)
+                                 : absl::nullopt,
+                       replay->ObservationString(0));
+    hashes.push_back(incremental.Hash());
+  }
+  SPIEL_CHECK_EQ(incremental.Hash(), compact0.Hash());
+  SPIEL_CHECK_TRUE(incremental == compact0);
+  SPIEL_CHECK_EQ(absl::Hash<CompactAOH>()(incremental),
+                 absl::Hash<CompactAOH>()(compact0));
+  while (incremental.MoveNumber() > 0) {
+    incremental.RemoveLast();
+    hashes.pop_back();
+    SPIEL_CHECK_EQ(incremental.Hash(), hashes.back());
+  }
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::CheckKuhnPokerObservationHistory();
+  open_spiel::CheckCompactActionObservationHistory();
 }
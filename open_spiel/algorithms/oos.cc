@@ -79,19 +79,44 @@ void TargetedPolicy::NoTargeting() {
   targeting_ = kDoNotUseTargeting;
   target_public_state_ = kNoPublicObsTargetSpecified;
   target_info_state_ = kNoActionObsTargetSpecified;
+  cached_info_state_target_.reset();
+  cached_public_state_target_.reset();
+  InvalidateTargetCaches();
 }
 
 void TargetedPolicy::UpdateTarget(const ActionObservationHistory* info_state) {
+  // Re-targeting the same infostate -- repeated RunTargetedIterations calls
+  // within one move decision -- keeps the targeting caches warm.
+  if (targeting_ == kInfoStateTargeting &&
+      cached_info_state_target_.has_value() &&
+      *cached_info_state_target_ == *info_state) {
+    target_info_state_ = info_state;
+    return;
+  }
   NoTargeting();  // Reset.
   targeting_ = kInfoStateTargeting;
   target_info_state_ = info_state;
+  // emplace, not assignment: ActionObservationHistory is not copy-assignable.
+  cached_info_state_target_.emplace(*info_state);
 }
 
 void TargetedPolicy::UpdateTarget(
     const PublicObservationHistory* public_state) {
+  if (targeting_ == kPublicStateTargeting &&
+      cached_public_state_target_.has_value() &&
+      *cached_public_state_target_ == *public_state) {
+    target_public_state_ = public_state;
+    return;
+  }
   NoTargeting();  // Reset.
   targeting_ = kPublicStateTargeting;
   target_public_state_ = public_state;
+  cached_public_state_target_.emplace(*public_state);
+}
+
+void TargetedPolicy::InvalidateTargetCaches() {
+  allowed_actions_cache_.clear();
+  target_hit_cache_.clear();
 }
 
 // Negative zeros denote the banned actions. Useful for debugging,
@@ -112,11 +137,17 @@ ActionsAndProbs TargetedPolicy::GetStatePolicy(const State& h) const {
   }
 
   double biased_sum = 0.0;
-  for (auto& [action, prob] : policy) {
-    if (IsAllowedAction(h, action)) {
-      biased_sum += prob;
-    } else {
-      prob = kBannedAction;
+  if (targeting_ == kDoNotUseTargeting) {
+    // Everything is allowed; skip the cache so unbiased runs don't grow it.
+    for (const auto& [_, prob] : policy) biased_sum += prob;
+  } else {
+    const std::vector<Action>& allowed = AllowedActions(h, policy);
+    for (auto& [action, prob] : policy) {
+      if (std::binary_search(allowed.begin(), allowed.end(), action)) {
+        biased_sum += prob;
+      } else {
+        prob = kBannedAction;
+      }
     }
   }
 
@@ -144,6 +175,22 @@ ActionsAndProbs TargetedPolicy::GetStatePolicy(const State& h) const {
   return policy;
 }
 
+const std::vector<Action>& TargetedPolicy::AllowedActions(
+    const State& h, const ActionsAndProbs& policy) const {
+  const std::string key = h.HistoryString();
+  auto it = allowed_actions_cache_.find(key);
+  if (it == allowed_actions_cache_.end()) {
+    std::vector<Action> allowed;
+    allowed.reserve(policy.size());
+    for (const auto& [action, _] : policy) {
+      if (IsAllowedAction(h, action)) allowed.push_back(action);
+    }
+    std::sort(allowed.begin(), allowed.end());
+    it = allowed_actions_cache_.emplace(key, std::move(allowed)).first;
+  }
+  return it->second;
+}
+
 bool TargetedPolicy::IsAllowedAction(const State& h,
                                      const Action& action) const {
   if (targeting_ == kDoNotUseTargeting) return true;
@@ -169,12 +216,20 @@ bool TargetedPolicy::IsTargetHit(const State& h) {
                    target_info_state_ != kNoActionObsTargetSpecified);
   SPIEL_CHECK_TRUE(targeting_ != kPublicStateTargeting ||
                    target_public_state_ != kNoPublicObsTargetSpecified);
+  if (targeting_ == kDoNotUseTargeting) return false;
+  // CorrespondsTo rebuilds an observation history from the state, which is
+  // far more expensive than a hash lookup; this runs for every visited state.
+  const std::string key = h.HistoryString();
+  const auto cache_it = target_hit_cache_.find(key);
+  if (cache_it != target_hit_cache_.end()) return cache_it->second;
   const bool hit_info_state =
       targeting_ == kInfoStateTargeting &&
       target_info_state_->CorrespondsTo(target_info_state_->GetPlayer(), h);
   const bool hit_public_state = targeting_ == kPublicStateTargeting &&
                                 target_public_state_->CorrespondsTo(h);
-  return hit_info_state || hit_public_state;
+  const bool hit = hit_info_state || hit_public_state;
+  target_hit_cache_.emplace(key, hit);
+  return hit;
 }
 
 // -----------------------------------------------------------------------------
@@ -464,8 +519,11 @@ PlayerNodeOutcome OOSAlgorithm::SampleExistingTree(
   double u_h = u_ha * rm_ha_both / s_ha_all;
   SPIEL_DCHECK_FALSE(std::isnan(rm_ha_both));
   SPIEL_DCHECK_FALSE(std::isnan(u_h));
+  // The recursive Iteration() call may have grown the table and invalidated
+  // `values` (the table is an open-addressing flat map), so look the entry up
+  // again before handing out a reference to it.
   return PlayerNodeOutcome{take.action, rm_ha_both, u_h, u_ha / s_ha_all,
-                           *values};
+                           values_->at(info_state)};
 }
 
 PlayerNodeOutcome OOSAlgorithm::IncrementallyBuildTree(
@@ -18,9 +18,11 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/algorithms/cfr.h"
 #include "open_spiel/algorithms/observation_history.h"
 #include "open_spiel/spiel.h"
@@ -189,6 +191,12 @@ constexpr PublicObservationHistory* kNoPublicObsTargetSpecified = nullptr;
 // The targeting is done on top of cached entries from the main algorithm,
 // i.e. the OOSValues table is shared between the algorithm and this sampling
 // policy.
+//
+// Targeting decisions depend only on the (target, history) pair, so they are
+// computed once per history and reused by every subsequent sample. Repeated
+// UpdateTarget calls with an identical target -- consecutive searches within
+// one move decision -- keep the caches warm; any other target change drops
+// them.
 class TargetedPolicy : public CFRCurrentPolicy {
  protected:
   const std::shared_ptr<const Game> game_;
@@ -222,6 +230,26 @@ class TargetedPolicy : public CFRCurrentPolicy {
 
  private:
   bool IsAllowedAction(const State& h, const Action& action) const;
+
+  // Returns the actions from `policy` that lead towards the current target
+  // at h, resolving each history at most once (every IsAllowedAction call
+  // clones a child state, which is the expensive part of targeting).
+  const std::vector<Action>& AllowedActions(const State& h,
+                                            const ActionsAndProbs& policy)
+      const;
+  void InvalidateTargetCaches();
+
+  // Both caches are keyed by State::HistoryString() and are only populated
+  // while a target is set, so they are bounded by the states visited during
+  // one move decision.
+  mutable std::unordered_map<std::string, std::vector<Action>>
+      allowed_actions_cache_;
+  std::unordered_map<std::string, bool> target_hit_cache_;
+
+  // Owned copies of the last target, used to detect re-targeting of the same
+  // state (the caller's pointer need not outlive the previous search).
+  absl::optional<ActionObservationHistory> cached_info_state_target_;
+  absl::optional<PublicObservationHistory> cached_public_state_target_;
 };
 
 struct PlayerNodeOutcome {
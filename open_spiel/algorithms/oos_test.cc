@@ -168,6 +168,27 @@ void BiasedIterationsConverge(std::shared_ptr<const Game> game, int iterations,
   }
 }
 
+void RepeatedTargetingIsConsistent(std::shared_ptr<const Game> game) {
+  // Re-targeting the same infostate reuses the cached targeting bookkeeping;
+  // switching the target (or dropping it) must invalidate the caches. All
+  // paths must keep the statistics invariants intact.
+  std::vector<std::unique_ptr<State>> states = CollectStatesInGame(game);
+  auto alg = OOSAlgorithm(game);
+  ActionObservationHistory aoh(/*player=*/0, *states[0]);
+  alg.RunTargetedIterations(aoh, 100);
+  alg.RunTargetedIterations(aoh, 100);  // Warm-cache path.
+  PublicObservationHistory poh(*states[0]);
+  alg.RunTargetedIterations(poh, 100);  // Target change invalidates.
+  alg.RunTargetedIterations(poh, 100);  // Warm again.
+  alg.RunUnbiasedIterations(100);
+  alg.GetStats().CheckConsistency();
+}
+
+void RepeatedTargetingIsConsistentInGames() {
+  RepeatedTargetingIsConsistent(LoadGame("coordinated_mp"));
+  RepeatedTargetingIsConsistent(LoadGame("kuhn_poker"));
+}
+
 void UnbiasedIterationsConvergeInGames() {
   UnbiasedIterationsConverge(LoadGame("coordinated_mp"), 10000, 0.05);
   UnbiasedIterationsConverge(LoadGame("kuhn_poker"), 10000, 0.05);
@@ -186,6 +207,7 @@ void BiasedIterationsConvergeInGames() {
 
 int main(int argc, char** argv) {
   open_spiel::algorithms::EpsExploreSamplingPolicyTest();
+  open_spiel::algorithms::RepeatedTargetingIsConsistentInGames();
   open_spiel::algorithms::UnbiasedIterationsConvergeInGames();
   open_spiel::algorithms::BiasedIterationsConvergeInGames();
 }
@@ -109,7 +109,7 @@ void SequenceFormLpSpecification::SpecifyCfValuesConstraints(
     const std::map<const InfostateNode*, const InfostateNode*>& terminal_map =
         terminal_bijection_.association(opponent_node->tree().acting_player());
     const InfostateNode* player_node = terminal_map.at(opponent_node);
-    const double value = opponent_node->terminal_utility() *
+    const double value = TerminalUtility(opponent_node) *
                          opponent_node->terminal_chance_reach_prob();
     // Terminal value constraint comes from the opponent.
     ct->SetCoefficient(node_spec_[player_node].var_reach_prob, value);
@@ -145,6 +145,7 @@ void SequenceFormLpSpecification::SpecifyObjective(
 
 void SequenceFormLpSpecification::ClearSpecification() {
   solver_->Clear();
+  specified_player_ = absl::nullopt;
   for (auto& [node, spec] : node_spec_) {
     spec.var_cf_value = nullptr;
     spec.var_reach_prob = nullptr;
@@ -155,9 +156,62 @@ void SequenceFormLpSpecification::ClearSpecification() {
   }
 }
 
+double SequenceFormLpSpecification::TerminalUtility(
+    const InfostateNode* opponent_node) const {
+  auto it = terminal_value_overrides_.find(opponent_node);
+  if (it != terminal_value_overrides_.end()) return it->second;
+  // The override may have been set through the other player's node.
+  const std::map<const InfostateNode*, const InfostateNode*>& terminal_map =
+      terminal_bijection_.association(opponent_node->tree().acting_player());
+  it = terminal_value_overrides_.find(terminal_map.at(opponent_node));
+  if (it != terminal_value_overrides_.end()) return -it->second;
+  return opponent_node->terminal_utility();
+}
+
+void SequenceFormLpSpecification::SetTerminalValue(
+    const InfostateNode* terminal_node, double utility) {
+  SPIEL_CHECK_TRUE(terminal_node != nullptr);
+  SPIEL_CHECK_EQ(terminal_node->type(), kTerminalInfostateNode);
+  terminal_value_overrides_[terminal_node] = utility;
+}
+
+void SequenceFormLpSpecification::ClearTerminalValueOverrides() {
+  terminal_value_overrides_.clear();
+}
+
+void SequenceFormLpSpecification::RefreshTerminalConstraints() {
+  SPIEL_CHECK_TRUE(specified_player_.has_value());
+  const Player pl = *specified_player_;
+  const std::map<const InfostateNode*, const InfostateNode*>& terminal_map =
+      terminal_bijection_.association(/*direction=*/1 - pl);
+  for (const auto& [opponent_node, player_node] : terminal_map) {
+    const double value = TerminalUtility(opponent_node) *
+                         opponent_node->terminal_chance_reach_prob();
+    node_spec_.at(opponent_node)
+        .ct_child_cf_value->SetCoefficient(
+            node_spec_.at(player_node).var_reach_prob, value);
+  }
+}
+
 void SequenceFormLpSpecification::SpecifyLinearProgram(Player pl) {
   SPIEL_CHECK_TRUE(pl == 0 || pl == 1);
+  if (specified_player_ == pl) {
+    // The constraint structure is a function of the trees alone, so the
+    // existing model can be reused: only the terminal payoffs may have
+    // changed. The solver resumes from its previous basis.
+    RefreshTerminalConstraints();
+    return;
+  }
   ClearSpecification();
+  // Every node gets a specification; sizing the map up front keeps the
+  // recursive construction free of rehashing.
+  size_t num_nodes = 0;
+  for (const std::shared_ptr<InfostateTree>& tree : trees_) {
+    for (const std::vector<InfostateNode*>& depth : tree->nodes_at_depths()) {
+      num_nodes += depth.size();
+    }
+  }
+  node_spec_.reserve(num_nodes);
   SpecifyReachProbsConstraints(
       /*player_node=*/trees_[pl]->mutable_root());
   SpecifyRootConstraints(
@@ -166,6 +220,7 @@ void SequenceFormLpSpecification::SpecifyLinearProgram(Player pl) {
       /*opponent_node=*/trees_[1 - pl]->mutable_root());
   SpecifyObjective(
       /*opponent_root_node=*/trees_[1 - pl]->mutable_root());
+  specified_player_ = pl;
 }
 
 double SequenceFormLpSpecification::Solve() {
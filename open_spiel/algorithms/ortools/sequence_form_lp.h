@@ -21,6 +21,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/algorithms/infostate_tree.h"
 #include "open_spiel/policy.h"
 #include "ortools/linear_solver/linear_solver.h"
@@ -89,12 +90,32 @@ class SequenceFormLpSpecification {
       const std::string& solver_id = kDefaultLinProgSolver);
 
   // Specify the linear program for given player.
+  //
+  // The constraint structure only depends on the trees, so calling this again
+  // for the same player does not rebuild the program: it merely reapplies the
+  // terminal payoff coefficients (picking up any overrides set through
+  // SetTerminalValue) into the existing model. The solver then resumes from
+  // its previous basis, which makes repeated solves over perturbed payoffs —
+  // the pattern of our iterative algorithms — much cheaper than solving from
+  // scratch.
   void SpecifyLinearProgram(Player pl);
 
   // Solve the linear program.
   // Returns the root value for the player whose strategy was computed.
   double Solve();
 
+  // Overrides the utility of a terminal node, replacing the tree's
+  // terminal_utility() in the payoff constraints. The node must be a terminal
+  // node of either player's infostate tree, and the utility is from the
+  // perspective of that tree's acting player (the LP assumes a zero-sum
+  // game, so the partner node's utility is the negation). Takes effect on the
+  // next call to SpecifyLinearProgram.
+  void SetTerminalValue(const InfostateNode* terminal_node, double utility);
+
+  // Removes all terminal value overrides, returning to the trees' utilities.
+  // Takes effect on the next call to SpecifyLinearProgram.
+  void ClearTerminalValueOverrides();
+
   // Reset the solver and erase all pointers.
   // This is called automatically when you call SpecifyLinearProgram.
   void ClearSpecification();
@@ -130,11 +151,22 @@ class SequenceFormLpSpecification {
   const BijectiveContainer<const InfostateNode*> terminal_bijection_;
   std::unique_ptr<operations_research::MPSolver> solver_;
   std::unordered_map<const InfostateNode*, NodeSpecification> node_spec_;
+  // The player the current model was specified for; nullopt when the model
+  // has not been built (or was cleared).
+  absl::optional<Player> specified_player_;
+  std::unordered_map<const InfostateNode*, double> terminal_value_overrides_;
 
   void SpecifyReachProbsConstraints(InfostateNode* player_node);
   void SpecifyCfValuesConstraints(InfostateNode* opponent_node);
   void SpecifyRootConstraints(const InfostateNode* player_root_node);
   void SpecifyObjective(const InfostateNode* opponent_root_node);
+  // The effective utility of an opponent terminal node: its override if one
+  // was set (on it, or negated from its partner node), otherwise the tree's
+  // terminal_utility().
+  double TerminalUtility(const InfostateNode* opponent_node) const;
+  // Reapplies the terminal payoff coefficients into the existing model
+  // without touching its structure, so the solver can warm-start.
+  void RefreshTerminalConstraints();
 };
 
 }  // namespace ortools
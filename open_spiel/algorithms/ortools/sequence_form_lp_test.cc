@@ -55,6 +55,34 @@ void TestGameValueAndExploitability(const std::string& game_name,
                          kErrorTolerance);
 }
 
+void TestWarmStartedResolves() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  SequenceFormLpSpecification specification(*game);
+  specification.SpecifyLinearProgram(0);
+  const double game_value = specification.Solve();
+  SPIEL_CHECK_FLOAT_NEAR(game_value, -1 / 18., kErrorTolerance);
+
+  // Re-specifying for the same player reuses the model; the warm re-solve
+  // must return the same value.
+  specification.SpecifyLinearProgram(0);
+  SPIEL_CHECK_FLOAT_NEAR(specification.Solve(), game_value, kErrorTolerance);
+
+  // Scaling every terminal payoff scales the game value. This exercises the
+  // perturbed-payoff path: same structure, updated coefficients only.
+  for (const InfostateNode* leaf : specification.trees()[1]->leaf_nodes()) {
+    if (leaf->type() != kTerminalInfostateNode) continue;
+    specification.SetTerminalValue(leaf, 2 * leaf->terminal_utility());
+  }
+  specification.SpecifyLinearProgram(0);
+  SPIEL_CHECK_FLOAT_NEAR(specification.Solve(), 2 * game_value,
+                         kErrorTolerance);
+
+  // Clearing the overrides restores the original game.
+  specification.ClearTerminalValueOverrides();
+  specification.SpecifyLinearProgram(0);
+  SPIEL_CHECK_FLOAT_NEAR(specification.Solve(), game_value, kErrorTolerance);
+}
+
 }  // namespace
 }  // namespace ortools
 }  // namespace algorithms
@@ -65,6 +93,7 @@ namespace algorithms = open_spiel::algorithms;
 int main(int argc, char** argv) {
   algorithms::ortools::TestGameValueAndExploitability("matrix_mp", 0.);
   algorithms::ortools::TestGameValueAndExploitability("kuhn_poker", -1 / 18.);
+  algorithms::ortools::TestWarmStartedResolves();
   algorithms::ortools::TestGameValueAndExploitability("leduc_poker",
                                                       -0.085606424078);
   algorithms::ortools::TestGameValueAndExploitability(
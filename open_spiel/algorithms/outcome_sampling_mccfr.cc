@@ -73,6 +73,26 @@ void OutcomeSamplingMCCFRSolver::RunIteration(std::mt19937* rng) {
   }
 }
 
+void OutcomeSamplingMCCFRSolver::RunBatchedIteration(int batch_size) {
+  SPIEL_CHECK_GE(batch_size, 1);
+  pending_updates_.clear();
+  for (int b = 0; b < batch_size; ++b) {
+    for (Player p = Player{0}; p < game_->NumPlayers(); ++p) {
+      std::unique_ptr<State> state = game_->NewInitialState();
+      SampleEpisode(state.get(), p, &rng_, 1.0, 1.0, 1.0, &pending_updates_);
+    }
+  }
+  // Apply the recorded increments in trajectory order. The entries exist:
+  // sampling inserts default entries for every infostate it visits.
+  for (const PendingUpdate& update : pending_updates_) {
+    CFRInfoStateValues& info_state = info_states_[update.is_key];
+    for (int aidx = 0; aidx < update.regret_increments.size(); ++aidx) {
+      info_state.cumulative_regrets[aidx] += update.regret_increments[aidx];
+      info_state.cumulative_policy[aidx] += update.policy_increments[aidx];
+    }
+  }
+}
+
 std::string OutcomeSamplingMCCFRSolver::Serialize(int double_precision,
                                                   std::string delimiter) const {
   SPIEL_CHECK_GE(double_precision, -1);
@@ -119,17 +139,35 @@ std::vector<double> OutcomeSamplingMCCFRSolver::SamplePolicy(
   return policy;
 }
 
-double OutcomeSamplingMCCFRSolver::Baseline(
-    const State& state, const CFRInfoStateValues& info_state, int aidx) const {
-  // Default to vanilla outcome sampling.
-  return 0;
+double OutcomeSamplingMCCFRSolver::Baseline(const std::string& is_key,
+                                            int aidx) const {
+  // Without the learned baseline this is vanilla outcome sampling.
+  if (!use_baseline_) return 0;
+  const auto iter = baseline_values_.find(is_key);
+  if (iter == baseline_values_.end() || iter->second.counts[aidx] == 0) {
+    return 0;
+  }
+  return iter->second.values[aidx];
+}
+
+void OutcomeSamplingMCCFRSolver::UpdateBaseline(const std::string& is_key,
+                                                int num_actions, int aidx,
+                                                double sampled_value) {
+  BaselineValues& baseline = baseline_values_[is_key];
+  if (baseline.values.empty()) {
+    baseline.values.resize(num_actions, 0);
+    baseline.counts.resize(num_actions, 0);
+  }
+  // Running mean of the sampled values for this action.
+  const int count = ++baseline.counts[aidx];
+  baseline.values[aidx] += (sampled_value - baseline.values[aidx]) / count;
 }
 
 // Applies Eq. 9 of Schmid et al. '19
 double OutcomeSamplingMCCFRSolver::BaselineCorrectedChildValue(
-    const State& state, const CFRInfoStateValues& info_state, int sampled_aidx,
-    int aidx, double child_value, double sample_prob) const {
-  double baseline = Baseline(state, info_state, aidx);
+    const std::string& is_key, int sampled_aidx, int aidx, double child_value,
+    double sample_prob) const {
+  double baseline = Baseline(is_key, aidx);
   if (aidx == sampled_aidx) {
     return baseline + (child_value - baseline) / sample_prob;
   } else {
@@ -139,18 +177,21 @@ double OutcomeSamplingMCCFRSolver::BaselineCorrectedChildValue(
 
 double OutcomeSamplingMCCFRSolver::SampleEpisode(
     State* state, Player update_player, std::mt19937* rng, double my_reach,
-    double opp_reach, double sample_reach) {
+    double opp_reach, double sample_reach,
+    std::vector<PendingUpdate>* pending_updates) {
   if (state->IsTerminal()) {
     return state->PlayerReturn(update_player);
   } else if (state->IsChanceNode()) {
+    ActionsAndProbs scratch;
     std::pair<Action, double> outcome_and_prob =
-        SampleAction(state->ChanceOutcomes(), dist_(*rng));
+        SampleAction(ChanceOutcomesRef(*state, &scratch), dist_(*rng));
     SPIEL_CHECK_PROB(outcome_and_prob.second);
     SPIEL_CHECK_GT(outcome_and_prob.second, 0);
     state->ApplyAction(outcome_and_prob.first);
     return SampleEpisode(state, update_player, rng, my_reach,
                          outcome_and_prob.second * opp_reach,
-                         outcome_and_prob.second * sample_reach);
+                         outcome_and_prob.second * sample_reach,
+                         pending_updates);
   } else if (state->IsSimultaneousNode()) {
     SpielFatalError(
         "Simultaneous moves not supported. Use "
@@ -190,14 +231,19 @@ double OutcomeSamplingMCCFRSolver::SampleEpisode(
       player == update_player
           ? opp_reach
           : opp_reach * info_state_copy.current_policy[sampled_aidx],
-      sample_reach * sample_policy[sampled_aidx]);
+      sample_reach * sample_policy[sampled_aidx], pending_updates);
 
   // Compute each of the child estimated values.
   std::vector<double> child_values(legal_actions.size(), 0);
   for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
-    child_values[aidx] =
-        BaselineCorrectedChildValue(*state, info_state_copy, sampled_aidx, aidx,
-                                    child_value, sample_policy[aidx]);
+    child_values[aidx] = BaselineCorrectedChildValue(
+        is_key, sampled_aidx, aidx, child_value, sample_policy[aidx]);
+  }
+
+  // The baseline must not include the current sample when correcting it, so
+  // it is folded in only after the corrected values are computed.
+  if (use_baseline_) {
+    UpdateBaseline(is_key, legal_actions.size(), sampled_aidx, child_value);
   }
 
   // Compute the value of this history for this policy.
@@ -208,33 +254,54 @@ double OutcomeSamplingMCCFRSolver::SampleEpisode(
   }
 
   if (player == update_player) {
-    // Now the regret and avg strategy updates.
-    CFRInfoStateValues& info_state = info_states_[is_key];
-    info_state.ApplyRegretMatching();
-
     // Estimate for the counterfactual value of the policy.
     double cf_value = value_estimate * opp_reach / sample_reach;
 
-    // Update regrets.
+    // Regret increments.
     //
     // Note: different from Chapter 4 of Lanctot '13 thesis, the utilities
     // coming back from the recursion are already multiplied by the players'
     // tail reaches and divided by the sample tail reach. So when adding regrets
     // to the table, we need only multiply by the opponent reach and divide by
     // the sample reach to this point.
+    std::vector<double> regret_increments(legal_actions.size(), 0);
     for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
       // Estimate for the counterfactual value of the policy replaced by always
       // choosing sampled_aidx at this information state.
       double cf_action_value = child_values[aidx] * opp_reach / sample_reach;
-      info_state.cumulative_regrets[aidx] += (cf_action_value - cf_value);
+      regret_increments[aidx] = (cf_action_value - cf_value);
     }
 
-    // Update the average policy.
-    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
-      double increment =
-          my_reach * info_state.current_policy[aidx] / sample_reach;
-      SPIEL_CHECK_FALSE(std::isnan(increment) || std::isinf(increment));
-      info_state.cumulative_policy[aidx] += increment;
+    if (pending_updates == nullptr) {
+      // Now the regret and avg strategy updates.
+      CFRInfoStateValues& info_state = info_states_[is_key];
+      info_state.ApplyRegretMatching();
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        info_state.cumulative_regrets[aidx] += regret_increments[aidx];
+      }
+
+      // Update the average policy.
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        double increment =
+            my_reach * info_state.current_policy[aidx] / sample_reach;
+        SPIEL_CHECK_FALSE(std::isnan(increment) || std::isinf(increment));
+        info_state.cumulative_policy[aidx] += increment;
+      }
+    } else {
+      // Batched mode: record the increments and apply them when the batch
+      // completes. The average-policy increment uses the (already
+      // regret-matched) policy the trajectory was sampled with, which equals
+      // what the in-place path would compute since no regrets have been
+      // written within the batch.
+      std::vector<double> policy_increments(legal_actions.size(), 0);
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        double increment =
+            my_reach * info_state_copy.current_policy[aidx] / sample_reach;
+        SPIEL_CHECK_FALSE(std::isnan(increment) || std::isinf(increment));
+        policy_increments[aidx] = increment;
+      }
+      pending_updates->push_back({is_key, std::move(regret_increments),
+                                  std::move(policy_increments)});
     }
   }
 
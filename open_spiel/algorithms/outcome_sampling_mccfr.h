@@ -17,8 +17,10 @@
 
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/random/uniform_real_distribution.h"
 #include "open_spiel/algorithms/cfr.h"
 #include "open_spiel/policy.h"
@@ -65,6 +67,21 @@ class OutcomeSamplingMCCFRSolver {
   // Same as above, but uses the specified random number generator instead.
   void RunIteration(std::mt19937* rng);
 
+  // Samples batch_size trajectories per update player before applying any
+  // table updates: the regret and average-policy increments of a batch are
+  // computed against the table state at the start of the batch, collected in
+  // a reused internal buffer, and applied when the batch completes. This
+  // amortizes the per-trajectory table writes and keeps the sampling policy
+  // fixed within a batch; a batch_size of 1 reproduces RunIteration().
+  void RunBatchedIteration(int batch_size);
+
+  // Enables the learned per-(infostate, action) baseline of VR-MCCFR
+  // (Schmid et al. '18): predicted child values are tracked as running means
+  // of the sampled returns and used to reduce the variance of the sampled
+  // counterfactual values. The baseline table is rebuilt from scratch on
+  // resumption; it is not part of the serialized state.
+  void UseBaseline(bool use_baseline) { use_baseline_ = use_baseline; }
+
   CFRInfoStateValuesTable& InfoStateValuesTable() { return info_states_; }
 
   // Computes the average policy, containing the policy for all players.
@@ -85,27 +102,52 @@ class OutcomeSamplingMCCFRSolver {
                         std::string delimiter = "<~>") const;
 
  private:
+  // The increments produced by one infostate visit, recorded during batched
+  // iterations and applied once the batch completes.
+  struct PendingUpdate {
+    std::string is_key;
+    std::vector<double> regret_increments;
+    std::vector<double> policy_increments;
+  };
+
+  // Per-(infostate, action) running means of sampled child values, used as
+  // the baseline when use_baseline_ is set.
+  struct BaselineValues {
+    std::vector<double> values;
+    std::vector<int> counts;
+  };
+
+  // Runs one trajectory. If pending_updates is null, updates are applied to
+  // the table in place; otherwise they are appended to it instead.
   double SampleEpisode(State* state, Player update_player, std::mt19937* rng,
-                       double my_reach, double opp_reach, double sample_reach);
+                       double my_reach, double opp_reach, double sample_reach,
+                       std::vector<PendingUpdate>* pending_updates = nullptr);
   std::vector<double> SamplePolicy(const CFRInfoStateValues& info_state) const;
 
   // The b_i function from  Schmid et al. '19.
-  double Baseline(const State& state, const CFRInfoStateValues& info_state,
-                  int aidx) const;
+  double Baseline(const std::string& is_key, int aidx) const;
 
   // Applies Eq. 9 of Schmid et al. '19
-  double BaselineCorrectedChildValue(const State& state,
-                                     const CFRInfoStateValues& info_state,
+  double BaselineCorrectedChildValue(const std::string& is_key,
                                      int sampled_aidx, int aidx,
                                      double child_value,
                                      double sample_prob) const;
 
+  // Folds the sampled value into the running-mean baseline for the action.
+  void UpdateBaseline(const std::string& is_key, int num_actions, int aidx,
+                      double sampled_value);
+
   std::shared_ptr<const Game> game_;
   double epsilon_;
   CFRInfoStateValuesTable info_states_;
   std::mt19937 rng_;
   absl::uniform_real_distribution<double> dist_;
   std::shared_ptr<Policy> default_policy_;
+  bool use_baseline_ = false;
+  absl::flat_hash_map<std::string, BaselineValues> baseline_values_;
+  // Reused across batches so steady-state batches allocate nothing for the
+  // trajectory records themselves.
+  std::vector<PendingUpdate> pending_updates_;
 };
 
 std::unique_ptr<OutcomeSamplingMCCFRSolver>
@@ -44,6 +44,21 @@ void MCCFR_2PGameTest(const std::string& game_name, std::mt19937* rng,
   SPIEL_CHECK_LE(nash_conv, nashconv_upperbound);
 }
 
+void MCCFR_BatchedIterationsTest(bool use_baseline) {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  OutcomeSamplingMCCFRSolver solver(
+      *game, OutcomeSamplingMCCFRSolver::kDefaultEpsilon, kSeed);
+  solver.UseBaseline(use_baseline);
+  for (int i = 0; i < 200; i++) {
+    solver.RunBatchedIteration(/*batch_size=*/50);
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  double nash_conv = NashConv(*game, *average_policy, true);
+  std::cout << "Kuhn (batched, baseline=" << use_baseline
+            << ") NashConv: " << nash_conv << std::endl;
+  SPIEL_CHECK_LE(nash_conv, 0.17);
+}
+
 void MCCFR_SerializationTest() {
   auto game = LoadGame("kuhn_poker");
   OutcomeSamplingMCCFRSolver solver = OutcomeSamplingMCCFRSolver(*game);
@@ -89,5 +104,7 @@ int main(int argc, char** argv) {
   algorithms::MCCFR_2PGameTest("kuhn_poker", &rng, 10000, 0.17);
   algorithms::MCCFR_2PGameTest("leduc_poker", &rng, 10000, 3.07);
   algorithms::MCCFR_2PGameTest("liars_dice", &rng, 10000, 1.45);
+  algorithms::MCCFR_BatchedIterationsTest(/*use_baseline=*/false);
+  algorithms::MCCFR_BatchedIterationsTest(/*use_baseline=*/true);
   algorithms::MCCFR_SerializationTest();
 }
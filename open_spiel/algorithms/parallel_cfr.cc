@@ -0,0 +1,291 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/parallel_cfr.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/memory/memory.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread_pool.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// One root subtree to be processed by a worker: the state below the root,
+// the reach probabilities at that state, and the probability the root
+// player's (or chance's) policy assigned to the action leading here.
+struct SubtreeItem {
+  std::unique_ptr<State> state;
+  std::vector<double> reach_probabilities;
+  double prob;
+  // Filled in by the worker: the subtree value for each player.
+  std::vector<double> values;
+};
+
+double CounterFactualReachProb(const std::vector<double>& reach_probabilities,
+                               const int player) {
+  double cfr_reach_prob = 1.0;
+  for (int i = 0; i < reach_probabilities.size(); i++) {
+    if (i != player) {
+      cfr_reach_prob *= reach_probabilities[i];
+    }
+  }
+  return cfr_reach_prob;
+}
+
+}  // namespace
+
+ParallelCFRSolver::ParallelCFRSolver(const Game& game, int num_threads,
+                                     bool alternating_updates,
+                                     bool linear_averaging,
+                                     bool regret_matching_plus)
+    : CFRSolverBase(game, alternating_updates, linear_averaging,
+                    regret_matching_plus),
+      num_threads_(num_threads),
+      alternating_updates_(alternating_updates),
+      linear_averaging_(linear_averaging),
+      regret_matching_plus_(regret_matching_plus),
+      chance_player_(game.NumPlayers()) {
+  SPIEL_CHECK_GE(num_threads_, 1);
+  if (num_threads_ > 1) {
+    pool_ = absl::make_unique<ThreadPool>(num_threads_);
+  }
+}
+
+void ParallelCFRSolver::EvaluateAndUpdatePolicy() {
+  if (num_threads_ == 1) {
+    CFRSolverBase::EvaluateAndUpdatePolicy();
+    return;
+  }
+  ++iteration_;
+  if (alternating_updates_) {
+    for (int player = 0; player < game_->NumPlayers(); player++) {
+      RunIteration(player);
+      if (regret_matching_plus_) {
+        for (auto& entry : info_states_) {
+          for (double& regret : entry.second.cumulative_regrets) {
+            if (regret < 0) regret = 0;
+          }
+        }
+      }
+      ApplyRegretMatching();
+    }
+  } else {
+    RunIteration(absl::nullopt);
+    if (regret_matching_plus_) {
+      for (auto& entry : info_states_) {
+        for (double& regret : entry.second.cumulative_regrets) {
+          if (regret < 0) regret = 0;
+        }
+      }
+    }
+    ApplyRegretMatching();
+  }
+}
+
+void ParallelCFRSolver::RunIteration(
+    const absl::optional<int>& alternating_player) {
+  if (root_state_->IsTerminal()) return;
+
+  // Expand the root one level into independent work items.
+  std::vector<SubtreeItem> items;
+  int root_player;
+  std::vector<Action> root_actions;
+  std::vector<double> root_policy;
+  std::string root_info_state;
+  if (root_state_->IsChanceNode()) {
+    root_player = chance_player_;
+    for (const auto& [outcome, prob] : root_state_->ChanceOutcomes()) {
+      root_actions.push_back(outcome);
+      root_policy.push_back(prob);
+    }
+  } else {
+    root_player = root_state_->CurrentPlayer();
+    root_info_state = root_state_->InformationStateString();
+    root_actions = root_state_->LegalActions();
+    root_policy = ReadPolicy(root_info_state, root_actions);
+  }
+  items.reserve(root_actions.size());
+  for (int aidx = 0; aidx < root_actions.size(); ++aidx) {
+    SubtreeItem item;
+    item.state = root_state_->Child(root_actions[aidx]);
+    item.reach_probabilities = root_reach_probs_;
+    item.prob = root_policy[aidx];
+    item.reach_probabilities[root_player] *= item.prob;
+    items.push_back(std::move(item));
+  }
+
+  // Fan the items out to the pool, each worker accumulating into a private
+  // delta table.
+  std::vector<CFRInfoStateValuesTable> worker_deltas(num_threads_);
+  pool_->ParallelFor(
+      0, items.size(),
+      [this, &items, &worker_deltas, &alternating_player](int64_t i) {
+        items[i].values = ComputeRegretsToTable(
+            *items[i].state, alternating_player, items[i].reach_probabilities,
+            &worker_deltas[ThreadPool::CurrentWorkerId()]);
+      });
+  for (const CFRInfoStateValuesTable& deltas : worker_deltas) {
+    MergeDeltas(deltas);
+  }
+
+  // The root itself is walked by no worker; if it is a decision node, apply
+  // its update serially from the collected subtree values.
+  if (root_player == chance_player_) return;
+  if (alternating_player && *alternating_player != root_player) return;
+  std::vector<double> state_value(game_->NumPlayers(), 0.0);
+  for (const SubtreeItem& item : items) {
+    for (int i = 0; i < state_value.size(); ++i) {
+      state_value[i] += item.prob * item.values[i];
+    }
+  }
+  CFRInfoStateValues& is_vals = info_states_[root_info_state];
+  SPIEL_CHECK_FALSE(is_vals.empty());
+  const double self_reach_prob = root_reach_probs_[root_player];
+  const double cfr_reach_prob =
+      CounterFactualReachProb(root_reach_probs_, root_player);
+  for (int aidx = 0; aidx < root_actions.size(); ++aidx) {
+    is_vals.cumulative_regrets[aidx] +=
+        cfr_reach_prob *
+        (items[aidx].values[root_player] - state_value[root_player]);
+    if (linear_averaging_) {
+      is_vals.cumulative_policy[aidx] +=
+          iteration_ * self_reach_prob * root_policy[aidx];
+    } else {
+      is_vals.cumulative_policy[aidx] += self_reach_prob * root_policy[aidx];
+    }
+  }
+}
+
+std::vector<double> ParallelCFRSolver::ComputeRegretsToTable(
+    const State& state, const absl::optional<int>& alternating_player,
+    const std::vector<double>& reach_probabilities,
+    CFRInfoStateValuesTable* deltas) {
+  if (state.IsTerminal()) {
+    return state.Returns();
+  }
+  if (state.IsChanceNode()) {
+    std::vector<double> state_value(game_->NumPlayers(), 0.0);
+    for (const auto& [outcome, prob] : state.ChanceOutcomes()) {
+      std::vector<double> new_reach_probabilities(reach_probabilities);
+      new_reach_probabilities[chance_player_] *= prob;
+      std::vector<double> child_value =
+          ComputeRegretsToTable(*state.Child(outcome), alternating_player,
+                                new_reach_probabilities, deltas);
+      for (int i = 0; i < state_value.size(); ++i) {
+        state_value[i] += prob * child_value[i];
+      }
+    }
+    return state_value;
+  }
+  bool all_zero = true;
+  for (int i = 0; i < game_->NumPlayers(); ++i) {
+    if (reach_probabilities[i] != 0.0) {
+      all_zero = false;
+      break;
+    }
+  }
+  if (all_zero) {
+    // As in the serial solver, this value never impacts the parent.
+    return std::vector<double>(game_->NumPlayers(), 0.0);
+  }
+
+  int current_player = state.CurrentPlayer();
+  std::string info_state = state.InformationStateString();
+  std::vector<Action> legal_actions = state.LegalActions(current_player);
+  std::vector<double> info_state_policy =
+      ReadPolicy(info_state, legal_actions);
+
+  std::vector<double> state_value(game_->NumPlayers(), 0.0);
+  std::vector<double> child_utilities;
+  child_utilities.reserve(legal_actions.size());
+  for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+    const double prob = info_state_policy[aidx];
+    std::vector<double> new_reach_probabilities(reach_probabilities);
+    new_reach_probabilities[current_player] *= prob;
+    std::vector<double> child_value = ComputeRegretsToTable(
+        *state.Child(legal_actions[aidx]), alternating_player,
+        new_reach_probabilities, deltas);
+    for (int i = 0; i < state_value.size(); ++i) {
+      state_value[i] += prob * child_value[i];
+    }
+    child_utilities.push_back(child_value[current_player]);
+  }
+
+  if (!alternating_player || *alternating_player == current_player) {
+    auto it = deltas->find(info_state);
+    if (it == deltas->end()) {
+      // Fresh delta entries start at zero; only the cumulative vectors of
+      // delta entries are meaningful.
+      it = deltas->emplace(info_state, CFRInfoStateValues(legal_actions))
+               .first;
+    }
+    CFRInfoStateValues& delta_vals = it->second;
+    const double self_reach_prob = reach_probabilities[current_player];
+    const double cfr_reach_prob =
+        CounterFactualReachProb(reach_probabilities, current_player);
+    const double policy_weight = linear_averaging_
+                                     ? iteration_ * self_reach_prob
+                                     : self_reach_prob;
+    const double baseline = state_value[current_player];
+    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+      delta_vals.cumulative_regrets[aidx] +=
+          cfr_reach_prob * (child_utilities[aidx] - baseline);
+      delta_vals.cumulative_policy[aidx] +=
+          policy_weight * info_state_policy[aidx];
+    }
+  }
+
+  return state_value;
+}
+
+void ParallelCFRSolver::MergeDeltas(const CFRInfoStateValuesTable& deltas) {
+  for (const auto& [info_state, delta_vals] : deltas) {
+    auto it = info_states_.find(info_state);
+    if (it == info_states_.end()) {
+      it = info_states_
+               .emplace(info_state,
+                        CFRInfoStateValues(delta_vals.legal_actions))
+               .first;
+    }
+    CFRInfoStateValues& is_vals = it->second;
+    for (int aidx = 0; aidx < delta_vals.num_actions(); ++aidx) {
+      is_vals.cumulative_regrets[aidx] += delta_vals.cumulative_regrets[aidx];
+      is_vals.cumulative_policy[aidx] += delta_vals.cumulative_policy[aidx];
+    }
+  }
+}
+
+std::vector<double> ParallelCFRSolver::ReadPolicy(
+    const std::string& info_state,
+    const std::vector<Action>& legal_actions) const {
+  auto it = info_states_.find(info_state);
+  if (it == info_states_.end()) {
+    // The table is fully initialized at construction, so this is not
+    // expected to trigger; if it does, behave like a freshly inserted entry
+    // (uniform policy) without writing to the shared table, which workers
+    // may only read.
+    return std::vector<double>(legal_actions.size(),
+                               1.0 / legal_actions.size());
+  }
+  SPIEL_CHECK_FALSE(it->second.current_policy.empty());
+  return it->second.current_policy;
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,93 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_PARALLEL_CFR_H_
+#define OPEN_SPIEL_ALGORITHMS_PARALLEL_CFR_H_
+
+#include <memory>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread_pool.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// A multithreaded variant of vanilla CFR. The subtrees rooted at the root
+// state's children (the chance outcomes when the root is a chance node, which
+// is the common case for card games) are distributed over a ThreadPool that
+// lives for the lifetime of the solver, so no threads are spawned per
+// iteration.
+// Each worker accumulates regret and average-policy increments into a private
+// CFRInfoStateValuesTable; the private tables are merged into the shared table
+// once all workers have joined, after which regret matching is applied as
+// usual. Because within an iteration the tree walk only *reads* the current
+// policy and only *accumulates* into the cumulative tables, this computes
+// exactly the same update as the serial solver; results can differ from the
+// serial solver only in floating-point summation order.
+//
+// The alternating_updates / linear_averaging / regret_matching_plus flags
+// select the same variants as in CFRSolverBase, so CFR+ is obtained by
+// enabling all three. Like a CFRSolverBase constructed with explicit flags,
+// this solver does not support serialization.
+class ParallelCFRSolver : public CFRSolverBase {
+ public:
+  // Uses the same defaults as CFRSolver (alternating updates, no linear
+  // averaging, plain regret matching). num_threads must be >= 1; with a
+  // single thread this behaves exactly like the serial solver.
+  ParallelCFRSolver(const Game& game, int num_threads,
+                    bool alternating_updates = true,
+                    bool linear_averaging = false,
+                    bool regret_matching_plus = false);
+
+  void EvaluateAndUpdatePolicy() override;
+
+ private:
+  // Runs one tree walk for the given player (or all players if nullopt),
+  // fanning the root subtrees out to num_threads_ workers.
+  void RunIteration(const absl::optional<int>& alternating_player);
+
+  // Serial recursion that accumulates regret and average-policy increments
+  // into `deltas` rather than the shared table. The shared info_states_ is
+  // only read (for the current policy). Returns the state value for each
+  // player, as in CFRSolverBase::ComputeCounterFactualRegret.
+  std::vector<double> ComputeRegretsToTable(
+      const State& state, const absl::optional<int>& alternating_player,
+      const std::vector<double>& reach_probabilities,
+      CFRInfoStateValuesTable* deltas);
+
+  // Adds the accumulated increments to the shared table.
+  void MergeDeltas(const CFRInfoStateValuesTable& deltas);
+
+  // Reads the current policy for this infostate from the shared table,
+  // falling back to uniform for infostates not seen yet.
+  std::vector<double> ReadPolicy(const std::string& info_state,
+                                 const std::vector<Action>& legal_actions)
+      const;
+
+  const int num_threads_;
+  const bool alternating_updates_;
+  const bool linear_averaging_;
+  const bool regret_matching_plus_;
+  const int chance_player_;
+  // Null when num_threads_ == 1 (the serial path is used).
+  std::unique_ptr<ThreadPool> pool_;
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_PARALLEL_CFR_H_
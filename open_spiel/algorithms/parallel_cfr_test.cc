@@ -0,0 +1,86 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/parallel_cfr.h"
+
+#include <memory>
+
+#include "open_spiel/algorithms/expected_returns.h"
+#include "open_spiel/algorithms/tabular_exploitability.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void CheckNashKuhnPoker(const Game& game, const Policy& policy) {
+  const std::vector<double> game_value =
+      ExpectedReturns(*game.NewInitialState(), policy, -1);
+
+  // 1/18 is the Nash value. See https://en.wikipedia.org/wiki/Kuhn_poker
+  constexpr float nash_value = 1.0 / 18.0;
+  constexpr float eps = 1e-3;
+
+  SPIEL_CHECK_EQ(2, game_value.size());
+  SPIEL_CHECK_FLOAT_NEAR((float)game_value[0], -nash_value, eps);
+  SPIEL_CHECK_FLOAT_NEAR((float)game_value[1], nash_value, eps);
+}
+
+void ParallelCFRTest_KuhnPoker(int num_threads) {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  ParallelCFRSolver solver(*game, num_threads);
+  for (int i = 0; i < 300; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  CheckNashKuhnPoker(*game, *average_policy);
+  SPIEL_CHECK_LE(Exploitability(*game, *average_policy), 0.05);
+}
+
+void ParallelCFRPlusTest_KuhnPoker(int num_threads) {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  ParallelCFRSolver solver(*game, num_threads,
+                           /*alternating_updates=*/true,
+                           /*linear_averaging=*/true,
+                           /*regret_matching_plus=*/true);
+  for (int i = 0; i < 200; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  CheckNashKuhnPoker(*game, *average_policy);
+  SPIEL_CHECK_LE(Exploitability(*game, *average_policy), 0.05);
+}
+
+void ParallelCFRTest_SimultaneousUpdates_Leduc() {
+  std::shared_ptr<const Game> game = LoadGame("leduc_poker");
+  ParallelCFRSolver solver(*game, /*num_threads=*/4,
+                           /*alternating_updates=*/false);
+  for (int i = 0; i < 10; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  SPIEL_CHECK_LE(Exploitability(*game, *average_policy), 1.0);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::ParallelCFRTest_KuhnPoker(/*num_threads=*/1);
+  open_spiel::algorithms::ParallelCFRTest_KuhnPoker(/*num_threads=*/4);
+  open_spiel::algorithms::ParallelCFRPlusTest_KuhnPoker(/*num_threads=*/4);
+  open_spiel::algorithms::ParallelCFRTest_SimultaneousUpdates_Leduc();
+}
@@ -15,6 +15,8 @@
 #include "open_spiel/algorithms/policy_iteration.h"
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel_globals.h"
@@ -24,104 +26,130 @@ namespace open_spiel {
 namespace algorithms {
 namespace {
 
-using std::vector;
-
-struct MDPState {
-  std::unique_ptr<State> state;  // The state of the MDP
-  double value;                  // The value of this state
-  absl::flat_hash_map<Action, std::vector<std::pair<std::string, double>>>
-      transitions;  // The transitions from this state, for each action, with
-                    // the correponding probability
-  Action optimal_action;  // The optimal action from this state
+// The game's transition structure in compressed sparse row (CSR) form,
+// extracted once up front. The action entries of state i are
+// action_offsets[i]..action_offsets[i+1], and the successor entries of
+// action entry e are successor_offsets[e]..successor_offsets[e+1]. After
+// extraction, evaluation and improvement sweeps run entirely over these
+// index arrays; no State objects are touched. Rewards live in the values of
+// the (absorbing) terminal states, as utility in these games is terminal.
+struct SparseMDP {
+  // States from the enumeration; successors beyond the depth limit are
+  // appended after these as action-less states with a fixed value of zero.
+  int num_real_states = 0;
+
+  std::vector<std::string> keys;
+  std::vector<int> players;    // Acting player; -1 for terminal states.
+  std::vector<double> values;  // Terminal returns for player 0, else 0.
+
+  std::vector<int> action_offsets;  // Size: num states + 1.
+  std::vector<Action> actions;      // Action label of each action entry.
+
+  std::vector<int> successor_offsets;  // Size: actions.size() + 1.
+  std::vector<int> successor_indices;
+  std::vector<double> successor_probs;
 };
 
-// Adds transitions and transition probability from a given state
-void AddTransition(
-    absl::flat_hash_map<Action, vector<std::pair<std::string, double>>>*
-        transitions,
-    const std::string& key, const std::unique_ptr<State>& state) {
-  for (Action action : state->LegalActions()) {
-    std::unique_ptr<State> next_state = state->Child(action);
-    vector<std::pair<std::string, double>> possibilities;
-    if (next_state->IsChanceNode()) {
-      // For a chance node, record the transition probabilities
-      for (const auto& actionprob : next_state->ChanceOutcomes()) {
-        std::unique_ptr<State> realized_next_state = next_state->Child(action);
-        possibilities.emplace_back(realized_next_state->ToString(),
-                                   actionprob.second);
-      }
-    } else {
-      // A non-chance node is equivalent to transition with probability 1
-      possibilities.emplace_back(next_state->ToString(), 1.0);
-    }
-    (*transitions)[action] = possibilities;
-  }
-}
+SparseMDP BuildSparseMDP(const Game& game, int depth_limit) {
+  std::map<std::string, std::unique_ptr<State>> states =
+      GetAllStates(game, depth_limit, /*include_terminals=*/true,
+                   /*include_chance_states=*/false);
 
-// Initialize transition map and value map
-void InitializeMaps(
-    const std::map<std::string, std::unique_ptr<State>>& states,
-    absl::flat_hash_map<std::string, MDPState>* mdp_state_nodes) {
+  SparseMDP mdp;
+  absl::flat_hash_map<std::string, int> index;
   for (const auto& kv : states) {
-    const std::string& key = kv.first;
+    index[kv.first] = mdp.keys.size();
+    mdp.keys.push_back(kv.first);
     if (kv.second->IsTerminal()) {
+      mdp.players.push_back(-1);
       // For both 1-player and 2-player zero sum games, suffices to look at
       // player 0's utility
-      (*mdp_state_nodes)[key].value = kv.second->PlayerReturn(Player{0});
-      // No action possible from a terminal state.
-      (*mdp_state_nodes)[key].optimal_action = kInvalidAction;
+      mdp.values.push_back(kv.second->PlayerReturn(Player{0}));
     } else {
-      absl::flat_hash_map<Action, std::vector<std::pair<std::string, double>>>&
-          transitions = (*mdp_state_nodes)[key].transitions;
-      AddTransition(&transitions, key, kv.second);
-      (*mdp_state_nodes)[key].value = 0;
-      // Assign any random action as the optimal action, initially.
-      (*mdp_state_nodes)[key].optimal_action = kv.second->LegalActions()[0];
+      mdp.players.push_back(kv.second->CurrentPlayer());
+      mdp.values.push_back(0);
     }
   }
-}
-
-double QValue(const absl::flat_hash_map<std::string, MDPState>& mdp_state_nodes,
-              const std::unique_ptr<State>& state, const Action& action) {
-  if (!mdp_state_nodes.contains(state->ToString()) ||
-      !mdp_state_nodes.at(state->ToString()).transitions.contains(action)) {
-    // This action is not possible from this state.
-    return 0;
+  mdp.num_real_states = mdp.keys.size();
+
+  // Reached only when depth_limit cuts the enumeration off: an unseen
+  // successor behaves as a fixed zero-value state.
+  auto successor_index = [&mdp, &index](const std::string& key) {
+    auto it = index.find(key);
+    if (it != index.end()) return it->second;
+    int idx = mdp.keys.size();
+    index[key] = idx;
+    mdp.keys.push_back(key);
+    mdp.players.push_back(-1);
+    mdp.values.push_back(0);
+    return idx;
+  };
+
+  mdp.action_offsets.push_back(0);
+  mdp.successor_offsets.push_back(0);
+  for (const auto& kv : states) {
+    if (!kv.second->IsTerminal()) {
+      for (Action action : kv.second->LegalActions()) {
+        std::unique_ptr<State> next_state = kv.second->Child(action);
+        if (next_state->IsChanceNode()) {
+          // For a chance node, record the transition probabilities
+          for (const auto& actionprob : next_state->ChanceOutcomes()) {
+            std::unique_ptr<State> realized_next_state =
+                next_state->Child(actionprob.first);
+            mdp.successor_indices.push_back(
+                successor_index(realized_next_state->ToString()));
+            mdp.successor_probs.push_back(actionprob.second);
+          }
+        } else {
+          // A non-chance node is equivalent to transition with probability 1
+          mdp.successor_indices.push_back(
+              successor_index(next_state->ToString()));
+          mdp.successor_probs.push_back(1.0);
+        }
+        mdp.actions.push_back(action);
+        mdp.successor_offsets.push_back(mdp.successor_indices.size());
+      }
+    }
+    mdp.action_offsets.push_back(mdp.actions.size());
   }
+  // Depth-limit phantom states have no actions.
+  mdp.action_offsets.resize(mdp.keys.size() + 1, mdp.actions.size());
+  return mdp;
+}
 
+// The expected value of taking an action entry: a sparse dot product of the
+// entry's transition probabilities with the current values.
+double EntryQValue(const SparseMDP& mdp, int entry) {
+  if (entry < 0) return 0;  // No action is possible from this state.
   double value = 0;
-  const vector<std::pair<std::string, double>>& possibilities =
-      mdp_state_nodes.at(state->ToString()).transitions.at(action);
-  for (const auto& outcome : possibilities) {
-    if (mdp_state_nodes.contains(outcome.first)) {
-      value += outcome.second * mdp_state_nodes.at(outcome.first).value;
-    }
+  for (int s = mdp.successor_offsets[entry];
+       s < mdp.successor_offsets[entry + 1]; ++s) {
+    value += mdp.successor_probs[s] * mdp.values[mdp.successor_indices[s]];
   }
   return value;
 }
 
-// Given a player and a state, gets the best possible action from this state
-Action GetBestAction(
-    const absl::flat_hash_map<std::string, MDPState>& mdp_state_nodes,
-    const std::unique_ptr<State>& state, const Player& player,
-    const double& min_utility, const double& max_utility) {
-  vector<Action> legal_actions = state->LegalActions();
-  Action optimal_action = kInvalidAction;
+// Given a state, gets the best possible action entry from this state
+int GetBestActionEntry(const SparseMDP& mdp, int state, double min_utility,
+                       double max_utility) {
+  int optimal_entry = -1;
 
   // Initialize value to be the minimum utility if current player
   // is the maximizing player (i.e. player 0), and to maximum utility
   // if current player is the minimizing player (i.e. player 1).
-  double value = (player == Player{0}) ? min_utility : max_utility;
-  for (Action action : legal_actions) {
-    double q_val = QValue(mdp_state_nodes, state, action);
-    bool is_best_so_far = (player == Player{0} && q_val >= value) ||
-                          (player == Player{1} && q_val <= value);
+  const bool maximizing = mdp.players[state] == Player{0};
+  double value = maximizing ? min_utility : max_utility;
+  for (int entry = mdp.action_offsets[state];
+       entry < mdp.action_offsets[state + 1]; ++entry) {
+    double q_val = EntryQValue(mdp, entry);
+    bool is_best_so_far =
+        maximizing ? (q_val >= value) : (q_val <= value);
     if (is_best_so_far) {
       value = q_val;
-      optimal_action = action;
+      optimal_entry = entry;
     }
   }
-  return optimal_action;
+  return optimal_entry;
 }
 
 }  // namespace
@@ -141,12 +169,16 @@ absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
   SPIEL_CHECK_EQ(game.GetType().information,
                  GameType::Information::kPerfectInformation);
 
-  std::map<std::string, std::unique_ptr<State>> states =
-      GetAllStates(game, depth_limit, /*include_terminals=*/true,
-                   /*include_chance_states=*/false);
-  absl::flat_hash_map<std::string, MDPState> mdp_state_nodes;
+  SparseMDP mdp = BuildSparseMDP(game, depth_limit);
+  const double min_utility = game.MinUtility();
+  const double max_utility = game.MaxUtility();
 
-  InitializeMaps(states, &mdp_state_nodes);
+  // The current policy: the chosen action entry per state. Start with the
+  // first legal action everywhere.
+  std::vector<int> policy(mdp.num_real_states);
+  for (int i = 0; i < mdp.num_real_states; ++i) {
+    policy[i] = mdp.action_offsets[i];
+  }
 
   bool policy_stable;
   do {
@@ -154,50 +186,35 @@ absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
     double error;
     do {
       error = 0;
-      for (const auto& kv : states) {
-        const std::string& key = kv.first;
-        if (kv.second->IsTerminal()) continue;
+      for (int i = 0; i < mdp.num_real_states; ++i) {
+        if (mdp.players[i] == -1) continue;  // Terminal: value is fixed.
 
         // Evaluate the state value function
-        Action curr_optimal_action = mdp_state_nodes.at(key).optimal_action;
-        double value = QValue(mdp_state_nodes, kv.second, curr_optimal_action);
-
-        double* stored_value = &mdp_state_nodes.at(key).value;
-        error = std::max(std::abs(*stored_value - value), error);
-        *stored_value = value;
+        double value = EntryQValue(mdp, policy[i]);
+        error = std::max(std::abs(mdp.values[i] - value), error);
+        mdp.values[i] = value;
       }
     } while (error > threshold);
 
     // Policy improvement
-    double min_utility = game.MinUtility();
-    double max_utility = game.MaxUtility();
     policy_stable = true;
-    for (const auto& kv : states) {
-      const std::string& key = kv.first;
-      if (kv.second->IsTerminal()) continue;
-
-      Player player = kv.second->CurrentPlayer();
+    for (int i = 0; i < mdp.num_real_states; ++i) {
+      if (mdp.players[i] == -1) continue;
 
       // Choose the action with the highest possible action value function
-      Action curr_optimal_action = GetBestAction(
-          mdp_state_nodes, kv.second, player, min_utility, max_utility);
-
-      double curr_value =
-          QValue(mdp_state_nodes, kv.second, curr_optimal_action);
+      int optimal_entry = GetBestActionEntry(mdp, i, min_utility, max_utility);
+      double curr_value = EntryQValue(mdp, optimal_entry);
 
-      double* stored_value = &mdp_state_nodes.at(key).value;
-      Action* stored_optimal_action = &mdp_state_nodes.at(key).optimal_action;
-      if (std::abs(*stored_value - curr_value) > threshold) {
+      if (std::abs(mdp.values[i] - curr_value) > threshold) {
         policy_stable = false;
-        *stored_optimal_action = curr_optimal_action;
+        policy[i] = optimal_entry;
       }
     }
   } while (!policy_stable);
 
   absl::flat_hash_map<std::string, double> values;
-  for (const auto& kv : states) {
-    std::string state_string = kv.first;
-    values[state_string] = mdp_state_nodes[state_string].value;
+  for (int i = 0; i < mdp.num_real_states; ++i) {
+    values[mdp.keys[i]] = mdp.values[i];
   }
   return values;
 }
@@ -31,7 +31,10 @@ namespace algorithms {
 // Currently works for sequential 1-player or 2-player zero-sum games,
 // with or without chance nodes.
 //
-// Based on the implementation in Sutton & Barto '18.
+// Based on the implementation in Sutton & Barto '18. The game tree is
+// expanded exactly once into a compressed-sparse-row transition model; the
+// evaluation and improvement sweeps are then pure index arithmetic over it,
+// with no State objects involved.
 
 absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
                                                          int depth_limit,
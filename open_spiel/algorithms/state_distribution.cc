@@ -43,13 +43,20 @@ int GetBeliefHistorySize(const HistoryDistribution& beliefs) {
   return belief_history_size;
 }
 
-std::unique_ptr<HistoryDistribution> AdvanceBeliefHistoryOneAction(
-    std::unique_ptr<HistoryDistribution> previous, Action action,
-    Player player_id, const Policy& opponent_policy) {
-  auto dist = absl::make_unique<HistoryDistribution>();
-  for (int i = 0; i < previous->first.size(); ++i) {
-    std::unique_ptr<State>& state = previous->first[i];
-    const double& prob = previous->second[i];
+// Advances the particles in place: surviving states are applied-to directly
+// and compacted toward the front of the same vectors, so no new distribution
+// is allocated. Only opponent decision nodes clone (one child per candidate
+// action); those children are appended after the compacted prefix.
+void AdvanceBeliefHistoryOneAction(HistoryDistribution* dist, Action action,
+                                   Player player_id,
+                                   const Policy& opponent_policy) {
+  std::vector<std::unique_ptr<State>> branched_states;
+  std::vector<double> branched_probs;
+  ActionsAndProbs state_policy;  // Reused across particles.
+  int write = 0;
+  for (int i = 0; i < dist->first.size(); ++i) {
+    std::unique_ptr<State>& state = dist->first[i];
+    const double prob = dist->second[i];
     if (Near(prob, 0.)) continue;
     switch (state->GetType()) {
       case StateType::kChance: {
@@ -65,29 +72,31 @@ std::unique_ptr<HistoryDistribution> AdvanceBeliefHistoryOneAction(
         // impossible, so we set it to zero.
         state->ApplyAction(action);
 
-        dist->first.push_back(std::move(state));
-        dist->second.push_back(prob * std::max(0.0, action_prob));
+        dist->first[write] = std::move(state);
+        dist->second[write] = prob * std::max(0.0, action_prob);
+        ++write;
         break;
       }
       case StateType::kDecision: {
         if (state->CurrentPlayer() == player_id) {
           state->ApplyAction(action);
-          dist->first.push_back(std::move(state));
-          dist->second.push_back(prob);
+          dist->first[write] = std::move(state);
+          dist->second[write] = prob;
+          ++write;
         } else {
           // We have to add all actions as we don't know if the opponent is
           // taking a private or public action.
           // TODO(author1): Add method to open_spiel::State that lets us
           // only loop over the actions that are consistent with a given private
           // action.
-          for (const auto& [candidate, action_prob] :
-               opponent_policy.GetStatePolicy(*state)) {
+          opponent_policy.GetStatePolicy(*state, &state_policy);
+          for (const auto& [candidate, action_prob] : state_policy) {
             if (Near(std::max(0.0, action_prob), 0.0)) continue;
             SPIEL_CHECK_PROB(action_prob);
             std::unique_ptr<State> child = state->Child(candidate);
             if (child->IsTerminal()) continue;
-            dist->first.push_back(std::move(child));
-            dist->second.push_back(prob * action_prob);
+            branched_states.push_back(std::move(child));
+            branched_probs.push_back(prob * action_prob);
           }
         }
         break;
@@ -103,28 +112,52 @@ std::unique_ptr<HistoryDistribution> AdvanceBeliefHistoryOneAction(
                                      ", state: ", state->ToString()));
     }
   }
-  return dist;
+  dist->first.erase(dist->first.begin() + write, dist->first.end());
+  dist->second.erase(dist->second.begin() + write, dist->second.end());
+  for (int i = 0; i < branched_states.size(); ++i) {
+    dist->first.push_back(std::move(branched_states[i]));
+    dist->second.push_back(branched_probs[i]);
+  }
 }
 
-// Filters out all beliefs that do not belong to infostate.
-std::unique_ptr<HistoryDistribution> FilterOutBeliefs(
-    const State& state, std::unique_ptr<HistoryDistribution> dist,
-    int player_id) {
+// Filters out all beliefs that do not belong to infostate, compacting the
+// survivors in place (the vectors keep their capacity).
+void FilterOutBeliefs(const State& state, HistoryDistribution* dist,
+                      int player_id) {
   const std::string infostate = state.InformationStateString(player_id);
-  auto new_dist = absl::make_unique<HistoryDistribution>();
-  std::vector<int> good_indices;
+  int write = 0;
   for (int i = 0; i < dist->first.size(); ++i) {
     if (dist->first[i]->InformationStateString(player_id) == infostate) {
-      good_indices.push_back(i);
+      if (write != i) {
+        dist->first[write] = std::move(dist->first[i]);
+        dist->second[write] = dist->second[i];
+      }
+      ++write;
     }
   }
-  new_dist->first.reserve(good_indices.size());
-  new_dist->second.reserve(good_indices.size());
-  for (int i : good_indices) {
-    new_dist->first.push_back(std::move(dist->first[i]));
-    new_dist->second.push_back(dist->second[i]);
+  dist->first.erase(dist->first.begin() + write, dist->first.end());
+  dist->second.erase(dist->second.begin() + write, dist->second.end());
+}
+
+// Drops particles whose (normalized) weight is below the threshold and
+// renormalizes the rest.
+void PruneBeliefs(HistoryDistribution* dist, double prune_threshold) {
+  int write = 0;
+  for (int i = 0; i < dist->first.size(); ++i) {
+    if (dist->second[i] >= prune_threshold) {
+      if (write != i) {
+        dist->first[write] = std::move(dist->first[i]);
+        dist->second[write] = dist->second[i];
+      }
+      ++write;
+    }
   }
-  return new_dist;
+  if (write == dist->first.size()) return;
+  // A threshold so high that it would drop every particle is ignored.
+  if (write == 0) return;
+  dist->first.erase(dist->first.begin() + write, dist->first.end());
+  dist->second.erase(dist->second.begin() + write, dist->second.end());
+  Normalize(absl::MakeSpan(dist->second));
 }
 
 }  // namespace
@@ -259,7 +292,7 @@ HistoryDistribution GetStateDistribution(const State& state,
 
 std::unique_ptr<HistoryDistribution> UpdateIncrementalStateDistribution(
     const State& state, const Policy& opponent_policy, int player_id,
-    std::unique_ptr<HistoryDistribution> previous) {
+    std::unique_ptr<HistoryDistribution> previous, double prune_threshold) {
   std::unique_ptr<HistoryDistribution> dist;
   if (previous) {
     dist = std::move(previous);
@@ -289,11 +322,11 @@ std::unique_ptr<HistoryDistribution> UpdateIncrementalStateDistribution(
   }
   SPIEL_DCHECK_TRUE(CheckBeliefs(*new_state, *dist, player_id));
   while (belief_history_size < history.size()) {
-    dist = AdvanceBeliefHistoryOneAction(std::move(dist),
-                                         history[belief_history_size].action,
-                                         player_id, opponent_policy);
+    AdvanceBeliefHistoryOneAction(dist.get(),
+                                  history[belief_history_size].action,
+                                  player_id, opponent_policy);
     new_state->ApplyAction(history[belief_history_size].action);
-    dist = FilterOutBeliefs(*new_state, std::move(dist), player_id);
+    FilterOutBeliefs(*new_state, dist.get(), player_id);
     SPIEL_CHECK_FALSE(dist->first.empty());
     if (!new_state->IsChanceNode()) {
       SPIEL_DCHECK_TRUE(CheckBeliefs(*new_state, *dist, player_id));
@@ -304,11 +337,12 @@ std::unique_ptr<HistoryDistribution> UpdateIncrementalStateDistribution(
   }
   SPIEL_CHECK_EQ(belief_history_size, history.size());
   SPIEL_CHECK_EQ(new_state->FullHistory(), state.FullHistory());
-  dist = FilterOutBeliefs(state, std::move(dist), player_id);
+  FilterOutBeliefs(state, dist.get(), player_id);
   SPIEL_CHECK_FALSE(dist->first.empty());
 
   // We only normalize after filtering out invalid infostates.
   Normalize(absl::MakeSpan(dist->second));
+  if (prune_threshold > 0.0) PruneBeliefs(dist.get(), prune_threshold);
 
   SPIEL_DCHECK_TRUE(CheckBeliefs(state, *dist, player_id));
   return dist;
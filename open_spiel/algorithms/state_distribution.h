@@ -57,10 +57,16 @@ std::unique_ptr<open_spiel::HistoryDistribution> CloneBeliefs(
 // previous is empty, calls the non-incremental version. This must be called for
 // each state in order, starting from the first non-chance node, or it will be
 // wrong.
-// Takes ownership of previous.
+// Takes ownership of previous, advances its particles in place (the same
+// vectors are reused across steps, so steady-state updates do not reallocate
+// the distribution) and returns it. If prune_threshold is positive, particles
+// whose normalized weight falls below it are dropped after each update and
+// the remainder renormalized, bounding the particle set in games where
+// near-zero-weight histories would otherwise accumulate.
 std::unique_ptr<HistoryDistribution> UpdateIncrementalStateDistribution(
     const State& state, const Policy& opponent_policy, int player_id,
-    std::unique_ptr<HistoryDistribution> previous);
+    std::unique_ptr<HistoryDistribution> previous,
+    double prune_threshold = 0.0);
 
 std::string PrintBeliefs(const HistoryDistribution& beliefs, int player_id);
 
@@ -229,6 +229,34 @@ void HunlRegressionTest() {
   algorithms::CheckBeliefs(*state, *dist, state->CurrentPlayer());
 }
 
+void LeducPruningTest() {
+  std::shared_ptr<const Game> game = LoadGame("leduc_poker");
+  std::unique_ptr<State> state = game->NewInitialState();
+  UniformPolicy opponent_policy;
+  const int player_id = 1;
+  constexpr double kPruneThreshold = 0.05;
+  std::unique_ptr<HistoryDistribution> dist;
+  for (const Action action : {0, 5, 1, 2, 1, 4}) {
+    if (state->CurrentPlayer() == player_id) {
+      dist = UpdateIncrementalStateDistribution(*state, opponent_policy,
+                                                player_id, std::move(dist),
+                                                kPruneThreshold);
+      algorithms::CheckBeliefs(*state, *dist, player_id);
+    }
+    state->ApplyAction(action);
+  }
+  dist = UpdateIncrementalStateDistribution(*state, opponent_policy, player_id,
+                                            std::move(dist), kPruneThreshold);
+  algorithms::CheckBeliefs(*state, *dist, player_id);
+  // Surviving particles are above the threshold and renormalized.
+  double prob_sum = 0.0;
+  for (const double prob : dist->second) {
+    SPIEL_CHECK_GE(prob, kPruneThreshold);
+    prob_sum += prob;
+  }
+  SPIEL_CHECK_FLOAT_EQ(prob_sum, 1.0);
+}
+
 void GoofspielDistributionTest() {
   std::shared_ptr<const Game> game =
       LoadGame(TurnBasedGoofspielGameString(/*num_cards=*/4));
@@ -260,6 +288,7 @@ int main(int argc, char** argv) {
   algorithms::HunlRegressionTest();
   algorithms::GoofspielDistributionTest();
   algorithms::LeducRegressionTest();
+  algorithms::LeducPruningTest();
   algorithms::LeducRegressionTestPerPlayer(/*player_id=*/0);
   algorithms::LeducRegressionTestPerPlayer(/*player_id=*/1);
 
@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <limits>
+#include <new>
 #include <numeric>
 #include <string>
 #include <utility>
@@ -33,18 +34,53 @@ namespace {
 constexpr double kSolveTolerance = 1e-12;
 }  // namespace
 
-MDPNode::MDPNode(const std::string& node_key)
+MDPNode::MDPNode(int node_key_id)
     : terminal_(false), total_weight_(0), children_(), value_(0),
-      node_key_(node_key) {}
+      node_key_id_(node_key_id) {}
 
 void MDPNode::IncTransitionWeight(Action a, MDPNode *child, double weight) {
   SPIEL_CHECK_TRUE(child != nullptr);
   children_[a][child] += weight;
 }
 
+void MDPNode::ResetWeights() {
+  total_weight_ = 0;
+  for (auto &action_and_children : children_) {
+    for (auto &child_and_weight : action_and_children.second) {
+      child_and_weight.second = 0;
+    }
+  }
+}
+
+MDPNodeArena::~MDPNodeArena() {
+  for (int b = 0; b < blocks_.size(); ++b) {
+    // Allocation is sequential, so every block is full except the last one.
+    int num_nodes =
+        (b + 1 < blocks_.size()) ? kNodesPerBlock : num_in_last_block_;
+    MDPNode *nodes = reinterpret_cast<MDPNode *>(blocks_[b].get());
+    for (int i = 0; i < num_nodes; ++i) {
+      nodes[i].~MDPNode();
+    }
+  }
+}
+
+MDPNode *MDPNodeArena::New(int node_key_id) {
+  if (num_in_last_block_ == kNodesPerBlock) {
+    blocks_.push_back(
+        absl::make_unique<unsigned char[]>(kNodesPerBlock * sizeof(MDPNode)));
+    num_in_last_block_ = 0;
+  }
+  MDPNode *slot = reinterpret_cast<MDPNode *>(blocks_.back().get()) +
+                  num_in_last_block_;
+  ++num_in_last_block_;
+  return new (slot) MDPNode(node_key_id);
+}
+
 MDP::MDP() : terminal_node_uid_(0), num_nonterminal_nodes_(0) {
-  node_map_[kRootKey] = absl::make_unique<MDPNode>(std::string(kRootKey));
-  node_map_[kRootKey]->add_weight(1.0);
+  key_to_id_[kRootKey] = kRootNodeId;
+  node_keys_.push_back(kRootKey);
+  nodes_by_id_.push_back(arena_.New(kRootNodeId));
+  nodes_by_id_[kRootNodeId]->add_weight(1.0);
 }
 
 MDPNode *MDP::CreateTerminalNode(const std::string &node_key) {
@@ -55,26 +91,35 @@ MDPNode *MDP::CreateTerminalNode(const std::string &node_key) {
 }
 
 MDPNode *MDP::LookupOrCreateNode(const std::string &node_key, bool terminal) {
-  const auto &iter = node_map_.find(node_key);
-  if (iter != node_map_.end()) {
-    return iter->second.get();
+  const auto &iter = key_to_id_.find(node_key);
+  if (iter != key_to_id_.end()) {
+    return nodes_by_id_[iter->second];
   } else {
-    MDPNode *new_node = new MDPNode(node_key);
-    node_map_[node_key].reset(new_node);
+    int id = nodes_by_id_.size();
+    key_to_id_[node_key] = id;
+    node_keys_.push_back(node_key);
+    nodes_by_id_.push_back(arena_.New(id));
     if (!terminal) {
       num_nonterminal_nodes_++;
     }
-    return new_node;
+    return nodes_by_id_[id];
   }
 }
 
+void MDP::ResetWeights() {
+  for (MDPNode *node : nodes_by_id_) {
+    node->ResetWeights();
+  }
+  RootNode()->add_weight(1.0);
+}
+
 double MDP::Solve(double tolerance, TabularPolicy *br_policy) {
   double delta = 0;
 
   do {
     delta = 0.0;
-    for (auto &key_and_node : node_map_) {
-      MDPNode *node = key_and_node.second.get();
+    for (int id = 0; id < static_cast<int>(nodes_by_id_.size()); ++id) {
+      MDPNode *node = nodes_by_id_[id];
 
       if (node->terminal()) {
         continue;
@@ -115,12 +160,12 @@ double MDP::Solve(double tolerance, TabularPolicy *br_policy) {
       node->set_value(max_value);
 
       // Set the best response to the maximum-value action, if it's non-null.
-      if (node->node_key() != kRootKey) {
+      if (id != kRootNodeId) {
         ActionsAndProbs br_state_policy;
         for (const auto &[action, child] : node->children()) {
           SetProb(&br_state_policy, action, action == max_action ? 1.0 : 0.0);
         }
-        br_policy->SetStatePolicy(node->node_key(), br_state_policy);
+        br_policy->SetStatePolicy(node_keys_[id], br_state_policy);
       }
     }
   } while (delta > tolerance);
@@ -201,7 +246,7 @@ void TabularBestResponseMDP::BuildMDPs(
 
       if (only_for_player == kInvalidPlayer || only_for_player != player) {
         fixed_state_policies[player] =
-            fixed_policy_.GetStatePolicy(state, player);
+            fixed_policy_->GetStatePolicy(state, player);
       }
     }
 
@@ -263,7 +308,7 @@ void TabularBestResponseMDP::BuildMDPs(
     // Get the fixed policy all the time if building all MDPs, or only at
     // opponent nodes otherwise
     if (only_for_player == kInvalidPlayer || only_for_player != player) {
-        state_policy = fixed_policy_.GetStatePolicy(state);
+        state_policy = fixed_policy_->GetStatePolicy(state);
     }
 
     for (Action action : legal_actions) {
@@ -311,7 +356,7 @@ std::string TabularBestResponseMDP::GetNodeKey(const State &state,
 
 TabularBestResponseMDP::TabularBestResponseMDP(const Game &game,
                                                const Policy &fixed_policy)
-    : game_(game), fixed_policy_(fixed_policy),
+    : game_(game), fixed_policy_(&fixed_policy),
       num_players_(game.NumPlayers()) {}
 
 int TabularBestResponseMDP::TotalNumNonterminals() const {
@@ -333,10 +378,17 @@ int TabularBestResponseMDP::TotalSize() const {
 TabularBestResponseMDPInfo TabularBestResponseMDP::ComputeBestResponses() {
   TabularBestResponseMDPInfo br_info(num_players_);
 
-  // Initialize IS-MDPs for each player, if necessary.
+  // Initialize IS-MDPs for each player, if necessary. Existing MDPs are
+  // reused: the node graph does not depend on the fixed policy, so only the
+  // reach weights need to be reset and re-derived.
   if (mdps_.empty()) {
-    for (Player p = 0; p < num_players_; p++) {
-      mdps_.push_back(absl::make_unique<MDP>());
+    mdps_.resize(num_players_);
+  }
+  for (Player p = 0; p < num_players_; p++) {
+    if (mdps_[p] == nullptr) {
+      mdps_[p] = absl::make_unique<MDP>();
+    } else {
+      mdps_[p]->ResetWeights();
     }
   }
 
@@ -365,7 +417,11 @@ TabularBestResponseMDP::ComputeBestResponse(Player max_player) {
 
   if (mdps_.empty()) {
     mdps_.resize(num_players_);
+  }
+  if (mdps_[max_player] == nullptr) {
     mdps_[max_player] = absl::make_unique<MDP>();
+  } else {
+    mdps_[max_player]->ResetWeights();
   }
 
   std::vector<MDPNode*> parent_nodes(num_players_, nullptr);
@@ -387,7 +443,7 @@ TabularBestResponseMDPInfo TabularBestResponseMDP::NashConv() {
   TabularBestResponseMDPInfo br_info = ComputeBestResponses();
   std::unique_ptr<State> state = game_.NewInitialState();
   br_info.on_policy_values =
-      ExpectedReturns(*state, fixed_policy_,
+      ExpectedReturns(*state, *fixed_policy_,
                       /*depth_limit*/ -1, /*use_infostate_get_policy*/ false);
   for (Player p = 0; p < num_players_; ++p) {
     br_info.deviation_incentives[p] =
@@ -74,12 +74,12 @@ namespace algorithms {
 
 class MDPNode {
  public:
-  explicit MDPNode(const std::string& node_key);
+  explicit MDPNode(int node_key_id);
 
   bool terminal() const { return terminal_; }
   double total_weight() const { return total_weight_; }
   double value() const { return value_; }
-  std::string node_key() const { return node_key_; }
+  int node_key_id() const { return node_key_id_; }
   void set_terminal(bool terminal) { terminal_ = terminal; }
   void add_weight(double weight) { total_weight_ += weight; }
   void set_value(double value) { value_ = value; }
@@ -91,6 +91,11 @@ class MDPNode {
 
   void IncTransitionWeight(Action a, MDPNode* child, double weight);
 
+  // Zeroes the node and transition weights, keeping the children edges and
+  // the current value (which warm-starts the next solve). Used when the same
+  // node graph is re-weighted under a different fixed policy.
+  void ResetWeights();
+
  private:
   bool terminal_;
   double total_weight_;
@@ -98,7 +103,25 @@ class MDPNode {
   // (probability) assigned to the transition (s,a,s').
   absl::flat_hash_map<Action, absl::flat_hash_map<MDPNode*, double>> children_;
   double value_;
-  std::string node_key_;
+  int node_key_id_;  // Interned node key; see MDP below.
+};
+
+// Bump arena for MDPNodes: nodes are placement-constructed into large blocks
+// and destroyed together with the arena, instead of one heap allocation per
+// infostate. Pointers handed out remain stable for the arena's lifetime.
+class MDPNodeArena {
+ public:
+  MDPNodeArena() = default;
+  ~MDPNodeArena();
+  MDPNodeArena(const MDPNodeArena&) = delete;
+  MDPNodeArena& operator=(const MDPNodeArena&) = delete;
+
+  MDPNode* New(int node_key_id);
+
+ private:
+  constexpr static int kNodesPerBlock = 4096;
+  std::vector<std::unique_ptr<unsigned char[]>> blocks_;
+  int num_in_last_block_ = kNodesPerBlock;  // Forces an initial block.
 };
 
 class MDP {
@@ -107,16 +130,28 @@ class MDP {
   MDPNode* CreateTerminalNode(const std::string& node_key);
   MDPNode* LookupOrCreateNode(const std::string& node_key,
                               bool terminal = false);
-  MDPNode* RootNode() { return node_map_[kRootKey].get(); }
+  MDPNode* RootNode() { return nodes_by_id_[kRootNodeId]; }
+
+  // Zeroes every node and transition weight, keeping the interned keys, the
+  // node graph, and the current values. Called before re-building the weights
+  // under a different fixed policy.
+  void ResetWeights();
 
   double Solve(double tolerance, TabularPolicy* br_policy);
   int NumNonTerminalNodes() const { return num_nonterminal_nodes_; }
-  int TotalSize() const { return node_map_.size(); }
+  int TotalSize() const { return nodes_by_id_.size(); }
 
  private:
   constexpr static const char* kRootKey = "**&!@ INFOSET_MDP ROOT KEY";
   constexpr static const char* kTerminalKeyPrefix = "**&!@ ISMDP TERMINAL KEY";
-  absl::flat_hash_map<std::string, std::unique_ptr<MDPNode>> node_map_;
+  constexpr static int kRootNodeId = 0;
+
+  // Node keys are interned: each key string is assigned a dense integer id on
+  // first lookup, and all bookkeeping past that point is by id.
+  absl::flat_hash_map<std::string, int> key_to_id_;
+  std::vector<std::string> node_keys_;  // id -> key.
+  std::vector<MDPNode*> nodes_by_id_;   // id -> node; owned by arena_.
+  MDPNodeArena arena_;
   int terminal_node_uid_;
   int num_nonterminal_nodes_;
   int num_terminal_nodes_;
@@ -142,6 +177,13 @@ class TabularBestResponseMDP {
  public:
   TabularBestResponseMDP(const Game& game, const Policy& fixed_policy);
 
+  // Replaces the fixed policy being responded to. The IS-MDP node graph and
+  // interned keys built by previous computations are kept; only the reach
+  // weights depend on the policy, and they are re-derived on the next
+  // computation. Intended for evaluation loops that call e.g. NashConv
+  // repeatedly on the policies of an ongoing solver run.
+  void SetPolicy(const Policy& fixed_policy) { fixed_policy_ = &fixed_policy; }
+
   // Compute best responses for all players.
   TabularBestResponseMDPInfo ComputeBestResponses();
 
@@ -175,7 +217,7 @@ class TabularBestResponseMDP {
 
   std::vector<std::unique_ptr<MDP>> mdps_;
   const Game &game_;
-  const Policy &fixed_policy_;
+  const Policy *fixed_policy_;
   const int num_players_;
 };
 
@@ -156,6 +156,32 @@ void OshiZumoGameTests() {
   SPIEL_CHECK_FLOAT_NEAR(br_info2.nash_conv, 2.0, kFloatTolerance);
 }
 
+void ReuseAcrossPoliciesTests() {
+  // A single TabularBestResponseMDP instance evaluated against several
+  // policies via SetPolicy must agree with fresh instances.
+  UniformPolicy uniform_policy;
+  FirstActionPolicy first_action_policy;
+
+  for (std::string game_string :
+       {"kuhn_poker", "tic_tac_toe", "goofspiel(num_cards=3)"}) {
+    std::shared_ptr<const Game> game = LoadGame(game_string);
+    TabularBestResponseMDP tbr(*game, uniform_policy);
+    double uniform_nash_conv = tbr.NashConv().nash_conv;
+    int total_size = tbr.TotalSize();
+
+    tbr.SetPolicy(first_action_policy);
+    TabularBestResponseMDP fresh(*game, first_action_policy);
+    SPIEL_CHECK_FLOAT_NEAR(tbr.NashConv().nash_conv,
+                           fresh.NashConv().nash_conv, kFloatTolerance);
+    // The node graph is policy-independent, so reuse must not grow it.
+    SPIEL_CHECK_EQ(tbr.TotalSize(), total_size);
+
+    tbr.SetPolicy(uniform_policy);
+    SPIEL_CHECK_FLOAT_NEAR(tbr.NashConv().nash_conv, uniform_nash_conv,
+                           kFloatTolerance);
+  }
+}
+
 void ImperfectRecallLiarsDiceGameTests() {
   std::shared_ptr<const Game> ir_game = LoadGame("liars_dice_ir");
   std::shared_ptr<const Game> pr_game = LoadGame("liars_dice");
@@ -211,5 +237,6 @@ int main(int argc, char **argv) {
   open_spiel::algorithms::RPSGameTests();
   open_spiel::algorithms::OshiZumoGameTests();
   open_spiel::algorithms::GoofspielGameTests();
+  open_spiel::algorithms::ReuseAcrossPoliciesTests();
   open_spiel::algorithms::ImperfectRecallLiarsDiceGameTests();
 }
@@ -17,15 +17,39 @@
 #include <cmath>
 #include <limits>
 #include <unordered_set>
+#include <vector>
 
 #include "open_spiel/algorithms/best_response.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
+namespace {
+
+// Builds a best response per player and computes the root values, one player
+// per thread. The policy is only read, but concurrently.
+std::vector<double> ConcurrentBestResponseValues(const Game& game,
+                                                 const Policy& policy) {
+  std::vector<double> values(game.NumPlayers(), 0);
+  std::vector<Thread> threads;
+  threads.reserve(game.NumPlayers());
+  for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
+    threads.emplace_back([&game, &policy, &values, p]() {
+      TabularBestResponse best_response(game, p, &policy);
+      values[p] = best_response.Value(*game.NewInitialState());
+    });
+  }
+  for (Thread& t : threads) {
+    t.join();
+  }
+  return values;
+}
+
+}  // namespace
 
 double Exploitability(const Game& game, const Policy& policy) {
   GameType game_type = game.GetType();
@@ -37,11 +61,10 @@ double Exploitability(const Game& game, const Policy& policy) {
     SpielFatalError("The game must have zero- or constant-sum utility.");
   }
 
-  std::unique_ptr<State> root = game.NewInitialState();
+  std::vector<double> values = ConcurrentBestResponseValues(game, policy);
   double nash_conv = 0;
   for (auto i = Player{0}; i < game.NumPlayers(); ++i) {
-    TabularBestResponse best_response(game, i, &policy);
-    nash_conv += best_response.Value(*root);
+    nash_conv += values[i];
   }
   return (nash_conv - *game.UtilitySum()) / game.NumPlayers();
 }
@@ -65,11 +88,8 @@ double NashConv(const Game& game, const Policy& policy,
   }
 
   std::unique_ptr<State> root = game.NewInitialState();
-  std::vector<double> best_response_values(game.NumPlayers());
-  for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
-    TabularBestResponse best_response(game, p, &policy);
-    best_response_values[p] = best_response.Value(*root);
-  }
+  std::vector<double> best_response_values =
+      ConcurrentBestResponseValues(game, policy);
   std::vector<double> on_policy_values =
       ExpectedReturns(*root, policy, -1, !use_state_get_policy);
   SPIEL_CHECK_EQ(best_response_values.size(), on_policy_values.size());
@@ -95,5 +115,78 @@ double NashConv(
   return NashConv(game, tabular_policy);
 }
 
+ExploitabilityEvaluator::ExploitabilityEvaluator(const Game& game)
+    : game_(game.shared_from_this()),
+      uniform_policy_(GetUniformPolicy(game)) {
+  best_responses_.reserve(game.NumPlayers());
+  for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
+    best_responses_.emplace_back(game, p, &uniform_policy_);
+  }
+}
+
+std::vector<double> ExploitabilityEvaluator::BestResponseValues(
+    const Policy& policy) {
+  std::vector<double> values(best_responses_.size(), 0);
+  std::vector<Thread> threads;
+  threads.reserve(best_responses_.size());
+  for (int p = 0; p < static_cast<int>(best_responses_.size()); ++p) {
+    threads.emplace_back([this, &policy, &values, p]() {
+      // SetPolicy only invalidates the part of the tree where the policy
+      // differs from the previous call, so Value recomputes just that part.
+      best_responses_[p].SetPolicy(&policy);
+      values[p] = best_responses_[p].Value(*game_->NewInitialState());
+    });
+  }
+  for (Thread& t : threads) {
+    t.join();
+  }
+  return values;
+}
+
+double ExploitabilityEvaluator::Exploitability(const Policy& policy) {
+  GameType game_type = game_->GetType();
+  if (game_type.dynamics != GameType::Dynamics::kSequential) {
+    SpielFatalError("The game must be turn-based.");
+  }
+  if (game_type.utility != GameType::Utility::kZeroSum &&
+      game_type.utility != GameType::Utility::kConstantSum) {
+    SpielFatalError("The game must have zero- or constant-sum utility.");
+  }
+
+  std::vector<double> values = BestResponseValues(policy);
+  double nash_conv = 0;
+  for (double value : values) {
+    nash_conv += value;
+  }
+  return (nash_conv - *game_->UtilitySum()) / game_->NumPlayers();
+}
+
+double ExploitabilityEvaluator::NashConv(const Policy& policy,
+                                         bool use_state_get_policy) {
+  GameType game_type = game_->GetType();
+  if (game_type.dynamics != GameType::Dynamics::kSequential) {
+    SpielFatalError("The game must be turn-based.");
+  }
+
+  std::unique_ptr<State> root = game_->NewInitialState();
+  std::vector<double> best_response_values = BestResponseValues(policy);
+  std::vector<double> on_policy_values =
+      ExpectedReturns(*root, policy, -1, !use_state_get_policy);
+  SPIEL_CHECK_EQ(best_response_values.size(), on_policy_values.size());
+  double nash_conv = 0;
+  for (auto p = Player{0}; p < game_->NumPlayers(); ++p) {
+    double deviation_incentive = best_response_values[p] - on_policy_values[p];
+    if (deviation_incentive < -FloatingPointDefaultTolerance()) {
+      SpielFatalError(
+          absl::StrCat("Negative Nash deviation incentive for player ", p, ": ",
+                       deviation_incentive, ". Does you game have imperfect ",
+                       "recall, or does State::ToString() not distinguish ",
+                       "between unique states?"));
+    }
+    nash_conv += deviation_incentive;
+  }
+  return nash_conv;
+}
+
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -17,7 +17,9 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open_spiel/algorithms/best_response.h"
 #include "open_spiel/algorithms/history_tree.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
@@ -62,6 +64,39 @@ double NashConv(const Game& game, const Policy& policy);
 double NashConv(const Game& game,
                 const std::unordered_map<std::string, ActionsAndProbs>& policy);
 
+// The functions above compute the per-player best responses on separate
+// threads, so the policy must be safe for concurrent reads (tabular policies
+// are; so is anything whose GetStatePolicy is a pure function of its
+// arguments).
+//
+// For evaluating a sequence of policies for the same game (e.g. training
+// checkpoints), this class keeps the per-player best-response structures --
+// the history tree and infosets -- alive between calls, and SetPolicy only
+// re-evaluates the part of the tree the new policy actually changed, so each
+// evaluation after the first costs roughly proportional to how much the
+// policy moved. The policy passed to each call only needs to live for the
+// duration of that call.
+class ExploitabilityEvaluator {
+ public:
+  explicit ExploitabilityEvaluator(const Game& game);
+
+  // As Exploitability(game, policy) above.
+  double Exploitability(const Policy& policy);
+
+  // As NashConv(game, policy, use_state_get_policy) above.
+  double NashConv(const Policy& policy, bool use_state_get_policy = false);
+
+ private:
+  // Computes each player's best-response value concurrently.
+  std::vector<double> BestResponseValues(const Policy& policy);
+
+  std::shared_ptr<const Game> game_;
+  // Placeholder the best responses are constructed against; every call
+  // replaces it via SetPolicy.
+  TabularPolicy uniform_policy_;
+  std::vector<TabularBestResponse> best_responses_;
+};
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
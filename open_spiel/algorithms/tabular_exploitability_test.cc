@@ -457,6 +457,29 @@ void TestNashConv(const std::string& game_name,
   }
 }
 
+void TestExploitabilityEvaluator() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  ExploitabilityEvaluator evaluator(*game);
+
+  // Repeated evaluations of different policies must match the free
+  // functions, even though the evaluator reuses its best-response
+  // structures and only re-evaluates what each policy change affected.
+  TabularPolicy uniform_policy = GetUniformPolicy(*game);
+  SPIEL_CHECK_TRUE(Near(evaluator.Exploitability(uniform_policy),
+                        Exploitability(*game, uniform_policy)));
+  SPIEL_CHECK_TRUE(Near(evaluator.NashConv(uniform_policy),
+                        NashConv(*game, uniform_policy)));
+
+  TabularPolicy optimal_policy =
+      kuhn_poker::GetOptimalPolicy(/*alpha=*/0.2);
+  SPIEL_CHECK_TRUE(Near(evaluator.Exploitability(optimal_policy), 0.));
+  SPIEL_CHECK_TRUE(Near(evaluator.NashConv(optimal_policy), 0.));
+
+  // And back again.
+  SPIEL_CHECK_TRUE(Near(evaluator.Exploitability(uniform_policy),
+                        Exploitability(*game, uniform_policy)));
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -497,4 +520,7 @@ int main(int argc, char** argv) {
                                        open_spiel::GetFirstActionPolicy, 2.);
   open_spiel::algorithms::TestNashConv("leduc_poker",
                                        open_spiel::GetFirstActionPolicy, 2.);
+
+  // Streaming evaluation across several policies for the same game.
+  open_spiel::algorithms::TestExploitabilityEvaluator();
 }
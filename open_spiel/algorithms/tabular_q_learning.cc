@@ -15,7 +15,11 @@
 #include "open_spiel/algorithms/tabular_q_learning.h"
 
 #include <algorithm>
+#include <cmath>
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
@@ -28,16 +32,33 @@ namespace algorithms {
 
 using std::vector;
 
+int TabularQLearningSolver::StateIndex(const std::string& state_str) {
+  const auto [iter, inserted] =
+      state_index_.emplace(state_str, state_index_.size());
+  if (inserted) {
+    q_values_.resize(state_index_.size() * num_actions_, 0.0);
+    if (lambda_ != 0) {
+      eligibility_traces_.resize(state_index_.size() * num_actions_, 0.0);
+    }
+  }
+  return iter->second;
+}
+
 Action TabularQLearningSolver::GetBestAction(const State& state,
                                              double min_utility) {
   vector<Action> legal_actions = state.LegalActions();
   SPIEL_CHECK_GT(legal_actions.size(), 0);
-  const auto state_str = state.ToString();
+  return GetBestAction(StateIndex(state.ToString()), legal_actions,
+                       min_utility);
+}
 
+Action TabularQLearningSolver::GetBestAction(
+    int state_index, const std::vector<Action>& legal_actions,
+    double min_utility) {
   Action best_action = legal_actions[0];
   double value = min_utility;
   for (const Action& action : legal_actions) {
-    double q_val = values_[{state_str, action}];
+    double q_val = QValue(state_index, action);
     if (q_val >= value) {
       value = q_val;
       best_action = action;
@@ -52,7 +73,9 @@ double TabularQLearningSolver::GetBestActionValue(const State& state,
     // q(s,a) is 0 when s is terminal.
     return 0;
   }
-  return values_[{state.ToString(), GetBestAction(state, min_utility)}];
+  const int state_index = StateIndex(state.ToString());
+  return QValue(state_index,
+                GetBestAction(state_index, state.LegalActions(), min_utility));
 }
 
 std::pair<Action, bool>
@@ -86,7 +109,8 @@ TabularQLearningSolver::TabularQLearningSolver(std::shared_ptr<const Game> game)
       epsilon_(kDefaultEpsilon),
       learning_rate_(kDefaultLearningRate),
       discount_factor_(kDefaultDiscountFactor),
-      lambda_(kDefaultLambda) {
+      lambda_(kDefaultLambda),
+      num_actions_(game->NumDistinctActions()) {
   SPIEL_CHECK_LE(lambda_, 1);
   SPIEL_CHECK_GE(lambda_, 0);
 
@@ -111,7 +135,8 @@ TabularQLearningSolver::TabularQLearningSolver(
       epsilon_(epsilon),
       learning_rate_(learning_rate),
       discount_factor_(discount_factor),
-      lambda_(lambda) {
+      lambda_(lambda),
+      num_actions_(game->NumDistinctActions()) {
   SPIEL_CHECK_LE(lambda_, 1);
   SPIEL_CHECK_GE(lambda_, 0);
 
@@ -128,9 +153,16 @@ TabularQLearningSolver::TabularQLearningSolver(
                  GameType::Information::kPerfectInformation);
 }
 
-const absl::flat_hash_map<std::pair<std::string, Action>, double>&
+absl::flat_hash_map<std::pair<std::string, Action>, double>
 TabularQLearningSolver::GetQValueTable() const {
-  return values_;
+  absl::flat_hash_map<std::pair<std::string, Action>, double> values;
+  for (const auto& [state_str, index] : state_index_) {
+    for (Action action = 0; action < num_actions_; ++action) {
+      const double q_value = q_values_[index * num_actions_ + action];
+      if (q_value != 0) values[{state_str, action}] = q_value;
+    }
+  }
+  return values;
 }
 
 void TabularQLearningSolver::RunIteration() {
@@ -157,33 +189,44 @@ void TabularQLearningSolver::RunIteration() {
         GetBestActionValue(*next_state, min_utility);
 
     // Update the q value
-    std::string key = curr_state->ToString();
+    const int curr_index = StateIndex(curr_state->ToString());
     double new_q_value = reward + discount_factor_ * next_q_value;
 
-    double prev_q_val = values_[{key, curr_action}];
+    double prev_q_val = QValue(curr_index, curr_action);
     if (lambda_ == 0) {
       // If lambda_ is equal to zero run Q-learning as usual.
       // It's not necessary to update eligibility traces.
-      values_[{key, curr_action}] +=
+      QValue(curr_index, curr_action) +=
           learning_rate_ * (new_q_value - prev_q_val);
     } else {
       double lambda =
           player != next_state->CurrentPlayer() ? -lambda_ : lambda_;
-      eligibility_traces_[{key, curr_action}] += 1;
-
-      for (const auto& q_cell : values_) {
-        std::string state = q_cell.first.first;
-        Action action = q_cell.first.second;
-
-        values_[{state, action}] += learning_rate_ *
-                                    (new_q_value - prev_q_val) *
-                                    eligibility_traces_[{state, action}];
+      const size_t curr_cell = curr_index * num_actions_ + curr_action;
+      if (eligibility_traces_[curr_cell] == 0) {
+        active_trace_cells_.push_back(curr_cell);
+      }
+      eligibility_traces_[curr_cell] += 1;
+
+      // Only cells with a live trace can change; sweep the active set and
+      // compact it in place, dropping traces that decayed below the cutoff.
+      const double update = learning_rate_ * (new_q_value - prev_q_val);
+      const double decay = discount_factor_ * lambda;
+      size_t kept = 0;
+      for (const size_t cell : active_trace_cells_) {
+        double& trace = eligibility_traces_[cell];
+        q_values_[cell] += update * trace;
         if (chosen_uniformly) {
-          eligibility_traces_[{state, action}] = 0;
-        } else {
-          eligibility_traces_[{state, action}] *= discount_factor_ * lambda;
+          trace = 0;
+          continue;
+        }
+        trace *= decay;
+        if (std::abs(trace) < kTraceCutoff) {
+          trace = 0;
+          continue;
         }
+        active_trace_cells_[kept++] = cell;
       }
+      active_trace_cells_.resize(kept);
     }
 
     curr_state = std::move(next_state);
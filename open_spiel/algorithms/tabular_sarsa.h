@@ -16,6 +16,8 @@
 #define OPEN_SPIEL_ALGORITHMS_TABULAR_SARSA_H_
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
@@ -43,6 +45,13 @@ namespace algorithms {
 // method (+1 at each iteration) instead of "replace" implementation
 // (doesn't sum trace values). Parameter lambda_ determines the level
 // of bootstraping.
+//
+// Traces are tracked sparsely: only cells visited recently enough that
+// their trace is still at least kTraceCutoff take part in the per-step
+// sweep, so a SARSA(lambda) step costs O(active trace cells) rather than
+// O(table). Cells whose trace decays below the cutoff stop receiving
+// updates; their remaining contribution is below the cutoff per step and
+// is deliberately dropped.
 
 class TabularSarsaSolver {
   static inline constexpr double kDefaultDepthLimit = -1;
@@ -50,6 +59,8 @@ class TabularSarsaSolver {
   static inline constexpr double kDefaultLearningRate = 0.01;
   static inline constexpr double kDefaultDiscountFactor = 0.99;
   static inline constexpr double kDefaultLambda = 0;
+  // Traces below this magnitude are dropped from the active set.
+  static inline constexpr double kTraceCutoff = 1e-8;
 
  public:
   TabularSarsaSolver(std::shared_ptr<const Game> game);
@@ -60,12 +71,28 @@ class TabularSarsaSolver {
 
   void RunIteration();
 
-  const absl::flat_hash_map<std::pair<std::string, Action>, double>&
-  GetQValueTable() const;
+  // A string-keyed view of the Q-table, materialized from the flat internal
+  // storage. Zero-valued cells are omitted; absent keys read as zero, which
+  // matches the behavior of the previous map-backed table.
+  absl::flat_hash_map<std::pair<std::string, Action>, double> GetQValueTable()
+      const;
 
  private:
+  // Returns the integer index of the state, assigning the next free index on
+  // first touch (and growing the flat tables). Indices are stable for the
+  // lifetime of the solver, so they are reused across RunIteration calls.
+  // This is the only place an episode step hashes the state string; all
+  // Q-value accesses are then flat-array reads.
+  int StateIndex(const std::string& state_str);
+
+  double& QValue(int state_index, Action action) {
+    return q_values_[state_index * num_actions_ + action];
+  }
+
   // Given a player and a state, gets the best possible action from this state
   Action GetBestAction(const State& state, double min_utility);
+  Action GetBestAction(int state_index, const std::vector<Action>& legal_actions,
+                       double min_utility);
 
   // Given a player and a state, gets the action, sampled from an epsilon-greedy
   // policy
@@ -83,9 +110,16 @@ class TabularSarsaSolver {
   double discount_factor_;
   double lambda_;
   std::mt19937 rng_;
-  absl::flat_hash_map<std::pair<std::string, Action>, double> values_;
-  absl::flat_hash_map<std::pair<std::string, Action>, double>
-      eligibility_traces_;
+  // First-touch state indexing backing the flat Q-table: row = state index,
+  // column = action. The eligibility traces share the layout and are only
+  // allocated when lambda is nonzero.
+  int num_actions_;
+  absl::flat_hash_map<std::string, int> state_index_;
+  std::vector<double> q_values_;
+  std::vector<double> eligibility_traces_;
+  // Cells with a nonzero trace, in visit order; compacted in place as
+  // traces decay below kTraceCutoff.
+  std::vector<size_t> active_trace_cells_;
 };
 
 }  // namespace algorithms
@@ -17,13 +17,17 @@
 #include <algorithm>
 #include <chrono>  // NOLINT
 #include <cstdint>
+#include <memory>
 #include <random>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -67,14 +71,14 @@ void BatchedTrajectory::MoveTrajectory(int index,
   actions[index] = std::move(trajectory->actions[0]);
   player_policies[index] = std::move(trajectory->player_policies[0]);
   player_ids[index] = std::move(trajectory->player_ids[0]);
-  rewards[index] = trajectory->rewards[0];
+  rewards[index] = std::move(trajectory->rewards[0]);
   next_is_terminal[index] = std::move(trajectory->next_is_terminal[0]);
   valid[index] = std::move(trajectory->valid[0]);
 }
 
 // Pads fields to make sure that they're all the same shape, i.e. [B, T, N],
 // where N = the size of each field.
-void BatchedTrajectory::ResizeFields(int length) {
+void BatchedTrajectory::ResizeFields(int length, int num_threads) {
   if (length > 0) {
     SPIEL_CHECK_GE(length, max_trajectory_length);
     // We adjust max_trajectory_length as it's no longer correct.
@@ -83,31 +87,48 @@ void BatchedTrajectory::ResizeFields(int length) {
   // Only works for batches with at least one trajectory as otherwise we can't
   // infer the field size.
   SPIEL_CHECK_GT(batch_size, 0);
-  // TODO(author1): Replace this with a multi-threaded version.
-  for (int i = 0; i < batch_size; ++i) {
-    // Each field has shape [B, T, field_size], where N is a parameter that is
-    // fixed for each (game, field) pair. We thus have to get the size of N from
-    // the existing vectors.
-    if (!observations[0].empty()) {
-      observations[i].resize(max_trajectory_length,
-                             std::vector<float>(observations[0][0].size(), 0));
+  // Each field has shape [B, T, field_size], where field_size is fixed for
+  // each (game, field) pair, so we get it from the existing vectors. These
+  // sizes are read by every worker below; hoist them out so the workers only
+  // write to their own batch entries.
+  const uint64_t observation_size =
+      observations[0].empty() ? 0 : observations[0][0].size();
+  const uint64_t mask_size = legal_actions[0][0].size();
+  auto pad_range = [this, observation_size, mask_size](int start, int end) {
+    for (int i = start; i < end; ++i) {
+      if (observation_size > 0) {
+        observations[i].resize(max_trajectory_length,
+                               std::vector<float>(observation_size, 0));
+      }
+      state_indices[i].resize(max_trajectory_length, 0);
+      legal_actions[i].resize(max_trajectory_length,
+                              std::vector<int>(mask_size, 1));
+
+      // Actions has shape [B, T, 1]
+      actions[i].resize(max_trajectory_length, 0);
+
+      // legal_actions has shape [B, T, num_distinct_actions], while
+      // player_policies[0][0].size() <= num_distinct_actions.
+      player_policies[i].resize(max_trajectory_length,
+                                std::vector<double>(mask_size, 1));
+      player_ids[i].resize(max_trajectory_length, 0);
+      next_is_terminal[i].resize(max_trajectory_length, false);
+      valid[i].resize(max_trajectory_length, false);
     }
-    state_indices[i].resize(max_trajectory_length, 0);
-    legal_actions[i].resize(max_trajectory_length,
-                            std::vector<int>(legal_actions[0][0].size(), 1));
-
-    // Actions has shape [B, T, 1]
-    actions[i].resize(max_trajectory_length, 0);
-
-    // legal_actions has shape [B, T, num_distinct_actions], while
-    // player_policies[0][0].size() <= num_distinct_actions.
-    player_policies[i].resize(
-        max_trajectory_length,
-        std::vector<double>(legal_actions[0][0].size(), 1));
-    player_ids[i].resize(max_trajectory_length, 0);
-    next_is_terminal[i].resize(max_trajectory_length, false);
-    valid[i].resize(max_trajectory_length, false);
+  };
+  num_threads = std::min(num_threads, batch_size);
+  if (num_threads <= 1) {
+    pad_range(0, batch_size);
+    return;
   }
+  std::vector<Thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    const int start = t * batch_size / num_threads;
+    const int end = (t + 1) * batch_size / num_threads;
+    threads.emplace_back([&pad_range, start, end]() { pad_range(start, end); });
+  }
+  for (Thread& thread : threads) thread.join();
 }
 
 BatchedTrajectory RecordBatchedTrajectory(
@@ -119,7 +140,8 @@ BatchedTrajectory RecordBatchedTrajectory(
   SPIEL_CHECK_GT(batch_size, 0);
   if (state_to_index.empty()) SPIEL_CHECK_TRUE(include_full_observations);
   BatchedTrajectory batched_trajectory(batch_size);
-  // TODO(author1): Replace this with a multi-threaded version.
+  // Single-threaded; see RecordBatchedTrajectoryParallel for the
+  // multi-threaded driver.
   for (int i = 0; i < batch_size; ++i) {
     BatchedTrajectory trajectory =
         RecordTrajectory(game, policies, initial_state, state_to_index,
@@ -140,6 +162,19 @@ BatchedTrajectory RecordTrajectory(
   BatchedTrajectory trajectory(/*batch_size=*/1);
   std::unique_ptr<open_spiel::State> state = initial_state.Clone();
   bool find_index = !state_to_index.empty();
+  // The episode cannot have more than MaxGameLength decision nodes, so
+  // reserving that up front means the per-step push_backs below never
+  // reallocate.
+  const int max_length = game.MaxGameLength();
+  trajectory.legal_actions[0].reserve(max_length);
+  trajectory.actions[0].reserve(max_length);
+  trajectory.player_policies[0].reserve(max_length);
+  trajectory.player_ids[0].reserve(max_length);
+  if (find_index) {
+    trajectory.state_indices[0].reserve(max_length);
+  } else {
+    trajectory.observations[0].reserve(max_length);
+  }
   while (!state->IsTerminal()) {
     Action action = kInvalidAction;
     if (state->IsChanceNode()) {
@@ -178,7 +213,7 @@ BatchedTrajectory RecordTrajectory(
       for (const std::pair<Action, double>& pair : policy) {
         probs[pair.first] = pair.second;
       }
-      trajectory.player_policies[0].push_back(probs);
+      trajectory.player_policies[0].push_back(std::move(probs));
       trajectory.player_ids[0].push_back(state->CurrentPlayer());
       action = SampleAction(policy, *rng).first;
       trajectory.actions[0].push_back(action);
@@ -220,6 +255,47 @@ BatchedTrajectory RecordBatchedTrajectory(
                                  max_unroll_length);
 }
 
+BatchedTrajectory RecordBatchedTrajectoryParallel(
+    const Game& game, const std::vector<TabularPolicy>& policies,
+    const std::unordered_map<std::string, int>& state_to_index, int batch_size,
+    bool include_full_observations, int seed, int max_unroll_length,
+    int num_threads) {
+  SPIEL_CHECK_GT(batch_size, 0);
+  SPIEL_CHECK_GE(num_threads, 1);
+  if (state_to_index.empty()) SPIEL_CHECK_TRUE(include_full_observations);
+  BatchedTrajectory batched_trajectory(batch_size);
+  BatchedTrajectory* result = &batched_trajectory;
+  // MoveTrajectory writes to disjoint batch entries across workers, but also
+  // updates the shared max_trajectory_length; the mutex guards that update
+  // (once per episode, so contention is negligible).
+  absl::Mutex mutex;
+  num_threads = std::min(num_threads, batch_size);
+  std::vector<Thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    const int start = t * batch_size / num_threads;
+    const int end = (t + 1) * batch_size / num_threads;
+    threads.emplace_back([&game, &policies, &state_to_index, result, &mutex,
+                          include_full_observations, seed, start, end]() {
+      std::unique_ptr<State> root = game.NewInitialState();
+      for (int i = start; i < end; ++i) {
+        // Each batch slot gets its own generator seeded with seed + i, so the
+        // recorded batch is the same regardless of num_threads.
+        std::mt19937 rng(seed + i);
+        BatchedTrajectory trajectory =
+            RecordTrajectory(game, policies, *root, state_to_index,
+                             include_full_observations, &rng);
+        SPIEL_CHECK_FALSE(trajectory.rewards[0].empty());
+        absl::MutexLock lock(&mutex);
+        result->MoveTrajectory(i, &trajectory);
+      }
+    });
+  }
+  for (Thread& thread : threads) thread.join();
+  batched_trajectory.ResizeFields(max_unroll_length, num_threads);
+  return batched_trajectory;
+}
+
 BatchedTrajectory RecordTrajectory(
     const Game& game, const std::vector<TabularPolicy>& policies,
     const std::unordered_map<std::string, int>& state_to_index,
@@ -42,8 +42,10 @@ struct BatchedTrajectory {
 
   // Pads fields to make sure that they're all the same shape, i.e. [B, T, N],
   // where N = the size of each field. If size is -1, i.e. the default, then
-  // we resize to the max trajectory length in the batch.
-  void ResizeFields(int length = -1);
+  // we resize to the max trajectory length in the batch. Batch entries are
+  // independent, so with num_threads > 1 the padding is split over that many
+  // worker threads.
+  void ResizeFields(int length = -1, int num_threads = 1);
 
   int batch_size;
 
@@ -107,6 +109,16 @@ BatchedTrajectory RecordBatchedTrajectory(
     const std::unordered_map<std::string, int>& state_to_index, int batch_size,
     bool include_full_observations, int seed, int max_unroll_length = -1);
 
+// As RecordBatchedTrajectory, but records the batch on num_threads worker
+// threads. Batch slot i always uses its own generator seeded with seed + i,
+// so the result is identical for every num_threads (including 1) and does not
+// depend on thread scheduling.
+BatchedTrajectory RecordBatchedTrajectoryParallel(
+    const Game& game, const std::vector<TabularPolicy>& policies,
+    const std::unordered_map<std::string, int>& state_to_index, int batch_size,
+    bool include_full_observations, int seed, int max_unroll_length,
+    int num_threads);
+
 // Stateful version of RecordTrajectory. There are several optimisations that
 // this allows. Currently, the only optimisation is preventing making multiple
 // copies of the state_to_index class. When state_to_index.empty() is false,
@@ -253,6 +253,36 @@ void BatchedTrajectoryResizesCorrectly(const std::string& game_name) {
   }
 }
 
+void RecordBatchedTrajectoryParallelIsDeterministic(
+    const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  const std::vector<TabularPolicy> policies(2, GetUniformPolicy(*game));
+  std::unordered_map<std::string, int> states_to_indices =
+      GetStatesToIndices(*game);
+  constexpr int kSeed = 1234;
+  BatchedTrajectory serial = RecordBatchedTrajectoryParallel(
+      *game, policies, states_to_indices, kBatchSize,
+      /*include_full_observations=*/false, kSeed,
+      /*max_unroll_length=*/game->MaxGameLength(), /*num_threads=*/1);
+  BatchedTrajectory parallel = RecordBatchedTrajectoryParallel(
+      *game, policies, states_to_indices, kBatchSize,
+      /*include_full_observations=*/false, kSeed,
+      /*max_unroll_length=*/game->MaxGameLength(), /*num_threads=*/4);
+  // Per-slot seeding makes the result independent of the thread count.
+  SPIEL_CHECK_EQ(serial.max_trajectory_length, parallel.max_trajectory_length);
+  SPIEL_CHECK_TRUE(serial.state_indices == parallel.state_indices);
+  SPIEL_CHECK_TRUE(serial.legal_actions == parallel.legal_actions);
+  SPIEL_CHECK_TRUE(serial.actions == parallel.actions);
+  SPIEL_CHECK_TRUE(serial.player_policies == parallel.player_policies);
+  SPIEL_CHECK_TRUE(serial.player_ids == parallel.player_ids);
+  SPIEL_CHECK_TRUE(serial.rewards == parallel.rewards);
+  SPIEL_CHECK_TRUE(serial.valid == parallel.valid);
+  SPIEL_CHECK_TRUE(serial.next_is_terminal == parallel.next_is_terminal);
+  for (int b = 0; b < parallel.batch_size; ++b) {
+    SPIEL_CHECK_EQ(parallel.actions[b].size(), game->MaxGameLength());
+  }
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -276,5 +306,6 @@ int main() {
     alg::RecordBatchedTrajectoryPlayerIdsIsCorrect(game_name);
     alg::RecordBatchedTrajectoryNextIsTerminalIsCorrect(game_name);
     alg::BatchedTrajectoryResizesCorrectly(game_name);
+    alg::RecordBatchedTrajectoryParallelIsDeterministic(game_name);
   }
 }
@@ -0,0 +1,198 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/tree_walk.h"
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/utils/thread_pool.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// A set of strings sharded by key hash so concurrent inserters only contend
+// when they hit the same shard.
+class ShardedStringSet {
+ public:
+  // Returns true if the key was newly inserted, false if already present.
+  bool Insert(const std::string& key) {
+    Shard& shard = shards_[absl::Hash<std::string>{}(key) % kNumShards];
+    absl::MutexLock lock(&shard.m);
+    return shard.set.insert(key).second;
+  }
+
+ private:
+  static constexpr int kNumShards = 16;
+  struct Shard {
+    absl::Mutex m;
+    absl::flat_hash_set<std::string> set;
+  };
+  Shard shards_[kNumShards];
+};
+
+struct SubtreeRoot {
+  std::unique_ptr<State> state;
+  int depth;
+};
+
+// Calls the visitor unless dedup filters the state out. Keys are only
+// computed (and recorded) when dedup is enabled. Returns false if a
+// duplicate should also end the descent.
+bool VisitIfNew(const State& state, int depth, const TreeWalkConfig& config,
+                ShardedStringSet* seen, const TreeWalkVisitor& visitor) {
+  static const std::string kNoKey;
+  if (config.dedup == TreeWalkDedup::kNone) {
+    visitor(kNoKey, state, depth);
+    return true;
+  }
+  std::string key = state.ToString();
+  if (seen->Insert(key)) {
+    visitor(key, state, depth);
+    return true;
+  }
+  return config.dedup != TreeWalkDedup::kStopAtDuplicates;
+}
+
+// Visits the state if the config keeps it, and returns whether its children
+// should be explored.
+bool Visit(const State& state, int depth, const TreeWalkConfig& config,
+           ShardedStringSet* seen, const TreeWalkVisitor& visitor) {
+  if (state.IsTerminal()) {
+    if (config.include_terminals) {
+      VisitIfNew(state, depth, config, seen, visitor);
+    }
+    return false;
+  }
+
+  if (config.depth_limit >= 0 && depth > config.depth_limit) {
+    return false;
+  }
+
+  if (!state.IsChanceNode() || config.include_chance_states) {
+    return VisitIfNew(state, depth, config, seen, visitor);
+  }
+  return true;
+}
+
+// Serial preorder recursion. Takes ownership of the state so the parent can
+// be applied in place for its last child instead of cloned; with branching
+// factor b this saves one clone in b.
+void WalkRecursive(std::unique_ptr<State> state, int depth,
+                   const TreeWalkConfig& config, ShardedStringSet* seen,
+                   const TreeWalkVisitor& visitor) {
+  if (!Visit(*state, depth, config, seen, visitor)) {
+    return;
+  }
+  std::vector<Action> actions = state->LegalActions();
+  for (int i = 0; i < static_cast<int>(actions.size()); ++i) {
+    if (i + 1 < static_cast<int>(actions.size())) {
+      std::unique_ptr<State> child = state->Clone();
+      child->ApplyAction(actions[i]);
+      WalkRecursive(std::move(child), depth + 1, config, seen, visitor);
+    } else {
+      // The parent is not needed below here: descend into the last child in
+      // place.
+      state->ApplyAction(actions[i]);
+      WalkRecursive(std::move(state), depth + 1, config, seen, visitor);
+    }
+  }
+}
+
+// Iterative DFS over the subtree rooted at root, with the same in-place
+// descent for the last child.
+void WalkSubtree(SubtreeRoot root, const TreeWalkConfig& config,
+                 ShardedStringSet* seen, const TreeWalkVisitor& visitor) {
+  std::vector<SubtreeRoot> stack;
+  stack.push_back(std::move(root));
+  while (!stack.empty()) {
+    SubtreeRoot item = std::move(stack.back());
+    stack.pop_back();
+    if (!Visit(*item.state, item.depth, config, seen, visitor)) {
+      continue;
+    }
+    std::vector<Action> actions = item.state->LegalActions();
+    for (int i = 0; i < static_cast<int>(actions.size()); ++i) {
+      if (i + 1 < static_cast<int>(actions.size())) {
+        std::unique_ptr<State> child = item.state->Clone();
+        child->ApplyAction(actions[i]);
+        stack.push_back(SubtreeRoot{std::move(child), item.depth + 1});
+      } else {
+        item.state->ApplyAction(actions[i]);
+        stack.push_back(SubtreeRoot{std::move(item.state), item.depth + 1});
+      }
+    }
+  }
+}
+
+void ParallelWalk(const Game& game, const TreeWalkVisitor& visitor,
+                  const TreeWalkConfig& config, ShardedStringSet* seen) {
+  // Expand the first plies serially, breadth first, until there are enough
+  // unvisited subtree roots to keep the workers busy.
+  const int target_frontier_size = config.num_threads * 16;
+  std::deque<SubtreeRoot> frontier;
+  frontier.push_back(SubtreeRoot{game.NewInitialState(), 0});
+  while (!frontier.empty() &&
+         static_cast<int>(frontier.size()) < target_frontier_size) {
+    SubtreeRoot item = std::move(frontier.front());
+    frontier.pop_front();
+    if (!Visit(*item.state, item.depth, config, seen, visitor)) {
+      continue;
+    }
+    for (Action action : item.state->LegalActions()) {
+      std::unique_ptr<State> next_state = item.state->Clone();
+      next_state->ApplyAction(action);
+      frontier.push_back(SubtreeRoot{std::move(next_state), item.depth + 1});
+    }
+  }
+
+  // One task per subtree root; the pool's work stealing balances large and
+  // small subtrees dynamically.
+  ThreadPool pool(config.num_threads);
+  std::vector<std::future<void>> futures;
+  futures.reserve(frontier.size());
+  for (SubtreeRoot& root : frontier) {
+    // The shared_ptr makes the task copyable, as std::function requires.
+    auto shared_root = std::make_shared<SubtreeRoot>(std::move(root));
+    futures.push_back(pool.Submit([shared_root, &config, seen, &visitor]() {
+      WalkSubtree(std::move(*shared_root), config, seen, visitor);
+    }));
+  }
+  for (std::future<void>& future : futures) {
+    future.get();
+  }
+}
+
+}  // namespace
+
+void TreeWalk(const Game& game, const TreeWalkVisitor& visitor,
+              const TreeWalkConfig& config) {
+  ShardedStringSet seen;
+  if (config.num_threads > 1) {
+    ParallelWalk(game, visitor, config, &seen);
+  } else {
+    WalkRecursive(game.NewInitialState(), 0, config, &seen, visitor);
+  }
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
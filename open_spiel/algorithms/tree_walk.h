@@ -0,0 +1,73 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_TREE_WALK_H_
+#define OPEN_SPIEL_ALGORITHMS_TREE_WALK_H_
+
+#include <functional>
+#include <string>
+
+#include "open_spiel/spiel.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// How repeated states are treated during a walk. States are keyed by their
+// ToString(); with kNone no keys are computed at all.
+enum class TreeWalkDedup {
+  kNone,              // Visit every history.
+  kVisitOnce,         // Visit the first occurrence only, but still expand
+                      // duplicates (their subtrees may contain new states).
+  kStopAtDuplicates,  // Visit the first occurrence only and prune duplicates.
+};
+
+struct TreeWalkConfig {
+  // Maximum depth to descend below the root; negative means no limit.
+  // Terminal states one past the limit are still visited, as the walk only
+  // cuts off below non-terminal states.
+  int depth_limit = -1;
+  // Whether the visitor sees terminal states.
+  bool include_terminals = true;
+  // Whether the visitor sees chance states. Chance states are always
+  // traversed through; this only controls visiting (and dedup, which applies
+  // to visited states only).
+  bool include_chance_states = true;
+  TreeWalkDedup dedup = TreeWalkDedup::kNone;
+  // With more than one thread, the first plies are expanded serially and the
+  // resulting subtrees are walked on a work-stealing ThreadPool.
+  int num_threads = 1;
+};
+
+// Called once per visited state. `key` is the state's ToString() when dedup
+// is enabled, and empty otherwise (recompute it if needed; the walk has not
+// paid for it). The state is only valid for the duration of the call; clone
+// it if it needs to outlive the visit. Must be thread-safe when walking with
+// more than one thread.
+using TreeWalkVisitor =
+    std::function<void(const std::string& key, const State& state, int depth)>;
+
+// Walks the game tree depth first, visiting every history (subject to the
+// config) exactly once. This is the traversal engine under GetAllStates,
+// ForAllStates and their consumers; tabular algorithms that enumerate the
+// tree should use it rather than hand-rolling the clone-and-descend
+// recursion. Visiting order is the serial preorder with one thread and
+// unspecified otherwise. All valid action sequences must be finite.
+// Currently not implemented for simultaneous games.
+void TreeWalk(const Game& game, const TreeWalkVisitor& visitor,
+              const TreeWalkConfig& config);
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_TREE_WALK_H_
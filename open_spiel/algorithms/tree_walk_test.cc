@@ -0,0 +1,101 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/tree_walk.h"
+
+#include <atomic>
+#include <set>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// With dedup the visitor sees each distinct state once; tic-tac-toe has a
+// known number of distinct states.
+void TestDedupCountsDistinctStates() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  TreeWalkConfig config;
+  config.dedup = TreeWalkDedup::kVisitOnce;
+  std::set<std::string> seen;
+  TreeWalk(*game,
+           [&seen](const std::string& key, const State& state, int depth) {
+             SPIEL_CHECK_FALSE(key.empty());
+             SPIEL_CHECK_EQ(key, state.ToString());
+             SPIEL_CHECK_TRUE(seen.insert(key).second);
+           },
+           config);
+  SPIEL_CHECK_EQ(seen.size(), tic_tac_toe::kNumberStates);
+}
+
+// The parallel walk visits exactly the same set of states as the serial one.
+void TestParallelMatchesSerial() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  TreeWalkConfig config;
+  config.dedup = TreeWalkDedup::kStopAtDuplicates;
+
+  std::set<std::string> serial;
+  TreeWalk(*game,
+           [&serial](const std::string& key, const State& state, int depth) {
+             serial.insert(key);
+           },
+           config);
+
+  config.num_threads = 4;
+  absl::Mutex mutex;
+  std::set<std::string> parallel;
+  TreeWalk(*game,
+           [&parallel, &mutex](const std::string& key, const State& state,
+                               int depth) {
+             absl::MutexLock lock(&mutex);
+             parallel.insert(key);
+           },
+           config);
+
+  SPIEL_CHECK_TRUE(serial == parallel);
+}
+
+// Without dedup every history is visited, with no key computed; the depth
+// limit cuts off below non-terminal states.
+void TestDepthLimitAndHistories() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  TreeWalkConfig config;
+  config.depth_limit = 1;
+  int num_visited = 0;
+  TreeWalk(*game,
+           [&num_visited](const std::string& key, const State& state,
+                          int depth) {
+             SPIEL_CHECK_TRUE(key.empty());
+             SPIEL_CHECK_LE(depth, 1);
+             ++num_visited;
+           },
+           config);
+  // The empty board plus the 9 opening moves.
+  SPIEL_CHECK_EQ(num_visited, 10);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::TestDedupCountsDistinctStates();
+  open_spiel::algorithms::TestParallelMatchesSerial();
+  open_spiel::algorithms::TestDepthLimitAndHistories();
+}
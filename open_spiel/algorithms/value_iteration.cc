@@ -15,8 +15,13 @@
 #include "open_spiel/algorithms/value_iteration.h"
 
 #include <algorithm>
+#include <queue>
+#include <utility>
+#include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -68,6 +73,122 @@ void InitializeMaps(const map<std::string, state_pointer>& states,
   }
 }
 
+// An index-based copy of the game's transition structure, so that sweeps can
+// run over integer indices and contiguous value arrays instead of string
+// keyed maps and State objects.
+struct CompactModel {
+  std::vector<std::string> keys;
+  // Acting player per state; -1 for terminal states.
+  std::vector<int> players;
+  // Initial values: the player 0 return for terminal states, 0 otherwise.
+  std::vector<double> values;
+  // successors[i][a] lists (successor index, probability) for the a'th legal
+  // action of state i; empty for terminal states.
+  std::vector<std::vector<std::vector<std::pair<int, double>>>> successors;
+};
+
+void CheckValueIterationPreconditions(const Game& game) {
+  // Currently only supports 1-player or 2-player zero sum games
+  SPIEL_CHECK_TRUE(game.NumPlayers() == 1 || game.NumPlayers() == 2);
+  if (game.NumPlayers() == 2) {
+    SPIEL_CHECK_EQ(game.GetType().utility, GameType::Utility::kZeroSum);
+  }
+
+  // No support for simultaneous games (needs an LP solver). And so also must
+  // be a perfect information game.
+  SPIEL_CHECK_EQ(game.GetType().dynamics, GameType::Dynamics::kSequential);
+  SPIEL_CHECK_EQ(game.GetType().information,
+                 GameType::Information::kPerfectInformation);
+}
+
+CompactModel BuildCompactModel(const Game& game, int depth_limit) {
+  auto states = GetAllStates(game, depth_limit, /*include_terminals=*/true,
+                             /*include_chance_states=*/false,
+                             /*stop_at_duplicates*/ true);
+  CompactModel model;
+  absl::flat_hash_map<std::string, int> index;
+  for (const auto& kv : states) {
+    index[kv.first] = model.keys.size();
+    model.keys.push_back(kv.first);
+    if (kv.second->IsTerminal()) {
+      model.players.push_back(-1);
+      // For both 1-player and 2-player zero sum games, suffices to look at
+      // player 0's utility
+      model.values.push_back(kv.second->PlayerReturn(Player{0}));
+    } else {
+      model.players.push_back(kv.second->CurrentPlayer());
+      model.values.push_back(0);
+    }
+  }
+  model.successors.resize(model.keys.size());
+
+  // Reached only when depth_limit cuts the enumeration off: an unseen
+  // successor behaves as a fixed zero-value state, as in the map-based sweep.
+  auto successor_index = [&model, &index](const std::string& key) {
+    auto it = index.find(key);
+    if (it != index.end()) return it->second;
+    int idx = model.keys.size();
+    index[key] = idx;
+    model.keys.push_back(key);
+    model.players.push_back(-1);
+    model.values.push_back(0);
+    model.successors.emplace_back();
+    return idx;
+  };
+
+  for (const auto& kv : states) {
+    if (kv.second->IsTerminal()) continue;
+    int state = index[kv.first];
+    for (Action action : kv.second->LegalActions()) {
+      auto next_state = kv.second->Clone();
+      next_state->ApplyAction(action);
+      std::vector<std::pair<int, double>> possibilities;
+      if (next_state->IsChanceNode()) {
+        // For a chance node, record the transition probabilities
+        for (const auto& actionprob : next_state->ChanceOutcomes()) {
+          auto realized_next_state = next_state->Clone();
+          realized_next_state->ApplyAction(actionprob.first);
+          possibilities.emplace_back(
+              successor_index(realized_next_state->ToString()),
+              actionprob.second);
+        }
+      } else {
+        // A non-chance node is equivalent to transition with probability 1
+        possibilities.emplace_back(successor_index(next_state->ToString()),
+                                   1.0);
+      }
+      model.successors[state].push_back(std::move(possibilities));
+    }
+  }
+  return model;
+}
+
+// One Bellman backup of a non-terminal state, reading from values.
+double Backup(const CompactModel& model, const std::vector<double>& values,
+              int state, double min_utility, double max_utility) {
+  // Player 0 is maximizing the value (which is w.r.t. player 0), player 1 is
+  // minimizing it.
+  const bool maximizing = model.players[state] == 0;
+  double value = maximizing ? min_utility : max_utility;
+  for (const auto& possibilities : model.successors[state]) {
+    double q_value = 0;
+    for (const auto& [successor, prob] : possibilities) {
+      q_value += prob * values[successor];
+    }
+    value = maximizing ? std::max(value, q_value) : std::min(value, q_value);
+  }
+  return value;
+}
+
+std::map<std::string, double> ValuesToMap(const CompactModel& model,
+                                          const std::vector<double>& values) {
+  std::map<std::string, double> result;
+  for (int i = 0; i < static_cast<int>(model.keys.size()); ++i) {
+    result[model.keys[i]] = values[i];
+  }
+  return result;
+}
+
 }  // namespace
 
 std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
@@ -134,5 +255,107 @@ std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
   return values;
 }
 
+std::map<std::string, double> ValueIterationParallel(const Game& game,
+                                                     int depth_limit,
+                                                     double threshold,
+                                                     int num_threads) {
+  CheckValueIterationPreconditions(game);
+  num_threads = std::max(1, num_threads);
+
+  CompactModel model = BuildCompactModel(game, depth_limit);
+  const int num_states = model.keys.size();
+  const double min_utility = game.MinUtility();
+  const double max_utility = game.MaxUtility();
+
+  std::vector<double> values = model.values;
+  std::vector<double> next_values = model.values;
+  std::vector<double> errors(num_threads, 0);
+  double error;
+  do {
+    std::vector<Thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&, t]() {
+        // Contiguous block of states per worker; every backup in this sweep
+        // reads the previous sweep's values, so the blocks are independent.
+        const int begin = static_cast<int64_t>(num_states) * t / num_threads;
+        const int end =
+            static_cast<int64_t>(num_states) * (t + 1) / num_threads;
+        double max_error = 0;
+        for (int i = begin; i < end; ++i) {
+          if (model.players[i] == -1) continue;  // Terminal: value is fixed.
+          double value = Backup(model, values, i, min_utility, max_utility);
+          max_error = std::max(max_error, std::abs(values[i] - value));
+          next_values[i] = value;
+        }
+        errors[t] = max_error;
+      });
+    }
+    for (Thread& thread : threads) {
+      thread.join();
+    }
+    std::swap(values, next_values);
+    error = *std::max_element(errors.begin(), errors.end());
+  } while (error > threshold);
+
+  return ValuesToMap(model, values);
+}
+
+std::map<std::string, double> ValueIterationPrioritized(const Game& game,
+                                                        int depth_limit,
+                                                        double threshold) {
+  CheckValueIterationPreconditions(game);
+
+  CompactModel model = BuildCompactModel(game, depth_limit);
+  const int num_states = model.keys.size();
+  const double min_utility = game.MinUtility();
+  const double max_utility = game.MaxUtility();
+
+  // Predecessor lists, so an update can be propagated to exactly the states
+  // whose backups read the updated value.
+  std::vector<std::vector<int>> predecessors(num_states);
+  for (int i = 0; i < num_states; ++i) {
+    for (const auto& possibilities : model.successors[i]) {
+      for (const auto& [successor, prob] : possibilities) {
+        predecessors[successor].push_back(i);
+      }
+    }
+  }
+  for (std::vector<int>& preds : predecessors) {
+    std::sort(preds.begin(), preds.end());
+    preds.erase(std::unique(preds.begin(), preds.end()), preds.end());
+  }
+
+  std::vector<double> values = model.values;
+
+  // Max-heap of (Bellman residual, state). Entries go stale when a state is
+  // pushed again with a newer residual; stale entries are skipped when
+  // popped by recomputing the residual.
+  std::priority_queue<std::pair<double, int>> heap;
+  for (int i = 0; i < num_states; ++i) {
+    if (model.players[i] == -1) continue;
+    double residual =
+        std::abs(Backup(model, values, i, min_utility, max_utility) -
+                 values[i]);
+    if (residual > threshold) heap.push({residual, i});
+  }
+
+  while (!heap.empty()) {
+    int state = heap.top().second;
+    heap.pop();
+    double value = Backup(model, values, state, min_utility, max_utility);
+    if (std::abs(value - values[state]) <= threshold) continue;  // Stale.
+    values[state] = value;
+    for (int pred : predecessors[state]) {
+      double residual =
+          std::abs(Backup(model, values, pred, min_utility, max_utility) -
+                   values[pred]);
+      if (residual > threshold) heap.push({residual, pred});
+    }
+  }
+
+  return ValuesToMap(model, values);
+}
+
 }  // namespace algorithms
 }  // namespace open_spiel
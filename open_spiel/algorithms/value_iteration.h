@@ -33,6 +33,26 @@ namespace algorithms {
 std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
                                              double threshold);
 
+// As ValueIteration, but each sweep is partitioned across num_threads
+// workers over double-buffered values (a Jacobi sweep: every update in a
+// pass reads only the previous pass's values, where the serial version
+// updates in place). Converges to the same fixed point; the sequence of
+// intermediate values differs.
+std::map<std::string, double> ValueIterationParallel(const Game& game,
+                                                     int depth_limit,
+                                                     double threshold,
+                                                     int num_threads);
+
+// As ValueIteration, but instead of full sweeps, states are updated one at a
+// time in order of their Bellman residual (largest first, via a max-heap),
+// and each update re-enqueues the predecessors it may have affected, until
+// no residual exceeds threshold. For games with long horizons where a sweep
+// touches mostly-converged states, this does far fewer updates per unit of
+// progress.
+std::map<std::string, double> ValueIterationPrioritized(const Game& game,
+                                                        int depth_limit,
+                                                        double threshold);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
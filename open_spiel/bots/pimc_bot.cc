@@ -14,6 +14,8 @@
 
 #include "open_spiel/bots/pimc_bot.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -22,22 +24,30 @@
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/algorithms/maxn.h"
 #include "open_spiel/algorithms/minimax.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 
 PIMCBot::PIMCBot(
     std::function<double(const State&, Player player)> value_function,
-    Player player_id, uint32_t seed, int num_determinizations, int depth_limit)
+    Player player_id, uint32_t seed, int num_determinizations, int depth_limit,
+    int num_threads, absl::Duration time_budget)
     : rng_(seed),
       value_function_(value_function),
       player_id_(player_id),
       num_determinizations_(num_determinizations),
-      depth_limit_(depth_limit) {}
+      depth_limit_(depth_limit),
+      num_threads_(num_threads),
+      time_budget_(time_budget) {
+  SPIEL_CHECK_GE(num_threads, 1);
+}
 
 Action PIMCBot::Step(const State& state) {
   std::pair<std::vector<int>, Action> search_result = Search(state);
@@ -68,6 +78,28 @@ ActionsAndProbs PIMCBot::PolicyFromBestAction(const State& state,
   return actions_and_probs;
 }
 
+Action PIMCBot::SearchOne(const GameType& type, Player player,
+                          State* state) const {
+  if (type.utility == GameType::Utility::kZeroSum &&
+      type.chance_mode == GameType::ChanceMode::kDeterministic &&
+      state->NumPlayers() == 2) {
+    // Special case for two-player zero-sum deterministic games: use
+    // alpha-beta.
+    std::pair<double, Action> search_result = algorithms::AlphaBetaSearch(
+        *state->GetGame(), state,
+        [this, player](const State& state) {
+          return this->value_function_(state, player);
+        },
+        depth_limit_, player, /*use_undo*/ false);
+    return search_result.second;
+  } else {
+    std::pair<std::vector<double>, Action> search_result =
+        algorithms::MaxNSearch(*state->GetGame(), state, value_function_,
+                               depth_limit_);
+    return search_result.second;
+  }
+}
+
 std::pair<std::vector<int>, Action> PIMCBot::Search(const State& root_state) {
   int num_determinizations = num_determinizations_;
 
@@ -90,32 +122,50 @@ std::pair<std::vector<int>, Action> PIMCBot::Search(const State& root_state) {
     return absl::Uniform<double>(this->rng_, 0.0, 1.0);
   };
 
+  // Sample every determinization up front on this thread. Resampling is cheap
+  // next to the searches, and keeping it sequential means the rng stream (and
+  // so the set of worlds searched) is identical whatever num_threads_ is.
+  std::vector<std::unique_ptr<State>> states;
+  states.reserve(num_determinizations);
   for (int i = 0; i < num_determinizations; ++i) {
-    std::unique_ptr<State> state = nullptr;
-
     if (num_determinizations == 1) {
-      state = root_state.Clone();
+      states.push_back(root_state.Clone());
     } else {
-      state = root_state.ResampleFromInfostate(player, rng_func);
+      states.push_back(root_state.ResampleFromInfostate(player, rng_func));
     }
+  }
 
-    if (type.utility == GameType::Utility::kZeroSum &&
-        type.chance_mode == GameType::ChanceMode::kDeterministic &&
-        root_state.NumPlayers() == 2) {
-      // Special case for two-player zero-sum deterministic games: use
-      // alpha-beta.
-      std::pair<double, Action> search_result = algorithms::AlphaBetaSearch(
-          *state->GetGame(), state.get(),
-          [this, player](const State& state) {
-            return this->value_function_(state, player);
-          },
-          depth_limit_, player, /*use_undo*/ false);
-      action_counts[search_result.second] += 1;
-    } else {
-      std::pair<std::vector<double>, Action> search_result =
-          algorithms::MaxNSearch(*state->GetGame(), state.get(),
-                                 value_function_, depth_limit_);
-      action_counts[search_result.second] += 1;
+  const absl::Time deadline = absl::Now() + time_budget_;
+  const int num_threads = std::min(num_threads_, num_determinizations);
+  if (num_threads <= 1) {
+    for (int i = 0; i < num_determinizations; ++i) {
+      if (absl::Now() >= deadline) break;
+      action_counts[SearchOne(type, player, states[i].get())] += 1;
+    }
+  } else {
+    // Workers pull determinization indices from a shared counter, vote into
+    // their own map, and stop claiming work once the budget is spent. Votes
+    // are merged after the join, so no locking is needed anywhere.
+    std::atomic<int> next_index{0};
+    std::vector<absl::flat_hash_map<Action, int>> thread_counts(num_threads);
+    std::vector<Thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back([this, &type, &states, &next_index, &deadline,
+                            player, num_determinizations,
+                            counts = &thread_counts[t]]() {
+        while (absl::Now() < deadline) {
+          int i = next_index.fetch_add(1, std::memory_order_relaxed);
+          if (i >= num_determinizations) break;
+          (*counts)[SearchOne(type, player, states[i].get())] += 1;
+        }
+      });
+    }
+    for (Thread& thread : threads) thread.join();
+    for (const auto& thread_count : thread_counts) {
+      for (const auto& [action, count] : thread_count) {
+        action_counts[action] += count;
+      }
     }
   }
 
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/games/gin_rummy/gin_rummy_utils.h"
 #include "open_spiel/spiel.h"
@@ -31,9 +32,18 @@ namespace open_spiel {
 
 class PIMCBot : public Bot {
  public:
+  // Runs `num_determinizations` determinized searches per step and plays the
+  // action with the most votes. With `num_threads` > 1 the searches are
+  // distributed over that many worker threads; determinizations are still
+  // sampled sequentially from the bot's rng, so results for a given seed do
+  // not depend on the thread count. The value function must be safe to call
+  // from several threads at once (a pure function of the state suffices).
+  // Searches that have not started when `time_budget` runs out are skipped,
+  // and the vote is taken over the searches that finished.
   PIMCBot(std::function<double(const State&, Player player)> value_function,
           Player player_id, uint32_t seed, int num_determinizations,
-          int depth_limit);
+          int depth_limit, int num_threads = 1,
+          absl::Duration time_budget = absl::InfiniteDuration());
 
   Action Step(const State& state) override;
 
@@ -48,12 +58,16 @@ class PIMCBot : public Bot {
   ActionsAndProbs PolicyFromBestAction(const State& state,
                                        Action best_action) const;
   std::pair<std::vector<int>, Action> Search(const State& root_state);
+  // Runs the search for one determinization and returns its vote.
+  Action SearchOne(const GameType& type, Player player, State* state) const;
 
   std::mt19937 rng_;
   std::function<double(const State&, Player player)> value_function_;
   const Player player_id_;
   const int num_determinizations_;
   const int depth_limit_;
+  const int num_threads_;
+  const absl::Duration time_budget_;
 };
 
 }  // namespace open_spiel
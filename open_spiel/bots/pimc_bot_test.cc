@@ -73,7 +73,33 @@ void SimpleSelfPlayTest() {
   }
 }
 
+void ThreadedMatchesSequentialTest() {
+  std::mt19937 rng(kSeed);
+  auto game = LoadGame("hearts");
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) {
+    ActionsAndProbs outcomes = state->ChanceOutcomes();
+    state->ApplyAction(
+        SampleAction(outcomes,
+                     std::uniform_real_distribution<double>(0.0, 1.0)(rng))
+            .first);
+  }
+
+  // The determinizations are sampled from the bot's rng before the searches
+  // are farmed out, so the same seed must yield the same vote whatever the
+  // thread count.
+  Player player = state->CurrentPlayer();
+  PIMCBot sequential(hearts_value_function, player, kSeed, 10, 2,
+                     /*num_threads=*/1);
+  PIMCBot threaded(hearts_value_function, player, kSeed, 10, 2,
+                   /*num_threads=*/4);
+  SPIEL_CHECK_EQ(sequential.Step(*state), threaded.Step(*state));
+}
+
 }  // namespace
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::SimpleSelfPlayTest(); }
+int main(int argc, char** argv) {
+  open_spiel::SimpleSelfPlayTest();
+  open_spiel::ThreadedMatchesSequentialTest();
+}
@@ -14,7 +14,6 @@
 
 #include "open_spiel/bots/uci/uci_bot.h"
 
-#include <sys/ioctl.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
@@ -59,13 +58,13 @@ Action UCIBot::Step(const State& state) {
   if (ponder_ && ponder_move_) {
     if (!was_ponder_hit_) {
       Stop();
-      Position(chess_state.Board().ToFEN());
+      PositionFromState(chess_state);
       tie(move_str, ponder_move_) = Go();
     } else {
       tie(move_str, ponder_move_) = ReadBestMove();
     }
   } else {
-    Position(chess_state.Board().ToFEN());
+    PositionFromState(chess_state);
     tie(move_str, ponder_move_) = Go();
   }
   was_ponder_hit_ = false;
@@ -75,7 +74,7 @@ Action UCIBot::Step(const State& state) {
   }
 
   if (ponder_ && ponder_move_) {
-    Position(chess_state.Board().ToFEN(), {move_str, *ponder_move_});
+    PositionFromState(chess_state, {move_str, *ponder_move_});
     GoPonder();
   }
 
@@ -93,7 +92,7 @@ void UCIBot::RestartAt(const State& state) {
   ponder_move_ = absl::nullopt;
   was_ponder_hit_ = false;
   auto chess_state = down_cast<const chess::ChessState &>(state);
-  Position(chess_state.Board().ToFEN());
+  PositionFromState(chess_state);
 }
 
 void UCIBot::InformAction(const State& state, Player player_id, Action action) {
@@ -150,7 +149,7 @@ void UCIBot::StartProcess(const std::string& bot_binary_path) {
 void UCIBot::Uci() {
   Write("uci");
   while (true) {
-    std::string response = Read(false);
+    std::string response = ReadLine(/*wait=*/false);
     if (!response.empty()) {
       if (absl::StrContains(response, "uciok")) {
         return;
@@ -171,7 +170,7 @@ void UCIBot::UciNewGame() { Write("ucinewgame"); }
 void UCIBot::IsReady() {
   Write("isready");
   while (true) {
-    std::string response = Read(false);
+    std::string response = ReadLine(/*wait=*/false);
     if (!response.empty()) {
       if (absl::StrContains(response, "readyok")) {
         return;
@@ -192,6 +191,17 @@ void UCIBot::Position(const std::string& fen,
   Write(msg);
 }
 
+void UCIBot::PositionFromState(const chess::ChessState& state,
+                               const std::vector<std::string>& extra_moves) {
+  std::vector<std::string> moves;
+  moves.reserve(state.MovesHistory().size() + extra_moves.size());
+  for (const chess::Move& move : state.MovesHistory()) {
+    moves.push_back(move.ToLAN());
+  }
+  moves.insert(moves.end(), extra_moves.begin(), extra_moves.end());
+  Position(state.StartBoard().ToFEN(), moves);
+}
+
 std::pair<std::string, absl::optional<std::string>> UCIBot::Go() {
   Write("go movetime " + std::to_string(move_time_));
   return ReadBestMove();
@@ -212,27 +222,23 @@ void UCIBot::Quit() { Write("quit"); }
 
 std::pair<std::string, absl::optional<std::string>> UCIBot::ReadBestMove() {
   while (true) {
-    auto response = Read(true);
-    std::istringstream response_stream(response);
-    std::string line;
-    while (getline(response_stream, line)) {
-      std::istringstream line_stream(line);
-      std::string token;
-      std::string move_str;
-      absl::optional<std::string> ponder_str = absl::nullopt;
-      line_stream >> std::skipws;
-      while (line_stream >> token) {
-        if (token == "bestmove") {
-          line_stream >> move_str;
-        } else if (token == "ponder") {
-          line_stream >> token;
-          ponder_str = token;
-        }
-      }
-      if (!move_str.empty()) {
-        return std::make_pair(move_str, ponder_str);
+    std::string line = ReadLine(/*wait=*/true);
+    std::istringstream line_stream(line);
+    std::string token;
+    std::string move_str;
+    absl::optional<std::string> ponder_str = absl::nullopt;
+    line_stream >> std::skipws;
+    while (line_stream >> token) {
+      if (token == "bestmove") {
+        line_stream >> move_str;
+      } else if (token == "ponder") {
+        line_stream >> token;
+        ponder_str = token;
       }
     }
+    if (!move_str.empty()) {
+      return std::make_pair(move_str, ponder_str);
+    }
   }
 }
 
@@ -243,39 +249,45 @@ void UCIBot::Write(const std::string& msg) const {
   }
 }
 
-std::string UCIBot::Read(bool wait) const {
-  char *buff;
-  int count = 0;
-  std::string response;
-
-  fd_set fds;
-  FD_ZERO(&fds);
-  FD_SET(input_fd_, &fds);
-  timeval timeout = {5, 0};  // 5 second timeout.
-
-  int ready_fd = select(/*nfds=*/input_fd_ + 1,
-                        /*readfds=*/&fds,
-                        /*writefds=*/nullptr,
-                        /*exceptfds*/ nullptr, wait ? nullptr : &timeout);
-  if (ready_fd == -1) {
-    SpielFatalError("Failed to read from uci sub-process");
-  }
-  if (ready_fd == 0) {
-    SpielFatalError("Response from uci sub-process not received in time");
-  }
-  if (ioctl(input_fd_, FIONREAD, &count) == -1) {
-    SpielFatalError("Failed to read input size.");
-  }
-  if (count == 0) {
-    return "";
-  }
-  buff = (char*)malloc(count);
-  if (read(input_fd_, buff, count) != count) {
-    SpielFatalError("Read wrong number of bytes");
+std::string UCIBot::ReadLine(bool wait) const {
+  while (true) {
+    // Return a buffered line before touching the pipe again, so one read that
+    // delivered several lines (or half of the next one) costs one syscall.
+    std::size_t pos = read_buffer_.find('\n');
+    if (pos != std::string::npos) {
+      std::string line = read_buffer_.substr(0, pos);
+      read_buffer_.erase(0, pos + 1);
+      if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+      }
+      return line;
+    }
+
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(input_fd_, &fds);
+    timeval timeout = {5, 0};  // 5 second timeout.
+
+    int ready_fd = select(/*nfds=*/input_fd_ + 1,
+                          /*readfds=*/&fds,
+                          /*writefds=*/nullptr,
+                          /*exceptfds*/ nullptr, wait ? nullptr : &timeout);
+    if (ready_fd == -1) {
+      SpielFatalError("Failed to read from uci sub-process");
+    }
+    if (ready_fd == 0) {
+      SpielFatalError("Response from uci sub-process not received in time");
+    }
+    char buff[4096];
+    ssize_t count = read(input_fd_, buff, sizeof(buff));
+    if (count < 0) {
+      SpielFatalError("Failed to read from uci sub-process");
+    }
+    if (count == 0) {
+      SpielFatalError("Uci sub-process closed its output");
+    }
+    read_buffer_.append(buff, count);
   }
-  response.assign(buff, count);
-  free(buff);
-  return response;
 }
 
 std::unique_ptr<Bot> MakeUCIBot(const std::string& bot_binary_path,
@@ -44,13 +44,23 @@ class UCIBot : public Bot {
                     Action action) override;
 
   void Write(const std::string& msg) const;
-  std::string Read(bool wait) const;
+  // Returns the next complete line from the engine, stripped of its
+  // terminator. Lines are assembled from a persistent read buffer, so a
+  // response split across pipe reads is never handed back in pieces. If `wait`
+  // is false, dies when the engine stays silent for too long.
+  std::string ReadLine(bool wait) const;
 
   void Position(const std::string& fen,
                 const std::vector<std::string>& moves = {});
 
  private:
   void StartProcess(const std::string& bot_binary_path);
+  // Sends the position as the game's start fen plus the moves played so far
+  // (plus `extra_moves`), instead of the current fen. Keeping one growing
+  // `position ... moves` line per game lets the engine recognize successive
+  // searches as the same game and reuse its internal state between moves.
+  void PositionFromState(const chess::ChessState& state,
+                         const std::vector<std::string>& extra_moves = {});
   void Uci();
   void SetOption(const std::string& name, const std::string& value);
   void UciNewGame();
@@ -65,6 +75,7 @@ class UCIBot : public Bot {
   pid_t pid_ = -1;
   int input_fd_ = -1;
   int output_fd_ = -1;
+  mutable std::string read_buffer_;
   int move_time_;
   absl::optional<std::string> ponder_move_ = absl::nullopt;
   bool was_ponder_hit_ = false;
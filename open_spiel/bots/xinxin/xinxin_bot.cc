@@ -235,5 +235,23 @@ std::unique_ptr<Bot> MakeXinxinBot(GameParameters params, int uct_num_runs,
                                      iimc_num_worlds, use_threads);
 }
 
+TournamentResults PlayXinxinMatches(std::shared_ptr<const Game> game,
+                                    int num_matches, int seed, int num_threads,
+                                    int uct_num_runs, double uct_c_val,
+                                    int iimc_num_worlds, bool use_threads) {
+  const int rules = XinxinBot::XinxinRules(game->GetParameters());
+  // The factory runs once per worker thread per seat; the runner then reuses
+  // that bot for all of the worker's matches (Restart between matches), so
+  // the engine sessions persist across the whole tournament.
+  return EvaluateBotsParallel(
+      game,
+      [rules, uct_num_runs, uct_c_val, iimc_num_worlds, use_threads](
+          const Game&, Player, uint32_t) -> std::unique_ptr<Bot> {
+        return std::make_unique<XinxinBot>(rules, uct_num_runs, uct_c_val,
+                                           iimc_num_worlds, use_threads);
+      },
+      num_matches, seed, num_threads);
+}
+
 }  // namespace hearts
 }  // namespace open_spiel
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "open_spiel/algorithms/evaluate_bots.h"
 #include "open_spiel/bots/xinxin/hearts/Hearts.h"
 #include "open_spiel/bots/xinxin/hearts/iiMonteCarlo.h"
 #include "open_spiel/games/hearts/hearts.h"
@@ -79,6 +80,22 @@ std::unique_ptr<Bot> MakeXinxinBot(GameParameters params, int uct_num_runs = 50,
                                    int iimc_num_worlds = 20,
                                    bool use_threads = true);
 
+// Plays a batch of xinxin self-play matches for evaluation tournaments,
+// spread over num_threads workers. Each worker creates its four engine
+// sessions (UCT searchers, playout modules and the engine game state) once
+// and keeps them for all of its matches: between matches the sessions are
+// only Reset(), and within a match they advance incrementally with each
+// observed action, so tournament wall time goes to search rather than
+// engine re-initialization. When running several workers, prefer
+// use_threads = false so xinxin does not oversubscribe the machine with its
+// own per-determinization threads.
+TournamentResults PlayXinxinMatches(std::shared_ptr<const Game> game,
+                                    int num_matches, int seed,
+                                    int num_threads, int uct_num_runs = 50,
+                                    double uct_c_val = 0.4,
+                                    int iimc_num_worlds = 20,
+                                    bool use_threads = true);
+
 }  // namespace hearts
 }  // namespace open_spiel
 
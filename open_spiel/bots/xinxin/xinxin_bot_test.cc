@@ -53,6 +53,17 @@ void XinxinBot_BasicPlayGame() {
   }
 }
 
+void XinxinBot_MatchRunnerTest() {
+  auto game = open_spiel::LoadGame("hearts");
+  // Small search settings: this exercises the runner, not playing strength.
+  TournamentResults results = hearts::PlayXinxinMatches(
+      game, /*num_matches=*/2, /*seed=*/1234, /*num_threads=*/1,
+      /*uct_num_runs=*/5, /*uct_c_val=*/0.4, /*iimc_num_worlds=*/2,
+      /*use_threads=*/false);
+  SPIEL_CHECK_EQ(results.num_episodes, 2);
+  SPIEL_CHECK_EQ(results.returns.size(), hearts::kNumPlayers);
+}
+
 void XinxinBot_CardActionTransformationTest() {
   // exhaustively check if action mapping is a bijection
   for (Action action = 0; action < hearts::kNumCards; action++) {
@@ -68,4 +79,5 @@ void XinxinBot_CardActionTransformationTest() {
 int main(int argc, char **argv) {
   open_spiel::XinxinBot_CardActionTransformationTest();
   open_spiel::XinxinBot_BasicPlayGame();
+  open_spiel::XinxinBot_MatchRunnerTest();
 }
@@ -45,4 +45,50 @@ std::string TurnBasedGoofspielGameString(int num_cards) {
       num_cards);
 }
 
+// The parameter values below must stay in sync with the strings above; the
+// multi-valued ACPC parameters (blind, stack, ...) are string-typed, exactly
+// as GameParametersFromString infers them.
+GameParameters HunlGameParameters(const std::string& betting_abstraction) {
+  return {{"name", GameParameter(std::string("universal_poker"))},
+          {"betting", GameParameter(std::string("nolimit"))},
+          {"numPlayers", GameParameter(2)},
+          {"numRounds", GameParameter(4)},
+          {"blind", GameParameter(std::string("100 50"))},
+          {"firstPlayer", GameParameter(std::string("2 1 1 1"))},
+          {"numSuits", GameParameter(4)},
+          {"numRanks", GameParameter(13)},
+          {"numHoleCards", GameParameter(2)},
+          {"numBoardCards", GameParameter(std::string("0 3 1 1"))},
+          {"stack", GameParameter(std::string("20000 20000"))},
+          {"bettingAbstraction", GameParameter(betting_abstraction)}};
+}
+
+GameParameters HulhGameParameters(const std::string& betting_abstraction) {
+  return {{"name", GameParameter(std::string("universal_poker"))},
+          {"betting", GameParameter(std::string("limit"))},
+          {"numPlayers", GameParameter(2)},
+          {"numRounds", GameParameter(4)},
+          {"blind", GameParameter(std::string("10 5"))},
+          {"firstPlayer", GameParameter(std::string("2 1"))},
+          {"numSuits", GameParameter(4)},
+          {"numRanks", GameParameter(13)},
+          {"numHoleCards", GameParameter(2)},
+          {"numBoardCards", GameParameter(std::string("0 3 1 1"))},
+          {"raiseSize", GameParameter(std::string("10 10 20 20"))},
+          {"maxRaises", GameParameter(std::string("3 4 4 4"))},
+          {"bettingAbstraction", GameParameter(betting_abstraction)}};
+}
+
+GameParameters TurnBasedGoofspielGameParameters(int num_cards) {
+  GameParameters goofspiel_params = {
+      {"name", GameParameter(std::string("goofspiel"))},
+      {"imp_info", GameParameter(true)},
+      {"num_cards", GameParameter(num_cards)},
+      {"players", GameParameter(2)},
+      {"points_order", GameParameter(std::string("descending"))},
+      {"returns_type", GameParameter(std::string("win_loss"))}};
+  return {{"name", GameParameter(std::string("turn_based_simultaneous_game"))},
+          {"game", GameParameter(goofspiel_params)}};
+}
+
 }  // namespace open_spiel
@@ -17,6 +17,8 @@
 
 #include <string>
 
+#include "open_spiel/game_parameters.h"
+
 // A place to store functions that return canonical game strings. These strings
 // can sent to LoadGame to load the game.
 
@@ -36,6 +38,16 @@ std::string HulhGameString(const std::string &betting_abstraction);
 // Turn based goofspiel w/ imperfect information and descending points order.
 std::string TurnBasedGoofspielGameString(int num_cards);
 
+// Precompiled GameParameters counterparts of the strings above, for callers
+// that load canonical games repeatedly (e.g. short-lived batch jobs). They
+// resolve to the same configurations without going through the LoadGame
+// string parser; pass the result to LoadGame(GameParameters) (the "name"
+// parameter is included). Repeat loads of one configuration then share the
+// process-wide game cache.
+GameParameters HunlGameParameters(const std::string& betting_abstraction);
+GameParameters HulhGameParameters(const std::string& betting_abstraction);
+GameParameters TurnBasedGoofspielGameParameters(int num_cards);
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_SPIEL_H_
@@ -48,6 +48,14 @@ ABSL_FLAG(int, replay_buffer_size, 1 << 16,
           "How many states to store in the replay buffer.");
 ABSL_FLAG(double, replay_buffer_reuse, 3,
           "How many times to reuse each state in the replay buffer.");
+ABSL_FLAG(std::string, replay_buffer_path, "",
+          ("If set, keep the replay buffer memory-mapped in a file at this "
+           "path rather than in RAM, so the window size is bounded by disk. "
+           "The file persists across runs, including after a crash."));
+ABSL_FLAG(std::string, trajectories_path, "",
+          ("If set, also append every training sample to a columnar binary "
+           "trajectory file in this directory, for offline reuse of the "
+           "training data."));
 ABSL_FLAG(int, checkpoint_freq, 100, "Save a checkpoint every N steps.");
 ABSL_FLAG(int, max_simulations, 300, "How many simulations to run.");
 ABSL_FLAG(int, train_batch_size, 1 << 10,
@@ -69,6 +77,14 @@ ABSL_FLAG(bool, explicit_learning, false,
           "multiple devices are available).");
 ABSL_FLAG(bool, verbose, false, "Show the MCTS stats of possible moves.");
 ABSL_FLAG(int, actors, 4, "How many actors to run.");
+ABSL_FLAG(int, games_per_actor, 1,
+          ("How many games each actor thread interleaves, collecting one "
+           "search leaf per game and evaluating them as a batch. Values "
+           "above 1 keep inference saturated with far fewer threads."));
+ABSL_FLAG(int, inflight_per_game, 1,
+          ("How many simulations each interleaved search keeps suspended "
+           "awaiting evaluation. Values above 1 deepen inference batches "
+           "beyond one leaf per game. Only used when games_per_actor > 1."));
 ABSL_FLAG(int, evaluators, 2, "How many evaluators to run.");
 ABSL_FLAG(int, eval_levels, 7,
           ("Play evaluation games vs MCTS+Solver, with max_simulations*10^(n/2)"
@@ -135,6 +151,8 @@ int main(int argc, char** argv) {
     config.train_batch_size = absl::GetFlag(FLAGS_train_batch_size);
     config.replay_buffer_size = absl::GetFlag(FLAGS_replay_buffer_size);
     config.replay_buffer_reuse = absl::GetFlag(FLAGS_replay_buffer_reuse);
+    config.replay_buffer_path = absl::GetFlag(FLAGS_replay_buffer_path);
+    config.trajectories_path = absl::GetFlag(FLAGS_trajectories_path);
     config.checkpoint_freq = absl::GetFlag(FLAGS_checkpoint_freq);
     config.evaluation_window = absl::GetFlag(FLAGS_evaluation_window);
     config.uct_c = absl::GetFlag(FLAGS_uct_c);
@@ -150,6 +168,8 @@ int main(int argc, char** argv) {
     config.cutoff_probability = absl::GetFlag(FLAGS_cutoff_probability);
     config.cutoff_value = absl::GetFlag(FLAGS_cutoff_value);
     config.actors = absl::GetFlag(FLAGS_actors);
+    config.games_per_actor = absl::GetFlag(FLAGS_games_per_actor);
+    config.inflight_per_game = absl::GetFlag(FLAGS_inflight_per_game);
     config.evaluators = absl::GetFlag(FLAGS_evaluators);
     config.eval_levels = absl::GetFlag(FLAGS_eval_levels);
     config.max_steps = absl::GetFlag(FLAGS_max_steps);
@@ -0,0 +1,284 @@
+// Copyright 2022 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks the hot per-state primitives of one or more games: state
+// creation, cloning, legal action generation, action application, and the
+// observation/information state accessors. Unlike benchmark_game, which times
+// whole random playthroughs, this isolates each primitive over a fixed corpus
+// of states, repeats each measurement several times after a warmup, and can
+// write a machine-readable report and compare it against a baseline report to
+// flag regressions.
+//
+// Typical usage:
+//   benchmark_primitives --games=chess,go --output=new.json
+//   benchmark_primitives --games=chess,go --baseline=old.json
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/flags/flag.h"
+#include "open_spiel/abseil-cpp/absl/flags/parse.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/utils/file.h"
+#include "open_spiel/utils/json.h"
+#include "open_spiel/utils/stats.h"
+
+ABSL_FLAG(std::string, games, "tic_tac_toe",
+          "Comma-separated list of games to benchmark.");
+ABSL_FLAG(int, episodes, 100,
+          "How many random episodes to collect the state corpus from.");
+ABSL_FLAG(int, max_states, 10000, "Cap on the size of the state corpus.");
+ABSL_FLAG(int, repetitions, 5, "Timed repetitions per primitive.");
+ABSL_FLAG(int, warmup, 1, "Untimed repetitions before measuring.");
+ABSL_FLAG(int, seed, 1234, "Seed for the random playthroughs.");
+ABSL_FLAG(std::string, output, "",
+          "If set, write a json report to this file.");
+ABSL_FLAG(std::string, baseline, "",
+          "If set, compare against the json report at this path.");
+ABSL_FLAG(double, regression_threshold, 0.15,
+          "Relative slowdown vs the baseline reported as a regression.");
+
+namespace open_spiel {
+namespace {
+
+// A corpus of non-terminal states from random play, with one legal action
+// sampled per state so the timed loops do no random number generation.
+struct StateCorpus {
+  std::vector<std::unique_ptr<State>> states;
+  std::vector<Action> actions;
+};
+
+StateCorpus CollectCorpus(const Game& game, int episodes, int max_states,
+                          std::mt19937* rng) {
+  StateCorpus corpus;
+  for (int episode = 0; episode < episodes; ++episode) {
+    std::unique_ptr<State> state = game.NewInitialState();
+    while (!state->IsTerminal()) {
+      if (corpus.states.size() >= max_states) return corpus;
+      Action action;
+      if (state->IsChanceNode()) {
+        action = SampleAction(state->ChanceOutcomes(), *rng).first;
+      } else {
+        std::vector<Action> legal_actions = state->LegalActions();
+        std::uniform_int_distribution<int> dis(0, legal_actions.size() - 1);
+        action = legal_actions[dis(*rng)];
+      }
+      // Simultaneous-move states are skipped: their per-player stepping is
+      // not comparable with the single ApplyAction primitive timed here.
+      if (state->CurrentPlayer() != kSimultaneousPlayerId) {
+        corpus.states.push_back(state->Clone());
+        corpus.actions.push_back(action);
+      }
+      state->ApplyAction(action);
+    }
+  }
+  return corpus;
+}
+
+// Runs `body` warmup + repetitions times over `num_ops` operations and
+// returns stats over the nanoseconds per operation of the timed repetitions.
+template <class Body>
+BasicStats TimeRepetitions(int warmup, int repetitions, int num_ops,
+                           const Body& body) {
+  BasicStats stats;
+  for (int rep = 0; rep < warmup + repetitions; ++rep) {
+    absl::Time start = absl::Now();
+    body();
+    absl::Duration elapsed = absl::Now() - start;
+    if (rep >= warmup) {
+      stats.Add(absl::ToDoubleNanoseconds(elapsed) / num_ops);
+    }
+  }
+  return stats;
+}
+
+json::Object BenchmarkGame(const std::string& game_name, int episodes,
+                           int max_states, int warmup, int repetitions,
+                           int seed) {
+  std::mt19937 rng(seed);
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  StateCorpus corpus =
+      CollectCorpus(*game, episodes, max_states, &rng);
+  const int num_states = corpus.states.size();
+  if (num_states == 0) {
+    std::cerr << game_name << ": no states collected, skipping." << std::endl;
+    return {};
+  }
+
+  json::Object results;
+  auto record = [&results](const std::string& name, const BasicStats& stats) {
+    results.emplace(name, json::Object{{"ns_per_op", stats.Avg()},
+                                       {"std_dev", stats.StdDev()},
+                                       {"repetitions", stats.Num()}});
+  };
+
+  constexpr int kNumInitialStates = 1000;
+  record("new_initial_state",
+         TimeRepetitions(warmup, repetitions, kNumInitialStates, [&game]() {
+           for (int i = 0; i < kNumInitialStates; ++i) {
+             std::unique_ptr<State> state = game->NewInitialState();
+           }
+         }));
+
+  record("clone", TimeRepetitions(warmup, repetitions, num_states, [&corpus]() {
+           for (const std::unique_ptr<State>& state : corpus.states) {
+             std::unique_ptr<State> clone = state->Clone();
+           }
+         }));
+
+  record("legal_actions",
+         TimeRepetitions(warmup, repetitions, num_states, [&corpus]() {
+           for (const std::unique_ptr<State>& state : corpus.states) {
+             std::vector<Action> actions = state->LegalActions();
+           }
+         }));
+
+  // ApplyAction consumes its state, so fresh clones are prepared before each
+  // repetition and only the application loop itself is timed.
+  {
+    BasicStats stats;
+    for (int rep = 0; rep < warmup + repetitions; ++rep) {
+      std::vector<std::unique_ptr<State>> clones;
+      clones.reserve(num_states);
+      for (const std::unique_ptr<State>& state : corpus.states) {
+        clones.push_back(state->Clone());
+      }
+      absl::Time start = absl::Now();
+      for (int i = 0; i < num_states; ++i) {
+        clones[i]->ApplyAction(corpus.actions[i]);
+      }
+      absl::Duration elapsed = absl::Now() - start;
+      if (rep >= warmup) {
+        stats.Add(absl::ToDoubleNanoseconds(elapsed) / num_states);
+      }
+    }
+    record("apply_action", stats);
+  }
+
+  if (game->GetType().provides_observation_tensor) {
+    std::vector<float> tensor(game->ObservationTensorSize());
+    record("observation_tensor",
+           TimeRepetitions(warmup, repetitions, num_states,
+                           [&corpus, &tensor]() {
+             for (const std::unique_ptr<State>& state : corpus.states) {
+               Player player = state->CurrentPlayer();
+               if (player < 0) player = 0;
+               state->ObservationTensor(player, absl::MakeSpan(tensor));
+             }
+           }));
+  }
+
+  if (game->GetType().provides_information_state_string) {
+    record("information_state_string",
+           TimeRepetitions(warmup, repetitions, num_states, [&corpus]() {
+             for (const std::unique_ptr<State>& state : corpus.states) {
+               Player player = state->CurrentPlayer();
+               if (player < 0) player = 0;
+               std::string str = state->InformationStateString(player);
+             }
+           }));
+  }
+
+  results.emplace("num_states", num_states);
+  return results;
+}
+
+void PrintReport(const std::string& game_name, const json::Object& results,
+                 const json::Object* baseline, double threshold) {
+  std::cout << game_name << " (" << results.at("num_states").GetInt()
+            << " states):" << std::endl;
+  for (const auto& [name, value] : results) {
+    if (!value.IsObject()) continue;
+    const json::Object& metric = value.GetObject();
+    double ns = metric.at("ns_per_op").GetDouble();
+    std::string line = absl::StrFormat("  %-26s %10.1f ns/op  (+- %.1f)", name,
+                                       ns, metric.at("std_dev").GetDouble());
+    if (baseline != nullptr) {
+      auto it = baseline->find(name);
+      if (it != baseline->end() && it->second.IsObject()) {
+        double base_ns = it->second.GetObject().at("ns_per_op").GetDouble();
+        if (base_ns > 0) {
+          double ratio = ns / base_ns;
+          absl::StrAppendFormat(&line, "  %6.2fx baseline", ratio);
+          if (ratio > 1 + threshold) absl::StrAppend(&line, "  REGRESSION");
+        }
+      }
+    }
+    std::cout << line << std::endl;
+  }
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+
+  open_spiel::json::Object baseline_report;
+  bool have_baseline = false;
+  std::string baseline_path = absl::GetFlag(FLAGS_baseline);
+  if (!baseline_path.empty()) {
+    absl::optional<open_spiel::json::Value> parsed =
+        open_spiel::json::FromString(
+            open_spiel::file::ReadContentsFromFile(baseline_path, "r"));
+    if (!parsed.has_value() || !parsed->IsObject()) {
+      std::cerr << "Could not parse baseline report: " << baseline_path
+                << std::endl;
+      return 1;
+    }
+    baseline_report = parsed->GetObject().at("games").GetObject();
+    have_baseline = true;
+  }
+
+  open_spiel::json::Object games_report;
+  std::vector<std::string> games =
+      absl::StrSplit(absl::GetFlag(FLAGS_games), ',');
+  for (const std::string& game_name : games) {
+    open_spiel::json::Object results = open_spiel::BenchmarkGame(
+        game_name, absl::GetFlag(FLAGS_episodes),
+        absl::GetFlag(FLAGS_max_states), absl::GetFlag(FLAGS_warmup),
+        absl::GetFlag(FLAGS_repetitions), absl::GetFlag(FLAGS_seed));
+    if (results.empty()) continue;
+    const open_spiel::json::Object* baseline = nullptr;
+    if (have_baseline) {
+      auto it = baseline_report.find(game_name);
+      if (it != baseline_report.end() && it->second.IsObject()) {
+        baseline = &it->second.GetObject();
+      }
+    }
+    open_spiel::PrintReport(game_name, results, baseline,
+                            absl::GetFlag(FLAGS_regression_threshold));
+    games_report.emplace(game_name, results);
+  }
+
+  std::string output_path = absl::GetFlag(FLAGS_output);
+  if (!output_path.empty()) {
+    open_spiel::json::Object report = {
+        {"timestamp", absl::FormatTime(absl::Now(), absl::UTCTimeZone())},
+        {"games", games_report},
+    };
+    open_spiel::file::WriteContentsToFile(
+        output_path, "w", open_spiel::json::ToString(report, /*wrap=*/true));
+    std::cout << "Wrote report to " << output_path << std::endl;
+  }
+}
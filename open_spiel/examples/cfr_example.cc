@@ -41,6 +41,7 @@ int main(int argc, char** argv) {
       double exploitability = open_spiel::algorithms::Exploitability(
           *game, *solver.AveragePolicy());
       std::cerr << "Iteration " << i << " exploitability=" << exploitability
+                << " table_bytes=" << solver.InfoStateValuesMemoryFootprint()
                 << std::endl;
     }
   }
@@ -0,0 +1,216 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Perft benchmark for the chess move generator.
+//
+// perft(n) counts the leaf nodes of the legal move tree to depth n, which
+// both validates move generation against known node counts and gives a
+// nodes-per-second number for tracking movegen performance over time.
+//
+// By default runs a standard suite of positions with known perft values
+// (https://www.chessprogramming.org/Perft_Results) and checks the counts.
+// A single position can be run with --fen, and --divide additionally prints
+// the subtree count under each root move, which is the usual way to bisect
+// a movegen bug against another engine. A custom suite can be loaded from
+// an EPD file with lines of the form:
+//   <fen> ;D1 20 ;D2 400 ;D3 8902
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/flags/flag.h"
+#include "open_spiel/abseil-cpp/absl/flags/parse.h"
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/strings/strip.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/games/chess/chess_board.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+ABSL_FLAG(std::string, fen, "",
+          "Run a single position instead of the built-in suite.");
+ABSL_FLAG(int, depth, 5, "Perft depth for --fen.");
+ABSL_FLAG(bool, divide, false,
+          "With --fen, print the node count under each root move.");
+ABSL_FLAG(std::string, epd_file, "",
+          "Run a suite from an EPD file with ;Dn <nodes> operations.");
+ABSL_FLAG(int, max_depth, 4,
+          "Cap on the depth of the suite positions' checked counts.");
+
+namespace open_spiel {
+namespace {
+
+// One suite entry: a position and its known node counts per depth.
+struct PerftPosition {
+  std::string fen;
+  std::vector<std::pair<int, uint64_t>> expected;
+};
+
+// The standard perft validation suite from the Chess Programming Wiki.
+std::vector<PerftPosition> DefaultSuite() {
+  return {
+      {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+       {{1, 20}, {2, 400}, {3, 8902}, {4, 197281}, {5, 4865609}}},
+      {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+       {{1, 48}, {2, 2039}, {3, 97862}, {4, 4085603}}},
+      {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+       {{1, 14}, {2, 191}, {3, 2812}, {4, 43238}, {5, 674624}}},
+      {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+       {{1, 6}, {2, 264}, {3, 9467}, {4, 422333}}},
+      {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+       {{1, 44}, {2, 1486}, {3, 62379}, {4, 2103487}}},
+      {"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - "
+       "- 0 10",
+       {{1, 46}, {2, 2079}, {3, 89890}, {4, 3894594}}},
+  };
+}
+
+std::vector<PerftPosition> LoadEpdSuite(const std::string& filename) {
+  std::vector<PerftPosition> suite;
+  std::string contents = file::ReadContentsFromFile(filename, "r");
+  for (absl::string_view line : absl::StrSplit(contents, '\n')) {
+    line = absl::StripAsciiWhitespace(line);
+    if (line.empty() || line[0] == '#') continue;
+    std::vector<absl::string_view> parts = absl::StrSplit(line, ';');
+    PerftPosition position;
+    position.fen = std::string(absl::StripAsciiWhitespace(parts[0]));
+    for (int i = 1; i < parts.size(); ++i) {
+      absl::string_view op = absl::StripAsciiWhitespace(parts[i]);
+      if (op.empty() || op[0] != 'D') continue;
+      std::vector<absl::string_view> fields =
+          absl::StrSplit(op.substr(1), ' ', absl::SkipEmpty());
+      int depth;
+      uint64_t nodes;
+      if (fields.size() != 2 || !absl::SimpleAtoi(fields[0], &depth) ||
+          !absl::SimpleAtoi(fields[1], &nodes)) {
+        SpielFatalError(absl::StrCat("Malformed EPD operation: ", op));
+      }
+      position.expected.push_back({depth, nodes});
+    }
+    suite.push_back(position);
+  }
+  return suite;
+}
+
+chess::ChessBoard BoardFromFenOrDie(const std::string& fen) {
+  // EPD records have only the first four FEN fields; complete them so the
+  // FEN parser accepts them.
+  std::string full_fen = fen;
+  if (std::vector<std::string> fields = absl::StrSplit(fen, ' ');
+      fields.size() == 4) {
+    full_fen = absl::StrCat(fen, " 0 1");
+  }
+  absl::optional<chess::ChessBoard> board =
+      chess::ChessBoard::BoardFromFEN(full_fen);
+  if (!board) SpielFatalError(absl::StrCat("Invalid FEN: ", fen));
+  return *board;
+}
+
+uint64_t Perft(const chess::ChessBoard& board, int depth) {
+  if (depth <= 0) return 1;
+  uint64_t nodes = 0;
+  board.GenerateLegalMoves([&](const chess::Move& move) {
+    if (depth == 1) {
+      ++nodes;
+    } else {
+      chess::ChessBoard child = board;
+      child.ApplyMove(move);
+      nodes += Perft(child, depth - 1);
+    }
+    return true;
+  });
+  return nodes;
+}
+
+// perft split by root move, for diffing against another engine.
+uint64_t Divide(const chess::ChessBoard& board, int depth) {
+  uint64_t total = 0;
+  board.GenerateLegalMoves([&](const chess::Move& move) {
+    chess::ChessBoard child = board;
+    child.ApplyMove(move);
+    uint64_t nodes = Perft(child, depth - 1);
+    std::cout << move.ToLAN() << ": " << nodes << std::endl;
+    total += nodes;
+    return true;
+  });
+  return total;
+}
+
+// Runs one perft and reports time and speed; checks the count if an
+// expected value is given. Returns the node count.
+uint64_t TimedPerft(const chess::ChessBoard& board, int depth,
+                    absl::optional<uint64_t> expected, bool divide) {
+  absl::Time start = absl::Now();
+  uint64_t nodes = divide ? Divide(board, depth) : Perft(board, depth);
+  double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  std::cout << absl::StrFormat(
+      "  perft(%d) = %d in %.3fs, %.3g nodes/s", depth, nodes, seconds,
+      seconds > 0 ? nodes / seconds : 0.0);
+  if (expected.has_value()) {
+    std::cout << (nodes == *expected
+                      ? " [ok]"
+                      : absl::StrFormat(" [FAIL, expected %d]", *expected));
+  }
+  std::cout << std::endl;
+  if (expected.has_value()) SPIEL_CHECK_EQ(nodes, *expected);
+  return nodes;
+}
+
+void RunSuite(const std::vector<PerftPosition>& suite, int max_depth) {
+  absl::Time start = absl::Now();
+  uint64_t total_nodes = 0;
+  for (const PerftPosition& position : suite) {
+    std::cout << "Position: " << position.fen << std::endl;
+    chess::ChessBoard board = BoardFromFenOrDie(position.fen);
+    for (const auto& [depth, expected] : position.expected) {
+      if (depth > max_depth) continue;
+      total_nodes += TimedPerft(board, depth, expected, /*divide=*/false);
+    }
+  }
+  double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  std::cout << absl::StrFormat("Suite total: %d nodes in %.3fs, %.3g nodes/s",
+                               total_nodes, seconds,
+                               seconds > 0 ? total_nodes / seconds : 0.0)
+            << std::endl;
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+
+  std::string fen = absl::GetFlag(FLAGS_fen);
+  if (!fen.empty()) {
+    std::cout << "Position: " << fen << std::endl;
+    open_spiel::chess::ChessBoard board = open_spiel::BoardFromFenOrDie(fen);
+    open_spiel::TimedPerft(board, absl::GetFlag(FLAGS_depth),
+                           absl::nullopt, absl::GetFlag(FLAGS_divide));
+    return 0;
+  }
+
+  std::string epd_file = absl::GetFlag(FLAGS_epd_file);
+  open_spiel::RunSuite(epd_file.empty() ? open_spiel::DefaultSuite()
+                                        : open_spiel::LoadEpdSuite(epd_file),
+                       absl::GetFlag(FLAGS_max_depth));
+  return 0;
+}
@@ -12,76 +12,349 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+#include "open_spiel/abseil-cpp/absl/flags/flag.h"
+#include "open_spiel/abseil-cpp/absl/flags/parse.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
-#include "open_spiel/algorithms/get_all_histories.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/canonical_game_strings.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+#include "open_spiel/utils/json.h"
 
-
-using open_spiel::TurnBasedGoofspielGameString;
-using open_spiel::LoadGame;
-using open_spiel::GameType;
-using open_spiel::StateType;
-using open_spiel::algorithms::GetAllHistories;
+ABSL_FLAG(std::string, games, "",
+          "Comma-separated list of games to count. Defaults to a built-in "
+          "suite of small games.");
+ABSL_FLAG(int, depth_limit, -1, "Depth limit for the walk; -1 for none.");
+ABSL_FLAG(std::string, spill_dir, "",
+          "When set, states are deduplicated through partitioned on-disk "
+          "hash buckets under this directory instead of one in-memory set, "
+          "so state spaces larger than RAM can still be counted.");
+ABSL_FLAG(int, num_buckets, 64,
+          "Number of spill buckets per state set in external-memory mode. "
+          "Each bucket's distinct states must fit in memory during the "
+          "merge pass, so increase this for bigger games.");
+ABSL_FLAG(int64_t, checkpoint_every, 1000000,
+          "Histories between progress checkpoints in external-memory mode.");
 
 // Counts the number of states in the game according to various measures.
 //   - histories is a sequence of moves (for all players) and chance outcomes
 //   - states is for imperfect information games, information states (i.e.
 //     sets of histories which are indistinguishable to the acting player);
-//     for example in poker, the acting player's private cards plus the sequence
-//     of bets and public cards, for perfect information games, Markov states
-//     (i.e. sets of histories which yield the same result with the same actions
-//     applied), e.g. in tic-tac-toe the current state of the board, regardless
-//     of the order in which the moves were played.
-int main(int argc, char** argv) {
-  for (const std::string& game_name :
-       {std::string("tic_tac_toe"), std::string("kuhn_poker"),
-        std::string("leduc_poker"), std::string("liars_dice"),
-        TurnBasedGoofspielGameString(4), TurnBasedGoofspielGameString(5),
-        TurnBasedGoofspielGameString(6)}) {
-    std::shared_ptr<const open_spiel::Game> game =
-        LoadGame(std::string(game_name));
-    std::vector<std::unique_ptr<open_spiel::State>> all_histories =
-        GetAllHistories(*game, /*depth_limit=*/-1, /*include_terminals=*/true,
-                        /*include_chance_states=*/true);
-    absl::flat_hash_set<std::string> nonterminal_states;
-    absl::flat_hash_set<std::string> terminal_states;
-    const int num_histories = all_histories.size();
-    int num_terminal_histories = 0;
-    int num_chance_nodes = 0;
-    for (const auto& state : all_histories) {
-      switch (state->GetType()) {
-        case StateType::kDecision:
-          if (game->GetType().information ==
-              GameType::Information::kPerfectInformation) {
-            nonterminal_states.insert(state->ToString());
-          } else {
-            nonterminal_states.insert(state->InformationStateString());
-          }
-          break;
-        case StateType::kTerminal:
-          ++num_terminal_histories;
-          terminal_states.insert(state->ToString());
-          break;
-        case StateType::kChance:
-          ++num_chance_nodes;
-          break;
-        case StateType::kMeanField:
-          open_spiel::SpielFatalError("kMeanField not handeled.");
+//     for example in poker, the acting player's private cards plus the
+//     sequence of bets and public cards, for perfect information games,
+//     Markov states (i.e. sets of histories which yield the same result with
+//     the same actions applied), e.g. in tic-tac-toe the current state of the
+//     board, regardless of the order in which the moves were played.
+//
+// Histories are walked depth-first without being materialized, so memory is
+// bounded by the deduplication of state strings. The default mode dedups in
+// one in-memory set; --spill_dir switches to an external-memory mode that
+// partitions state strings into on-disk hash buckets during the walk and
+// deduplicates one bucket at a time in a merge pass, with progress
+// checkpointed to <spill_dir>/checkpoint.json. An interrupted merge resumes
+// from the checkpoint; an interrupted walk restarts (its state is the DFS
+// stack, which is not serialized).
+
+namespace open_spiel {
+namespace {
+
+// Deduplicates a stream of state strings and reports how many were distinct.
+class Deduper {
+ public:
+  virtual ~Deduper() = default;
+  virtual void Insert(const std::string& s) = 0;
+  // Returns the number of distinct strings inserted. Call once, at the end.
+  virtual int64_t CountDistinct() = 0;
+};
+
+class InMemoryDeduper : public Deduper {
+ public:
+  void Insert(const std::string& s) override { states_.insert(s); }
+  int64_t CountDistinct() override { return states_.size(); }
+
+ private:
+  absl::flat_hash_set<std::string> states_;
+};
+
+// Partitioned on-disk dedup. During the walk, strings are appended to one of
+// `num_buckets` spill files chosen by hash, as length-prefixed records; all
+// copies of a string land in the same bucket, so the merge pass can
+// deduplicate one bucket at a time in memory. Peak memory is the largest
+// bucket's distinct strings rather than the whole state space.
+class SpillingDeduper : public Deduper {
+ public:
+  // `resume_at` > 0 skips the walk-side file creation and resumes the merge
+  // at that bucket, with `resumed_count` distinct strings already counted;
+  // the spill files of the interrupted run must still be on disk.
+  SpillingDeduper(const std::string& dir, const std::string& name,
+                  int num_buckets, int resume_at = 0,
+                  int64_t resumed_count = 0)
+      : next_bucket_(resume_at), count_(resumed_count) {
+    paths_.reserve(num_buckets);
+    for (int b = 0; b < num_buckets; ++b) {
+      paths_.push_back(absl::StrFormat("%s/%s-%04d.spill", dir, name, b));
+    }
+    if (resume_at == 0) {
+      buckets_.reserve(num_buckets);
+      for (const std::string& path : paths_) {
+        buckets_.emplace_back(absl::in_place, path, "w");
+      }
+    }
+  }
+
+  void Insert(const std::string& s) override {
+    uint32_t length = s.size();
+    file::File& bucket =
+        *buckets_[absl::Hash<std::string>()(s) % buckets_.size()];
+    bucket.Write(absl::string_view(reinterpret_cast<const char*>(&length),
+                                   sizeof(length)));
+    bucket.Write(s);
+  }
+
+  // Deduplicates the remaining buckets one at a time, calling
+  // `bucket_merged` (if set) after each so the caller can checkpoint. Spill
+  // files are deleted as they are merged.
+  int64_t CountDistinct() override {
+    while (next_bucket_ < static_cast<int>(paths_.size())) {
+      const int b = next_bucket_;
+      if (!buckets_.empty()) buckets_[b].reset();  // Flush and close.
+      {
+        file::MappedFile bucket(paths_[b]);
+        absl::string_view data = bucket.contents();
+        absl::flat_hash_set<absl::string_view> distinct;
+        std::size_t pos = 0;
+        while (pos < data.size()) {
+          uint32_t length;
+          SPIEL_CHECK_LE(pos + sizeof(length), data.size());
+          std::memcpy(&length, data.data() + pos, sizeof(length));
+          pos += sizeof(length);
+          SPIEL_CHECK_LE(pos + length, data.size());
+          distinct.insert(data.substr(pos, length));
+          pos += length;
+        }
+        count_ += distinct.size();
       }
+      file::Remove(paths_[b]);
+      ++next_bucket_;
+      if (bucket_merged) bucket_merged();
     }
-    const int num_nonterminal_states = nonterminal_states.size();
-    const int num_terminal_states = terminal_states.size();
-    std::cout << "Game: " << game_name
-              << ", num_histories: " << num_histories
-              << ", num_terminal_histories: " << num_terminal_histories
-              << ", num_chance_nodes: " << num_chance_nodes
-              << ", num_nonterminal_states: " << num_nonterminal_states
-              << ", num_terminal_states: " << num_terminal_states
-              << std::endl;
+    return count_;
+  }
+
+  // Merge progress, for checkpointing.
+  int next_bucket() const { return next_bucket_; }
+  int64_t count() const { return count_; }
+
+  // Called after each merged bucket.
+  std::function<void()> bucket_merged;
+
+ private:
+  std::vector<std::string> paths_;
+  // Open only on the walk side; absent when resuming a merge.
+  std::vector<absl::optional<file::File>> buckets_;
+  int next_bucket_;
+  int64_t count_;
+};
+
+struct WalkCounts {
+  int64_t num_histories = 0;
+  int64_t num_terminal_histories = 0;
+  int64_t num_chance_nodes = 0;
+};
+
+// Depth-first walk over all histories, feeding decision and terminal state
+// strings to the dedupers without materializing the histories.
+void WalkHistories(State* state, int depth_limit, int depth,
+                   bool perfect_information, WalkCounts* counts,
+                   Deduper* nonterminal_states, Deduper* terminal_states,
+                   const std::function<void()>& maybe_checkpoint) {
+  ++counts->num_histories;
+  maybe_checkpoint();
+  switch (state->GetType()) {
+    case StateType::kDecision:
+      nonterminal_states->Insert(perfect_information
+                                     ? state->ToString()
+                                     : state->InformationStateString());
+      break;
+    case StateType::kTerminal:
+      ++counts->num_terminal_histories;
+      terminal_states->Insert(state->ToString());
+      return;
+    case StateType::kChance:
+      ++counts->num_chance_nodes;
+      break;
+    case StateType::kMeanField:
+      SpielFatalError("kMeanField not handeled.");
+  }
+  if (depth_limit >= 0 && depth >= depth_limit) return;
+  for (Action action : state->LegalActions()) {
+    std::unique_ptr<State> child = state->Child(action);
+    WalkHistories(child.get(), depth_limit, depth + 1, perfect_information,
+                  counts, nonterminal_states, terminal_states,
+                  maybe_checkpoint);
+  }
+}
+
+std::string CheckpointPath(const std::string& spill_dir) {
+  return spill_dir + "/checkpoint.json";
+}
+
+void WriteCheckpoint(const std::string& spill_dir, const std::string& game,
+                     const std::string& phase, const WalkCounts& counts,
+                     int nonterminal_buckets_merged, int64_t nonterminal_count,
+                     int terminal_buckets_merged, int64_t terminal_count) {
+  json::Object checkpoint = {
+      {"game", game},
+      {"phase", phase},
+      {"num_buckets", absl::GetFlag(FLAGS_num_buckets)},
+      {"num_histories", counts.num_histories},
+      {"num_terminal_histories", counts.num_terminal_histories},
+      {"num_chance_nodes", counts.num_chance_nodes},
+      {"nonterminal_buckets_merged", nonterminal_buckets_merged},
+      {"nonterminal_count", nonterminal_count},
+      {"terminal_buckets_merged", terminal_buckets_merged},
+      {"terminal_count", terminal_count},
+  };
+  file::WriteContentsToFile(CheckpointPath(spill_dir), "w",
+                            json::ToString(checkpoint, /*wrap=*/true));
+}
+
+// Returns the checkpoint left by an interrupted merge of `game`, if one is
+// on disk and compatible with the current flags.
+absl::optional<json::Object> LoadMergeCheckpoint(const std::string& spill_dir,
+                                                 const std::string& game) {
+  if (spill_dir.empty() || !file::Exists(CheckpointPath(spill_dir))) {
+    return absl::nullopt;
+  }
+  absl::optional<json::Value> checkpoint = json::FromString(
+      file::ReadContentsFromFile(CheckpointPath(spill_dir), "r"));
+  if (!checkpoint || !checkpoint->IsObject()) return absl::nullopt;
+  const json::Object& obj = checkpoint->GetObject();
+  if (obj.at("game") != game || obj.at("phase") != "merge" ||
+      obj.at("num_buckets") != absl::GetFlag(FLAGS_num_buckets)) {
+    return absl::nullopt;
+  }
+  return obj;
+}
+
+void CountGame(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  const bool perfect_information =
+      game->GetType().information == GameType::Information::kPerfectInformation;
+  const std::string spill_dir = absl::GetFlag(FLAGS_spill_dir);
+  const int num_buckets = absl::GetFlag(FLAGS_num_buckets);
+  const int64_t checkpoint_every = absl::GetFlag(FLAGS_checkpoint_every);
+
+  std::unique_ptr<Deduper> nonterminal_states;
+  std::unique_ptr<Deduper> terminal_states;
+  WalkCounts counts;
+  bool walk_needed = true;
+
+  if (spill_dir.empty()) {
+    nonterminal_states = std::make_unique<InMemoryDeduper>();
+    terminal_states = std::make_unique<InMemoryDeduper>();
+  } else {
+    if (!file::Exists(spill_dir)) file::Mkdirs(spill_dir);
+    absl::optional<json::Object> resume =
+        LoadMergeCheckpoint(spill_dir, game_name);
+    if (resume.has_value()) {
+      // The walk finished before the interruption; only the merge remains.
+      std::cerr << "Resuming merge of " << game_name << " from checkpoint."
+                << std::endl;
+      walk_needed = false;
+      counts.num_histories = resume->at("num_histories").GetInt();
+      counts.num_terminal_histories =
+          resume->at("num_terminal_histories").GetInt();
+      counts.num_chance_nodes = resume->at("num_chance_nodes").GetInt();
+      nonterminal_states = std::make_unique<SpillingDeduper>(
+          spill_dir, "nonterminal", num_buckets,
+          resume->at("nonterminal_buckets_merged").GetInt(),
+          resume->at("nonterminal_count").GetInt());
+      terminal_states = std::make_unique<SpillingDeduper>(
+          spill_dir, "terminal", num_buckets,
+          resume->at("terminal_buckets_merged").GetInt(),
+          resume->at("terminal_count").GetInt());
+    } else {
+      nonterminal_states = std::make_unique<SpillingDeduper>(
+          spill_dir, "nonterminal", num_buckets);
+      terminal_states = std::make_unique<SpillingDeduper>(
+          spill_dir, "terminal", num_buckets);
+    }
+    auto* spilling_nonterminal =
+        down_cast<SpillingDeduper*>(nonterminal_states.get());
+    auto* spilling_terminal =
+        down_cast<SpillingDeduper*>(terminal_states.get());
+    auto checkpoint_merge = [=, &counts]() {
+      WriteCheckpoint(spill_dir, game_name, "merge", counts,
+                      spilling_nonterminal->next_bucket(),
+                      spilling_nonterminal->count(),
+                      spilling_terminal->next_bucket(),
+                      spilling_terminal->count());
+    };
+    spilling_nonterminal->bucket_merged = checkpoint_merge;
+    spilling_terminal->bucket_merged = checkpoint_merge;
+  }
+
+  if (walk_needed) {
+    std::function<void()> maybe_checkpoint = []() {};
+    if (!spill_dir.empty()) {
+      maybe_checkpoint = [&]() {
+        if (counts.num_histories % checkpoint_every == 0) {
+          WriteCheckpoint(spill_dir, game_name, "walk", counts, 0, 0, 0, 0);
+        }
+      };
+    }
+    std::unique_ptr<State> initial_state = game->NewInitialState();
+    WalkHistories(initial_state.get(), absl::GetFlag(FLAGS_depth_limit),
+                  /*depth=*/0, perfect_information, &counts,
+                  nonterminal_states.get(), terminal_states.get(),
+                  maybe_checkpoint);
+    if (!spill_dir.empty()) {
+      // Walk done: from here an interrupted run resumes at the merge.
+      WriteCheckpoint(spill_dir, game_name, "merge", counts, 0, 0, 0, 0);
+    }
+  }
+
+  const int64_t num_nonterminal_states = nonterminal_states->CountDistinct();
+  const int64_t num_terminal_states = terminal_states->CountDistinct();
+  if (!spill_dir.empty()) file::Remove(CheckpointPath(spill_dir));
+  std::cout << "Game: " << game_name
+            << ", num_histories: " << counts.num_histories
+            << ", num_terminal_histories: " << counts.num_terminal_histories
+            << ", num_chance_nodes: " << counts.num_chance_nodes
+            << ", num_nonterminal_states: " << num_nonterminal_states
+            << ", num_terminal_states: " << num_terminal_states
+            << std::endl;
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+  std::vector<std::string> game_names;
+  if (absl::GetFlag(FLAGS_games).empty()) {
+    game_names = {std::string("tic_tac_toe"), std::string("kuhn_poker"),
+                  std::string("leduc_poker"), std::string("liars_dice"),
+                  open_spiel::TurnBasedGoofspielGameString(4),
+                  open_spiel::TurnBasedGoofspielGameString(5),
+                  open_spiel::TurnBasedGoofspielGameString(6)};
+  } else {
+    game_names = absl::StrSplit(absl::GetFlag(FLAGS_games), ',');
+  }
+  for (const std::string& game_name : game_names) {
+    open_spiel::CountGame(game_name);
   }
 }
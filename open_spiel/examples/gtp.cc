@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include<functional>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -21,13 +24,22 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/algorithms/mcts.h"
 #include "open_spiel/abseil-cpp/absl/flags/flag.h"
 #include "open_spiel/abseil-cpp/absl/flags/parse.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 ABSL_FLAG(std::string, game, "tic_tac_toe", "The name of the game to play.");
+ABSL_FLAG(int, max_simulations, 1000,
+          "Simulation budget per move (the ceiling when a time limit from "
+          "time_left applies).");
+ABSL_FLAG(bool, ponder, true,
+          "Keep searching on a background thread while waiting for the "
+          "opponent's move.");
 
 std::string Success() { return "=\n\n"; }
 std::string Success(const std::string& s) {
@@ -37,12 +49,24 @@ std::string Failure(const std::string& s) {
   return absl::StrCat("? ", s, "\n\n");
 }
 
-std::unique_ptr<open_spiel::Bot> MakeBot(
+// Normalizes a GTP color argument ("B", "black", "w", ...) to "b" or "w".
+std::string NormalizeColor(const std::string& color) {
+  if (color.empty()) return color;
+  return std::string(1, std::tolower(static_cast<unsigned char>(color[0])));
+}
+
+std::unique_ptr<open_spiel::algorithms::MCTSBot> MakeBot(
     const open_spiel::Game& game,
-    std::shared_ptr<open_spiel::algorithms::Evaluator> evaluator) {
-  return std::make_unique<open_spiel::algorithms::MCTSBot>(
-      game, std::move(evaluator), /*uct_c=*/2, /*max_simulations=*/1000,
+    std::shared_ptr<open_spiel::algorithms::Evaluator> evaluator,
+    int max_simulations) {
+  auto bot = std::make_unique<open_spiel::algorithms::MCTSBot>(
+      game, std::move(evaluator), /*uct_c=*/2, max_simulations,
       /*max_memory_mb=*/0, /*solve=*/true, /*seed=*/0, /*verbose=*/false);
+  // Keep the search tree across genmove calls: each move re-roots into the
+  // subtree reached by the moves played, keeping the simulations already
+  // spent there. This is also what makes pondering pay off.
+  bot->SetTreeReuse(true);
+  return bot;
 }
 
 // Implements the Go Text Protocol, GTP, which is a text based protocol for
@@ -62,7 +86,56 @@ int main(int argc, char** argv) {
   auto evaluator =
       std::make_shared<open_spiel::algorithms::RandomRolloutEvaluator>(
       /*n_rollouts=*/1, /*seed=*/0);
-  std::unique_ptr<open_spiel::Bot> bot = MakeBot(*game, evaluator);
+  const int max_simulations = absl::GetFlag(FLAGS_max_simulations);
+  const bool ponder_enabled = absl::GetFlag(FLAGS_ponder);
+  std::unique_ptr<open_spiel::algorithms::MCTSBot> bot =
+      MakeBot(*game, evaluator, max_simulations);
+
+  // While waiting for the next command the bot keeps searching the current
+  // position on a background thread, in small chunks so it stops promptly.
+  // The worker owns the bot while it runs, so every command that touches the
+  // bot (or replaces the game or state) must stop it first.
+  constexpr int kPonderChunkSimulations = 250;
+  std::unique_ptr<open_spiel::Thread> ponder_thread;
+  std::atomic<bool> stop_ponder{false};
+  auto stop_pondering = [&ponder_thread, &stop_ponder]() {
+    if (ponder_thread != nullptr) {
+      stop_ponder = true;
+      ponder_thread->join();
+      ponder_thread.reset();
+    }
+  };
+  auto start_pondering = [&]() {
+    if (!ponder_enabled || state->IsTerminal()) return;
+    stop_ponder = false;
+    // The worker searches its own clone; the main thread is free to answer
+    // read-only queries against `state` in the meantime.
+    std::shared_ptr<open_spiel::State> ponder_state = state->Clone();
+    ponder_thread = std::make_unique<open_spiel::Thread>(
+        [&bot, &stop_ponder, ponder_state]() {
+          bot->SetMaxSimulations(kPonderChunkSimulations);
+          while (!stop_ponder) {
+            bot->Ponder(*ponder_state);
+          }
+        });
+  };
+
+  // Remaining clock time per color, set by the time_left command. Combined
+  // with a measured simulation rate it converts into a per-move simulation
+  // budget, so genmove answers within its share of the clock.
+  std::map<std::string, double> time_left_seconds;
+  double simulations_per_second = 0;
+  auto move_budget = [&](const std::string& color) {
+    auto it = time_left_seconds.find(color);
+    if (it == time_left_seconds.end() || it->second <= 0 ||
+        simulations_per_second <= 0) {
+      return max_simulations;
+    }
+    // Spend roughly 1/30th of the remaining clock on this move.
+    double seconds = std::max(0.05, it->second / 30.0);
+    return std::clamp(static_cast<int>(seconds * simulations_per_second), 16,
+                      max_simulations);
+  };
 
   using Args = std::vector<std::string>;
   std::map<std::string, std::function<std::string(const Args&)>> cmds = {
@@ -87,16 +160,17 @@ int main(int argc, char** argv) {
     {"known_games", [](const Args& args) {
       return Success(absl::StrJoin(open_spiel::RegisteredGames(), " "));
     }},
-    {"game", [&bot, &game, &state, &evaluator](const Args& args) {
+    {"game", [&](const Args& args) {
       if (args.empty()) {
         return Success(game->ToString());
       }
+      stop_pondering();
       game = open_spiel::LoadGame(args[0]);
       state = game->NewInitialState();
-      bot = MakeBot(*game, evaluator);
+      bot = MakeBot(*game, evaluator, max_simulations);
       return Success(game->ToString());
     }},
-    {"boardsize", [&bot, &game, &state, &evaluator](const Args& args) {
+    {"boardsize", [&](const Args& args) {
       open_spiel::GameParameters params = game->GetParameters();
       if (params.find("board_size") == params.end()) {
         return Failure("Game doesn't support setting the board size");
@@ -108,13 +182,14 @@ int main(int argc, char** argv) {
       if (!absl::SimpleAtoi(args[0], &board_size)) {
         return Failure("Failed to parse first arg as an int");
       }
+      stop_pondering();
       params["board_size"] = open_spiel::GameParameter(board_size);
       game = open_spiel::LoadGame(game->GetType().short_name, params);
       state = game->NewInitialState();
-      bot = MakeBot(*game, evaluator);
+      bot = MakeBot(*game, evaluator, max_simulations);
       return Success();
     }},
-    {"play", [&bot, &state](const Args& args) {
+    {"play", [&](const Args& args) {
       if (args.size() < 2) {
         return Failure("Not enough args");
       }
@@ -122,29 +197,59 @@ int main(int argc, char** argv) {
       const std::string& action_str = args[1];
       for (const open_spiel::Action action : state->LegalActions()) {
         if (action_str == state->ActionToString(action)) {
+          stop_pondering();
           bot->InformAction(*state, state->CurrentPlayer(), action);
           state->ApplyAction(action);
+          start_pondering();
           return Success();
         }
       }
       return Failure("Invalid action");
     }},
-    {"genmove", [&bot, &state](const Args& args) {
+    {"genmove", [&](const Args& args) {
       if (state->IsTerminal()) {
         return Failure("Game is already over");
       }
-      // Ignore player arg, assume it's always the current player.
+      stop_pondering();
+      std::string color = args.empty() ? "" : NormalizeColor(args[0]);
+      int budget = move_budget(color);
+      bot->SetMaxSimulations(budget);
+      absl::Time search_start = absl::Now();
       open_spiel::Action action = bot->Step(*state);
+      double seconds = absl::ToDoubleSeconds(absl::Now() - search_start);
+      if (seconds > 0) {
+        simulations_per_second = budget / seconds;
+        auto it = time_left_seconds.find(color);
+        if (it != time_left_seconds.end()) {
+          it->second = std::max(0.0, it->second - seconds);
+        }
+      }
       std::string action_str = state->ActionToString(action);
       state->ApplyAction(action);
+      start_pondering();
       return Success(action_str);
     }},
-    {"clear_board", [&bot, &game, &state](const Args& args) {
+    {"time_left", [&](const Args& args) {
+      // Per GTP: time_left <color> <seconds> [<stones>]. We only use the
+      // main time; byo-yomi stones are ignored.
+      if (args.size() < 2) {
+        return Failure("Not enough args");
+      }
+      double seconds;
+      if (!absl::SimpleAtod(args[1], &seconds)) {
+        return Failure("Failed to parse second arg as a number");
+      }
+      time_left_seconds[NormalizeColor(args[0])] = seconds;
+      return Success();
+    }},
+    {"clear_board", [&](const Args& args) {
+      stop_pondering();
       state = game->NewInitialState();
       bot->Restart();
+      start_pondering();
       return Success();
     }},
-    {"undo", [&bot, &game, &state](const Args& args) {
+    {"undo", [&](const Args& args) {
       std::vector<open_spiel::Action> history = state->History();
       int count = 1;
       if (!args.empty() && !absl::SimpleAtoi(args[0], &count)) {
@@ -155,12 +260,14 @@ int main(int argc, char** argv) {
             "Can't undo ", count, " moves from game of length ",
             history.size()));
       }
+      stop_pondering();
       state = game->NewInitialState();
       bot->Restart();
       for (int i = 0; i < history.size() - count; ++i) {
         bot->InformAction(*state, state->CurrentPlayer(), history[i]);
         state->ApplyAction(history[i]);
       }
+      start_pondering();
       return Success();
     }},
     {"showboard", [&state](const Args& args) {
@@ -208,5 +315,6 @@ int main(int argc, char** argv) {
       break;
     }
   }
+  stop_pondering();
   return 0;
 }
@@ -0,0 +1,54 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Builds an Oware endgame table (all positions with at most --max_seeds seeds
+// on the board) and writes it to --output for later loading with
+// OwareEndgameTable::Load. See games/oware/oware_endgame.h.
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/flags/flag.h"
+#include "open_spiel/abseil-cpp/absl/flags/parse.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/games/oware/oware_endgame.h"
+#include "open_spiel/spiel.h"
+
+ABSL_FLAG(std::string, game, "oware", "The Oware game (with parameters).");
+ABSL_FLAG(int, max_seeds, 8,
+          "Solve all positions with at most this many seeds on the board.");
+ABSL_FLAG(std::string, output, "",
+          "File to write the table to; only printed stats if empty.");
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+
+  std::shared_ptr<const open_spiel::Game> game =
+      open_spiel::LoadGame(absl::GetFlag(FLAGS_game));
+  open_spiel::oware::OwareEndgameTable table(absl::GetFlag(FLAGS_max_seeds));
+
+  const absl::Time start = absl::Now();
+  table.Build(game);
+  const absl::Duration elapsed = absl::Now() - start;
+  std::cout << "Solved " << table.size() << " positions with at most "
+            << table.max_seeds() << " seeds in " << elapsed << std::endl;
+
+  const std::string output = absl::GetFlag(FLAGS_output);
+  if (!output.empty()) {
+    table.Save(output);
+    std::cout << "Table written to " << output << std::endl;
+  }
+}
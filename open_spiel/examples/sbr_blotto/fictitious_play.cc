@@ -127,26 +127,33 @@ void FictitiousPlayProcess::GetMarginalJointPolicy(
 // policy.
 void FictitiousPlayProcess::GetMarginalJointPolicyFromEmpirical(
     TabularPolicy* policy) const {
+  // Marginalize each player's digit out of the empirical joint policy with
+  // strided sweeps over the weight array, rather than materializing the
+  // correlation device and decoding every joint action.
   std::vector<std::vector<double>> marginal_weights;
   marginal_weights.reserve(num_players_);
-  for (Player p = 0; p < num_players_; ++p) {
-    marginal_weights.push_back(std::vector<double>(num_actions_, 0));
-  }
-
-  NormalFormCorrelationDevice mu = GetEmpiricalJointPolicy();
-
-  for (int ja_idx = 0; ja_idx < num_joint_actions_; ++ja_idx) {
-    for (Player p = 0; p < num_players_; ++p) {
-      marginal_weights[p][mu[ja_idx].actions[p]] += mu[ja_idx].probability;
-    }
-  }
+  double total_weight = std::accumulate(cumulative_joint_policy_.begin(),
+                                        cumulative_joint_policy_.end(), 0.0);
 
   for (Player p = 0; p < num_players_; ++p) {
-    double total_weight = std::accumulate(marginal_weights[p].begin(),
-                                          marginal_weights[p].end(), 0.0);
+    std::vector<double> weights(num_actions_, 0);
+    const int stride = PlayerStride(p);
+    const int block = stride * num_actions_;
+    for (int base = 0; base < num_joint_actions_; base += block) {
+      for (Action a = 0; a < num_actions_; ++a) {
+        const double* joint =
+            cumulative_joint_policy_.data() + base + a * stride;
+        double sum = 0.0;
+        for (int lo = 0; lo < stride; ++lo) {
+          sum += joint[lo];
+        }
+        weights[a] += sum;
+      }
+    }
     for (Action a = 0; a < num_actions_; ++a) {
-      marginal_weights[p][a] /= total_weight;
+      weights[a] /= total_weight;
     }
+    marginal_weights.push_back(std::move(weights));
   }
 
   GetMarginalJointPolicy(policy, &marginal_weights);
@@ -247,17 +254,30 @@ void FictitiousPlayProcess::InitPolicies() {
 // Add appropriate weights given each players' (potentially mixed) policy
 void FictitiousPlayProcess::UpdateCumulativeJointPolicy(
     const std::vector<std::vector<double>>& policies) {
+  // Build the joint weights as an outer product of the players' policies,
+  // expanding one player's digit at a time (player 0 is the fastest-moving
+  // digit of the joint index), then add them into the cumulative joint policy
+  // in place.
+  std::vector<double> joint_weights = policies[0];
+  for (Player p = 1; p < num_players_; ++p) {
+    const int prev_size = joint_weights.size();
+    std::vector<double> expanded(prev_size * num_actions_);
+    for (Action a = 0; a < num_actions_; ++a) {
+      const double prob = policies[p][a];
+      double* dst = expanded.data() + a * prev_size;
+      for (int i = 0; i < prev_size; ++i) {
+        dst[i] = joint_weights[i] * prob;
+      }
+    }
+    joint_weights = std::move(expanded);
+  }
+  SPIEL_CHECK_EQ(joint_weights.size(), num_joint_actions_);
+
   double sum_weights = 0.0;
   double sum_joint_policy = 0.0;
   for (int ja_idx = 0; ja_idx < num_joint_actions_; ++ja_idx) {
-    std::vector<Action> joint_action = IndexToJointAction(ja_idx);
-    double weight = 1.0;
-    for (Player p = 0; p < num_players_; ++p) {
-      Action action = joint_action[p];
-      weight *= policies[p][action];
-    }
-    cumulative_joint_policy_[ja_idx] += weight;
-    sum_weights += weight;
+    cumulative_joint_policy_[ja_idx] += joint_weights[ja_idx];
+    sum_weights += joint_weights[ja_idx];
     sum_joint_policy += cumulative_joint_policy_[ja_idx];
   }
   SPIEL_CHECK_FLOAT_NEAR(sum_weights, 1.0, 1e-12);
@@ -313,25 +333,58 @@ std::vector<double> FictitiousPlayProcess::Softmax(
   return policy;
 }
 
-Action FictitiousPlayProcess::BestResponseAgainstEmpiricalJointPolicy(
-    Player player, std::vector<double>* values) {
-  double best_action_value = -10;
+int FictitiousPlayProcess::PlayerStride(Player player) const {
+  int stride = 1;
+  for (Player p = 0; p < player; ++p) {
+    stride *= num_actions_;
+  }
+  return stride;
+}
+
+void FictitiousPlayProcess::MarginalizeOut(
+    Player player, const std::vector<double>& joint_weights,
+    std::vector<double>* others_weights) const {
+  const int stride = PlayerStride(player);
+  const int block = stride * num_actions_;
+  others_weights->assign(num_joint_actions_ / num_actions_, 0.0);
+  for (int base = 0; base < num_joint_actions_; base += block) {
+    double* dst = others_weights->data() + base / num_actions_;
+    for (Action a = 0; a < num_actions_; ++a) {
+      const double* src = joint_weights.data() + base + a * stride;
+      for (int lo = 0; lo < stride; ++lo) {
+        dst[lo] += src[lo];
+      }
+    }
+  }
+}
+
+Action FictitiousPlayProcess::BestDeviationValues(
+    Player player, const std::vector<double>& joint_weights,
+    std::vector<double>* values) const {
+  double total_weight =
+      std::accumulate(joint_weights.begin(), joint_weights.end(), 0.0);
+
+  // Since the deviation overwrites the player's own action, its original
+  // digit only matters through the marginal weights of the other players'
+  // actions. Marginalize it out once; each action value is then a dot product
+  // of the reduced weights with a strided slice of the cached utilities.
+  std::vector<double> others_weights;
+  MarginalizeOut(player, joint_weights, &others_weights);
+
+  const int stride = PlayerStride(player);
+  const int block = stride * num_actions_;
+  const std::vector<double>& utilities = cached_joint_utilities_[player];
+  double best_action_value = -std::numeric_limits<double>::infinity();
   Action best_action = kInvalidAction;
-  // NormalFormCorrelationDevice mu = GetEmpiricalJointPolicy();
-  double total_weight = std::accumulate(cumulative_joint_policy_.begin(),
-                                        cumulative_joint_policy_.end(), 0.0);
 
   for (Action a = 0; a < num_actions_; ++a) {
     double value = 0.0;
-    for (int idx = 0; idx < num_joint_actions_; ++idx) {
-      // std::vector<Action> joint_action = mu[idx].actions;
-      std::vector<Action> joint_action = IndexToJointAction(idx);
-      joint_action[player] = a;
-      int new_ja_idx = JointActionToIndex(joint_action);
-      // value +=
-      //    mu[idx].probability * cached_joint_utilities_[player][new_ja_idx];
-      value += (cumulative_joint_policy_[idx] *
-                cached_joint_utilities_[player][new_ja_idx]);
+    for (int base = 0; base < num_joint_actions_; base += block) {
+      const double* weights = others_weights.data() + base / num_actions_;
+      const double* utils = utilities.data() + base + a * stride;
+      for (int lo = 0; lo < stride; ++lo) {
+        value += weights[lo] * utils[lo];
+      }
     }
     value /= total_weight;
     if (values != nullptr) {
@@ -346,6 +399,11 @@ Action FictitiousPlayProcess::BestResponseAgainstEmpiricalJointPolicy(
   return best_action;
 }
 
+Action FictitiousPlayProcess::BestResponseAgainstEmpiricalJointPolicy(
+    Player player, std::vector<double>* values) {
+  return BestDeviationValues(player, cumulative_joint_policy_, values);
+}
+
 Action FictitiousPlayProcess::BestResponseAgainstEmpiricalMarginalizedPolicies(
     Player player, std::vector<double>* values) {
   TabularPolicy marginalized_joint_policy;
@@ -390,43 +448,26 @@ void FictitiousPlayProcess::CheckJointUtilitiesCache() {
 
 double FictitiousPlayProcess::CCEDist() const {
   double dist = 0;
-  std::vector<double> max_deviation(num_players_, -10);
-  std::vector<double> exp_values(num_players_, 0);
-  NormalFormCorrelationDevice corr_dev = GetEmpiricalJointPolicy();
-
-  // First compute expected values for everyone
-  for (int ja_idx = 0; ja_idx < num_joint_actions_; ++ja_idx) {
-    if (corr_dev[ja_idx].probability > 0) {
-      for (Player p = 0; p < num_players_; ++p) {
-        exp_values[p] +=
-            corr_dev[ja_idx].probability * cached_joint_utilities_[p][ja_idx];
-      }
-    }
-  }
+  double total_weight = std::accumulate(cumulative_joint_policy_.begin(),
+                                        cumulative_joint_policy_.end(), 0.0);
 
-  // Now for each player, find the maximal deviation
   for (Player p = 0; p < num_players_; ++p) {
-    for (Action a = 0; a < num_actions_; ++a) {
-      double action_value = 0;
-      for (int ja_idx = 0; ja_idx < num_joint_actions_; ++ja_idx) {
-        if (corr_dev[ja_idx].probability > 0) {
-          // Player p is changing to choose a instead.
-          std::vector<Action> joint_action = IndexToJointAction(ja_idx);
-          joint_action[p] = a;
-          int other_index = JointActionToIndex(joint_action);
-
-          action_value += corr_dev[ja_idx].probability *
-                          cached_joint_utilities_[p][other_index];
-        }
-      }
-      if (action_value > max_deviation[p]) {
-        max_deviation[p] = action_value;
-      }
+    // The on-policy value is a dot product of the empirical joint policy with
+    // the player's utility array.
+    const std::vector<double>& utilities = cached_joint_utilities_[p];
+    double exp_value = 0;
+    for (int ja_idx = 0; ja_idx < num_joint_actions_; ++ja_idx) {
+      exp_value += cumulative_joint_policy_[ja_idx] * utilities[ja_idx];
     }
-  }
+    exp_value /= total_weight;
 
-  for (Player p = 0; p < num_players_; ++p) {
-    double delta = std::max(max_deviation[p] - exp_values[p], 0.0);
+    // Deviation values for all actions, computed from the marginalized
+    // opponent weights.
+    std::vector<double> values(num_actions_, 0);
+    BestDeviationValues(p, cumulative_joint_policy_, &values);
+    double max_deviation = *std::max_element(values.begin(), values.end());
+
+    double delta = std::max(max_deviation - exp_value, 0.0);
     SPIEL_CHECK_GE(delta, 0);
     dist += delta;
   }
@@ -100,6 +100,25 @@ class FictitiousPlayProcess {
   int JointActionToIndex(const std::vector<Action>& joint_action) const;
   std::vector<Action> IndexToJointAction(int index) const;
 
+  // Stride of the player's action digit within the joint action index, i.e.
+  // num_actions_^player.
+  int PlayerStride(Player player) const;
+
+  // Sums the joint-action weights over the player's action digit, leaving one
+  // weight per combination of the other players' actions (indexed by the
+  // joint action index with the player's digit removed). The result has size
+  // num_joint_actions_ / num_actions_.
+  void MarginalizeOut(Player player, const std::vector<double>& joint_weights,
+                      std::vector<double>* others_weights) const;
+
+  // Computes the expected utility to the player of each of its actions against
+  // the (unnormalized) joint-action weights, as dot products of the
+  // marginalized opponent weights with contiguous slices of the cached
+  // utilities. Fills values if non-null and returns the best action.
+  Action BestDeviationValues(Player player,
+                             const std::vector<double>& joint_weights,
+                             std::vector<double>* values) const;
+
   NormalFormCorrelationDevice GetEmpiricalJointPolicy() const;
 
   // Add appropriate weights given each players' (potentially mixed) policy
@@ -0,0 +1,96 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/game_plugins.h"
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+#if defined(__APPLE__)
+constexpr const char* kPluginSuffix = ".dylib";
+#else
+constexpr const char* kPluginSuffix = ".so";
+#endif
+
+// Serializes dlopen calls so that concurrent loads of the same plugin run
+// its static initializers once, in order. The registration map written by
+// those initializers is guarded separately by the registry mutex inside
+// GameRegisterer, which concurrent registry readers also take (shared).
+absl::Mutex plugin_mutex;
+
+void OpenPlugin(const std::string& path)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(plugin_mutex) {
+#if defined(_WIN32)
+  SpielFatalError("Game plugins are not supported on Windows.");
+#else
+  // RTLD_NOW surfaces unresolved symbols here, where we can name the plugin,
+  // rather than at first use. The handle is deliberately never closed: the
+  // registered factory points into the plugin for the process lifetime.
+  if (dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL) == nullptr) {
+    SpielFatalError(
+        absl::StrCat("Failed to load game plugin ", path, ": ", dlerror()));
+  }
+#endif
+}
+
+}  // namespace
+
+bool LoadGamePlugin(const std::string& short_name) {
+#if defined(_WIN32)
+  return false;
+#else
+  const char* plugin_path = std::getenv(kGamePluginPathEnvVar);
+  if (plugin_path == nullptr) return false;
+  const std::string file_name =
+      absl::StrCat("libgame_", short_name, kPluginSuffix);
+  for (absl::string_view dir : absl::StrSplit(plugin_path, ':')) {
+    if (dir.empty()) continue;
+    const std::string path = absl::StrCat(dir, "/", file_name);
+    if (access(path.c_str(), F_OK) != 0) continue;
+    {
+      absl::MutexLock lock(&plugin_mutex);
+      OpenPlugin(path);
+    }
+    if (!GameRegisterer::IsValidName(short_name)) {
+      SpielFatalError(absl::StrCat("Game plugin ", path,
+                                   " loaded but did not register the game '",
+                                   short_name, "'."));
+    }
+    return true;
+  }
+  return false;
+#endif
+}
+
+void LoadGamePluginFile(const std::string& path) {
+  absl::MutexLock lock(&plugin_mutex);
+  OpenPlugin(path);
+}
+
+}  // namespace open_spiel
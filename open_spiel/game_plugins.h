@@ -0,0 +1,56 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_GAME_PLUGINS_H_
+#define OPEN_SPIEL_GAME_PLUGINS_H_
+
+#include <string>
+
+// Support for loading games from shared-library plugins on demand, so that a
+// deployment can link a slim core (no games, or only the games it uses) and
+// still resolve the remaining games at runtime. A plugin is an ordinary game
+// translation unit compiled into its own shared library: its
+// REGISTER_SPIEL_GAME static initializer runs when the library is opened and
+// registers the game with GameRegisterer exactly as a statically linked game
+// would. For the registration to land in the running process's registry, the
+// OpenSpiel core must be a shared library (see examples/shared_library_example
+// and BUILD_SHARED_LIB in the main CMakeLists) or the executable must export
+// its symbols (e.g. -rdynamic).
+
+namespace open_spiel {
+
+// Colon-separated list of directories that are searched for game plugins.
+inline constexpr const char* kGamePluginPathEnvVar = "OPEN_SPIEL_PLUGIN_PATH";
+
+// Searches the directories in OPEN_SPIEL_PLUGIN_PATH for a plugin providing
+// the game `short_name`, looking for libgame_<short_name>.so (.dylib on
+// macOS) in each directory in turn. Returns true if a plugin was found and
+// the game is registered after loading it; returns false, without error, if
+// no plugin exists (the caller decides whether an unknown game is fatal). A
+// plugin file that exists but fails to load, or loads without registering the
+// requested game, is a fatal error: the deployment is misconfigured.
+//
+// LoadGame calls this automatically when a game name is not registered, so
+// most callers never use it directly.
+bool LoadGamePlugin(const std::string& short_name);
+
+// Opens the plugin at `path` unconditionally, running its registrations.
+// Fatal if the library cannot be loaded. Useful for plugins that register
+// several games or whose file name does not follow the libgame_<name>
+// convention.
+void LoadGamePluginFile(const std::string& path);
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAME_PLUGINS_H_
@@ -14,6 +14,10 @@
 
 #include "open_spiel/game_transforms/add_noise.h"
 
+#include <functional>
+#include <random>
+#include <string>
+
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
@@ -64,24 +68,23 @@ AddNoiseGame::AddNoiseGame(std::shared_ptr<const Game> game, GameType game_type,
                            GameParameters game_parameters)
     : WrappedGame(game, game_type, game_parameters),
       epsilon_(ParameterValue<double>("epsilon")),
-      rng_(ParameterValue<int>("seed")) {}
+      seed_(ParameterValue<int>("seed")) {}
 
 std::unique_ptr<State> AddNoiseGame::NewInitialState() const {
   return std::make_unique<AddNoiseState>(shared_from_this(),
                                          game_->NewInitialState());
 }
 
-double AddNoiseGame::GetNoise(const AddNoiseState& state) {
-  std::string state_str = state.HistoryString();
-  auto it = noise_table_.find(state_str);
-  if (it != noise_table_.end()) {
-    return it->second;
-  }
-
+double AddNoiseGame::GetNoise(const AddNoiseState& state) const {
+  // Seed a generator from the terminal history and the game seed, as
+  // ExpectedReturnsOfDeterministicPoliciesFromSeeds does for its per-state
+  // action choices. This makes the noise a pure function of the history, so
+  // concurrent rollout workers read it without any shared mutable state.
+  auto history_seed = std::hash<std::string>{}(state.HistoryString());
+  history_seed += seed_;
+  std::mt19937 gen(history_seed);
   std::uniform_real_distribution<double> dist(-epsilon_, epsilon_);
-  double noise = dist(rng_);
-  noise_table_[state_str] = noise;
-  return noise;
+  return dist(gen);
 }
 
 double AddNoiseGame::MaxUtility() const {
@@ -101,8 +104,7 @@ std::vector<double> AddNoiseState::Returns() const {
   SPIEL_CHECK_EQ(returns.size(), 2);
 
   if (state_->IsTerminal()) {
-    auto const_noise_game = down_cast<const AddNoiseGame*>(game_.get());
-    AddNoiseGame* noise_game = const_cast<AddNoiseGame*>(const_noise_game);
+    auto noise_game = down_cast<const AddNoiseGame*>(game_.get());
     double noise = noise_game->GetNoise(*this);
     returns[0] += noise;
     returns[1] -= noise;
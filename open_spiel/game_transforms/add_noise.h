@@ -46,7 +46,12 @@ class AddNoiseGame : public WrappedGame {
   AddNoiseGame(std::shared_ptr<const Game> game, GameType game_type,
                GameParameters game_parameters);
   std::unique_ptr<State> NewInitialState() const override;
-  double GetNoise(const AddNoiseState& state);
+
+  // Returns the noise for the given terminal history. The noise is derived
+  // deterministically from the history and the game's seed, so calls are
+  // pure reads: no table, no lock, and the value does not depend on the
+  // order in which terminal histories are visited.
+  double GetNoise(const AddNoiseState& state) const;
 
   double MinUtility() const override;
 
@@ -54,8 +59,7 @@ class AddNoiseGame : public WrappedGame {
 
  private:
   const double epsilon_;
-  std::mt19937 rng_;
-  std::unordered_map<std::string, double> noise_table_;
+  const int seed_;
 };
 
 }  // namespace add_noise
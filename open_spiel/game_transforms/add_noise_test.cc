@@ -29,8 +29,38 @@ void BasicTests() {
       *LoadGame("add_noise(epsilon=1.,seed=1,game=kuhn_poker())"), 100);
 }
 
+void NoiseIsDeterministicPerHistoryTest() {
+  // The noise is a pure function of the terminal history and the seed, so
+  // two separately loaded games must agree on it, regardless of which
+  // terminal histories were evaluated before.
+  std::shared_ptr<const Game> game =
+      LoadGame("add_noise(epsilon=1.,seed=1,game=kuhn_poker())");
+  std::shared_ptr<const Game> other =
+      LoadGame("add_noise(epsilon=1.,seed=1,game=kuhn_poker())");
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::unique_ptr<State> other_state = other->NewInitialState();
+  for (Action action : {0, 1, 1, 1}) {
+    state->ApplyAction(action);
+    other_state->ApplyAction(action);
+  }
+  SPIEL_CHECK_TRUE(state->IsTerminal());
+  SPIEL_CHECK_TRUE(state->Returns() == other_state->Returns());
+
+  // Repeated queries on the same state agree as well, and a different seed
+  // gives different noise.
+  SPIEL_CHECK_TRUE(state->Returns() == state->Returns());
+  std::unique_ptr<State> reseeded_state =
+      LoadGame("add_noise(epsilon=1.,seed=2,game=kuhn_poker())")
+          ->NewInitialState();
+  for (Action action : {0, 1, 1, 1}) reseeded_state->ApplyAction(action);
+  SPIEL_CHECK_FALSE(state->Returns() == reseeded_state->Returns());
+}
+
 }  // namespace
 }  // namespace add_noise
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::add_noise::BasicTests(); }
+int main(int argc, char** argv) {
+  open_spiel::add_noise::BasicTests();
+  open_spiel::add_noise::NoiseIsDeterministicPerHistoryTest();
+}
@@ -14,7 +14,12 @@
 
 #include "open_spiel/game_transforms/coop_to_1p.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
 
 namespace open_spiel {
 namespace coop_to_1p {
@@ -60,6 +65,37 @@ CoopTo1pGame::CoopTo1pGame(std::shared_ptr<const Game> game, GameType game_type,
                            GameParameters game_parameters)
     : Game(game_type, game_parameters), game_(game) {}
 
+const std::vector<std::vector<Action>>& CoopTo1pGame::PossibleAssignments(
+    const State& underlying_state, Action prev_action) const {
+  SPIEL_DCHECK_FALSE(underlying_state.IsChanceNode());
+  std::pair<int, Action> key = {underlying_state.MoveNumber(), prev_action};
+  absl::MutexLock lock(&cache_mutex_);
+  auto iter = possible_assignments_.find(key);
+  if (iter == possible_assignments_.end()) {
+    std::vector<std::vector<Action>> assignments(game_->NumPlayers());
+    for (Player player = 0; player < game_->NumPlayers(); ++player) {
+      assignments[player] = underlying_state.LegalActions(player);
+      assignments[player].push_back(PlayerPrivate::kUnassigned);
+    }
+    iter = possible_assignments_.emplace(key, std::move(assignments)).first;
+  }
+  return iter->second;
+}
+
+const std::vector<std::string>& CoopTo1pGame::PrivateNames(
+    Player player, const State& chance_state) const {
+  absl::MutexLock lock(&cache_mutex_);
+  if (private_names_.empty()) private_names_.resize(game_->NumPlayers());
+  std::vector<std::string>& names = private_names_[player];
+  if (names.empty()) {
+    names.reserve(NumPrivates());
+    for (int i = 0; i < NumPrivates(); ++i) {
+      names.push_back(chance_state.ActionToString(kChancePlayerId, i));
+    }
+  }
+  return names;
+}
+
 std::unique_ptr<State> CoopTo1pState::Clone() const {
   return std::unique_ptr<State>(new CoopTo1pState(*this));
 }
@@ -97,10 +133,25 @@ std::string CoopTo1pState::AssignmentToString(Player player,
 std::string CoopTo1pState::Assignments() const {
   std::string str = "";
   Player current_player = state_->CurrentPlayer();
+  // The enumeration of possible privates is shared across every node at the
+  // same public state. While the underlying game is still dealing, its legal
+  // actions may depend on already-dealt (hidden) privates, so enumerate
+  // directly there instead of going through the game's cache.
+  std::vector<std::vector<Action>> local_assignments;
+  const std::vector<std::vector<Action>>* possible_assignments;
+  if (state_->IsChanceNode()) {
+    local_assignments.resize(privates_.size());
+    for (int player = 0; player < privates_.size(); ++player) {
+      local_assignments[player] = state_->LegalActions(player);
+      local_assignments[player].push_back(PlayerPrivate::kUnassigned);
+    }
+    possible_assignments = &local_assignments;
+  } else {
+    auto* game = down_cast<const CoopTo1pGame*>(game_.get());
+    possible_assignments = &game->PossibleAssignments(*state_, prev_action_);
+  }
   for (int player = 0; player < privates_.size(); ++player) {
-    auto possible_assignments = state_->LegalActions(player);
-    possible_assignments.push_back(PlayerPrivate::kUnassigned);
-    for (auto asignment : possible_assignments) {
+    for (auto asignment : (*possible_assignments)[player]) {
       absl::StrAppend(&str, "Player ", player);
       if (player == current_player) {
         absl::StrAppend(&str, " ", AssignmentToString(player, asignment), ":");
@@ -192,12 +243,13 @@ void CoopTo1pState::ObservationTensor(Player player,
 void CoopTo1pState::DoApplyAction(Action action_id) {
   if (IsChanceNode()) {
     // Assume this is the dealing of a private state. Capture info on possible
-    // privates here.
+    // privates here. The names are computed once per player position and
+    // shared by every node dealing that player's private.
     privates_.push_back(PlayerPrivate(num_privates_));
     actual_private_.push_back(action_id);
-    for (int i = 0; i < num_privates_; ++i) {
-      privates_.back().names[i] = state_->ActionToString(kChancePlayerId, i);
-    }
+    auto* game = down_cast<const CoopTo1pGame*>(game_.get());
+    privates_.back().names =
+        game->PrivateNames(privates_.size() - 1, *state_);
     state_->ApplyAction(action_id);
   } else {
     // Update the assignment and maybe act in the underlying game.
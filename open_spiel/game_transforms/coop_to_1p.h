@@ -16,7 +16,13 @@
 #define OPEN_SPIEL_GAME_TRANSFORMS_COOP_TO_1P_H_
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "open_spiel/abseil-cpp/absl/base/thread_annotations.h"
+#include "open_spiel/abseil-cpp/absl/container/node_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/game_transforms/game_wrapper.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -175,9 +181,34 @@ class CoopTo1pGame : public Game {
     return game_->UtilitySum();
   }
 
+  // The private states possible for every player at the given public state
+  // (the player's underlying legal actions, plus the kUnassigned bucket),
+  // memoized across all states of this game: sibling nodes at the same public
+  // state differ only in their assignments, so their enumerations are
+  // identical. Must not be called while the underlying state is still dealing
+  // privates, since legal actions there may depend on hidden information.
+  const std::vector<std::vector<Action>>& PossibleAssignments(
+      const State& underlying_state, Action prev_action) const;
+
+  // Names of the private states dealt to the given player (the chance action
+  // names, which map 1:1 to privates), computed once from the first state to
+  // reach that deal and shared by every other node dealing the same player.
+  const std::vector<std::string>& PrivateNames(
+      Player player, const State& chance_state) const;
+
  private:
   std::shared_ptr<const Game> game_;
   int NumPrivates() const { return game_->MaxChanceOutcomes(); }
+
+  // Keyed by (underlying move number, last underlying action), which under
+  // the transform's assumptions pins down the public state. node_hash_map so
+  // returned references stay valid as other public states are added.
+  mutable absl::Mutex cache_mutex_;
+  mutable absl::node_hash_map<std::pair<int, Action>,
+                              std::vector<std::vector<Action>>>
+      possible_assignments_ ABSL_GUARDED_BY(cache_mutex_);
+  mutable std::vector<std::vector<std::string>> private_names_
+      ABSL_GUARDED_BY(cache_mutex_);
 };
 
 }  // namespace coop_to_1p
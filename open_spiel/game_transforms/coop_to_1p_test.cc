@@ -29,8 +29,38 @@ void BasicTests() {
                          100);
 }
 
+void CachedEnumerationTest() {
+  // States must look the same whether the game's public-state caches are warm
+  // (entries left behind by earlier trajectories) or cold (a freshly loaded
+  // game).
+  std::shared_ptr<const Game> warm = LoadGame("coop_to_1p(game=tiny_hanabi())");
+  for (int trial = 0; trial < 3; ++trial) {
+    std::shared_ptr<const Game> cold =
+        LoadGame("coop_to_1p(game=tiny_hanabi())");
+    std::unique_ptr<State> warm_state = warm->NewInitialState();
+    std::unique_ptr<State> cold_state = cold->NewInitialState();
+    int step = 0;
+    while (!warm_state->IsTerminal()) {
+      SPIEL_CHECK_EQ(warm_state->ToString(), cold_state->ToString());
+      if (warm_state->CurrentPlayer() == kPlayerId) {
+        SPIEL_CHECK_EQ(warm_state->ObservationString(kPlayerId),
+                       cold_state->ObservationString(kPlayerId));
+      }
+      std::vector<Action> legal = warm_state->LegalActions();
+      Action action = legal[(step + trial) % legal.size()];
+      warm_state->ApplyAction(action);
+      cold_state->ApplyAction(action);
+      ++step;
+    }
+    SPIEL_CHECK_EQ(warm_state->ToString(), cold_state->ToString());
+  }
+}
+
 }  // namespace
 }  // namespace coop_to_1p
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::coop_to_1p::BasicTests(); }
+int main(int argc, char** argv) {
+  open_spiel::coop_to_1p::BasicTests();
+  open_spiel::coop_to_1p::CachedEnumerationTest();
+}
@@ -15,11 +15,11 @@
 #include "open_spiel/game_transforms/efg_writer.h"
 
 #include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <memory>
 
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/format_double.h"
 
 namespace open_spiel {
 
@@ -63,7 +63,7 @@ void EFGWriter::Write(std::ostream& f, const State& state) {
     f << " \"\" ";
     f << "{ ";
     for (auto r : state.Returns()) {
-      f << r << " ";
+      f << ShortestDoubleToString(r) << " ";
     }
     f << "}\n";
     return;
@@ -79,7 +79,9 @@ void EFGWriter::Write(std::ostream& f, const State& state) {
       } else {
         f << '"' << action_and_probs.first << "\" ";
       }
-      f << std::setprecision(10) << action_and_probs.second << " ";
+      // Shortest round-trip form: an EFG importer recovers the exact
+      // probability, and conversion is much cheaper than the iostream path.
+      f << ShortestDoubleToString(action_and_probs.second) << " ";
     }
     f << "} 0\n";
   } else {
@@ -15,85 +15,188 @@
 #ifndef OPEN_SPIEL_GAME_TRANSFORMS_GAME_WRAPPER_H_
 #define OPEN_SPIEL_GAME_TRANSFORMS_GAME_WRAPPER_H_
 
+#include <type_traits>
+#include <typeinfo>
+
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
+#include "open_spiel/spiel_utils.h"
 
 // Wraps a game, forwarding everything to the original implementation.
 // Transforms can inherit from this, overriding only what they need.
+//
+// WrappedStateT/WrappedGameT are templated on the type of the wrapped
+// state/game. With the defaults (WrappedState/WrappedGame below) forwarding
+// goes through ordinary virtual dispatch and the wrapped object may be of any
+// type, as before. Instantiating them with the concrete wrapped type instead
+// (e.g. WrappedStateT<tic_tac_toe::TicTacToeState>) makes every forwarded
+// call a qualified, compile-time-bound call that the compiler can inline, so
+// stacking transforms does not pay one virtual hop per layer per call. In
+// that case the wrapped object must be of exactly that type -- not a further
+// derived one, since qualified calls bypass its overrides; this is checked at
+// construction in debug builds.
 
 namespace open_spiel {
 
-class WrappedState : public State {
+template <class WrappedType = State>
+class WrappedStateT : public State {
  public:
-  WrappedState(std::shared_ptr<const Game> game, std::unique_ptr<State> state)
-      : State(game), state_(std::move(state)) {}
-  WrappedState(const WrappedState& other)
-      : State(other), state_(other.state_->Clone()) {}
-
-  Player CurrentPlayer() const override { return state_->CurrentPlayer(); }
+  // Qualified calls through the concrete type would bypass overrides of
+  // anything derived from WrappedType, and calling State:: members that are
+  // pure virtual is not possible at all, so the default instantiation
+  // dispatches virtually.
+  static constexpr bool kStaticDispatch = !std::is_same_v<WrappedType, State>;
+
+  WrappedStateT(std::shared_ptr<const Game> game,
+                std::unique_ptr<WrappedType> state)
+      : State(game), state_(std::move(state)) {
+    if constexpr (kStaticDispatch) {
+      SPIEL_DCHECK_TRUE(typeid(*state_) == typeid(WrappedType));
+    }
+  }
+  WrappedStateT(const WrappedStateT& other)
+      : State(other),
+        state_(down_cast<WrappedType*>(other.state_->Clone().release())) {}
+
+  Player CurrentPlayer() const override {
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::CurrentPlayer();
+    } else {
+      return state_->CurrentPlayer();
+    }
+  }
 
   std::vector<Action> LegalActions(Player player) const override {
-    return state_->LegalActions(player);
+    // Always a virtual call through the State interface: most games override
+    // only the zero-argument overload, which hides this overload's default in
+    // State from name lookup on WrappedType.
+    return static_cast<const State*>(state_.get())->LegalActions(player);
   }
 
   std::vector<Action> LegalActions() const override {
-    return state_->LegalActions();
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::LegalActions();
+    } else {
+      return state_->LegalActions();
+    }
   }
 
   std::string ActionToString(Player player, Action action_id) const override {
-    return state_->ActionToString(player, action_id);
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::ActionToString(player, action_id);
+    } else {
+      return state_->ActionToString(player, action_id);
+    }
   }
 
-  std::string ToString() const override { return state_->ToString(); }
+  std::string ToString() const override {
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::ToString();
+    } else {
+      return state_->ToString();
+    }
+  }
 
-  bool IsTerminal() const override { return state_->IsTerminal(); }
+  bool IsTerminal() const override {
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::IsTerminal();
+    } else {
+      return state_->IsTerminal();
+    }
+  }
 
-  std::vector<double> Rewards() const override { return state_->Rewards(); }
+  std::vector<double> Rewards() const override {
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::Rewards();
+    } else {
+      return state_->Rewards();
+    }
+  }
 
-  std::vector<double> Returns() const override { return state_->Returns(); }
+  std::vector<double> Returns() const override {
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::Returns();
+    } else {
+      return state_->Returns();
+    }
+  }
 
   std::string InformationStateString(Player player) const override {
-    return state_->InformationStateString(player);
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::InformationStateString(player);
+    } else {
+      return state_->InformationStateString(player);
+    }
   }
 
   void InformationStateTensor(Player player,
                               absl::Span<float> values) const override {
-    state_->InformationStateTensor(player, values);
+    if constexpr (kStaticDispatch) {
+      state_->WrappedType::InformationStateTensor(player, values);
+    } else {
+      state_->InformationStateTensor(player, values);
+    }
   }
 
   std::string ObservationString(Player player) const override {
-    return state_->ObservationString(player);
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::ObservationString(player);
+    } else {
+      return state_->ObservationString(player);
+    }
   }
 
   void ObservationTensor(Player player,
                          absl::Span<float> values) const override {
-    state_->ObservationTensor(player, values);
+    if constexpr (kStaticDispatch) {
+      state_->WrappedType::ObservationTensor(player, values);
+    } else {
+      state_->ObservationTensor(player, values);
+    }
   }
 
   std::unique_ptr<State> Clone() const override = 0;
 
   void UndoAction(Player player, Action action) override {
-    state_->UndoAction(player, action);
+    if constexpr (kStaticDispatch) {
+      state_->WrappedType::UndoAction(player, action);
+    } else {
+      state_->UndoAction(player, action);
+    }
     history_.pop_back();
   }
 
   ActionsAndProbs ChanceOutcomes() const override {
-    return state_->ChanceOutcomes();
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::ChanceOutcomes();
+    } else {
+      return state_->ChanceOutcomes();
+    }
   }
 
   std::vector<Action> LegalChanceOutcomes() const override {
-    return state_->LegalChanceOutcomes();
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::LegalChanceOutcomes();
+    } else {
+      return state_->LegalChanceOutcomes();
+    }
   }
 
-  const State& GetWrappedState() const { return *state_; }
+  const WrappedType& GetWrappedState() const { return *state_; }
 
   std::vector<Action> ActionsConsistentWithInformationFrom(
       Action action) const override {
-    return state_->ActionsConsistentWithInformationFrom(action);
+    if constexpr (kStaticDispatch) {
+      return state_->WrappedType::ActionsConsistentWithInformationFrom(action);
+    } else {
+      return state_->ActionsConsistentWithInformationFrom(action);
+    }
   }
 
  protected:
   void DoApplyAction(Action action_id) override {
+    // State::ApplyAction is non-virtual; it maintains the wrapped state's
+    // history and dispatches to its DoApplyAction internally.
     state_->ApplyAction(action_id);
   }
 
@@ -101,55 +204,128 @@ class WrappedState : public State {
     state_->ApplyActions(actions);
   }
 
-  std::unique_ptr<State> state_;
+  std::unique_ptr<WrappedType> state_;
 };
 
-class WrappedGame : public Game {
+using WrappedState = WrappedStateT<>;
+
+template <class WrappedType = Game>
+class WrappedGameT : public Game {
  public:
-  WrappedGame(std::shared_ptr<const Game> game, GameType game_type,
-              GameParameters game_parameters)
-      : Game(game_type, game_parameters), game_(game) {}
+  static constexpr bool kStaticDispatch = !std::is_same_v<WrappedType, Game>;
+
+  WrappedGameT(std::shared_ptr<const WrappedType> game, GameType game_type,
+               GameParameters game_parameters)
+      : Game(game_type, game_parameters), game_(game) {
+    if constexpr (kStaticDispatch) {
+      SPIEL_DCHECK_TRUE(typeid(*game_) == typeid(WrappedType));
+    }
+  }
 
   int NumDistinctActions() const override {
-    return game_->NumDistinctActions();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::NumDistinctActions();
+    } else {
+      return game_->NumDistinctActions();
+    }
   }
 
   std::unique_ptr<State> NewInitialState() const override = 0;
 
-  int MaxChanceOutcomes() const override { return game_->MaxChanceOutcomes(); }
-  int NumPlayers() const override { return game_->NumPlayers(); }
-  double MinUtility() const override { return game_->MinUtility(); }
-  double MaxUtility() const override { return game_->MaxUtility(); }
+  int MaxChanceOutcomes() const override {
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::MaxChanceOutcomes();
+    } else {
+      return game_->MaxChanceOutcomes();
+    }
+  }
+  int NumPlayers() const override {
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::NumPlayers();
+    } else {
+      return game_->NumPlayers();
+    }
+  }
+  double MinUtility() const override {
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::MinUtility();
+    } else {
+      return game_->MinUtility();
+    }
+  }
+  double MaxUtility() const override {
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::MaxUtility();
+    } else {
+      return game_->MaxUtility();
+    }
+  }
   absl::optional<double> UtilitySum() const override {
-    return game_->UtilitySum();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::UtilitySum();
+    } else {
+      return game_->UtilitySum();
+    }
   }
 
   std::vector<int> InformationStateTensorShape() const override {
-    return game_->InformationStateTensorShape();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::InformationStateTensorShape();
+    } else {
+      return game_->InformationStateTensorShape();
+    }
   }
 
   std::vector<int> ObservationTensorShape() const override {
-    return game_->ObservationTensorShape();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::ObservationTensorShape();
+    } else {
+      return game_->ObservationTensorShape();
+    }
   }
 
   TensorLayout InformationStateTensorLayout() const override {
-    return game_->InformationStateTensorLayout();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::InformationStateTensorLayout();
+    } else {
+      return game_->InformationStateTensorLayout();
+    }
   }
   TensorLayout ObservationTensorLayout() const override {
-    return game_->ObservationTensorLayout();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::ObservationTensorLayout();
+    } else {
+      return game_->ObservationTensorLayout();
+    }
   }
   std::vector<int> PolicyTensorShape() const override {
-    return game_->PolicyTensorShape();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::PolicyTensorShape();
+    } else {
+      return game_->PolicyTensorShape();
+    }
+  }
+  int MaxGameLength() const override {
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::MaxGameLength();
+    } else {
+      return game_->MaxGameLength();
+    }
   }
-  int MaxGameLength() const override { return game_->MaxGameLength(); }
   int MaxChanceNodesInHistory() const override {
-    return game_->MaxChanceNodesInHistory();
+    if constexpr (kStaticDispatch) {
+      return game_->WrappedType::MaxChanceNodesInHistory();
+    } else {
+      return game_->MaxChanceNodesInHistory();
+    }
   }
 
  protected:
-  std::shared_ptr<const Game> game_;
+  std::shared_ptr<const WrappedType> game_;
 };
 
+using WrappedGame = WrappedGameT<>;
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_GAME_TRANSFORMS_GAME_WRAPPER_H_
@@ -0,0 +1,97 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/game_transforms/game_wrapper.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+// A pass-through wrapper with compile-time-bound forwarding into the concrete
+// wrapped state type.
+class StaticTicTacToeState : public WrappedStateT<tic_tac_toe::TicTacToeState> {
+ public:
+  using WrappedStateT<tic_tac_toe::TicTacToeState>::WrappedStateT;
+
+  std::unique_ptr<State> Clone() const override {
+    return std::unique_ptr<State>(new StaticTicTacToeState(*this));
+  }
+};
+
+// A second static layer stacked on the first, negating the returns, as the
+// misere transform does. Both layers forward without virtual dispatch.
+class StaticMisereState : public WrappedStateT<StaticTicTacToeState> {
+ public:
+  using WrappedStateT<StaticTicTacToeState>::WrappedStateT;
+
+  std::vector<double> Returns() const override {
+    std::vector<double> returns =
+        WrappedStateT<StaticTicTacToeState>::Returns();
+    for (double& value : returns) value = -value;
+    return returns;
+  }
+
+  std::unique_ptr<State> Clone() const override {
+    return std::unique_ptr<State>(new StaticMisereState(*this));
+  }
+};
+
+void StaticDispatchWrapperTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> reference = game->NewInitialState();
+  auto concrete = std::unique_ptr<tic_tac_toe::TicTacToeState>(
+      down_cast<tic_tac_toe::TicTacToeState*>(
+          game->NewInitialState().release()));
+  StaticMisereState wrapped(
+      game, std::make_unique<StaticTicTacToeState>(game, std::move(concrete)));
+
+  while (!reference->IsTerminal()) {
+    SPIEL_CHECK_FALSE(wrapped.IsTerminal());
+    SPIEL_CHECK_EQ(wrapped.CurrentPlayer(), reference->CurrentPlayer());
+    SPIEL_CHECK_EQ(wrapped.ToString(), reference->ToString());
+    SPIEL_CHECK_TRUE(wrapped.LegalActions() == reference->LegalActions());
+    SPIEL_CHECK_EQ(wrapped.ObservationString(reference->CurrentPlayer()),
+                   reference->ObservationString(reference->CurrentPlayer()));
+    Action action = reference->LegalActions()[0];
+    reference->ApplyAction(action);
+    wrapped.ApplyAction(action);
+  }
+  SPIEL_CHECK_TRUE(wrapped.IsTerminal());
+
+  std::vector<double> reference_returns = reference->Returns();
+  std::vector<double> wrapped_returns = wrapped.Returns();
+  SPIEL_CHECK_EQ(wrapped_returns.size(), reference_returns.size());
+  for (int p = 0; p < reference_returns.size(); ++p) {
+    SPIEL_CHECK_EQ(wrapped_returns[p], -reference_returns[p]);
+  }
+
+  // Cloning preserves both layers.
+  std::unique_ptr<State> clone = wrapped.Clone();
+  SPIEL_CHECK_EQ(clone->ToString(), wrapped.ToString());
+  SPIEL_CHECK_TRUE(clone->Returns() == wrapped_returns);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::StaticDispatchWrapperTest();
+}
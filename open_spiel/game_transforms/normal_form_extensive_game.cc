@@ -14,9 +14,16 @@
 
 #include "open_spiel/game_transforms/normal_form_extensive_game.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "open_spiel/algorithms/deterministic_policy.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 
@@ -51,43 +58,91 @@ std::shared_ptr<const Game> Factory(const GameParameters& params) {
 
 REGISTER_SPIEL_GAME(kGameType, Factory);
 
-std::shared_ptr<const TensorGame> ExtensiveToTensorGame(const Game& game) {
-  std::vector<std::vector<std::string>> action_names(game.NumPlayers());
+std::shared_ptr<const TensorGame> ExtensiveToTensorGame(const Game& game,
+                                                        int num_threads) {
+  const int num_players = game.NumPlayers();
+  std::vector<std::vector<std::string>> action_names(num_players);
 
   GameType type = game.GetType();
 
-  std::vector<algorithms::DeterministicTabularPolicy> policies;
-  for (Player player = 0; player < game.NumPlayers(); ++player) {
+  for (Player player = 0; player < num_players; ++player) {
     algorithms::DeterministicTabularPolicy policy(game, player);
     do {
       action_names[player].push_back(policy.ToString(/*delimiter=*/" --- "));
     } while (policy.NextPolicy());
-    policy.ResetDefaultPolicy();
-    policies.push_back(policy);
   }
-  std::vector<const Policy*> policy_ptrs(policies.size());
-    for (Player player = 0; player < game.NumPlayers(); ++player) {
+
+  // Cells are indexed in the odometer order of the per-player policies, with
+  // the last player's policy varying fastest.
+  int64_t total_cells = 1;
+  std::vector<int64_t> strides(num_players);
+  for (Player player = num_players - 1; player >= 0; --player) {
+    strides[player] = total_cells;
+    total_cells *= action_names[player].size();
+  }
+
+  std::vector<std::vector<double>> utils(
+      num_players, std::vector<double>(total_cells));
+
+  // Fills the cells in [begin, end). Cells are independent, so ranges can run
+  // concurrently; each range has its own policies, root state and returns
+  // cache. The cache is passed with a fresh version per cell: only subtree
+  // values that do not depend on any policy (chance-only subtrees) carry over
+  // between cells, which is exactly what is shared when neighboring cells
+  // differ in one player's policy.
+  auto fill_cells = [&game, &action_names, &strides, &utils,
+                     num_players](int64_t begin, int64_t end) {
+    std::vector<algorithms::DeterministicTabularPolicy> policies;
+    policies.reserve(num_players);
+    std::vector<const Policy*> policy_ptrs(num_players);
+    for (Player player = 0; player < num_players; ++player) {
+      policies.emplace_back(game, player);
+      const int64_t policy_index =
+          (begin / strides[player]) %
+          static_cast<int64_t>(action_names[player].size());
+      for (int64_t i = 0; i < policy_index; ++i) {
+        SPIEL_CHECK_TRUE(policies.back().NextPolicy());
+      }
       policy_ptrs[player] = &policies[player];
     }
-  const std::unique_ptr<State> initial_state = game.NewInitialState();
-  std::vector<std::vector<double>> utils(game.NumPlayers());
-  bool last_entry;
-  do {
-    std::vector<double> returns = algorithms::ExpectedReturns(
-        *initial_state, policy_ptrs, /*depth_limit=*/-1);
-    for (Player player = 0; player < game.NumPlayers(); ++player) {
-      utils[player].push_back(returns[player]);
-    }
-    last_entry = true;
-    for (auto policy = policies.rbegin(); policy != policies.rend(); ++policy) {
-      if (policy->NextPolicy()) {
-        last_entry = false;
-        break;
-      } else {
-        policy->ResetDefaultPolicy();
+    const std::unique_ptr<State> initial_state = game.NewInitialState();
+    algorithms::ExpectedReturnsCache cache;
+    for (int64_t cell = begin; cell < end; ++cell) {
+      std::vector<double> returns = algorithms::MemoizedExpectedReturns(
+          *initial_state, policy_ptrs, &cache, /*policy_version=*/cell + 1);
+      for (Player player = 0; player < num_players; ++player) {
+        utils[player][cell] = returns[player];
+      }
+      for (auto policy = policies.rbegin(); policy != policies.rend();
+           ++policy) {
+        if (policy->NextPolicy()) {
+          break;
+        } else {
+          policy->ResetDefaultPolicy();
+        }
       }
     }
-  } while (!last_entry);
+  };
+
+  const int num_workers = std::max<int64_t>(
+      1, std::min<int64_t>(num_threads, total_cells));
+  if (num_workers <= 1) {
+    fill_cells(0, total_cells);
+  } else {
+    const int64_t cells_per_worker =
+        (total_cells + num_workers - 1) / num_workers;
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int w = 0; w < num_workers; ++w) {
+      const int64_t begin = w * cells_per_worker;
+      const int64_t end = std::min<int64_t>(begin + cells_per_worker,
+                                            total_cells);
+      workers.emplace_back([&fill_cells, begin, end]() {
+        fill_cells(begin, end);
+      });
+    }
+    for (Thread& worker : workers) worker.join();
+  }
 
   return tensor_game::CreateTensorGame(kGameType.short_name,
                                        "Normal-form " + type.long_name,
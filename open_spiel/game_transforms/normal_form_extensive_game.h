@@ -37,9 +37,12 @@ namespace open_spiel {
 //
 // Hence, this method should only be used for  small games! For example, Kuhn
 // poker has 64 deterministic policies, resulting in a 64-by-64 matrix.
+//
+// The payoff tensor cells are independent, so with num_threads > 1 they are
+// filled by that many worker threads over contiguous ranges of cells.
 
 std::shared_ptr<const tensor_game::TensorGame> ExtensiveToTensorGame(
-    const Game& game);
+    const Game& game, int num_threads = 1);
 
 }  // namespace open_spiel
 
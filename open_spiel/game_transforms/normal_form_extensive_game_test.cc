@@ -28,9 +28,24 @@ void ExtensiveToTensorGameTest() {
   SPIEL_CHECK_EQ(auction_tensor_game->Shape()[2], 24);
 }
 
+void ParallelExtensiveToTensorGameTest() {
+  // The parallel fill must produce exactly the same tensor as the serial one.
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  std::shared_ptr<const tensor_game::TensorGame> serial =
+      ExtensiveToTensorGame(*game);
+  std::shared_ptr<const tensor_game::TensorGame> parallel =
+      ExtensiveToTensorGame(*game, /*num_threads=*/3);
+  SPIEL_CHECK_TRUE(serial->Shape() == parallel->Shape());
+  for (Player player = 0; player < game->NumPlayers(); ++player) {
+    SPIEL_CHECK_TRUE(serial->PlayerUtilities(player) ==
+                     parallel->PlayerUtilities(player));
+  }
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::ExtensiveToTensorGameTest();
+  open_spiel::ParallelExtensiveToTensorGameTest();
 }
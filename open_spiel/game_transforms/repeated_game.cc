@@ -14,6 +14,8 @@
 
 #include "open_spiel/game_transforms/repeated_game.h"
 
+#include <algorithm>
+
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/spiel.h"
@@ -66,8 +68,16 @@ RepeatedState::RepeatedState(std::shared_ptr<const Game> game,
       stage_game_state_(stage_game->NewInitialState()),
       num_repetitions_(num_repetitions),
       recall_(recall) {
-  actions_history_.reserve(num_repetitions_);
-  rewards_history_.reserve(num_repetitions_);
+  round_tensor_size_ = 0;
+  player_action_counts_.reserve(num_players_);
+  for (int i = 0; i < num_players_; ++i) {
+    player_action_counts_.push_back(stage_game_state_->LegalActions(i).size());
+    round_tensor_size_ += player_action_counts_[i];
+  }
+  actions_history_.reserve(num_repetitions_ * num_players_);
+  rewards_history_.reserve(num_repetitions_ * num_players_);
+  returns_.assign(num_players_, 0.0);
+  obs_window_.assign(recall_ * round_tensor_size_, 0.0);
 }
 
 void RepeatedState::DoApplyActions(const std::vector<Action>& actions) {
@@ -77,24 +87,40 @@ void RepeatedState::DoApplyActions(const std::vector<Action>& actions) {
   std::unique_ptr<State> stage_game_state = stage_game_state_->Clone();
   stage_game_state->ApplyActions(actions);
   SPIEL_CHECK_TRUE(stage_game_state->IsTerminal());
-  actions_history_.push_back(actions);
-  rewards_history_.push_back(stage_game_state->Returns());
+  actions_history_.insert(actions_history_.end(), actions.begin(),
+                          actions.end());
+  std::vector<double> rewards = stage_game_state->Returns();
+  for (int i = 0; i < num_players_; ++i) returns_[i] += rewards[i];
+  rewards_history_.insert(rewards_history_.end(), rewards.begin(),
+                          rewards.end());
+
+  // Advance the observation window: overwrite the oldest slot with this
+  // round's one-hot encoding.
+  obs_window_head_ = (obs_window_head_ + 1) % recall_;
+  float* slot = obs_window_.data() + obs_window_head_ * round_tensor_size_;
+  std::fill(slot, slot + round_tensor_size_, 0.0);
+  int offset = 0;
+  for (int i = 0; i < num_players_; ++i) {
+    slot[offset + actions[i]] = 1.0;
+    offset += player_action_counts_[i];
+  }
 }
 
 std::string RepeatedState::ToString() const {
   std::string rv;
-  for (int i = 0; i < actions_history_.size(); ++i) {
+  for (int i = 0; i < NumRounds(); ++i) {
     absl::StrAppend(&rv, "Round ", i, ":\n");
     absl::StrAppend(&rv, "Actions: ");
     for (int j = 0; j < num_players_; ++j) {
-      absl::StrAppend(
-          &rv, stage_game_state_->ActionToString(j, actions_history_[i][j]),
-          " ");
+      absl::StrAppend(&rv,
+                      stage_game_state_->ActionToString(
+                          j, actions_history_[i * num_players_ + j]),
+                      " ");
     }
     absl::StrAppend(&rv, "\n");
     absl::StrAppend(&rv, "Rewards: ");
-    for (auto player_reward : rewards_history_[i])
-      absl::StrAppend(&rv, player_reward, " ");
+    for (int j = 0; j < num_players_; ++j)
+      absl::StrAppend(&rv, rewards_history_[i * num_players_ + j], " ");
     absl::StrAppend(&rv, "\n");
   }
   absl::StrAppend(&rv, "Total Returns: ");
@@ -103,32 +129,27 @@ std::string RepeatedState::ToString() const {
 }
 
 bool RepeatedState::IsTerminal() const {
-  return actions_history_.size() == num_repetitions_;
+  return NumRounds() == num_repetitions_;
 }
 
 std::vector<double> RepeatedState::Rewards() const {
-  return rewards_history_.empty() ? std::vector<double>(num_players_, 0.0)
-                                  : rewards_history_.back();
+  return rewards_history_.empty()
+             ? std::vector<double>(num_players_, 0.0)
+             : std::vector<double>(rewards_history_.end() - num_players_,
+                                   rewards_history_.end());
 }
 
-std::vector<double> RepeatedState::Returns() const {
-  std::vector<double> returns(num_players_, 0.0);
-  for (auto rewards : rewards_history_) {
-    for (int i = 0; i < rewards.size(); ++i) {
-      returns[i] += rewards[i];
-    }
-  }
-  return returns;
-}
+std::vector<double> RepeatedState::Returns() const { return returns_; }
 
 std::string RepeatedState::InformationStateString(Player /*player*/) const {
   std::string rv;
   if (actions_history_.empty()) return rv;
-  for (int j = 0; j < actions_history_.size(); ++j) {
+  for (int j = 0; j < NumRounds(); ++j) {
     for (int i = 0; i < num_players_; ++i) {
-      absl::StrAppend(
-          &rv, stage_game_state_->ActionToString(i, actions_history_[j][i]),
-          " ");
+      absl::StrAppend(&rv,
+                      stage_game_state_->ActionToString(
+                          i, actions_history_[j * num_players_ + i]),
+                      " ");
     }
     absl::StrAppend(&rv, ";");
   }
@@ -140,16 +161,15 @@ std::string RepeatedState::ObservationString(Player /*player*/) const {
   if (actions_history_.empty()) { return rv; }
 
   // Starting from the back of the history, show each player's moves:
-  for (int j = 0;
-       j < recall_ && static_cast<int>(actions_history_.size()) - 1 - j >= 0;
-       ++j) {
-    int hist_idx = actions_history_.size() - 1 - j;
+  for (int j = 0; j < recall_ && NumRounds() - 1 - j >= 0; ++j) {
+    int hist_idx = NumRounds() - 1 - j;
     SPIEL_CHECK_GE(hist_idx, 0);
-    SPIEL_CHECK_LT(hist_idx, actions_history_.size());
+    SPIEL_CHECK_LT(hist_idx, NumRounds());
     for (int i = 0; i < num_players_; ++i) {
       absl::StrAppend(&rv,
-          stage_game_state_->ActionToString(i, actions_history_[hist_idx][i]),
-          " ");
+                      stage_game_state_->ActionToString(
+                          i, actions_history_[hist_idx * num_players_ + i]),
+                      " ");
     }
   }
   return rv;
@@ -165,10 +185,10 @@ void RepeatedState::InformationStateTensor(Player player,
   if (actions_history_.empty()) return;
 
   auto ptr = values.begin();
-  for (int j = 0; j < actions_history_.size(); ++j) {
+  for (int j = 0; j < NumRounds(); ++j) {
     for (int i = 0; i < num_players_; ++i) {
-      ptr[actions_history_[j][i]] = 1;
-      ptr += stage_game_state_->LegalActions(i).size();
+      ptr[actions_history_[j * num_players_ + i]] = 1;
+      ptr += player_action_counts_[i];
     }
   }
 }
@@ -182,18 +202,14 @@ void RepeatedState::ObservationTensor(Player player,
   std::fill(values.begin(), values.end(), 0.0);
   if (actions_history_.empty()) return;
 
+  // Copy the rolling window maintained in DoApplyActions, most recent round
+  // first, matching the layout the per-round reconstruction used to produce.
   auto ptr = values.begin();
-  // Starting from the back of the history, show each player's moves:
-  for (int j = 0;
-       j < recall_ && static_cast<int>(actions_history_.size()) - 1 - j >= 0;
-       j++) {
-    int hist_idx = static_cast<int>(actions_history_.size()) - 1 - j;
-    SPIEL_CHECK_GE(hist_idx, 0);
-    SPIEL_CHECK_LT(hist_idx, actions_history_.size());
-    for (int i = 0; i < num_players_; ++i) {
-      ptr[actions_history_[hist_idx][i]] = 1;
-      ptr += stage_game_state_->LegalActions(i).size();
-    }
+  for (int j = 0; j < recall_ && j < NumRounds(); ++j) {
+    int slot = (obs_window_head_ - j + recall_) % recall_;
+    std::copy(obs_window_.begin() + slot * round_tensor_size_,
+              obs_window_.begin() + (slot + 1) * round_tensor_size_, ptr);
+    ptr += round_tensor_size_;
   }
 
   SPIEL_CHECK_LE(ptr, values.end());
@@ -67,14 +67,36 @@ class RepeatedState : public SimMoveState {
   void ObliviousObservationTensor(Player player,
                                   absl::Span<float> values) const;
 
+  // Number of rounds played so far.
+  int NumRounds() const {
+    return static_cast<int>(actions_history_.size()) / num_players_;
+  }
+
   std::shared_ptr<const Game> stage_game_;
   // Store a reference initial state of the stage game for efficient calls
   // to state functions (e.g. LegalActions()).
   std::shared_ptr<const State> stage_game_state_;
   int num_repetitions_;
   int recall_;
-  std::vector<std::vector<Action>> actions_history_{};
-  std::vector<std::vector<double>> rewards_history_{};
+  // Number of legal actions of each player in the stage game, and their sum
+  // (the length of one round's one-hot segment in the tensors), cached at
+  // construction so the tensor fills do not rebuild legal action vectors.
+  std::vector<int> player_action_counts_;
+  int round_tensor_size_;
+  // Round history stored flat: round r occupies indices
+  // [r * num_players_, (r + 1) * num_players_) of both vectors, avoiding one
+  // heap vector per round over long horizons.
+  std::vector<Action> actions_history_{};
+  std::vector<double> rewards_history_{};
+  // Running sum of rewards_history_ per player, so Returns() does not rescan
+  // the whole history.
+  std::vector<double> returns_;
+  // Rolling window holding the one-hot encodings of the last recall_ rounds
+  // as a ring buffer of recall_ slots of round_tensor_size_ floats each,
+  // updated in O(round_tensor_size_) per round regardless of the horizon.
+  // obs_window_head_ is the slot holding the most recent round.
+  std::vector<float> obs_window_;
+  int obs_window_head_ = -1;
 };
 
 class RepeatedGame : public SimMoveGame {
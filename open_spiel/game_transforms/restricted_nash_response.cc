@@ -136,13 +136,12 @@ class RestrictedNashResponseObserver : public Observer {
 
 RestrictedNashResponseState::RestrictedNashResponseState(
     std::shared_ptr<const Game> game, std::unique_ptr<State> state, bool fixed,
-    Player fixed_player, bool initial_state, double p,
+    Player fixed_player, bool initial_state,
     std::shared_ptr<Policy> fixed_policy)
     : State(std::move(game)),
       state_(std::move(state)),
       is_initial_(initial_state),
       fixed_(fixed),
-      p_(p),
       fixed_player_(fixed_player),
       fixed_policy_(fixed_policy),
       use_fixed_policy_(fixed_policy) {}
@@ -179,7 +178,10 @@ void RestrictedNashResponseState::DoApplyActions(
 std::vector<std::pair<Action, double>>
 RestrictedNashResponseState::ChanceOutcomes() const {
   if (is_initial_) {
-    return {{Action(kFixedAction), p_}, {Action(kFreeAction), 1 - p_}};
+    // p is read through the game so that SetP sweeps need no state rebuilds.
+    const double p =
+        open_spiel::down_cast<const RestrictedNashResponseGame &>(*game_).p();
+    return {{Action(kFixedAction), p}, {Action(kFreeAction), 1 - p}};
   } else {
     if (state_->IsChanceNode()) {
       return state_->ChanceOutcomes();
@@ -306,7 +308,6 @@ RestrictedNashResponseState::RestrictedNashResponseState(
       state_(other.state_->Clone()),
       is_initial_(other.is_initial_),
       fixed_(other.fixed_),
-      p_(other.p_),
       fixed_player_(other.fixed_player_),
       fixed_policy_(other.fixed_policy_),
       use_fixed_policy_(other.use_fixed_policy_) {}
@@ -41,7 +41,7 @@ class RestrictedNashResponseState : public State {
  public:
   RestrictedNashResponseState(std::shared_ptr<const Game> game,
                               std::unique_ptr<State> state, bool fixed,
-                              Player fixed_player, bool initial_state, double p,
+                              Player fixed_player, bool initial_state,
                               std::shared_ptr<Policy> fixed_policy);
 
   RestrictedNashResponseState(const RestrictedNashResponseState &other);
@@ -98,8 +98,9 @@ class RestrictedNashResponseState : public State {
   // part is fixed or not.
   bool is_initial_;
   bool fixed_;
-  // Constants representing p value and the player who is fixed.
-  const double p_;
+  // Constant representing the player who is fixed. The p value lives in the
+  // game (see RestrictedNashResponseGame::SetP) and is read through it, so
+  // one game (and the states built over it) can be reused across a sweep.
   const Player fixed_player_;
   // Constants for the fixed strategy and if we use explicit fixed strategy
   std::shared_ptr<Policy> fixed_policy_;
@@ -118,7 +119,20 @@ class RestrictedNashResponseGame : public WrappedGame {
   std::unique_ptr<State> NewInitialState() const override {
     return std::unique_ptr<State>(new RestrictedNashResponseState(
         shared_from_this(), game_->NewInitialState(), false, fixed_player_,
-        true, p_, fixed_policy_));
+        true, fixed_policy_));
+  }
+
+  // The exploitation level p: the probability with which the initial chance
+  // node enters the fixed part of the tree. States read it through the game,
+  // so a sweep over exploitation levels can call SetP on one game and reuse
+  // it (and any states or solver structures built over it); the new chance
+  // weights are visible immediately, with nothing rebuilt. As with
+  // SetRNGState, SetP is const despite mutating the game, because games are
+  // shared as shared_ptr<const Game>.
+  double p() const { return p_; }
+  void SetP(double p) const {
+    SPIEL_CHECK_PROB(p);
+    p_ = p;
   }
 
   int NumDistinctActions() const override {
@@ -180,9 +194,9 @@ class RestrictedNashResponseGame : public WrappedGame {
   std::shared_ptr<RestrictedNashResponseObserver> info_state_observer_;
 
  private:
-  // Fixed player and p constants to be passed to the initial state
+  // The fixed player, and the current exploitation level (see SetP above).
   const Player fixed_player_;
-  const double p_;
+  mutable double p_;
   // Constants for the fixed strategy and if we use explicit fixed strategy
   std::shared_ptr<Policy> fixed_policy_;
 };
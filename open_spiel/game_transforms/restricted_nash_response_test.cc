@@ -238,6 +238,25 @@ void TestFixedPolicyGame() {
   }
 }
 
+void TestPSweepReusesGame() {
+  // Sweeping the exploitation level must not require rebuilding the game:
+  // SetP changes the initial chance weights seen by existing states too.
+  std::shared_ptr<const Game> game = LoadGame("matrix_mp");
+  std::shared_ptr<const Game> rnr_game = ConvertToRNR(*game, /*fixed_player=*/1,
+                                                      /*p=*/0.4);
+  const auto &rnr =
+      down_cast<const RestrictedNashResponseGame &>(*rnr_game);
+  auto state = rnr_game->NewInitialState();
+  SPIEL_CHECK_EQ(state->ChanceOutcomes()[0].second, 0.4);
+
+  rnr.SetP(0.25);
+  SPIEL_CHECK_EQ(rnr.p(), 0.25);
+  // Both the pre-existing state and newly created ones see the new weights.
+  SPIEL_CHECK_EQ(state->ChanceOutcomes()[0].second, 0.25);
+  SPIEL_CHECK_EQ(state->ChanceOutcomes()[1].second, 0.75);
+  SPIEL_CHECK_EQ(rnr_game->NewInitialState()->ChanceOutcomes()[0].second, 0.25);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -246,4 +265,5 @@ int main(int argc, char **argv) {
   open_spiel::TestBasicCreation();
   open_spiel::TestMatchingPenniesCreation();
   open_spiel::TestFixedPolicyGame();
+  open_spiel::TestPSweepReusesGame();
 }
@@ -90,7 +90,8 @@ StartAtTransformationGame::StartAtTransformationGame(
     : WrappedGame(game, game_type, game_parameters),
       start_state_(StateFromHistory(
           game,
-          HistoryFromString(game_parameters.at("history").string_value()))) {}
+          HistoryFromString(game_parameters.at("history").string_value()))),
+      start_history_(start_state_->FullHistory()) {}
 
 std::unique_ptr<State> StartAtTransformationGame::NewInitialState() const {
   return std::make_unique<StartAtTransformationState>(shared_from_this(),
@@ -100,13 +101,18 @@ std::unique_ptr<State> StartAtTransformationGame::NewInitialState() const {
 StartAtTransformationState::StartAtTransformationState(
     std::shared_ptr<const Game> transformed_game, std::unique_ptr<State> state)
     : WrappedState(transformed_game, std::move(state)) {
+#if !defined(NDEBUG)
+  // Building the full histories is O(prefix length); keep it out of release
+  // builds so that constructing states from a deep prefix stays O(1) beyond
+  // the snapshot clone.
   const auto* start_at_game = open_spiel::down_cast<
       const StartAtTransformationGame*>(game_.get());
-  const std::vector<State::PlayerAction> start_history =
+  const std::vector<State::PlayerAction>& start_history =
       start_at_game->StartAtHistory();
   const std::vector<State::PlayerAction> wrap_history = state_->FullHistory();
   SPIEL_DCHECK_TRUE(std::equal(start_history.begin(), start_history.end(),
                                wrap_history.begin()));
+#endif  // !defined(NDEBUG)
 }
 
 }  // namespace open_spiel
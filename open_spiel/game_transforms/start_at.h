@@ -40,12 +40,17 @@ class StartAtTransformationGame : public WrappedGame {
   StartAtTransformationGame(std::shared_ptr<const Game> game,
                             GameType game_type, GameParameters game_parameters);
   std::unique_ptr<State> NewInitialState() const override;
-  std::vector<State::PlayerAction> StartAtHistory() const {
-    return start_state_->FullHistory();
+  const std::vector<State::PlayerAction>& StartAtHistory() const {
+    return start_history_;
   }
 
  private:
+  // The post-prefix snapshot: built once by replaying the prefix at game
+  // construction, then cloned by every NewInitialState call, so constructing
+  // states does not replay the prefix. The full history is cached alongside
+  // it to keep StartAtHistory O(1).
   const std::unique_ptr<State> start_state_;
+  const std::vector<State::PlayerAction> start_history_;
 };
 
 }  // namespace open_spiel
@@ -60,6 +60,7 @@ TurnBasedSimultaneousState::TurnBasedSimultaneousState(
     : State(game),
       state_(std::move(state)),
       action_vector_(game->NumPlayers()),
+      rollout_legal_actions_(game->NumPlayers()),
       rollout_mode_(kNoRollout) {
   DetermineWhoseTurn();
 }
@@ -74,6 +75,11 @@ void TurnBasedSimultaneousState::DetermineWhoseTurn() {
     // rolled out as turn-based, starting with player 0.
     current_player_ = -1;
     rollout_mode_ = kStartRollout;
+    // Fetch each player's legal actions once for the whole rollout; they
+    // cannot change until the joint action is applied.
+    for (auto p = Player{0}; p < num_players_; ++p) {
+      rollout_legal_actions_[p] = state_->LegalActions(p);
+    }
     RolloutModeIncrementCurrentPlayer();
     // If the rollout mode is used, then at least one player should have a valid
     // action.
@@ -90,7 +96,7 @@ void TurnBasedSimultaneousState::RolloutModeIncrementCurrentPlayer() {
 
   // Make sure to skip over the players that do not have legal actions.
   while (current_player_ < num_players_ &&
-         state_->LegalActions(current_player_).empty()) {
+         rollout_legal_actions_[current_player_].empty()) {
     // Unnecessary to set an action here, but leads to a nicer ToString.
     action_vector_[current_player_] = 0;
     current_player_++;
@@ -128,6 +134,12 @@ TurnBasedSimultaneousState::ChanceOutcomes() const {
 }
 
 std::vector<Action> TurnBasedSimultaneousState::LegalActions() const {
+  if (rollout_mode_) {
+    // Reuse the buffer fetched at the start of the rollout. Callers that
+    // want to avoid the copy made at this virtual API boundary can go
+    // through LegalActionsRef(), which caches it per state change.
+    return rollout_legal_actions_[current_player_];
+  }
   return state_->LegalActions(CurrentPlayer());
 }
 
@@ -249,6 +261,7 @@ TurnBasedSimultaneousState::TurnBasedSimultaneousState(
     : State(other),
       state_(other.state_->Clone()),
       action_vector_(other.action_vector_),
+      rollout_legal_actions_(other.rollout_legal_actions_),
       current_player_(other.current_player_),
       rollout_mode_(other.rollout_mode_) {}
 
@@ -73,6 +73,13 @@ class TurnBasedSimultaneousState : public State {
   // to be turn-based.
   std::vector<Action> action_vector_;
 
+  // Per-player legal actions at the simultaneous move node currently being
+  // rolled out, fetched once when the rollout starts. The underlying state
+  // does not change until the joint action is applied, so every turn of the
+  // rollout reads these buffers instead of querying the underlying state
+  // again (which rebuilds a vector per player per turn).
+  std::vector<std::vector<Action>> rollout_legal_actions_;
+
   // The current player (which will never be kSimultaneousPlayerId).
   Player current_player_;
 
@@ -194,6 +194,9 @@ void SimulateGames(std::mt19937* rng, const Game& game, State* sim_state,
         std::cout << "player " << p << " chose "
                   << sim_state->ActionToString(p, action) << std::endl;
         SPIEL_CHECK_EQ(p, turn_based_state->CurrentPlayer());
+        // The wrapper serves the rollout from per-player buffers fetched at
+        // the start of the joint move; they must match the underlying state.
+        SPIEL_CHECK_TRUE(turn_based_state->LegalActions() == actions);
         turn_based_state->ApplyAction(action);
       }
 
@@ -15,6 +15,7 @@
 #include "open_spiel/games/amazons/amazons.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -82,190 +83,71 @@ std::string StateToString(CellState state) {
 }
 
 /* Move generation functions */
-std::vector<Action> AmazonsState::GetHorizontalMoves(Action cell) const {
-  std::vector<Action> horizontalMoves;
-
-  unsigned char col = cell % kNumRows;  // The column the cell is in
-  unsigned char left =
-      col;  // The maximum amount of spaces to check left of given cell
-  unsigned char right =
-      kNumCols - col -
-      1;  // The maximal amount of spaces to check right of given cell
-  Action focus;
-
-  // <-----X
-  // Walk until we encounter a blocking piece or end of row
-  int count = 1;
-  while (count <= left) {
-    focus = cell - count;
-    if (board_[focus] == CellState::kEmpty) {
-      horizontalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
-    }
-  }
+namespace {
 
-  // X---->
-  // Walk until we encounter a blocking piece or end of row
-  count = 1;
-  while (count <= right) {
-    focus = cell + count;
-    if (board_[focus] == CellState::kEmpty) {
-      horizontalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
+// The 8 queen directions as (row, col) steps. Directions 0-3 decrease the
+// cell index, directions 4-7 increase it; QueenReach relies on that split
+// to pick the right bit scan for the nearest blocker.
+constexpr int kNumQueenDirections = 8;
+constexpr int kDirRowStep[kNumQueenDirections] = {-1, -1, -1, 0, 0, 1, 1, 1};
+constexpr int kDirColStep[kNumQueenDirections] = {-1, 0, 1, -1, 1, -1, 0, 1};
+
+using RayTable =
+    std::array<std::array<uint64_t, kNumCells>, kNumQueenDirections>;
+
+// Per (direction, cell) bitboard of every cell on the ray from (excluding)
+// the cell to the board edge.
+RayTable BuildRayTable() {
+  RayTable rays{};
+  for (int dir = 0; dir < kNumQueenDirections; ++dir) {
+    for (int cell = 0; cell < kNumCells; ++cell) {
+      int row = cell / kNumCols + kDirRowStep[dir];
+      int col = cell % kNumCols + kDirColStep[dir];
+      while (row >= 0 && row < kNumRows && col >= 0 && col < kNumCols) {
+        rays[dir][cell] |= uint64_t{1} << (row * kNumCols + col);
+        row += kDirRowStep[dir];
+        col += kDirColStep[dir];
+      }
     }
   }
-
-  return horizontalMoves;
+  return rays;
 }
 
-std::vector<Action> AmazonsState::GetVerticalMoves(Action cell) const {
-  std::vector<Action> verticalMoves;
-
-  unsigned char row = cell / kNumRows;  // The row the cell is in
-  unsigned char up =
-      row;  // The maximum amount of spaces to check up of given cell
-  unsigned char down =
-      kNumRows - row -
-      1;  // The maximal amount of spaces to check down of given cell
-  Action focus;
-
-  // ^
-  // |
-  // |
-  // X
-  // Walk until we encounter a blocking piece or end of column
-  int count = 1;
-  focus = cell;
-  while (count <= up) {
-    focus -= kNumRows;
-    if (board_[focus] == CellState::kEmpty) {
-      verticalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
-    }
-  }
-
-  // X
-  // |
-  // |
-  // V
-  // Walk until we encounter a blocking piece or end of column
-  count = 1;
-  focus = cell;
-  while (count <= down) {
-    focus += kNumRows;
-    if (board_[focus] == CellState::kEmpty) {
-      verticalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
-    }
-  }
-
-  return verticalMoves;
+const RayTable& GetRayTable() {
+  static const RayTable* rays = new RayTable(BuildRayTable());
+  return *rays;
 }
 
-std::vector<Action> AmazonsState::GetDiagonalMoves(Action cell) const {
-  std::vector<Action> diagonalMoves;
-  unsigned char col = cell % kNumCols;  // The column the cell is in
-  unsigned char row = cell / kNumRows;  // The row the cell is in
-  unsigned char upLeft = std::min(
-      row,
-      col);  // The maximum amount of spaces to check up and left of given cell
-  unsigned char upRight = std::min(
-      row,
-      (unsigned char)(kNumCols - col - 1));  // The maximum amount of spaces to
-                                             // check up and right of given cell
-  // The maximum amount of spaces to check
-  // down and left of given cell
-  unsigned char downLeft =
-      std::min(static_cast<unsigned char>(kNumRows - row - 1), col);
-  // The maximum amount of spaces to check down
-  // and right of given cell
-  unsigned char downRight =
-      std::min(static_cast<unsigned char>(kNumRows - row - 1),
-               static_cast<unsigned char>(kNumCols - col - 1));
-  Action focus;
-
-  // Up and left
-  int count = 1;
-  focus = cell;
-  while (count <= upLeft) {
-    focus -= (kNumRows + 1);
-    if (board_[focus] == CellState::kEmpty) {
-      diagonalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
-    }
-  }
-
-  // Up and right
-  count = 1;
-  focus = cell;
-  while (count <= upRight) {
-    focus -= (kNumRows - 1);
-    if (board_[focus] == CellState::kEmpty) {
-      diagonalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
-    }
-  }
+inline int BitScanForward(uint64_t b) { return __builtin_ctzll(b); }
+inline int BitScanReverse(uint64_t b) { return 63 - __builtin_clzll(b); }
 
-  // Down and left
-  count = 1;
-  focus = cell;
-  while (count <= downLeft) {
-    focus += (kNumRows - 1);
-    if (board_[focus] == CellState::kEmpty) {
-      diagonalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
-    }
-  }
+}  // namespace
 
-  // Down and right
-  count = 1;
-  focus = cell;
-  while (count <= downRight) {
-    focus += (kNumRows + 1);
-    if (board_[focus] == CellState::kEmpty) {
-      diagonalMoves.push_back(focus);
-      count++;
-    } else {
-      // We have encountered a blocking piece
-      break;
+uint64_t AmazonsState::QueenReach(Action cell) const {
+  const RayTable& rays = GetRayTable();
+  uint64_t reach = 0;
+  for (int dir = 0; dir < kNumQueenDirections; ++dir) {
+    uint64_t ray = rays[dir][cell];
+    uint64_t blockers = ray & occupied_;
+    if (blockers != 0) {
+      // Clip the ray at the blocker nearest to the cell: the highest set
+      // bit for down-index directions, the lowest for up-index directions.
+      int blocker =
+          dir < 4 ? BitScanReverse(blockers) : BitScanForward(blockers);
+      ray ^= rays[dir][blocker];
     }
+    reach |= ray;
   }
-
-  return diagonalMoves;
+  // The nearest blocker on each ray is still set; all pieces block.
+  return reach & ~occupied_;
 }
 
 std::vector<Action> AmazonsState::GetAllMoves(Action cell) const {
-  std::vector<Action> horizontals = GetHorizontalMoves(cell);
-  std::vector<Action> verticals = GetVerticalMoves(cell);
-  std::vector<Action> diagonals = GetDiagonalMoves(cell);
-
-  std::vector<Action> acc = horizontals;
-
-  acc.insert(acc.end(), verticals.begin(), verticals.end());
-  acc.insert(acc.end(), diagonals.begin(), diagonals.end());
-
-  return acc;
+  std::vector<Action> moves;
+  for (uint64_t reach = QueenReach(cell); reach != 0; reach &= reach - 1) {
+    moves.push_back(BitScanForward(reach));
+  }
+  return moves;
 }
 
 void AmazonsState::DoApplyAction(Action action) {
@@ -274,6 +156,7 @@ void AmazonsState::DoApplyAction(Action action) {
       SPIEL_CHECK_EQ(board_[action], PlayerToState(CurrentPlayer()));
       from_ = action;
       board_[from_] = CellState::kEmpty;
+      occupied_ &= ~(uint64_t{1} << from_);
       state_ = destination_select;
     }
     break;
@@ -282,6 +165,7 @@ void AmazonsState::DoApplyAction(Action action) {
       SPIEL_CHECK_EQ(board_[action], CellState::kEmpty);
       to_ = action;
       board_[to_] = PlayerToState(CurrentPlayer());
+      occupied_ |= uint64_t{1} << to_;
       state_ = shot_select;
       break;
     }
@@ -290,6 +174,7 @@ void AmazonsState::DoApplyAction(Action action) {
       SPIEL_CHECK_EQ(board_[action], CellState::kEmpty);
       shoot_ = action;
       board_[shoot_] = CellState::kBlock;
+      occupied_ |= uint64_t{1} << shoot_;
       current_player_ = 1 - current_player_;
       state_ = amazon_select;
       // Check if game is over
@@ -308,6 +193,7 @@ void AmazonsState::UndoAction(Player player, Action move) {
     case amazon_select: {
       shoot_ = move;
       board_[shoot_] = CellState::kEmpty;
+      occupied_ &= ~(uint64_t{1} << shoot_);
       current_player_ = player;
       outcome_ = kInvalidPlayer;
       state_ = shot_select;
@@ -317,6 +203,7 @@ void AmazonsState::UndoAction(Player player, Action move) {
     case destination_select: {
       from_ = move;
       board_[from_] = PlayerToState(player);
+      occupied_ |= uint64_t{1} << from_;
       state_ = amazon_select;
     }
     break;
@@ -324,6 +211,7 @@ void AmazonsState::UndoAction(Player player, Action move) {
     case shot_select: {
       to_ = move;
       board_[to_] = CellState::kEmpty;
+      occupied_ &= ~(uint64_t{1} << to_);
       state_ = destination_select;
     }
     break;
@@ -344,7 +232,7 @@ std::vector<Action> AmazonsState::LegalActions() const {
       for (int i = 0; i < board_.size(); i++) {
         if (board_[i] == PlayerToState(CurrentPlayer())) {
           // check if the selected amazon has a possible move
-          if (GetAllMoves(i).empty()) continue;
+          if (QueenReach(i) == 0) continue;
 
           actions.push_back(i);
         }
@@ -401,6 +289,9 @@ AmazonsState::AmazonsState(std::shared_ptr<const Game> game) : State(game) {
       board_[40] = board_[47] = board_[58] = board_[61] = CellState::kNought;
       break;
   }
+  for (int cell = 0; cell < kNumCells; ++cell) {
+    if (board_[cell] != CellState::kEmpty) occupied_ |= uint64_t{1} << cell;
+  }
 }
 
 void AmazonsState::SetState(int cur_player, MoveState move_state,
@@ -408,6 +299,10 @@ void AmazonsState::SetState(int cur_player, MoveState move_state,
   current_player_ = cur_player;
   state_ = move_state;
   board_ = board;
+  occupied_ = 0;
+  for (int cell = 0; cell < kNumCells; ++cell) {
+    if (board_[cell] != CellState::kEmpty) occupied_ |= uint64_t{1} << cell;
+  }
 }
 
 std::string AmazonsState::ToString() const {
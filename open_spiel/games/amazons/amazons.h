@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_GAMES_AMAZONS_H_
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -39,6 +40,9 @@ inline constexpr int kNumCols = 6;
 inline constexpr int kNumCells = kNumRows * kNumCols;
 inline constexpr int kCellStates = 4;  // empty, 'X', 'O', '@'.
 
+// Move generation keeps the occupancy in a single bitboard word.
+static_assert(kNumCells <= 64, "Board must fit in a 64-bit bitboard.");
+
 // Hensgens et al = 10e40 for 10x10
 inline constexpr int kNumberStates = 1000000000;
 
@@ -101,16 +105,19 @@ class AmazonsState : public State {
   int to_ = 0;
   int shoot_ = 0;
 
+  // Bitboard of empty cells a queen on `cell` can reach along the 8 rays,
+  // given the current occupancy.
+  uint64_t QueenReach(Action cell) const;
   std::vector<Action> GetAllMoves(Action) const;
-  std::vector<Action> GetDiagonalMoves(Action) const;
-  std::vector<Action> GetVerticalMoves(Action) const;
-  std::vector<Action> GetHorizontalMoves(Action) const;
 
   bool IsGameOver() const;
 
   Player current_player_ = 0;        // Player zero goes first
   Player outcome_ = kInvalidPlayer;  // Outcome unclear at init
   int num_moves_ = 0;
+  // Bitboard of all non-empty cells (amazons of both players and arrows),
+  // kept in sync with board_ by DoApplyAction / UndoAction.
+  uint64_t occupied_ = 0;
 };
 
 // Game object.
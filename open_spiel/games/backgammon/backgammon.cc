@@ -16,7 +16,6 @@
 
 #include <algorithm>
 #include <cstdlib>
-#include <set>
 #include <utility>
 #include <vector>
 
@@ -913,56 +912,64 @@ int BackgammonState::IsBackgammoned(int player) const {
   return false;
 }
 
-std::set<CheckerMove> BackgammonState::LegalCheckerMoves(int player) const {
-  std::set<CheckerMove> moves;
+void BackgammonState::LegalCheckerMoves(
+    int player, std::vector<CheckerMove>* moves) const {
+  // The distinct usable dice outcomes. With doubles both dice show the same
+  // number, so expanding only one of them keeps the generated moves
+  // duplicate-free by construction.
+  int outcomes[2] = {-1, -1};
+  int num_outcomes = 0;
+  for (int outcome : dice_) {
+    if (UsableDiceOutcome(outcome) &&
+        (num_outcomes == 0 || outcomes[0] != outcome)) {
+      outcomes[num_outcomes++] = outcome;
+    }
+  }
 
   if (bar_[player] > 0) {
     // If there are any checkers are the bar, must move them out first.
-    for (int outcome : dice_) {
-      if (UsableDiceOutcome(outcome)) {
-        int pos = PositionFromBar(player, outcome);
-        if (NumOppCheckers(player, pos) <= 1) {
-          bool hit = NumOppCheckers(player, pos) == 1;
-          moves.insert(CheckerMove(kBarPos, outcome, hit));
-        }
+    for (int i = 0; i < num_outcomes; ++i) {
+      int outcome = outcomes[i];
+      int pos = PositionFromBar(player, outcome);
+      if (NumOppCheckers(player, pos) <= 1) {
+        bool hit = NumOppCheckers(player, pos) == 1;
+        moves->push_back(CheckerMove(kBarPos, outcome, hit));
       }
     }
-    return moves;
+    return;
   }
 
   // Regular board moves.
   bool all_in_home = AllInHome(player);
   for (int i = 0; i < kNumPoints; ++i) {
     if (board_[player][i] > 0) {
-      for (int outcome : dice_) {
-        if (UsableDiceOutcome(outcome)) {
-          int pos = PositionFrom(player, i, outcome);
-          if (pos == kScorePos && all_in_home) {
-            // Check whether a bear off move is legal.
-
-            // It is ok to bear off if all the checkers are at home and the
-            // point being used to move from exactly matches the distance from
-            // just stepping off the board.
-            if ((player == kXPlayerId && i + outcome == 24) ||
-                (player == kOPlayerId && i - outcome == -1)) {
-              moves.insert(CheckerMove(i, outcome, false));
-            } else {
-              // Otherwise, a die can only be used to move a checker off if
-              // there are no checkers further than it in the player's home.
-              if (i == FurthestCheckerInHome(player)) {
-                moves.insert(CheckerMove(i, outcome, false));
-              }
+      for (int j = 0; j < num_outcomes; ++j) {
+        int outcome = outcomes[j];
+        int pos = PositionFrom(player, i, outcome);
+        if (pos == kScorePos && all_in_home) {
+          // Check whether a bear off move is legal.
+
+          // It is ok to bear off if all the checkers are at home and the
+          // point being used to move from exactly matches the distance from
+          // just stepping off the board.
+          if ((player == kXPlayerId && i + outcome == 24) ||
+              (player == kOPlayerId && i - outcome == -1)) {
+            moves->push_back(CheckerMove(i, outcome, false));
+          } else {
+            // Otherwise, a die can only be used to move a checker off if
+            // there are no checkers further than it in the player's home.
+            if (i == FurthestCheckerInHome(player)) {
+              moves->push_back(CheckerMove(i, outcome, false));
             }
-          } else if (pos != kScorePos && NumOppCheckers(player, pos) <= 1) {
-            // Regular move.
-            bool hit = NumOppCheckers(player, pos) == 1;
-            moves.insert(CheckerMove(i, outcome, hit));
           }
+        } else if (pos != kScorePos && NumOppCheckers(player, pos) <= 1) {
+          // Regular move.
+          bool hit = NumOppCheckers(player, pos) == 1;
+          moves->push_back(CheckerMove(i, outcome, hit));
         }
       }
     }
   }
-  return moves;
 }
 
 bool BackgammonState::ApplyCheckerMove(int player, const CheckerMove& move) {
@@ -1059,35 +1066,45 @@ void BackgammonState::UndoCheckerMove(int player, const CheckerMove& move) {
 
 // Returns the maximum move size (2, 1, or 0)
 int BackgammonState::RecLegalMoves(
-    std::vector<CheckerMove> moveseq,
-    std::set<std::vector<CheckerMove>>* movelist) {
-  if (moveseq.size() == 2) {
-    movelist->insert(moveseq);
-    return moveseq.size();
+    std::vector<CheckerMove>* moveseq,
+    std::vector<std::vector<CheckerMove>>* movelist,
+    std::vector<CheckerMove>* move_buffer) {
+  if (moveseq->size() == 2) {
+    movelist->push_back(*moveseq);
+    return moveseq->size();
   }
 
-  std::set<CheckerMove> moves_here = LegalCheckerMoves(cur_player_);
+  // The moves of this node are appended to the shared buffer and popped off
+  // again on the way out, so one allocation serves the whole search.
+  const size_t buffer_start = move_buffer->size();
+  LegalCheckerMoves(cur_player_, move_buffer);
+  const size_t buffer_end = move_buffer->size();
 
-  if (moves_here.empty()) {
-    movelist->insert(moveseq);
-    return moveseq.size();
+  if (buffer_start == buffer_end) {
+    movelist->push_back(*moveseq);
+    return moveseq->size();
   }
 
   int max_moves = -1;
-  for (const auto& move : moves_here) {
-    moveseq.push_back(move);
+  for (size_t i = buffer_start; i < buffer_end; ++i) {
+    const CheckerMove move = (*move_buffer)[i];
+    moveseq->push_back(move);
     ApplyCheckerMove(cur_player_, move);
-    int child_max = RecLegalMoves(moveseq, movelist);
+    int child_max = RecLegalMoves(moveseq, movelist, move_buffer);
     UndoCheckerMove(cur_player_, move);
     max_moves = std::max(child_max, max_moves);
-    moveseq.pop_back();
+    moveseq->pop_back();
   }
+  // erase rather than resize: CheckerMove has no default constructor, which
+  // resize requires even when shrinking.
+  move_buffer->erase(move_buffer->begin() + buffer_start, move_buffer->end());
 
   return max_moves;
 }
 
 std::vector<Action> BackgammonState::ProcessLegalMoves(
-    int max_moves, const std::set<std::vector<CheckerMove>>& movelist) const {
+    int max_moves,
+    const std::vector<std::vector<CheckerMove>>& movelist) const {
   if (max_moves == 0) {
     SPIEL_CHECK_EQ(movelist.size(), 1);
     SPIEL_CHECK_TRUE(movelist.begin()->empty());
@@ -1142,30 +1159,32 @@ std::vector<Action> BackgammonState::LegalActions() const {
 
   std::unique_ptr<State> cstate = this->Clone();
   BackgammonState* state = dynamic_cast<BackgammonState*>(cstate.get());
-  std::set<std::vector<CheckerMove>> movelist;
-  int max_moves = state->RecLegalMoves({}, &movelist);
+  movelist_buffer_.clear();
+  moveseq_buffer_.clear();
+  move_buffer_.clear();
+  int max_moves = state->RecLegalMoves(&moveseq_buffer_, &movelist_buffer_,
+                                       &move_buffer_);
   SPIEL_CHECK_GE(max_moves, 0);
   SPIEL_CHECK_LE(max_moves, 2);
-  std::vector<Action> legal_actions = ProcessLegalMoves(max_moves, movelist);
+  std::vector<Action> legal_actions =
+      ProcessLegalMoves(max_moves, movelist_buffer_);
   std::sort(legal_actions.begin(), legal_actions.end());
   return legal_actions;
 }
 
 std::vector<std::pair<Action, double>> BackgammonState::ChanceOutcomes() const {
   SPIEL_CHECK_TRUE(IsChanceNode());
+  return *ChanceOutcomeTable();
+}
+
+const ActionsAndProbs* BackgammonState::ChanceOutcomeTable() const {
+  const auto& game = down_cast<const BackgammonGame&>(*game_);
   if (turns_ == -1) {
     // Doubles not allowed for the initial roll to determine who goes first.
     // Range 0-14: X goes first, range 15-29: O goes first.
-    std::vector<std::pair<Action, double>> outcomes;
-    int num_outcomes = kNumNonDoubleOutcomes * 2;
-    outcomes.reserve(num_outcomes);
-    const double uniform_prob = 1.0 / num_outcomes;
-    for (Action action = 0; action < num_outcomes; ++action) {
-      outcomes.push_back({action, uniform_prob});
-    }
-    return outcomes;
+    return game.initial_chance_outcomes();
   } else {
-    return kChanceOutcomes;
+    return game.roll_chance_outcomes();
   }
 }
 
@@ -1302,7 +1321,18 @@ BackgammonGame::BackgammonGame(const GameParameters& params)
     : Game(kGameType, params),
       scoring_type_(
           ParseScoringType(ParameterValue<std::string>("scoring_type"))),
-      hyper_backgammon_(ParameterValue<bool>("hyper_backgammon")) {}
+      hyper_backgammon_(ParameterValue<bool>("hyper_backgammon")) {
+  ActionsAndProbs initial_outcomes;
+  int num_outcomes = kNumNonDoubleOutcomes * 2;
+  initial_outcomes.reserve(num_outcomes);
+  const double uniform_prob = 1.0 / num_outcomes;
+  for (Action action = 0; action < num_outcomes; ++action) {
+    initial_outcomes.push_back({action, uniform_prob});
+  }
+  initial_chance_outcomes_ =
+      MakeChanceOutcomeTable(std::move(initial_outcomes));
+  roll_chance_outcomes_ = MakeChanceOutcomeTable(kChanceOutcomes);
+}
 
 double BackgammonGame::MaxUtility() const {
   if (hyper_backgammon_) {
@@ -17,7 +17,6 @@
 
 #include <array>
 #include <memory>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -129,6 +128,7 @@ class BackgammonState : public State {
   std::vector<Action> LegalActions() const override;
   std::string ActionToString(Player player, Action move_id) const override;
   std::vector<std::pair<Action, double>> ChanceOutcomes() const override;
+  const ActionsAndProbs* ChanceOutcomeTable() const override;
   std::string ToString() const override;
   bool IsTerminal() const override;
   std::vector<double> Returns() const override;
@@ -237,11 +237,24 @@ class BackgammonState : public State {
 
   bool ApplyCheckerMove(int player, const CheckerMove& move);
   void UndoCheckerMove(int player, const CheckerMove& move);
-  std::set<CheckerMove> LegalCheckerMoves(int player) const;
-  int RecLegalMoves(std::vector<CheckerMove> moveseq,
-                    std::set<std::vector<CheckerMove>>* movelist);
+
+  // Appends the legal single checker moves for the player to *moves (the
+  // buffer is not cleared). Each distinct move is generated exactly once:
+  // with doubles, both dice show the same number, so only one is expanded.
+  void LegalCheckerMoves(int player, std::vector<CheckerMove>* moves) const;
+
+  // Recursively enumerates the candidate move sequences into *movelist,
+  // depth-first over the trie of distinct checker moves. Since every node
+  // expands each move once, no duplicate sequences are ever materialized.
+  // *moveseq is the sequence on the path to the current node, and
+  // *move_buffer is scratch space for the per-node moves; both are restored
+  // before returning. Returns the maximum move size (2, 1, or 0).
+  int RecLegalMoves(std::vector<CheckerMove>* moveseq,
+                    std::vector<std::vector<CheckerMove>>* movelist,
+                    std::vector<CheckerMove>* move_buffer);
   std::vector<Action> ProcessLegalMoves(
-      int max_moves, const std::set<std::vector<CheckerMove>>& movelist) const;
+      int max_moves,
+      const std::vector<std::vector<CheckerMove>>& movelist) const;
 
   ScoringType scoring_type_;  // Which rules apply when scoring the game.
   bool hyper_backgammon_;     // Is the Hyper-backgammon variant enabled?
@@ -257,6 +270,13 @@ class BackgammonState : public State {
   std::vector<int> scores_;  // Checkers returned home by each player.
   std::vector<std::vector<int>> board_;  // Checkers for each player on points.
   std::vector<TurnHistoryInfo> turn_history_info_;  // Info needed for Undo.
+
+  // Reusable scratch buffers for LegalActions(), so that rollouts calling it
+  // every turn do not keep reallocating. The enumeration itself runs on a
+  // clone of the state; only the buffers live here.
+  mutable std::vector<std::vector<CheckerMove>> movelist_buffer_;
+  mutable std::vector<CheckerMove> moveseq_buffer_;
+  mutable std::vector<CheckerMove> move_buffer_;
 };
 
 class BackgammonGame : public Game {
@@ -274,6 +294,15 @@ class BackgammonGame : public Game {
   // the doubles).
   int MaxChanceOutcomes() const override { return 30; }
 
+  // The initial-roll and regular-roll distributions; see
+  // State::ChanceOutcomeTable().
+  const ActionsAndProbs* initial_chance_outcomes() const {
+    return initial_chance_outcomes_;
+  }
+  const ActionsAndProbs* roll_chance_outcomes() const {
+    return roll_chance_outcomes_;
+  }
+
   // There is arbitrarily chosen number to ensure the game is finite.
   int MaxGameLength() const override { return 1000; }
 
@@ -314,6 +343,10 @@ class BackgammonGame : public Game {
  private:
   ScoringType scoring_type_;  // Which rules apply when scoring the game.
   bool hyper_backgammon_;     // Is hyper-backgammon variant enabled?
+
+  // Owned by the base Game; registered in the constructor.
+  const ActionsAndProbs* initial_chance_outcomes_;
+  const ActionsAndProbs* roll_chance_outcomes_;
 };
 
 }  // namespace backgammon
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <set>
@@ -26,6 +27,8 @@
 #include "open_spiel/abseil-cpp/absl/base/attributes.h"
 #include "open_spiel/abseil-cpp/absl/base/const_init.h"
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
@@ -44,6 +47,7 @@
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
 
 // Our preferred version of the double_dummy_solver defines a DDS_EXTERNAL
 // macro to add a prefix to the exported symbols to avoid name clashes.
@@ -480,24 +484,121 @@ void BridgeState::SetDoubleDummyResults(ddTableResults double_dummy_results) {
 
 ABSL_CONST_INIT absl::Mutex dds_mutex(absl::kConstInit);
 
+namespace {
+
+// Double-dummy analysis dominates the cost of scoring, and bidding-policy
+// training revisits the same deals many times (e.g. when scoring the same
+// board against several contracts, or when cloned states are scored
+// independently). We therefore memoize the trick counts in a process-wide
+// cache keyed by the exact deal. Deals are keyed losslessly - two bits per
+// card giving its holder - so a hit is always valid; the solver's own
+// transposition table already shares work between trick states within a
+// single solve.
+using DealKey = std::pair<uint64_t, uint64_t>;
+
+constexpr int kUnknownTricks = -1;
+
+// Tricks available to each declarer in each denomination; kUnknownTricks
+// marks cells which have not been solved yet (ScoreForContracts only solves
+// the cells the requested contracts need).
+struct DoubleDummyTricks {
+  std::array<std::array<int8_t, kNumPlayers>, kNumDenominations> tricks;
+  DoubleDummyTricks() {
+    for (auto& row : tricks) row.fill(kUnknownTricks);
+  }
+};
+
+DealKey DealKeyFromHolders(
+    const std::array<absl::optional<Player>, kNumCards>& holder) {
+  DealKey key{0, 0};
+  for (int card = 0; card < kNumCards; ++card) {
+    const uint64_t player = holder[card].value();
+    if (card < 32) {
+      key.first |= player << (2 * card);
+    } else {
+      key.second |= player << (2 * (card - 32));
+    }
+  }
+  return key;
+}
+
+bool HasAllTricks(const DoubleDummyTricks& entry) {
+  for (const auto& row : entry.tricks) {
+    for (const int8_t cell : row) {
+      if (cell == kUnknownTricks) return false;
+    }
+  }
+  return true;
+}
+
+void MergeTricks(const DoubleDummyTricks& from, DoubleDummyTricks* to) {
+  for (int trumps = 0; trumps < kNumDenominations; ++trumps) {
+    for (int declarer = 0; declarer < kNumPlayers; ++declarer) {
+      if (from.tricks[trumps][declarer] != kUnknownTricks) {
+        to->tricks[trumps][declarer] = from.tricks[trumps][declarer];
+      }
+    }
+  }
+}
+
+ABSL_CONST_INIT absl::Mutex dd_cache_mutex(absl::kConstInit);
+
+absl::flat_hash_map<DealKey, DoubleDummyTricks>& DoubleDummyCache()
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(dd_cache_mutex) {
+  static auto* cache = new absl::flat_hash_map<DealKey, DoubleDummyTricks>();
+  return *cache;
+}
+
+}  // namespace
+
 void BridgeState::ComputeDoubleDummyTricks() const {
   if (!double_dummy_results_.has_value()) {
-    absl::MutexLock lock(&dds_mutex);  // TODO(author11) Make DDS code thread-safe
+    const DealKey key = DealKeyFromHolders(holder_);
     double_dummy_results_ = ddTableResults{};
-    ddTableDeal dd_table_deal{};
-    for (int suit = 0; suit < kNumSuits; ++suit) {
-      for (int rank = 0; rank < kNumCardsPerSuit; ++rank) {
-        const int player = holder_[Card(Suit(suit), rank)].value();
-        dd_table_deal.cards[player][suit] += 1 << (2 + rank);
+    bool cached = false;
+    {
+      absl::MutexLock lock(&dd_cache_mutex);
+      const auto it = DoubleDummyCache().find(key);
+      // The full table is needed here, so a partially-solved entry (left by
+      // ScoreForContracts) does not count as a hit.
+      if (it != DoubleDummyCache().end() && HasAllTricks(it->second)) {
+        for (int trumps = 0; trumps < kNumDenominations; ++trumps) {
+          for (int declarer = 0; declarer < kNumPlayers; ++declarer) {
+            double_dummy_results_->resTable[trumps][declarer] =
+                it->second.tricks[trumps][declarer];
+          }
+        }
+        cached = true;
       }
     }
-    DDS_EXTERNAL(SetMaxThreads)(0);
-    const int return_code = DDS_EXTERNAL(CalcDDtable)(
-        dd_table_deal, &double_dummy_results_.value());
-    if (return_code != RETURN_NO_FAULT) {
-      char error_message[80];
-      DDS_EXTERNAL(ErrorMessage)(return_code, error_message);
-      SpielFatalError(absl::StrCat("double_dummy_solver:", error_message));
+    if (!cached) {
+      {
+        absl::MutexLock lock(
+            &dds_mutex);  // TODO(author11) Make DDS code thread-safe
+        ddTableDeal dd_table_deal{};
+        for (int suit = 0; suit < kNumSuits; ++suit) {
+          for (int rank = 0; rank < kNumCardsPerSuit; ++rank) {
+            const int player = holder_[Card(Suit(suit), rank)].value();
+            dd_table_deal.cards[player][suit] += 1 << (2 + rank);
+          }
+        }
+        DDS_EXTERNAL(SetMaxThreads)(0);
+        const int return_code = DDS_EXTERNAL(CalcDDtable)(
+            dd_table_deal, &double_dummy_results_.value());
+        if (return_code != RETURN_NO_FAULT) {
+          char error_message[80];
+          DDS_EXTERNAL(ErrorMessage)(return_code, error_message);
+          SpielFatalError(absl::StrCat("double_dummy_solver:", error_message));
+        }
+      }
+      absl::MutexLock lock(&dd_cache_mutex);
+      DoubleDummyTricks& entry = DoubleDummyCache()[key];
+      for (int trumps = 0; trumps < kNumDenominations; ++trumps) {
+        for (int declarer = 0; declarer < kNumPlayers; ++declarer) {
+          entry.tricks[trumps][declarer] =
+              double_dummy_results_->resTable[trumps][declarer];
+        }
+      }
     }
   }
   ComputeScoreByContract();
@@ -517,93 +618,123 @@ std::vector<int> BridgeState::ScoreForContracts(
       }
     }
   } else {
+    // Start from any cells already solved for this deal; only the cells the
+    // requested contracts need and the cache is missing get analyzed.
+    const DealKey key = DealKeyFromHolders(holder_);
+    DoubleDummyTricks cached;
     {
-      // This performs some sort of global initialization; unclear
-      // exactly what.
-      absl::MutexLock lock(&dds_mutex);
-      DDS_EXTERNAL(SetMaxThreads)(0);
+      absl::MutexLock lock(&dd_cache_mutex);
+      const auto it = DoubleDummyCache().find(key);
+      if (it != DoubleDummyCache().end()) cached = it->second;
     }
 
-    // Working storage for DD calculation.
-    auto thread_data = std::make_unique<ThreadData>();
-    auto transposition_table = std::make_unique<TransTableL>();
-    transposition_table->SetMemoryDefault(95);   // megabytes
-    transposition_table->SetMemoryMaximum(160);  // megabytes
-    transposition_table->MakeTT();
-    thread_data->transTable = transposition_table.get();
-
-    // Which trump suits do we need to handle?
+    // Which trump suits do we still need to handle?
     std::set<int> suits;
     for (auto index : contracts) {
       const auto& contract = kAllContracts[index];
-      if (contract.level > 0) suits.emplace(contract.trumps);
+      if (contract.level > 0 &&
+          cached.tricks[contract.trumps][contract.declarer] == kUnknownTricks)
+        suits.emplace(contract.trumps);
     }
-    // Build the deal
-    ::deal dl{};
-    for (int suit = 0; suit < kNumSuits; ++suit) {
-      for (int rank = 0; rank < kNumCardsPerSuit; ++rank) {
-        const int player = holder_[Card(Suit(suit), rank)].value();
-        dl.remainCards[player][suit] += 1 << (2 + rank);
+
+    if (!suits.empty()) {
+      {
+        // This performs some sort of global initialization; unclear
+        // exactly what.
+        absl::MutexLock lock(&dds_mutex);
+        DDS_EXTERNAL(SetMaxThreads)(0);
       }
-    }
-    for (int k = 0; k <= 2; k++) {
-      dl.currentTrickRank[k] = 0;
-      dl.currentTrickSuit[k] = 0;
-    }
 
-    // Analyze for each trump suit.
-    for (int suit : suits) {
-      dl.trump = suit;
-      transposition_table->ResetMemory(TT_RESET_NEW_TRUMP);
-
-      // Assemble the declarers we need to consider.
-      std::set<int> declarers;
-      for (auto index : contracts) {
-        const auto& contract = kAllContracts[index];
-        if (contract.level > 0 && contract.trumps == suit)
-          declarers.emplace(contract.declarer);
+      // Working storage for DD calculation.
+      auto thread_data = std::make_unique<ThreadData>();
+      auto transposition_table = std::make_unique<TransTableL>();
+      transposition_table->SetMemoryDefault(95);   // megabytes
+      transposition_table->SetMemoryMaximum(160);  // megabytes
+      transposition_table->MakeTT();
+      thread_data->transTable = transposition_table.get();
+
+      // Build the deal
+      ::deal dl{};
+      for (int suit = 0; suit < kNumSuits; ++suit) {
+        for (int rank = 0; rank < kNumCardsPerSuit; ++rank) {
+          const int player = holder_[Card(Suit(suit), rank)].value();
+          dl.remainCards[player][suit] += 1 << (2 + rank);
+        }
+      }
+      for (int k = 0; k <= 2; k++) {
+        dl.currentTrickRank[k] = 0;
+        dl.currentTrickSuit[k] = 0;
       }
 
-      // Analyze the deal for each declarer.
-      absl::optional<Player> first_declarer;
-      absl::optional<int> first_tricks;
-      for (int declarer : declarers) {
-        ::futureTricks fut;
-        dl.first = (declarer + 1) % kNumPlayers;
-        if (!first_declarer.has_value()) {
-          // First time we're calculating this trump suit.
-          const int return_code = SolveBoardInternal(
-              thread_data.get(), dl,
-              /*target=*/-1,    // Find max number of tricks
-              /*solutions=*/1,  // Just the tricks (no card-by-card result)
-              /*mode=*/2,       // Unclear
-              &fut              // Output
-          );
-          if (return_code != RETURN_NO_FAULT) {
-            char error_message[80];
-            DDS_EXTERNAL(ErrorMessage)(return_code, error_message);
-            SpielFatalError(
-                absl::StrCat("double_dummy_solver:", error_message));
-          }
-          dd_tricks[suit][declarer] = 13 - fut.score[0];
-          first_declarer = declarer;
-          first_tricks = 13 - fut.score[0];
-        } else {
-          // Reuse data from last time.
-          const int hint = Partnership(declarer) == Partnership(*first_declarer)
-                               ? *first_tricks
-                               : 13 - *first_tricks;
-          const int return_code =
-              SolveSameBoard(thread_data.get(), dl, &fut, hint);
-          if (return_code != RETURN_NO_FAULT) {
-            char error_message[80];
-            DDS_EXTERNAL(ErrorMessage)(return_code, error_message);
-            SpielFatalError(
-                absl::StrCat("double_dummy_solver:", error_message));
+      // Analyze for each trump suit.
+      for (int suit : suits) {
+        dl.trump = suit;
+        transposition_table->ResetMemory(TT_RESET_NEW_TRUMP);
+
+        // Assemble the declarers we need to consider.
+        std::set<int> declarers;
+        for (auto index : contracts) {
+          const auto& contract = kAllContracts[index];
+          if (contract.level > 0 && contract.trumps == suit &&
+              cached.tricks[suit][contract.declarer] == kUnknownTricks)
+            declarers.emplace(contract.declarer);
+        }
+
+        // Analyze the deal for each declarer.
+        absl::optional<Player> first_declarer;
+        absl::optional<int> first_tricks;
+        for (int declarer : declarers) {
+          ::futureTricks fut;
+          dl.first = (declarer + 1) % kNumPlayers;
+          if (!first_declarer.has_value()) {
+            // First time we're calculating this trump suit.
+            const int return_code = SolveBoardInternal(
+                thread_data.get(), dl,
+                /*target=*/-1,    // Find max number of tricks
+                /*solutions=*/1,  // Just the tricks (no card-by-card result)
+                /*mode=*/2,       // Unclear
+                &fut              // Output
+            );
+            if (return_code != RETURN_NO_FAULT) {
+              char error_message[80];
+              DDS_EXTERNAL(ErrorMessage)(return_code, error_message);
+              SpielFatalError(
+                  absl::StrCat("double_dummy_solver:", error_message));
+            }
+            cached.tricks[suit][declarer] = 13 - fut.score[0];
+            first_declarer = declarer;
+            first_tricks = 13 - fut.score[0];
+          } else {
+            // Reuse data from last time.
+            const int hint =
+                Partnership(declarer) == Partnership(*first_declarer)
+                    ? *first_tricks
+                    : 13 - *first_tricks;
+            const int return_code =
+                SolveSameBoard(thread_data.get(), dl, &fut, hint);
+            if (return_code != RETURN_NO_FAULT) {
+              char error_message[80];
+              DDS_EXTERNAL(ErrorMessage)(return_code, error_message);
+              SpielFatalError(
+                  absl::StrCat("double_dummy_solver:", error_message));
+            }
+            cached.tricks[suit][declarer] = 13 - fut.score[0];
           }
-          dd_tricks[suit][declarer] = 13 - fut.score[0];
         }
       }
+
+      // Publish the newly-solved cells; another thread may have filled in
+      // others in the meantime, so merge rather than overwrite.
+      absl::MutexLock lock(&dd_cache_mutex);
+      MergeTricks(cached, &DoubleDummyCache()[key]);
+    }
+
+    for (auto index : contracts) {
+      const auto& contract = kAllContracts[index];
+      if (contract.level > 0) {
+        dd_tricks[contract.trumps][contract.declarer] =
+            cached.tricks[contract.trumps][contract.declarer];
+      }
     }
   }
 
@@ -950,5 +1081,52 @@ std::string BridgeGame::ContractString(int index) const {
   return kAllContracts[index].ToString();
 }
 
+int DoubleDummyCacheSize() {
+  absl::MutexLock lock(&dd_cache_mutex);
+  return DoubleDummyCache().size();
+}
+
+void SaveDoubleDummyCache(const std::string& filename) {
+  std::string contents;
+  {
+    absl::MutexLock lock(&dd_cache_mutex);
+    for (const auto& [key, entry] : DoubleDummyCache()) {
+      absl::StrAppend(&contents, key.first, " ", key.second);
+      for (int trumps = 0; trumps < kNumDenominations; ++trumps) {
+        for (int declarer = 0; declarer < kNumPlayers; ++declarer) {
+          absl::StrAppend(&contents, " ",
+                          static_cast<int>(entry.tricks[trumps][declarer]));
+        }
+      }
+      absl::StrAppend(&contents, "\n");
+    }
+  }
+  file::WriteContentsToFile(filename, "w", contents);
+}
+
+void LoadDoubleDummyCache(const std::string& filename) {
+  const std::string contents = file::ReadContentsFromFile(filename, "r");
+  absl::MutexLock lock(&dd_cache_mutex);
+  for (absl::string_view line :
+       absl::StrSplit(contents, '\n', absl::SkipEmpty())) {
+    const std::vector<absl::string_view> fields = absl::StrSplit(line, ' ');
+    SPIEL_CHECK_EQ(fields.size(), 2 + kNumDenominations * kNumPlayers);
+    DealKey key;
+    SPIEL_CHECK_TRUE(absl::SimpleAtoi(fields[0], &key.first));
+    SPIEL_CHECK_TRUE(absl::SimpleAtoi(fields[1], &key.second));
+    DoubleDummyTricks loaded;
+    int field = 2;
+    for (int trumps = 0; trumps < kNumDenominations; ++trumps) {
+      for (int declarer = 0; declarer < kNumPlayers; ++declarer) {
+        int num_tricks;
+        SPIEL_CHECK_TRUE(absl::SimpleAtoi(fields[field++], &num_tricks));
+        loaded.tricks[trumps][declarer] = num_tricks;
+      }
+    }
+    // Merge so that a stale file cannot erase cells solved this run.
+    MergeTricks(loaded, &DoubleDummyCache()[key]);
+  }
+}
+
 }  // namespace bridge
 }  // namespace open_spiel
@@ -266,6 +266,16 @@ class BridgeGame : public Game {
   int NumTricks() const { return ParameterValue<int>("num_tricks", 2); }
 };
 
+// Double-dummy trick counts computed while scoring are memoized in a
+// process-wide cache keyed by the deal. These helpers persist that cache so
+// that repeated training runs over the same boards skip play analysis
+// entirely. The format is one line per deal: the two words of the deal key
+// followed by the tricks for each (denomination, declarer) pair, with -1
+// marking cells that were never solved. Loading merges into the live cache.
+int DoubleDummyCacheSize();
+void SaveDoubleDummyCache(const std::string& filename);
+void LoadDoubleDummyCache(const std::string& filename);
+
 }  // namespace bridge
 }  // namespace open_spiel
 
@@ -19,6 +19,7 @@
 #include "open_spiel/games/bridge/bridge_uncontested_bidding.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/tests/basic_tests.h"
+#include "open_spiel/utils/file.h"
 
 namespace open_spiel {
 namespace bridge {
@@ -83,6 +84,17 @@ void DeserializeDoubleDummyResults() {
   SPIEL_CHECK_EQ(serialized, new_state->Serialize());
 }
 
+void DoubleDummyCacheTest() {
+  // The simulations above have scored deals, so the cache is non-empty.
+  const int size = DoubleDummyCacheSize();
+  SPIEL_CHECK_GT(size, 0);
+  const std::string filename = file::GetTmpDir() + "/bridge_dd_cache.txt";
+  SaveDoubleDummyCache(filename);
+  LoadDoubleDummyCache(filename);
+  SPIEL_CHECK_EQ(DoubleDummyCacheSize(), size);
+  file::Remove(filename);
+}
+
 }  // namespace
 }  // namespace bridge
 }  // namespace open_spiel
@@ -93,4 +105,5 @@ int main(int argc, char** argv) {
   open_spiel::bridge::BasicGameTests();
   open_spiel::bridge::SerializeDoubleDummyResults();
   open_spiel::bridge::DeserializeDoubleDummyResults();
+  open_spiel::bridge::DoubleDummyCacheTest();
 }
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "open_spiel/games/chess/chess.h"
+#include <algorithm>
 #include <string>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
@@ -59,20 +60,17 @@ REGISTER_SPIEL_GAME(kGameType, Factory);
 
 RegisterSingleTensorObserver single_tensor(kGameType.short_name);
 
-// Adds a plane to the information state vector corresponding to the presence
-// and absence of the given piece type and colour at each square.
-void AddPieceTypePlane(Color color, PieceType piece_type,
-                       const ChessBoard& board,
-                       absl::Span<float>::iterator& value_it) {
-  for (int8_t y = 0; y < kMaxBoardSize; ++y) {
-    for (int8_t x = 0; x < kMaxBoardSize; ++x) {
-      Piece piece_on_board = board.at(Square{x, y});
-      *value_it++ =
-          (piece_on_board.color == color && piece_on_board.type == piece_type
-               ? 1.0
-               : 0.0);
-    }
-  }
+// Number of piece-configuration planes in the observation tensor: a white and
+// a black plane for every piece type, plus one plane for empty squares.
+constexpr int kNumPiecePlanes = 2 * kPieceTypes.size() + 1;
+
+// Plane index of a piece in the piece-configuration section of the
+// observation tensor: white and black planes in kPieceTypes order, followed
+// by the empty-square plane.
+int PiecePlaneIndex(const Piece& piece) {
+  if (piece.type == PieceType::kEmpty) return kNumPiecePlanes - 1;
+  return 2 * (static_cast<int>(piece.type) - 1) +
+         (piece.color == Color::kWhite ? 0 : 1);
 }
 
 // Adds a uniform scalar plane scaled with min and max.
@@ -93,7 +91,7 @@ ChessState::ChessState(std::shared_ptr<const Game> game)
     : State(game),
       start_board_(MakeDefaultBoard()),
       current_board_(start_board_) {
-  repetitions_[current_board_.HashValue()] = 1;
+  position_hashes_.push_back(current_board_.HashValue());
 }
 
 ChessState::ChessState(std::shared_ptr<const Game> game, const std::string& fen)
@@ -102,7 +100,18 @@ ChessState::ChessState(std::shared_ptr<const Game> game, const std::string& fen)
   SPIEL_CHECK_TRUE(maybe_board);
   start_board_ = *maybe_board;
   current_board_ = start_board_;
-  repetitions_[current_board_.HashValue()] = 1;
+  position_hashes_.push_back(current_board_.HashValue());
+}
+
+ChessState::ChessState(const ChessState& other)
+    : State(other),
+      moves_history_(other.moves_history_),
+      start_board_(other.start_board_),
+      current_board_(other.current_board_),
+      position_hashes_(other.position_hashes_),
+      cached_legal_actions_(other.cached_legal_actions_) {
+  // The observation-plane cache is intentionally not copied; the clone
+  // rebuilds it on its first ObservationTensor call.
 }
 
 Action ChessState::ParseMoveToAction(const std::string& move_str) const {
@@ -117,7 +126,7 @@ void ChessState::DoApplyAction(Action action) {
   Move move = ActionToMove(action, Board());
   moves_history_.push_back(move);
   Board().ApplyMove(move);
-  ++repetitions_[current_board_.HashValue()];
+  position_hashes_.push_back(current_board_.HashValue());
   cached_legal_actions_.reset();
 }
 
@@ -326,17 +335,12 @@ void ChessState::ObservationTensor(Player player,
 
   auto value_it = values.begin();
 
-  // Piece configuration.
-  for (const auto& piece_type : kPieceTypes) {
-    AddPieceTypePlane(Color::kWhite, piece_type, Board(), value_it);
-    AddPieceTypePlane(Color::kBlack, piece_type, Board(), value_it);
-  }
+  // Piece configuration, maintained incrementally across calls.
+  UpdatePiecePlanes();
+  value_it = std::copy(observation_piece_planes_.begin(),
+                       observation_piece_planes_.end(), value_it);
 
-  AddPieceTypePlane(Color::kEmpty, PieceType::kEmpty, Board(), value_it);
-
-  const auto entry = repetitions_.find(Board().HashValue());
-  SPIEL_CHECK_FALSE(entry == repetitions_.end());
-  int repetitions = entry->second;
+  int repetitions = RepetitionCount();
 
   // Num repetitions for the current board.
   AddScalarPlane(repetitions, 1, 3, value_it);
@@ -365,6 +369,31 @@ void ChessState::ObservationTensor(Player player,
   SPIEL_CHECK_EQ(value_it, values.end());
 }
 
+void ChessState::UpdatePiecePlanes() const {
+  const std::array<Piece, k2dMaxBoardSize>& pieces = Board().pieces();
+  if (observation_piece_planes_.empty()) {
+    // First call: build the planes from scratch.
+    observation_piece_planes_.assign(kNumPiecePlanes * k2dMaxBoardSize, 0.0);
+    for (int i = 0; i < k2dMaxBoardSize; ++i) {
+      observation_piece_planes_[PiecePlaneIndex(pieces[i]) * k2dMaxBoardSize +
+                                i] = 1.0;
+    }
+    observation_planes_board_ = pieces;
+    return;
+  }
+  // Later calls: only rewrite the squares whose piece changed.
+  for (int i = 0; i < k2dMaxBoardSize; ++i) {
+    if (observation_planes_board_[i] != pieces[i]) {
+      observation_piece_planes_[PiecePlaneIndex(observation_planes_board_[i]) *
+                                    k2dMaxBoardSize +
+                                i] = 0.0;
+      observation_piece_planes_[PiecePlaneIndex(pieces[i]) * k2dMaxBoardSize +
+                                i] = 1.0;
+      observation_planes_board_[i] = pieces[i];
+    }
+  }
+}
+
 std::unique_ptr<State> ChessState::Clone() const {
   return std::unique_ptr<State>(new ChessState(*this));
 }
@@ -372,7 +401,7 @@ std::unique_ptr<State> ChessState::Clone() const {
 void ChessState::UndoAction(Player player, Action action) {
   // TODO: Make this fast by storing undo info in another stack.
   SPIEL_CHECK_GE(moves_history_.size(), 1);
-  --repetitions_[current_board_.HashValue()];
+  position_hashes_.pop_back();
   moves_history_.pop_back();
   history_.pop_back();
   --move_number_;
@@ -383,9 +412,20 @@ void ChessState::UndoAction(Player player, Action action) {
 }
 
 bool ChessState::IsRepetitionDraw() const {
-  const auto entry = repetitions_.find(Board().HashValue());
-  SPIEL_CHECK_FALSE(entry == repetitions_.end());
-  return entry->second >= kNumRepetitionsToDraw;
+  return RepetitionCount() >= kNumRepetitionsToDraw;
+}
+
+int ChessState::RepetitionCount() const {
+  // The top of the stack is always the current position.
+  SPIEL_DCHECK_FALSE(position_hashes_.empty());
+  SPIEL_DCHECK_EQ(position_hashes_.back(), Board().HashValue());
+  const uint64_t current_hash = Board().HashValue();
+  int count = 0;
+  for (auto it = position_hashes_.rbegin(); it != position_hashes_.rend();
+       ++it) {
+    if (*it == current_hash) ++count;
+  }
+  return count;
 }
 
 absl::optional<std::vector<double>> ChessState::MaybeFinalReturns() const {
@@ -431,6 +471,17 @@ std::string ChessState::Serialize() const {
   return state_str;
 }
 
+int64_t ChessState::MemoryFootprint() const {
+  int64_t bytes = sizeof(*this) - sizeof(State) + State::MemoryFootprint();
+  bytes += moves_history_.capacity() * sizeof(Move);
+  bytes += position_hashes_.capacity() * sizeof(uint64_t);
+  if (cached_legal_actions_) {
+    bytes += cached_legal_actions_->capacity() * sizeof(Action);
+  }
+  bytes += observation_piece_planes_.capacity() * sizeof(float);
+  return bytes;
+}
+
 ChessGame::ChessGame(const GameParameters& params) : Game(kGameType, params) {}
 
 std::unique_ptr<State> ChessGame::DeserializeState(
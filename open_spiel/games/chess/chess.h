@@ -20,7 +20,6 @@
 #include <memory>
 #include <string>
 #include <vector>
-#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/memory/memory.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/games/chess/chess_board.h"
@@ -128,9 +127,9 @@ class ChessState : public State {
   // Constructs a chess state at the given position in Forsyth-Edwards Notation.
   // https://en.wikipedia.org/wiki/Forsyth%E2%80%93Edwards_Notation
   ChessState(std::shared_ptr<const Game> game, const std::string& fen);
-  ChessState(const ChessState&) = default;
-
-  ChessState& operator=(const ChessState&) = default;
+  // Copies everything except the cached observation planes, so that cloning
+  // inside a search remains cheap; clones rebuild the planes on first use.
+  ChessState(const ChessState&);
 
   Player CurrentPlayer() const override {
     return IsTerminal() ? kTerminalPlayerId : ColorToPlayer(Board().ToPlay());
@@ -173,6 +172,8 @@ class ChessState : public State {
 
   std::string Serialize() const override;
 
+  int64_t MemoryFootprint() const override;
+
  protected:
   void DoApplyAction(Action action) override;
 
@@ -181,6 +182,10 @@ class ChessState : public State {
   // board position has already appeared twice in the history).
   bool IsRepetitionDraw() const;
 
+  // How many times the current board position has appeared in the history
+  // stack (including the current board).
+  int RepetitionCount() const;
+
   // Calculates legal actions and caches them. This is separate from
   // LegalActions() as there are a number of other methods that need the value
   // of LegalActions. This is a separate method as it's called from
@@ -189,6 +194,11 @@ class ChessState : public State {
 
   absl::optional<std::vector<double>> MaybeFinalReturns() const;
 
+  // Brings the cached piece-configuration planes in sync with the current
+  // board. The first call builds them from scratch; later calls only patch
+  // the squares whose piece changed since the previous call.
+  void UpdatePiecePlanes() const;
+
   // We have to store every move made to check for repetitions and to implement
   // undo. We store the current board position as an optimization.
   std::vector<Move> moves_history_;
@@ -198,19 +208,21 @@ class ChessState : public State {
   // We store the current board position as an optimization.
   ChessBoard current_board_;
 
-  // RepetitionTable records how many times the given hash exists in the history
-  // stack (including the current board).
-  // We are already indexing by board hash, so there is no need to hash that
-  // hash again, so we use a custom passthrough hasher.
-  class PassthroughHash {
-   public:
-    std::size_t operator()(uint64_t x) const {
-      return static_cast<std::size_t>(x);
-    }
-  };
-  using RepetitionTable = absl::flat_hash_map<uint64_t, int, PassthroughHash>;
-  RepetitionTable repetitions_;
+  // Stack of Zobrist hashes of every position in the history (including the
+  // current board), appended to as moves are applied. Repetition counts are
+  // computed by scanning this stack backwards on demand; keeping a flat vector
+  // instead of a hash-keyed count table makes Clone() a plain memcpy, which
+  // matters for search algorithms that clone states frequently.
+  std::vector<uint64_t> position_hashes_;
   mutable absl::optional<std::vector<Action>> cached_legal_actions_;
+
+  // Piece-configuration planes of the observation tensor, built lazily on the
+  // first ObservationTensor call and then maintained incrementally (only
+  // squares touched by moves since the previous call are rewritten).
+  // observation_planes_board_ records the position the planes reflect. The
+  // cache is deliberately not copied by the copy constructor.
+  mutable std::vector<float> observation_piece_planes_;
+  mutable std::array<Piece, k2dMaxBoardSize> observation_planes_board_;
 };
 
 // Game object.
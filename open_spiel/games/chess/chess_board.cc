@@ -1330,14 +1330,101 @@ std::string ChessBoard::DebugString() const {
   return s;
 }
 
+namespace {
+
+// Offsets for all possible king moves, in the order they are generated.
+constexpr std::array<Offset, 8> kKingOffsets = {
+    {{1, 0}, {1, 1}, {1, -1}, {0, 1}, {0, -1}, {-1, 1}, {-1, 0}, {-1, -1}}};
+
+// Ray directions for sliding pieces. The first four are the rook directions
+// and the last four are the bishop directions, in the order the
+// Generate{Rook,Bishop}Destinations_ functions walk them.
+constexpr std::array<Offset, 8> kRayOffsets = {
+    {{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {-1, 1}, {1, -1}, {-1, -1}}};
+
+// In-board destinations precomputed for one square. King and knight lists
+// hold at most 8 destinations; ray lists hold at most board_size - 1 squares
+// in nearest-first order.
+struct DestinationList {
+  std::array<Square, 8> destinations;
+  int num_destinations = 0;
+};
+
+// Precomputed destination tables for the standard 8x8 board. With these, the
+// leaper generators skip the per-offset InBoardArea tests, and the sliding
+// generators scan a precomputed ray and only test occupancy instead of
+// stepping square by square with bounds checks. Boards of other sizes fall
+// back to the generic offset walks.
+struct DestinationTables {
+  DestinationTables() {
+    const auto in_board = [](const Square &sq) {
+      return sq.x >= 0 && sq.x < kDefaultBoardSize && sq.y >= 0 &&
+             sq.y < kDefaultBoardSize;
+    };
+    for (int8_t y = 0; y < kDefaultBoardSize; ++y) {
+      for (int8_t x = 0; x < kDefaultBoardSize; ++x) {
+        const Square sq{x, y};
+        const int index = y * kDefaultBoardSize + x;
+        for (const auto &offset : kKingOffsets) {
+          Square dest = sq + offset;
+          if (in_board(dest)) {
+            king[index].destinations[king[index].num_destinations++] = dest;
+          }
+        }
+        for (const auto &offset : kKnightOffsets) {
+          Square dest = sq + offset;
+          if (in_board(dest)) {
+            knight[index].destinations[knight[index].num_destinations++] =
+                dest;
+          }
+        }
+        for (int dir = 0; dir < static_cast<int>(kRayOffsets.size()); ++dir) {
+          DestinationList &ray = rays[dir][index];
+          for (Square dest = sq + kRayOffsets[dir]; in_board(dest);
+               dest += kRayOffsets[dir]) {
+            ray.destinations[ray.num_destinations++] = dest;
+          }
+        }
+      }
+    }
+  }
+
+  std::array<DestinationList, k2dMaxBoardSize> king;
+  std::array<DestinationList, k2dMaxBoardSize> knight;
+  std::array<std::array<DestinationList, k2dMaxBoardSize>, 8> rays;
+};
+
+const DestinationTables &Destinations8x8() {
+  static const DestinationTables tables;
+  return tables;
+}
+
+// Index into kRayOffsets for a unit step offset.
+int RayDirectionIndex(const Offset &step) {
+  static constexpr int kIndex[3][3] = {{7, 3, 6},   // y_offset == -1
+                                       {1, -1, 0},  // y_offset == 0
+                                       {5, 2, 4}};  // y_offset == 1
+  return kIndex[step.y_offset + 1][step.x_offset + 1];
+}
+
+}  // namespace
+
 // King moves without castling.
 template <typename YieldFn>
 void ChessBoard::GenerateKingDestinations_(Square sq, Color color,
                                            const YieldFn &yield) const {
-  static const std::array<Offset, 8> kOffsets = {
-      {{1, 0}, {1, 1}, {1, -1}, {0, 1}, {0, -1}, {-1, 1}, {-1, 0}, {-1, -1}}};
+  if (board_size_ == kDefaultBoardSize) {
+    const DestinationList &list = Destinations8x8().king[SquareToIndex_(sq)];
+    for (int i = 0; i < list.num_destinations; ++i) {
+      const Square &dest = list.destinations[i];
+      if (IsEmptyOrEnemy(dest, color)) {
+        yield(dest);
+      }
+    }
+    return;
+  }
 
-  for (const auto &offset : kOffsets) {
+  for (const auto &offset : kKingOffsets) {
     Square dest = sq + offset;
     if (InBoardArea(dest) && IsEmptyOrEnemy(dest, color)) {
       yield(dest);
@@ -1487,6 +1574,17 @@ void ChessBoard::GenerateBishopDestinations_(Square sq, Color color,
 template <typename YieldFn>
 void ChessBoard::GenerateKnightDestinations_(Square sq, Color color,
                                              const YieldFn &yield) const {
+  if (board_size_ == kDefaultBoardSize) {
+    const DestinationList &list = Destinations8x8().knight[SquareToIndex_(sq)];
+    for (int i = 0; i < list.num_destinations; ++i) {
+      const Square &dest = list.destinations[i];
+      if (IsEmptyOrEnemy(dest, color)) {
+        yield(dest);
+      }
+    }
+    return;
+  }
+
   for (const auto &offset : kKnightOffsets) {
     Square dest = sq + offset;
     if (InBoardArea(dest) && IsEmptyOrEnemy(dest, color)) {
@@ -1548,6 +1646,27 @@ void ChessBoard::GenerateRayDestinations_(Square sq, Color color,
                                           PseudoLegalMoveSettings settings,
                                           Offset offset_step,
                                           const YieldFn &yield) const {
+  if (board_size_ == kDefaultBoardSize) {
+    const DestinationList &list =
+        Destinations8x8()
+            .rays[RayDirectionIndex(offset_step)][SquareToIndex_(sq)];
+    for (int i = 0; i < list.num_destinations; ++i) {
+      const Square &dest = list.destinations[i];
+      if (IsEmpty(dest)) {
+        yield(dest);
+      } else if (IsEnemy(dest, color)) {
+        yield(dest);
+        if (settings == PseudoLegalMoveSettings::kAcknowledgeEnemyPieces) {
+          break;
+        }
+      } else {
+        // We have a friendly piece.
+        break;
+      }
+    }
+    return;
+  }
+
   for (Square dest = sq + offset_step; InBoardArea(dest); dest += offset_step) {
     if (IsEmpty(dest)) {
       yield(dest);
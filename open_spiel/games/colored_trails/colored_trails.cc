@@ -97,24 +97,26 @@ std::vector<Action> GenerateLegalActionsForChips(
     const Board& board,
     const std::vector<int>& player_chips,
     const std::vector<int>& responder_chips) {
+  // Scan the trade table precomputed by InitTradeInfo() instead of
+  // enumerating the combo product of the players' chips: every entry is
+  // already in reduced form, so an entry is legal here exactly when both of
+  // its sides are covered by the respective players' chips. This also keeps
+  // the ids sorted and duplicate-free without the per-state string
+  // round-trips the enumeration needed for the id lookups.
   std::vector<Action> actions;
-  ChipComboIterator proposer_iter(player_chips);
-  while (!proposer_iter.IsFinished()) {
-    std::vector<int> proposer_chips = proposer_iter.Next();
-    ChipComboIterator receiver_iter(responder_chips);
-    while (!receiver_iter.IsFinished()) {
-      std::vector<int> receiver_chips = receiver_iter.Next();
-      Trade trade(proposer_chips, receiver_chips);
-      if (IsLegalTrade(board, trade, proposer_chips, responder_chips)) {
-        int trade_id = game->LookupTradeId(trade.ToString());
-        actions.push_back(trade_id);
+  const std::vector<std::unique_ptr<Trade>>& trades = game->PossibleTrades();
+  for (int trade_id = 0; trade_id < trades.size(); ++trade_id) {
+    const Trade& trade = *trades[trade_id];
+    bool covered = true;
+    for (int i = 0; i < board.num_colors; ++i) {
+      if (trade.giving[i] > player_chips[i] ||
+          trade.receiving[i] > responder_chips[i]) {
+        covered = false;
+        break;
       }
     }
+    if (covered) actions.push_back(trade_id);
   }
-  // Sort and remove duplicates.
-  absl::c_sort(actions);
-  auto last = std::unique(actions.begin(), actions.end());
-  actions.erase(last, actions.end());
 
   // Add pass trade.
   actions.push_back(game->PassAction());
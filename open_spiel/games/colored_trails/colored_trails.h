@@ -249,6 +249,12 @@ class ColoredTrailsGame : public Game {
     return trade_info_.trade_str_to_id.at(trade_str);
   }
 
+  // The full table of reduced trades (trade id -> chip exchange vectors),
+  // built once per game configuration by InitTradeInfo().
+  const std::vector<std::unique_ptr<Trade>>& PossibleTrades() const {
+    return trade_info_.possible_trades;
+  }
+
   std::vector<Action> LookupTradesCache(const std::string& key) const;
   void AddToTradesCache(const std::string& key,
                         std::vector<Action>& actions) const;
@@ -15,6 +15,7 @@
 #include "open_spiel/games/connect_four/connect_four.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -74,14 +75,51 @@ std::string StateToString(CellState state) {
       return "This will never return.";
   }
 }
-}  // namespace
 
-CellState& ConnectFourState::CellAt(int row, int col) {
-  return board_[row * kCols + col];
+// Bitboard layout: 7 bits per column, column c occupying bits
+// [c * kBitsPerCol, c * kBitsPerCol + kRows), lowest bit at row 0. The
+// seventh (sentinel) bit of each column is always empty, which stops the
+// win-detection shifts and the drop carry from wrapping into the next
+// column.
+constexpr int kBitsPerCol = kRows + 1;
+
+constexpr uint64_t BitAt(int row, int col) {
+  return uint64_t{1} << (col * kBitsPerCol + row);
+}
+
+constexpr uint64_t ColumnMask(int col) {
+  return ((uint64_t{1} << kRows) - 1) << (col * kBitsPerCol);
 }
 
+constexpr uint64_t FullBoardMask() {
+  uint64_t mask = 0;
+  for (int col = 0; col < kCols; ++col) mask |= ColumnMask(col);
+  return mask;
+}
+
+// Whether the given bitboard contains four in a row, checked with one
+// shift-and per direction.
+bool HasFourInARow(uint64_t bitboard) {
+  // Vertical.
+  uint64_t pairs = bitboard & (bitboard >> 1);
+  if (pairs & (pairs >> 2)) return true;
+  // Horizontal.
+  pairs = bitboard & (bitboard >> kBitsPerCol);
+  if (pairs & (pairs >> (2 * kBitsPerCol))) return true;
+  // Diagonal up-right.
+  pairs = bitboard & (bitboard >> (kBitsPerCol + 1));
+  if (pairs & (pairs >> (2 * (kBitsPerCol + 1)))) return true;
+  // Diagonal down-right.
+  pairs = bitboard & (bitboard >> (kBitsPerCol - 1));
+  if (pairs & (pairs >> (2 * (kBitsPerCol - 1)))) return true;
+  return false;
+}
+}  // namespace
+
 CellState ConnectFourState::CellAt(int row, int col) const {
-  return board_[row * kCols + col];
+  if (bitboards_[0] & BitAt(row, col)) return CellState::kCross;
+  if (bitboards_[1] & BitAt(row, col)) return CellState::kNought;
+  return CellState::kEmpty;
 }
 
 int ConnectFourState::CurrentPlayer() const {
@@ -93,12 +131,14 @@ int ConnectFourState::CurrentPlayer() const {
 }
 
 void ConnectFourState::DoApplyAction(Action move) {
-  SPIEL_CHECK_EQ(CellAt(kRows - 1, move), CellState::kEmpty);
-  int row = 0;
-  while (CellAt(row, move) != CellState::kEmpty) ++row;
-  CellAt(row, move) = PlayerToState(CurrentPlayer());
-
-  if (HasLine(current_player_)) {
+  const uint64_t mask = bitboards_[0] | bitboards_[1];
+  // Adding the bottom bit of the column carries up to its lowest empty cell;
+  // a full column carries into the sentinel bit, outside the column mask.
+  const uint64_t move_bit = (mask + BitAt(0, move)) & ColumnMask(move);
+  SPIEL_CHECK_NE(move_bit, 0);
+  bitboards_[current_player_] |= move_bit;
+
+  if (HasFourInARow(bitboards_[current_player_])) {
     outcome_ = static_cast<Outcome>(current_player_);
   } else if (IsFull()) {
     outcome_ = Outcome::kDraw;
@@ -111,8 +151,9 @@ std::vector<Action> ConnectFourState::LegalActions() const {
   // Can move in any non-full column.
   std::vector<Action> moves;
   if (IsTerminal()) return moves;
+  const uint64_t mask = bitboards_[0] | bitboards_[1];
   for (int col = 0; col < kCols; ++col) {
-    if (CellAt(kRows - 1, col) == CellState::kEmpty) moves.push_back(col);
+    if ((mask & BitAt(kRows - 1, col)) == 0) moves.push_back(col);
   }
   return moves;
 }
@@ -122,49 +163,26 @@ std::string ConnectFourState::ActionToString(Player player,
   return absl::StrCat(StateToString(PlayerToState(player)), action_id);
 }
 
-bool ConnectFourState::HasLineFrom(Player player, int row, int col) const {
-  return HasLineFromInDirection(player, row, col, 0, 1) ||
-         HasLineFromInDirection(player, row, col, -1, -1) ||
-         HasLineFromInDirection(player, row, col, -1, 0) ||
-         HasLineFromInDirection(player, row, col, -1, 1);
-}
-
-bool ConnectFourState::HasLineFromInDirection(Player player, int row, int col,
-                                              int drow, int dcol) const {
-  if (row + 3 * drow >= kRows || col + 3 * dcol >= kCols ||
-      row + 3 * drow < 0 || col + 3 * dcol < 0)
-    return false;
-  CellState c = PlayerToState(player);
-  for (int i = 0; i < 4; ++i) {
-    if (CellAt(row, col) != c) return false;
-    row += drow;
-    col += dcol;
-  }
-  return true;
-}
-
 bool ConnectFourState::HasLine(Player player) const {
-  CellState c = PlayerToState(player);
-  for (int col = 0; col < kCols; ++col) {
-    for (int row = 0; row < kRows; ++row) {
-      if (CellAt(row, col) == c && HasLineFrom(player, row, col)) return true;
-    }
-  }
-  return false;
+  return HasFourInARow(bitboards_[player]);
 }
 
 bool ConnectFourState::IsFull() const {
-  for (int col = 0; col < kCols; ++col) {
-    if (CellAt(kRows - 1, col) == CellState::kEmpty) return false;
-  }
-  return true;
+  return (bitboards_[0] | bitboards_[1]) == FullBoardMask();
 }
 
-ConnectFourState::ConnectFourState(std::shared_ptr<const Game> game)
-    : State(game) {
-  std::fill(begin(board_), end(board_), CellState::kEmpty);
+uint64_t ConnectFourState::Key() const {
+  // The standard Connect Four transposition-table key: the sum of the
+  // player-to-move's stones and the occupancy mask. The per-column sums
+  // cannot collide (the sentinel bits absorb the carries) and uniquely
+  // encode both bitboards, and the player to move is implied by the stone
+  // count.
+  return bitboards_[current_player_] + (bitboards_[0] | bitboards_[1]);
 }
 
+ConnectFourState::ConnectFourState(std::shared_ptr<const Game> game)
+    : State(game), bitboards_{0, 0} {}
+
 std::string ConnectFourState::ToString() const {
   std::string str;
   for (int row = kRows - 1; row >= 0; --row) {
@@ -218,7 +236,8 @@ void ConnectFourState::ObservationTensor(Player player,
   TensorView<2> view(values, {kCellStates, kNumCells}, true);
 
   for (int cell = 0; cell < kNumCells; ++cell) {
-    view[{PlayerRelative(board_[cell], player), cell}] = 1.0;
+    view[{PlayerRelative(CellAt(cell / kCols, cell % kCols), player), cell}] =
+        1.0;
   }
 }
 
@@ -231,7 +250,7 @@ ConnectFourGame::ConnectFourGame(const GameParameters& params)
 
 ConnectFourState::ConnectFourState(std::shared_ptr<const Game> game,
                                    const std::string& str)
-    : State(game) {
+    : State(game), bitboards_{0, 0} {
   int xs = 0;
   int os = 0;
   int r = 5;
@@ -239,15 +258,14 @@ ConnectFourState::ConnectFourState(std::shared_ptr<const Game> game,
   for (const char ch : str) {
     switch (ch) {
       case '.':
-        CellAt(r, c) = CellState::kEmpty;
         break;
       case 'x':
         ++xs;
-        CellAt(r, c) = CellState::kCross;
+        bitboards_[0] |= BitAt(r, c);
         break;
       case 'o':
         ++os;
-        CellAt(r, c) = CellState::kNought;
+        bitboards_[1] |= BitAt(r, c);
         break;
     }
     if (ch == '.' || ch == 'x' || ch == 'o') {
@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_GAMES_CONNECT_FOUR_H_
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -85,20 +86,25 @@ class ConnectFourState : public State {
     return Clone();
   }
 
+  // A key uniquely identifying the position (board contents and player to
+  // move), suitable for transposition tables in alpha-beta search. Equal
+  // positions reached by different move orders share a key.
+  uint64_t Key() const;
+
  protected:
   void DoApplyAction(Action move) override;
 
  private:
-  CellState& CellAt(int row, int col);
   CellState CellAt(int row, int col) const;
   bool HasLine(Player player) const;  // Does this player have a line?
-  bool HasLineFrom(Player player, int row, int col) const;
-  bool HasLineFromInDirection(Player player, int row, int col, int drow,
-                              int dcol) const;
-  bool IsFull() const;         // Is the board full?
-  Player current_player_ = 0;  // Player zero goes first
+  bool IsFull() const;                // Is the board full?
+  Player current_player_ = 0;         // Player zero goes first
   Outcome outcome_ = Outcome::kUnknown;
-  std::array<CellState, kNumCells> board_;
+  // One bitboard per player in the canonical 7-bits-per-column layout: cell
+  // (row, col) is bit col * (kRows + 1) + row, with a sentinel bit on top of
+  // each column so that shifts and carries never wrap between columns. See
+  // HasLine/DoApplyAction in connect_four.cc.
+  std::array<uint64_t, kNumPlayers> bitboards_;
 };
 
 // Game object.
@@ -79,6 +79,22 @@ void CheckFullBoardDraw() {
   SPIEL_CHECK_EQ(state.Returns(), (std::vector<double>{0, 0}));
 }
 
+void TranspositionKeyTest() {
+  std::shared_ptr<const Game> game = LoadGame("connect_four");
+  // The same position reached by transposed move orders shares a key.
+  auto state_a = game->NewInitialState();
+  for (Action action : {3, 2, 4, 5}) state_a->ApplyAction(action);
+  auto state_b = game->NewInitialState();
+  for (Action action : {4, 5, 3, 2}) state_b->ApplyAction(action);
+  SPIEL_CHECK_EQ(static_cast<ConnectFourState*>(state_a.get())->Key(),
+                 static_cast<ConnectFourState*>(state_b.get())->Key());
+  // A different position does not.
+  auto state_c = game->NewInitialState();
+  for (Action action : {3, 2, 4, 6}) state_c->ApplyAction(action);
+  SPIEL_CHECK_NE(static_cast<ConnectFourState*>(state_a.get())->Key(),
+                 static_cast<ConnectFourState*>(state_c.get())->Key());
+}
+
 }  // namespace
 }  // namespace connect_four
 }  // namespace open_spiel
@@ -88,4 +104,5 @@ int main(int argc, char **argv) {
   open_spiel::connect_four::FastLoss();
   open_spiel::connect_four::BasicSerializationTest();
   open_spiel::connect_four::CheckFullBoardDraw();
+  open_spiel::connect_four::TranspositionKeyTest();
 }
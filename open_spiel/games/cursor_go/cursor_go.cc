@@ -228,7 +228,7 @@ void CursorGoState::DoApplyAction(Action action) {
     to_play_ = OppColor(to_play_);
     cursor_moves_count_ = 0;
 
-    bool was_inserted = repetitions_.insert(board_.HashValue()).second;
+    bool was_inserted = repetitions_.Insert(board_.HashValue());
     if (!was_inserted && action == kActionPlaceStone) {
       // We have encountered this position before.
       superko_ = true;
@@ -269,8 +269,8 @@ void CursorGoState::ResetBoard() {
     to_play_ = GoColor::kWhite;
   }
 
-  repetitions_.clear();
-  repetitions_.insert(board_.HashValue());
+  repetitions_.Clear();
+  repetitions_.Insert(board_.HashValue());
   superko_ = false;
   is_terminal_ = false;
   last_move_was_pass_ = false;
@@ -109,9 +109,17 @@ DarkHexState::DarkHexState(std::shared_ptr<const Game> game, int num_cols,
       num_rows_(num_rows),
       num_cells_(num_cols * num_rows),
       bits_per_action_(num_cells_ + 1),
-      longest_sequence_(num_cells_ * 2 - 1) {
-  black_view_.resize(num_cols * num_rows, CellState::kEmpty);
-  white_view_.resize(num_cols * num_rows, CellState::kEmpty);
+      longest_sequence_(num_cells_ * 2 - 1),
+      black_view_(num_cells_),
+      white_view_(num_cells_) {
+  std::string empty_view;
+  for (int r = 0; r < num_rows_; ++r) {
+    if (r > 0) absl::StrAppend(&empty_view, "\n");
+    for (int c = 0; c < num_cols_; ++c) {
+      absl::StrAppend(&empty_view, StateToString(CellState::kEmpty));
+    }
+  }
+  view_strings_.fill(empty_view);
 }
 
 void DarkHexState::DoApplyAction(Action move) {
@@ -135,21 +143,31 @@ void DarkHexState::DoApplyAction(Action move) {
 
   SPIEL_CHECK_EQ(cur_view[move], CellState::kEmpty);
   // Update the view - only using CellState::kBlack and CellState::kWhite
+  CellState revealed = CellState::kEmpty;
   if (state_.BoardAt(move) == CellState::kBlack ||
       state_.BoardAt(move) == CellState::kBlackNorth ||
       state_.BoardAt(move) == CellState::kBlackSouth) {
-    cur_view[move] = CellState::kBlack;
+    revealed = CellState::kBlack;
   } else if (state_.BoardAt(move) == CellState::kWhite ||
              state_.BoardAt(move) == CellState::kWhiteEast ||
              state_.BoardAt(move) == CellState::kWhiteWest) {
-    cur_view[move] = CellState::kWhite;
+    revealed = CellState::kWhite;
   } else if (state_.BoardAt(move) == CellState::kBlackWin ||
              state_.BoardAt(move) == CellState::kWhiteWin) {
-    cur_view[move] = state_.BoardAt(move);
+    revealed = state_.BoardAt(move);
   } else {
     SPIEL_CHECK_TRUE(false);
   }
+  cur_view.Set(move, revealed);
+  view_strings_[cur_player][ViewStringIndex(move)] = StateToString(revealed)[0];
+
   action_sequence_.push_back(std::pair<int, Action>(cur_player, move));
+  absl::StrAppend(&action_sequence_strings_[cur_player], cur_player, ",", move,
+                  " ");
+  if (obs_type_ == ObservationType::kRevealNumTurns) {
+    absl::StrAppend(&action_sequence_strings_[1 - cur_player], cur_player,
+                    ",? ");
+  }
 }
 
 std::vector<Action> DarkHexState::LegalActions() const {
@@ -168,36 +186,13 @@ std::vector<Action> DarkHexState::LegalActions() const {
 }
 
 std::string DarkHexState::ViewToString(Player player) const {
-  const auto& cur_view = (player == 0 ? black_view_ : white_view_);
-  std::string str;
-
-  for (int r = 0; r < num_rows_; ++r) {
-    for (int c = 0; c < num_cols_; ++c) {
-      absl::StrAppend(&str, StateToString(cur_view[r * num_cols_ + c]));
-    }
-    if (r < (num_rows_ - 1)) {
-      absl::StrAppend(&str, "\n");
-    }
-  }
-  return str;
+  return view_strings_[player];
 }
 
 std::string DarkHexState::ActionSequenceToString(Player player) const {
   SPIEL_CHECK_GE(player, 0);
   SPIEL_CHECK_LT(player, num_players_);
-
-  std::string str;
-  for (const auto& player_with_action : action_sequence_) {
-    if (player_with_action.first == player) {
-      absl::StrAppend(&str, player_with_action.first, ",");
-      absl::StrAppend(&str, player_with_action.second, " ");
-    } else if (obs_type_ == ObservationType::kRevealNumTurns) {
-      absl::StrAppend(&str, player_with_action.first, ",? ");
-    } else {
-      SPIEL_CHECK_EQ(obs_type_, ObservationType::kRevealNothing);
-    }
-  }
-  return str;
+  return action_sequence_strings_[player];
 }
 
 std::string DarkHexState::InformationStateString(Player player) const {
@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_GAMES_DARK_HEX_H_
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -87,6 +88,60 @@ enum class GameVersion {
   kClassicalDarkHex,
 };
 
+// A per-player view of the board, bit-packed three bits per cell into uint64
+// words. A dark hex view only ever holds five of the nine hex cell states
+// (empty, the two colors, and the two winning-move markers), so three bits
+// per cell suffice. Tabular phantom-game solvers keep a large number of
+// cloned states alive at once, which makes the per-state footprint of the
+// views the binding memory constraint; packing shrinks each view by an order
+// of magnitude compared to a vector of CellState.
+class BitPackedView {
+ public:
+  explicit BitPackedView(int num_cells)
+      : words_((num_cells + kCellsPerWord - 1) / kCellsPerWord, 0) {}
+
+  hex::CellState operator[](int cell) const {
+    int code = (words_[cell / kCellsPerWord] >>
+                ((cell % kCellsPerWord) * kBitsPerCell)) &
+               kCellMask;
+    return kCodeToState[code];
+  }
+
+  void Set(int cell, hex::CellState state) {
+    uint64_t& word = words_[cell / kCellsPerWord];
+    int shift = (cell % kCellsPerWord) * kBitsPerCell;
+    word = (word & ~(static_cast<uint64_t>(kCellMask) << shift)) |
+           (static_cast<uint64_t>(StateToCode(state)) << shift);
+  }
+
+ private:
+  static constexpr int kBitsPerCell = 3;
+  static constexpr int kCellsPerWord = 64 / kBitsPerCell;
+  static constexpr int kCellMask = (1 << kBitsPerCell) - 1;
+  static constexpr hex::CellState kCodeToState[] = {
+      hex::CellState::kEmpty, hex::CellState::kBlack, hex::CellState::kWhite,
+      hex::CellState::kBlackWin, hex::CellState::kWhiteWin};
+
+  static int StateToCode(hex::CellState state) {
+    switch (state) {
+      case hex::CellState::kEmpty:
+        return 0;
+      case hex::CellState::kBlack:
+        return 1;
+      case hex::CellState::kWhite:
+        return 2;
+      case hex::CellState::kBlackWin:
+        return 3;
+      case hex::CellState::kWhiteWin:
+        return 4;
+      default:
+        SpielFatalError("Cell state never appears in a dark hex view");
+    }
+  }
+
+  std::vector<uint64_t> words_;
+};
+
 class DarkHexState : public State {
  public:
   DarkHexState(std::shared_ptr<const Game> game, int num_cols, int num_rows,
@@ -119,6 +174,12 @@ class DarkHexState : public State {
  private:
   std::string ActionSequenceToString(Player player) const;
 
+  // Offset of a cell inside the cached view string; each row is num_cols_
+  // cells followed by a newline.
+  int ViewStringIndex(int cell) const {
+    return (cell / num_cols_) * (num_cols_ + 1) + (cell % num_cols_);
+  }
+
   hex::HexState state_;
   ObservationType obs_type_;
   GameVersion game_version_;
@@ -130,8 +191,15 @@ class DarkHexState : public State {
 
   // Change this to _history on base class
   std::vector<std::pair<int, Action>> action_sequence_;
-  std::vector<hex::CellState> black_view_;
-  std::vector<hex::CellState> white_view_;
+  BitPackedView black_view_;
+  BitPackedView white_view_;
+
+  // Incrementally-maintained information-state pieces. A move changes one
+  // cell of one view and appends one entry to the action sequence, so
+  // DoApplyAction patches these strings in place and the info-state queries
+  // return them directly instead of rebuilding them from scratch.
+  std::array<std::string, hex::kNumPlayers> view_strings_;
+  std::array<std::string, hex::kNumPlayers> action_sequence_strings_;
 };
 
 class DarkHexGame : public Game {
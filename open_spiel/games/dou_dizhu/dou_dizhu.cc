@@ -278,15 +278,13 @@ std::vector<Action> DouDizhuState::BiddingLegalActions() const {
 }
 
 std::vector<Action> DouDizhuState::PlayLegalActions() const {
-  std::vector<Action> legal_actions;
-  // the leader of a trick must play./ an action and cannot pass
-  if (!new_trick_begin_) legal_actions.push_back(kPass);
-
-  std::array<int, kNumRanks> hand = holds_[current_player_];
+  const std::array<int, kNumRanks>& hand = holds_[current_player_];
   const int prev_action = CurrentTrick().WinningAction();
-  SearchForLegalActions(&legal_actions, hand, prev_action);
+  std::vector<Action> legal_actions = CachedLegalActions(hand, prev_action);
 
-  absl::c_sort(legal_actions);
+  // the leader of a trick must play an action and cannot pass. kPass sorts
+  // before every play action.
+  if (!new_trick_begin_) legal_actions.insert(legal_actions.begin(), kPass);
   return legal_actions;
 }
 
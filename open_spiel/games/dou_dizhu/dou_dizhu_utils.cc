@@ -14,7 +14,11 @@
 
 #include "open_spiel/games/dou_dizhu/dou_dizhu_utils.h"
 
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/utils/lru_cache.h"
 
 namespace open_spiel {
 namespace dou_dizhu {
@@ -924,5 +928,33 @@ void SearchForLegalActions(std::vector<Action>* legal_actions,
   }
 }
 
+uint64_t HandToKey(absl::Span<const int> hand) {
+  uint64_t key = 0;
+  for (int rank = 0; rank < kNumRanks; ++rank) {
+    key |= static_cast<uint64_t>(hand[rank]) << (4 * rank);
+  }
+  return key;
+}
+
+std::vector<Action> CachedLegalActions(absl::Span<const int> hand,
+                                       int prev_action) {
+  // Sharded so that parallel solver threads only contend when they hit the
+  // same shard. Combination generation dominates LegalActions and the same
+  // (rank counts, action to beat) pairs recur constantly within a game, so
+  // the recursive searches are memoized here.
+  static ShardedLRUCache<std::pair<uint64_t, int>, std::vector<Action>>*
+      cache = new ShardedLRUCache<std::pair<uint64_t, int>,
+                                  std::vector<Action>>(/*max_size=*/1 << 18,
+                                                       /*num_shards=*/16);
+  const std::pair<uint64_t, int> key = {HandToKey(hand), prev_action};
+  absl::optional<const std::vector<Action>> cached = cache->Get(key);
+  if (cached.has_value()) return *cached;
+  std::vector<Action> legal_actions;
+  SearchForLegalActions(&legal_actions, hand, prev_action);
+  absl::c_sort(legal_actions);
+  cache->Set(key, legal_actions);
+  return legal_actions;
+}
+
 }  // namespace dou_dizhu
 }  // namespace open_spiel
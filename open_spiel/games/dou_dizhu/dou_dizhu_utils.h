@@ -15,6 +15,8 @@
 #ifndef OPEN_SPIEL_GAMES_DOU_DIZHU_DOU_DIZHU_UTILS_H_
 #define OPEN_SPIEL_GAMES_DOU_DIZHU_DOU_DIZHU_UTILS_H_
 
+#include <cstdint>
+
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/spiel.h"
 
@@ -172,6 +174,17 @@ std::array<int, kNumRanks> ActionToHand(int action);
 void SearchForLegalActions(std::vector<Action>* legal_actions,
                            absl::Span<const int> hand, int prev_action);
 
+// Packs the per-rank card counts of a hand into a single integer, four bits
+// per rank. Hands with identical rank counts map to the same key.
+uint64_t HandToKey(absl::Span<const int> hand);
+
+// Memoized SearchForLegalActions: legal play actions only depend on the
+// hand's rank counts and the action to beat, so the recursively generated
+// combinations are cached under (HandToKey(hand), prev_action). The returned
+// actions are sorted.
+std::vector<Action> CachedLegalActions(absl::Span<const int> hand,
+                                       int prev_action);
+
 }  // namespace dou_dizhu
 }  // namespace open_spiel
 
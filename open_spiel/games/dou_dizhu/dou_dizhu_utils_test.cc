@@ -14,6 +14,7 @@
 
 #include "open_spiel/games/dou_dizhu/dou_dizhu_utils.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 
@@ -162,6 +163,31 @@ void AirplaneCombHandTest() {
   SPIEL_CHECK_EQ(static_cast<int>(actions3.size()), 1052);
 }
 
+void CachedLegalActionsTest() {
+  // 558999TJJJJKKK plus both jokers.
+  std::array<int, kNumRanks> current_hand = {0, 0, 2, 0, 0, 1, 3, 1,
+                                             4, 0, 3, 0, 0, 1, 1};
+
+  // Keys only depend on the rank counts.
+  std::array<int, kNumRanks> same_counts = current_hand;
+  SPIEL_CHECK_EQ(HandToKey(current_hand), HandToKey(same_counts));
+  same_counts[0] = 1;
+  SPIEL_CHECK_NE(HandToKey(current_hand), HandToKey(same_counts));
+
+  // The cached results match the direct search, sorted, both on the first
+  // (miss) and second (hit) call.
+  for (int prev_action : {static_cast<int>(kInvalidAction), kTrioActionBase}) {
+    std::vector<Action> direct;
+    SearchForLegalActions(&direct, current_hand, prev_action);
+    std::sort(direct.begin(), direct.end());
+    for (int repeat = 0; repeat < 2; ++repeat) {
+      std::vector<Action> cached = CachedLegalActions(current_hand,
+                                                      prev_action);
+      SPIEL_CHECK_EQ(cached, direct);
+    }
+  }
+}
+
 }  // namespace dou_dizhu
 }  // namespace open_spiel
 
@@ -170,4 +196,5 @@ int main() {
   open_spiel::dou_dizhu::ChainOnlyHandTest();
   open_spiel::dou_dizhu::SingleTrioCombHandTest();
   open_spiel::dou_dizhu::AirplaneCombHandTest();
+  open_spiel::dou_dizhu::CachedLegalActionsTest();
 }
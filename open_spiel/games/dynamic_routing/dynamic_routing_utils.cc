@@ -122,6 +122,32 @@ Network::Network(
   capacity_ = AssignExistingOrDefaultValues(capacity, road_sections, 1);
   free_flow_travel_time_ =
       AssignExistingOrDefaultValues(free_flow_travel_time, road_sections, 1);
+  // Pack the per-link data into tables indexed by action id so that the
+  // per-time-step queries do not hash road section strings.
+  int num_sections = num_actions();
+  bpr_a_by_link_.assign(num_sections, 0);
+  bpr_b_by_link_.assign(num_sections, 1);
+  capacity_by_link_.assign(num_sections, 1);
+  free_flow_travel_time_by_link_.assign(num_sections, 1);
+  is_link_sink_.assign(num_sections, false);
+  successor_actions_by_link_.assign(num_sections, {});
+  for (int action = kNoPossibleAction + 1; action < num_sections; ++action) {
+    const std::string& road_section = road_section_by_action.at(action);
+    bpr_a_by_link_[action] = bpr_a_coefficient_.at(road_section);
+    bpr_b_by_link_[action] = bpr_b_coefficient_.at(road_section);
+    capacity_by_link_[action] = capacity_.at(road_section);
+    free_flow_travel_time_by_link_[action] =
+        free_flow_travel_time_.at(road_section);
+    is_link_sink_[action] = sink_road_sections_.contains(road_section);
+    std::string end_node = NodesFromRoadSection(road_section)[1];
+    for (const std::string& successor : adjacency_list_.at(end_node)) {
+      successor_actions_by_link_[action].push_back(
+          action_by_road_section_.at(
+              RoadSectionFromNodes(end_node, successor)));
+    }
+    std::sort(successor_actions_by_link_[action].begin(),
+              successor_actions_by_link_[action].end());
+  }
 }
 
 float Network::GetTravelTime(absl::string_view road_section,
@@ -142,6 +168,28 @@ bool Network::IsLocationASinkNode(absl::string_view road_section) const {
   return sink_road_sections_.contains(road_section);
 }
 
+float Network::GetTravelTime(int road_section_id, float volume) const {
+  SPIEL_CHECK_GT(road_section_id, kNoPossibleAction);
+  SPIEL_CHECK_LT(road_section_id, num_actions());
+  return free_flow_travel_time_by_link_[road_section_id] *
+         (1.0 + bpr_a_by_link_[road_section_id] *
+                    pow(volume / capacity_by_link_[road_section_id],
+                        bpr_b_by_link_[road_section_id]));
+}
+
+bool Network::IsLocationASinkNode(int road_section_id) const {
+  SPIEL_CHECK_GT(road_section_id, kNoPossibleAction);
+  SPIEL_CHECK_LT(road_section_id, num_actions());
+  return is_link_sink_[road_section_id];
+}
+
+const std::vector<int>& Network::GetSuccessorActions(
+    int road_section_id) const {
+  SPIEL_CHECK_GT(road_section_id, kNoPossibleAction);
+  SPIEL_CHECK_LT(road_section_id, num_actions());
+  return successor_actions_by_link_[road_section_id];
+}
+
 int Network::GetActionIdFromMovement(absl::string_view origin,
                                      absl::string_view destination) const {
   std::string section = RoadSectionFromNodes(origin, destination);
@@ -117,6 +117,17 @@ class Network {
   //   volume: the volume on the road section.
   float GetTravelTime(absl::string_view road_section, float volume) const;
 
+  // Id-based overloads of the queries above, reading the packed per-link
+  // tables built at construction. Road section ids are the 1-based action
+  // indices; these avoid the string hashing of the string_view overloads on
+  // the per-time-step simulation paths.
+  bool IsLocationASinkNode(int road_section_id) const;
+  float GetTravelTime(int road_section_id, float volume) const;
+
+  // Returns the action ids of the road sections reachable from the end node
+  // of the road section with the given id, sorted in increasing order.
+  const std::vector<int>& GetSuccessorActions(int road_section_id) const;
+
   // Maps two connected nodes to an action.
   int GetActionIdFromMovement(absl::string_view origin,
                               absl::string_view destination) const;
@@ -176,6 +187,16 @@ class Network {
   std::vector<std::string> road_section_by_action;
   // flat_hash_set that contains sink locations.
   absl::flat_hash_set<std::string> sink_road_sections_;
+  // Packed per-link tables indexed by the road section's action id (entry 0
+  // is the dummy kNoPossibleAction slot), mirroring the string-keyed maps
+  // above so the per-time-step evolution reads arrays instead of hashing
+  // road section strings.
+  std::vector<float> bpr_a_by_link_;
+  std::vector<float> bpr_b_by_link_;
+  std::vector<float> capacity_by_link_;
+  std::vector<float> free_flow_travel_time_by_link_;
+  std::vector<bool> is_link_sink_;
+  std::vector<std::vector<int>> successor_actions_by_link_;
 };
 }  // namespace open_spiel::dynamic_routing
 
@@ -103,6 +103,17 @@ void TestNetworkAdjacencyListInit() {
   SPIEL_CHECK_EQ(network->GetRoadSectionFromActionId(1), "A->D");
 }
 
+void TestNetworkIdBasedQueries() {
+  auto network = InitNetwork();
+  SPIEL_CHECK_TRUE(network->IsLocationASinkNode(1));   // "A->D"
+  SPIEL_CHECK_FALSE(network->IsLocationASinkNode(2));  // "O->A"
+  SPIEL_CHECK_EQ(network->GetSuccessorActions(2), std::vector<int>{1});
+  SPIEL_CHECK_TRUE(network->GetSuccessorActions(1).empty());
+  // Default coefficients: a = 0, so the travel time is the free flow travel
+  // time (1) for any volume.
+  SPIEL_CHECK_FLOAT_EQ(network->GetTravelTime(2, 1000.0), 1.0);
+}
+
 // Exceptions are checked in the code with SPIEL_CHECK_TRUE.
 
 }  // namespace
@@ -117,4 +128,5 @@ int main(int argc, char** argv) {
   open_spiel::dynamic_routing::TestOdDemandInstanciation2();
   open_spiel::dynamic_routing::TestNetworkInitWithEmpty();
   open_spiel::dynamic_routing::TestNetworkAdjacencyListInit();
+  open_spiel::dynamic_routing::TestNetworkIdBasedQueries();
 }
@@ -15,9 +15,12 @@
 #include "open_spiel/games/efg_game/efg_game.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <memory>
+#include <string>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
@@ -25,6 +28,7 @@
 #include "open_spiel/abseil-cpp/absl/strings/numbers.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/file.h"
@@ -89,7 +93,7 @@ std::string NodeToString(const Node* node) {
 }
 
 std::string EFGInformationStateString(Player owner, Player observer, int number,
-                                      const std::string& name) {
+                                      absl::string_view name) {
   return absl::StrCat(owner, "-", observer, "-", number, "-", name);
 }
 }  // namespace
@@ -114,7 +118,7 @@ std::string EFGState::ActionToString(Player player, Action action) const {
   int action_idx = ActionIdx(action);
   SPIEL_CHECK_GE(action_idx, 0);
   SPIEL_CHECK_LT(action_idx, cur_node_->actions.size());
-  return cur_node_->actions[action_idx];
+  return std::string(cur_node_->actions[action_idx]);
 }
 
 std::string EFGState::ToString() const {
@@ -280,7 +284,8 @@ std::vector<int> EFGGame::InformationStateTensorShape() const {
 EFGGame::EFGGame(const GameParameters& params)
     : Game(kGameType, params),
       filename_(ParameterValue<std::string>("filename")),
-      string_data_(file::ReadContentsFromFile(filename_, "r")),
+      mapped_data_(std::make_unique<file::MappedFile>(filename_)),
+      data_(mapped_data_->contents()),
       pos_(0),
       num_chance_nodes_(0),
       max_actions_(0),
@@ -289,7 +294,7 @@ EFGGame::EFGGame(const GameParameters& params)
       identical_payoffs_(true),
       general_sum_(true),
       perfect_information_(true) {
-  SPIEL_CHECK_GT(string_data_.size(), 0);
+  SPIEL_CHECK_GT(data_.size(), 0);
 
   // Now parse the string data into a data structure.
   ParseGame();
@@ -298,6 +303,7 @@ EFGGame::EFGGame(const GameParameters& params)
 EFGGame::EFGGame(const std::string& data)
     : Game(kGameType, {}),
       string_data_(data),
+      data_(string_data_),
       pos_(0),
       num_chance_nodes_(0),
       max_actions_(0),
@@ -360,7 +366,7 @@ std::unique_ptr<Node> EFGGame::NewNode() const {
       __FILE__, ":", __LINE__, " CHECK_FALSE(", #x, ")\n",       \
       " while parsing line #", line_, ":\n", GetLine(line_)))
 
-bool EFGGame::ParseDoubleValue(const std::string& str, double* value) const {
+bool EFGGame::ParseDoubleValue(absl::string_view str, double* value) const {
   if (absl::StrContains(str, '/')) {
     // Check for rational number of the form X/Y
     std::vector<std::string> parts = absl::StrSplit(str, '/');
@@ -384,30 +390,30 @@ bool EFGGame::ParseDoubleValue(const std::string& str, double* value) const {
 }
 
 
-std::string EFGGame::NextPayoffToken() {
-  std::string str = "";
+absl::string_view EFGGame::NextPayoffToken() {
+  std::size_t start = pos_;
   bool seen_comma = false;
 
   while (true) {
     // Check stopping condition:
-    if (pos_ >= string_data_.length() ||
-        string_data_.at(pos_) == ',' ||
-        IsWhiteSpace(string_data_.at(pos_))) {
+    if (pos_ >= data_.length() ||
+        data_.at(pos_) == ',' ||
+        IsWhiteSpace(data_.at(pos_))) {
       break;
     }
 
-    str.push_back(string_data_.at(pos_));
     AdvancePosition();
   }
+  absl::string_view str = data_.substr(start, pos_ - start);
 
   // Advance the position to the next token.
-  while (pos_ < string_data_.length()) {
-    if (!seen_comma && string_data_.at(pos_) == ',') {
+  while (pos_ < data_.length()) {
+    if (!seen_comma && data_.at(pos_) == ',') {
       seen_comma = true;
       AdvancePosition();
       continue;
     }
-    if (!IsWhiteSpace(string_data_.at(pos_))) {
+    if (!IsWhiteSpace(data_.at(pos_))) {
       break;
     }
     AdvancePosition();
@@ -416,34 +422,34 @@ std::string EFGGame::NextPayoffToken() {
   return str;
 }
 
-std::string EFGGame::NextToken() {
-  std::string str = "";
+absl::string_view EFGGame::NextToken() {
   bool reading_quoted_string = false;
 
-  if (string_data_.at(pos_) == '"') {
+  if (data_.at(pos_) == '"') {
     reading_quoted_string = true;
     AdvancePosition();
   }
+  std::size_t start = pos_;
 
   while (true) {
     // Check stopping condition:
-    if (pos_ >= string_data_.length() ||
-        (reading_quoted_string && string_data_.at(pos_) == '"') ||
-        (!reading_quoted_string && IsWhiteSpace(string_data_.at(pos_)))) {
+    if (pos_ >= data_.length() ||
+        (reading_quoted_string && data_.at(pos_) == '"') ||
+        (!reading_quoted_string && IsWhiteSpace(data_.at(pos_)))) {
       break;
     }
 
-    str.push_back(string_data_.at(pos_));
     AdvancePosition();
   }
+  absl::string_view str = data_.substr(start, pos_ - start);
 
   if (reading_quoted_string) {
-    SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
+    SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
   }
   AdvancePosition();
 
   // Advance the position to the next token.
-  while (pos_ < string_data_.length() && IsWhiteSpace(string_data_.at(pos_))) {
+  while (pos_ < data_.length() && IsWhiteSpace(data_.at(pos_))) {
     AdvancePosition();
   }
 
@@ -452,19 +458,20 @@ std::string EFGGame::NextToken() {
 
 void EFGGame::AdvancePosition() {
   pos_++;
-  if (string_data_[pos_] == '\n') line_++;
+  // Unlike std::string, the view has no terminating NUL we can safely read.
+  if (pos_ < data_.size() && data_[pos_] == '\n') line_++;
 }
 
 std::string EFGGame::GetLine(int line) const {
   SPIEL_CHECK_GE(line, 1);
 
   int cur_line = 1;
-  int pos = 0;
-  int len = string_data_.size();
+  std::size_t pos = 0;
+  std::size_t len = data_.size();
   std::string buf;
   do {
-    if (cur_line == line) buf.push_back(string_data_[pos]);
-    if (string_data_[pos] == '\n') cur_line++;
+    if (cur_line == line) buf.push_back(data_[pos]);
+    if (data_[pos] == '\n') cur_line++;
     pos++;
   } while (cur_line != line + 1 && pos < len);
 
@@ -508,28 +515,28 @@ t "" 16 "Outcome 16" { 10.000000 0.000000 }
 void EFGGame::ParsePrologue() {
   // Parse the first part of the header "EFG 2 R "
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "EFG");
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "2");
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "R");
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
-  name_ = NextToken();
-  std::string token = NextToken();
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
+  name_ = std::string(NextToken());
+  absl::string_view token = NextToken();
   SPIEL_EFG_PARSE_CHECK_TRUE(token == "{");
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
   token = NextToken();
   while (token != "}") {
-    player_names_.push_back(token);
+    player_names_.push_back(std::string(token));
     token = NextToken();
   }
   num_players_ = player_names_.size();
   infoset_num_to_states_count_.resize(num_players_, {});
-  if (string_data_.at(pos_) == '"') {
-    description_ = NextToken();
+  if (data_.at(pos_) == '"') {
+    description_ = std::string(NextToken());
   }
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
-  SPIEL_EFG_PARSE_CHECK_TRUE(IsNodeToken(string_data_.at(pos_)));
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
+  SPIEL_EFG_PARSE_CHECK_TRUE(IsNodeToken(data_.at(pos_)));
 }
 
 void EFGGame::ParseChanceNode(Node* parent, Node* child, int depth) {
@@ -547,20 +554,20 @@ void EFGGame::ParseChanceNode(Node* parent, Node* child, int depth) {
   max_depth_ = std::max(max_depth_, depth);
   child->type = NodeType::kChance;
   child->parent = parent;
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
   child->name = NextToken();
-  SPIEL_EFG_PARSE_CHECK_FALSE(string_data_.at(pos_) == '"');
+  SPIEL_EFG_PARSE_CHECK_FALSE(data_.at(pos_) == '"');
   SPIEL_EFG_PARSE_CHECK_TRUE(
       absl::SimpleAtoi(NextToken(), &child->infoset_number));
-  if (string_data_.at(pos_) == '"') {
+  if (data_.at(pos_) == '"') {
     child->infoset_name = NextToken();
   }
   // I do not understand how the list of children can be optional.
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "{");
   int chance_outcomes = 0;
   double prob_sum = 0.0;
-  while (string_data_.at(pos_) == '"') {
-    std::string action_str = NextToken();
+  while (data_.at(pos_) == '"') {
+    absl::string_view action_str = NextToken();
     child->actions.push_back(action_str);
     Action action = AddOrGetChanceOutcome(action_str);
     child->action_ids.push_back(action);
@@ -603,17 +610,17 @@ void EFGGame::UpdateAndCheckInfosetMaps(const Node* node) {
             "Inconsistent infoset (player, num) -> name: ",
             static_cast<int>(player), ",", node->infoset_number, " ",
             node->infoset_name, " ", iter1->second, "\nfilename: ", filename_,
-            "\nstring data:\n", string_data_));
+            "\nstring data:\n", data_));
       }
     } else {
       std::pair<Player, int> key = {player, node->infoset_number};
-      infoset_player_num_to_name_[key] = node->infoset_name;
+      infoset_player_num_to_name_[key] = std::string(node->infoset_name);
     }
 
     // Name -> infoset number is not required to be unique in .efg so we don't
     // check it. So these may overlap unless the mapping is unique in the file.
-    infoset_name_to_player_num_[node->infoset_name] = {player,
-                                                       node->infoset_number};
+    infoset_name_to_player_num_[std::string(node->infoset_name)] = {
+        player, node->infoset_number};
   }
 }
 
@@ -632,9 +639,9 @@ void EFGGame::ParsePlayerNode(Node* parent, Node* child, int depth) {
   max_depth_ = std::max(max_depth_, depth);
   child->type = NodeType::kPlayer;
   child->parent = parent;
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
   child->name = NextToken();
-  SPIEL_EFG_PARSE_CHECK_FALSE(string_data_.at(pos_) == '"');
+  SPIEL_EFG_PARSE_CHECK_FALSE(data_.at(pos_) == '"');
   SPIEL_EFG_PARSE_CHECK_TRUE(
       absl::SimpleAtoi(NextToken(), &child->player_number));
   SPIEL_EFG_PARSE_CHECK_TRUE(
@@ -646,15 +653,15 @@ void EFGGame::ParsePlayerNode(Node* parent, Node* child, int depth) {
     perfect_information_ = false;
   }
   child->infoset_name = "";
-  if (string_data_.at(pos_) == '"') {
+  if (data_.at(pos_) == '"') {
     child->infoset_name = NextToken();
   }
   UpdateAndCheckInfosetMaps(child);
   // Do not understand how the list of actions can be optional.
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "{");
   int actions = 0;
-  while (string_data_.at(pos_) == '"') {
-    std::string action_str = NextToken();
+  while (data_.at(pos_) == '"') {
+    absl::string_view action_str = NextToken();
     child->actions.push_back(action_str);
     Action action = AddOrGetAction(action_str);
     child->action_ids.push_back(action);
@@ -687,11 +694,11 @@ void EFGGame::ParseTerminalNode(Node* parent, Node* child, int depth) {
   max_depth_ = std::max(max_depth_, depth);
   child->type = NodeType::kTerminal;
   child->parent = parent;
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
   child->name = NextToken();
   SPIEL_EFG_PARSE_CHECK_TRUE(
       absl::SimpleAtoi(NextToken(), &child->outcome_number));
-  if (string_data_.at(pos_) == '"') {
+  if (data_.at(pos_) == '"') {
     child->outcome_name = NextToken();
   }
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "{");
@@ -699,7 +706,7 @@ void EFGGame::ParseTerminalNode(Node* parent, Node* child, int depth) {
   int idx = 0;
   double util_sum = 0;
   bool identical = true;
-  while (string_data_.at(pos_) != '}') {
+  while (data_.at(pos_) != '}') {
     double utility = 0;
     SPIEL_EFG_PARSE_CHECK_TRUE(ParseDoubleValue(NextPayoffToken(), &utility));
     child->payoffs.push_back(utility);
@@ -744,7 +751,7 @@ void EFGGame::ParseTerminalNode(Node* parent, Node* child, int depth) {
 }
 
 void EFGGame::RecParseSubtree(Node* parent, Node* child, int depth) {
-  switch (string_data_.at(pos_)) {
+  switch (data_.at(pos_)) {
     case 'c':
       ParseChanceNode(parent, child, depth);
       break;
@@ -756,7 +763,7 @@ void EFGGame::RecParseSubtree(Node* parent, Node* child, int depth) {
       break;
     default:
       SpielFatalError(absl::StrCat("Unexpected character at pos ", pos_, ": ",
-                                   string_data_.substr(pos_, 1)));
+                                   data_.substr(pos_, 1)));
   }
 }
 
@@ -794,15 +801,15 @@ std::string EFGGame::GetInformationStateStringByNumber(Player player,
 
 void EFGGame::ParseGame() {
   // Skip any initial whitespace.
-  while (pos_ < string_data_.length() && IsWhiteSpace(string_data_.at(pos_))) {
+  while (pos_ < data_.length() && IsWhiteSpace(data_.at(pos_))) {
     AdvancePosition();
   }
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
 
   ParsePrologue();
   nodes_.push_back(NewNode());
   RecParseSubtree(nullptr, nodes_[0].get(), 0);
-  SPIEL_EFG_PARSE_CHECK_GE(pos_, string_data_.length());
+  SPIEL_EFG_PARSE_CHECK_GE(pos_, data_.length());
 
   // Modify the game type.
   if (num_chance_nodes_ > 0) {
@@ -15,16 +15,19 @@
 #ifndef OPEN_SPIEL_GAMES_EFG_GAME_H_
 #define OPEN_SPIEL_GAMES_EFG_GAME_H_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
 
 // A parser for the .efg format used by Gambit:
 // http://www.gambit-project.org/gambit14/formats.html
@@ -46,18 +49,22 @@ enum class NodeType {
   kTerminal,
 };
 
-// A node object that represent a subtree of the game.
+// A node object that represent a subtree of the game. The string fields are
+// zero-copy views into the data backing the owning EFGGame (the memory-mapped
+// file, or the in-memory string for games loaded via LoadEFGGame), valid for
+// the lifetime of the game. This keeps the per-node memory footprint
+// independent of how often names and action labels repeat across the file.
 struct Node {
   Node* parent;
   NodeType type;
   int id;
-  std::string name;
+  absl::string_view name;
   int infoset_number;  // Must starting at 1 for each player.
   int player_number;   // The EFG player numbers (starting at 1 rather than 0).
-  std::string infoset_name;
-  std::string outcome_name;
+  absl::string_view infoset_name;
+  absl::string_view outcome_name;
   int outcome_number;
-  std::vector<std::string> actions;
+  std::vector<absl::string_view> actions;
   std::vector<Action> action_ids;
   std::vector<Node*> children;
   std::vector<double> probs;
@@ -140,23 +147,23 @@ class EFGGame : public Game {
     return iter->second;
   }
 
-  Action AddOrGetAction(const std::string& label) {
+  Action AddOrGetAction(absl::string_view label) {
     auto iter = action_ids_.find(label);
     if (iter != action_ids_.end()) {
       return iter->second;
     }
     Action new_action = action_ids_.size();
-    action_ids_[label] = new_action;
+    action_ids_.emplace(label, new_action);
     return new_action;
   }
 
-  Action AddOrGetChanceOutcome(const std::string& label) {
+  Action AddOrGetChanceOutcome(absl::string_view label) {
     auto iter = chance_action_ids_.find(label);
     if (iter != chance_action_ids_.end()) {
       return iter->second;
     }
     Action new_action = chance_action_ids_.size();
-    chance_action_ids_[label] = new_action;
+    chance_action_ids_.emplace(label, new_action);
     return new_action;
   }
 
@@ -180,11 +187,11 @@ class EFGGame : public Game {
   std::unique_ptr<Node> NewNode() const;
   void ParseGame();
   void ParsePrologue();
-  std::string NextPayoffToken();
-  std::string NextToken();
+  absl::string_view NextPayoffToken();
+  absl::string_view NextToken();
   void AdvancePosition();
   std::string GetLine(int line) const;
-  bool ParseDoubleValue(const std::string& str, double* value) const;
+  bool ParseDoubleValue(absl::string_view str, double* value) const;
   bool IsWhiteSpace(char c) const;
   bool IsNodeToken(char c) const;
   void UpdateAndCheckInfosetMaps(const Node* node);
@@ -195,8 +202,17 @@ class EFGGame : public Game {
   std::string PrettyTree(const Node* node, const std::string& indent) const;
 
   std::string filename_;
+  // Owns the data when the game is constructed from string data (LoadEFGGame);
+  // empty for games loaded from a file.
   std::string string_data_;
-  int pos_;
+  // Owns the mapping when the game is loaded from a file, so that multi-GB
+  // files are paged in on demand instead of copied into memory up front; null
+  // otherwise.
+  std::unique_ptr<file::MappedFile> mapped_data_;
+  // A view over whichever of the two sources above backs this game. All parser
+  // tokens and Node string fields point into it.
+  absl::string_view data_;
+  std::size_t pos_;
   int line_ = 1;
   std::vector<std::unique_ptr<Node>> nodes_;
   std::string name_;
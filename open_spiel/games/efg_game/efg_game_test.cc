@@ -22,6 +22,7 @@
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/tests/basic_tests.h"
+#include "open_spiel/utils/file.h"
 #include "open_spiel/utils/init.h"
 
 namespace open_spiel {
@@ -94,6 +95,24 @@ void EFGGameSimpleForkFromData() {
   testing::RandomSimTestNoSerialize(*game, 100);
 }
 
+void EFGGameFileAndDataParityTest() {
+  // The filename path parses out of a memory-mapped view of the file; it must
+  // produce the same game as parsing the same data from an in-memory string.
+  std::string filename = file::GetTmpDir() + "/efg_game_parity_test.efg";
+  file::WriteContentsToFile(filename, "w", GetSampleEFGData());
+  std::shared_ptr<const Game> file_game =
+      LoadGame("efg_game", {{"filename", GameParameter(filename)}});
+  std::shared_ptr<const Game> data_game = LoadEFGGame(GetSampleEFGData());
+  SPIEL_CHECK_EQ(file_game->NumPlayers(), data_game->NumPlayers());
+  SPIEL_CHECK_EQ(file_game->NumDistinctActions(),
+                 data_game->NumDistinctActions());
+  SPIEL_CHECK_EQ(file_game->MaxChanceOutcomes(),
+                 data_game->MaxChanceOutcomes());
+  SPIEL_CHECK_EQ(file_game->NewInitialState()->ToString(),
+                 data_game->NewInitialState()->ToString());
+  file::Remove(filename);
+}
+
 void EFGGameCommasFromFile() {
   absl::optional<std::string> file = FindFile(kCommasFilename, 2);
   if (file != absl::nullopt) {
@@ -209,6 +228,7 @@ int main(int argc, char** argv) {
   open_spiel::Init("", &argc, &argv, true);
   open_spiel::efg_game::EFGGameSimTestsSampleFromData();
   open_spiel::efg_game::EFGGameSimTestsKuhnFromData();
+  open_spiel::efg_game::EFGGameFileAndDataParityTest();
   open_spiel::efg_game::EFGGameCommasFromFile();
   open_spiel::efg_game::EFGGameSimTestsSampleFromFile();
   open_spiel::efg_game::EFGGameSimTestsKuhnFromFile();
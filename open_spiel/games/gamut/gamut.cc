@@ -14,6 +14,7 @@
 
 #include "open_spiel/games/gamut/gamut.h"
 
+#include <cstdint>
 #include <memory>
 #include <random>
 #include <string>
@@ -22,6 +23,8 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/games/nfg_game/nfg_game.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/file.h"
 
@@ -33,6 +36,22 @@ constexpr const int kNumTmpfileRetries = 16;
 constexpr const int kNumRandomChars = 32;
 constexpr const char* kAlphaChars =
     "abcdefghijklmnopqrstuvwxyxABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+// First line of every cache entry; the full argument string follows so that
+// (unlikely) hash collisions are detected rather than served.
+constexpr const char* kCacheHeaderPrefix = "# gamut-args: ";
+
+// Stable 64-bit FNV-1a hash, used to content-address cache files. The cache
+// must survive across processes, so absl::Hash (salted per process) is not
+// suitable.
+uint64_t StableHash(absl::string_view str) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : str) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
 }  // namespace
 
 GamutGenerator::GamutGenerator(const std::string& jar_path, int tmpfile_seed)
@@ -50,6 +69,21 @@ std::shared_ptr<const Game> GamutGenerator::GenerateGame(
   return GenerateGame(absl::StrSplit(cmdline_args, ' '));
 }
 
+void GamutGenerator::SetCacheDir(const std::string& cache_dir) {
+  absl::MutexLock lock(&generation_mutex_);
+  if (!file::Exists(cache_dir)) {
+    SPIEL_CHECK_TRUE(file::Mkdirs(cache_dir));
+  }
+  cache_dir_ = cache_dir;
+}
+
+std::string GamutGenerator::CacheFilePath(
+    const std::string& canonical_args) const {
+  return absl::StrCat(cache_dir_, "/gamut_",
+                      absl::Hex(StableHash(canonical_args), absl::kZeroPad16),
+                      ".nfg");
+}
+
 std::string GamutGenerator::TmpFile() {
   for (int retries = 0; retries < kNumTmpfileRetries; ++retries) {
     // Try random files until we find one that does not exist.
@@ -78,6 +112,10 @@ std::shared_ptr<const Game> GamutGenerator::GenerateGame(
     }
   }
 
+  // The cache is keyed by the arguments as given, before -output and -f are
+  // appended below.
+  std::string canonical_args = absl::StrJoin(cmdline_args, " ");
+
   std::vector<std::string> arguments = cmdline_args;
   arguments.push_back("-output");
   arguments.push_back("GambitOutput");
@@ -86,6 +124,21 @@ std::shared_ptr<const Game> GamutGenerator::GenerateGame(
   std::shared_ptr<const Game> game;
   {
     absl::MutexLock lock(&generation_mutex_);
+    std::string cache_filename;
+    std::string cache_header;
+    if (!cache_dir_.empty()) {
+      cache_filename = CacheFilePath(canonical_args);
+      cache_header = absl::StrCat(kCacheHeaderPrefix, canonical_args, "\n");
+      if (file::Exists(cache_filename)) {
+        std::string cached =
+            file::ReadContentsFromFile(cache_filename, "r");
+        // Only serve the entry if the header matches the full argument
+        // string; otherwise fall through and regenerate.
+        if (cached.compare(0, cache_header.size(), cache_header) == 0) {
+          return nfg_game::LoadNFGGame(cached.substr(cache_header.size()));
+        }
+      }
+    }
     // Get a temporary file and add it to the arguments.
     std::string tmp_filename = TmpFile();
     arguments.push_back("-f");
@@ -95,7 +148,14 @@ std::shared_ptr<const Game> GamutGenerator::GenerateGame(
     int ret_code = system(full_cmd.c_str());
     SPIEL_CHECK_EQ(ret_code, 0);
     SPIEL_CHECK_TRUE(file::Exists(tmp_filename));
-    game = LoadGame("nfg_game", {{"filename", GameParameter(tmp_filename)}});
+    if (!cache_dir_.empty()) {
+      std::string contents = file::ReadContentsFromFile(tmp_filename, "r");
+      file::WriteContentsToFile(cache_filename, "w",
+                                absl::StrCat(cache_header, contents));
+      game = nfg_game::LoadNFGGame(contents);
+    } else {
+      game = LoadGame("nfg_game", {{"filename", GameParameter(tmp_filename)}});
+    }
     file::Remove(tmp_filename);
   }
   return game;
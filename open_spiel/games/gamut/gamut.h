@@ -59,11 +59,22 @@ class GamutGenerator {
   std::shared_ptr<const tensor_game::TensorGame> GenerateTensorGame(
       const std::vector<std::string>& cmdline_args);
 
+  // Enables a persistent on-disk cache of generated games under cache_dir
+  // (created if necessary), content-addressed by the full command-line
+  // string. Cache hits bypass the java subprocess entirely, which makes
+  // repeated sweeps over the same parameters much faster. Note that GAMUT's
+  // randomized generators are frozen by the cache: identical arguments
+  // (including any -random_seed) replay the originally generated game.
+  void SetCacheDir(const std::string& cache_dir);
+
  private:
   std::string TmpFile();
+  // Path of the cache entry for the given joined command-line arguments.
+  std::string CacheFilePath(const std::string& canonical_args) const;
 
   std::string java_path_;
   std::string jar_path_;
+  std::string cache_dir_;  // Empty when the cache is disabled.
   absl::Mutex generation_mutex_;
   std::mt19937 rng_;
   std::string rand_string_;  // Random string used for temp file names.
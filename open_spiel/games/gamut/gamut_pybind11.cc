@@ -28,7 +28,8 @@ void init_pyspiel_gamut(::pybind11::module& m) {
       .def("generate_game", py::overload_cast<const std::vector<std::string>&>(
                                 &gamut::GamutGenerator::GenerateGame))
       .def("generate_matrix_game", &gamut::GamutGenerator::GenerateMatrixGame)
-      .def("generate_tensor_game", &gamut::GamutGenerator::GenerateTensorGame);
+      .def("generate_tensor_game", &gamut::GamutGenerator::GenerateTensorGame)
+      .def("set_cache_dir", &gamut::GamutGenerator::SetCacheDir);
 }
 
 }  // namespace open_spiel
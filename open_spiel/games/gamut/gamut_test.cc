@@ -14,9 +14,11 @@
 
 #include "open_spiel/games/gamut/gamut.h"
 
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/matrix_game.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/tensor_game.h"
+#include "open_spiel/utils/file.h"
 #include "open_spiel/utils/init.h"
 
 namespace open_spiel {
@@ -55,6 +57,36 @@ void BasicLoadGamutTest() {
   SPIEL_CHECK_TRUE(game4 != nullptr);
 }
 
+void CachedLoadGamutTest() {
+  GamutGenerator generator("gamut.jar");
+  generator.SetCacheDir(absl::StrCat(file::GetTmpDir(), "/gamut_cache_test"));
+
+  // RandomGame without a seed draws fresh payoffs on every generation, so
+  // getting identical games twice demonstrates the second call was served
+  // from the cache.
+  std::vector<std::string> args = {"-g",         "RandomGame", "-players", "2",
+                                   "-normalize", "-min_payoff", "0",
+                                   "-max_payoff", "150",        "-actions", "3",
+                                   "4"};
+  std::shared_ptr<const matrix_game::MatrixGame> game1 =
+      generator.GenerateMatrixGame(args);
+  SPIEL_CHECK_TRUE(game1 != nullptr);
+  std::shared_ptr<const matrix_game::MatrixGame> game2 =
+      generator.GenerateMatrixGame(args);
+  SPIEL_CHECK_TRUE(game2 != nullptr);
+
+  SPIEL_CHECK_EQ(game1->NumRows(), game2->NumRows());
+  SPIEL_CHECK_EQ(game1->NumCols(), game2->NumCols());
+  for (int row = 0; row < game1->NumRows(); ++row) {
+    for (int col = 0; col < game1->NumCols(); ++col) {
+      for (Player player : {0, 1}) {
+        SPIEL_CHECK_EQ(game1->PlayerUtility(player, row, col),
+                       game2->PlayerUtility(player, row, col));
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace gamut
 }  // namespace open_spiel
@@ -62,4 +94,5 @@ void BasicLoadGamutTest() {
 int main(int argc, char** argv) {
   open_spiel::Init("", &argc, &argv, true);
   open_spiel::gamut::BasicLoadGamutTest();
+  open_spiel::gamut::CachedLoadGamutTest();
 }
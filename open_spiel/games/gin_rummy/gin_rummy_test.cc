@@ -590,6 +590,29 @@ void DeckSizeTests() {
   testing::RandomSimTest(*game, 10);
 }
 
+void DeadwoodCacheTests() {
+  GinRummyUtils utils = GinRummyUtils(kDefaultNumRanks, kDefaultNumSuits,
+                                      kDefaultHandSize);
+  // An 11-card hand where some discards break melds and some don't.
+  std::vector<std::string> cards = {"As", "2s", "3s", "4s", "8s", "8c",
+                                    "8d", "Jc", "Jd", "Kd", "Kh"};
+  std::vector<int> hand = utils.CardStringsToCardInts(cards);
+  // Memoized result matches a repeated evaluation.
+  int deadwood = utils.MinDeadwood(hand);
+  SPIEL_CHECK_EQ(utils.MinDeadwood(hand), deadwood);
+  // The incremental LegalDiscards must agree with recomputing the deadwood
+  // of every one-card-removed hand from scratch.
+  for (int knock_card = 0; knock_card <= 20; ++knock_card) {
+    std::vector<int> legal_discards = utils.LegalDiscards(hand, knock_card);
+    for (int i = 0; i < hand.size(); ++i) {
+      std::vector<int> sub_hand(hand);
+      sub_hand.erase(sub_hand.begin() + i);
+      bool legal = utils.MinDeadwood(sub_hand) <= knock_card;
+      SPIEL_CHECK_EQ(absl::c_linear_search(legal_discards, hand[i]), legal);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace gin_rummy
 }  // namespace open_spiel
@@ -605,5 +628,6 @@ int main(int argc, char** argv) {
   open_spiel::gin_rummy::OklahomaTest();
   open_spiel::gin_rummy::ObserverTest();
   open_spiel::gin_rummy::DeckSizeTests();
+  open_spiel::gin_rummy::DeadwoodCacheTests();
   std::cout << "Gin rummy tests passed!" << std::endl;
 }
@@ -314,6 +314,12 @@ VecVecInt GinRummyUtils::BestMeldGroup(const VecInt &cards) const {
   return best_meld_group;
 }
 
+uint64_t GinRummyUtils::CardSetMask(const VecInt &cards) const {
+  uint64_t mask = 0;
+  for (int card : cards) mask |= uint64_t{1} << card;
+  return mask;
+}
+
 // Minimum deadwood count over all meld groups.
 int GinRummyUtils::MinDeadwood(VecInt hand, absl::optional<int> card) const {
   if (card.has_value()) hand.push_back(card.value());
@@ -322,6 +328,15 @@ int GinRummyUtils::MinDeadwood(VecInt hand, absl::optional<int> card) const {
 
 // Minimum deadwood count over all meld groups.
 int GinRummyUtils::MinDeadwood(const VecInt &hand) const {
+  // The answer depends only on the set of cards (the 11-card discard rule
+  // below depends only on the set's size), so it memoizes cleanly.
+  const bool use_cache = num_cards <= 64;
+  uint64_t mask = 0;
+  if (use_cache) {
+    mask = CardSetMask(hand);
+    auto it = deadwood_cache_.find(mask);
+    if (it != deadwood_cache_.end()) return it->second;
+  }
   VecInt deadwood = hand;
   VecVecInt best_melds = BestMeldGroup(hand);
 
@@ -338,6 +353,7 @@ int GinRummyUtils::MinDeadwood(const VecInt &hand) const {
   }
   int deadwood_total = 0;
   for (int card : deadwood) deadwood_total += CardValue(card);
+  if (use_cache) deadwood_cache_.emplace(mask, deadwood_total);
   return deadwood_total;
 }
 
@@ -393,11 +409,27 @@ VecInt GinRummyUtils::LegalMelds(const VecInt &hand, int knock_card) const {
 // discard a card that preseves the ability to arrange the hand so that the
 // total deadwood is less than the knock card.
 VecInt GinRummyUtils::LegalDiscards(const VecInt &hand, int knock_card) const {
+  // One meld decomposition of the full hand covers most discards. Any meld
+  // group of the smaller hand is also a meld group of the full hand, so
+  // discarding a card no best meld uses leaves the decomposition both intact
+  // and optimal: the new deadwood is the old unmelded total minus the card's
+  // value. Only discards that break a meld need a fresh meld search.
+  VecVecInt best_melds = BestMeldGroup(hand);
+  VecInt melded;
+  for (const auto &meld : best_melds) {
+    melded.insert(melded.end(), meld.begin(), meld.end());
+  }
+  const int unmelded_value = TotalCardValue(hand) - TotalCardValue(best_melds);
   std::set<int> legal_discards;
   for (int i = 0; i < hand.size(); ++i) {
-    VecInt hand_(hand);
-    hand_.erase(hand_.begin() + i);
-    int deadwood = MinDeadwood(hand_);
+    int deadwood;
+    if (!absl::c_linear_search(melded, hand[i])) {
+      deadwood = unmelded_value - CardValue(hand[i]);
+    } else {
+      VecInt hand_(hand);
+      hand_.erase(hand_.begin() + i);
+      deadwood = MinDeadwood(hand_);
+    }
     if (deadwood <= knock_card) {
       legal_discards.insert(hand[i]);
     }
@@ -15,10 +15,12 @@
 #ifndef OPEN_SPIEL_GAMES_GIN_RUMMY_UTILS_H_
 #define OPEN_SPIEL_GAMES_GIN_RUMMY_UTILS_H_
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 
 namespace open_spiel {
@@ -101,6 +103,10 @@ struct GinRummyUtils {
 
   VecVecInt BestMeldGroup(const VecInt &cards) const;
 
+  // Bitmask with bit i set iff card i is in cards. Only meaningful when the
+  // deck fits in 64 bits, which all supported parameterizations do.
+  uint64_t CardSetMask(const VecInt &cards) const;
+
   int MinDeadwood(VecInt hand, absl::optional<int> card) const;
   int MinDeadwood(const VecInt &hand) const;
 
@@ -117,6 +123,15 @@ struct GinRummyUtils {
 
   std::map<VecInt, int> BuildMeldToIntMap() const;
   std::map<int, VecInt> BuildIntToMeldMap() const;
+
+ private:
+  // Memo of MinDeadwood results keyed by card-set bitmask. The deadwood of a
+  // set of cards never changes, and both legal action generation and the
+  // bots evaluate the same sub-hands over and over, so meld search — the
+  // bulk of gin rummy simulation cost — is paid once per distinct hand.
+  // Unused when the deck does not fit in the mask. Mutable because caching
+  // does not change observable behavior.
+  mutable absl::flat_hash_map<uint64_t, int> deadwood_cache_;
 };
 
 }  // namespace gin_rummy
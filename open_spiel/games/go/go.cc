@@ -209,7 +209,7 @@ void GoState::DoApplyAction(Action action) {
       board_.PlayMove(board_.ActionToVirtualAction(action), to_play_));
   to_play_ = OppColor(to_play_);
 
-  bool was_inserted = repetitions_.insert(board_.HashValue()).second;
+  bool was_inserted = repetitions_.Insert(board_.HashValue());
   if (!was_inserted && action != board_.pass_action()) {
     // We have encountered this position before.
     superko_ = true;
@@ -227,11 +227,17 @@ void GoState::ResetBoard() {
     to_play_ = GoColor::kWhite;
   }
 
-  repetitions_.clear();
-  repetitions_.insert(board_.HashValue());
+  repetitions_.Clear();
+  repetitions_.Insert(board_.HashValue());
   superko_ = false;
 }
 
+int64_t GoState::MemoryFootprint() const {
+  // GoBoard lives inline; the superko history is the only heap member.
+  return sizeof(*this) - sizeof(State) + State::MemoryFootprint() +
+         repetitions_.MemoryBytes();
+}
+
 GoGame::GoGame(const GameParameters& params)
     : Game(kGameType, params),
       komi_(ParameterValue<double>("komi")),
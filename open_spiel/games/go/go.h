@@ -20,7 +20,6 @@
 #include <map>
 #include <memory>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
 #include "open_spiel/games/go/go_board.h"
@@ -96,6 +95,8 @@ class GoState : public State {
 
   const GoBoard& board() const { return board_; }
 
+  int64_t MemoryFootprint() const override;
+
  protected:
   void DoApplyAction(Action action) override;
 
@@ -104,17 +105,8 @@ class GoState : public State {
 
   GoBoard board_;
 
-  // RepetitionTable records which positions we have already encountered.
-  // We are already indexing by board hash, so there is no need to hash that
-  // hash again, so we use a custom passthrough hasher.
-  class PassthroughHash {
-   public:
-    std::size_t operator()(uint64_t x) const {
-      return static_cast<std::size_t>(x);
-    }
-  };
-  using RepetitionTable = std::unordered_set<uint64_t, PassthroughHash>;
-  RepetitionTable repetitions_;
+  // Positions we have already encountered, for positional superko.
+  ZobristHistorySet repetitions_;
 
   const float komi_;
   const int handicap_;
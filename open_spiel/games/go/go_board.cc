@@ -14,6 +14,7 @@
 
 #include "open_spiel/games/go/go_board.h"
 
+#include <algorithm>
 #include <iomanip>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
@@ -247,6 +248,54 @@ VirtualPoint MakePoint(std::string s) {
   return VirtualPointFrom2DPoint({row - 1, col});
 }
 
+bool ZobristHistorySet::Insert(uint64_t hash) {
+  if (hash == 0) {
+    if (has_zero_) return false;
+    has_zero_ = true;
+    ++size_;
+    return true;
+  }
+  if (2 * (size_ + 1) > static_cast<int>(slots_.size())) Grow();
+  const uint64_t mask = slots_.size() - 1;
+  uint64_t i = hash & mask;
+  while (slots_[i] != 0) {
+    if (slots_[i] == hash) return false;
+    i = (i + 1) & mask;
+  }
+  slots_[i] = hash;
+  ++size_;
+  return true;
+}
+
+bool ZobristHistorySet::Contains(uint64_t hash) const {
+  if (hash == 0) return has_zero_;
+  const uint64_t mask = slots_.size() - 1;
+  for (uint64_t i = hash & mask; slots_[i] != 0; i = (i + 1) & mask) {
+    if (slots_[i] == hash) return true;
+  }
+  return false;
+}
+
+void ZobristHistorySet::Clear() {
+  // Enough for most games without growing; a 19x19 game approaching the
+  // move limit doubles a few times beyond this.
+  slots_.assign(512, 0);
+  size_ = 0;
+  has_zero_ = false;
+}
+
+void ZobristHistorySet::Grow() {
+  std::vector<uint64_t> old_slots(2 * slots_.size(), 0);
+  old_slots.swap(slots_);
+  const uint64_t mask = slots_.size() - 1;
+  for (uint64_t hash : old_slots) {
+    if (hash == 0) continue;
+    uint64_t i = hash & mask;
+    while (slots_[i] != 0) i = (i + 1) & mask;
+    slots_[i] = hash;
+  }
+}
+
 GoBoard::GoBoard(int board_size)
     : board_size_(board_size), pass_action_(board_size * board_size) {
   if (board_size_ > 19) {
@@ -463,6 +512,121 @@ void GoBoard::InitNewChain(VirtualPoint p) {
   });
 }
 
+// Benson's algorithm: a chain of color c is unconditionally alive if it has
+// at least two "vital" enclosed regions, where a region (a maximal connected
+// set of non-c points) is vital to a chain if every empty point of the region
+// is a liberty of that chain. Chains with fewer than two vital regions, and
+// regions bordering such chains, are removed iteratively until a fixpoint is
+// reached; the surviving chains are pass-alive.
+std::array<bool, kVirtualBoardPoints> GoBoard::UnconditionallyAlivePoints(
+    GoColor c) const {
+  // 1. Partition all non-c points into maximal connected regions.
+  std::array<int, kVirtualBoardPoints> region_id;
+  region_id.fill(-1);
+  std::vector<std::vector<VirtualPoint>> region_points;
+  for (VirtualPoint p : BoardPoints(board_size_)) {
+    if (PointColor(p) == c || region_id[p] >= 0) continue;
+    const int id = region_points.size();
+    region_points.emplace_back();
+    region_id[p] = id;
+    std::vector<VirtualPoint> frontier = {p};
+    while (!frontier.empty()) {
+      VirtualPoint cur = frontier.back();
+      frontier.pop_back();
+      region_points[id].push_back(cur);
+      Neighbours(cur, [this, c, id, &region_id, &frontier](VirtualPoint n) {
+        if (PointColor(n) != c && PointColor(n) != GoColor::kGuard &&
+            region_id[n] < 0) {
+          region_id[n] = id;
+          frontier.push_back(n);
+        }
+      });
+    }
+  }
+
+  // 2. For every region, find the adjacent c-chains (identified by their
+  // heads), and the subset of those chains the region is vital to.
+  const int num_regions = region_points.size();
+  std::vector<std::vector<VirtualPoint>> border_chains(num_regions);
+  std::vector<std::vector<VirtualPoint>> vital_chains(num_regions);
+  const auto contains = [](const std::vector<VirtualPoint>& v,
+                           VirtualPoint p) {
+    return std::find(v.begin(), v.end(), p) != v.end();
+  };
+  for (int id = 0; id < num_regions; ++id) {
+    bool first_empty_point = true;
+    for (VirtualPoint p : region_points[id]) {
+      std::vector<VirtualPoint> adjacent_chains;
+      Neighbours(p, [this, c, &adjacent_chains, &contains](VirtualPoint n) {
+        if (PointColor(n) == c && !contains(adjacent_chains, ChainHead(n))) {
+          adjacent_chains.push_back(ChainHead(n));
+        }
+      });
+      for (VirtualPoint head : adjacent_chains) {
+        if (!contains(border_chains[id], head)) {
+          border_chains[id].push_back(head);
+        }
+      }
+      if (IsEmpty(p)) {
+        // The region stays vital only to chains that this empty point is a
+        // liberty of.
+        if (first_empty_point) {
+          vital_chains[id] = adjacent_chains;
+          first_empty_point = false;
+        } else {
+          std::vector<VirtualPoint> still_vital;
+          for (VirtualPoint head : vital_chains[id]) {
+            if (contains(adjacent_chains, head)) still_vital.push_back(head);
+          }
+          vital_chains[id] = std::move(still_vital);
+        }
+      }
+    }
+  }
+
+  // 3. Iterate to a fixpoint: drop chains with fewer than two vital regions,
+  // then drop regions bordering a dropped chain.
+  std::array<bool, kVirtualBoardPoints> chain_alive;
+  chain_alive.fill(false);
+  for (VirtualPoint p : BoardPoints(board_size_)) {
+    if (PointColor(p) == c) chain_alive[ChainHead(p)] = true;
+  }
+  std::vector<bool> region_alive(num_regions, true);
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    std::array<int, kVirtualBoardPoints> num_vital_regions;
+    num_vital_regions.fill(0);
+    for (int id = 0; id < num_regions; ++id) {
+      if (!region_alive[id]) continue;
+      for (VirtualPoint head : vital_chains[id]) ++num_vital_regions[head];
+    }
+    for (VirtualPoint p : BoardPoints(board_size_)) {
+      if (chain_alive[p] && num_vital_regions[p] < 2) {
+        chain_alive[p] = false;
+        changed = true;
+      }
+    }
+    for (int id = 0; id < num_regions; ++id) {
+      if (!region_alive[id]) continue;
+      for (VirtualPoint head : border_chains[id]) {
+        if (!chain_alive[head]) {
+          region_alive[id] = false;
+          changed = true;
+          break;
+        }
+      }
+    }
+  }
+
+  std::array<bool, kVirtualBoardPoints> alive;
+  alive.fill(false);
+  for (VirtualPoint p : BoardPoints(board_size_)) {
+    if (PointColor(p) == c && chain_alive[ChainHead(p)]) alive[p] = true;
+  }
+  return alive;
+}
+
 bool GoBoard::IsInBoardArea(VirtualPoint p) const {
   auto rc = VirtualPointTo2DPoint(p);
   return rc.first >= 0 && rc.first < board_size() && rc.second >= 0 &&
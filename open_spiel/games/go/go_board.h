@@ -102,6 +102,41 @@ class Neighbours4 {
   const VirtualPoint p_;
 };
 
+// Set of Zobrist position hashes seen during a game, used for positional
+// superko detection. This is a flat open-addressing table rather than
+// std::unordered_set: insert and lookup stay O(1) amortized, but the storage
+// is one contiguous allocation, so copying a state (which search does on
+// every clone) copies the table with a single memcpy instead of rebuilding
+// it node by node.
+class ZobristHistorySet {
+ public:
+  ZobristHistorySet() { Clear(); }
+
+  // Inserts the hash. Returns false if it was already present.
+  bool Insert(uint64_t hash);
+
+  bool Contains(uint64_t hash) const;
+
+  void Clear();
+
+  inline int size() const { return size_; }
+
+  // Heap bytes held by the slot table, for memory accounting.
+  inline int64_t MemoryBytes() const {
+    return slots_.capacity() * sizeof(uint64_t);
+  }
+
+ private:
+  void Grow();
+
+  // Open-addressing slots with linear probing; 0 marks an empty slot. The
+  // hash 0 itself (notably the empty board) is tracked separately in
+  // has_zero_. Capacity is a power of two, grown at 50% load.
+  std::vector<uint64_t> slots_;
+  int size_;
+  bool has_zero_;
+};
+
 // Simple Go board that is optimized for speed.
 // It only implements the minimum of functionality necessary to support the
 // search and is optimized for speed and size. Importantly, it fits on the
@@ -173,6 +208,16 @@ class GoBoard {
   // Number of stones in a chain.
   inline int ChainSize(VirtualPoint p) const { return chain(p).num_stones; }
 
+  // Returns a mask over all virtual points that is true for every stone
+  // belonging to an unconditionally alive ("pass-alive") chain of the given
+  // color, as determined by Benson's algorithm
+  // (https://senseis.xmp.net/?BensonsAlgorithm). Such chains can never be
+  // captured, even if the opponent moves first and this color only ever
+  // passes, which makes the mask useful for terminating playouts early and
+  // scoring decided positions without playing them out.
+  std::array<bool, kVirtualBoardPoints> UnconditionallyAlivePoints(
+      GoColor c) const;
+
   std::string ToString();
 
   class GroupIter {
@@ -14,6 +14,9 @@
 
 #include "open_spiel/games/go/go.h"
 
+#include <random>
+#include <vector>
+
 #include "open_spiel/games/go/go_board.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -49,6 +52,68 @@ void HandicapTest() {
   SPIEL_CHECK_EQ(state.board().PointColor(MakePoint("q16")), GoColor::kBlack);
 }
 
+void UnconditionalLifeTest() {
+  // The group at the bottom has two single-point eyes and is therefore
+  // pass-alive; the ring above it has only one eye and can still be captured.
+  GoBoard board = CreateBoard(
+      "X+X+X\n"
+      "XXXXX\n"
+      "+++++\n"
+      "XXX++\n"
+      "X+X++\n"
+      "XXX++");
+  std::array<bool, kVirtualBoardPoints> alive =
+      board.UnconditionallyAlivePoints(GoColor::kBlack);
+
+  // The two-eyed group is unconditionally alive.
+  SPIEL_CHECK_TRUE(alive[MakePoint("a1")]);
+  SPIEL_CHECK_TRUE(alive[MakePoint("e2")]);
+  // Its eyes are empty points, not stones of the group.
+  SPIEL_CHECK_FALSE(alive[MakePoint("b1")]);
+  // The single-eyed ring is not pass-alive.
+  SPIEL_CHECK_FALSE(alive[MakePoint("a4")]);
+  SPIEL_CHECK_FALSE(alive[MakePoint("b6")]);
+
+  // There are no white stones, so no unconditionally alive white points.
+  std::array<bool, kVirtualBoardPoints> alive_white =
+      board.UnconditionallyAlivePoints(GoColor::kWhite);
+  for (VirtualPoint p : BoardPoints(board.board_size())) {
+    SPIEL_CHECK_FALSE(alive_white[p]);
+  }
+}
+
+void ZobristHistorySetTest() {
+  ZobristHistorySet set;
+  SPIEL_CHECK_EQ(set.size(), 0);
+
+  // The empty board hashes to 0; make sure it is tracked like any other
+  // position.
+  SPIEL_CHECK_FALSE(set.Contains(0));
+  SPIEL_CHECK_TRUE(set.Insert(0));
+  SPIEL_CHECK_FALSE(set.Insert(0));
+  SPIEL_CHECK_TRUE(set.Contains(0));
+  SPIEL_CHECK_EQ(set.size(), 1);
+
+  // Insert enough random hashes to force the table to grow several times.
+  std::mt19937 rng(82669);
+  std::uniform_int_distribution<uint64_t> dist;
+  std::vector<uint64_t> hashes;
+  for (int i = 0; i < 2000; ++i) {
+    uint64_t hash = dist(rng);
+    if (hash != 0 && set.Insert(hash)) hashes.push_back(hash);
+  }
+  SPIEL_CHECK_EQ(set.size(), static_cast<int>(hashes.size()) + 1);
+  for (uint64_t hash : hashes) {
+    SPIEL_CHECK_TRUE(set.Contains(hash));
+    SPIEL_CHECK_FALSE(set.Insert(hash));
+  }
+  SPIEL_CHECK_FALSE(set.Contains(1));
+
+  set.Clear();
+  SPIEL_CHECK_EQ(set.size(), 0);
+  SPIEL_CHECK_FALSE(set.Contains(hashes[0]));
+}
+
 void ConcreteActionsAreUsedInTheAPI() {
   int board_size = 13;
   std::shared_ptr<const Game> game =
@@ -70,5 +135,7 @@ void ConcreteActionsAreUsedInTheAPI() {
 int main(int argc, char** argv) {
   open_spiel::go::BasicGoTests();
   open_spiel::go::HandicapTest();
+  open_spiel::go::UnconditionalLifeTest();
+  open_spiel::go::ZobristHistorySetTest();
   open_spiel::go::ConcreteActionsAreUsedInTheAPI();
 }
@@ -208,7 +208,7 @@ class GoofspielObserver : public Observer {
     Player p = player;
     for (int n = 0; n < game.NumPlayers(); state.NextPlayer(&n, &p)) {
       for (int c = 0; c < game.NumCards(); ++c) {
-        out.at(n, c) = state.player_hands_[p][c];
+        out.at(n, c) = (state.player_hands_[p] >> c) & 1;
       }
     }
   }
@@ -235,10 +235,9 @@ class GoofspielObserver : public Observer {
                                 const GoofspielState& state,
                                 Allocator* allocator) const {
     auto out = allocator->Get("remaining_point_cards", {game.NumCards()});
-    std::set<int> played(state.point_card_sequence_.begin(),
-                         state.point_card_sequence_.end());
-    for (int i = 0; i < state.num_cards_; ++i) {
-      if (played.count(i) == 0) out.at(i) = 1.0;
+    for (uint32_t deck = state.remaining_point_cards_; deck != 0;
+         deck &= deck - 1) {
+      out.at(__builtin_ctz(deck)) = 1.0;
     }
   }
 
@@ -265,7 +264,7 @@ class GoofspielObserver : public Observer {
                        int player, Allocator* allocator) const {
     auto out = allocator->Get("player_hand", {game.NumCards()});
     for (int c = 0; c < game.NumCards(); ++c) {
-      out.at(c) = state.player_hands_[player][c];
+      out.at(c) = (state.player_hands_[player] >> c) & 1;
     }
   }
 
@@ -284,8 +283,9 @@ class GoofspielObserver : public Observer {
                         int player, std::string* result) const {
     // Only my hand
     absl::StrAppend(result, "P", player, " hand: ");
-    for (int c = 0; c < game.NumCards(); ++c) {
-      if (state.player_hands_[player][c]) absl::StrAppend(result, c + 1, " ");
+    for (uint32_t hand = state.player_hands_[player]; hand != 0;
+         hand &= hand - 1) {
+      absl::StrAppend(result, __builtin_ctz(hand) + 1, " ");
     }
     absl::StrAppend(result, "\n");
   }
@@ -312,11 +312,10 @@ class GoofspielObserver : public Observer {
   }
   void StringRemainingPointCards(const GoofspielState& state,
                                  std::string* result) const {
-    std::set<int> played(state.point_card_sequence_.begin(),
-                         state.point_card_sequence_.end());
     absl::StrAppend(result, "Remaining Point Cards: ");
-    for (int i = 0; i < state.num_cards_; ++i) {
-      if (played.count(i) == 0) absl::StrAppend(result, 1 + i);
+    for (uint32_t deck = state.remaining_point_cards_; deck != 0;
+         deck &= deck - 1) {
+      absl::StrAppend(result, 1 + __builtin_ctz(deck));
     }
     absl::StrAppend(result, "\n");
   }
@@ -331,8 +330,9 @@ class GoofspielObserver : public Observer {
     // Show the hands in the perfect info case.
     for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
       absl::StrAppend(result, "P", p, " hand: ");
-      for (int c = 0; c < game.NumCards(); ++c) {
-        if (state.player_hands_[p][c]) absl::StrAppend(result, c + 1, " ");
+      for (uint32_t hand = state.player_hands_[p]; hand != 0;
+           hand &= hand - 1) {
+        absl::StrAppend(result, __builtin_ctz(hand) + 1, " ");
       }
       absl::StrAppend(result, "\n");
     }
@@ -381,17 +381,19 @@ GoofspielState::GoofspielState(std::shared_ptr<const Game> game, int num_cards,
       win_sequence_({}),
       actions_history_({}) {
   SPIEL_CHECK_LE(num_turns_, num_cards_);
+  SPIEL_CHECK_LE(num_cards_, kMaxNumCards);
 
   // Points and point-card deck.
   points_.resize(num_players_);
   std::fill(points_.begin(), points_.end(), 0);
 
+  // Full-deck bitmask: bits 0 .. num_cards_ - 1 set.
+  const uint32_t full_deck =
+      num_cards_ == kMaxNumCards ? ~uint32_t{0} : (uint32_t{1} << num_cards_) - 1;
+  remaining_point_cards_ = full_deck;
+
   // Player hands.
-  player_hands_.clear();
-  for (auto p = Player{0}; p < num_players_; ++p) {
-    std::vector<bool> hand(num_cards_, true);
-    player_hands_.push_back(hand);
-  }
+  player_hands_.assign(num_players_, full_deck);
 
   // Set the points card index.
   if (points_order_ == PointsOrder::kRandom) {
@@ -411,7 +413,9 @@ int GoofspielState::CurrentPlayer() const { return current_player_; }
 void GoofspielState::DealPointCard(int point_card) {
   SPIEL_CHECK_GE(point_card, 0);
   SPIEL_CHECK_LT(point_card, num_cards_);
+  SPIEL_CHECK_NE(remaining_point_cards_ & (uint32_t{1} << point_card), 0u);
   point_card_ = point_card;
+  remaining_point_cards_ &= ~(uint32_t{1} << point_card);
   point_card_sequence_.push_back(point_card);
 }
 
@@ -432,7 +436,7 @@ void GoofspielState::DoApplyActions(const std::vector<Action>& actions) {
     const int action = actions[p];
     SPIEL_CHECK_GE(action, 0);
     SPIEL_CHECK_LT(action, num_cards_);
-    SPIEL_CHECK_TRUE(player_hands_[p][action]);
+    SPIEL_CHECK_NE(player_hands_[p] & (uint32_t{1} << action), 0u);
   }
 
   // Find the highest bid
@@ -464,7 +468,7 @@ void GoofspielState::DoApplyActions(const std::vector<Action>& actions) {
 
   // Remove the cards from the player's hands.
   for (auto p = Player{0}; p < num_players_; ++p) {
-    player_hands_[p][actions[p]] = false;
+    player_hands_[p] &= ~(uint32_t{1} << actions[p]);
   }
 
   // Next player's turn.
@@ -519,16 +523,13 @@ void GoofspielState::DoApplyActions(const std::vector<Action>& actions) {
 
 std::vector<std::pair<Action, double>> GoofspielState::ChanceOutcomes() const {
   SPIEL_CHECK_TRUE(IsChanceNode());
-  std::set<int> played(point_card_sequence_.begin(),
-                       point_card_sequence_.end());
   std::vector<std::pair<Action, double>> outcomes;
-  const int n = num_cards_ - played.size();
+  const int n = __builtin_popcount(remaining_point_cards_);
   const double p = 1.0 / n;
   outcomes.reserve(n);
-  for (int i = 0; i < num_cards_; ++i) {
-    if (played.count(i) == 0) outcomes.emplace_back(i, p);
+  for (uint32_t deck = remaining_point_cards_; deck != 0; deck &= deck - 1) {
+    outcomes.emplace_back(__builtin_ctz(deck), p);
   }
-  SPIEL_CHECK_EQ(outcomes.size(), n);
   return outcomes;
 }
 
@@ -540,10 +541,9 @@ std::vector<Action> GoofspielState::LegalActions(Player player) const {
   SPIEL_CHECK_LT(player, num_players_);
 
   std::vector<Action> movelist;
-  for (int bid = 0; bid < player_hands_[player].size(); ++bid) {
-    if (player_hands_[player][bid]) {
-      movelist.push_back(bid);
-    }
+  movelist.reserve(__builtin_popcount(player_hands_[player]));
+  for (uint32_t hand = player_hands_[player]; hand != 0; hand &= hand - 1) {
+    movelist.push_back(__builtin_ctz(hand));
   }
   return movelist;
 }
@@ -571,11 +571,9 @@ std::string GoofspielState::ToString() const {
     absl::StrAppend(&result, "P");
     absl::StrAppend(&result, p);
     absl::StrAppend(&result, " hand: ");
-    for (int c = 0; c < num_cards_; ++c) {
-      if (player_hands_[p][c]) {
-        absl::StrAppend(&result, c + 1);
-        absl::StrAppend(&result, " ");
-      }
+    for (uint32_t hand = player_hands_[p]; hand != 0; hand &= hand - 1) {
+      absl::StrAppend(&result, __builtin_ctz(hand) + 1);
+      absl::StrAppend(&result, " ");
     }
     absl::StrAppend(&result, "\n");
   }
@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_GAMES_GOOFSPIEL_H_
 #define OPEN_SPIEL_GAMES_GOOFSPIEL_H_
 
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -85,6 +86,10 @@ enum class ReturnsType {
 
 inline constexpr const int kInvalidCard = -1;
 
+// Hands and the point deck are stored as uint32 bitmasks, so the card values
+// can be at most 32.
+inline constexpr int kMaxNumCards = 32;
+
 class GoofspielObserver;
 
 class GoofspielState : public SimMoveState {
@@ -133,7 +138,8 @@ class GoofspielState : public SimMoveState {
   int current_turn_;
   int point_card_;
   std::vector<int> points_;
-  std::vector<std::vector<bool>> player_hands_;  // true if card is in hand.
+  std::vector<uint32_t> player_hands_;   // Bit c is set if card c is in hand.
+  uint32_t remaining_point_cards_;       // Bit c is set if card c is undealt.
   std::vector<int> point_card_sequence_;
   std::vector<Player> win_sequence_;  // Which player won, kInvalidPlayer if tie
   std::vector<std::vector<Action>> actions_history_;
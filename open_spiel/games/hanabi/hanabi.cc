@@ -14,6 +14,9 @@
 
 #include "open_spiel/games/hanabi/hanabi.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -190,6 +193,10 @@ void OpenSpielHanabiState::DoApplyAction(Action action) {
   if (state_.MoveIsLegal(move)) {
     if (!IsChanceNode()) prev_state_score_ = state_.Score();
     state_.ApplyMove(move);
+    // The cached encodings describe the previous state; the buffers keep
+    // their capacity for the re-encode.
+    std::fill(encoded_observation_valid_.begin(),
+              encoded_observation_valid_.end(), false);
   } else {
     SpielFatalError(absl::StrCat("Invalid move ", move.ToString()));
   }
@@ -207,8 +214,12 @@ void OpenSpielHanabiState::ObservationTensor(Player player,
   SPIEL_CHECK_GE(player, 0);
   SPIEL_CHECK_LT(player, num_players_);
 
-  auto obs = game_->Encoder().Encode(
-      hanabi_learning_env::HanabiObservation(state_, player));
+  std::vector<int>& obs = encoded_observations_[player];
+  if (!encoded_observation_valid_[player]) {
+    obs = game_->Encoder().Encode(
+        hanabi_learning_env::HanabiObservation(state_, player));
+    encoded_observation_valid_[player] = true;
+  }
   SPIEL_CHECK_EQ(values.size(), obs.size());
   for (int i = 0; i < obs.size(); ++i) values.at(i) = obs[i];
 }
@@ -239,7 +250,9 @@ OpenSpielHanabiState::OpenSpielHanabiState(std::shared_ptr<const Game> game)
       state_(const_cast<hanabi_learning_env::HanabiGame*>(
              &(static_cast<const OpenSpielHanabiGame&>(*game).HanabiGame()))),
       game_(static_cast<const OpenSpielHanabiGame*>(game.get())),
-      prev_state_score_(0.) {}
+      prev_state_score_(0.),
+      encoded_observations_(num_players_),
+      encoded_observation_valid_(num_players_, false) {}
 
 }  // namespace hanabi
 }  // namespace open_spiel
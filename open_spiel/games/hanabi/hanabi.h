@@ -30,6 +30,7 @@
 // (TLDR: Set the environment variable OPEN_SPIEL_BUILD_WITH_HANABI to ON).
 
 #include <memory>
+#include <vector>
 
 #include "open_spiel/spiel.h"
 #include "hanabi_lib/canonical_encoders.h"
@@ -94,6 +95,14 @@ class OpenSpielHanabiState : public State {
   hanabi_learning_env::HanabiState state_;
   const OpenSpielHanabiGame* game_;
   double prev_state_score_;
+
+  // Per-player cache of the canonical observation encoding. Building the
+  // HanabiObservation and running the HLE encoder is by far the most
+  // expensive operation on this state, and training loops commonly request
+  // the same state's tensor several times, so the encoding is computed at
+  // most once per player per state and invalidated when a move is applied.
+  mutable std::vector<std::vector<int>> encoded_observations_;
+  mutable std::vector<bool> encoded_observation_valid_;
 };
 
 }  // namespace hanabi
@@ -14,6 +14,9 @@
 
 #include "open_spiel/games/hanabi/hanabi.h"
 
+#include <memory>
+#include <vector>
+
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/observer.h"
 #include "open_spiel/spiel_utils.h"
@@ -40,8 +43,35 @@ void BasicHanabiTests() {
   testing::RandomSimTestCustomObserver(*LoadGame("hanabi"), observer);
 }
 
+void CachedObservationTest() {
+  std::shared_ptr<const Game> game = LoadGame("hanabi");
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) state->ApplyAction(state->LegalActions()[0]);
+
+  // Repeated requests on the same state are served from the cache and must
+  // match the first encoding.
+  std::vector<float> first(game->ObservationTensorSize());
+  state->ObservationTensor(0, absl::MakeSpan(first));
+  std::vector<float> repeat(first.size());
+  state->ObservationTensor(0, absl::MakeSpan(repeat));
+  SPIEL_CHECK_TRUE(first == repeat);
+
+  // Applying a move invalidates the cache: the observation (which encodes
+  // the last move) must be re-encoded, not replayed.
+  state->ApplyAction(state->LegalActions()[0]);
+  while (!state->IsTerminal() && state->IsChanceNode()) {
+    state->ApplyAction(state->LegalActions()[0]);
+  }
+  std::vector<float> after(first.size());
+  state->ObservationTensor(0, absl::MakeSpan(after));
+  SPIEL_CHECK_TRUE(first != after);
+}
+
 }  // namespace
 }  // namespace hanabi
 }  // namespace open_spiel
 
-int main(int argc, char **argv) { open_spiel::hanabi::BasicHanabiTests(); }
+int main(int argc, char **argv) {
+  open_spiel::hanabi::BasicHanabiTests();
+  open_spiel::hanabi::CachedObservationTest();
+}
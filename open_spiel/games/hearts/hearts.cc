@@ -665,6 +665,14 @@ std::unique_ptr<State> HeartsState::ResampleFromInfostate(
     }
   }
 
+  // pool of cards whose location player_id does not know; unknown slots are
+  // drawn directly from it instead of rejection sampling the clone's chance
+  // outcomes, which degrades badly once most of the deck is accounted for
+  std::vector<int> unknown_pool;
+  for (int card = 0; card < kNumCards; card++) {
+    if (!KnowsLocation(player_id, card)) unknown_pool.push_back(card);
+  }
+
   // at this point we have all the information we need about which card
   // locations are known to player_id, so we can start applying deal actions
   Player deal_to, pass_to, recv_from;
@@ -697,15 +705,17 @@ std::unique_ptr<State> HeartsState::ResampleFromInfostate(
 
     // all known card constraints for to_deal have been satisfied, so we can
     // deal them a random card that does not violate other player constraints
-    while (action == kInvalidAction) {
-      Action candidate = SampleAction(clone->ChanceOutcomes(), rng()).first;
-      if (!KnowsLocation(player_id, candidate)) {
-        action = candidate;
-        // we can also use this card as a pass action later because its
-        // location is unknown
-        if (pass_actions[deal_to].size() < passed_cards_[deal_to].size()) {
-          pass_actions[deal_to].push_back(action);
-        }
+    if (action == kInvalidAction) {
+      SPIEL_CHECK_FALSE(unknown_pool.empty());
+      int index = static_cast<int>(rng() * unknown_pool.size());
+      index = std::min<int>(index, unknown_pool.size() - 1);
+      action = unknown_pool[index];
+      unknown_pool[index] = unknown_pool.back();
+      unknown_pool.pop_back();
+      // we can also use this card as a pass action later because its
+      // location is unknown
+      if (pass_actions[deal_to].size() < passed_cards_[deal_to].size()) {
+        pass_actions[deal_to].push_back(action);
       }
     }
 
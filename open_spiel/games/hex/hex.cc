@@ -15,6 +15,7 @@
 #include "open_spiel/games/hex/hex.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -54,6 +55,38 @@ REGISTER_SPIEL_GAME(kGameType, Factory);
 
 RegisterSingleTensorObserver single_tensor(kGameType.short_name);
 
+NeighborList GenNeighbors(int num_cols, int num_rows) {
+  NeighborList out(num_cols * num_rows);
+  for (int cell = 0; cell < out.size(); ++cell) {
+    std::vector<int>& neighbours = out[cell];
+    bool north_edge = (cell < num_cols);
+    bool south_edge = (cell >= (num_cols * (num_rows - 1)));
+    bool west_edge = (cell % num_cols == 0);
+    bool east_edge = (cell % num_cols == num_cols - 1);
+    if (!north_edge) { neighbours.push_back(cell - num_cols); }
+    if (!north_edge && !east_edge) { neighbours.push_back(cell - num_cols + 1); }
+    if (!east_edge) { neighbours.push_back(cell + 1); }
+    if (!south_edge) { neighbours.push_back(cell + num_cols); }
+    if (!south_edge && !west_edge) { neighbours.push_back(cell + num_cols - 1); }
+    if (!west_edge) { neighbours.push_back(cell - 1); }
+  }
+  return out;
+}
+
+// Precomputed lists of neighbours, keyed by (num_cols, num_rows). Computing
+// them per state (or worse, per cell visit) allocates in the middle of
+// rollouts; sharing one list per geometry makes the win-detection flood fill
+// allocation free.
+const NeighborList& GetNeighbors(int num_cols, int num_rows) {
+  static std::map<std::pair<int, int>, NeighborList>* cache =
+      new std::map<std::pair<int, int>, NeighborList>();
+  NeighborList& neighbors = (*cache)[{num_cols, num_rows}];
+  if (neighbors.empty()) {
+    neighbors = GenNeighbors(num_cols, num_rows);
+  }
+  return neighbors;
+}
+
 }  // namespace
 
 CellState PlayerToState(Player player) {
@@ -215,23 +248,11 @@ std::string HexState::ActionToString(Player player, Action action_id) const {
                       ")");
 }
 
-std::vector<int> HexState::AdjacentCells(int cell) const {
-  std::vector<int> neighbours = {};
-  bool north_edge = (cell < num_cols_);
-  bool south_edge = (cell >= (board_.size() - num_cols_));
-  bool west_edge = (cell % num_cols_ == 0);
-  bool east_edge = (cell % num_cols_ == num_cols_ - 1);
-  if (!north_edge) { neighbours.push_back(cell - num_cols_); }
-  if (!north_edge && !east_edge) { neighbours.push_back(cell - num_cols_ + 1); }
-  if (!east_edge) { neighbours.push_back(cell + 1); }
-  if (!south_edge) { neighbours.push_back(cell + num_cols_); }
-  if (!south_edge && !west_edge) { neighbours.push_back(cell + num_cols_ - 1); }
-  if (!west_edge) { neighbours.push_back(cell - 1); }
-  return neighbours;
-}
-
 HexState::HexState(std::shared_ptr<const Game> game, int num_cols, int num_rows)
-    : State(game), num_cols_(num_cols), num_rows_(num_rows) {
+    : State(game),
+      num_cols_(num_cols),
+      num_rows_(num_rows),
+      neighbors_(GetNeighbors(num_cols, num_rows)) {
   // for all num_colss & num_rowss -> num_colss_ >= num_rowss_
   board_.resize(num_cols * num_rows, CellState::kEmpty);
 }
@@ -62,6 +62,9 @@ enum class CellState {
   kBlack = 1,  // Black and not edge connected
 };
 
+// List of neighbours of a cell, precomputed per board geometry: [cell][i].
+typedef std::vector<std::vector<int>> NeighborList;
+
 // State of an in-play game.
 class HexState : public State {
  public:
@@ -92,12 +95,16 @@ class HexState : public State {
 
  private:
   CellState PlayerAndActionToState(Player player, Action move) const;
-  Player current_player_ = 0;                      // Player zero goes first
-  double result_black_perspective_ = 0;            // 1 if Black (player 0) wins
-  std::vector<int> AdjacentCells(int cell) const;  // Cells adjacent to cell
+  Player current_player_ = 0;            // Player zero goes first
+  double result_black_perspective_ = 0;  // 1 if Black (player 0) wins
+  // Cells adjacent to cell, shared between all states of a geometry.
+  const std::vector<int>& AdjacentCells(int cell) const {
+    return neighbors_[cell];
+  }
 
   const int num_cols_;  // x
   const int num_rows_;  // y
+  const NeighborList& neighbors_;
 };
 
 // Game object.
@@ -80,6 +80,21 @@ bool ObserverHasTensor(IIGObservationType iig_obs_type) {
 
 bool IsValid(chess::Square square) { return square.x >= 0 && square.y >= 0; }
 
+// Squares whose occupancy a move can change: the source and destination, the
+// square of a pawn captured en passant and, for castling, the whole home rank
+// (the rook's source square depends on pre-move castling rights).
+std::vector<chess::Square> SquaresTouchedByMove(const chess::Move &move,
+                                                int board_size) {
+  std::vector<chess::Square> squares{
+      move.from, move.to, chess::Square{move.to.x, move.from.y}};
+  if (move.is_castling) {
+    for (int8_t x = 0; x < board_size; ++x) {
+      squares.push_back(chess::Square{x, move.from.y});
+    }
+  }
+  return squares;
+}
+
 }  // namespace
 
 class KriegspielObserver : public Observer {
@@ -140,7 +155,7 @@ class KriegspielObserver : public Observer {
       }
 
       // Write last umpire message
-      return state.last_umpire_msg_->ToString();
+      return state.last_umpire_msg_str_;
     } else {
       SpielFatalError(
           "KriegspielObserver: string with imperfect recall is implemented only"
@@ -244,8 +259,9 @@ class KriegspielObserver : public Observer {
                               const std::string &prefix,
                               Allocator *allocator) const {
     chess::Color color = chess::PlayerToColor(player);
+    // The state keeps this table up to date incrementally.
     chess::ObservationTable private_info_table =
-        ComputePrivateInfoTable(state.Board(), color);
+        state.private_info_tables_[chess::ToInt(color)];
 
     // Piece configuration.
     for (const chess::PieceType &piece_type : chess::kPieceTypes) {
@@ -521,6 +537,14 @@ KriegspielState::KriegspielState(std::shared_ptr<const Game> game,
       rule_50_move_(rule_50_move) {
   SPIEL_CHECK_TRUE(&current_board_);
   repetitions_[current_board_.HashValue()] = 1;
+  RecomputePrivateInfoTables();
+}
+
+void KriegspielState::RecomputePrivateInfoTables() {
+  for (int color = 0; color < 2; ++color) {
+    private_info_tables_[color] =
+        ComputePrivateInfoTable(Board(), static_cast<chess::Color>(color));
+  }
 }
 
 void KriegspielState::DoApplyAction(Action action) {
@@ -532,6 +556,7 @@ void KriegspielState::DoApplyAction(Action action) {
 
   move_msg_history_.emplace_back(move, msg);
   last_umpire_msg_ = msg;
+  last_umpire_msg_str_ = msg.ToString();
 
   if (msg.illegal) {
     // If the move is illegal, the player is notified about it and can play
@@ -544,6 +569,15 @@ void KriegspielState::DoApplyAction(Action action) {
   Board().ApplyMove(move);
   illegal_tried_moves_.clear();
   ++repetitions_[current_board_.HashValue()];
+
+  // Only the squares the move touched can have changed visibility.
+  for (const chess::Square &square : SquaresTouchedByMove(move, BoardSize())) {
+    const size_t index = chess::SquareToIndex(square, BoardSize());
+    for (int color = 0; color < 2; ++color) {
+      private_info_tables_[color][index] =
+          Board().IsFriendly(square, static_cast<chess::Color>(color));
+    }
+  }
 }
 
 void KriegspielState::MaybeGenerateLegalActions() const {
@@ -613,6 +647,14 @@ void KriegspielState::UndoAction(Player player, Action action) {
        move_msg_history_) {
     current_board_.ApplyMove(move_msg_pair.first);
   }
+  if (move_msg_history_.empty()) {
+    last_umpire_msg_ = absl::nullopt;
+    last_umpire_msg_str_.clear();
+  } else {
+    last_umpire_msg_ = move_msg_history_.back().second;
+    last_umpire_msg_str_ = last_umpire_msg_->ToString();
+  }
+  RecomputePrivateInfoTables();
 }
 
 bool KriegspielState::IsThreefoldRepetitionDraw() const {
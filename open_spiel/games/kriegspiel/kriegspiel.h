@@ -176,6 +176,10 @@ class KriegspielState : public State {
   // IsTerminal(), which is also called by LegalActions().
   void MaybeGenerateLegalActions() const;
 
+  // Rebuilds private_info_tables_ from the current board. Used when the board
+  // cannot be updated incrementally (construction and undo).
+  void RecomputePrivateInfoTables();
+
   absl::optional<std::vector<double>> MaybeFinalReturns() const;
 
   // We have to store every move made to check for repetitions and to implement
@@ -185,6 +189,9 @@ class KriegspielState : public State {
   // We store this info as an optimisation so that we don't have to compute it
   // from move_msg_history for observations
   absl::optional<KriegspielUmpireMessage> last_umpire_msg_{};
+  // String form of the last umpire message. Built once per move so that
+  // ObservationString doesn't reformat the same message on every call.
+  std::string last_umpire_msg_str_;
   // Moves that the player tried and were illegal. We don't let player try them
   // again on the same board because they are clearly still illegal;
   std::vector<chess::Move> illegal_tried_moves_;
@@ -193,6 +200,12 @@ class KriegspielState : public State {
   chess::ChessBoard start_board_;
   // We store the current board position as an optimization.
   chess::ChessBoard current_board_;
+  // Per-colour table of the squares occupied by that colour's pieces - the
+  // private part of a Kriegspiel observation. Maintained incrementally as
+  // moves are applied (only the squares a move touches are refreshed) so that
+  // observers don't have to rescan the whole board. Indexed by
+  // chess::ToInt(color).
+  std::array<chess::ObservationTable, 2> private_info_tables_;
 
   bool threefold_repetition_;
   bool rule_50_move_;
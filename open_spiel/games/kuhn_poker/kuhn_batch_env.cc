@@ -0,0 +1,112 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/kuhn_poker/kuhn_batch_env.h"
+
+#include <algorithm>
+
+#include "open_spiel/games/kuhn_poker/kuhn_poker.h"
+
+namespace open_spiel {
+namespace kuhn_poker {
+
+KuhnBatchEnv::KuhnBatchEnv(int num_envs, int seed)
+    : num_envs_(num_envs),
+      rng_(seed),
+      cards_(num_envs * 2),
+      ante_(num_envs * 2),
+      cur_player_(num_envs),
+      first_bettor_(num_envs),
+      num_actions_(num_envs),
+      dones_(num_envs),
+      rewards_(num_envs * 2) {
+  SPIEL_CHECK_GT(num_envs, 0);
+  Reset();
+}
+
+void KuhnBatchEnv::Reset() {
+  for (int env = 0; env < num_envs_; ++env) DealEnv(env);
+  std::fill(dones_.begin(), dones_.end(), 0);
+  std::fill(rewards_.begin(), rewards_.end(), 0.0f);
+}
+
+void KuhnBatchEnv::DealEnv(int env) {
+  // Two distinct cards out of three: draw the first uniformly, then the
+  // second from the remaining two.
+  int first = std::uniform_int_distribution<int>(0, 2)(rng_);
+  int second = std::uniform_int_distribution<int>(0, 1)(rng_);
+  if (second >= first) ++second;
+  cards_[env * 2] = first;
+  cards_[env * 2 + 1] = second;
+  ante_[env * 2] = 1;
+  ante_[env * 2 + 1] = 1;
+  cur_player_[env] = 0;
+  first_bettor_[env] = -1;
+  num_actions_[env] = 0;
+}
+
+void KuhnBatchEnv::Step(absl::Span<const int> actions) {
+  SPIEL_CHECK_EQ(actions.size(), num_envs_);
+  std::fill(dones_.begin(), dones_.end(), 0);
+  std::fill(rewards_.begin(), rewards_.end(), 0.0f);
+  for (int env = 0; env < num_envs_; ++env) {
+    const int player = cur_player_[env];
+    const int action = actions[env];
+    SPIEL_DCHECK_TRUE(action == ActionType::kPass ||
+                      action == ActionType::kBet);
+    int8_t* ante = &ante_[env * 2];
+    if (action == ActionType::kBet) {
+      ++ante[player];
+      if (first_bettor_[env] < 0) first_bettor_[env] = player;
+    }
+    ++num_actions_[env];
+    // The game ends after two passes, or one action after the first bet.
+    const bool terminal =
+        (first_bettor_[env] < 0 && num_actions_[env] == 2) ||
+        (first_bettor_[env] >= 0 &&
+         num_actions_[env] == first_bettor_[env] + 2);
+    if (!terminal) {
+      cur_player_[env] = 1 - player;
+      continue;
+    }
+    // Unequal antes mean somebody folded to the bet; otherwise showdown.
+    int winner;
+    if (ante[0] != ante[1]) {
+      winner = ante[0] > ante[1] ? 0 : 1;
+    } else {
+      winner = cards_[env * 2] > cards_[env * 2 + 1] ? 0 : 1;
+    }
+    const int pot = ante[0] + ante[1];
+    rewards_[env * 2 + winner] = pot - ante[winner];
+    rewards_[env * 2 + (1 - winner)] = -ante[1 - winner];
+    dones_[env] = 1;
+    DealEnv(env);
+  }
+}
+
+void KuhnBatchEnv::ObservationTensors(absl::Span<float> values) const {
+  SPIEL_CHECK_EQ(values.size(), num_envs_ * kObservationSize);
+  std::fill(values.begin(), values.end(), 0.0f);
+  for (int env = 0; env < num_envs_; ++env) {
+    float* obs = values.data() + env * kObservationSize;
+    const int player = cur_player_[env];
+    obs[player] = 1.0f;
+    obs[2 + cards_[env * 2 + player]] = 1.0f;
+    obs[5] = ante_[env * 2];
+    obs[6] = ante_[env * 2 + 1];
+  }
+}
+
+}  // namespace kuhn_poker
+}  // namespace open_spiel
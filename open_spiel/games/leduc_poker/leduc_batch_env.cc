@@ -0,0 +1,166 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/leduc_poker/leduc_batch_env.h"
+
+#include <algorithm>
+
+namespace open_spiel {
+namespace leduc_poker {
+namespace {
+
+constexpr int kDeckSize = kDefaultPlayers * kNumSuits + kNumSuits;  // 6.
+
+// Same ranking as LeducState::RankHand for a two-card hand: pairs beat
+// high cards, then compare ranks (card / 2) with suits breaking nothing.
+int RankHand(int card_a, int card_b) {
+  const int lo = std::min(card_a, card_b);
+  const int hi = std::max(card_a, card_b);
+  if (lo % 2 == 0 && hi == lo + 1) {
+    return kDeckSize * kDeckSize + lo;
+  }
+  return (hi / 2) * kDeckSize + (lo / 2);
+}
+
+}  // namespace
+
+LeducBatchEnv::LeducBatchEnv(int num_envs, int seed)
+    : num_envs_(num_envs),
+      rng_(seed),
+      private_cards_(num_envs * 2),
+      board_card_(num_envs),
+      ante_(num_envs * 2),
+      stakes_(num_envs),
+      round_(num_envs),
+      num_raises_(num_envs),
+      num_calls_(num_envs),
+      cur_player_(num_envs),
+      dones_(num_envs),
+      rewards_(num_envs * 2) {
+  SPIEL_CHECK_GT(num_envs, 0);
+  Reset();
+}
+
+void LeducBatchEnv::Reset() {
+  for (int env = 0; env < num_envs_; ++env) DealEnv(env);
+  std::fill(dones_.begin(), dones_.end(), 0);
+  std::fill(rewards_.begin(), rewards_.end(), 0.0f);
+}
+
+void LeducBatchEnv::DealEnv(int env) {
+  // Three distinct cards out of six; the board card is drawn up front but
+  // only revealed in round 2, which gives the same distribution as dealing
+  // it at the round transition.
+  int first = std::uniform_int_distribution<int>(0, 5)(rng_);
+  int second = std::uniform_int_distribution<int>(0, 4)(rng_);
+  if (second >= first) ++second;
+  int board = std::uniform_int_distribution<int>(0, 3)(rng_);
+  if (board >= std::min(first, second)) ++board;
+  if (board >= std::max(first, second)) ++board;
+  private_cards_[env * 2] = first;
+  private_cards_[env * 2 + 1] = second;
+  board_card_[env] = board;
+  ante_[env * 2] = 1;
+  ante_[env * 2 + 1] = 1;
+  stakes_[env] = 1;
+  round_[env] = 1;
+  num_raises_[env] = 0;
+  num_calls_[env] = 0;
+  cur_player_[env] = 0;
+}
+
+void LeducBatchEnv::Showdown(int env) {
+  const int8_t* ante = &ante_[env * 2];
+  const int pot = ante[0] + ante[1];
+  const int rank0 = RankHand(board_card_[env], private_cards_[env * 2]);
+  const int rank1 = RankHand(board_card_[env], private_cards_[env * 2 + 1]);
+  if (rank0 == rank1) {
+    // Split pot; antes are equal at a showdown, so both break even.
+    rewards_[env * 2] = pot / 2.0f - ante[0];
+    rewards_[env * 2 + 1] = pot / 2.0f - ante[1];
+  } else {
+    const int winner = rank0 > rank1 ? 0 : 1;
+    rewards_[env * 2 + winner] = pot - ante[winner];
+    rewards_[env * 2 + (1 - winner)] = -ante[1 - winner];
+  }
+}
+
+void LeducBatchEnv::Step(absl::Span<const int> actions) {
+  SPIEL_CHECK_EQ(actions.size(), num_envs_);
+  std::fill(dones_.begin(), dones_.end(), 0);
+  std::fill(rewards_.begin(), rewards_.end(), 0.0f);
+  for (int env = 0; env < num_envs_; ++env) {
+    const int player = cur_player_[env];
+    const int action = actions[env];
+    int8_t* ante = &ante_[env * 2];
+    bool terminal = false;
+    if (action == ActionType::kFold) {
+      SPIEL_DCHECK_TRUE(CanFold(env));
+      // The caller keeps the pot; the folder forfeits their ante.
+      const int winner = 1 - player;
+      rewards_[env * 2 + winner] = ante[player];
+      rewards_[env * 2 + player] = -ante[player];
+      terminal = true;
+    } else if (action == ActionType::kCall) {
+      ante[player] = stakes_[env];
+      ++num_calls_[env];
+      // The round ends once everyone has matched the stakes: after two
+      // checks, or one call after the last raise.
+      const bool round_over =
+          (num_raises_[env] == 0 && num_calls_[env] == 2) ||
+          (num_raises_[env] > 0 && num_calls_[env] == 1);
+      if (!round_over) {
+        cur_player_[env] = 1 - player;
+      } else if (round_[env] == 1) {
+        round_[env] = 2;
+        num_raises_[env] = 0;
+        num_calls_[env] = 0;
+        cur_player_[env] = 0;
+      } else {
+        Showdown(env);
+        terminal = true;
+      }
+    } else {
+      SPIEL_DCHECK_EQ(action, ActionType::kRaise);
+      SPIEL_DCHECK_TRUE(CanRaise(env));
+      stakes_[env] +=
+          round_[env] == 1 ? kFirstRaiseAmount : kSecondRaiseAmount;
+      ante[player] = stakes_[env];
+      ++num_raises_[env];
+      num_calls_[env] = 0;
+      cur_player_[env] = 1 - player;
+    }
+    if (terminal) {
+      dones_[env] = 1;
+      DealEnv(env);
+    }
+  }
+}
+
+void LeducBatchEnv::ObservationTensors(absl::Span<float> values) const {
+  SPIEL_CHECK_EQ(values.size(), num_envs_ * kObservationSize);
+  std::fill(values.begin(), values.end(), 0.0f);
+  for (int env = 0; env < num_envs_; ++env) {
+    float* obs = values.data() + env * kObservationSize;
+    const int player = cur_player_[env];
+    obs[player] = 1.0f;
+    obs[2 + private_cards_[env * 2 + player]] = 1.0f;
+    if (round_[env] == 2) obs[2 + kDeckSize + board_card_[env]] = 1.0f;
+    obs[2 + 2 * kDeckSize] = ante_[env * 2];
+    obs[2 + 2 * kDeckSize + 1] = ante_[env * 2 + 1];
+  }
+}
+
+}  // namespace leduc_poker
+}  // namespace open_spiel
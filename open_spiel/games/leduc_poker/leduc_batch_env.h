@@ -0,0 +1,116 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_GAMES_LEDUC_POKER_LEDUC_BATCH_ENV_H_
+#define OPEN_SPIEL_GAMES_LEDUC_POKER_LEDUC_BATCH_ENV_H_
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/games/leduc_poker/leduc_poker.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace leduc_poker {
+
+// Hand-written batch environment for two-player Leduc poker, the companion
+// of kuhn_poker::KuhnBatchEnv. The whole state of a hand -- two private
+// cards, the board card, the round, the stakes and the antes -- is a
+// handful of int8s, so stepping packed struct-of-arrays state sidesteps the
+// virtual State machinery that dominates RL training loops. Games that
+// finish during a Step are scored and immediately re-dealt, so every
+// environment is always at a decision node.
+//
+// Actions, rewards and the observation encoding match
+// LoadGame("leduc_poker") exactly; leduc_batch_env_test.cc cross-checks the
+// two in lockstep.
+class LeducBatchEnv {
+ public:
+  static constexpr int kNumPlayers = 2;
+  // Observation layout, matching the game's default observer: observing
+  // player one-hot (2), private card one-hot (6), public card one-hot
+  // (6, all zero before the flop), pot contribution per player (2).
+  static constexpr int kObservationSize = 16;
+
+  LeducBatchEnv(int num_envs, int seed);
+
+  int num_envs() const { return num_envs_; }
+
+  // Re-deals every game. Called by the constructor.
+  void Reset();
+
+  // Applies one action (kFold, kCall or kRaise) per environment, for that
+  // environment's current player. Callers must respect CanFold/CanRaise.
+  void Step(absl::Span<const int> actions);
+
+  // Current player of an environment; always 0 or 1.
+  int current_player(int env) const { return cur_player_[env]; }
+
+  // The private card dealt to a player, in [0, 6); equal to the chance
+  // action that deals it in the generic game.
+  int private_card(int env, int player) const {
+    return private_cards_[env * 2 + player];
+  }
+
+  // The board card, or -1 while the game is still in the first round.
+  int public_card(int env) const {
+    return round_[env] == 2 ? board_card_[env] : -1;
+  }
+
+  // Folding is only legal when facing a raise; raising is capped at two
+  // raises per round. Calling is always legal.
+  bool CanFold(int env) const {
+    return stakes_[env] > ante_[env * 2 + cur_player_[env]];
+  }
+  bool CanRaise(int env) const { return num_raises_[env] < kMaxRaises; }
+
+  // Whether the environment's game ended on the last Step (it has since
+  // been re-dealt), and the returns of that finished game.
+  bool done(int env) const { return dones_[env] != 0; }
+  float reward(int env, int player) const {
+    return rewards_[env * 2 + player];
+  }
+
+  // Writes the current player's observation tensor of every environment
+  // into one contiguous slab of num_envs() * kObservationSize floats.
+  void ObservationTensors(absl::Span<float> values) const;
+
+ private:
+  void DealEnv(int env);
+  void Showdown(int env);
+
+  const int num_envs_;
+  std::mt19937 rng_;
+
+  // Struct-of-arrays game state, one entry (or one per player) per env.
+  std::vector<int8_t> private_cards_;  // num_envs x 2
+  std::vector<int8_t> board_card_;     // Dealt up front, hidden in round 1.
+  std::vector<int8_t> ante_;           // num_envs x 2
+  std::vector<int8_t> stakes_;
+  std::vector<int8_t> round_;          // 1 or 2.
+  std::vector<int8_t> num_raises_;
+  std::vector<int8_t> num_calls_;
+  std::vector<int8_t> cur_player_;
+
+  // Results of the last Step.
+  std::vector<uint8_t> dones_;
+  std::vector<float> rewards_;  // num_envs x 2
+};
+
+}  // namespace leduc_poker
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_LEDUC_POKER_LEDUC_BATCH_ENV_H_
@@ -0,0 +1,102 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/leduc_poker/leduc_batch_env.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace leduc_poker {
+namespace {
+
+// Runs the batch environment in lockstep with mirror states of the generic
+// game, checking that current players, legal actions, observation tensors
+// and terminal rewards all agree.
+void TestBatchEnvMatchesLeducGame() {
+  constexpr int kNumEnvs = 16;
+  constexpr int kNumSteps = 4000;
+  std::shared_ptr<const Game> game = LoadGame("leduc_poker");
+  LeducBatchEnv batch_env(kNumEnvs, /*seed=*/4177);
+  std::mt19937 rng(23);
+
+  // The chance action dealing a card equals the card itself.
+  auto make_mirror = [&](int env) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    state->ApplyAction(batch_env.private_card(env, 0));
+    state->ApplyAction(batch_env.private_card(env, 1));
+    return state;
+  };
+  std::vector<std::unique_ptr<State>> mirrors;
+  mirrors.reserve(kNumEnvs);
+  for (int env = 0; env < kNumEnvs; ++env) {
+    mirrors.push_back(make_mirror(env));
+  }
+
+  std::vector<float> slab(kNumEnvs * LeducBatchEnv::kObservationSize);
+  std::vector<float> obs(LeducBatchEnv::kObservationSize);
+  std::vector<int> actions(kNumEnvs);
+
+  for (int step = 0; step < kNumSteps; ++step) {
+    batch_env.ObservationTensors(absl::MakeSpan(slab));
+    for (int env = 0; env < kNumEnvs; ++env) {
+      const int player = batch_env.current_player(env);
+      SPIEL_CHECK_EQ(mirrors[env]->CurrentPlayer(), player);
+      std::vector<Action> legal_actions = mirrors[env]->LegalActions();
+      SPIEL_CHECK_EQ(absl::c_linear_search(legal_actions, ActionType::kFold),
+                     batch_env.CanFold(env));
+      SPIEL_CHECK_EQ(absl::c_linear_search(legal_actions, ActionType::kRaise),
+                     batch_env.CanRaise(env));
+      mirrors[env]->ObservationTensor(player, absl::MakeSpan(obs));
+      for (int i = 0; i < LeducBatchEnv::kObservationSize; ++i) {
+        SPIEL_CHECK_EQ(obs[i],
+                       slab[env * LeducBatchEnv::kObservationSize + i]);
+      }
+      actions[env] = legal_actions[std::uniform_int_distribution<int>(
+          0, legal_actions.size() - 1)(rng)];
+    }
+    batch_env.Step(actions);
+    for (int env = 0; env < kNumEnvs; ++env) {
+      mirrors[env]->ApplyAction(actions[env]);
+      if (mirrors[env]->IsChanceNode()) {
+        // Round transition: deal the board card the environment drew.
+        SPIEL_CHECK_GE(batch_env.public_card(env), 0);
+        mirrors[env]->ApplyAction(batch_env.public_card(env));
+      }
+      if (mirrors[env]->IsTerminal()) {
+        SPIEL_CHECK_TRUE(batch_env.done(env));
+        std::vector<double> returns = mirrors[env]->Returns();
+        SPIEL_CHECK_EQ(returns[0], batch_env.reward(env, 0));
+        SPIEL_CHECK_EQ(returns[1], batch_env.reward(env, 1));
+        // The environment re-dealt itself; follow it with a fresh mirror.
+        mirrors[env] = make_mirror(env);
+      } else {
+        SPIEL_CHECK_FALSE(batch_env.done(env));
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace leduc_poker
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::leduc_poker::TestBatchEnvMatchesLeducGame();
+}
@@ -246,19 +246,10 @@ std::vector<Action> LiarsDiceState::LegalActions() const {
     return LegalChanceOutcomes();
   }
 
-  std::vector<Action> actions;
-
-  // Any move higher than the current bid is allowed. (Bids start at 0)
-  for (int b = current_bid_ + 1; b < total_num_dice_ * dice_sides(); b++) {
-    actions.push_back(b);
-  }
-
-  // Calling Liar is only available if at least one move has been made.
-  if (total_moves_ > 0) {
-    actions.push_back(total_num_dice_ * dice_sides());
-  }
-
-  return actions;
+  // Any move higher than the current bid is allowed, plus calling Liar once
+  // at least one bid has been made; these sets only depend on the current
+  // bid, so they are precomputed by the game.
+  return UnwrapGame(game_.get())->legal_bids(current_bid_);
 }
 
 std::vector<std::pair<Action, double>> LiarsDiceState::ChanceOutcomes() const {
@@ -423,71 +414,10 @@ std::unique_ptr<State> LiarsDiceState::Clone() const {
 }
 
 std::pair<int, int> LiarsDiceState::UnrankBid(int bidnum) const {
-  std::pair<int, int> bid;
   SPIEL_CHECK_NE(bidnum, kInvalidBid);
   SPIEL_CHECK_GE(bidnum, 0);
   SPIEL_CHECK_LT(bidnum, dice_sides() * total_num_dice_);
-
-  if (bidding_rule() == BiddingRule::kResetFace) {
-    // Bids have the form <quantity>-<face>
-    //
-    // So, in a two-player game where each die has 6 faces, we have
-    //
-    // Bid ID    Quantity   Face
-    // 0         1          1
-    // 1         1          2
-    // ...
-    // 5         1          6
-    // 6         2          1
-    // ...
-    // 11        2          6
-    //
-    // Bid ID #dice * #num faces encodes the special "liar" action.
-
-    // The quantity occupies the higher bits, so it can be extracted using an
-    // integer division operation.
-    bid.first = bidnum / dice_sides() + 1;
-    // The face occupies the lower bits, so it can be extraced using a modulo
-    // operation.
-    bid.second = 1 + (bidnum % dice_sides());
-  } else {
-    SPIEL_CHECK_EQ(bidding_rule(), BiddingRule::kResetQuantity);
-    // Bids have the form <face>-<quantity>
-    //
-    // So, in a two-player game where each die has 6 faces, we have
-    //
-    // Bid ID    Quantity   Face
-    // 0         1          1
-    // 1         2          1
-    // 2         1          2
-    // 3         2          2
-    // ...
-    // 9         2          5
-    // 10        1          6
-    // 11        2          6
-    //
-    // Bid ID #dice * #num faces encodes the special "liar" action.
-    //
-    // This particular encoding scheme allows for very cheap comparison of bids:
-    // a bid is stronger if it is encoded to a higher ID.
-
-    // The quantity occupies the lower bits, so it can be extracted using a
-    // modulo operation.
-    bid.first = 1 + (bidnum % total_num_dice_);
-    // The face occupies the higher bits, so it can be extracted using an
-    // integer division.
-    bid.second = bidnum / total_num_dice_ + 1;
-  }
-
-  SPIEL_CHECK_GE(bid.first, 1);
-  // It doesn't make sense to bid more dice than the number of dice in the game.
-  SPIEL_CHECK_LE(bid.first, total_num_dice_);
-
-  SPIEL_CHECK_GE(bid.second, 1);
-  // It doesn't make sense to bid a face that does not exist.
-  SPIEL_CHECK_LE(bid.second, dice_sides());
-
-  return bid;
+  return UnwrapGame(game_.get())->bid_quantity_face(bidnum);
 }
 
 LiarsDiceGame::LiarsDiceGame(const GameParameters& params, GameType game_type)
@@ -526,6 +456,113 @@ LiarsDiceGame::LiarsDiceGame(const GameParameters& params, GameType game_type)
       max_dice_per_player_ = nd;
     }
   }
+
+  BuildTables();
+}
+
+void LiarsDiceGame::BuildTables() {
+  const int liar_action = total_num_dice_ * dice_sides_;
+
+  // Bid unranking table.
+  bid_quantity_face_.reserve(liar_action);
+  for (int bidnum = 0; bidnum < liar_action; ++bidnum) {
+    std::pair<int, int> bid;
+    if (bidding_rule_ == BiddingRule::kResetFace) {
+      // Bids have the form <quantity>-<face>
+      //
+      // So, in a two-player game where each die has 6 faces, we have
+      //
+      // Bid ID    Quantity   Face
+      // 0         1          1
+      // 1         1          2
+      // ...
+      // 5         1          6
+      // 6         2          1
+      // ...
+      // 11        2          6
+      //
+      // Bid ID #dice * #num faces encodes the special "liar" action.
+
+      // The quantity occupies the higher bits, so it can be extracted using
+      // an integer division operation.
+      bid.first = bidnum / dice_sides_ + 1;
+      // The face occupies the lower bits, so it can be extraced using a
+      // modulo operation.
+      bid.second = 1 + (bidnum % dice_sides_);
+    } else {
+      SPIEL_CHECK_EQ(bidding_rule_, BiddingRule::kResetQuantity);
+      // Bids have the form <face>-<quantity>
+      //
+      // So, in a two-player game where each die has 6 faces, we have
+      //
+      // Bid ID    Quantity   Face
+      // 0         1          1
+      // 1         2          1
+      // 2         1          2
+      // 3         2          2
+      // ...
+      // 9         2          5
+      // 10        1          6
+      // 11        2          6
+      //
+      // Bid ID #dice * #num faces encodes the special "liar" action.
+      //
+      // This particular encoding scheme allows for very cheap comparison of
+      // bids: a bid is stronger if it is encoded to a higher ID.
+
+      // The quantity occupies the lower bits, so it can be extracted using a
+      // modulo operation.
+      bid.first = 1 + (bidnum % total_num_dice_);
+      // The face occupies the higher bits, so it can be extracted using an
+      // integer division.
+      bid.second = bidnum / total_num_dice_ + 1;
+    }
+
+    SPIEL_CHECK_GE(bid.first, 1);
+    // It doesn't make sense to bid more dice than the number of dice in the
+    // game.
+    SPIEL_CHECK_LE(bid.first, total_num_dice_);
+
+    SPIEL_CHECK_GE(bid.second, 1);
+    // It doesn't make sense to bid a face that does not exist.
+    SPIEL_CHECK_LE(bid.second, dice_sides_);
+
+    bid_quantity_face_.push_back(bid);
+  }
+
+  // Legal bids per current bid: any move higher than the current bid, plus
+  // calling Liar once at least one bid has been made. Entry 0 is the empty
+  // bid (kInvalidBid).
+  legal_bids_table_.resize(liar_action + 1);
+  for (int current_bid = kInvalidBid; current_bid < liar_action;
+       ++current_bid) {
+    std::vector<Action>& actions = legal_bids_table_[current_bid + 1];
+    actions.reserve(liar_action - current_bid);
+    for (int b = current_bid + 1; b < liar_action; ++b) {
+      actions.push_back(b);
+    }
+    if (current_bid != kInvalidBid) {
+      actions.push_back(liar_action);
+    }
+  }
+
+  // Per-face distributions over the number of matches among all dice in the
+  // game, built by repeated convolution with a single die. The highest face
+  // is wild, so it matches every face (and only itself).
+  match_count_distributions_.resize(dice_sides_);
+  for (int face = 1; face <= dice_sides_; ++face) {
+    const double p_match =
+        (face == dice_sides_ ? 1.0 : 2.0) / dice_sides_;
+    std::vector<double>& dist = match_count_distributions_[face - 1];
+    dist.assign(total_num_dice_ + 1, 0.0);
+    dist[0] = 1.0;
+    for (int die = 0; die < total_num_dice_; ++die) {
+      for (int k = die + 1; k >= 1; --k) {
+        dist[k] = dist[k] * (1.0 - p_match) + dist[k - 1] * p_match;
+      }
+      dist[0] *= 1.0 - p_match;
+    }
+  }
 }
 
 int LiarsDiceGame::NumDistinctActions() const {
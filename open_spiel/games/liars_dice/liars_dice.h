@@ -18,6 +18,7 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/spiel.h"
@@ -158,6 +159,29 @@ class LiarsDiceGame : public Game {
   const int dice_sides() const { return dice_sides_; }
   const BiddingRule bidding_rule() const { return bidding_rule_; }
 
+  // Precomputed tables, shared between the state implementation and external
+  // solvers (e.g. examples/fsicfr_liars_dice.cc) so that node expansion is
+  // table-lookup cheap.
+
+  // Quantity and face of a bid id, under this game's bidding rule. Bid ids
+  // run from 0 to total_num_dice * dice_sides - 1 (inclusive).
+  const std::pair<int, int>& bid_quantity_face(int bid) const {
+    return bid_quantity_face_[bid];
+  }
+
+  // The legal bids (including calling liar when available) given the current
+  // highest bid, where kInvalidBid (-1) means no bid has been made yet.
+  const std::vector<Action>& legal_bids(int current_bid) const {
+    return legal_bids_table_[current_bid + 1];
+  }
+
+  // Distribution over the number of dice among all total_num_dice() dice
+  // that match the given face (1-based), counting the wild highest face.
+  // Entry k is the probability of exactly k matches.
+  const std::vector<double>& match_count_distribution(int face) const {
+    return match_count_distributions_[face - 1];
+  }
+
  private:
   // Number of players.
   int num_players_;
@@ -165,10 +189,19 @@ class LiarsDiceGame : public Game {
   // Total dice in the game, determines the legal bids.
   int total_num_dice_;
 
+  // Fills the precomputed tables above. Called at the end of the
+  // constructor, once the dice counts are known.
+  void BuildTables();
+
   std::vector<int> num_dice_;  // How many dice each player has.
   int max_dice_per_player_;    // Maximum value in num_dice_ vector.
   const int dice_sides_;       // Number of faces on each die.
   const BiddingRule bidding_rule_;
+
+  // Precomputed tables; see the accessors above.
+  std::vector<std::pair<int, int>> bid_quantity_face_;
+  std::vector<std::vector<Action>> legal_bids_table_;
+  std::vector<std::vector<double>> match_count_distributions_;
 };
 
 // Implements the action abstraction from Lanctot et al. '12
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "open_spiel/games/liars_dice/liars_dice.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/tests/basic_tests.h"
 
@@ -27,6 +28,35 @@ void BasicLiarsDiceTests() {
   testing::RandomSimTest(*LoadGame("liars_dice"), 50);
 }
 
+void PrecomputedTablesTest() {
+  std::shared_ptr<const Game> game = LoadGame("liars_dice");
+  const auto* ld_game = down_cast<const LiarsDiceGame*>(game.get());
+
+  // 2 players x 1 die, 6 sides: bid 7 is quantity 2, face 2 under the
+  // default reset-face rule.
+  SPIEL_CHECK_EQ(ld_game->bid_quantity_face(7).first, 2);
+  SPIEL_CHECK_EQ(ld_game->bid_quantity_face(7).second, 2);
+
+  // From the empty bid all 12 bids but not Liar; from the highest bid only
+  // Liar remains.
+  SPIEL_CHECK_EQ(ld_game->legal_bids(-1).size(), 12);
+  SPIEL_CHECK_EQ(ld_game->legal_bids(11).size(), 1);
+  SPIEL_CHECK_EQ(ld_game->legal_bids(11)[0], 12);
+
+  // Matches of a non-wild face among 2 dice: each die matches with
+  // probability 2/6 (the face itself or the wild 6).
+  const std::vector<double>& dist = ld_game->match_count_distribution(1);
+  SPIEL_CHECK_EQ(dist.size(), 3);
+  SPIEL_CHECK_FLOAT_EQ(dist[0], 4.0 / 9.0);
+  SPIEL_CHECK_FLOAT_EQ(dist[1], 4.0 / 9.0);
+  SPIEL_CHECK_FLOAT_EQ(dist[2], 1.0 / 9.0);
+
+  // The wild face only matches itself.
+  const std::vector<double>& wild_dist =
+      ld_game->match_count_distribution(6);
+  SPIEL_CHECK_FLOAT_EQ(wild_dist[2], 1.0 / 36.0);
+}
+
 void ImperfectRecallLiarsDiceTests() {
   testing::LoadGameTest("liars_dice_ir");
   testing::ChanceOutcomesTest(*LoadGame("liars_dice_ir"));
@@ -39,5 +69,6 @@ void ImperfectRecallLiarsDiceTests() {
 
 int main(int argc, char** argv) {
   open_spiel::liars_dice::BasicLiarsDiceTests();
+  open_spiel::liars_dice::PrecomputedTablesTest();
   open_spiel::liars_dice::ImperfectRecallLiarsDiceTests();
 }
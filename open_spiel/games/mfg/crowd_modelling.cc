@@ -112,11 +112,8 @@ std::vector<Action> CrowdModellingState::LegalActions() const {
 
 ActionsAndProbs CrowdModellingState::ChanceOutcomes() const {
   if (is_chance_init_) {
-    ActionsAndProbs outcomes;
-    for (int i = 0; i < size_; ++i) {
-      outcomes.push_back({i, 1. / size_});
-    }
-    return outcomes;
+    return down_cast<const CrowdModellingGame&>(*game_)
+        .InitialChanceOutcomes();
   }
   return {{0, 1. / 3}, {1, 1. / 3}, {2, 1. / 3}};
 }
@@ -152,19 +149,15 @@ std::string CrowdModellingState::ActionToString(Player player,
 }
 
 std::vector<std::string> CrowdModellingState::DistributionSupport() {
-  std::vector<std::string> support;
-  support.reserve(size_);
-  for (int x = 0; x < size_; ++x) {
-    support.push_back(StateToString(x, t_, kMeanFieldPlayerId, false));
-  }
-  return support;
+  return down_cast<const CrowdModellingGame&>(*game_).SupportStrings(t_);
 }
 
 void CrowdModellingState::UpdateDistribution(
     const std::vector<double>& distribution) {
   SPIEL_CHECK_EQ(current_player_, kMeanFieldPlayerId);
   SPIEL_CHECK_EQ(distribution.size(), size_);
-  distribution_ = distribution;
+  // Reuses the existing dense storage instead of reallocating.
+  distribution_.assign(distribution.begin(), distribution.end());
   current_player_ = kDefaultPlayerId;
 }
 
@@ -233,7 +226,22 @@ std::string CrowdModellingState::Serialize() const {
 CrowdModellingGame::CrowdModellingGame(const GameParameters& params)
     : Game(kGameType, params),
       size_(ParameterValue<int>("size", kDefaultSize)),
-      horizon_(ParameterValue<int>("horizon", kDefaultHorizon)) {}
+      horizon_(ParameterValue<int>("horizon", kDefaultHorizon)) {
+  // The support and the initial chance outcomes are fixed given the game
+  // parameters, so they are built once here and shared by all states.
+  support_strings_.resize(horizon_ + 1);
+  for (int t = 0; t <= horizon_; ++t) {
+    support_strings_[t].reserve(size_);
+    for (int x = 0; x < size_; ++x) {
+      support_strings_[t].push_back(
+          StateToString(x, t, kMeanFieldPlayerId, false));
+    }
+  }
+  initial_chance_outcomes_.reserve(size_);
+  for (int i = 0; i < size_; ++i) {
+    initial_chance_outcomes_.push_back({i, 1. / size_});
+  }
+}
 
 std::vector<int> CrowdModellingGame::ObservationTensorShape() const {
   // +1 to allow for t_ == horizon.
@@ -141,9 +141,25 @@ class CrowdModellingGame : public Game {
   std::unique_ptr<State> DeserializeState(
       const std::string& str) const override;
 
+  // Support of the mean-field distribution at time t: every position on the
+  // circle. Cached here because distribution updates query it for every
+  // state of a sweep.
+  const std::vector<std::string>& SupportStrings(int t) const {
+    return support_strings_[t];
+  }
+
+  // Outcomes of the initial chance node: uniform over positions.
+  const ActionsAndProbs& InitialChanceOutcomes() const {
+    return initial_chance_outcomes_;
+  }
+
  private:
   const int size_;
   const int horizon_;
+
+  // Precomputed tables, indexed by time and position respectively.
+  std::vector<std::vector<std::string>> support_strings_;
+  ActionsAndProbs initial_chance_outcomes_;
 };
 
 }  // namespace crowd_modelling
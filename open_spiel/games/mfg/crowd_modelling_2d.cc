@@ -399,21 +399,15 @@ std::string CrowdModelling2dState::ActionToString(Player player,
 }
 
 std::vector<std::string> CrowdModelling2dState::DistributionSupport() {
-  std::vector<std::string> support;
-  support.reserve(size_ * size_);
-  for (int x = 0; x < size_; ++x) {
-    for (int y = 0; y < size_; ++y) {
-      support.push_back(StateToString(x, y, t_, kMeanFieldPlayerId, false));
-    }
-  }
-  return support;
+  return down_cast<const CrowdModelling2dGame&>(*game_).SupportStrings(t_);
 }
 
 void CrowdModelling2dState::UpdateDistribution(
     const std::vector<double>& distribution) {
   SPIEL_CHECK_EQ(current_player_, kMeanFieldPlayerId);
   SPIEL_CHECK_EQ(distribution.size(), size_ * size_);
-  distribution_ = distribution;
+  // Reuses the existing dense storage instead of reallocating.
+  distribution_.assign(distribution.begin(), distribution.end());
   current_player_ = kDefaultPlayerId;
 }
 
@@ -524,7 +518,20 @@ CrowdModelling2dGame::CrowdModelling2dGame(const GameParameters& params)
       noise_intensity_(
           ParameterValue<double>("noise_intensity", kDefaultNoiseIntensity)),
       crowd_aversion_coef_(ParameterValue<double>("crowd_aversion_coef",
-                                                  kDefaultCrowdAversionCoef)) {}
+                                                  kDefaultCrowdAversionCoef)) {
+  // The support is fixed given the game parameters, so it is built once here
+  // and shared by all states.
+  support_strings_.resize(horizon_ + 1);
+  for (int t = 0; t <= horizon_; ++t) {
+    support_strings_[t].reserve(size_ * size_);
+    for (int x = 0; x < size_; ++x) {
+      for (int y = 0; y < size_; ++y) {
+        support_strings_[t].push_back(
+            StateToString(x, y, t, kMeanFieldPlayerId, false));
+      }
+    }
+  }
+}
 
 std::vector<int> CrowdModelling2dGame::ObservationTensorShape() const {
   // +1 to allow for t_ == horizon.
@@ -201,9 +201,17 @@ class CrowdModelling2dGame : public Game {
   std::unique_ptr<State> DeserializeState(
       const std::string& str) const override;
 
+  // Support of the mean-field distribution at time t: the whole grid.
+  // Cached here because distribution updates query it for every state of a
+  // sweep.
+  const std::vector<std::string>& SupportStrings(int t) const {
+    return support_strings_[t];
+  }
+
  private:
   const int size_;
   const int horizon_;
+  std::vector<std::vector<std::string>> support_strings_;
   const bool only_distribution_reward_;
   std::string forbidden_states_;            // Default "", example "[0|0;0|1]"
   std::string initial_distribution_;        // Default "", example  "[0|2;0|3]"
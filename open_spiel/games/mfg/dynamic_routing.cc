@@ -207,7 +207,12 @@ MeanFieldRoutingGameState::MeanFieldRoutingGameState(
       od_demand_(od_demand),
       network_(network),
       total_num_vehicle_(total_num_vehicle),
-      chance_outcomes_(chance_outcomes) {}
+      chance_outcomes_(chance_outcomes) {
+  // Recompute the id mirrors from the strings so that deserialized states get
+  // them as well (empty strings map to kNoPossibleAction).
+  vehicle_location_id_ = network_->GetRoadSectionAsInt(vehicle_location_);
+  vehicle_destination_id_ = network_->GetRoadSectionAsInt(vehicle_destination_);
+}
 
 std::string MeanFieldRoutingGameState::StateToString(
     std::string location, int time_step, int player_id, int waiting_time,
@@ -255,20 +260,14 @@ std::vector<Action> MeanFieldRoutingGameState::LegalActions() const {
   if (vehicle_without_legal_action_) {
     return {kNoPossibleAction};
   }
-  std::string end_section_node = NodesFromRoadSection(vehicle_location_)[1];
-  std::vector<std::string> successors =
-      network_->GetSuccessors(end_section_node);
+  const std::vector<int>& successor_actions =
+      network_->GetSuccessorActions(vehicle_location_id_);
   if (perform_sanity_checks_) {
-    SPIEL_CHECK_TRUE(!successors.empty());
-  }
-  std::vector<Action> actions;
-  for (const auto& d : successors) {
-    Action action = network_->GetActionIdFromMovement(end_section_node, d);
-    network_->AssertValidAction(action);
-    actions.push_back(action);
+    SPIEL_CHECK_TRUE(!successor_actions.empty());
   }
-  std::sort(actions.begin(), actions.end());
-  return actions;
+  // Successor actions are already sorted in increasing order.
+  return std::vector<Action>(successor_actions.begin(),
+                             successor_actions.end());
 }
 
 void MeanFieldRoutingGameState::DoApplyAction(Action action) {
@@ -283,6 +282,9 @@ void MeanFieldRoutingGameState::DoApplyAction(Action action) {
       auto od_demand = od_demand_->at(action);
       vehicle_destination_ = od_demand.vehicle.destination;
       vehicle_location_ = od_demand.vehicle.origin;
+      vehicle_destination_id_ =
+          network_->GetRoadSectionAsInt(vehicle_destination_);
+      vehicle_location_id_ = network_->GetRoadSectionAsInt(vehicle_location_);
       waiting_time_ = static_cast<int>(od_demand.vehicle.departure_time /
                                        time_step_length_);
       is_chance_init_ = false;
@@ -298,11 +300,12 @@ void MeanFieldRoutingGameState::DoApplyAction(Action action) {
             network_->AssertValidAction(action, vehicle_location_);
           }
           vehicle_location_ = network_->GetRoadSectionFromActionId(action);
-          if (vehicle_location_ == vehicle_destination_) {
+          vehicle_location_id_ = action;
+          if (vehicle_location_id_ == vehicle_destination_id_) {
             vehicle_final_travel_time_ = current_time_step_;
             vehicle_at_destination_ = true;
             vehicle_without_legal_action_ = true;
-          } else if (network_->IsLocationASinkNode(vehicle_location_)) {
+          } else if (network_->IsLocationASinkNode(vehicle_location_id_)) {
             vehicle_without_legal_action_ = true;
             vehicle_final_travel_time_ = -1 * GetGame()->MinUtility();
           } else {
@@ -350,11 +353,11 @@ std::string MeanFieldRoutingGameState::ActionToString(Player player,
 }
 
 Action MeanFieldRoutingGameState::GetLocationAsActionInt() const {
-  return network_->GetRoadSectionAsInt(vehicle_location_);
+  return vehicle_location_id_;
 }
 
 Action MeanFieldRoutingGameState::GetDestinationAsActionInt() const {
-  return network_->GetRoadSectionAsInt(vehicle_destination_);
+  return vehicle_destination_id_;
 }
 
 int MeanFieldRoutingGameState::CurrentTimeStamp() const {
@@ -422,8 +425,9 @@ void MeanFieldRoutingGameState::UpdateDistribution(
     if (waiting_time_ == kWaitingTimeNotAssigned) {
       double volume = total_num_vehicle_ * normed_density_on_vehicle_link;
       waiting_time_ =
-          static_cast<int>(network_->GetTravelTime(vehicle_location_, volume) /
-                           time_step_length_) -
+          static_cast<int>(
+              network_->GetTravelTime(vehicle_location_id_, volume) /
+              time_step_length_) -
           1;
       waiting_time_ = std::max(0, waiting_time_);
     }
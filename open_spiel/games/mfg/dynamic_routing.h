@@ -221,6 +221,12 @@ class MeanFieldRoutingGameState : public State {
   // It is associated to the representative vehicle after the initial chance
   // node according to the od_demand distribution.
   std::string vehicle_destination_;
+  // Integer mirrors of the location and destination above, as 1-based road
+  // section action ids (kNoPossibleAction while the strings are empty). Kept
+  // in sync so the per-time-step paths can use the id-indexed network tables
+  // instead of hashing the road section strings.
+  int vehicle_location_id_ = kNoPossibleAction;
+  int vehicle_destination_id_ = kNoPossibleAction;
 
   // Size of the time step, used to convert travel times into number of game
   // time steps.
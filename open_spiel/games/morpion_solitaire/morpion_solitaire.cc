@@ -49,6 +49,30 @@ REGISTER_SPIEL_GAME(kGameType, Factory);
 
 RegisterSingleTensorObserver single_tensor(kGameType.short_name);
 
+inline void SetMaskBit(PointMask* mask, int pos) {
+  (*mask)[pos >> 6] |= uint64_t{1} << (pos & 63);
+}
+
+inline void ClearMaskBit(PointMask* mask, int pos) {
+  (*mask)[pos >> 6] &= ~(uint64_t{1} << (pos & 63));
+}
+
+// Number of points of `mask` that are also set in `other`.
+inline int CountOverlap(const PointMask& mask, const PointMask& other) {
+  int count = 0;
+  for (int i = 0; i < mask.size(); i++) {
+    count += __builtin_popcountll(mask[i] & other[i]);
+  }
+  return count;
+}
+
+inline bool Intersects(const PointMask& mask, const PointMask& other) {
+  for (int i = 0; i < mask.size(); i++) {
+    if ((mask[i] & other[i]) != 0) return true;
+  }
+  return false;
+}
+
 }  // namespace
 
 // Line methods =============================================================
@@ -105,15 +129,27 @@ void Line::Init(Point point1, Point point2) {
   // 0]).
   direction_[0] = static_cast<int>((endpoint2_.x - endpoint1_.x) / 3);
   direction_[1] = static_cast<int>((endpoint2_.y - endpoint1_.y) / 3);
+  if (direction_[0] == 0) {
+    dir_index_ = 0;  // [0, 1]
+  } else if (direction_[1] == 0) {
+    dir_index_ = 1;  // [1, 0]
+  } else if (direction_[1] == 1) {
+    dir_index_ = 2;  // [1, 1]
+  } else {
+    dir_index_ = 3;  // [1, -1]
+  }
   // Get all points in line (beyond the two initial endpoints) and sort.
   for (int i = 0; i < 4; i++) {
     line_points_.emplace_back(endpoint1_.x + i * direction_[0],
                               endpoint1_.y + i * direction_[1]);
   }
   std::sort(line_points_.begin(), line_points_.end());
+  for (const Point& p : line_points_) {
+    SetMaskBit(&point_mask_, p.y + (p.x * kNumRows));
+  }
 }
 
-bool Line::CheckOverlap(Line l) {
+bool Line::CheckOverlap(Line l) const {
   // Only check for overlapping points for lines in the same direction.
   if (direction_ != l.GetDirection()) {
     return false;
@@ -141,7 +177,7 @@ bool Line::operator==(Line other_line) {
 }
 
 // Getters
-Action Line::GetAction() {
+Action Line::GetAction() const {
   int dirCode;
   if ((direction_[0] == 0) && (direction_[1] == 1)) {
     dirCode = 1;
@@ -180,36 +216,44 @@ std::string Line::ToString() const {
   return "(" + endpoint1_.ToString() + " " + endpoint2_.ToString() + ")";
 }
 
-std::vector<Point> Line::GetEndpoints() {
+std::vector<Point> Line::GetEndpoints() const {
   return std::vector<Point>{endpoint1_, endpoint2_};
 }
 
-std::array<int, 2> Line::GetDirection() { return direction_; }
+std::array<int, 2> Line::GetDirection() const { return direction_; }
 
-std::vector<Point> Line::GetAllPoints() { return line_points_; }
+const std::vector<Point>& Line::GetAllPoints() const { return line_points_; }
 
 // Morpion State methods ====================================================
 void MorpionState::DoApplyAction(Action move) {
-  Line newMove = *action_map_.at(move);
+  const Line& newMove = all_lines_[action_map_.at(move)];
   Point newPoint;
   int pos;
-  for (Point p : newMove.GetAllPoints()) {
+  for (const Point& p : newMove.GetAllPoints()) {
     pos = p.y + (p.x * kNumRows);
     if (board_[pos] == 0) {
       board_[pos] = 1;
+      SetMaskBit(&occupied_, pos);
       newPoint = p;
       break;
     }
   }
+  // Mark the line's points as covered in its direction, so overlapping
+  // candidates in that direction drop out of the valid set.
+  const PointMask& mask = newMove.GetPointMask();
+  PointMask& used = dir_used_[newMove.GetDirIndex()];
+  for (int i = 0; i < mask.size(); i++) used[i] |= mask[i];
   move_history_.emplace_back(newMove, newPoint);
   num_moves_ += 1;
   current_returns_ += 1;
+  valid_moves_dirty_ = true;
 }
 
 std::vector<Action> MorpionState::LegalActions() const {
   if (IsTerminal()) return {};
   std::vector<Action> moves;
-  for (Line move : current_valid_moves_) {
+  moves.reserve(current_valid_moves_.size());
+  for (const Line& move : current_valid_moves_) {
     moves.push_back(move.GetAction());
   }
   sort(moves.begin(), moves.end());
@@ -218,9 +262,9 @@ std::vector<Action> MorpionState::LegalActions() const {
 
 std::string MorpionState::ActionToString(Player player,
                                          Action action_id) const {
-  Line move = *action_map_.at(action_id);
+  const Line& move = all_lines_[action_map_.at(action_id)];
   std::string action_str;
-  for (Point p : move.GetAllPoints()) {
+  for (const Point& p : move.GetAllPoints()) {
     absl::StrAppend(&action_str, p.ToString(), " ");
   }
   return action_str;
@@ -258,39 +302,31 @@ MorpionState::MorpionState(std::shared_ptr<const Game> game) : State(game) {
       }
     }
   }
-  // For each line, store in a map of action # -> line object.
-  for (Line& line : all_lines_) {
-    action_map_[line.GetAction()] = &line;
+  // For each line, store in a map of action # -> index into all_lines_.
+  // Indices rather than pointers keep the map valid across State copies.
+  for (int i = 0; i < all_lines_.size(); i++) {
+    action_map_[all_lines_[i].GetAction()] = i;
+  }
+  // Bit-packed mirror of the starting points.
+  for (int pos = 0; pos < kNumPoints; pos++) {
+    if (board_[pos] == 1) SetMaskBit(&occupied_, pos);
   }
 }
 
 // Generate all valid lines / moves in current board state.
 void MorpionState::getAllValidMoves() const {
+  if (!valid_moves_dirty_) return;
   current_valid_moves_.clear();
-  for (Line l : all_lines_) {
-    // Check that exactly one point is empty.
-    int count = 0;
-    for (Point p : l.GetAllPoints()) {
-      if (board_[p.y + (p.x * kNumRows)] == 1) {
-        count++;
-      }
-    }
-    if (count != 3) {
-      continue;
-    }
-    // Check that line does not overlap any existing moves / lines.
-    bool overlaps = false;
-    for (const std::pair<Line, Point>& m : move_history_) {
-      overlaps = l.CheckOverlap(m.first);
-      if (overlaps) {
-        break;
-      }
-    }
-    if (overlaps) {
-      continue;
-    }
+  for (const Line& l : all_lines_) {
+    const PointMask& mask = l.GetPointMask();
+    // Exactly one of the line's four points may be empty, and none of them
+    // may already be covered by a played line in the same direction. Both
+    // are mask tests; the move history is never scanned.
+    if (CountOverlap(mask, occupied_) != 3) continue;
+    if (Intersects(mask, dir_used_[l.GetDirIndex()])) continue;
     current_valid_moves_.push_back(l);
   }
+  valid_moves_dirty_ = false;
 }
 
 bool MorpionState::IsTerminal() const {
@@ -333,11 +369,19 @@ std::string MorpionState::ObservationString(Player player) const {
 
 void MorpionState::UndoAction(Player player, Action move) {
   std::pair<Line, Point> last_move = move_history_.back();
-  board_[last_move.second.x * kNumRows + last_move.second.y] = 0;
+  int pos = last_move.second.y + (last_move.second.x * kNumRows);
+  board_[pos] = 0;
+  ClearMaskBit(&occupied_, pos);
+  // Valid same-direction lines never share points, so clearing this line's
+  // bits cannot clear another played line's coverage.
+  const PointMask& mask = last_move.first.GetPointMask();
+  PointMask& used = dir_used_[last_move.first.GetDirIndex()];
+  for (int i = 0; i < mask.size(); i++) used[i] &= ~mask[i];
   move_history_.pop_back();
   num_moves_ -= 1;
   history_.pop_back();
   --move_number_;
+  valid_moves_dirty_ = true;
 }
 
 std::unique_ptr<State> MorpionState::Clone() const {
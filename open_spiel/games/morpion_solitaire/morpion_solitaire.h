@@ -16,9 +16,11 @@
 #define OPEN_SPIEL_GAMES_MORPION_SOLITAIRE_H_
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "open_spiel/spiel.h"
@@ -39,6 +41,10 @@ namespace morpion_solitaire {
 inline constexpr int kNumRows = 13;
 inline constexpr int kNumCols = 13;
 inline constexpr int kNumPoints = kNumRows * kNumCols;
+inline constexpr int kNumDirections = 4;
+
+// A bitset over the board's points, indexed as y + x * kNumRows.
+using PointMask = std::array<uint64_t, (kNumPoints + 63) / 64>;
 
 // Support Classes and Structs
 // =============================================================
@@ -76,20 +82,28 @@ class Line {
   bool operator==(Line other_line);
 
   // Getters and setters
-  std::vector<Point> GetEndpoints();
-  std::array<int, 2> GetDirection();
-  std::vector<Point> GetAllPoints();
-  Action GetAction();
-  bool CheckOverlap(Line l);
+  std::vector<Point> GetEndpoints() const;
+  std::array<int, 2> GetDirection() const;
+  const std::vector<Point>& GetAllPoints() const;
+  Action GetAction() const;
+  bool CheckOverlap(Line l) const;
   std::string ToString() const;
 
+  // Direction as an index in [0, kNumDirections), for the per-direction
+  // coverage masks.
+  int GetDirIndex() const { return dir_index_; }
+  // Bitset of the four points on this line.
+  const PointMask& GetPointMask() const { return point_mask_; }
+
  private:
   void Init(Point point1, Point point2);
   std::array<int, 2>
       direction_{};  // One of 4 line directions (0,0), (1,0), (1,1), (1,-1)
+  int dir_index_ = 0;
   Point endpoint1_;
   Point endpoint2_;
   std::vector<Point> line_points_;  // Collection of all 4 points on a line
+  PointMask point_mask_{};
 };
 
 // State of an in-play game.
@@ -128,7 +142,21 @@ class MorpionState : public State {
   double current_returns_{};
   std::vector<std::pair<Line, Point>>
       move_history_;  // Stores both Line and new Point created during move
-  std::unordered_map<int, Line*> action_map_;  // Maps action encoding to Line
+  std::unordered_map<int, int>
+      action_map_;  // Maps action encoding to an index into all_lines_.
+
+  // Bit-packed occupancy, and per line direction the points already covered
+  // by a played line in that direction. A candidate line is valid iff
+  // exactly three of its points are occupied and none of its points is
+  // covered in its direction, so validity is a few mask tests instead of a
+  // scan of the move history. Both are updated in place by DoApplyAction and
+  // reverted exactly by UndoAction (same-direction lines never share points,
+  // so clearing a line's bits cannot disturb another line's).
+  PointMask occupied_{};
+  std::array<PointMask, kNumDirections> dir_used_{};
+  // Whether current_valid_moves_ matches the boards above; cleared on apply
+  // and undo so repeated IsTerminal/LegalActions calls reuse the list.
+  mutable bool valid_moves_dirty_ = true;
 };
 
 // Game object.
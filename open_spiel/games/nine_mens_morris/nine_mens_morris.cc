@@ -15,6 +15,7 @@
 #include "open_spiel/games/nine_mens_morris/nine_mens_morris.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -104,6 +105,42 @@ constexpr std::array<std::array<int, 4>, kNumPoints> kPointNeighbors = {{
     {14, -1, -1, 22}   // 23
 }};
 
+constexpr uint32_t kFullBoardMask = (1u << kNumPoints) - 1;
+
+// The 16 mills: 8 along the rows and 8 along the columns of the diagram
+// above.
+constexpr int kNumMills = 16;
+constexpr std::array<Mill, kNumMills> kMillList = {{
+    {0, 1, 2},    {3, 4, 5},    {6, 7, 8},    {9, 10, 11},
+    {12, 13, 14}, {15, 16, 17}, {18, 19, 20}, {21, 22, 23},
+    {0, 9, 21},   {3, 10, 18},  {6, 11, 15},  {1, 4, 7},
+    {16, 19, 22}, {8, 12, 17},  {5, 13, 20},  {2, 14, 23},
+}};
+
+// The occupancy mask of each mill, and per point the masks of the two mills
+// through it, so mill detection is two mask compares.
+constexpr std::array<uint32_t, kNumMills> MillMasks() {
+  std::array<uint32_t, kNumMills> masks{};
+  for (int i = 0; i < kNumMills; ++i) {
+    masks[i] = (1u << kMillList[i][0]) | (1u << kMillList[i][1]) |
+               (1u << kMillList[i][2]);
+  }
+  return masks;
+}
+constexpr std::array<uint32_t, kNumMills> kMillMasks = MillMasks();
+
+constexpr std::array<std::array<uint32_t, 2>, kNumPoints> PointMillMasks() {
+  std::array<std::array<uint32_t, 2>, kNumPoints> masks{};
+  for (int i = 0; i < kNumMills; ++i) {
+    for (int point : kMillList[i]) {
+      masks[point][masks[point][0] == 0 ? 0 : 1] = kMillMasks[i];
+    }
+  }
+  return masks;
+}
+constexpr std::array<std::array<uint32_t, 2>, kNumPoints> kPointMillMasks =
+    PointMillMasks();
+
 }  // namespace
 
 CellState PlayerToState(Player player) {
@@ -169,68 +206,59 @@ void FromMoveAction(Action action, int* source, int* dest) {
 void NineMensMorrisState::GetCurrentLegalActions() {
   cur_legal_actions_.clear();
 
+  const uint32_t empty = kFullBoardMask & ~(occupancy_[0] | occupancy_[1]);
   if (capture_) {
     Player opp = 1 - current_player_;
     bool all_mills = CheckAllMills(opp);
-    for (int p = 0; p < kNumPoints; ++p) {
-      if (StateToPlayer(board_[p]) == opp) {
-        if (all_mills || !CheckInMill(p)) {
-          cur_legal_actions_.push_back(p);
-        }
+    for (uint32_t men = occupancy_[opp]; men != 0; men &= men - 1) {
+      int p = __builtin_ctz(men);
+      if (all_mills || !CheckInMill(p)) {
+        cur_legal_actions_.push_back(p);
       }
     }
   } else {
     if (men_to_deploy_[current_player_] > 0) {
       // Still in phase 1.
-      for (int p = 0; p < kNumPoints; ++p) {
-        if (board_[p] == CellState::kEmpty) {
-          cur_legal_actions_.push_back(p);
-        }
+      for (uint32_t points = empty; points != 0; points &= points - 1) {
+        cur_legal_actions_.push_back(__builtin_ctz(points));
       }
     } else if (num_men_[current_player_] > 3) {
       // Phase 2.
-      for (int p = 0; p < kNumPoints; ++p) {
-        Player player = StateToPlayer(board_[p]);
-        if (player == current_player_) {
-          for (int dir = 0; dir < 4; ++dir) {
-            int np = kPointNeighbors[p][dir];
-            if (np > 0 && board_[np] == CellState::kEmpty) {
-              cur_legal_actions_.push_back(ToMoveAction(p, np));
-            }
+      for (uint32_t men = occupancy_[current_player_]; men != 0;
+           men &= men - 1) {
+        int p = __builtin_ctz(men);
+        for (int dir = 0; dir < 4; ++dir) {
+          int np = kPointNeighbors[p][dir];
+          if (np > 0 && (empty & (1u << np)) != 0) {
+            cur_legal_actions_.push_back(ToMoveAction(p, np));
           }
         }
       }
       absl::c_sort(cur_legal_actions_);
     } else {
-      // Phase 3.
-      for (int p = 0; p < kNumPoints; ++p) {
-        Player player = StateToPlayer(board_[p]);
-        if (player == current_player_) {
-          for (int np = 0; np < kNumPoints; ++np) {
-            if (p == np) {
-              continue;
-            }
-
-            if (board_[np] == CellState::kEmpty) {
-              cur_legal_actions_.push_back(ToMoveAction(p, np));
-            }
-          }
+      // Phase 3 (flying): any of the player's men to any empty point. Both
+      // loops ascend, so the actions come out sorted.
+      for (uint32_t men = occupancy_[current_player_]; men != 0;
+           men &= men - 1) {
+        int p = __builtin_ctz(men);
+        for (uint32_t dests = empty; dests != 0; dests &= dests - 1) {
+          cur_legal_actions_.push_back(ToMoveAction(p, __builtin_ctz(dests)));
         }
       }
-      absl::c_sort(cur_legal_actions_);
     }
   }
 }
 
 bool NineMensMorrisState::CheckAllMills(Player player) const {
-  for (int p = 0; p < kNumPoints; ++p) {
-    if (StateToPlayer(board_[p]) == player) {
-      if (!CheckInMill(p)) {
-        return false;
-      }
+  // Every one of the player's men lies in some closed mill.
+  const uint32_t occ = occupancy_[player];
+  uint32_t in_mill = 0;
+  for (uint32_t mill : kMillMasks) {
+    if ((occ & mill) == mill) {
+      in_mill |= mill;
     }
   }
-  return true;
+  return (occ & ~in_mill) == 0;
 }
 
 bool NineMensMorrisState::CheckInMill(int pos) const {
@@ -238,33 +266,10 @@ bool NineMensMorrisState::CheckInMill(int pos) const {
   if (player == kInvalidPlayer) {
     return false;
   }
-
-  int cp = pos;
-
-  // Direction base: North or East.
-  for (int dir_base = 0; dir_base < 2; ++dir_base) {
-    int total_matches = 0;
-
-    // Try North + South, then East + West
-    for (int dir : {dir_base, dir_base + 2}) {
-      cp = pos;
-
-      for (int i = 0; i < 2; ++i) {
-        cp = kPointNeighbors[cp][dir];
-        if (cp < 0 || StateToPlayer(board_[cp]) != player) {
-          break;
-        } else {
-          total_matches++;
-        }
-      }
-    }
-
-    if (total_matches == 2) {
-      return true;
-    }
-  }
-
-  return false;
+  // A point lies on exactly two mills; test both against the occupancy.
+  const uint32_t occ = occupancy_[player];
+  return (occ & kPointMillMasks[pos][0]) == kPointMillMasks[pos][0] ||
+         (occ & kPointMillMasks[pos][1]) == kPointMillMasks[pos][1];
 }
 
 void NineMensMorrisState::DoApplyAction(Action move) {
@@ -277,6 +282,7 @@ void NineMensMorrisState::DoApplyAction(Action move) {
       SPIEL_CHECK_TRUE(opp == 1 - current_player_);
       num_men_[opp]--;
       board_[move] = CellState::kEmpty;
+      occupancy_[opp] &= ~(1u << move);
       capture_ = false;
       current_player_ = 1 - current_player_;
       num_turns_++;
@@ -284,6 +290,7 @@ void NineMensMorrisState::DoApplyAction(Action move) {
       // Regular move in phase 1 (deployment)
       SPIEL_CHECK_TRUE(board_[move] == CellState::kEmpty);
       board_[move] = PlayerToState(current_player_);
+      occupancy_[current_player_] |= 1u << move;
       SPIEL_CHECK_GT(men_to_deploy_[current_player_], 0);
       men_to_deploy_[current_player_]--;
       bool mill = CheckInMill(move);
@@ -302,6 +309,7 @@ void NineMensMorrisState::DoApplyAction(Action move) {
     SPIEL_CHECK_TRUE(board_[to_pos] == CellState::kEmpty);
     board_[to_pos] = board_[from_pos];
     board_[from_pos] = CellState::kEmpty;
+    occupancy_[current_player_] ^= (1u << from_pos) | (1u << to_pos);
     bool mill = CheckInMill(to_pos);
     if (mill) {
       capture_ = true;
@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_NINE_MENS_MORRIS_H_
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -85,6 +86,10 @@ class NineMensMorrisState : public State {
   bool capture_ = false;
   std::array<int, 2> men_to_deploy_ = {kNumMen, kNumMen};
   std::array<int, 2> num_men_ = {kNumMen, kNumMen};
+  // Per-player occupancy bitmask over the 24 points, kept in sync with
+  // board_. Mill checks and move generation work on these words against
+  // precomputed mill masks, see nine_mens_morris.cc.
+  std::array<uint32_t, kNumPlayers> occupancy_ = {0, 0};
   std::vector<Action> cur_legal_actions_;
 
   void GetCurrentLegalActions();
@@ -24,6 +24,7 @@
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/constrained_deals.h"
 
 namespace open_spiel {
 namespace oh_hell {
@@ -545,41 +546,42 @@ std::unique_ptr<State> OhHellState::ResampleFromInfostate(
   clone->ApplyAction(dealer_);
 
   // deal needs to be consistent with the player's hand, and the opponent's
-  // played cards
-  std::vector<std::vector<int>> known(num_players_);
+  // played cards; the unknown cards are assigned directly by the constrained
+  // sampler (with one extra hand for the undealt remainder of the deck), so
+  // no candidate deal is ever rejected
+  const int kUndealt = num_players_;
+  ConstrainedDealSampler sampler(deck_props_.NumCards(), num_players_ + 1);
+  for (Player p = 0; p < num_players_; ++p) sampler.SetHandSize(p, num_tricks_);
+  sampler.SetHandSize(
+      kUndealt, deck_props_.NumCards() - 1 - num_players_ * num_tricks_);
+  sampler.RemoveCard(trump_);
   for (int card = 0; card < deck_props_.NumCards(); ++card) {
+    if (card == trump_) continue;
     absl::optional<Player> p = initial_deal_[card];
     if (p.has_value() && (*p == player_id || !holder_[card].has_value())) {
       // if player_id was initially dealt the card, or if anyone was but no
       // longer holds it (because it was played), player_id knows where it was
       // dealt
-      known[*p].push_back(card);
+      sampler.SetKnownHolder(card, *p);
     }
+    // all other cards are unconstrained: from player_id's point of view they
+    // may sit in any opponent's hand or outside the deal entirely
   }
+  std::vector<int> deal = sampler.Sample(rng);
+  SPIEL_CHECK_FALSE(deal.empty());
 
-  // the only other known card is trump
   // apply num_tricks * num_players deal actions
-  std::vector<int> known_deal_counter(num_players_, 0);
+  std::vector<std::vector<int>> hands(num_players_);
+  for (int card = 0; card < deck_props_.NumCards(); ++card) {
+    if (deal[card] >= 0 && deal[card] < num_players_) {
+      hands[deal[card]].push_back(card);
+    }
+  }
+  std::vector<int> deal_counter(num_players_, 0);
   for (int i = 0; i < num_players_ * num_tricks_; ++i) {
     Player deal_to = i % num_players_;
-    if (known_deal_counter[deal_to] < known[deal_to].size()) {
-      clone->ApplyAction(known[deal_to][known_deal_counter[deal_to]]);
-      known_deal_counter[deal_to]++;
-    } else {
-      // deal randomly from the remaining unknown cards
-      Action candidate = kInvalidAction;
-      while (candidate == kInvalidAction) {
-        candidate = SampleAction(clone->ChanceOutcomes(), rng()).first;
-        absl::optional<Player> p = initial_deal_[candidate];
-        if (candidate == trump_ ||  (p.has_value() &&
-            (*p == player_id || !holder_[candidate].has_value()))) {
-          // can't use this card if player_id has it, or if it was played by
-          // any player
-          candidate = kInvalidAction;
-        }
-      }
-      clone->ApplyAction(candidate);
-    }
+    clone->ApplyAction(hands[deal_to][deal_counter[deal_to]]);
+    deal_counter[deal_to]++;
   }
 
   // deal the trump card
@@ -96,115 +96,111 @@ inline std::string ColumnString(int col) {
   return std::string(1, "abcdefgh"[col]);
 }
 
-}  // namespace
-
-Move Move::Next(Direction dir) const {
+// Bitboard kernels. Bit i of a board corresponds to cell i (row-major,
+// a1 = bit 0), matching the action encoding.
+constexpr uint64_t kNotAFile = 0xfefefefefefefefeULL;  // clears column a
+constexpr uint64_t kNotHFile = 0x7f7f7f7f7f7f7f7fULL;  // clears column h
+
+// Shifts every disc one step in the given direction, dropping discs that
+// leave the board.
+inline uint64_t Shift(uint64_t b, Direction dir) {
   switch (dir) {
-    case Direction::kUp:
-      return Move(row_ - 1, col_);
-    case Direction::kDown:
-      return Move(row_ + 1, col_);
-    case Direction::kLeft:
-      return Move(row_, col_ - 1);
-    case Direction::kRight:
-      return Move(row_, col_ + 1);
-    case Direction::kUpRight:
-      return Move(row_ - 1, col_ + 1);
-    case Direction::kUpLeft:
-      return Move(row_ - 1, col_ - 1);
-    case Direction::kDownRight:
-      return Move(row_ + 1, col_ + 1);
-    case Direction::kDownLeft:
-      return Move(row_ + 1, col_ - 1);
+    case kUp:
+      return b >> kNumCols;
+    case kDown:
+      return b << kNumCols;
+    case kLeft:
+      return (b & kNotAFile) >> 1;
+    case kRight:
+      return (b & kNotHFile) << 1;
+    case kUpLeft:
+      return (b & kNotAFile) >> (kNumCols + 1);
+    case kUpRight:
+      return (b & kNotHFile) >> (kNumCols - 1);
+    case kDownLeft:
+      return (b & kNotAFile) << (kNumCols - 1);
+    case kDownRight:
+      return (b & kNotHFile) << (kNumCols + 1);
     default:
-      SpielFatalError(absl::StrCat("Found unmatched case in Next."));
+      SpielFatalError("Found unmatched case in Shift.");
   }
 }
 
-std::string Move::ToString() const {
-  return absl::StrCat(ColumnString(col_), RowString(row_));
-}
-
-inline bool Move::OnBoard() const {
-  return (row_ >= 0) && (row_ < kNumRows) && (col_ >= 0) && (col_ < kNumCols);
-}
-
-int OthelloState::CountSteps(Player player, int action, Direction dir) const {
-  Move move = Move(action).Next(dir);
-
-  int count = 0;
-  CellState cell = PlayerToState(player);
-  while (move.OnBoard()) {
-    if (BoardAt(move) == cell) {
-      return count;
-    } else if (BoardAt(move) == CellState::kEmpty) {
-      return 0;
+// Dumb7Fill move generation: for each direction, flood own discs along runs
+// of opponent discs; every empty square one step past such a run is a legal
+// move.
+uint64_t LegalMovesMask(uint64_t own, uint64_t opp) {
+  const uint64_t empty = ~(own | opp);
+  uint64_t legal = 0;
+  for (Direction dir : kDirections) {
+    uint64_t flood = Shift(own, dir) & opp;
+    // A run of opponent discs is at most kNumRows - 2 long.
+    for (int i = 0; i < kNumRows - 3; ++i) {
+      flood |= Shift(flood, dir) & opp;
     }
-
-    count++;
-    move = move.Next(dir);
+    legal |= Shift(flood, dir) & empty;
   }
-
-  return 0;
+  return legal;
 }
 
-bool OthelloState::CanCapture(Player player, int move) const {
-  if (board_[move] != CellState::kEmpty) return false;
-
-  for (auto direction : kDirections) {
-    if (CountSteps(player, move, direction) != 0) {
-      return true;
+// Discs flipped by placing one of `own`'s discs on `move_bit`; zero if the
+// move captures nothing (i.e. is not legal).
+uint64_t ComputeFlips(uint64_t own, uint64_t opp, uint64_t move_bit) {
+  uint64_t flips = 0;
+  for (Direction dir : kDirections) {
+    uint64_t line = Shift(move_bit, dir) & opp;
+    for (int i = 0; i < kNumRows - 3; ++i) {
+      line |= Shift(line, dir) & opp;
     }
+    // The run only counts if the square past its far end holds our own disc.
+    if (Shift(line, dir) & own) flips |= line;
   }
-
-  return false;
+  return flips;
 }
 
-void OthelloState::Capture(Player player, int action, Direction dir,
-                           int steps) {
-  Move move = Move(action).Next(dir);
+}  // namespace
 
-  CellState cell = PlayerToState(player);
-  for (int step = 0; step < steps; step++) {
-    if (BoardAt(move) == CellState::kEmpty || BoardAt(move) == cell) {
-      SpielFatalError(absl::StrCat("Cannot capture cell ", move.ToString()));
-    }
+std::string Move::ToString() const {
+  return absl::StrCat(ColumnString(col_), RowString(row_));
+}
 
-    board_[move.GetAction()] = cell;
-    move = move.Next(dir);
-  }
+CellState OthelloState::BoardAt(int cell) const {
+  if ((pieces_[0] >> cell) & 1) return CellState::kBlack;
+  if ((pieces_[1] >> cell) & 1) return CellState::kWhite;
+  return CellState::kEmpty;
 }
 
 int OthelloState::DiskCount(Player player) const {
-  return absl::c_count(board_, PlayerToState(player));
+  return __builtin_popcountll(pieces_[player]);
 }
 
 bool OthelloState::NoValidActions() const {
-  return (LegalRegularActions(Player(0)).empty() &&
-          LegalRegularActions(Player(1)).empty());
+  return LegalMovesMask(pieces_[0], pieces_[1]) == 0 &&
+         LegalMovesMask(pieces_[1], pieces_[0]) == 0;
 }
 
 bool OthelloState::ValidAction(Player player, int move) const {
-  return (board_[move] == CellState::kEmpty && CanCapture(player, move));
+  return (LegalMovesMask(pieces_[player], pieces_[1 - player]) >> move) & 1;
 }
 
 void OthelloState::DoApplyAction(Action action) {
   if (action == kPassMove) {  // pass
+    flipped_history_.push_back(0);
     current_player_ = 1 - current_player_;
     return;
   }
 
-  SPIEL_CHECK_TRUE(ValidAction(current_player_, action));
+  const uint64_t move_bit = uint64_t{1} << action;
+  uint64_t& own = pieces_[current_player_];
+  uint64_t& opp = pieces_[1 - current_player_];
+  // A move is valid iff the square is empty and it captures something.
+  SPIEL_CHECK_EQ((own | opp) & move_bit, 0);
+  const uint64_t flipped = ComputeFlips(own, opp, move_bit);
+  SPIEL_CHECK_NE(flipped, 0);
 
-  CellState cell = PlayerToState(current_player_);
-  board_[action] = cell;
-
-  for (auto direction : kDirections) {
-    int steps = CountSteps(current_player_, action, direction);
-    if (steps > 0) {
-      Capture(current_player_, action, direction, steps);
-    }
-  }
+  own |= move_bit | flipped;
+  opp ^= flipped;
+  flipped_history_.push_back(flipped);
 
   if (NoValidActions()) {  // check for end game state
     int count_zero = DiskCount(Player(0));
@@ -222,12 +218,28 @@ void OthelloState::DoApplyAction(Action action) {
   }
 }
 
+void OthelloState::UndoAction(Player player, Action action) {
+  SPIEL_CHECK_FALSE(history_.empty());
+  SPIEL_CHECK_EQ(history_.back().action, action);
+  const uint64_t flipped = flipped_history_.back();
+  if (action != kPassMove) {
+    // Every flipped disc belonged to the opponent before the move.
+    pieces_[player] ^= (uint64_t{1} << action) | flipped;
+    pieces_[1 - player] |= flipped;
+  }
+  flipped_history_.pop_back();
+  // The move being undone was legal, so the game was not over before it.
+  outcome_ = kInvalidPlayer;
+  current_player_ = player;
+  history_.pop_back();
+  --move_number_;
+}
+
 std::vector<Action> OthelloState::LegalRegularActions(Player p) const {
   std::vector<Action> moves;
-  for (int cell = 0; cell < kNumCells; ++cell) {
-    if (ValidAction(p, cell)) {
-      moves.push_back(cell);
-    }
+  for (uint64_t mask = LegalMovesMask(pieces_[p], pieces_[1 - p]); mask != 0;
+       mask &= mask - 1) {
+    moves.push_back(__builtin_ctzll(mask));
   }
   return moves;
 }
@@ -249,11 +261,10 @@ std::string OthelloState::ActionToString(Player player,
 }
 
 OthelloState::OthelloState(std::shared_ptr<const Game> game) : State(game) {
-  absl::c_fill(board_, CellState::kEmpty);
-  board_[Move(3, 3).GetAction()] = CellState::kWhite;
-  board_[Move(3, 4).GetAction()] = CellState::kBlack;
-  board_[Move(4, 3).GetAction()] = CellState::kBlack;
-  board_[Move(4, 4).GetAction()] = CellState::kWhite;
+  pieces_[0] = (uint64_t{1} << Move(3, 4).GetAction()) |
+               (uint64_t{1} << Move(4, 3).GetAction());  // black
+  pieces_[1] = (uint64_t{1} << Move(3, 3).GetAction()) |
+               (uint64_t{1} << Move(4, 4).GetAction());  // white
 }
 
 std::string OthelloState::ToString() const {
@@ -308,9 +319,10 @@ void OthelloState::ObservationTensor(Player player,
   TensorView<2> view(values, {kCellStates, kNumCells}, true);
 
   for (int cell = 0; cell < kNumCells; ++cell) {
-    if (board_[cell] == CellState::kEmpty) {
+    const CellState state = BoardAt(cell);
+    if (state == CellState::kEmpty) {
       view[{0, cell}] = 1;
-    } else if (board_[cell] == PlayerToState(player)) {
+    } else if (state == PlayerToState(player)) {
       view[{1, cell}] = 1;
     } else {  // Opponent's piece
       view[{2, cell}] = 1;
@@ -16,12 +16,12 @@
 #define OPEN_SPIEL_GAMES_OTHELLO_H_
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include "open_spiel/abseil-cpp/absl/algorithm/container.h"  // for c_fill
 #include "open_spiel/spiel.h"
 
 // Simple game of Othello:
@@ -73,9 +73,7 @@ class Move {
   inline int GetRow() const { return row_; }
   inline int GetColumn() const { return col_; }
   inline int GetAction() const { return row_ * kNumCols + col_; }
-  inline bool OnBoard() const;
 
-  Move Next(Direction dir) const;
   std::string ToString() const;
 
  private:
@@ -102,14 +100,16 @@ class OthelloState : public State {
   void ObservationTensor(Player player,
                          absl::Span<float> values) const override;
   std::unique_ptr<State> Clone() const override;
+  void UndoAction(Player player, Action action) override;
   std::vector<Action> LegalActions() const override;
 
  private:
-  std::array<CellState, kNumCells> board_;
   void DoApplyAction(Action action) override;
 
-  CellState BoardAt(int row, int col) const { return BoardAt(Move(row, col)); }
-  CellState BoardAt(Move move) const { return board_[move.GetAction()]; }
+  CellState BoardAt(int row, int col) const {
+    return BoardAt(row * kNumCols + col);
+  }
+  CellState BoardAt(int cell) const;
 
   // Returns a list of regular (non-pass) actions.
   std::vector<Action> LegalRegularActions(Player p) const;
@@ -123,18 +123,17 @@ class OthelloState : public State {
   // Returns the number of pieces on the board for the given player.
   int DiskCount(Player player) const;
 
-  // Returns true if the specified move would result in a capture.
-  bool CanCapture(Player player, int move) const;
-
-  // Returns the number of capturable disks of the opponent in the given
-  // direction from the given starting location.
-  int CountSteps(Player player, int action, Direction dir) const;
-
-  // Updates the board to reflect a capture move.
-  void Capture(Player player, int action, Direction dir, int steps);
+  // One bitboard of discs per player; bit i corresponds to cell i (row-major,
+  // a1 = bit 0). Move generation and flip computation are shift-based over
+  // these, see LegalMovesMask/ComputeFlips in othello.cc.
+  std::array<uint64_t, kNumPlayers> pieces_;
 
   Player current_player_ = 0;  // Player zero goes first
   Player outcome_ = kInvalidPlayer;
+
+  // The discs flipped by each move played so far (zero for passes), enabling
+  // incremental UndoAction for clone-free search.
+  std::vector<uint64_t> flipped_history_;
 };
 
 // Game object.
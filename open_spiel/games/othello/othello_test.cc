@@ -25,6 +25,7 @@ void BasicOthelloTests() {
   testing::LoadGameTest("othello");
   testing::NoChanceOutcomesTest(*LoadGame("othello"));
   testing::RandomSimTest(*LoadGame("othello"), 100);
+  testing::RandomSimTestWithUndo(*LoadGame("othello"), 5);
 }
 
 }  // namespace
@@ -0,0 +1,243 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/oware/oware_endgame.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace oware {
+namespace {
+
+std::string EncodeBoard(const std::vector<int>& seeds, Player player) {
+  std::string key(seeds.size() + 1, '\0');
+  for (int house = 0; house < seeds.size(); ++house) {
+    key[house] = static_cast<char>(seeds[house]);
+  }
+  key[seeds.size()] = static_cast<char>(player);
+  return key;
+}
+
+int SeedsOnBoard(const OwareBoard& board) {
+  int total = 0;
+  for (int seeds : board.seeds) total += seeds;
+  return total;
+}
+
+// Mirrors OwareState::LegalActions for a bare board: whether the player to
+// move can sow at all, feeding the opponent if the opponent has no seeds.
+// Needed because a custom-board OwareState may only be constructed for
+// positions that are terminal or have a legal move.
+bool HasLegalMove(const std::vector<int>& seeds, Player player) {
+  const int num_houses_per_player = seeds.size() / kNumPlayers;
+  const int lower = player * num_houses_per_player;
+  const int upper = lower + num_houses_per_player - 1;
+  int opponent_seeds = 0;
+  for (int house = 0; house < seeds.size(); ++house) {
+    if (house < lower || house > upper) opponent_seeds += seeds[house];
+  }
+  for (int house = lower; house <= upper; ++house) {
+    if (opponent_seeds == 0) {
+      const int first_seeds_in_own_row = upper - house;
+      if (seeds[house] - first_seeds_in_own_row > 0) return true;
+    } else {
+      if (seeds[house] > 0) return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+OwareEndgameTable::OwareEndgameTable(int max_seeds) : max_seeds_(max_seeds) {
+  SPIEL_CHECK_GE(max_seeds, 0);
+}
+
+void OwareEndgameTable::Build(std::shared_ptr<const Game> game) {
+  SPIEL_CHECK_EQ(game->GetType().short_name, "oware");
+  values_.clear();
+  std::vector<int> seeds(kNumPlayers * game->NumDistinctActions(), 0);
+  // Layer by layer, so that capture continuations (which always land in a
+  // lower layer) are already solved.
+  for (int total = 0; total <= max_seeds_; ++total) {
+    EnumerateBoards(game, &seeds, /*house=*/0, /*remaining=*/total);
+  }
+}
+
+void OwareEndgameTable::EnumerateBoards(
+    const std::shared_ptr<const Game>& game, std::vector<int>* seeds,
+    int house, int remaining) {
+  if (house == seeds->size()) {
+    if (remaining != 0) return;
+    for (Player player = 0; player < kNumPlayers; ++player) {
+      int value;
+      if (HasLegalMove(*seeds, player)) {
+        const OwareState state(game,
+                               OwareBoard(player, /*score=*/{0, 0}, *seeds));
+        value = Solve(state);
+      } else {
+        // Starved: the game ends and each player collects their own row.
+        const int num_houses_per_player = seeds->size() / kNumPlayers;
+        value = 0;
+        for (int h = 0; h < seeds->size(); ++h) {
+          const int sign = (h / num_houses_per_player == player) ? 1 : -1;
+          value += sign * (*seeds)[h];
+        }
+      }
+      values_[EncodeBoard(*seeds, player)] = value;
+    }
+    return;
+  }
+  for (int count = 0; count <= remaining; ++count) {
+    (*seeds)[house] = count;
+    EnumerateBoards(game, seeds, house + 1, remaining - count);
+  }
+  (*seeds)[house] = 0;
+}
+
+int OwareEndgameTable::Solve(const OwareState& state) const {
+  const OwareBoard& board = state.Board();
+  const Player mover = board.current_player;
+  int best = std::numeric_limits<int>::min();
+  for (Action action : state.LegalActions()) {
+    const std::unique_ptr<State> child = state.Child(action);
+    const auto& child_state = down_cast<const OwareState&>(*child);
+    const OwareBoard& child_board = child_state.Board();
+    // Seeds banked by the move itself (captures, and collected rows if the
+    // move ended the game).
+    const int immediate =
+        (child_board.score[mover] - board.score[mover]) -
+        (child_board.score[1 - mover] - board.score[1 - mover]);
+    int value;
+    if (child_state.IsTerminal()) {
+      // A terminal child must never fall through to the recursive branch: it
+      // has no legal actions to solve over.
+      if (SeedsOnBoard(child_board) == 0) {
+        // Played to completion, starved, or ended by repetition: every
+        // remaining seed has been banked (on repetition each player collects
+        // their own row), so the score delta is the whole value.
+        value = immediate;
+      } else {
+        // Ended by majority with seeds still on the board: the table values
+        // seeds to completion, so the position is played on. (Ending by
+        // majority can only make the sign of the eventual real-game score
+        // difference more certain, so playing on is sign-exact for the real
+        // game.)
+        value = immediate - LookupValue(child_board);
+      }
+    } else if (immediate != 0) {
+      // A capture: the repetition set is reset, so the continuation depends
+      // only on the board and lies in an already-solved layer.
+      value = immediate - LookupValue(child_board);
+    } else {
+      // Same layer; the child state carries the repetition history.
+      value = -Solve(child_state);
+    }
+    best = std::max(best, value);
+  }
+  SPIEL_CHECK_GT(best, std::numeric_limits<int>::min());
+  return best;
+}
+
+int OwareEndgameTable::LookupValue(const OwareBoard& board) const {
+  const auto it = values_.find(EncodeBoard(board.seeds, board.current_player));
+  SPIEL_CHECK_TRUE(it != values_.end());
+  return it->second;
+}
+
+absl::optional<int> OwareEndgameTable::Probe(const OwareState& state) const {
+  const OwareBoard& board = state.Board();
+  const auto it = values_.find(EncodeBoard(board.seeds, board.current_player));
+  if (it == values_.end()) return absl::nullopt;
+  return it->second;
+}
+
+std::function<double(const State&)> OwareEndgameTable::MakeValueFunction(
+    Player maximizing_player,
+    std::function<double(const State&)> fallback) const {
+  return [this, maximizing_player, fallback](const State& state) -> double {
+    const auto& oware_state = down_cast<const OwareState&>(state);
+    const absl::optional<int> net = Probe(oware_state);
+    if (!net.has_value()) {
+      if (fallback == nullptr) {
+        SpielFatalError(absl::StrCat(
+            "Position with more than ", max_seeds_,
+            " seeds probed without a fallback value function."));
+      }
+      return fallback(state);
+    }
+    const OwareBoard& board = oware_state.Board();
+    const Player mover = board.current_player;
+    const int final_difference =
+        board.score[mover] - board.score[1 - mover] + *net;
+    const double value =
+        final_difference > 0 ? 1.0 : (final_difference < 0 ? -1.0 : 0.0);
+    return mover == maximizing_player ? value : -value;
+  };
+}
+
+void OwareEndgameTable::Save(const std::string& filename) const {
+  std::string contents = absl::StrCat(max_seeds_, "\n");
+  for (const auto& [key, value] : values_) {
+    const Player player = key.back();
+    absl::StrAppend(&contents, player);
+    for (int house = 0; house + 1 < key.size(); ++house) {
+      absl::StrAppend(&contents, " ", static_cast<int>(key[house]));
+    }
+    absl::StrAppend(&contents, " ", value, "\n");
+  }
+  file::WriteContentsToFile(filename, "w", contents);
+}
+
+void OwareEndgameTable::Load(const std::string& filename) {
+  const std::string contents = file::ReadContentsFromFile(filename, "r");
+  values_.clear();
+  bool first_line = true;
+  for (absl::string_view line :
+       absl::StrSplit(contents, '\n', absl::SkipEmpty())) {
+    if (first_line) {
+      int max_seeds;
+      SPIEL_CHECK_TRUE(absl::SimpleAtoi(line, &max_seeds));
+      SPIEL_CHECK_EQ(max_seeds, max_seeds_);
+      first_line = false;
+      continue;
+    }
+    const std::vector<absl::string_view> fields = absl::StrSplit(line, ' ');
+    SPIEL_CHECK_GE(fields.size(), 3);
+    int player;
+    SPIEL_CHECK_TRUE(absl::SimpleAtoi(fields[0], &player));
+    std::vector<int> seeds(fields.size() - 2);
+    for (int house = 0; house < seeds.size(); ++house) {
+      SPIEL_CHECK_TRUE(absl::SimpleAtoi(fields[house + 1], &seeds[house]));
+    }
+    int value;
+    SPIEL_CHECK_TRUE(absl::SimpleAtoi(fields.back(), &value));
+    values_[EncodeBoard(seeds, player)] = value;
+  }
+}
+
+}  // namespace oware
+}  // namespace open_spiel
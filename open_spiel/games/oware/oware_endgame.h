@@ -0,0 +1,100 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_GAMES_OWARE_OWARE_ENDGAME_H_
+#define OPEN_SPIEL_GAMES_OWARE_OWARE_ENDGAME_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/games/oware/oware.h"
+#include "open_spiel/spiel.h"
+
+// An endgame table for Oware. Positions with few seeds left on the board are
+// exactly solvable; the table stores, for every such position, the net number
+// of seeds the player to move will collect beyond the opponent under optimal
+// play. Since captured seeds never re-enter the game, the final score
+// difference of a game is the current score difference plus that net value,
+// which turns late-game evaluation into an O(1) lookup.
+//
+// Positions are solved layer by layer in increasing number of seeds on the
+// board: any capture strictly reduces that number (and resets the game's
+// repetition detection), so a position's continuation after a capture depends
+// only on the resulting board and can be read from the already-solved layers.
+// Within a layer, non-capturing lines are searched directly and end either in
+// a capture, in a starved position where the remaining seeds are collected,
+// or in a repetition. Repetition is history-dependent in the real game; the
+// table values each position as if it were reached freshly after a capture,
+// which is exact whenever the probed position follows a capture and the usual
+// approximation otherwise.
+
+namespace open_spiel {
+namespace oware {
+
+class OwareEndgameTable {
+ public:
+  explicit OwareEndgameTable(int max_seeds);
+
+  // Solves every position of the given game with at most max_seeds() seeds
+  // left on the board. The game must be an Oware game; its house count
+  // determines the positions enumerated.
+  void Build(std::shared_ptr<const Game> game);
+
+  // Returns the net number of seeds the player to move will collect beyond
+  // the opponent from here on under optimal play, or nullopt if the position
+  // is not in the table (more than max_seeds() seeds on the board).
+  absl::optional<int> Probe(const OwareState& state) const;
+
+  // Wraps the table as a value function for AlphaBetaSearch or
+  // ExpectiminimaxSearch. Positions covered by the table are valued exactly
+  // (as the eventual game outcome for `maximizing_player`); other positions
+  // are delegated to `fallback`, which must be provided unless the search
+  // horizon is known to stay within the table.
+  std::function<double(const State&)> MakeValueFunction(
+      Player maximizing_player,
+      std::function<double(const State&)> fallback = nullptr) const;
+
+  // Persists the table as text, one position per line.
+  void Save(const std::string& filename) const;
+  void Load(const std::string& filename);
+
+  int max_seeds() const { return max_seeds_; }
+  int size() const { return values_.size(); }
+
+ private:
+  // Exhaustive negamax over a constructed position; capture continuations are
+  // read from the already-solved lower layers.
+  int Solve(const OwareState& state) const;
+
+  // Enumerates all seed distributions summing to `remaining` over the houses
+  // from `house` on, solving each completed board for both players.
+  void EnumerateBoards(const std::shared_ptr<const Game>& game,
+                       std::vector<int>* seeds, int house, int remaining);
+
+  int LookupValue(const OwareBoard& board) const;
+
+  const int max_seeds_;
+  // Keyed by the per-house seed counts plus the player to move, one byte
+  // each; scores do not affect the net value and are not part of the key.
+  absl::flat_hash_map<std::string, int> values_;
+};
+
+}  // namespace oware
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_OWARE_OWARE_ENDGAME_H_
@@ -0,0 +1,118 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/oware/oware_endgame.h"
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "open_spiel/algorithms/minimax.h"
+#include "open_spiel/games/oware/oware.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace oware {
+namespace {
+
+// A game small enough (4 seeds in total) for the table to cover every
+// position, so search results can be compared against exhaustive search.
+std::shared_ptr<const Game> TinyGame() {
+  return LoadGame("oware", {{"num_houses_per_player", GameParameter(2)},
+                            {"num_seeds_per_house", GameParameter(1)}});
+}
+
+void TinyGameMatchesFullSearchTest() {
+  std::shared_ptr<const Game> game = TinyGame();
+  OwareEndgameTable table(/*max_seeds=*/4);
+  table.Build(game);
+  SPIEL_CHECK_GT(table.size(), 0);
+
+  std::unique_ptr<State> root = game->NewInitialState();
+  const double full_search_value =
+      algorithms::AlphaBetaSearch(*game, root.get(), /*value_function=*/nullptr,
+                                  /*depth_limit=*/game->MaxGameLength(),
+                                  /*maximizing_player=*/Player{0})
+          .first;
+  // The table alone (search of depth 0) must give the same value.
+  const double table_value =
+      algorithms::AlphaBetaSearch(*game, root.get(),
+                                  table.MakeValueFunction(Player{0}),
+                                  /*depth_limit=*/0,
+                                  /*maximizing_player=*/Player{0})
+          .first;
+  SPIEL_CHECK_EQ(table_value, full_search_value);
+}
+
+void ProbeCoversPlayTest() {
+  std::shared_ptr<const Game> game = TinyGame();
+  OwareEndgameTable table(/*max_seeds=*/4);
+  table.Build(game);
+
+  std::mt19937 rng(2306);
+  for (int sim = 0; sim < 20; ++sim) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (!state->IsTerminal()) {
+      const auto& oware_state = down_cast<const OwareState&>(*state);
+      SPIEL_CHECK_TRUE(table.Probe(oware_state).has_value());
+      std::vector<Action> actions = state->LegalActions();
+      state->ApplyAction(actions[rng() % actions.size()]);
+    }
+  }
+}
+
+void FallbackTest() {
+  // The default game starts with 24 seeds on the board, well outside a
+  // 3-seed table, so the root must be delegated to the fallback.
+  std::shared_ptr<const Game> game = LoadGame("oware");
+  OwareEndgameTable table(/*max_seeds=*/3);
+  table.Build(game);
+  SPIEL_CHECK_GT(table.size(), 0);
+
+  std::unique_ptr<State> root = game->NewInitialState();
+  const auto value_function = table.MakeValueFunction(
+      Player{0}, [](const State&) { return 0.25; });
+  SPIEL_CHECK_EQ(value_function(*root), 0.25);
+}
+
+void SaveLoadTest() {
+  std::shared_ptr<const Game> game = TinyGame();
+  OwareEndgameTable table(/*max_seeds=*/4);
+  table.Build(game);
+
+  const std::string filename =
+      file::GetTmpDir() + "/oware_endgame_test_table.txt";
+  table.Save(filename);
+  OwareEndgameTable loaded(/*max_seeds=*/4);
+  loaded.Load(filename);
+  SPIEL_CHECK_EQ(loaded.size(), table.size());
+  std::unique_ptr<State> root = game->NewInitialState();
+  const auto& root_state = down_cast<const OwareState&>(*root);
+  SPIEL_CHECK_EQ(loaded.Probe(root_state).value(),
+                 table.Probe(root_state).value());
+  file::Remove(filename);
+}
+
+}  // namespace
+}  // namespace oware
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::oware::TinyGameMatchesFullSearchTest();
+  open_spiel::oware::ProbeCoversPlayTest();
+  open_spiel::oware::FallbackTest();
+  open_spiel::oware::SaveLoadTest();
+}
@@ -15,6 +15,8 @@
 #include "open_spiel/games/pentago/pentago.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -147,6 +149,44 @@ uint64_t rotate_quadrant_ccw(uint64_t b, int quadrant) {
   return (b & ~m) | (((b & m) >> 2) & m) | (((b & m) << 6) & m);
 }
 
+// The whole-board symmetries. xy_to_bit starts every quadrant's ring at the
+// board's outer corner and runs clockwise, so rotating the whole board 90
+// degrees clockwise maps each ring, bit for bit, onto the ring of the next
+// quadrant: a rotation of the four 9-bit quadrant fields.
+uint64_t rotate_board_cw(uint64_t b) {
+  return ((b << 9) | (b >> 27)) & ((1ull << 36) - 1);
+}
+
+// Reflecting the board maps each ring onto the ring of the horizontally
+// opposite quadrant in reverse order, fixing the outer-corner bit. The
+// reversal is a pure permutation of the ring byte, precomputed for all 256
+// ring values.
+constexpr std::array<uint8_t, 256> reflect_ring_table() {
+  std::array<uint8_t, 256> table{};
+  for (int ring = 0; ring < 256; ++ring) {
+    uint8_t reflected = ring & 1;  // The outer-corner bit stays put.
+    for (int i = 1; i < 8; ++i) {
+      reflected |= ((ring >> i) & 1) << (8 - i);
+    }
+    table[ring] = reflected;
+  }
+  return table;
+}
+constexpr std::array<uint8_t, 256> reflect_ring = reflect_ring_table();
+
+// Mirror the board left-right: the quadrants swap horizontally and each ring
+// is reversed; the quadrant centers stay in place.
+uint64_t mirror_board(uint64_t b) {
+  constexpr int mirrored_quadrant[] = {1, 0, 3, 2};
+  uint64_t out = 0;
+  for (int q = 0; q < 4; ++q) {
+    uint64_t ring = (b >> (q * 9)) & 0xFF;
+    uint64_t center = (b >> (q * 9)) & 0x100;
+    out |= (reflect_ring[ring] | center) << (mirrored_quadrant[q] * 9);
+  }
+  return out;
+}
+
 }  // namespace
 
 PentagoState::PentagoState(std::shared_ptr<const Game> game,
@@ -235,6 +275,22 @@ PentagoPlayer PentagoState::get(int i) const {
               : board_[1] & xy_bit_mask[i] ? kPlayer2 : kPlayerNone);
 }
 
+std::pair<uint64_t, uint64_t> PentagoState::CanonicalKey() const {
+  uint64_t b0 = board_[0];
+  uint64_t b1 = board_[1];
+  std::pair<uint64_t, uint64_t> best(b0, b1);
+  for (int mirrored = 0; mirrored < 2; ++mirrored) {
+    for (int rotation = 0; rotation < 4; ++rotation) {
+      best = std::min(best, std::make_pair(b0, b1));
+      b0 = rotate_board_cw(b0);
+      b1 = rotate_board_cw(b1);
+    }
+    b0 = mirror_board(b0);
+    b1 = mirror_board(b1);
+  }
+  return best;
+}
+
 std::vector<double> PentagoState::Returns() const {
   if (outcome_ == kPlayer1) return {1, -1};
   if (outcome_ == kPlayer2) return {-1, 1};
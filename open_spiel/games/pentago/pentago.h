@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/spiel.h"
@@ -73,6 +74,14 @@ class PentagoState : public State {
   std::unique_ptr<State> Clone() const override;
   std::vector<Action> LegalActions() const override;
 
+  // A key identifying the position up to the 8 board symmetries: the
+  // lexicographically smallest pair of bitboards over all rotations and
+  // reflections of the board. Mirror and rotation images of a position share
+  // a key, so transposition tables and opening books keyed on it collapse
+  // the symmetric duplicates. The player to move is implied by the number of
+  // stones.
+  std::pair<uint64_t, uint64_t> CanonicalKey() const;
+
  protected:
   void DoApplyAction(Action action) override;
 
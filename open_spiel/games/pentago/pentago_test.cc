@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "open_spiel/games/pentago/pentago.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/tests/basic_tests.h"
@@ -33,8 +34,30 @@ void BasicPentagoTests() {
   testing::RandomSimTest(*LoadGame("pentago(ansi_color_output=True)"), 10);
 }
 
+void CanonicalKeyTest() {
+  std::shared_ptr<const Game> game = LoadGame("pentago");
+  // Actions are (y * kBoardSize + x) * kPossibleRotations + r; all use r=4,
+  // which rotates the (empty, in these lines) bottom-right quadrant.
+  auto key = [&game](const std::vector<Action>& actions) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    for (Action action : actions) state->ApplyAction(action);
+    return static_cast<PentagoState*>(state.get())->CanonicalKey();
+  };
+  // Mirror images share a key: a1 vs f1, and a two-stone line with both
+  // players' stones.
+  SPIEL_CHECK_TRUE(key({4}) == key({44}));
+  SPIEL_CHECK_TRUE(key({4, 116}) == key({44, 124}));
+  // Rotation images share a key: a1 vs a6.
+  SPIEL_CHECK_TRUE(key({4}) == key({244}));
+  // Positions in different orbits do not: a1 vs b1.
+  SPIEL_CHECK_FALSE(key({4}) == key({12}));
+}
+
 }  // namespace
 }  // namespace pentago
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::pentago::BasicPentagoTests(); }
+int main(int argc, char** argv) {
+  open_spiel::pentago::BasicPentagoTests();
+  open_spiel::pentago::CanonicalKeyTest();
+}
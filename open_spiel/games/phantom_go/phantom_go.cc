@@ -14,8 +14,10 @@
 
 #include "open_spiel/games/phantom_go/phantom_go.h"
 
+#include <algorithm>
 #include <random>
 #include <sstream>
+#include <vector>
 
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/games/phantom_go/phantom_go_board.h"
@@ -60,6 +62,11 @@ REGISTER_SPIEL_GAME(kGameType, Factory);
 
 RegisterSingleTensorObserver single_tensor(kGameType.short_name);
 
+// How often to redraw the hidden enemy stones before giving up on finding a
+// valid arrangement; orders of magnitude more than a sample ever needs in
+// practice.
+constexpr int kMaxResampleAttempts = 100;
+
 std::vector<VirtualPoint> HandicapStones(int num_handicap) {
   if (num_handicap < 2 || num_handicap > 9) return {};
 
@@ -267,6 +274,71 @@ std::unique_ptr<State> PhantomGoState::Clone() const {
   return std::unique_ptr<State>(new PhantomGoState(*this));
 }
 
+std::unique_ptr<State> PhantomGoState::ResampleFromInfostate(
+    int player_id, std::function<double()> rng) const {
+  const int board_size = board_.board_size();
+  const int board_points = board_size * board_size;
+  const GoColor opp_color = OppColor(PlayerToColor(player_id));
+  const std::array<int, 2> stone_count = board_.GetStoneCount();
+  const auto observation = board_.GetObservationByID(player_id);
+
+  // The observation pins down the player's own stones and every enemy stone
+  // revealed through collisions or captures; the remaining enemy stones hide
+  // among the points the player has no information about. The board keeps
+  // the observation up to date incrementally, so gathering the constraints
+  // is a single pass here.
+  std::vector<int>& unknown_points = resample_scratch_;
+  unknown_points.clear();
+  int hidden_stones = stone_count[ColorToPlayer(opp_color)];
+  for (int point = 0; point < board_points; ++point) {
+    if (observation[point] == opp_color) {
+      --hidden_stones;
+    } else if (observation[point] == GoColor::kEmpty) {
+      unknown_points.push_back(point);
+    }
+  }
+  SPIEL_CHECK_GE(hidden_stones, 0);
+  SPIEL_CHECK_LE(hidden_stones, static_cast<int>(unknown_points.size()));
+
+  for (int attempt = 0; attempt < kMaxResampleAttempts; ++attempt) {
+    // Choose the hidden enemy stones with a partial Fisher-Yates shuffle.
+    for (int i = 0; i < hidden_stones; ++i) {
+      int j = i + static_cast<int>(rng() * (unknown_points.size() - i));
+      j = std::min(j, static_cast<int>(unknown_points.size()) - 1);
+      std::swap(unknown_points[i], unknown_points[j]);
+    }
+
+    std::unique_ptr<PhantomGoState> sample(
+        new PhantomGoState(game_, board_size, komi_, handicap_));
+    auto place = [&sample, board_size](int point, GoColor color) {
+      VirtualPoint p = VirtualPointFromBoardPoint(point, board_size);
+      if (sample->board_.PointColor(p) != color) {
+        sample->board_.PlayMove(p, color);
+      }
+    };
+    for (int point = 0; point < board_points; ++point) {
+      if (observation[point] != GoColor::kEmpty) {
+        place(point, observation[point]);
+      }
+    }
+    for (int i = 0; i < hidden_stones; ++i) {
+      place(unknown_points[i], opp_color);
+    }
+
+    // Captures and rejected placements only ever lower the stone counts, so
+    // matching counts mean the board reproduced the constraints exactly;
+    // arrangements that leave a chain without liberties are redrawn.
+    if (sample->board_.GetStoneCount() == stone_count) {
+      sample->to_play_ = to_play_;
+      return sample;
+    }
+  }
+
+  // No valid arrangement found (the hidden stones are tightly constrained);
+  // the true state is itself consistent with the player's observation.
+  return Clone();
+}
+
 void PhantomGoState::UndoAction(Player player, Action action) {
   // We don't have direct undo functionality, but copying the board and
   // replaying all actions is still pretty fast (> 1 million undos/second).
@@ -107,6 +107,16 @@ class PhantomGoState : public State {
   std::unique_ptr<State> Clone() const override;
   void UndoAction(Player player, Action action) override;
 
+  // Samples a board consistent with the player's observation: the player's
+  // own stones and the enemy stones revealed through collisions or captures
+  // are fixed, and the remaining enemy stones are placed uniformly among
+  // the points the player has no information about. The sampled state
+  // reproduces the position and stone counts; the move-by-move observation
+  // history of the players is not reconstructed. Falls back to the true
+  // state if no valid arrangement is found.
+  std::unique_ptr<State> ResampleFromInfostate(
+      int player_id, std::function<double()> rng) const override;
+
   const PhantomGoBoard& board() const { return board_; }
 
  protected:
@@ -134,6 +144,10 @@ class PhantomGoState : public State {
   const int max_game_length_;
   GoColor to_play_;
   bool superko_;
+
+  // Scratch space for ResampleFromInfostate, reused across the many calls a
+  // search makes so each sample avoids reallocating the candidate list.
+  mutable std::vector<int> resample_scratch_;
 };
 
 class PhantomGoGame : public Game {
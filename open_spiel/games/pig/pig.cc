@@ -222,23 +222,12 @@ std::vector<Action> PigState::LegalActions() const {
 
 std::vector<std::pair<Action, double>> PigState::ChanceOutcomes() const {
   SPIEL_CHECK_TRUE(IsChanceNode());
-  std::vector<std::pair<Action, double>> outcomes;
-
-  if (piglet_) {
-    // Chance outcomes are labelled 0 or 1, corresponding to rolling 1 or not 1
-    // respectively
-    outcomes.reserve(2);
-    outcomes.push_back(std::make_pair(0, 1.0 / dice_outcomes_));
-    outcomes.push_back(std::make_pair(1, 1.0 - (1.0 / dice_outcomes_)));
-  } else {
-    // Chance outcomes are labelled 0+, corresponding to rolling 1+x.
-    outcomes.reserve(dice_outcomes_);
-    for (int i = 0; i < dice_outcomes_; i++) {
-      outcomes.push_back(std::make_pair(i, 1.0 / dice_outcomes_));
-    }
-  }
+  return *ChanceOutcomeTable();
+}
 
-  return outcomes;
+const ActionsAndProbs* PigState::ChanceOutcomeTable() const {
+  if (!IsChanceNode()) return nullptr;
+  return down_cast<const PigGame&>(*game_).chance_outcome_table();
 }
 
 std::string PigState::ToString() const {
@@ -258,7 +247,23 @@ PigGame::PigGame(const GameParameters& params)
       horizon_(ParameterValue<int>("horizon")),
       num_players_(ParameterValue<int>("players")),
       win_score_(ParameterValue<int>("winscore")),
-      piglet_(ParameterValue<bool>("piglet")) {}
+      piglet_(ParameterValue<bool>("piglet")) {
+  ActionsAndProbs outcomes;
+  if (piglet_) {
+    // Chance outcomes are labelled 0 or 1, corresponding to rolling 1 or not 1
+    // respectively
+    outcomes.reserve(2);
+    outcomes.push_back(std::make_pair(0, 1.0 / dice_outcomes_));
+    outcomes.push_back(std::make_pair(1, 1.0 - (1.0 / dice_outcomes_)));
+  } else {
+    // Chance outcomes are labelled 0+, corresponding to rolling 1+x.
+    outcomes.reserve(dice_outcomes_);
+    for (int i = 0; i < dice_outcomes_; i++) {
+      outcomes.push_back(std::make_pair(i, 1.0 / dice_outcomes_));
+    }
+  }
+  chance_outcome_table_ = MakeChanceOutcomeTable(std::move(outcomes));
+}
 
 }  // namespace pig
 }  // namespace open_spiel
@@ -59,6 +59,7 @@ class PigState : public State {
   Player CurrentPlayer() const override;
   std::string ActionToString(Player player, Action move_id) const override;
   std::vector<std::pair<Action, double>> ChanceOutcomes() const override;
+  const ActionsAndProbs* ChanceOutcomeTable() const override;
   std::string ToString() const override;
   bool IsTerminal() const override;
   std::vector<double> Returns() const override;
@@ -103,6 +104,11 @@ class PigGame : public Game {
   }
   int MaxChanceOutcomes() const override { return dice_outcomes_; }
 
+  // Every chance node rolls the same die.
+  const ActionsAndProbs* chance_outcome_table() const {
+    return chance_outcome_table_;
+  }
+
   // There is arbitrarily chosen number to ensure the game is finite.
   int MaxGameLength() const override { return horizon_; }
 
@@ -133,6 +139,9 @@ class PigGame : public Game {
 
   // Whether Piglet variant is enabled (always move only 1 step forward)
   bool piglet_;
+
+  // The single die-roll distribution; owned by the base Game.
+  const ActionsAndProbs* chance_outcome_table_;
 };
 
 }  // namespace pig
@@ -15,6 +15,7 @@
 #include "open_spiel/games/quoridor/quoridor.h"
 
 #include <algorithm>
+#include <cstdlib>
 #include <functional>
 #include <memory>
 #include <queue>
@@ -327,6 +328,21 @@ bool QuoridorState::IsValidWall(Move m, SearchState* search_state) const {
        IsWall(m + offset + offset.rotate_right())));
   if (count <= 1) return true;
 
+  // A wall can only cut a player off if it separates the cells on its two
+  // sides. Try to reconnect both of the wall's crossings with a search that
+  // pretends the wall is placed: if both detours exist, reachability is
+  // unchanged for every player, so the wall is legal. The search stays local
+  // to the wall, which makes it far cheaper than the per-player goal
+  // searches below; those are kept as the exact fallback for walls that do
+  // seal off a region.
+  Move far_wall = m + offset * 2;
+  Offset cross = (m.IsHorizontalWall() ? Offset(0, 1) : Offset(1, 0));
+  if (SearchDetour(m - cross, m + cross, m, far_wall, search_state) &&
+      SearchDetour(far_wall - cross, far_wall + cross, m, far_wall,
+                   search_state)) {
+    return true;
+  }
+
   // Do a full search to verify both players can get to their respective goals.
   bool pathExists = true;
   for (int i = 0; i < num_players_; ++i) {
@@ -369,6 +385,34 @@ bool QuoridorState::SearchEndZone(QuoridorPlayer p, Move wall1, Move wall2,
   return false;
 }
 
+// Search for a path between the two cells separated by one crossing of a
+// candidate wall, treating the wall as placed. Any path through the wall can
+// be rerouted along such a detour, so if both crossings have one, the wall
+// cuts no path at all.
+bool QuoridorState::SearchDetour(Move start, Move target, Move wall1,
+                                 Move wall2, SearchState* search_state) const {
+  search_state->ResetSearchQueue();
+  Offset dir(1, 0);  // Direction is arbitrary. Queue will make it fast.
+  search_state->Push(0, start);
+  while (!search_state->IsEmpty()) {
+    Move c = search_state->Pop();
+    for (int i = 0; i < 4; ++i) {
+      Move wall = c + dir;
+      if (!IsWall(wall) && wall != wall1 && wall != wall2) {
+        Move move = c + dir * 2;
+        if (move == target) {
+          return true;
+        }
+        // Sort by distance to the target in a min-heap.
+        search_state->Push(
+            std::abs(target.x - move.x) + std::abs(target.y - move.y), move);
+      }
+      dir = dir.rotate_left();
+    }
+  }
+  return false;
+}
+
 void QuoridorState::SearchShortestPath(QuoridorPlayer p,
                                        SearchState* search_state) const {
   search_state->ResetSearchQueue();
@@ -599,6 +643,7 @@ void QuoridorState::DoApplyAction(Action action) {
     SetPlayer(move + offset * 2, kPlayerWall, kPlayerNone);
     wall_count_[current_player_] -= 1;
   } else {
+    prev_pawn_loc_.push_back(player_loc_[current_player_]);
     SetPlayer(player_loc_[current_player_], kPlayerNone, current_player_);
     SetPlayer(move, current_player_, kPlayerNone);
     player_loc_[current_player_] = move;
@@ -626,6 +671,38 @@ void QuoridorState::DoApplyAction(Action action) {
   current_player_ = players_[current_player_index_];
 }
 
+void QuoridorState::UndoAction(Player player, Action action) {
+  SPIEL_CHECK_FALSE(history_.empty());
+  SPIEL_CHECK_EQ(history_.back().action, action);
+
+  // Restore the acting player before touching the board.
+  current_player_index_ -= 1;
+  if (current_player_index_ < 0) current_player_index_ = num_players_ - 1;
+  current_player_ = players_[current_player_index_];
+
+  Move move = ActionToMove(action);
+  if (move.IsWall()) {
+    Offset offset = (move.IsHorizontalWall() ? Offset(1, 0) : Offset(0, 1));
+    SetPlayer(move + offset * 0, kPlayerNone, kPlayerWall);
+    SetPlayer(move + offset * 1, kPlayerNone, kPlayerWall);
+    SetPlayer(move + offset * 2, kPlayerNone, kPlayerWall);
+    wall_count_[current_player_] += 1;
+  } else {
+    SPIEL_CHECK_FALSE(prev_pawn_loc_.empty());
+    Move prev = prev_pawn_loc_.back();
+    prev_pawn_loc_.pop_back();
+    SetPlayer(player_loc_[current_player_], kPlayerNone, current_player_);
+    SetPlayer(prev, current_player_, kPlayerNone);
+    player_loc_[current_player_] = prev;
+  }
+
+  // The move being undone was legal, so the game was not over before it.
+  outcome_ = kPlayerNone;
+  --moves_made_;
+  history_.pop_back();
+  --move_number_;
+}
+
 std::unique_ptr<State> QuoridorState::Clone() const {
   return std::unique_ptr<State>(new QuoridorState(*this));
 }
@@ -108,6 +108,7 @@ class QuoridorState : public State {
   void ObservationTensor(Player player,
                          absl::Span<float> values) const override;
   std::unique_ptr<State> Clone() const override;
+  void UndoAction(Player player, Action action) override;
   std::vector<Action> LegalActions() const override;
   int NumCellStates() const { return num_players_ + 1; }
 
@@ -141,6 +142,8 @@ class QuoridorState : public State {
   bool IsValidWall(Move m, SearchState*) const;
   bool SearchEndZone(QuoridorPlayer p, Move wall1, Move wall2,
                      SearchState*) const;
+  bool SearchDetour(Move start, Move target, Move wall1, Move wall2,
+                    SearchState*) const;
   void SearchShortestPath(QuoridorPlayer p, SearchState* search_state) const;
 
   std::vector<QuoridorPlayer> board_;
@@ -152,6 +155,10 @@ class QuoridorState : public State {
   int current_player_index_ = 0;
   QuoridorPlayer outcome_ = kPlayerNone;
   int moves_made_ = 0;
+  // The pawn's previous location for each pawn move played so far (wall moves
+  // are fully reversible from the action alone), enabling incremental
+  // UndoAction for clone-free search.
+  std::vector<Move> prev_pawn_loc_;
   const int board_size_;
   const int board_diameter_;
   const bool ansi_color_output_;
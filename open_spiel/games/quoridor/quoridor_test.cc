@@ -28,6 +28,7 @@ void BasicQuoridorTests() {
   testing::LoadGameTest("quoridor(board_size=5)");
   testing::NoChanceOutcomesTest(*LoadGame("quoridor()"));
   testing::RandomSimTest(*LoadGame("quoridor"), 10);
+  testing::RandomSimTestWithUndo(*LoadGame("quoridor(board_size=5)"), 3);
 
   for (int i = 5; i <= 13; i++) {
     testing::RandomSimTest(
@@ -55,29 +55,12 @@ std::shared_ptr<const Game> Factory(const GameParameters& params) {
 
 REGISTER_SPIEL_GAME(kGameType, Factory)
 
-chess::ObservationTable ComputeObservationTable(const chess::ChessBoard& board,
-                                                chess::Color color,
-                                                int sense_location,
-                                                int sense_size) {
-  const int board_size = board.BoardSize();
-  chess::ObservationTable observability_table{false};
-
-  // Player pieces.
-  for (int8_t y = 0; y < board_size; ++y) {
-    for (int8_t x = 0; x < board_size; ++x) {
-      chess::Square sq{x, y};
-      const auto& piece = board.at(sq);
-      if (piece.color == color) {
-        size_t index = chess::SquareToIndex(sq, board_size);
-        observability_table[index] = true;
-      }
-    }
-  }
-
+// Marks all squares under the sense window as observable.
+void AddSenseWindow(int board_size, int sense_location, int sense_size,
+                    chess::ObservationTable* observability_table) {
   // No sense window specified.
-  if (sense_location < 0) return observability_table;
+  if (sense_location < 0) return;
 
-  // All pieces under the sense window.
   int inner_size = board_size - sense_size + 1;
   chess::Square sense_sq = chess::IndexToSquare(sense_location, inner_size);
   SPIEL_DCHECK_LE(sense_sq.x + sense_size, board_size);
@@ -86,11 +69,25 @@ chess::ObservationTable ComputeObservationTable(const chess::ChessBoard& board,
     for (int8_t y = sense_sq.y; y < sense_sq.y + sense_size; ++y) {
       const chess::Square sq{x, y};
       size_t index = chess::SquareToIndex(sq, board_size);
-      observability_table[index] = true;
+      (*observability_table)[index] = true;
     }
   }
+}
 
-  return observability_table;
+// Squares whose occupancy a move can change: the source and destination, the
+// square of a pawn captured en passant and, for castling, the whole home rank
+// (the rook's source square depends on pre-move castling rights).
+std::vector<chess::Square> SquaresTouchedByMove(const chess::Move& move,
+                                                int board_size) {
+  if (move == chess::kPassMove) return {};
+  std::vector<chess::Square> squares{
+      move.from, move.to, chess::Square{move.to.x, move.from.y}};
+  if (move.is_castling) {
+    for (int8_t x = 0; x < board_size; ++x) {
+      squares.push_back(chess::Square{x, move.from.y});
+    }
+  }
+  return squares;
 }
 
 bool ObserverHasString(IIGObservationType iig_obs_type) {
@@ -173,8 +170,12 @@ class RbcObserver : public Observer {
             // perceive only results of the last sensing.
             : kSenseLocationNonSpecified;
     const chess::ChessBoard& board = state.Board();
-    chess::ObservationTable observability_table = ComputeObservationTable(
-        board, color, sense_location, game.sense_size());
+    // The state keeps the friendly-piece part of the table up to date
+    // incrementally; only the sense window needs to be added here.
+    chess::ObservationTable observability_table =
+        state.friendly_tables_[chess::ToInt(color)];
+    AddSenseWindow(game.board_size(), sense_location, game.sense_size(),
+                   &observability_table);
     const int board_size = game.board_size();
     std::string str = "";
 
@@ -315,20 +316,9 @@ class RbcObserver : public Observer {
 
   void WritePublicInfoTensor(const RbcState& state,
                              Allocator* allocator) const {
-    // Compute number of pieces of each player.
+    // The state maintains the piece counts incrementally.
     const int board_size = state.game()->board_size();
-    std::array<int, 2> num_pieces = {0, 0};
-    for (int x = 0; x < board_size; ++x) {
-      for (int y = 0; y < board_size; ++y) {
-        for (int pl = 0; pl < 2; ++pl) {
-          num_pieces[pl] +=
-              state.Board().IsFriendly(
-                  chess::Square{static_cast<int8_t>(x),
-                                static_cast<int8_t>(y)},
-                  static_cast<chess::Color>(pl));
-        }
-      }
-    }
+    const std::array<int, 2>& num_pieces = state.num_pieces_;
 
     WriteScalar(num_pieces[0], 0, board_size * 2, "pieces_black", allocator);
     WriteScalar(num_pieces[1], 0, board_size * 2, "pieces_white", allocator);
@@ -351,6 +341,24 @@ RbcState::RbcState(std::shared_ptr<const Game> game, int board_size,
       phase_(MovePhase::kSensing) {
   SPIEL_CHECK_TRUE(&current_board_);
   repetitions_[current_board_.HashValue()] = 1;
+  RecomputeObservationCaches();
+}
+
+void RbcState::RecomputeObservationCaches() {
+  num_pieces_ = {0, 0};
+  for (int color = 0; color < 2; ++color) {
+    friendly_tables_[color].fill(false);
+  }
+  for (int8_t y = 0; y < BoardSize(); ++y) {
+    for (int8_t x = 0; x < BoardSize(); ++x) {
+      const chess::Square square{x, y};
+      const chess::Color color = Board().at(square).color;
+      if (color == chess::Color::kEmpty) continue;
+      friendly_tables_[chess::ToInt(color)]
+                      [chess::SquareToIndex(square, BoardSize())] = true;
+      ++num_pieces_[chess::ToInt(color)];
+    }
+  }
 }
 
 void RbcState::DoApplyAction(Action action) {
@@ -416,6 +424,19 @@ void RbcState::DoApplyAction(Action action) {
     moves_history_.push_back(move);
     Board().ApplyMove(move);
 
+    // Only the squares the move touched can have changed visibility.
+    for (const chess::Square& square :
+         SquaresTouchedByMove(move, BoardSize())) {
+      const size_t index = chess::SquareToIndex(square, BoardSize());
+      for (int color = 0; color < 2; ++color) {
+        const bool friendly =
+            Board().IsFriendly(square, static_cast<chess::Color>(color));
+        num_pieces_[color] += static_cast<int>(friendly) -
+                              static_cast<int>(friendly_tables_[color][index]);
+        friendly_tables_[color][index] = friendly;
+      }
+    }
+
     ++repetitions_[current_board_.HashValue()];
     phase_ = MovePhase::kSensing;
   }
@@ -506,6 +527,7 @@ void RbcState::UndoAction(Player player, Action action) {
     for (const chess::Move& move : moves_history_) {
       current_board_.ApplyMove(move);
     }
+    RecomputeObservationCaches();
   }
 }
 
@@ -196,6 +196,10 @@ class RbcState : public State {
   // IsTerminal(), which is also called by LegalActions().
   void MaybeGenerateLegalActions() const;
 
+  // Rebuilds friendly_tables_ and num_pieces_ from the current board. Used
+  // when the board cannot be updated incrementally (construction and undo).
+  void RecomputeObservationCaches();
+
   absl::optional<std::vector<double>> MaybeFinalReturns() const;
 
   // We have to store every move made to check for repetitions and to implement
@@ -214,6 +218,14 @@ class RbcState : public State {
                                         kSenseLocationNonSpecified};
   bool move_captured_ = false;
   bool illegal_move_attempted_ = false;
+  // Per-colour table of the squares occupied by that colour's pieces - the
+  // always-visible part of an RBC observation (the sense window is added on
+  // top by the observer). Maintained incrementally as moves are applied (only
+  // the squares a move touches are refreshed) so that observers don't have to
+  // rescan the whole board. Indexed by chess::ToInt(color).
+  std::array<chess::ObservationTable, 2> friendly_tables_;
+  // Number of pieces of each colour, maintained alongside friendly_tables_.
+  std::array<int, 2> num_pieces_ = {0, 0};
 
   // RepetitionTable records how many times the given hash exists in the history
   // stack (including the current board).
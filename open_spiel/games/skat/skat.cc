@@ -34,7 +34,7 @@ const GameType kGameType{/*short_name=*/"skat",
                          GameType::RewardModel::kTerminal,
                          /*max_num_players=*/3,
                          /*min_num_players=*/3,
-                         /*provides_information_state_string=*/false,
+                         /*provides_information_state_string=*/true,
                          /*provides_information_state_tensor=*/false,
                          /*provides_observation_string=*/true,
                          /*provides_observation_tensor=*/true,
@@ -239,6 +239,9 @@ SkatState::SkatState(std::shared_ptr<const Game> game)
       : State(game) {
   card_locations_.fill(kDeck);
   player_bids_.fill(kPass);
+  for (int pl = 0; pl < kNumPlayers; ++pl) {
+    info_state_strings_[pl] = absl::StrCat("Pos:", pl, "|Hand:");
+  }
 }
 
 std::string SkatState::ActionToString(Player player, Action action_id) const {
@@ -391,6 +394,11 @@ void SkatState::ApplyDealAction(int card) {
   } else if (deal_round == 9 || deal_round == 10) {
     card_locations_[card] = kSkat;
   }
+  // Only the receiving player observes the card.
+  if (card_locations_[card] >= kHand0 && card_locations_[card] <= kHand2) {
+    absl::StrAppend(&info_state_strings_[card_locations_[card] - kHand0],
+                    CardToString(card));
+  }
   if (deal_round == kNumCards - 1) {
     current_player_ = 0;
     phase_ = kBidding;
@@ -401,6 +409,11 @@ void SkatState::ApplyBiddingAction(int game_type) {
   // Simplified bidding as first come first serve. Players can say if they want
   // to play or not on a first come first serve basis. Currently, the solo
   // player is not able to touch the Skat.
+  // Bids are public.
+  for (int pl = 0; pl < kNumPlayers; ++pl) {
+    absl::StrAppend(&info_state_strings_[pl], "|Bid:", current_player_, ":",
+                    SkatGameTypeToString(SkatGameType(game_type)));
+  }
   player_bids_[current_player_] = game_type;
   if (game_type == kPass) {
     if (current_player_ < 2) {
@@ -417,10 +430,12 @@ void SkatState::EndBidding(Player winner, SkatGameType game_type) {
     solo_player_ = winner;
     current_player_ = winner;
     game_type_ = game_type;
-    // Winner takes up Skat cards.
+    // Winner takes up Skat cards; only they observe which cards these are.
+    absl::StrAppend(&info_state_strings_[winner], "|Skat:");
     for (int card = 0; card < kNumCards; card++) {
       if (card_locations_[card] == kSkat) {
         card_locations_[card] = PlayerToLocation(winner);
+        absl::StrAppend(&info_state_strings_[winner], CardToString(card));
       }
     }
     phase_ = kDiscardCards;
@@ -439,6 +454,9 @@ void SkatState::ApplyDiscardCardsAction(int card) {
   SPIEL_CHECK_TRUE(current_player_ == solo_player_);
   SPIEL_CHECK_TRUE(card_locations_[card] == PlayerToLocation(solo_player_));
   card_locations_[card] = kSkat;
+  // Discards are only observed by the solo player.
+  absl::StrAppend(&info_state_strings_[solo_player_],
+                  "|Discard:", CardToString(card));
 
   if (CardsInSkat() == 2) {
     phase_ = kPlay;
@@ -448,6 +466,11 @@ void SkatState::ApplyDiscardCardsAction(int card) {
 
 void SkatState::ApplyPlayAction(int card) {
   SPIEL_CHECK_TRUE(card_locations_[card] == PlayerToLocation(current_player_));
+  // Plays are public.
+  for (int pl = 0; pl < kNumPlayers; ++pl) {
+    absl::StrAppend(&info_state_strings_[pl], "|Play:", current_player_, ":",
+                    CardToString(card));
+  }
   card_locations_[card] = kTrick;
   if (num_cards_played_ == 0) {
     CurrentTrick() = Trick(current_player_);
@@ -788,6 +811,12 @@ std::string SkatState::ObservationString(Player player) const {
   return rv;
 }
 
+std::string SkatState::InformationStateString(Player player) const {
+  SPIEL_CHECK_GE(player, 0);
+  SPIEL_CHECK_LT(player, num_players_);
+  return info_state_strings_[player];
+}
+
 // ********************************** SkatGame *********************************
 
 SkatGame::SkatGame(const GameParameters& params)
@@ -158,6 +158,7 @@ class SkatState : public State {
   std::string ObservationString(Player player) const override;
   void ObservationTensor(Player player,
                          absl::Span<float> values) const override;
+  std::string InformationStateString(Player player) const override;
 
  protected:
   void DoApplyAction(Action action) override;
@@ -206,6 +207,12 @@ class SkatState : public State {
   int points_solo_ = 0;
   int points_team_ = 0;
   std::vector<double> returns_ = std::vector<double>(kNumPlayers);
+  // Per-player information state key, appended to by the Apply* methods as
+  // each player observes an action (own dealt cards, public bids and plays,
+  // and the Skat pickup / discards for the solo player). Keeping the key
+  // incremental makes InformationStateString a copy instead of a rebuild,
+  // which tabular algorithms call at every node.
+  std::array<std::string, kNumPlayers> info_state_strings_;
 };
 
 class SkatGame : public Game {
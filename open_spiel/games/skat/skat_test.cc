@@ -14,6 +14,13 @@
 
 #include "open_spiel/games/skat/skat.h"
 
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/tests/basic_tests.h"
 
@@ -28,10 +35,32 @@ void BasicSkatTests() {
   testing::RandomSimTest(*LoadGame("skat"), 10);
 }
 
+void InformationStateStringTest() {
+  std::shared_ptr<const Game> game = LoadGame("skat");
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::mt19937 rng(1234);
+  while (!state->IsTerminal()) {
+    if (!state->IsChanceNode()) {
+      // Keys are per-player and grow with the player's observations.
+      for (Player pl = 0; pl < kNumPlayers; ++pl) {
+        std::string info_state = state->InformationStateString(pl);
+        SPIEL_CHECK_FALSE(info_state.empty());
+      }
+    }
+    std::vector<Action> actions = state->LegalActions();
+    state->ApplyAction(
+        actions[absl::Uniform<int>(rng, 0, actions.size())]);
+  }
+  // Players observed different private cards, so keys must differ.
+  SPIEL_CHECK_NE(state->InformationStateString(0),
+                 state->InformationStateString(1));
+}
+
 }  // namespace
 }  // namespace skat
 }  // namespace open_spiel
 
 int main(int argc, char **argv) {
   open_spiel::skat::BasicSkatTests();
+  open_spiel::skat::InformationStateStringTest();
 }
@@ -548,6 +548,17 @@ bool IsKey(const Element &element) {
          element == kElKeyGreen || element == kElKeyYellow;
 }
 
+// Check if the element has a dynamics function, i.e. can change on its own
+// during a scan (everything else only changes when written to)
+bool IsDynamic(const Element &element) {
+  return element == kElStone || element == kElStoneFalling ||
+         element == kElDiamond || element == kElDiamondFalling ||
+         element == kElNut || element == kElNutFalling || element == kElBomb ||
+         element == kElBombFalling || element == kElExitClosed ||
+         element == kElBlob || IsButterfly(element) || IsFirefly(element) ||
+         IsOrange(element) || IsMagicWall(element) || IsExplosion(element);
+}
+
 }  // namespace
 
 // ---------- Game dynamic function ----------
@@ -594,6 +605,8 @@ void StonesNGemsState::MoveItem(int index, int action) {
   grid_.elements[new_index].has_updated = true;
   grid_.elements[index] = kElEmpty;
   grid_.ids[index] = ++id_counter_;
+  MarkCellUpdated(new_index);
+  MarkCellUpdated(index);
 }
 
 // Set the new index to the given element
@@ -602,6 +615,18 @@ void StonesNGemsState::SetItem(int index, Element element, int id, int action) {
   grid_.elements[new_index] = element;
   grid_.ids[new_index] = id;
   grid_.elements[new_index].has_updated = true;
+  MarkCellUpdated(new_index);
+}
+
+// Record the write to the given index, so the has_updated flags can be reset
+// without a full sweep, and track whether the cell needs visiting on scans
+void StonesNGemsState::MarkCellUpdated(int index) {
+  updated_cells_.push_back(index);
+  if (IsDynamic(grid_.elements[index])) {
+    active_cells_.insert(index);
+  } else {
+    active_cells_.erase(index);
+  }
 }
 
 // Get the item after applying the action to the index
@@ -1006,10 +1031,11 @@ void StonesNGemsState::StartScan() {
   current_reward_ = 0;
   blob_size_ = 0;
   blob_enclosed_ = true;
-  // Reset element flags
-  for (auto &e : grid_.elements) {
-    e.has_updated = false;
+  // Reset element flags; only cells written since the last scan can be set
+  for (const int index : updated_cells_) {
+    grid_.elements[index].has_updated = false;
   }
+  updated_cells_.clear();
 }
 
 void StonesNGemsState::EndScan() {
@@ -1033,8 +1059,14 @@ void StonesNGemsState::EndScan() {
 
 void StonesNGemsState::DoApplyAction(Action move) {
   if (cur_player_ == kChancePlayerId) {
-    // Check each cell and apply respective dynamics function
-    for (int index = 0; index < grid_.num_cols * grid_.num_rows; ++index) {
+    // Check each active cell and apply respective dynamics function. Only
+    // cells holding an element with a dynamics function can change, and the
+    // snapshot is visited in the same ascending order as a full-grid sweep
+    // would visit it; cells written mid-scan are flagged has_updated and
+    // skipped, exactly as the full sweep would skip them.
+    const std::vector<int> scan_cells(active_cells_.begin(),
+                                      active_cells_.end());
+    for (const int index : scan_cells) {
       Element &e = grid_.elements[index];
       if (e.has_updated) {
         continue;
@@ -1184,7 +1216,15 @@ StonesNGemsState::StonesNGemsState(
       grid_(grid),
       obs_show_ids_(obs_show_ids),
       id_counter_(id_counter),
-      cur_player_(player) {}
+      cur_player_(player) {
+  // Collect the cells which initially hold an element with a dynamics
+  // function; MoveItem/SetItem keep the set in sync from here on
+  for (std::size_t index = 0; index < grid_.elements.size(); ++index) {
+    if (IsDynamic(grid_.elements[index])) {
+      active_cells_.insert(active_cells_.end(), static_cast<int>(index));
+    }
+  }
+}
 
 // ------ Game -------
 
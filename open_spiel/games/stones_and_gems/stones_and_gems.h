@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_GAMES_STONES_AND_GEMS_H_
 
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -290,6 +291,7 @@ class StonesNGemsState : public State {
   void MoveItem(int index, int action);
   void SetItem(int index, Element element, int id,
                int action = Directions::kNone);
+  void MarkCellUpdated(int index);
   Element GetItem(int index, int action = Directions::kNone) const;
   bool IsTypeAdjacent(int index, Element element) const;
 
@@ -338,6 +340,14 @@ class StonesNGemsState : public State {
   bool obs_show_ids_;     // Flag to show IDs in observation tensor
   int id_counter_;        // Next ID tracker
 
+  // Cells holding an element with a dynamics function, kept in sync with
+  // every write to the grid so each scan only visits cells which can change
+  // (ordered, as the scan must mirror the ascending full-grid sweep).
+  std::set<int> active_cells_;
+  // Cells written since the last StartScan(), so the has_updated flags can
+  // be reset without sweeping the whole grid.
+  std::vector<int> updated_cells_;
+
   Player cur_player_ = -1;  // Player to play.
 };
 
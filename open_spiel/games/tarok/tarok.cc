@@ -191,6 +191,13 @@ std::vector<std::vector<Action>> TarokState::TalonSets() const {
 std::vector<Action> TarokState::TrickCards() const { return trick_cards_; }
 
 std::vector<Action> TarokState::LegalActions() const {
+  if (!cached_legal_actions_) {
+    cached_legal_actions_ = ComputeLegalActions();
+  }
+  return *cached_legal_actions_;
+}
+
+std::vector<Action> TarokState::ComputeLegalActions() const {
   // all card actions are encoded as 0, 1, ..., 52, 53 and correspond to card
   // indices wrt. tarok_parent_game_->card_deck_, card actions are returned:
   //   - in the king calling phase
@@ -480,6 +487,7 @@ void TarokState::DoApplyAction(Action action_id) {
     case GamePhase::kFinished:
       SpielFatalError("Calling DoApplyAction in a terminal state.");
   }
+  cached_legal_actions_.reset();
 }
 
 void TarokState::DoApplyActionInCardDealing() {
@@ -137,6 +137,7 @@ class TarokState : public State {
  private:
   friend class TarokGame;
 
+  std::vector<Action> ComputeLegalActions() const;
   std::vector<Action> LegalActionsInBidding() const;
   std::vector<Action> LegalActionsInTalonExchange() const;
   std::vector<Action> LegalActionsInTricksPlaying() const;
@@ -209,6 +210,12 @@ class TarokState : public State {
   std::vector<Action> trick_cards_;
   Player captured_mond_player_ = kInvalidPlayer;
   std::vector<std::string> players_info_states_;
+  // Legal actions computed at most once per move: the rule checks (bidding
+  // constraints, talon handling, trump obligations) only depend on state
+  // mutated by DoApplyAction, which resets the cache. This also lets
+  // DoApplyAction's own legality check reuse the vector the searcher just
+  // requested instead of recomputing it.
+  mutable absl::optional<std::vector<Action>> cached_legal_actions_;
 };
 
 std::ostream& operator<<(std::ostream& os, const GamePhase& game_phase);
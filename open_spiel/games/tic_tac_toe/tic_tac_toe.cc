@@ -15,6 +15,8 @@
 #include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -93,7 +95,7 @@ bool BoardHasLine(const std::array<CellState, kNumCells>& board,
 }
 
 void TicTacToeState::DoApplyAction(Action move) {
-  SPIEL_CHECK_EQ(board_[move], CellState::kEmpty);
+  SPIEL_HOT_CHECK_EQ(board_[move], CellState::kEmpty);
   board_[move] = PlayerToState(CurrentPlayer());
   if (HasLine(current_player_)) {
     outcome_ = current_player_;
@@ -193,6 +195,34 @@ std::unique_ptr<State> TicTacToeState::Clone() const {
   return std::unique_ptr<State>(new TicTacToeState(*this));
 }
 
+namespace {
+// The flat core captured by the snapshot hooks; see State::SnapshotTo.
+struct Snapshot {
+  std::array<CellState, kNumCells> board;
+  Player current_player;
+  Player outcome;
+  int num_moves;
+  int move_number;
+};
+}  // namespace
+
+void TicTacToeState::SnapshotTo(std::string* buffer) const {
+  const Snapshot snapshot = {board_, current_player_, outcome_, num_moves_,
+                             MoveNumber()};
+  buffer->append(reinterpret_cast<const char*>(&snapshot), sizeof(snapshot));
+}
+
+void TicTacToeState::RestoreSnapshot(absl::string_view buffer) {
+  SPIEL_CHECK_EQ(buffer.size(), sizeof(Snapshot));
+  Snapshot snapshot;
+  std::memcpy(&snapshot, buffer.data(), sizeof(snapshot));
+  board_ = snapshot.board;
+  current_player_ = snapshot.current_player;
+  outcome_ = snapshot.outcome;
+  num_moves_ = snapshot.num_moves;
+  move_number_ = snapshot.move_number;
+}
+
 std::string TicTacToeGame::ActionToString(Player player,
                                           Action action_id) const {
   return absl::StrCat(StateToString(PlayerToState(player)), "(",
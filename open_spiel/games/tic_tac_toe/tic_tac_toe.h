@@ -70,6 +70,8 @@ class TicTacToeState : public State {
   std::unique_ptr<State> Clone() const override;
   void UndoAction(Player player, Action move) override;
   std::vector<Action> LegalActions() const override;
+  void SnapshotTo(std::string* buffer) const override;
+  void RestoreSnapshot(absl::string_view buffer) override;
   CellState BoardAt(int cell) const { return board_[cell]; }
   CellState BoardAt(int row, int column) const {
     return board_[row * kNumCols + column];
@@ -108,6 +110,7 @@ class TicTacToeGame : public Game {
   }
   int MaxGameLength() const override { return kNumCells; }
   std::string ActionToString(Player player, Action action_id) const override;
+  bool SupportsStateSnapshots() const override { return true; }
 };
 
 CellState PlayerToState(Player player);
@@ -27,10 +27,32 @@ void BasicTicTacToeTests() {
   testing::RandomSimTest(*LoadGame("tic_tac_toe"), 100);
 }
 
+void SnapshotTests() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  SPIEL_CHECK_TRUE(game->SupportsStateSnapshots());
+  std::unique_ptr<State> state = game->NewInitialState();
+  for (Action action : {4, 0, 8, 2, 1, 7, 6}) {
+    state->ApplyAction(action);
+    std::string snapshot;
+    state->SnapshotTo(&snapshot);
+    std::unique_ptr<State> restored = game->RestoreSnapshot(snapshot);
+    SPIEL_CHECK_EQ(restored->ToString(), state->ToString());
+    SPIEL_CHECK_EQ(restored->CurrentPlayer(), state->CurrentPlayer());
+    SPIEL_CHECK_EQ(restored->MoveNumber(), state->MoveNumber());
+    if (state->IsTerminal()) {
+      SPIEL_CHECK_TRUE(restored->IsTerminal());
+      SPIEL_CHECK_EQ(restored->Returns(), state->Returns());
+    } else {
+      SPIEL_CHECK_EQ(restored->LegalActions(), state->LegalActions());
+    }
+  }
+}
+
 }  // namespace
 }  // namespace tic_tac_toe
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::tic_tac_toe::BasicTicTacToeTests();
+  open_spiel::tic_tac_toe::SnapshotTests();
 }
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -58,33 +59,110 @@ REGISTER_SPIEL_GAME(kGameType, Factory);
 
 RegisterSingleTensorObserver single_tensor(kGameType.short_name);
 
-constexpr bool InBounds(int r, int c) {
-  return r >= 0 && r < kRows && c >= 0 && c < kColumns;
+// Each 16-bit chunk of the packed board is one row of four 4-bit tile
+// exponents, column 0 in the low nibble. Sliding a row is a lookup into
+// tables indexed by all 65536 row values, holding the resulting row and the
+// score gained by merges. Up/down slide the columns, which become rows under
+// a transposition of the board.
+constexpr int kNumRowValues = 1 << 16;
+
+struct RowTables {
+  std::array<uint16_t, kNumRowValues> left;
+  std::array<uint16_t, kNumRowValues> right;
+  std::array<int, kNumRowValues> left_score;
+  std::array<int, kNumRowValues> right_score;
+};
+
+uint16_t ReverseRow(uint16_t row) {
+  return (row >> 12) | ((row >> 4) & 0x00F0) | ((row << 4) & 0x0F00) |
+         (row << 12);
 }
 
-// An array that dictates the order of traveral of row and column coordinated
-// by direction. E.g, kTraversals[direction][0] is an array of size four
-// refering to the row order, and kTraversals[direction][1] is an array of
-// size four refering to the column order.
-constexpr std::array<std::array<std::array<int, 4>, 2>, 4> kTraversals = {{
-    {{{0, 1, 2, 3}, {0, 1, 2, 3}}},  // Up
-    {{{0, 1, 2, 3}, {3, 2, 1, 0}}},  // Right
-    {{{3, 2, 1, 0}, {0, 1, 2, 3}}},  // Down
-    {{{0, 1, 2, 3}, {0, 1, 2, 3}}}   // Left
-}};
+// Slides one row towards column 0, merging equal neighbours once each, and
+// returns the resulting row; `*score` receives the values of the merged
+// tiles, as in the original game.
+uint16_t SlideRowLeft(uint16_t row, int* score) {
+  std::array<int, kColumns> out = {0, 0, 0, 0};
+  int out_index = 0;
+  int previous = 0;
+  for (int c = 0; c < kColumns; ++c) {
+    const int exponent = (row >> (4 * c)) & 0xF;
+    if (exponent == 0) continue;
+    if (exponent == previous) {
+      // Merge with the previous tile; a merged tile cannot merge again.
+      out[out_index - 1] = std::min(exponent + 1, kMaxTileExponent);
+      *score += 1 << (exponent + 1);
+      previous = 0;
+    } else {
+      out[out_index++] = exponent;
+      previous = exponent;
+    }
+  }
+  return out[0] | (out[1] << 4) | (out[2] << 8) | (out[3] << 12);
+}
+
+const RowTables& GetRowTables() {
+  static const RowTables* tables = [] {
+    RowTables* t = new RowTables();
+    for (int row = 0; row < kNumRowValues; ++row) {
+      int score = 0;
+      t->left[row] = SlideRowLeft(row, &score);
+      t->left_score[row] = score;
+    }
+    for (int row = 0; row < kNumRowValues; ++row) {
+      const uint16_t reversed = ReverseRow(row);
+      t->right[row] = ReverseRow(t->left[reversed]);
+      t->right_score[row] = t->left_score[reversed];
+    }
+    return t;
+  }();
+  return *tables;
+}
+
+// Transposes the board, so that columns can be slid with the row tables.
+uint64_t Transpose(uint64_t board) {
+  const uint64_t a1 = board & 0xF0F00F0FF0F00F0FULL;
+  const uint64_t a2 = board & 0x0000F0F00000F0F0ULL;
+  const uint64_t a3 = board & 0x0F0F00000F0F0000ULL;
+  const uint64_t a = a1 | (a2 << 12) | (a3 >> 12);
+  const uint64_t b1 = a & 0xFF00FF0000FF00FFULL;
+  const uint64_t b2 = a & 0x00FF00FF00000000ULL;
+  const uint64_t b3 = a & 0x00000000FF00FF00ULL;
+  return b1 | (b2 >> 24) | (b3 << 24);
+}
+
+uint64_t SlideRows(uint64_t board, const std::array<uint16_t, kNumRowValues>& rows,
+                   const std::array<int, kNumRowValues>& scores, int* score) {
+  uint64_t out = 0;
+  for (int r = 0; r < kRows; ++r) {
+    const uint16_t row = (board >> (16 * r)) & 0xFFFF;
+    *score += scores[row];
+    out |= static_cast<uint64_t>(rows[row]) << (16 * r);
+  }
+  return out;
+}
 }  // namespace
 
 TwentyFortyEightState::TwentyFortyEightState(std::shared_ptr<const Game> game)
     : State(game),
-      parent_game_(open_spiel::down_cast<const TwentyFortyEightGame&>(*game)),
-      board_(std::vector<Tile>(kRows * kColumns)) {}
+      parent_game_(open_spiel::down_cast<const TwentyFortyEightGame&>(*game)) {
+}
+
+int TwentyFortyEightState::TileValueAt(int cell) const {
+  const int exponent = (board_ >> (4 * cell)) & 0xF;
+  return exponent == 0 ? 0 : 1 << exponent;
+}
+
+void TwentyFortyEightState::SetTileValue(int cell, int value) {
+  const int exponent = value == 0 ? 0 : __builtin_ctz(value);
+  board_ = (board_ & ~(uint64_t{0xF} << (4 * cell))) |
+           (static_cast<uint64_t>(exponent) << (4 * cell));
+}
 
 void TwentyFortyEightState::SetCustomBoard(const std::vector<int>& board_seq) {
   current_player_ = 0;
-  for (int r = 0; r < kRows; r++) {
-    for (int c = 0; c < kColumns; c++) {
-      SetBoard(r, c, Tile(board_seq[r * kColumns + c], false));
-    }
+  for (int cell = 0; cell < kRows * kColumns; cell++) {
+    SetTileValue(cell, board_seq[cell]);
   }
 }
 
@@ -102,77 +180,24 @@ Action TwentyFortyEightState::ChanceActionToSpielAction(
                              {move.row, move.column, move.is_four});
 }
 
-bool TwentyFortyEightState::CellAvailable(int r, int c) const {
-  return BoardAt(r, c).value == 0;
-}
-
-constexpr Coordinate GetVector(int direction) {
-  switch (direction) {
-    case kMoveUp:
-      return Coordinate(-1, 0);
+uint64_t TwentyFortyEightState::MovedBoard(Action action, int* score) const {
+  const RowTables& tables = GetRowTables();
+  switch (action) {
+    case kMoveLeft:
+      return SlideRows(board_, tables.left, tables.left_score, score);
     case kMoveRight:
-      return Coordinate(0, 1);
+      return SlideRows(board_, tables.right, tables.right_score, score);
+    case kMoveUp:
+      return Transpose(
+          SlideRows(Transpose(board_), tables.left, tables.left_score, score));
     case kMoveDown:
-      return Coordinate(1, 0);
-    case kMoveLeft:
-      return Coordinate(0, -1);
+      return Transpose(SlideRows(Transpose(board_), tables.right,
+                                 tables.right_score, score));
     default:
       SpielFatalError("Unrecognized direction");
   }
 }
 
-std::array<Coordinate, 2> TwentyFortyEightState::FindFarthestPosition(
-    int r, int c, int direction) const {
-  // Progress towards the vector direction until an obstacle is found
-  Coordinate prev = Coordinate(r, c);
-  Coordinate direction_diff = GetVector(direction);
-  do {
-    prev = Coordinate(r, c);
-    r += direction_diff.row;
-    c += direction_diff.column;
-  } while (InBounds(r, c) && CellAvailable(r, c));
-  return std::array<Coordinate, 2>{prev, Coordinate(r, c)};
-}
-
-bool TwentyFortyEightState::TileMatchAvailable(int r, int c) const {
-  int tile = BoardAt(r, c).value;
-  if (tile > 0) {
-    for (int direction : kPlayerActions) {
-      Coordinate vector = GetVector(direction);
-      int other = GetCellContent(r + vector.row, c + vector.column);
-      if (other > 0 && other == tile) {
-        return true;  // These two tiles can be merged
-      }
-    }
-  }
-  return false;
-}
-
-// Check for available matches between tiles (more expensive check)
-bool TwentyFortyEightState::TileMatchesAvailable() const {
-  for (int r = 0; r < kRows; r++) {
-    for (int c = 0; c < kColumns; c++) {
-      if (TileMatchAvailable(r, c)) {
-        return true;
-      }
-    }
-  }
-  return false;
-}
-
-void TwentyFortyEightState::PrepareTiles() {
-  for (int r = 0; r < kRows; r++) {
-    for (int c = 0; c < kColumns; c++) {
-      SetTileIsMerged(r, c, false);
-    }
-  }
-}
-
-int TwentyFortyEightState::GetCellContent(int r, int c) const {
-  if (!InBounds(r, c)) return 0;
-  return BoardAt(r, c).value;
-}
-
 void TwentyFortyEightState::DoApplyAction(Action action) {
   if (IsChanceNode()) {
     // The original 2048 game starts with two random tiles. To achieve this,
@@ -187,66 +212,23 @@ void TwentyFortyEightState::DoApplyAction(Action action) {
       return;
     }
     ChanceAction chance_action = SpielActionToChanceAction(action);
-    SetBoard(
-        chance_action.row, chance_action.column,
-        Tile(chance_action.is_four ? kChanceTiles[1] : kChanceTiles[0], false));
+    SetTileValue(chance_action.row * kColumns + chance_action.column,
+                 chance_action.is_four ? kChanceTiles[1] : kChanceTiles[0]);
     return;
   }
   action_score_ = 0;
-  const std::array<std::array<int, 4>, 2>& traversals = kTraversals[action];
-  PrepareTiles();
-  for (int r : traversals[0]) {
-    for (int c : traversals[1]) {
-      int tile = GetCellContent(r, c);
-      if (tile > 0) {
-        bool moved = false;
-        std::array<Coordinate, 2> positions =
-            FindFarthestPosition(r, c, action);
-        Coordinate farthest_pos = positions[0];
-        Coordinate next_pos = positions[1];
-        int next_cell = GetCellContent(next_pos.row, next_pos.column);
-        if (next_cell > 0 && next_cell == tile &&
-            !BoardAt(next_pos).is_merged) {
-          int merged = tile * 2;
-          action_score_ += merged;
-          SetBoard(next_pos.row, next_pos.column, Tile(merged, true));
-          moved = true;
-        } else if (farthest_pos.row != r || farthest_pos.column != c) {
-          SetBoard(farthest_pos.row, farthest_pos.column, Tile(tile, false));
-          moved = true;
-        }
-        if (moved) {
-          SetBoard(r, c, Tile(0, false));
-          current_player_ = kChancePlayerId;
-        }
-      }
-    }
+  const uint64_t moved = MovedBoard(action, &action_score_);
+  if (moved != board_) {
+    board_ = moved;
+    current_player_ = kChancePlayerId;
   }
   total_score_ += action_score_;
   total_actions_++;
 }
 
 bool TwentyFortyEightState::DoesActionChangeBoard(Action action) const {
-  const std::array<std::array<int, 4>, 2>& traversals = kTraversals[action];
-  for (int r : traversals[0]) {
-    for (int c : traversals[1]) {
-      int tile = GetCellContent(r, c);
-      if (tile > 0) {
-        std::array<Coordinate, 2> positions =
-            FindFarthestPosition(r, c, action);
-        Coordinate farthest_pos = positions[0];
-        Coordinate next_pos = positions[1];
-        int next_cell = GetCellContent(next_pos.row, next_pos.column);
-        if (next_cell > 0 && next_cell == tile &&
-            !BoardAt(next_pos).is_merged) {
-          return true;
-        } else if (farthest_pos.row != r || farthest_pos.column != c) {
-          return true;
-        }
-      }
-    }
-  }
-  return false;
+  int score = 0;
+  return MovedBoard(action, &score) != board_;
 }
 
 std::string TwentyFortyEightState::ActionToString(Player player,
@@ -276,11 +258,9 @@ std::string TwentyFortyEightState::ActionToString(Player player,
 
 int TwentyFortyEightState::AvailableCellCount() const {
   int count = 0;
-  for (int r = 0; r < kRows; r++) {
-    for (int c = 0; c < kColumns; c++) {
-      if (BoardAt(r, c).value == 0) {
-        count++;
-      }
+  for (int cell = 0; cell < kRows * kColumns; cell++) {
+    if (((board_ >> (4 * cell)) & 0xF) == 0) {
+      count++;
     }
   }
   return count;
@@ -315,12 +295,8 @@ std::vector<Action> TwentyFortyEightState::LegalActions() const {
     return LegalChanceOutcomes();
   }
 
-  // Construct a vector from the array.
-  std::vector<Action> actions =
-      std::vector<Action>(kPlayerActions.begin(), kPlayerActions.end());
-
   std::vector<Action> actions_allowed = {};
-  for (Action action : actions) {
+  for (Action action : kPlayerActions) {
     if (DoesActionChangeBoard(action)) actions_allowed.push_back(action);
   }
   return actions_allowed;
@@ -344,33 +320,23 @@ bool TwentyFortyEightState::IsTerminal() const {
     return true;
   }
 
-  // Scan the board.
-  int count = 0;
-  int tile_matches_available = 0;
-  for (int r = 0; r < kRows; r++) {
-    for (int c = 0; c < kColumns; c++) {
-      // Check for 2048, if necessary,
-      if (BoardAt(r, c).value == parent_game_.max_tile()) {
-        return true;
-      }
-
-      // Check for increase of available cell count.
-      if (BoardAt(r, c).value == 0) {
-        count++;
-      }
-
-      // Check for tile matches.
-      if (TileMatchAvailable(r, c)) {
-        tile_matches_available++;
-      }
+  // Check for the winning tile.
+  for (int cell = 0; cell < kRows * kColumns; cell++) {
+    if (TileValueAt(cell) == parent_game_.max_tile()) {
+      return true;
     }
   }
 
-  if (count == 0 && tile_matches_available == 0) {
-    return true;
-  } else {
+  // The game continues while there is an empty cell or a possible merge.
+  if (AvailableCellCount() > 0) {
     return false;
   }
+  for (Action action : kPlayerActions) {
+    if (DoesActionChangeBoard(action)) {
+      return false;
+    }
+  }
+  return true;
 }
 
 std::vector<double> TwentyFortyEightState::Rewards() const {
@@ -407,7 +373,12 @@ void TwentyFortyEightState::ObservationTensor(Player player,
 
 TwentyFortyEightGame::TwentyFortyEightGame(const GameParameters& params)
     : Game(kGameType, params),
-      max_tile_(ParameterValue<int>("max_tile", kDefaultMaxTile)) {}
+      max_tile_(ParameterValue<int>("max_tile", kDefaultMaxTile)) {
+  // The packed board holds log2 of each tile in 4 bits.
+  SPIEL_CHECK_GT(max_tile_, 0);
+  SPIEL_CHECK_EQ(max_tile_ & (max_tile_ - 1), 0);
+  SPIEL_CHECK_LE(max_tile_, 1 << kMaxTileExponent);
+}
 
 int TwentyFortyEightGame::NumDistinctActions() const {
   return kPlayerActions.size();
@@ -31,7 +31,9 @@
 //   max_tile            int     End the game when max_tile is reached?
 //                               (default: 2048)
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -49,6 +51,10 @@ constexpr int kColumns = 4;
 
 constexpr int kDefaultMaxTile = 2048;
 
+// The board is packed into a uint64_t, 4 bits per cell holding log2 of the
+// tile value, so the largest representable tile is 2^15.
+constexpr int kMaxTileExponent = 15;
+
 // The chance tiles that randomly appear on the board after each move
 constexpr std::array<int, 2> kChanceTiles = {2, 4};
 const int kNoCellAvailableAction = kRows * kColumns * kChanceTiles.size();
@@ -99,10 +105,10 @@ class TwentyFortyEightState : public State {
 
   // Game-specific methods outside the core API:
   Tile BoardAt(int row, int column) const {
-    return board_[row * kColumns + column];
+    return Tile(TileValueAt(row * kColumns + column), false);
   }
   Tile BoardAt(Coordinate coordinate) const {
-    return board_[coordinate.row * kColumns + coordinate.column];
+    return BoardAt(coordinate.row, coordinate.column);
   }
   void SetCustomBoard(const std::vector<int>& board_seq);
 
@@ -112,25 +118,22 @@ class TwentyFortyEightState : public State {
  private:
   ChanceAction SpielActionToChanceAction(Action action) const;
   Action ChanceActionToSpielAction(ChanceAction move) const;
-  void SetBoard(int row, int column, Tile tile) {
-    board_[row * kColumns + column] = tile;
-  }
-  void SetTileIsMerged(int row, int column, bool is_merged) {
-    board_[row * kColumns + column].is_merged = is_merged;
-  }
+  // The decoded tile value at the given cell (0 for an empty cell).
+  int TileValueAt(int cell) const;
+  // Sets a cell to the given tile value, which must be 0 or a power of two.
+  void SetTileValue(int cell, int value);
   int AvailableCellCount() const;
-  bool CellAvailable(int r, int c) const;
-  std::array<Coordinate, 2> FindFarthestPosition(int r, int c,
-                                                 int direction) const;
-  bool TileMatchAvailable(int r, int c) const;
-  bool TileMatchesAvailable() const;
-  void PrepareTiles();
-  int GetCellContent(int r, int c) const;
+  // The board after sliding in the given direction, accumulating the score
+  // of any merges into `*score`. Computed with the precomputed row
+  // transition tables, see 2048.cc.
+  uint64_t MovedBoard(Action action, int* score) const;
   bool DoesActionChangeBoard(Action action) const;
 
   const TwentyFortyEightGame& parent_game_;
   Player current_player_ = kChancePlayerId;
-  std::vector<Tile> board_;
+  // 4 bits per cell holding log2 of the tile value (0 = empty); cell (r, c)
+  // occupies bits [4 * (r * kColumns + c), ...+4).
+  uint64_t board_ = 0;
   bool extra_chance_turn_ = true;
   int total_score_ = 0;
   int action_score_ = 0;
@@ -0,0 +1,191 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/universal_poker/logic/bucketing.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/memory/memory.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace universal_poker {
+namespace logic {
+
+namespace {
+
+// Number of random deals sampled per street to place the bucket boundaries.
+constexpr int kNumBoundarySamples = 200;
+
+// Moves `count` uniformly drawn distinct cards to cards[offset, offset +
+// count) by partial Fisher-Yates, and returns them as a CardSet.
+CardSet DrawCards(std::vector<uint8_t>* cards, int offset, int count,
+                  std::mt19937* rng) {
+  CardSet drawn;
+  for (int i = offset; i < offset + count; ++i) {
+    std::uniform_int_distribution<int> dist(i, cards->size() - 1);
+    std::swap((*cards)[i], (*cards)[dist(*rng)]);
+    drawn.AddCard((*cards)[i]);
+  }
+  return drawn;
+}
+
+CardSet Union(const CardSet& a, const CardSet& b) {
+  CardSet result;
+  result.cs.cards = a.cs.cards | b.cs.cards;
+  return result;
+}
+
+}  // namespace
+
+ExpectedHandStrengthBucketing::ExpectedHandStrengthBucketing(
+    int num_buckets, int num_suits, int num_ranks, int num_hole_cards,
+    int num_board_cards, int num_board_rollouts, int num_opponent_samples,
+    uint64_t seed)
+    : num_buckets_(num_buckets),
+      num_suits_(num_suits),
+      num_ranks_(num_ranks),
+      num_hole_cards_(num_hole_cards),
+      num_board_cards_(num_board_cards),
+      num_board_rollouts_(num_board_rollouts),
+      num_opponent_samples_(num_opponent_samples),
+      rng_(seed) {
+  SPIEL_CHECK_GT(num_buckets_, 1);
+  SPIEL_CHECK_GT(num_board_rollouts_, 0);
+  SPIEL_CHECK_GT(num_opponent_samples_, 0);
+}
+
+int ExpectedHandStrengthBucketing::Bucket(const CardSet& hole,
+                                          const CardSet& board) {
+  SPIEL_CHECK_EQ(hole.NumCards(), num_hole_cards_);
+  absl::MutexLock lock(&mu_);
+  const HandKey key = CanonicalHandKey(hole, board);
+  auto it = bucket_cache_.find(key);
+  if (it != bucket_cache_.end()) return it->second;
+
+  const double ehs2 = ExpectedHandStrengthSquaredImpl(hole, board);
+  const std::vector<double>& bounds = Boundaries(board.NumCards());
+  const int bucket =
+      std::upper_bound(bounds.begin(), bounds.end(), ehs2) - bounds.begin();
+  bucket_cache_[key] = bucket;
+  return bucket;
+}
+
+double ExpectedHandStrengthBucketing::ExpectedHandStrengthSquared(
+    const CardSet& hole, const CardSet& board) {
+  absl::MutexLock lock(&mu_);
+  return ExpectedHandStrengthSquaredImpl(hole, board);
+}
+
+double ExpectedHandStrengthBucketing::ExpectedHandStrengthSquaredImpl(
+    const CardSet& hole, const CardSet& board) {
+  CardSet deck(num_suits_, num_ranks_);
+  for (uint8_t card : hole.ToCardArray()) deck.RemoveCard(card);
+  for (uint8_t card : board.ToCardArray()) deck.RemoveCard(card);
+  std::vector<uint8_t> remaining = deck.ToCardArray();
+
+  const int cards_to_come = num_board_cards_ - board.NumCards();
+  // On the last street the board is fixed, so spend the whole budget on
+  // opponent hands instead of on identical board rollouts.
+  const int board_rollouts = cards_to_come == 0 ? 1 : num_board_rollouts_;
+  const int opponent_samples =
+      cards_to_come == 0 ? num_board_rollouts_ * num_opponent_samples_
+                         : num_opponent_samples_;
+
+  double sum_hs2 = 0;
+  for (int rollout = 0; rollout < board_rollouts; ++rollout) {
+    const CardSet full_board =
+        Union(board, DrawCards(&remaining, 0, cards_to_come, &rng_));
+    const int own_rank = Union(hole, full_board).RankCardsCached();
+
+    double wins = 0;
+    for (int sample = 0; sample < opponent_samples; ++sample) {
+      // Opponent cards are drawn from behind the rolled-out board cards.
+      const CardSet opponent_hole =
+          DrawCards(&remaining, cards_to_come, num_hole_cards_, &rng_);
+      const int opponent_rank =
+          Union(opponent_hole, full_board).RankCardsCached();
+      if (own_rank > opponent_rank) {
+        wins += 1;
+      } else if (own_rank == opponent_rank) {
+        wins += 0.5;
+      }
+    }
+    const double hand_strength = wins / opponent_samples;
+    sum_hs2 += hand_strength * hand_strength;
+  }
+  return sum_hs2 / board_rollouts;
+}
+
+const std::vector<double>& ExpectedHandStrengthBucketing::Boundaries(
+    int num_board_cards_dealt) {
+  auto it = boundaries_.find(num_board_cards_dealt);
+  if (it != boundaries_.end()) return it->second;
+
+  // Sample random deals at this street and take evenly spaced quantiles of
+  // their E[HS^2] as the bucket boundaries.
+  std::vector<uint8_t> cards = CardSet(num_suits_, num_ranks_).ToCardArray();
+  std::vector<double> values;
+  values.reserve(kNumBoundarySamples);
+  for (int i = 0; i < kNumBoundarySamples; ++i) {
+    const CardSet hole = DrawCards(&cards, 0, num_hole_cards_, &rng_);
+    const CardSet board =
+        DrawCards(&cards, num_hole_cards_, num_board_cards_dealt, &rng_);
+    values.push_back(ExpectedHandStrengthSquaredImpl(hole, board));
+  }
+  std::sort(values.begin(), values.end());
+
+  std::vector<double> bounds(num_buckets_ - 1);
+  for (int b = 1; b < num_buckets_; ++b) {
+    bounds[b - 1] = values[b * values.size() / num_buckets_];
+  }
+  return boundaries_[num_board_cards_dealt] = std::move(bounds);
+}
+
+ExpectedHandStrengthBucketing::HandKey
+ExpectedHandStrengthBucketing::CanonicalHandKey(const CardSet& hole,
+                                                const CardSet& board) {
+  // Permuting the suits permutes the per-suit (hole, board) mask pairs the
+  // same way, so sorting the pairs yields the same key for every suit
+  // isomorphism of the hand while keeping distinct hands distinct.
+  std::array<uint32_t, kMaxSuits> suits;
+  for (int s = 0; s < kMaxSuits; ++s) {
+    suits[s] = (static_cast<uint32_t>(hole.cs.bySuit[s]) << 16) |
+               board.cs.bySuit[s];
+  }
+  std::sort(suits.begin(), suits.end());
+  return {(static_cast<uint64_t>(suits[0]) << 32) | suits[1],
+          (static_cast<uint64_t>(suits[2]) << 32) | suits[3]};
+}
+
+std::unique_ptr<HandBucketing> MakeHandBucketing(const std::string& name,
+                                                 int num_buckets,
+                                                 int num_suits, int num_ranks,
+                                                 int num_hole_cards,
+                                                 int num_board_cards) {
+  if (name.empty()) return nullptr;
+  if (name == "ehs2") {
+    return absl::make_unique<ExpectedHandStrengthBucketing>(
+        num_buckets, num_suits, num_ranks, num_hole_cards, num_board_cards);
+  }
+  SpielFatalError(absl::StrFormat("bucketing: %s not supported.", name));
+}
+
+}  // namespace logic
+}  // namespace universal_poker
+}  // namespace open_spiel
@@ -0,0 +1,122 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_GAMES_UNIVERSAL_POKER_LOGIC_BUCKETING_H_
+#define OPEN_SPIEL_GAMES_UNIVERSAL_POKER_LOGIC_BUCKETING_H_
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/games/universal_poker/logic/card_set.h"
+
+namespace open_spiel {
+namespace universal_poker {
+namespace logic {
+
+// Card abstraction for universal_poker: maps a (hole cards, board cards)
+// pair to a small bucket index so that tabular solvers such as MCCFR can key
+// their infostate tables on buckets instead of raw cards. Implementations
+// must map suit-isomorphic hands to the same bucket, and may cache freely;
+// all methods must be safe to call from multiple threads.
+class HandBucketing {
+ public:
+  virtual ~HandBucketing() = default;
+
+  // Number of buckets hands are mapped into.
+  virtual int num_buckets() const = 0;
+
+  // Returns the bucket in [0, num_buckets()) for the given hole and board
+  // cards. `hole` must contain a full set of hole cards.
+  virtual int Bucket(const CardSet& hole, const CardSet& board) = 0;
+};
+
+// Buckets hands by percentiles of E[HS^2]: the expectation, over rollouts of
+// the remaining board cards, of the squared probability of beating a random
+// opponent hand at showdown. Squaring the hand strength favours hands with
+// the potential to become very strong over hands of the same average
+// strength, which is the standard distribution-aware refinement used in
+// poker abstractions.
+//
+// Per street (number of board cards dealt), the bucket boundaries are built
+// once from the E[HS^2] quantiles of a sample of random deals; hands are
+// then placed by binary search. Both the boundaries and the bucket of every
+// suit-canonical hand already seen are kept in lookup tables, so repeated
+// queries during solver traversals reduce to a hash lookup.
+class ExpectedHandStrengthBucketing : public HandBucketing {
+ public:
+  // The deck and deal shape come from the game: num_suits/num_ranks describe
+  // the deck, num_hole_cards is the number of hole cards per player and
+  // num_board_cards the total number of board cards dealt by the last round.
+  // The rollout counts trade accuracy against the one-time cost of filling
+  // the tables.
+  ExpectedHandStrengthBucketing(int num_buckets, int num_suits, int num_ranks,
+                                int num_hole_cards, int num_board_cards,
+                                int num_board_rollouts = 50,
+                                int num_opponent_samples = 10,
+                                uint64_t seed = 23);
+
+  int num_buckets() const override { return num_buckets_; }
+  int Bucket(const CardSet& hole, const CardSet& board) override;
+
+  // Monte-Carlo estimate of E[HS^2], in [0, 1]. Exposed for tests.
+  double ExpectedHandStrengthSquared(const CardSet& hole,
+                                     const CardSet& board);
+
+ private:
+  // Key identifying (hole, board) up to a permutation of the suits.
+  using HandKey = std::pair<uint64_t, uint64_t>;
+  static HandKey CanonicalHandKey(const CardSet& hole, const CardSet& board);
+
+  double ExpectedHandStrengthSquaredImpl(const CardSet& hole,
+                                         const CardSet& board)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  const std::vector<double>& Boundaries(int num_board_cards_dealt)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const int num_buckets_;
+  const int num_suits_;
+  const int num_ranks_;
+  const int num_hole_cards_;
+  const int num_board_cards_;
+  const int num_board_rollouts_;
+  const int num_opponent_samples_;
+
+  absl::Mutex mu_;
+  std::mt19937 rng_ ABSL_GUARDED_BY(mu_);
+  // Per-street percentile boundaries, built once on first use.
+  absl::flat_hash_map<int, std::vector<double>> boundaries_
+      ABSL_GUARDED_BY(mu_);
+  // Bucket of every suit-canonical hand already queried.
+  absl::flat_hash_map<HandKey, int> bucket_cache_ ABSL_GUARDED_BY(mu_);
+};
+
+// Returns the bucketing registered under `name` ("ehs2" is currently the
+// only one), or nullptr for the empty string (no abstraction).
+std::unique_ptr<HandBucketing> MakeHandBucketing(const std::string& name,
+                                                 int num_buckets,
+                                                 int num_suits, int num_ranks,
+                                                 int num_hole_cards,
+                                                 int num_board_cards);
+
+}  // namespace logic
+}  // namespace universal_poker
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_UNIVERSAL_POKER_LOGIC_BUCKETING_H_
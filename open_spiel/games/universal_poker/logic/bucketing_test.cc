@@ -0,0 +1,80 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/universal_poker/logic/bucketing.h"
+
+#include <memory>
+
+#include "open_spiel/games/universal_poker/logic/card_set.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace universal_poker {
+namespace logic {
+
+// A hold'em-shaped game on a 4-suit, 6-rank deck (ranks 2 through 7): two
+// hole cards and three board cards.
+ExpectedHandStrengthBucketing MakeTestBucketing() {
+  return ExpectedHandStrengthBucketing(
+      /*num_buckets=*/5, /*num_suits=*/4, /*num_ranks=*/6,
+      /*num_hole_cards=*/2, /*num_board_cards=*/3);
+}
+
+void ExpectedHandStrengthTests() {
+  ExpectedHandStrengthBucketing bucketing = MakeTestBucketing();
+
+  // A pair of the highest rank beats an unsuited low hand, both preflop and
+  // on a board that misses both hands.
+  double strong = bucketing.ExpectedHandStrengthSquared(CardSet("7s7h"),
+                                                        CardSet());
+  double weak = bucketing.ExpectedHandStrengthSquared(CardSet("2s3h"),
+                                                      CardSet());
+  SPIEL_CHECK_GE(weak, 0);
+  SPIEL_CHECK_LE(strong, 1);
+  SPIEL_CHECK_GT(strong, weak);
+}
+
+void BucketTests() {
+  ExpectedHandStrengthBucketing bucketing = MakeTestBucketing();
+  SPIEL_CHECK_EQ(bucketing.num_buckets(), 5);
+
+  int strong = bucketing.Bucket(CardSet("7s7h"), CardSet());
+  int weak = bucketing.Bucket(CardSet("2s3h"), CardSet());
+  SPIEL_CHECK_GE(weak, 0);
+  SPIEL_CHECK_LT(strong, bucketing.num_buckets());
+  SPIEL_CHECK_GE(strong, weak);
+
+  // Suit-isomorphic hands land in the same bucket, with and without a board.
+  SPIEL_CHECK_EQ(bucketing.Bucket(CardSet("7c7d"), CardSet()), strong);
+  SPIEL_CHECK_EQ(bucketing.Bucket(CardSet("6s5s"), CardSet("2s3h4h")),
+                 bucketing.Bucket(CardSet("6d5d"), CardSet("2d3c4c")));
+}
+
+void MakeHandBucketingTests() {
+  SPIEL_CHECK_TRUE(MakeHandBucketing("", 5, 4, 6, 2, 3) == nullptr);
+  std::unique_ptr<HandBucketing> bucketing =
+      MakeHandBucketing("ehs2", 5, 4, 6, 2, 3);
+  SPIEL_CHECK_TRUE(bucketing != nullptr);
+  SPIEL_CHECK_EQ(bucketing->num_buckets(), 5);
+}
+
+}  // namespace logic
+}  // namespace universal_poker
+}  // namespace open_spiel
+
+int main(int argc, char **argv) {
+  open_spiel::universal_poker::logic::ExpectedHandStrengthTests();
+  open_spiel::universal_poker::logic::BucketTests();
+  open_spiel::universal_poker::logic::MakeHandBucketingTests();
+}
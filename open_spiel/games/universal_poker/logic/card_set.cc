@@ -14,6 +14,8 @@
 
 #include "open_spiel/games/universal_poker/logic/card_set.h"
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <iostream>
 #include <sstream>
@@ -21,6 +23,7 @@
 
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/lru_cache.h"
 
 constexpr absl::string_view kSuitChars = "cdhs";
 constexpr absl::string_view kRankChars = "23456789TJQKA";
@@ -130,6 +133,33 @@ int CardSet::RankCards() const {
   return rankCardset(csNative);
 }
 
+int CardSet::RankCardsCached() const {
+  // Sharded so that parallel solver threads only contend when they hit the
+  // same shard. The capacity comfortably covers the suit-canonical 7-card
+  // deals reachable from a single hold'em board texture.
+  static ShardedLRUCache<uint64_t, int>* cache =
+      new ShardedLRUCache<uint64_t, int>(/*max_size=*/1 << 20,
+                                         /*num_shards=*/16);
+  const uint64_t key = CanonicalKey();
+  absl::optional<const int> rank = cache->Get(key);
+  if (rank.has_value()) return *rank;
+  const int computed_rank = RankCards();
+  cache->Set(key, computed_rank);
+  return computed_rank;
+}
+
+uint64_t CardSet::CanonicalKey() const {
+  // Sorting the per-suit rank masks maps every suit permutation of this set
+  // to the same representative.
+  std::array<uint16_t, kMaxSuits> suits = {cs.bySuit[0], cs.bySuit[1],
+                                           cs.bySuit[2], cs.bySuit[3]};
+  std::sort(suits.begin(), suits.end());
+  return (static_cast<uint64_t>(suits[0]) << 48) |
+         (static_cast<uint64_t>(suits[1]) << 32) |
+         (static_cast<uint64_t>(suits[2]) << 16) |
+         static_cast<uint64_t>(suits[3]);
+}
+
 std::vector<CardSet> CardSet::SampleCards(int nbCards) {
   std::vector<CardSet> combinations;
 
@@ -57,6 +57,17 @@ class CardSet {
   int NumCards() const;
   // Returns the ranking value of this set of cards as evaluated by ACPC.
   int RankCards() const;
+  // Same as RankCards(), but memoizes the evaluation in a process-wide cache
+  // keyed by CanonicalKey(). Suit-isomorphic hands share a cache entry, so
+  // solver traversals that evaluate many deals of the same hand class hit the
+  // cache instead of the ACPC hand evaluator.
+  int RankCardsCached() const;
+
+  // Returns a key that is identical for all suit isomorphisms of this set:
+  // two CardSets have the same canonical key iff one can be obtained from the
+  // other by permuting the suits. Hand ranking is invariant under suit
+  // permutation, so the key is a perfect index for memoizing RankCards().
+  uint64_t CanonicalKey() const;
 
   // Returns all the possible nbCards-subsets of this CardSet.
   std::vector<CardSet> SampleCards(int nbCards);
@@ -16,6 +16,8 @@
 
 #include <iostream>
 
+#include "open_spiel/spiel_utils.h"
+
 namespace open_spiel {
 namespace universal_poker {
 namespace logic {
@@ -44,10 +46,29 @@ void BasicCardSetTests() {
   }
 }
 
+void CanonicalKeyTests() {
+  // The canonical key identifies card sets up to a permutation of the suits.
+  CardSet spades("AsKsQsJsTs");
+  CardSet hearts("AhKhQhJhTh");
+  SPIEL_CHECK_EQ(spades.CanonicalKey(), hearts.CanonicalKey());
+  SPIEL_CHECK_NE(spades.CanonicalKey(), CardSet("AsKsQsJs9s").CanonicalKey());
+  SPIEL_CHECK_NE(spades.CanonicalKey(), CardSet("AsKsQsJsTh").CanonicalKey());
+
+  // The cached ranking agrees with the direct ACPC evaluation, both on the
+  // miss that populates the cache and on the hit that follows (the two hands
+  // are suit-isomorphic and so share a cache entry).
+  SPIEL_CHECK_EQ(spades.RankCardsCached(), spades.RankCards());
+  SPIEL_CHECK_EQ(hearts.RankCardsCached(), hearts.RankCards());
+
+  CardSet wheel("5d4d3c2cAh");
+  SPIEL_CHECK_EQ(wheel.RankCardsCached(), wheel.RankCards());
+}
+
 }  // namespace logic
 }  // namespace universal_poker
 }  // namespace open_spiel
 
 int main(int argc, char **argv) {
   open_spiel::universal_poker::logic::BasicCardSetTests();
+  open_spiel::universal_poker::logic::CanonicalKeyTests();
 }
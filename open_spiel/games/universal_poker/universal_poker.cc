@@ -167,6 +167,12 @@ const GameType kGameType{
         // "fcpa" for fold, check/call, bet pot and all in (default).
         // Use "fullgame" for the unabstracted game.
         {"bettingAbstraction", GameParameter(std::string("fcpa"))},
+        // Card abstraction applied to the information state string. Empty
+        // for the raw (unabstracted) game; "ehs2" buckets hands by
+        // percentiles of expected hand strength squared.
+        {"bucketing", GameParameter(std::string(""))},
+        // Number of buckets per betting round when bucketing is enabled.
+        {"numBuckets", GameParameter(50)},
 
         // ------------------------------------------------------------------------
         // Following parameters are used to specify specific subgame.
@@ -214,7 +220,9 @@ UniversalPokerState::UniversalPokerState(std::shared_ptr<const Game> game)
       cur_player_(kChancePlayerId),
       possibleActions_(ACTION_DEAL),
       betting_abstraction_(static_cast<const UniversalPokerGame *>(game.get())
-                               ->betting_abstraction()) {
+                               ->betting_abstraction()),
+      betting_tree_(
+          static_cast<const UniversalPokerGame *>(game.get())->betting_tree()) {
   // -- Optionally apply subgame parameters. -----------------------------------
   // Pot size.
   const int pot_size = game->GetParameters().at("potSize").int_value();
@@ -354,6 +362,7 @@ std::vector<double> UniversalPokerState::Returns() const {
   if (!IsTerminal()) {
     return std::vector<double>(NumPlayers(), 0.0);
   }
+  if (!cached_terminal_returns_.empty()) return cached_terminal_returns_;
 
   std::vector<double> returns(NumPlayers());
   for (Player player = 0; player < NumPlayers(); ++player) {
@@ -361,6 +370,7 @@ std::vector<double> UniversalPokerState::Returns() const {
     returns[player] = GetTotalReward(player);
   }
 
+  cached_terminal_returns_ = returns;
   return returns;
 }
 
@@ -501,6 +511,21 @@ std::string UniversalPokerState::InformationStateString(Player player) const {
     absl::StrAppend(&sequences, acpc_state_.BettingSequence(r));
   }
 
+  logic::HandBucketing *bucketing =
+      static_cast<const UniversalPokerGame *>(game_.get())->bucketing();
+  if (bucketing != nullptr) {
+    const logic::CardSet hole = HoleCards(player);
+    // Buckets are only defined for complete hole cards; during the initial
+    // deal fall through to the raw representation.
+    if (hole.NumCards() == acpc_game_->GetNbHoleCardsRequired()) {
+      return absl::StrFormat(
+          "[Round %i][Player: %i][Pot: %i][Money: %s][Bucket: %i][Sequences: "
+          "%s]",
+          acpc_state_.GetRound(), CurrentPlayer(), pot, money,
+          bucketing->Bucket(hole, BoardCards()), sequences);
+    }
+  }
+
   return absl::StrFormat(
       "[Round %i][Player: %i][Pot: %i][Money: %s][Private: %s][Public: "
       "%s][Sequences: %s]",
@@ -814,6 +839,7 @@ int UniversalPokerState::AllInSize() const {
 // player first, then the second player, until all players have their private
 // cards.
 void UniversalPokerState::DoApplyAction(Action action_id) {
+  cached_terminal_returns_.clear();
   if (IsChanceNode()) {
     if (IsDistributingSingleCard()) {
       // In chance nodes, the action_id is an index into the full deck.
@@ -889,11 +915,17 @@ void UniversalPokerState::DoApplyAction(Action action_id) {
         return;
       }
       if (action_int == kBet && !acpc_game_->IsLimitGame()) {
-        ApplyChoiceAction(ACTION_BET, PotSize());
+        ApplyChoiceAction(ACTION_BET,
+                          betting_tree_ != nullptr
+                              ? betting_tree_->node(betting_node_).bet_size
+                              : PotSize());
         return;
       }
       if (action_int == kAllIn) {
-        ApplyChoiceAction(ACTION_ALL_IN, AllInSize());
+        ApplyChoiceAction(ACTION_ALL_IN,
+                          betting_tree_ != nullptr
+                              ? betting_tree_->node(betting_node_).all_in_size
+                              : AllInSize());
         return;
       }
       // FCHPA allows for arbitrary bets.
@@ -977,6 +1009,18 @@ UniversalPokerState::GetHistoriesConsistentWithInfostate(int player_id) const {
   return dist;
 }
 
+int64_t UniversalPokerState::MemoryFootprint() const {
+  // acpc_state_ and deck_ are stored inline; only the strings and vectors
+  // below own heap memory.
+  int64_t bytes = sizeof(*this) - sizeof(State) + State::MemoryFootprint();
+  if (actionSequence_.capacity() > sizeof(std::string)) {
+    bytes += actionSequence_.capacity();
+  }
+  bytes += cached_terminal_returns_.capacity() * sizeof(double);
+  bytes += handReaches_.capacity() * sizeof(double);
+  return bytes;
+}
+
 /**
  * Universal Poker Game Constructor
  * @param params
@@ -1002,8 +1046,23 @@ UniversalPokerGame::UniversalPokerGame(const GameParameters &params)
     SpielFatalError(absl::StrFormat("bettingAbstraction: %s not supported.",
                                     betting_abstraction));
   }
+  bucketing_ = logic::MakeHandBucketing(
+      ParameterValue<std::string>("bucketing"),
+      ParameterValue<int>("numBuckets"), acpc_game_.NumSuitsDeck(),
+      acpc_game_.NumRanksDeck(), acpc_game_.GetNbHoleCardsRequired(),
+      acpc_game_.GetTotalNbBoardCards());
   max_game_length_ = MaxGameLength();
   SPIEL_CHECK_TRUE(max_game_length_.has_value());
+  // Precompute the betting tree for the fixed-action abstractions. The full
+  // game's tree is far too large to enumerate, FCHPA additionally accepts
+  // arbitrary bet sizes, and subgames start from a betting state the tree
+  // root would not match; those variants keep querying ACPC directly.
+  if ((betting_abstraction_ == BettingAbstraction::kFC ||
+       betting_abstraction_ == BettingAbstraction::kFCPA) &&
+      potSize_ == 0 && boardCards_.empty()) {
+    auto betting_tree = absl::make_unique<BettingTree>(*this);
+    if (betting_tree->BuildComplete()) betting_tree_ = std::move(betting_tree);
+  }
 }
 
 std::unique_ptr<State> UniversalPokerGame::NewInitialState() const {
@@ -1212,6 +1271,14 @@ void UniversalPokerState::ApplyChoiceAction(StateActionType action_type,
   SPIEL_CHECK_GE(cur_player_, 0);  // No chance not terminal.
   const auto &up_game = static_cast<const UniversalPokerGame &>(*game_);
 
+  // Children are indexed by the abstract action, before the check/call
+  // redirect below; the tree applied the same redirect when it was built.
+  if (betting_tree_ != nullptr) {
+    betting_node_ = betting_tree_->node(betting_node_)
+                        .children[BettingTree::ChildIndex(action_type)];
+    SPIEL_CHECK_NE(betting_node_, BettingTree::kInvalidNode);
+  }
+
   // We redirect these actions to check/call, as they are semantically a
   // check/call action. For some reason, ACPC prefers it this way.
   if (size == up_game.MaxCommitment() * up_game.NumPlayers()) {
@@ -1226,6 +1293,121 @@ void UniversalPokerState::ApplyChoiceAction(StateActionType action_type,
   _CalculateActionsAndNodeType();
 }
 
+namespace {
+
+// Computes the abstract actions available at a betting node, along with the
+// raise-to sizes used for the pot-bet and all-in actions. This depends only
+// on the betting state, never on the cards dealt, which is what allows the
+// result to be precomputed per betting sequence in BettingTree.
+uint32_t CalculateChoiceActionMask(const acpc_cpp::ACPCState &acpc_state,
+                                   const acpc_cpp::ACPCGame &acpc_game,
+                                   BettingAbstraction betting_abstraction,
+                                   int *bet_size, int *all_in_size) {
+  uint32_t mask = 0;
+  if (acpc_state.IsValidAction(acpc_cpp::ACPCState::ACPCActionType::ACPC_FOLD,
+                               0)) {
+    mask |= ACTION_FOLD;
+  }
+  if (acpc_state.IsValidAction(acpc_cpp::ACPCState::ACPCActionType::ACPC_CALL,
+                               0)) {
+    mask |= ACTION_CHECK_CALL;
+  }
+
+  int potSize = 0;
+  int allInSize = 0;
+  bool valid_to_raise = acpc_state.RaiseIsValid(&potSize, &allInSize);
+  if (betting_abstraction != BettingAbstraction::kFC && valid_to_raise) {
+    if (acpc_game.IsLimitGame()) {
+      potSize = 0;
+      // There's only one "bet" allowed in Limit, which is "all-in or fixed
+      // bet".
+      mask |= ACTION_BET;
+    } else {
+      int cur_spent = acpc_state.CurrentSpent(acpc_state.CurrentPlayer());
+      int pot_raise_to =
+          acpc_state.TotalSpent() + 2 * acpc_state.MaxSpend() - cur_spent;
+
+      if (pot_raise_to >= potSize && pot_raise_to <= allInSize) {
+        potSize = pot_raise_to;
+        mask |= ACTION_BET;
+      }
+
+      if (pot_raise_to != allInSize) {
+        // If the raise to amount happens to match the number of chips I have,
+        // then this action was already added as a pot-bet.
+        mask |= ACTION_ALL_IN;
+      }
+    }
+  }
+  *bet_size = potSize;
+  *all_in_size = allInSize;
+  return mask;
+}
+
+}  // namespace
+
+BettingTree::BettingTree(const UniversalPokerGame &game)
+    : acpc_game_(game.GetACPCGame()),
+      betting_abstraction_(game.betting_abstraction()),
+      check_call_redirect_(game.MaxCommitment() * game.NumPlayers()) {
+  Expand(acpc_cpp::ACPCState(acpc_game_));
+  if (!complete_) nodes_.clear();
+}
+
+int BettingTree::ChildIndex(StateActionType action_type) {
+  switch (action_type) {
+    case ACTION_FOLD:
+      return ActionType::kFold;
+    case ACTION_CHECK_CALL:
+      return ActionType::kCall;
+    case ACTION_BET:
+      return ActionType::kBet;
+    case ACTION_ALL_IN:
+      return ActionType::kAllIn;
+    default:
+      SpielFatalError(
+          absl::StrCat("Action type has no betting tree child: ", action_type));
+  }
+}
+
+int BettingTree::Expand(const acpc_cpp::ACPCState &acpc_state) {
+  if (NumNodes() >= kMaxNodes) complete_ = false;
+  if (!complete_) return kInvalidNode;
+  const int node_id = nodes_.size();
+  nodes_.emplace_back();
+  if (acpc_state.IsFinished()) return node_id;
+
+  int bet_size = 0;
+  int all_in_size = 0;
+  const uint32_t mask = CalculateChoiceActionMask(
+      acpc_state, *acpc_game_, betting_abstraction_, &bet_size, &all_in_size);
+  nodes_[node_id].action_mask = mask;
+  nodes_[node_id].bet_size = bet_size;
+  nodes_[node_id].all_in_size = all_in_size;
+
+  for (StateActionType action_type :
+       {ACTION_FOLD, ACTION_CHECK_CALL, ACTION_BET, ACTION_ALL_IN}) {
+    if (!(mask & action_type)) continue;
+    int size = 0;
+    if (action_type == ACTION_BET) size = bet_size;
+    if (action_type == ACTION_ALL_IN) size = all_in_size;
+    // Mirror ApplyChoiceAction: a raise to the combined maximum commitment is
+    // semantically a check/call, and ACPC expects it encoded as one.
+    StateActionType applied_type = action_type;
+    if (size == check_call_redirect_) {
+      applied_type = StateActionType::ACTION_CHECK_CALL;
+      size = 0;
+    }
+    acpc_cpp::ACPCState child_state(acpc_state);
+    child_state.DoAction(UniversalPokerActionTypeToACPCActionType(applied_type),
+                         size);
+    // Note: Expand can reallocate nodes_, so index instead of holding a
+    // reference across the recursive call.
+    nodes_[node_id].children[ChildIndex(action_type)] = Expand(child_state);
+  }
+  return node_id;
+}
+
 void UniversalPokerState::_CalculateActionsAndNodeType() {
   possibleActions_ = 0;
 
@@ -1263,43 +1445,17 @@ void UniversalPokerState::_CalculateActionsAndNodeType() {
 
     // Check for CHOICE Actions
     cur_player_ = acpc_state_.CurrentPlayer();
-    if (acpc_state_.IsValidAction(
-            acpc_cpp::ACPCState::ACPCActionType::ACPC_FOLD, 0)) {
-      possibleActions_ |= ACTION_FOLD;
-    }
-    if (acpc_state_.IsValidAction(
-            acpc_cpp::ACPCState::ACPCActionType::ACPC_CALL, 0)) {
-      possibleActions_ |= ACTION_CHECK_CALL;
-    }
-
-    int potSize = 0;
-    int allInSize = 0;
-    // We have to call this as this sets potSize and allInSize_.
-    bool valid_to_raise = acpc_state_.RaiseIsValid(&potSize, &allInSize);
-    if (betting_abstraction_ == BettingAbstraction::kFC) return;
-    if (valid_to_raise) {
-      if (acpc_game_->IsLimitGame()) {
-        potSize = 0;
-        // There's only one "bet" allowed in Limit, which is "all-in or fixed
-        // bet".
-        possibleActions_ |= ACTION_BET;
-      } else {
-        int cur_spent = acpc_state_.CurrentSpent(acpc_state_.CurrentPlayer());
-        int pot_raise_to =
-            acpc_state_.TotalSpent() + 2 * acpc_state_.MaxSpend() - cur_spent;
-
-        if (pot_raise_to >= potSize && pot_raise_to <= allInSize) {
-          potSize = pot_raise_to;
-          possibleActions_ |= ACTION_BET;
-        }
-
-        if (pot_raise_to != allInSize) {
-          // If the raise to amount happens to match the number of chips I have,
-          // then this action was already added as a pot-bet.
-          possibleActions_ |= ACTION_ALL_IN;
-        }
-      }
+    if (betting_tree_ != nullptr) {
+      // The ACPC validation and raise-size work was all done once, when the
+      // tree was built.
+      possibleActions_ = betting_tree_->node(betting_node_).action_mask;
+      return;
     }
+    int bet_size = 0;
+    int all_in_size = 0;
+    possibleActions_ |= CalculateChoiceActionMask(
+        acpc_state_, *acpc_game_, betting_abstraction_, &bet_size,
+        &all_in_size);
   }
 }
 
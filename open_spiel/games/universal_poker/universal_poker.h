@@ -25,6 +25,7 @@
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
 #include "open_spiel/games/universal_poker/acpc_cpp/acpc_game.h"
+#include "open_spiel/games/universal_poker/logic/bucketing.h"
 #include "open_spiel/games/universal_poker/logic/card_set.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
@@ -65,6 +66,59 @@ enum StateActionType {
 constexpr StateActionType ALL_ACTIONS[5] = {
     ACTION_DEAL, ACTION_FOLD, ACTION_CHECK_CALL, ACTION_BET, ACTION_ALL_IN};
 
+// Precomputed betting structure for the abstracted game variants. The set of
+// abstract actions available at a betting node and the raise-to sizes of the
+// pot-bet and all-in actions depend only on the betting sequence, never on
+// the cards dealt, so they are computed once per game by walking the (small)
+// abstract betting tree and looked up by node id afterwards. This removes
+// the repeated ACPC action-validation and raise-size queries from the hot
+// loop of tabular solvers, which revisit every betting node many times per
+// iteration.
+class BettingTree {
+ public:
+  static constexpr int kInvalidNode = -1;
+  static constexpr int kRootNode = 0;
+
+  struct Node {
+    // Mask of StateActionType bits available at this node.
+    uint32_t action_mask = 0;
+    // Raise-to sizes applied for ACTION_BET and ACTION_ALL_IN.
+    int bet_size = 0;
+    int all_in_size = 0;
+    // Child node id per abstract action (indexed by ActionType, kFold up to
+    // kAllIn), or kInvalidNode where the action is not available.
+    std::array<int, 4> children = {kInvalidNode, kInvalidNode, kInvalidNode,
+                                   kInvalidNode};
+  };
+
+  explicit BettingTree(const UniversalPokerGame &game);
+
+  const Node &node(int node_id) const { return nodes_[node_id]; }
+  int NumNodes() const { return nodes_.size(); }
+
+  // Whether the tree was fully enumerated. Construction gives up beyond
+  // kMaxNodes (deep multi-way no-limit games, large raise caps); the game
+  // then keeps querying ACPC directly instead.
+  bool BuildComplete() const { return complete_; }
+  static constexpr int kMaxNodes = 1 << 20;
+
+  // Index of an abstract action within Node::children.
+  static int ChildIndex(StateActionType action_type);
+
+ private:
+  // Appends the node reached by the given betting state (and, recursively,
+  // its descendants) to nodes_, returning its id.
+  int Expand(const acpc_cpp::ACPCState &acpc_state);
+
+  const acpc_cpp::ACPCGame *acpc_game_;
+  const BettingAbstraction betting_abstraction_;
+  // Raises to this total are redirected to check/call, see
+  // UniversalPokerState::ApplyChoiceAction.
+  const double check_call_redirect_;
+  bool complete_ = true;
+  std::vector<Node> nodes_;
+};
+
 class UniversalPokerState : public State {
  public:
   explicit UniversalPokerState(std::shared_ptr<const Game> game);
@@ -109,6 +163,8 @@ class UniversalPokerState : public State {
   int AllInSize() const;
   void ApplyChoiceAction(StateActionType action_type, int size);
 
+  int64_t MemoryFootprint() const override;
+
  protected:
   void DoApplyAction(Action action_id) override;
 
@@ -184,6 +240,17 @@ class UniversalPokerState : public State {
 
   BettingAbstraction betting_abstraction_;
 
+  // Betting tree of the abstracted game, shared by all states of the game;
+  // nullptr when the variant has no precomputed tree (full game,
+  // arbitrary-bet abstractions and subgames).
+  const BettingTree *betting_tree_;
+  int betting_node_ = BettingTree::kRootNode;
+
+  // Returns() is called repeatedly on terminal states during solver
+  // traversals; the ACPC showdown evaluation is cached here after the first
+  // call and cleared whenever an action is applied.
+  mutable std::vector<double> cached_terminal_returns_;
+
   // Used for custom implementation of subgames.
   std::vector<double> handReaches_;
   std::vector <std::pair <Action, double>> DistributeHandCardsInSubgame() const;
@@ -214,6 +281,11 @@ class UniversalPokerGame : public Game {
   int big_blind() const { return big_blind_; }
   double MaxCommitment() const;
   const acpc_cpp::ACPCGame *GetACPCGame() const { return &acpc_game_; }
+  // The precomputed betting tree, or nullptr when the variant has none.
+  const BettingTree *betting_tree() const { return betting_tree_.get(); }
+  // The card abstraction applied to information state strings, or nullptr
+  // when playing the unabstracted game.
+  logic::HandBucketing *bucketing() const { return bucketing_.get(); }
   std::string parseParameters(const GameParameters &map);
 
  private:
@@ -224,6 +296,8 @@ class UniversalPokerGame : public Game {
   const std::string handReaches_;
   absl::optional<int> max_game_length_;
   BettingAbstraction betting_abstraction_ = BettingAbstraction::kFULLGAME;
+  std::unique_ptr<BettingTree> betting_tree_;
+  std::unique_ptr<logic::HandBucketing> bucketing_;
   int big_blind_;
   int max_stack_size_;
 };
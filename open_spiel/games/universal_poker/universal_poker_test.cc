@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 
@@ -216,6 +217,23 @@ void LoadAndRunGameFromDefaultConfig() {
   testing::RandomSimTest(*game, 2);
 }
 
+void TestBucketedInformationStates() {
+  std::shared_ptr<const Game> game =
+      LoadGame("universal_poker",
+               {{"bucketing", GameParameter(std::string("ehs2"))},
+                {"numBuckets", GameParameter(10)}});
+  std::unique_ptr<State> state = game->NewInitialState();
+  // Deal everyone's hole cards.
+  while (state->IsChanceNode()) {
+    state->ApplyAction(state->LegalActions()[0]);
+  }
+  const std::string infostate = state->InformationStateString();
+  SPIEL_CHECK_TRUE(absl::StrContains(infostate, "[Bucket: "));
+  // The raw cards must not leak into the abstracted infostate.
+  SPIEL_CHECK_FALSE(absl::StrContains(infostate, "[Private: "));
+  testing::RandomSimTest(*game, 2);
+}
+
 void BasicUniversalPokerTests() {
   testing::LoadGameTest("universal_poker");
   testing::ChanceOutcomesTest(*LoadGame("universal_poker"));
@@ -811,6 +829,67 @@ void TestFixedPreferenceBots() {
   }
 }
 
+void TestPrecomputedBettingTree() {
+  // The precomputed betting tree must agree with what the ACPC wrappers
+  // report at every betting node reached through the public API.
+  for (const std::string& game_string :
+       std::vector<std::string>({"universal_poker", HunlGameString("fcpa"),
+                                 HulhGameString("fcpa")})) {
+    std::shared_ptr<const Game> game = LoadGame(game_string);
+    const auto& up_game = static_cast<const UniversalPokerGame&>(*game);
+    SPIEL_CHECK_TRUE(up_game.betting_tree() != nullptr);
+    SPIEL_CHECK_GT(up_game.betting_tree()->NumNodes(), 1);
+    const bool is_limit = up_game.GetACPCGame()->IsLimitGame();
+
+    std::mt19937 rng(2387);
+    for (int sim = 0; sim < 10; ++sim) {
+      std::unique_ptr<State> state = game->NewInitialState();
+      while (!state->IsTerminal()) {
+        std::vector<Action> legal_actions = state->LegalActions();
+        if (!state->IsChanceNode()) {
+          const auto& up_state =
+              static_cast<const UniversalPokerState&>(*state);
+          const acpc_cpp::ACPCState& acpc_state = up_state.acpc_state();
+          SPIEL_CHECK_EQ(
+              absl::c_linear_search(legal_actions, ActionType::kFold),
+              static_cast<bool>(acpc_state.IsValidAction(
+                  acpc_cpp::ACPCState::ACPCActionType::ACPC_FOLD, 0)));
+          SPIEL_CHECK_EQ(
+              absl::c_linear_search(legal_actions, ActionType::kCall),
+              static_cast<bool>(acpc_state.IsValidAction(
+                  acpc_cpp::ACPCState::ACPCActionType::ACPC_CALL, 0)));
+          int32_t min_raise = 0;
+          int32_t max_raise = 0;
+          const bool valid_to_raise =
+              acpc_state.RaiseIsValid(&min_raise, &max_raise) != 0;
+          if (is_limit) {
+            SPIEL_CHECK_EQ(
+                absl::c_linear_search(legal_actions, ActionType::kBet),
+                valid_to_raise);
+            SPIEL_CHECK_FALSE(
+                absl::c_linear_search(legal_actions, ActionType::kAllIn));
+          } else {
+            const int pot_raise_to = up_state.PotSize();
+            SPIEL_CHECK_EQ(
+                absl::c_linear_search(legal_actions, ActionType::kBet),
+                valid_to_raise && pot_raise_to >= min_raise &&
+                    pot_raise_to <= max_raise);
+            SPIEL_CHECK_EQ(
+                absl::c_linear_search(legal_actions, ActionType::kAllIn),
+                valid_to_raise && pot_raise_to != max_raise);
+            if (absl::c_linear_search(legal_actions, ActionType::kAllIn)) {
+              SPIEL_CHECK_EQ(up_state.AllInSize(), max_raise);
+            }
+          }
+        }
+        std::uniform_int_distribution<int> dist(
+            0, static_cast<int>(legal_actions.size()) - 1);
+        state->ApplyAction(legal_actions[dist(rng)]);
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace universal_poker
 }  // namespace open_spiel
@@ -825,6 +904,7 @@ int main(int argc, char **argv) {
   open_spiel::universal_poker::LoadGameFromDefaultConfig();
   open_spiel::universal_poker::LoadAndRunGameFromGameDef();
   open_spiel::universal_poker::LoadAndRunGameFromDefaultConfig();
+  open_spiel::universal_poker::TestBucketedInformationStates();
   open_spiel::universal_poker::BasicUniversalPokerTests();
   open_spiel::universal_poker::HUNLRegressionTests();
   open_spiel::universal_poker::ChumpPolicyTests();
@@ -841,4 +921,5 @@ int main(int argc, char **argv) {
   open_spiel::universal_poker::TestRandomSubgameCreation();
   open_spiel::universal_poker::TestHalfCallHalfRaise();
   open_spiel::universal_poker::TestFixedPreferenceBots();
+  open_spiel::universal_poker::TestPrecomputedBettingTree();
 }
@@ -0,0 +1,33 @@
+@testset "BulkOps" begin
+
+@testset "run_random_steps" begin
+    game = load_game("tic_tac_toe")
+    state = new_initial_state(game)
+    @test run_random_steps(state, 3, 123) == 3
+    @test length(history(state)) == 3
+    # Runs to the end and reports the number of steps actually taken.
+    @test run_random_steps(state, 100, 456) <= 6
+    @test is_terminal(state)
+end
+
+@testset "collect_observations" begin
+    game = load_game("kuhn_poker")
+    observations = collect_observations(game, 8, 123)
+    obs_size = observation_tensor_size(game)
+    @test length(observations) % obs_size == 0
+    # Every kuhn_poker playthrough has at least two decision nodes.
+    @test length(observations) >= 8 * 2 * obs_size
+end
+
+@testset "evaluate_policy_batch" begin
+    game = load_game("kuhn_poker")
+    policy = get_uniform_policy(game)
+    num_episodes = 16
+    rets = evaluate_policy_batch(game, policy, num_episodes, 123)
+    @test length(rets) == num_episodes * num_players(game)
+    episode_returns = reshape(collect(rets), Int(num_players(game)), :)
+    # kuhn_poker is zero-sum, episode by episode.
+    @test all(isapprox.(sum(episode_returns, dims=1), 0.0; atol=1e-9))
+end
+
+end
@@ -40,4 +40,5 @@ end
     include("bots.jl")
     include("cfr.jl")
     include("trajector.jl")
+    include("bulk_ops.jl")
 end
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cmath>   // for std::nan
+#include <random>
 
 #include "jlcxx/jlcxx.hpp"
 #include "jlcxx/stl.hpp"
@@ -734,6 +735,93 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
                    state, joint_policy, depth_limit);
              });
 
+  // Bulk trajectory operations: each one runs a whole simulation loop on the
+  // C++ side, so a Julia caller pays one wrapper crossing per call instead of
+  // one per state method.
+  mod.method("run_random_steps",
+             [](open_spiel::State& state, int max_steps, int seed) {
+               std::mt19937 rng(seed);
+               std::uniform_real_distribution<double> uniform(0.0, 1.0);
+               int steps = 0;
+               while (steps < max_steps && !state.IsTerminal()) {
+                 open_spiel::Action action;
+                 if (state.IsChanceNode()) {
+                   action = open_spiel::SampleAction(state.ChanceOutcomes(),
+                                                     uniform(rng))
+                                .first;
+                 } else {
+                   std::vector<open_spiel::Action> legal = state.LegalActions();
+                   action = legal[std::uniform_int_distribution<int>(
+                       0, legal.size() - 1)(rng)];
+                 }
+                 state.ApplyAction(action);
+                 ++steps;
+               }
+               // The number of steps actually taken (fewer than max_steps if
+               // a terminal state was reached).
+               return steps;
+             });
+  mod.method(
+      "collect_observations",
+      [](const open_spiel::Game& game, int num_trajectories, int seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        const int obs_size = game.ObservationTensorSize();
+        std::vector<float> observations;
+        for (int t = 0; t < num_trajectories; ++t) {
+          std::unique_ptr<open_spiel::State> state = game.NewInitialState();
+          while (!state->IsTerminal()) {
+            if (state->IsChanceNode()) {
+              state->ApplyAction(
+                  open_spiel::SampleAction(state->ChanceOutcomes(),
+                                           uniform(rng))
+                      .first);
+              continue;
+            }
+            open_spiel::Player player = state->CurrentPlayer();
+            if (player < 0) player = 0;
+            const std::size_t offset = observations.size();
+            observations.resize(offset + obs_size);
+            state->ObservationTensor(
+                player, absl::MakeSpan(observations.data() + offset,
+                                       obs_size));
+            std::vector<open_spiel::Action> legal = state->LegalActions();
+            state->ApplyAction(legal[std::uniform_int_distribution<int>(
+                0, legal.size() - 1)(rng)]);
+          }
+        }
+        // Flat, one observation of obs_size per decision node visited;
+        // reshape to (obs_size, :) on the Julia side.
+        return observations;
+      });
+  mod.method(
+      "evaluate_policy_batch",
+      [](const open_spiel::Game& game, const open_spiel::Policy& policy,
+         int num_episodes, int seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        const int num_players = game.NumPlayers();
+        std::vector<double> returns;
+        returns.reserve(num_episodes * num_players);
+        for (int episode = 0; episode < num_episodes; ++episode) {
+          std::unique_ptr<open_spiel::State> state = game.NewInitialState();
+          while (!state->IsTerminal()) {
+            const open_spiel::ActionsAndProbs actions_and_probs =
+                state->IsChanceNode() ? state->ChanceOutcomes()
+                                      : policy.GetStatePolicy(*state);
+            state->ApplyAction(
+                open_spiel::SampleAction(actions_and_probs, uniform(rng))
+                    .first);
+          }
+          const std::vector<double> episode_returns = state->Returns();
+          returns.insert(returns.end(), episode_returns.begin(),
+                         episode_returns.end());
+        }
+        // Flat, num_players entries per episode; reshape to
+        // (num_players, :) on the Julia side.
+        return returns;
+      });
+
   mod.add_type<open_spiel::algorithms::BatchedTrajectory>("BatchedTrajectory")
       .constructor<int>()
       .method("observations",
@@ -0,0 +1,207 @@
+// Copyright 2022 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/libnop/binary_serialization.h"
+
+#include <nop/serializer.h>
+#include <nop/structure.h>
+#include <nop/utility/stream_reader.h>
+#include <nop/utility/stream_writer.h>
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+constexpr const char* kMagic = "OpenSpielBin";
+
+using Serializer = nop::Serializer<nop::StreamWriter<std::stringstream>>;
+using Deserializer = nop::Deserializer<nop::StreamReader<std::stringstream>>;
+
+// A nop-friendly mirror of GameParameter; recursion through the vector keeps
+// the type complete where libnop needs it.
+struct SerializedParam {
+  int32_t type = -1;
+  bool is_mandatory = false;
+  int64_t int_value = 0;
+  double double_value = 0;
+  bool bool_value = false;
+  std::string string_value;
+  std::vector<std::pair<std::string, SerializedParam>> game_value;
+  NOP_STRUCTURE(SerializedParam, type, is_mandatory, int_value, double_value,
+                bool_value, string_value, game_value);
+};
+
+std::vector<std::pair<std::string, SerializedParam>> ToSerialized(
+    const GameParameters& params);
+
+SerializedParam ToSerialized(const GameParameter& param) {
+  SerializedParam out;
+  out.type = static_cast<int32_t>(param.type());
+  out.is_mandatory = param.is_mandatory();
+  switch (param.type()) {
+    case GameParameter::Type::kUnset: break;
+    case GameParameter::Type::kInt: out.int_value = param.int_value(); break;
+    case GameParameter::Type::kDouble:
+      out.double_value = param.double_value();
+      break;
+    case GameParameter::Type::kString:
+      out.string_value = param.string_value();
+      break;
+    case GameParameter::Type::kBool:
+      out.bool_value = param.bool_value();
+      break;
+    case GameParameter::Type::kGame:
+      out.game_value = ToSerialized(param.game_value());
+      break;
+  }
+  return out;
+}
+
+std::vector<std::pair<std::string, SerializedParam>> ToSerialized(
+    const GameParameters& params) {
+  std::vector<std::pair<std::string, SerializedParam>> out;
+  out.reserve(params.size());
+  for (const auto& [name, param] : params) {
+    out.emplace_back(name, ToSerialized(param));
+  }
+  return out;
+}
+
+GameParameters FromSerialized(
+    const std::vector<std::pair<std::string, SerializedParam>>& params);
+
+GameParameter FromSerialized(const SerializedParam& param) {
+  switch (static_cast<GameParameter::Type>(param.type)) {
+    case GameParameter::Type::kUnset:
+      return GameParameter(GameParameter::Type::kUnset, param.is_mandatory);
+    case GameParameter::Type::kInt:
+      return GameParameter(static_cast<int>(param.int_value),
+                           param.is_mandatory);
+    case GameParameter::Type::kDouble:
+      return GameParameter(param.double_value, param.is_mandatory);
+    case GameParameter::Type::kString:
+      return GameParameter(param.string_value, param.is_mandatory);
+    case GameParameter::Type::kBool:
+      return GameParameter(param.bool_value, param.is_mandatory);
+    case GameParameter::Type::kGame:
+      return GameParameter(FromSerialized(param.game_value),
+                           param.is_mandatory);
+  }
+  SpielFatalError(absl::StrCat("Unknown parameter type: ", param.type));
+}
+
+GameParameters FromSerialized(
+    const std::vector<std::pair<std::string, SerializedParam>>& params) {
+  GameParameters out;
+  for (const auto& [name, param] : params) {
+    out.emplace(name, FromSerialized(param));
+  }
+  return out;
+}
+
+void WriteHeader(Serializer* serializer) {
+  SPIEL_CHECK_TRUE(serializer->Write(std::string(kMagic)));
+  SPIEL_CHECK_TRUE(serializer->Write(kBinarySerializationVersion));
+}
+
+// Checks the magic tag and returns the blob's version, dying on foreign data
+// or a version newer than this binary understands.
+int ReadHeader(Deserializer* deserializer) {
+  std::string magic;
+  int version = -1;
+  SPIEL_CHECK_TRUE(deserializer->Read(&magic));
+  SPIEL_CHECK_EQ(magic, kMagic);
+  SPIEL_CHECK_TRUE(deserializer->Read(&version));
+  SPIEL_CHECK_GE(version, 1);
+  SPIEL_CHECK_LE(version, kBinarySerializationVersion);
+  return version;
+}
+
+}  // namespace
+
+std::string SerializeGameParametersBinary(const GameParameters& params) {
+  Serializer serializer;
+  WriteHeader(&serializer);
+  SPIEL_CHECK_TRUE(serializer.Write(ToSerialized(params)));
+  return serializer.writer().stream().str();
+}
+
+GameParameters DeserializeGameParametersBinary(const std::string& data) {
+  Deserializer deserializer{data};
+  ReadHeader(&deserializer);
+  std::vector<std::pair<std::string, SerializedParam>> params;
+  SPIEL_CHECK_TRUE(deserializer.Read(&params));
+  return FromSerialized(params);
+}
+
+std::string SerializeGameAndStateBinary(const Game& game, const State& state) {
+  Serializer serializer;
+  WriteHeader(&serializer);
+  SPIEL_CHECK_TRUE(serializer.Write(game.Serialize()));
+  SPIEL_CHECK_TRUE(serializer.Write(state.History()));
+  return serializer.writer().stream().str();
+}
+
+std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
+DeserializeGameAndStateBinary(const std::string& data) {
+  Deserializer deserializer{data};
+  ReadHeader(&deserializer);
+  std::string game_string;
+  std::vector<Action> history;
+  SPIEL_CHECK_TRUE(deserializer.Read(&game_string));
+  SPIEL_CHECK_TRUE(deserializer.Read(&history));
+
+  std::shared_ptr<const Game> game = DeserializeGame(game_string);
+  std::unique_ptr<State> state = game->NewInitialState();
+  for (int i = 0; i < history.size();) {
+    if (state->IsSimultaneousNode()) {
+      // The flattened history holds one action per player at a simultaneous
+      // node.
+      std::vector<Action> joint(history.begin() + i,
+                                history.begin() + i + game->NumPlayers());
+      state->ApplyActions(joint);
+      i += game->NumPlayers();
+    } else {
+      state->ApplyAction(history[i]);
+      i += 1;
+    }
+  }
+  return {game, std::move(state)};
+}
+
+std::string SerializeTabularPolicyBinary(const TabularPolicy& policy) {
+  Serializer serializer;
+  WriteHeader(&serializer);
+  SPIEL_CHECK_TRUE(serializer.Write(policy.PolicyTable()));
+  return serializer.writer().stream().str();
+}
+
+TabularPolicy DeserializeTabularPolicyBinary(const std::string& data) {
+  Deserializer deserializer{data};
+  ReadHeader(&deserializer);
+  std::unordered_map<std::string, ActionsAndProbs> table;
+  SPIEL_CHECK_TRUE(deserializer.Read(&table));
+  return TabularPolicy(table);
+}
+
+}  // namespace open_spiel
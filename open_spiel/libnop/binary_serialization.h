@@ -0,0 +1,55 @@
+// Copyright 2022 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_LIBNOP_BINARY_SERIALIZATION_H_
+#define OPEN_SPIEL_LIBNOP_BINARY_SERIALIZATION_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "open_spiel/game_parameters.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+
+// Binary counterparts, via the bundled libnop, of the human-readable
+// serialization in spiel.cc and policy.h: several times smaller on disk and
+// much cheaper to parse for large artifacts such as tabular policies. Every
+// blob starts with a magic tag and a format version, so readers fail loudly
+// on foreign data and old blobs stay loadable when the format grows.
+// Only available when built with OPEN_SPIEL_BUILD_WITH_LIBNOP.
+
+namespace open_spiel {
+
+// The current format version, written at the head of every blob.
+inline constexpr int kBinarySerializationVersion = 1;
+
+// Game parameters, including nested game-valued parameters.
+std::string SerializeGameParametersBinary(const GameParameters& params);
+GameParameters DeserializeGameParametersBinary(const std::string& data);
+
+// A game plus a state, encoded as the game string and the state's action
+// history, like the default text serialization; games whose states cannot be
+// reconstructed by replaying their history must keep the string form.
+std::string SerializeGameAndStateBinary(const Game& game, const State& state);
+std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
+DeserializeGameAndStateBinary(const std::string& data);
+
+// A tabular policy's whole table.
+std::string SerializeTabularPolicyBinary(const TabularPolicy& policy);
+TabularPolicy DeserializeTabularPolicyBinary(const std::string& data);
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_LIBNOP_BINARY_SERIALIZATION_H_
@@ -0,0 +1,102 @@
+// Copyright 2022 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/libnop/binary_serialization.h"
+
+#include <memory>
+#include <string>
+
+#include "open_spiel/game_parameters.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+void TestGameParametersRoundTrip() {
+  GameParameters params = {
+      {"int", GameParameter(3)},
+      {"double", GameParameter(2.5)},
+      {"string", GameParameter(std::string("asdf"))},
+      {"bool", GameParameter(true)},
+      {"game", GameParameter(GameParameters{
+                   {"nested", GameParameter(7, /*is_mandatory=*/true)}})},
+  };
+  GameParameters found =
+      DeserializeGameParametersBinary(SerializeGameParametersBinary(params));
+  SPIEL_CHECK_TRUE(params == found);
+  SPIEL_CHECK_TRUE(found.at("game").game_value().at("nested").is_mandatory());
+}
+
+void TestGameAndStateRoundTrip() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  state->ApplyAction(4);
+  state->ApplyAction(0);
+  state->ApplyAction(8);
+
+  std::string data = SerializeGameAndStateBinary(*game, *state);
+  auto [game2, state2] = DeserializeGameAndStateBinary(data);
+  SPIEL_CHECK_EQ(game2->ToString(), game->ToString());
+  SPIEL_CHECK_EQ(state2->ToString(), state->ToString());
+  SPIEL_CHECK_EQ(state2->History(), state->History());
+
+  // The binary form is smaller than the text form.
+  SPIEL_CHECK_LT(data.size(), SerializeGameAndState(*game, *state).size());
+}
+
+void TestSimultaneousGameAndStateRoundTrip() {
+  std::shared_ptr<const Game> game = LoadGame("matrix_rps");
+  std::unique_ptr<State> state = game->NewInitialState();
+  state->ApplyActions({0, 1});
+
+  auto [game2, state2] = DeserializeGameAndStateBinary(
+      SerializeGameAndStateBinary(*game, *state));
+  SPIEL_CHECK_EQ(state2->History(), state->History());
+  SPIEL_CHECK_TRUE(state2->IsTerminal());
+}
+
+void TestTabularPolicyRoundTrip() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  TabularPolicy policy = GetUniformPolicy(*game);
+  policy.SetProb(policy.PolicyTable().begin()->first, 0, 0.125);
+
+  TabularPolicy found =
+      DeserializeTabularPolicyBinary(SerializeTabularPolicyBinary(policy));
+  SPIEL_CHECK_EQ(found.PolicyTable().size(), policy.PolicyTable().size());
+  for (const auto& [info_state, probs] : policy.PolicyTable()) {
+    SPIEL_CHECK_TRUE(found.GetStatePolicy(info_state) == probs);
+  }
+}
+
+void TestHeaderIsChecked() {
+  std::string data = SerializeGameParametersBinary({});
+  SPIEL_CHECK_GT(data.size(), 0);
+  // A version byte within the accepted range parses; the magic tag guards
+  // against foreign blobs (checked fatally, so not exercised here).
+  GameParameters params = DeserializeGameParametersBinary(data);
+  SPIEL_CHECK_TRUE(params.empty());
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestGameParametersRoundTrip();
+  open_spiel::TestGameAndStateRoundTrip();
+  open_spiel::TestSimultaneousGameAndStateRoundTrip();
+  open_spiel::TestTabularPolicyRoundTrip();
+  open_spiel::TestHeaderIsChecked();
+}
@@ -22,6 +22,7 @@
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/tensor_compression.h"
 
 namespace open_spiel {
 
@@ -221,12 +222,75 @@ Observation::Observation(const Game& game, std::shared_ptr<Observer> observer)
     observer_->WriteTensor(*state, /*player=*/0, &allocator);
     buffer_ = allocator.data();
     tensors_info_ = allocator.tensors_info();
+    if (observer_->HasFixedLayout()) {
+      // Compile the layout: resolve every piece's span into buffer_ once, so
+      // SetFrom just replays them. buffer_ is never resized again, so the
+      // spans stay valid.
+      compiled_allocator_ = std::make_unique<CompiledAllocator>(tensors());
+    }
   }
 }
 
 void Observation::SetFrom(const State& state, int player) {
-  ContiguousAllocator allocator(absl::MakeSpan(buffer_));
-  observer_->WriteTensor(state, player, &allocator);
+  if (compiled_allocator_ != nullptr) {
+    compiled_allocator_->Reset();
+    observer_->WriteTensor(state, player, compiled_allocator_.get());
+  } else {
+    ContiguousAllocator allocator(absl::MakeSpan(buffer_));
+    observer_->WriteTensor(state, player, &allocator);
+  }
+}
+
+BatchedObservation::BatchedObservation(const Game& game,
+                                       std::shared_ptr<Observer> observer,
+                                       int batch_size)
+    : observer_(std::move(observer)), batch_size_(batch_size) {
+  SPIEL_CHECK_GT(batch_size, 0);
+  SPIEL_CHECK_TRUE(observer_->HasTensor());
+  // Get an observation of the initial state to set up the row layout.
+  auto state = game.NewInitialState();
+  TrackingVectorAllocator allocator;
+  observer_->WriteTensor(*state, /*player=*/0, &allocator);
+  tensors_info_ = allocator.tensors_info();
+  row_size_ = allocator.data().size();
+  buffer_.resize(static_cast<std::size_t>(batch_size_) * row_size_, 0);
+  if (observer_->HasFixedLayout()) {
+    // Compile one write plan per row, each resolving the pieces into that
+    // row's slice of the batch buffer.
+    row_allocators_.reserve(batch_size_);
+    for (int row = 0; row < batch_size_; ++row) {
+      std::vector<SpanTensor> tensors;
+      tensors.reserve(tensors_info_.size());
+      absl::Span<float> row_buffer = RowTensor(row);
+      int offset = 0;
+      for (const SpanTensorInfo& info : tensors_info_) {
+        const int size = info.size();
+        tensors.emplace_back(info, row_buffer.subspan(offset, size));
+        offset += size;
+      }
+      row_allocators_.push_back(
+          std::make_unique<CompiledAllocator>(std::move(tensors)));
+    }
+  }
+}
+
+absl::Span<float> BatchedObservation::RowTensor(int row) {
+  SPIEL_CHECK_GE(row, 0);
+  SPIEL_CHECK_LT(row, batch_size_);
+  return absl::MakeSpan(buffer_).subspan(
+      static_cast<std::size_t>(row) * row_size_, row_size_);
+}
+
+void BatchedObservation::SetFrom(const State& state, int player, int row) {
+  if (!row_allocators_.empty()) {
+    SPIEL_CHECK_GE(row, 0);
+    SPIEL_CHECK_LT(row, batch_size_);
+    row_allocators_[row]->Reset();
+    observer_->WriteTensor(state, player, row_allocators_[row].get());
+  } else {
+    ContiguousAllocator allocator(RowTensor(row));
+    observer_->WriteTensor(state, player, &allocator);
+  }
 }
 
 std::vector<SpanTensor> Observation::tensors() {
@@ -241,84 +305,12 @@ std::vector<SpanTensor> Observation::tensors() {
   return result;
 }
 
-// We may in the future support multiple compression schemes.
-// The Compress() method should select the most effective scheme adaptively.
-enum CompressionScheme : char {
-  kCompressionNone,   // We weren't able to compress the data.
-  kCompressionBinary  // Data is binary (all elements zero or one).
-};
-constexpr int kNumHeaderBytes = 1;
-
-// Binary compression.
-struct BinaryCompress {
-  static constexpr int kBitsPerByte = 8;
-
-  static std::string Compress(absl::Span<const float> buffer) {
-    const int num_bytes = (buffer.size() + kBitsPerByte - 1) / kBitsPerByte;
-    std::string str(num_bytes + kNumHeaderBytes, '\0');
-    str[0] = kCompressionBinary;
-
-    for (int i = 0; i < buffer.size(); ++i) {
-      if (buffer[i]) {
-        const int byte = i / kBitsPerByte;
-        const int bit = i % kBitsPerByte;
-        str[kNumHeaderBytes + byte] += (1 << bit);
-      }
-    }
-    return str;
-  }
-
-  static void Decompress(absl::string_view compressed,
-                         absl::Span<float> buffer) {
-    const int num_bytes = (buffer.size() + kBitsPerByte - 1) / kBitsPerByte;
-    absl::c_fill(buffer, 0);
-    SPIEL_CHECK_EQ(compressed.size(), num_bytes + kNumHeaderBytes);
-    for (int byte = 0; byte < num_bytes; ++byte) {
-      for (int bit = 0; bit < kBitsPerByte; ++bit) {
-        if (compressed[kNumHeaderBytes + byte] & (1 << bit)) {
-          buffer[byte * kBitsPerByte + bit] = 1;
-        }
-      }
-    }
-  }
-};
-
-// No compression.
-struct NoCompress {
-  static std::string Compress(absl::Span<const float> buffer) {
-    const int num_bytes = sizeof(float) * buffer.size();
-    std::string str(num_bytes + 1, '\0');
-    str[0] = kCompressionNone;
-    memcpy(&str[kNumHeaderBytes], &buffer[0], num_bytes);
-    return str;
-  }
-
-  static void Decompress(absl::string_view compressed,
-                         absl::Span<float> buffer) {
-    const int num_bytes = sizeof(float) * buffer.size();
-    SPIEL_CHECK_EQ(compressed.size(), num_bytes + kNumHeaderBytes);
-    memcpy(&buffer[0], &compressed[kNumHeaderBytes], num_bytes);
-  }
-};
-
 std::string Observation::Compress() const {
-  const bool data_is_binary =
-      absl::c_all_of(buffer_, [](float x) { return x == 0 || x == 1; });
-  return data_is_binary ? BinaryCompress::Compress(buffer_)
-                        : NoCompress::Compress(buffer_);
+  return CompressTensor(buffer_);
 }
 
 void Observation::Decompress(absl::string_view compressed) {
-  SPIEL_CHECK_GT(compressed.size(), 0);
-  switch (compressed[0]) {
-    case kCompressionBinary:
-      return BinaryCompress::Decompress(compressed, absl::MakeSpan(buffer_));
-    case kCompressionNone:
-      return NoCompress::Decompress(compressed, absl::MakeSpan(buffer_));
-    default:
-      SpielFatalError(absl::StrCat("Unrecognized compression scheme in '",
-                                   compressed, "'"));
-  }
+  DecompressTensor(compressed, absl::MakeSpan(buffer_));
 }
 
 bool IIGObservationType::operator==(const IIGObservationType& other) {
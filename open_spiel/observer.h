@@ -41,6 +41,7 @@
 // for accessing pieces of the observation tensor by name. See `observation.py`
 // and `observation_test.py`.
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -184,6 +185,43 @@ class ContiguousAllocator : public Allocator {
   int offset_;
 };
 
+// Replays a tensor layout that was resolved ("compiled") once up front:
+// Get() hands out pre-computed spans in call order instead of re-deriving
+// sizes and offsets from names and shapes on every observation. Used by
+// Observation::SetFrom after it has recorded the observer's layout; in small
+// games the per-piece bookkeeping of ContiguousAllocator costs more than the
+// actual tensor writes. Only valid for observers with a fixed layout (see
+// Observer::HasFixedLayout); in debug builds each Get() is checked against
+// the recorded layout.
+class CompiledAllocator : public Allocator {
+ public:
+  // `tensors` must be the spans handed out by a recording pass over the same
+  // buffer, in Get() call order.
+  explicit CompiledAllocator(std::vector<SpanTensor> tensors)
+      : tensors_(std::move(tensors)) {}
+
+  // Rewinds the replay to the first tensor and zeroes all spans, ready for
+  // the next observation.
+  void Reset() {
+    next_ = 0;
+    for (const SpanTensor& tensor : tensors_) {
+      absl::Span<float> data = tensor.data();
+      std::fill(data.begin(), data.end(), 0.f);
+    }
+  }
+
+  SpanTensor Get(absl::string_view name,
+                 const absl::InlinedVector<int, 4>& shape) override {
+    SPIEL_DCHECK_LT(next_, tensors_.size());
+    SPIEL_DCHECK_EQ(tensors_[next_].info().name(), std::string(name));
+    return tensors_[next_++];
+  }
+
+ private:
+  std::vector<SpanTensor> tensors_;
+  int next_ = 0;
+};
+
 // Allocates new memory for each allocation request and keeps track
 // of tensor names and shapes. This is intended to use when it's not yet
 // known how much memory an observation consumes.
@@ -338,6 +376,13 @@ class Observer {
   bool HasString() const { return has_string_; }
   bool HasTensor() const { return has_tensor_; }
 
+  // Whether WriteTensor requests the same tensor pieces, in the same order
+  // with the same shapes, for every state and player. This is true of all
+  // built-in and game-specific observers today, and lets Observation compile
+  // the layout once and replay it per state; an observer whose layout
+  // depends on the state must override this to return false.
+  virtual bool HasFixedLayout() const { return true; }
+
   virtual ~Observer() = default;
 
  protected:
@@ -404,6 +449,47 @@ class Observation {
   std::shared_ptr<Observer> observer_;
   std::vector<float> buffer_;
   std::vector<SpanTensorInfo> tensors_info_;
+  // The compiled write plan over buffer_, when the observer has a fixed
+  // layout; null otherwise (SetFrom then falls back to ContiguousAllocator).
+  std::unique_ptr<CompiledAllocator> compiled_allocator_;
+};
+
+// Holds an Observer and a single contiguous buffer for a fixed-size batch of
+// observations. Row i of the batch is written in place by pointing the
+// observer at the corresponding slice of the buffer, so assembling a large
+// inference or training batch involves no intermediate copies: the buffer can
+// be handed directly to the consumer (e.g. wrapped as a torch tensor).
+class BatchedObservation {
+ public:
+  BatchedObservation(const Game& game, std::shared_ptr<Observer> observer,
+                     int batch_size);
+
+  // Writes the observation for `state` and `player` into row `row` of the
+  // batch buffer.
+  void SetFrom(const State& state, int player, int row);
+
+  // The whole batch buffer, of size batch_size() * row_size().
+  absl::Span<float> Tensor() { return absl::MakeSpan(buffer_); }
+
+  // The slice of the buffer holding row `row`.
+  absl::Span<float> RowTensor(int row);
+
+  // Describes the observation components of a single row.
+  const std::vector<SpanTensorInfo>& tensors_info() const {
+    return tensors_info_;
+  }
+
+  int batch_size() const { return batch_size_; }
+  int row_size() const { return row_size_; }
+
+ private:
+  std::shared_ptr<Observer> observer_;
+  int batch_size_;
+  int row_size_;
+  std::vector<float> buffer_;
+  std::vector<SpanTensorInfo> tensors_info_;
+  // One compiled write plan per row, when the observer has a fixed layout.
+  std::vector<std::unique_ptr<CompiledAllocator>> row_allocators_;
 };
 
 // Allows to register observers to a game. Usage:
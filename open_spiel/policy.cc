@@ -15,6 +15,9 @@
 #include "open_spiel/policy.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <random>
@@ -26,6 +29,7 @@
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
 #include "open_spiel/abseil-cpp/absl/container/node_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/strings/charconv.h"
 #include "open_spiel/abseil-cpp/absl/strings/numbers.h"
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
@@ -195,6 +199,235 @@ std::unique_ptr<TabularPolicy> DeserializeTabularPolicy(
   return res;
 }
 
+namespace {
+
+// Binary policy file layout: a BinaryPolicyHeader followed by the columns at
+// the byte offsets it records. All offsets are from the start of the file
+// and 8-byte aligned, so the mapped columns can be read through typed
+// pointers directly.
+struct BinaryPolicyHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t probability_bits;
+  uint32_t reserved;
+  uint64_t num_states;
+  uint64_t key_offsets_offset;
+  uint64_t key_blob_offset;
+  uint64_t row_offsets_offset;
+  uint64_t action_offsets_offset;
+  uint64_t action_blob_offset;
+  uint64_t prob_blob_offset;
+};
+static_assert(sizeof(BinaryPolicyHeader) % 8 == 0,
+              "Columns after the header must stay 8-byte aligned.");
+
+constexpr char kBinaryPolicyMagic[4] = {'O', 'S', 'T', 'P'};
+constexpr uint32_t kBinaryPolicyVersion = 1;
+
+void AppendVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+uint64_t ParseVarint(const uint8_t** cursor) {
+  uint64_t value = 0;
+  int shift = 0;
+  while (true) {
+    const uint8_t byte = *(*cursor)++;
+    value |= uint64_t{byte & 0x7f} << shift;
+    if ((byte & 0x80) == 0) return value;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+void SaveTabularPolicyBinary(const TabularPolicy& policy,
+                             const std::string& filename,
+                             int probability_bits) {
+  SPIEL_CHECK_TRUE(probability_bits == 8 || probability_bits == 16 ||
+                   probability_bits == 32);
+  const std::unordered_map<std::string, ActionsAndProbs>& table =
+      policy.PolicyTable();
+
+  // Sorted keys make the reader's lookup a binary search over the key column.
+  std::vector<const std::pair<const std::string, ActionsAndProbs>*> rows;
+  rows.reserve(table.size());
+  for (const auto& kv : table) rows.push_back(&kv);
+  std::sort(rows.begin(), rows.end(),
+            [](const auto* a, const auto* b) { return a->first < b->first; });
+
+  const uint64_t quant_max = (uint64_t{1} << probability_bits) - 1;
+  std::string key_blob;
+  std::string action_blob;
+  std::string prob_blob;
+  std::vector<uint64_t> key_offsets = {0};
+  std::vector<uint64_t> row_offsets = {0};
+  std::vector<uint64_t> action_offsets = {0};
+  key_offsets.reserve(rows.size() + 1);
+  row_offsets.reserve(rows.size() + 1);
+  action_offsets.reserve(rows.size() + 1);
+
+  ActionsAndProbs sorted_policy;
+  for (const auto* row : rows) {
+    key_blob.append(row->first);
+    key_offsets.push_back(key_blob.size());
+
+    sorted_policy.assign(row->second.begin(), row->second.end());
+    absl::c_sort(sorted_policy, [](const std::pair<Action, double>& a,
+                                   const std::pair<Action, double>& b) {
+      return a.first < b.first;
+    });
+    row_offsets.push_back(row_offsets.back() + sorted_policy.size());
+
+    Action previous = 0;
+    for (const auto& [action, prob] : sorted_policy) {
+      SPIEL_CHECK_GE(action, previous);  // Sorted, non-negative actions.
+      AppendVarint(action - previous, &action_blob);
+      previous = action;
+      const double clamped = std::min(std::max(prob, 0.), 1.);
+      const uint64_t quantized =
+          static_cast<uint64_t>(std::llround(clamped * quant_max));
+      if (probability_bits == 8) {
+        const uint8_t value = quantized;
+        prob_blob.append(reinterpret_cast<const char*>(&value), sizeof(value));
+      } else if (probability_bits == 16) {
+        const uint16_t value = quantized;
+        prob_blob.append(reinterpret_cast<const char*>(&value), sizeof(value));
+      } else {
+        const uint32_t value = quantized;
+        prob_blob.append(reinterpret_cast<const char*>(&value), sizeof(value));
+      }
+    }
+    action_offsets.push_back(action_blob.size());
+  }
+
+  // Assemble: header, then the columns, each padded to an 8-byte boundary.
+  std::string body;
+  auto append_column = [&body](const char* data, size_t size) -> uint64_t {
+    while (body.size() % 8 != 0) body.push_back('\0');
+    const uint64_t offset = sizeof(BinaryPolicyHeader) + body.size();
+    body.append(data, size);
+    return offset;
+  };
+  auto append_offsets = [&append_column](
+                            const std::vector<uint64_t>& offsets) -> uint64_t {
+    return append_column(reinterpret_cast<const char*>(offsets.data()),
+                         offsets.size() * sizeof(uint64_t));
+  };
+
+  BinaryPolicyHeader header = {};
+  std::copy(std::begin(kBinaryPolicyMagic), std::end(kBinaryPolicyMagic),
+            header.magic);
+  header.version = kBinaryPolicyVersion;
+  header.probability_bits = probability_bits;
+  header.num_states = rows.size();
+  header.key_offsets_offset = append_offsets(key_offsets);
+  header.key_blob_offset = append_column(key_blob.data(), key_blob.size());
+  header.row_offsets_offset = append_offsets(row_offsets);
+  header.action_offsets_offset = append_offsets(action_offsets);
+  header.action_blob_offset =
+      append_column(action_blob.data(), action_blob.size());
+  header.prob_blob_offset = append_column(prob_blob.data(), prob_blob.size());
+
+  file::File file(filename, "wb");
+  SPIEL_CHECK_TRUE(file.Write(absl::string_view(
+      reinterpret_cast<const char*>(&header), sizeof(header))));
+  SPIEL_CHECK_TRUE(file.Write(body));
+}
+
+MmapTabularPolicy::MmapTabularPolicy(const std::string& filename)
+    : file_(std::make_shared<file::MappedFile>(filename)) {
+  const absl::string_view contents = file_->contents();
+  SPIEL_CHECK_GE(contents.size(), sizeof(BinaryPolicyHeader));
+  BinaryPolicyHeader header;
+  std::memcpy(&header, contents.data(), sizeof(header));
+  SPIEL_CHECK_TRUE(std::equal(std::begin(kBinaryPolicyMagic),
+                              std::end(kBinaryPolicyMagic), header.magic));
+  SPIEL_CHECK_EQ(header.version, kBinaryPolicyVersion);
+  SPIEL_CHECK_TRUE(header.probability_bits == 8 ||
+                   header.probability_bits == 16 ||
+                   header.probability_bits == 32);
+  probability_bits_ = header.probability_bits;
+  num_states_ = header.num_states;
+
+  const char* base = contents.data();
+  auto column = [&](uint64_t offset) {
+    SPIEL_CHECK_LE(offset, contents.size());
+    return base + offset;
+  };
+  key_offsets_ =
+      reinterpret_cast<const uint64_t*>(column(header.key_offsets_offset));
+  key_blob_ = column(header.key_blob_offset);
+  row_offsets_ =
+      reinterpret_cast<const uint64_t*>(column(header.row_offsets_offset));
+  action_offsets_ =
+      reinterpret_cast<const uint64_t*>(column(header.action_offsets_offset));
+  action_blob_ =
+      reinterpret_cast<const uint8_t*>(column(header.action_blob_offset));
+  prob_blob_ =
+      reinterpret_cast<const uint8_t*>(column(header.prob_blob_offset));
+  // The probability column is the last one; check it fits in the file.
+  SPIEL_CHECK_LE(header.prob_blob_offset + row_offsets_[num_states_] *
+                                               (probability_bits_ / 8),
+                 contents.size());
+}
+
+int64_t MmapTabularPolicy::FindRow(absl::string_view info_state) const {
+  int64_t lo = 0;
+  int64_t hi = num_states_;
+  while (lo < hi) {
+    const int64_t mid = (lo + hi) / 2;
+    const absl::string_view key(key_blob_ + key_offsets_[mid],
+                                key_offsets_[mid + 1] - key_offsets_[mid]);
+    if (key < info_state) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == num_states_) return -1;
+  const absl::string_view key(key_blob_ + key_offsets_[lo],
+                              key_offsets_[lo + 1] - key_offsets_[lo]);
+  return key == info_state ? lo : -1;
+}
+
+ActionsAndProbs MmapTabularPolicy::GetStatePolicy(
+    const std::string& info_state) const {
+  ActionsAndProbs state_policy;
+  GetStatePolicy(info_state, &state_policy);
+  return state_policy;
+}
+
+void MmapTabularPolicy::GetStatePolicy(const std::string& info_state,
+                                       ActionsAndProbs* out) const {
+  out->clear();
+  const int64_t row = FindRow(info_state);
+  if (row < 0) return;
+  const uint64_t begin = row_offsets_[row];
+  const uint64_t end = row_offsets_[row + 1];
+  out->reserve(end - begin);
+  const uint8_t* cursor = action_blob_ + action_offsets_[row];
+  const double quant_max = (uint64_t{1} << probability_bits_) - 1;
+  Action action = 0;
+  for (uint64_t i = begin; i < end; ++i) {
+    action += ParseVarint(&cursor);
+    double prob;
+    if (probability_bits_ == 8) {
+      prob = prob_blob_[i] / quant_max;
+    } else if (probability_bits_ == 16) {
+      prob = reinterpret_cast<const uint16_t*>(prob_blob_)[i] / quant_max;
+    } else {
+      prob = reinterpret_cast<const uint32_t*>(prob_blob_)[i] / quant_max;
+    }
+    out->emplace_back(action, prob);
+  }
+  SPIEL_DCHECK_EQ(cursor, action_blob_ + action_offsets_[row + 1]);
+}
+
 std::string TabularPolicy::ToString() const {
   std::string str = "";
   for (const auto& infostate_and_policy : policy_table_) {
@@ -230,46 +463,106 @@ std::string TabularPolicy::ToStringSorted() const {
 
 PartialTabularPolicy::PartialTabularPolicy()
     : TabularPolicy(),
-      fallback_policy_(std::make_shared<UniformPolicy>()) {}
+      fallback_policy_(std::make_shared<UniformPolicy>()) {
+  RebuildFilter();
+}
 
 PartialTabularPolicy::PartialTabularPolicy(
       const std::unordered_map<std::string, ActionsAndProbs>& table)
     : TabularPolicy(table),
-      fallback_policy_(std::make_shared<UniformPolicy>()) {}
+      fallback_policy_(std::make_shared<UniformPolicy>()) {
+  RebuildFilter();
+}
 
 PartialTabularPolicy::PartialTabularPolicy(
       const std::unordered_map<std::string, ActionsAndProbs>& table,
       std::shared_ptr<Policy> fallback_policy)
     : TabularPolicy(table),
-      fallback_policy_(fallback_policy) {}
+      fallback_policy_(fallback_policy) {
+  RebuildFilter();
+}
+
+namespace {
+// Ten bits per key with two probes per lookup gives a false-positive rate of
+// a few percent; a false positive only costs the map lookup that would have
+// happened anyway.
+constexpr int kFilterBitsPerKey = 10;
+}  // namespace
+
+void PartialTabularPolicy::RebuildFilter() {
+  uint64_t num_bits = 64;
+  while (num_bits < policy_table_.size() * kFilterBitsPerKey) num_bits *= 2;
+  filter_bits_.assign(num_bits / 64, 0);
+  filter_mask_ = num_bits - 1;
+  for (const auto& kv : policy_table_) AddToFilter(kv.first);
+}
+
+void PartialTabularPolicy::AddToFilter(absl::string_view info_state) {
+  const uint64_t hash = absl::Hash<absl::string_view>()(info_state);
+  const uint64_t bit1 = hash & filter_mask_;
+  const uint64_t bit2 = (hash >> 32) & filter_mask_;
+  filter_bits_[bit1 / 64] |= uint64_t{1} << (bit1 % 64);
+  filter_bits_[bit2 / 64] |= uint64_t{1} << (bit2 % 64);
+}
+
+bool PartialTabularPolicy::MaybeInTable(absl::string_view info_state) const {
+  const uint64_t hash = absl::Hash<absl::string_view>()(info_state);
+  const uint64_t bit1 = hash & filter_mask_;
+  const uint64_t bit2 = (hash >> 32) & filter_mask_;
+  return (filter_bits_[bit1 / 64] >> (bit1 % 64)) &
+         (filter_bits_[bit2 / 64] >> (bit2 % 64)) & 1;
+}
+
+void PartialTabularPolicy::SetStatePolicy(const std::string& info_state,
+                                          const ActionsAndProbs& state_policy) {
+  TabularPolicy::SetStatePolicy(info_state, state_policy);
+  AddToFilter(info_state);
+}
+
+void PartialTabularPolicy::SetProb(const std::string& info_state, Action action,
+                                   double prob) {
+  TabularPolicy::SetProb(info_state, action, prob);
+  AddToFilter(info_state);
+}
 
 ActionsAndProbs PartialTabularPolicy::GetStatePolicy(const State& state) const {
-  auto iter = policy_table_.find(state.InformationStateString());
-  if (iter == policy_table_.end()) {
-    return fallback_policy_->GetStatePolicy(state);
-  } else {
-    return iter->second;
+  const std::string info_state = state.InformationStateString();
+  if (MaybeInTable(info_state)) {
+    auto iter = policy_table_.find(info_state);
+    if (iter != policy_table_.end()) return iter->second;
   }
+  return fallback_policy_->GetStatePolicy(state);
 }
 
 ActionsAndProbs PartialTabularPolicy::GetStatePolicy(const State& state,
                                                      Player player) const {
-  auto iter = policy_table_.find(state.InformationStateString(player));
-  if (iter == policy_table_.end()) {
-    return fallback_policy_->GetStatePolicy(state);
-  } else {
-    return iter->second;
+  const std::string info_state = state.InformationStateString(player);
+  if (MaybeInTable(info_state)) {
+    auto iter = policy_table_.find(info_state);
+    if (iter != policy_table_.end()) return iter->second;
   }
+  return fallback_policy_->GetStatePolicy(state);
 }
 
 ActionsAndProbs PartialTabularPolicy::GetStatePolicy(
     const std::string& info_state) const {
-  auto iter = policy_table_.find(info_state);
-  if (iter == policy_table_.end()) {
-    return fallback_policy_->GetStatePolicy(info_state);
-  } else {
-    return iter->second;
+  if (MaybeInTable(info_state)) {
+    auto iter = policy_table_.find(info_state);
+    if (iter != policy_table_.end()) return iter->second;
+  }
+  return fallback_policy_->GetStatePolicy(info_state);
+}
+
+void PartialTabularPolicy::GetStatePolicy(const std::string& info_state,
+                                          ActionsAndProbs* out) const {
+  if (MaybeInTable(info_state)) {
+    auto iter = policy_table_.find(info_state);
+    if (iter != policy_table_.end()) {
+      out->assign(iter->second.begin(), iter->second.end());
+      return;
+    }
   }
+  fallback_policy_->GetStatePolicy(info_state, out);
 }
 
 TabularPolicy GetEmptyTabularPolicy(const Game& game,
@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_POLICY_H_
 #define OPEN_SPIEL_POLICY_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -22,8 +23,11 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
 #include "open_spiel/utils/serialization.h"
 
 namespace open_spiel {
@@ -133,6 +137,25 @@ class Policy {
     SpielFatalError("GetStatePolicy(const std::string&) unimplemented.");
   }
 
+  // In-place variants of the accessors above, filling a caller-provided
+  // vector rather than returning a fresh one. Sampling loops (e.g. MCCFR
+  // trajectories) that query a policy once per node should reuse a single
+  // vector across calls: its capacity is retained, so steady-state queries
+  // allocate nothing. Subclasses whose storage permits it should override
+  // these to write directly into `out`; the defaults fall back on the
+  // by-value accessors.
+  virtual void GetStatePolicy(const State& state, ActionsAndProbs* out) const {
+    *out = GetStatePolicy(state);
+  }
+  virtual void GetStatePolicy(const State& state, Player player,
+                              ActionsAndProbs* out) const {
+    *out = GetStatePolicy(state, player);
+  }
+  virtual void GetStatePolicy(const std::string& info_state,
+                              ActionsAndProbs* out) const {
+    *out = GetStatePolicy(info_state);
+  }
+
   // Each override must write out the class’s identity followed by ":" as the
   // very first thing so that the DeserializePolicy method can then call the
   // Deserialize method for the correct subclass. See TabularPolicy and
@@ -195,6 +218,18 @@ class TabularPolicy : public Policy {
     }
   }
 
+  // In-place variant: assigns into the caller's vector so that repeated
+  // queries reuse its capacity instead of allocating a fresh vector.
+  void GetStatePolicy(const std::string& info_state,
+                      ActionsAndProbs* out) const override {
+    auto iter = policy_table_.find(info_state);
+    if (iter == policy_table_.end()) {
+      out->clear();
+    } else {
+      out->assign(iter->second.begin(), iter->second.end());
+    }
+  }
+
   std::string Serialize(int double_precision = -1,
                         std::string delimiter = "<~>") const override {
     SPIEL_CHECK_GE(double_precision, -1);
@@ -279,6 +314,99 @@ class TabularPolicy : public Policy {
   std::unordered_map<std::string, ActionsAndProbs> policy_table_;
 };
 
+// A tabular policy tuned for large tables and hot lookup loops. Info-state
+// strings are interned into dense ids: each key is stored once, in an
+// open-addressing map (no per-node allocations, unlike the
+// std::unordered_map backing TabularPolicy), and the id -> state-policy
+// table is a plain vector. Lookups by string hash the key once;
+// callers that probe the same states repeatedly (best response,
+// exploitability, CFR averaging) should intern once and then probe by id,
+// which is an array index. String lookups accept string_view, so probing
+// never copies the key.
+class InternedTabularPolicy : public Policy {
+ public:
+  InternedTabularPolicy() = default;
+
+  // Bulk construction: reserves the map and table once and moves the entries
+  // in. The input need not be sorted; entries with duplicate keys overwrite
+  // earlier ones.
+  explicit InternedTabularPolicy(
+      std::vector<std::pair<std::string, ActionsAndProbs>> entries) {
+    ids_.reserve(entries.size());
+    policies_.reserve(entries.size());
+    for (auto& [info_state, state_policy] : entries) {
+      SetStatePolicyById(Intern(info_state), std::move(state_policy));
+    }
+  }
+
+  explicit InternedTabularPolicy(const TabularPolicy& policy) {
+    ids_.reserve(policy.PolicyTable().size());
+    policies_.reserve(policy.PolicyTable().size());
+    for (const auto& [info_state, state_policy] : policy.PolicyTable()) {
+      SetStatePolicyById(Intern(info_state), state_policy);
+    }
+  }
+
+  // Returns the dense id for the info state, interning it if absent. New ids
+  // are assigned consecutively from 0, and an interned state starts with an
+  // empty policy.
+  int Intern(absl::string_view info_state) {
+    auto [iter, inserted] = ids_.emplace(info_state, policies_.size());
+    if (inserted) policies_.emplace_back();
+    return iter->second;
+  }
+
+  // Returns the id for the info state, or -1 if it has not been interned.
+  int Find(absl::string_view info_state) const {
+    auto iter = ids_.find(info_state);
+    return iter == ids_.end() ? -1 : iter->second;
+  }
+
+  const ActionsAndProbs& StatePolicyById(int id) const {
+    return policies_[id];
+  }
+
+  void SetStatePolicyById(int id, ActionsAndProbs state_policy) {
+    policies_[id] = std::move(state_policy);
+  }
+
+  void SetStatePolicy(absl::string_view info_state,
+                      ActionsAndProbs state_policy) {
+    SetStatePolicyById(Intern(info_state), std::move(state_policy));
+  }
+
+  ActionsAndProbs GetStatePolicy(const std::string& info_state) const override {
+    int id = Find(info_state);
+    return id < 0 ? ActionsAndProbs() : policies_[id];
+  }
+
+  void GetStatePolicy(const std::string& info_state,
+                      ActionsAndProbs* out) const override {
+    int id = Find(info_state);
+    if (id < 0) {
+      out->clear();
+    } else {
+      out->assign(policies_[id].begin(), policies_[id].end());
+    }
+  }
+
+  // Copies the table out into the map-backed representation, for interop
+  // with code that consumes TabularPolicy.
+  TabularPolicy ToTabularPolicy() const {
+    TabularPolicy policy;
+    for (const auto& [info_state, id] : ids_) {
+      policy.SetStatePolicy(info_state, policies_[id]);
+    }
+    return policy;
+  }
+
+  int size() const { return policies_.size(); }
+
+ private:
+  absl::flat_hash_map<std::string, int> ids_;
+  std::vector<ActionsAndProbs> policies_;
+};
+
 // A partial tabular policy is one that is not entirely complete: only a subset
 // of the full table is included. When called on state that is not in the table,
 // a specific fallback policy is queried instead.
@@ -300,19 +428,92 @@ class PartialTabularPolicy : public TabularPolicy {
 
   // These retrieval methods are all modified in the same way: they first check
   // if the key is in the table. If so, they return the state policy from the
-  // table. Otherwise, they forward the call to the fallback policy.
+  // table. Otherwise, they forward the call to the fallback policy. A
+  // compact membership filter over the table's keys is consulted before the
+  // map, so the overwhelmingly-common miss case (hybrid tabular+neural
+  // setups) costs one cheap hash and two bit tests instead of a full failed
+  // hash-map lookup; false positives just fall through to the map.
   ActionsAndProbs GetStatePolicy(const State& state) const override;
   ActionsAndProbs GetStatePolicy(const State& state,
                                  Player player) const override;
   ActionsAndProbs GetStatePolicy(const std::string& info_state) const override;
 
+  // In-place variant: fills the caller's vector from the table or the
+  // fallback, reusing its capacity.
+  void GetStatePolicy(const std::string& info_state,
+                      ActionsAndProbs* out) const override;
+
+  // Table mutations must go through these (shadowing the TabularPolicy
+  // methods) to keep the membership filter in sync; keys added directly via
+  // PolicyTable() would be routed to the fallback policy.
+  void SetStatePolicy(const std::string& info_state,
+                      const ActionsAndProbs& state_policy);
+  void SetProb(const std::string& info_state, Action action, double prob);
+
  private:
+  // Blocked bloom-style filter: two bits per key from one 64-bit hash, sized
+  // at ~10 bits/key (power of two), giving a few percent false positives.
+  void RebuildFilter();
+  void AddToFilter(absl::string_view info_state);
+  bool MaybeInTable(absl::string_view info_state) const;
+
   std::shared_ptr<Policy> fallback_policy_;
+  std::vector<uint64_t> filter_bits_;
+  uint64_t filter_mask_ = 0;
 };
 
 std::unique_ptr<TabularPolicy> DeserializeTabularPolicy(
     const std::string& serialized, std::string delimiter = "<~>");
 
+// Binary columnar format for large saved tabular policies. Unlike
+// Serialize/DeserializeTabularPolicy, which emit delimited text and must
+// parse the whole file before the first query, this stores sorted interned
+// infostate keys, delta-encoded action lists and fixed-point probabilities
+// in separate columns, and the reader memory-maps the file: queries fault in
+// only the pages they touch, so a bot can start answering before the full
+// policy is resident.
+//
+// probability_bits selects the fixed-point quantization (8, 16 or 32 bits
+// per probability); 16 bits keeps probabilities within ~1.5e-5 of the
+// original. Action lists are re-sorted in ascending action order. The format
+// uses the native byte order and is not an interchange format.
+void SaveTabularPolicyBinary(const TabularPolicy& policy,
+                             const std::string& filename,
+                             int probability_bits = 16);
+
+// A read-only Policy backed by a memory-mapped file written by
+// SaveTabularPolicyBinary. Lookups binary-search the sorted key column;
+// unknown infostates return an empty list, like TabularPolicy.
+class MmapTabularPolicy : public Policy {
+ public:
+  explicit MmapTabularPolicy(const std::string& filename);
+
+  ActionsAndProbs GetStatePolicy(const std::string& info_state) const override;
+  void GetStatePolicy(const std::string& info_state,
+                      ActionsAndProbs* out) const override;
+
+  int64_t size() const { return num_states_; }
+
+ private:
+  // Returns the row index of info_state, or -1 if absent.
+  int64_t FindRow(absl::string_view info_state) const;
+
+  std::shared_ptr<file::MappedFile> file_;
+  int64_t num_states_ = 0;
+  int probability_bits_ = 0;
+  // Columns, pointing into the mapping. Key i is
+  // key_blob_[key_offsets_[i] .. key_offsets_[i + 1]); its row spans entries
+  // row_offsets_[i] .. row_offsets_[i + 1]) of the probability column and
+  // bytes action_offsets_[i] .. action_offsets_[i + 1]) of the varint-coded
+  // action column.
+  const uint64_t* key_offsets_ = nullptr;
+  const char* key_blob_ = nullptr;
+  const uint64_t* row_offsets_ = nullptr;
+  const uint64_t* action_offsets_ = nullptr;
+  const uint8_t* action_blob_ = nullptr;
+  const uint8_t* prob_blob_ = nullptr;
+};
+
 // Chooses all legal actions with equal probability. This is equivalent to the
 // tabular version, except that this works for large games.
 class UniformPolicy : public Policy {
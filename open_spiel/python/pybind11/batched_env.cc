@@ -0,0 +1,177 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/python/pybind11/batched_env.h"
+
+// Python bindings for vectorized multi-state stepping.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/python/pybind11/pybind11.h"
+
+namespace open_spiel {
+namespace {
+
+namespace py = ::pybind11;
+
+// A batch of states of one game, stepped together so that Python RL loops
+// cross the binding boundary once per step instead of once per environment.
+// All stepping and stacking runs in C++ with the GIL released; actions arrive
+// as one sequence (a numpy array converts) and rewards, dones, observations
+// and legal-action masks come back stacked.
+class BatchedEnv {
+ public:
+  BatchedEnv(std::shared_ptr<const Game> game, int batch_size, bool auto_reset)
+      : game_(std::move(game)),
+        num_players_(game_->NumPlayers()),
+        obs_size_(game_->GetType().provides_observation_tensor
+                      ? game_->ObservationTensorSize()
+                      : 0),
+        auto_reset_(auto_reset),
+        rewards_(batch_size * num_players_, 0.0),
+        dones_(batch_size, 0) {
+    SPIEL_CHECK_GT(batch_size, 0);
+    states_.reserve(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+      states_.push_back(game_->NewInitialState());
+    }
+  }
+
+  int BatchSize() const { return states_.size(); }
+  int NumPlayers() const { return num_players_; }
+  int ObservationSize() const { return obs_size_; }
+
+  void Reset() {
+    for (auto& state : states_) state = game_->NewInitialState();
+    std::fill(rewards_.begin(), rewards_.end(), 0.0);
+    std::fill(dones_.begin(), dones_.end(), 0);
+  }
+
+  void ResetAt(int index) {
+    states_.at(index) = game_->NewInitialState();
+    std::fill_n(rewards_.begin() + index * num_players_, num_players_, 0.0);
+    dones_.at(index) = 0;
+  }
+
+  // One vectorized step: applies actions[i] to the i-th environment
+  // (kInvalidAction leaves it untouched) and records its rewards and done
+  // flag. With auto_reset, environments reaching a terminal state are
+  // restarted afterwards; their recorded rewards and dones still reflect the
+  // terminal step, while subsequent observations come from the new episode.
+  void Step(const std::vector<Action>& actions) {
+    SPIEL_CHECK_EQ(actions.size(), states_.size());
+    for (int i = 0; i < states_.size(); ++i) {
+      State& state = *states_[i];
+      if (actions[i] != kInvalidAction && !state.IsTerminal()) {
+        state.ApplyAction(actions[i]);
+      }
+      std::vector<double> rewards = state.Rewards();
+      SPIEL_CHECK_EQ(rewards.size(), num_players_);
+      std::copy(rewards.begin(), rewards.end(),
+                rewards_.begin() + i * num_players_);
+      const bool done = state.IsTerminal();
+      dones_[i] = done ? 1 : 0;
+      if (done && auto_reset_) states_[i] = game_->NewInitialState();
+    }
+  }
+
+  // Rewards of the last step, flat [batch_size, num_players].
+  const std::vector<double>& Rewards() const { return rewards_; }
+
+  // Whether each environment finished on the last step.
+  const std::vector<uint8_t>& Dones() const { return dones_; }
+
+  std::vector<int> CurrentPlayers() const {
+    std::vector<int> players(states_.size());
+    for (int i = 0; i < states_.size(); ++i) {
+      players[i] = states_[i]->CurrentPlayer();
+    }
+    return players;
+  }
+
+  // Flat [batch_size, observation size] tensors, observed by each
+  // environment's current player (player 0 where no player is to act).
+  std::vector<float> ObservationTensors() const {
+    SPIEL_CHECK_GT(obs_size_, 0);
+    std::vector<float> observations(states_.size() * obs_size_, 0.0);
+    auto all = absl::MakeSpan(observations);
+    for (int i = 0; i < states_.size(); ++i) {
+      Player player = states_[i]->CurrentPlayer();
+      if (player < 0) player = 0;
+      states_[i]->ObservationTensor(player,
+                                    all.subspan(i * obs_size_, obs_size_));
+    }
+    return observations;
+  }
+
+  // Flat [batch_size, num_distinct_actions] legal-action masks for the
+  // current players; all-zero rows for environments at chance or terminal
+  // nodes.
+  std::vector<int> LegalActionsMasks() const {
+    const int num_actions = game_->NumDistinctActions();
+    std::vector<int> masks(states_.size() * num_actions, 0);
+    for (int i = 0; i < states_.size(); ++i) {
+      const Player player = states_[i]->CurrentPlayer();
+      if (player < 0) continue;
+      std::vector<int> mask = states_[i]->LegalActionsMask(player);
+      std::copy(mask.begin(), mask.end(), masks.begin() + i * num_actions);
+    }
+    return masks;
+  }
+
+  const State& StateAt(int index) const { return *states_.at(index); }
+
+ private:
+  std::shared_ptr<const Game> game_;
+  const int num_players_;
+  const int obs_size_;
+  const bool auto_reset_;
+  std::vector<std::unique_ptr<State>> states_;
+  std::vector<double> rewards_;
+  std::vector<uint8_t> dones_;
+};
+
+}  // namespace
+
+void init_pyspiel_batched_env(py::module& m) {
+  py::class_<BatchedEnv>(m, "BatchedEnv")
+      .def(py::init<std::shared_ptr<const Game>, int, bool>(), py::arg("game"),
+           py::arg("batch_size"), py::arg("auto_reset") = true)
+      .def_property_readonly("batch_size", &BatchedEnv::BatchSize)
+      .def_property_readonly("num_players", &BatchedEnv::NumPlayers)
+      .def_property_readonly("observation_size", &BatchedEnv::ObservationSize)
+      .def("reset", &BatchedEnv::Reset,
+           py::call_guard<py::gil_scoped_release>())
+      .def("reset_at", &BatchedEnv::ResetAt, py::arg("index"))
+      .def("step", &BatchedEnv::Step, py::arg("actions"),
+           py::call_guard<py::gil_scoped_release>())
+      .def("rewards", &BatchedEnv::Rewards)
+      .def("dones", &BatchedEnv::Dones)
+      .def("current_players", &BatchedEnv::CurrentPlayers)
+      .def("observation_tensors", &BatchedEnv::ObservationTensors,
+           py::call_guard<py::gil_scoped_release>())
+      .def("legal_actions_masks", &BatchedEnv::LegalActionsMasks,
+           py::call_guard<py::gil_scoped_release>())
+      .def("state_at", &BatchedEnv::StateAt, py::arg("index"),
+           py::return_value_policy::reference_internal);
+}
+
+}  // namespace open_spiel
@@ -0,0 +1,25 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_PYTHON_PYBIND11_BATCHED_ENV_H_
+#define OPEN_SPIEL_PYTHON_PYBIND11_BATCHED_ENV_H_
+
+#include "open_spiel/python/pybind11/pybind11.h"
+
+// Initialize the Python interface for the batched environment.
+namespace open_spiel {
+void init_pyspiel_batched_env(::pybind11::module &m);
+}
+
+#endif  // OPEN_SPIEL_PYTHON_PYBIND11_BATCHED_ENV_H_
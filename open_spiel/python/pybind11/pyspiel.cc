@@ -29,6 +29,7 @@
 #include "open_spiel/observer.h"
 #include "open_spiel/python/pybind11/algorithms_corr_dist.h"
 #include "open_spiel/python/pybind11/algorithms_trajectories.h"
+#include "open_spiel/python/pybind11/batched_env.h"
 #include "open_spiel/python/pybind11/bots.h"
 #include "open_spiel/python/pybind11/game_transforms.h"
 #include "open_spiel/python/pybind11/games_backgammon.h"
@@ -102,6 +103,23 @@ class SpielException : public std::exception {
   std::string message_;
 };
 
+// Returns a writable span over a caller-provided C-contiguous float32
+// buffer (e.g. a numpy array), so tensors can be written in place instead
+// of allocating a fresh list per call.
+absl::Span<float> WritableFloatBuffer(const py::buffer_info& info) {
+  if (info.format != py::format_descriptor<float>::format()) {
+    SpielFatalError("Expected a float32 buffer.");
+  }
+  py::ssize_t stride = info.itemsize;
+  for (int d = info.ndim - 1; d >= 0; --d) {
+    if (info.strides[d] != stride) {
+      SpielFatalError("Expected a C-contiguous buffer.");
+    }
+    stride *= info.shape[d];
+  }
+  return absl::MakeSpan(static_cast<float*>(info.ptr), info.size);
+}
+
 // Definition of our Python module.
 PYBIND11_MODULE(pyspiel, m) {
   m.doc() = "Open Spiel";
@@ -315,6 +333,26 @@ PYBIND11_MODULE(pyspiel, m) {
                State::InformationStateTensor)
       .def("information_state_tensor", (std::vector<float>(State::*)() const) &
                                            State::InformationStateTensor)
+      // In-place variant writing into a caller-provided C-contiguous float32
+      // numpy buffer, avoiding an allocation and copy per call.
+      .def("write_information_state_tensor",
+           [](const State& state, int player, const py::buffer& buffer) {
+             py::buffer_info info = buffer.request(/*writable=*/true);
+             absl::Span<float> values = WritableFloatBuffer(info);
+             SPIEL_CHECK_EQ(values.size(),
+                            state.GetGame()->InformationStateTensorSize());
+             state.InformationStateTensor(player, values);
+           },
+           py::arg("player"), py::arg("buffer"))
+      .def("write_information_state_tensor",
+           [](const State& state, const py::buffer& buffer) {
+             py::buffer_info info = buffer.request(/*writable=*/true);
+             absl::Span<float> values = WritableFloatBuffer(info);
+             SPIEL_CHECK_EQ(values.size(),
+                            state.GetGame()->InformationStateTensorSize());
+             state.InformationStateTensor(state.CurrentPlayer(), values);
+           },
+           py::arg("buffer"))
       .def("observation_string",
            (std::string(State::*)(int) const) & State::ObservationString)
       .def("observation_string",
@@ -323,6 +361,25 @@ PYBIND11_MODULE(pyspiel, m) {
            (std::vector<float>(State::*)(int) const) & State::ObservationTensor)
       .def("observation_tensor",
            (std::vector<float>(State::*)() const) & State::ObservationTensor)
+      // In-place variant; see write_information_state_tensor above.
+      .def("write_observation_tensor",
+           [](const State& state, int player, const py::buffer& buffer) {
+             py::buffer_info info = buffer.request(/*writable=*/true);
+             absl::Span<float> values = WritableFloatBuffer(info);
+             SPIEL_CHECK_EQ(values.size(),
+                            state.GetGame()->ObservationTensorSize());
+             state.ObservationTensor(player, values);
+           },
+           py::arg("player"), py::arg("buffer"))
+      .def("write_observation_tensor",
+           [](const State& state, const py::buffer& buffer) {
+             py::buffer_info info = buffer.request(/*writable=*/true);
+             absl::Span<float> values = WritableFloatBuffer(info);
+             SPIEL_CHECK_EQ(values.size(),
+                            state.GetGame()->ObservationTensorSize());
+             state.ObservationTensor(state.CurrentPlayer(), values);
+           },
+           py::arg("buffer"))
       .def("clone", &State::Clone)
       .def("child", &State::Child)
       .def("undo_action", &State::UndoAction)
@@ -637,6 +694,7 @@ PYBIND11_MODULE(pyspiel, m) {
   py::register_exception<SpielException>(m, "SpielError", PyExc_RuntimeError);
 
   // Register other bits of the API.
+  init_pyspiel_batched_env(m);            // Vectorized multi-state stepping.
   init_pyspiel_bots(m);                   // Bots and bot-related algorithms.
   init_pyspiel_policy(m);           // Policies and policy-related algorithms.
   init_pyspiel_algorithms_corr_dist(m);     // Correlated eq. distance funcs
@@ -0,0 +1,83 @@
+# Copyright 2019 DeepMind Technologies Limited
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Tests for the C++ BatchedEnv exposed to Python."""
+
+from absl.testing import absltest
+import numpy as np
+
+import pyspiel
+
+
+class BatchedEnvTest(absltest.TestCase):
+
+  def test_shapes(self):
+    game = pyspiel.load_game("tic_tac_toe")
+    batch_size = 4
+    env = pyspiel.BatchedEnv(game, batch_size)
+    self.assertEqual(env.batch_size, batch_size)
+    self.assertEqual(env.num_players, 2)
+    self.assertEqual(env.observation_size, game.observation_tensor_size())
+    obs = np.asarray(env.observation_tensors()).reshape(batch_size, -1)
+    self.assertEqual(obs.shape, (batch_size, game.observation_tensor_size()))
+    masks = np.asarray(env.legal_actions_masks()).reshape(batch_size, -1)
+    self.assertEqual(masks.shape, (batch_size, game.num_distinct_actions()))
+    # All nine moves are legal at the initial state of every environment.
+    self.assertTrue((masks == 1).all())
+
+  def test_step_matches_single_state(self):
+    game = pyspiel.load_game("tic_tac_toe")
+    env = pyspiel.BatchedEnv(game, 2, auto_reset=False)
+    state = game.new_initial_state()
+    # Play the same fixed line in environment 0 and in a plain state; leave
+    # environment 1 untouched with invalid actions.
+    for action in [4, 0, 8, 2, 1, 7, 6]:
+      env.step(np.array([action, pyspiel.INVALID_ACTION], dtype=np.int64))
+      state.apply_action(action)
+    self.assertEqual(str(env.state_at(0)), str(state))
+    self.assertEqual(str(env.state_at(1)), str(game.new_initial_state()))
+    dones = env.dones()
+    self.assertEqual(list(dones), [state.is_terminal(), False])
+    rewards = np.asarray(env.rewards()).reshape(2, 2)
+    self.assertEqual(list(rewards[0]), state.rewards())
+    self.assertEqual(list(rewards[1]), [0.0, 0.0])
+
+  def test_auto_reset(self):
+    game = pyspiel.load_game("tic_tac_toe")
+    env = pyspiel.BatchedEnv(game, 1, auto_reset=True)
+    # Player 0 wins the top row.
+    for action in [0, 3, 1, 4, 2]:
+      env.step(np.array([action], dtype=np.int64))
+    # The terminal step is still reported ...
+    self.assertEqual(list(env.dones()), [True])
+    self.assertEqual(list(env.rewards()), [1.0, -1.0])
+    # ... but the environment has already restarted.
+    self.assertFalse(env.state_at(0).is_terminal())
+    self.assertEqual(env.state_at(0).move_number(), 0)
+
+  def test_reset(self):
+    game = pyspiel.load_game("kuhn_poker")
+    env = pyspiel.BatchedEnv(game, 3)
+    env.step(np.array([0, 0, pyspiel.INVALID_ACTION], dtype=np.int64))
+    env.reset_at(1)
+    self.assertEqual(env.state_at(1).move_number(), 0)
+    env.reset()
+    for i in range(3):
+      self.assertEqual(env.state_at(i).move_number(), 0)
+    self.assertEqual(list(env.rewards()), [0.0] * 6)
+    self.assertEqual(list(env.dones()), [False] * 3)
+
+
+if __name__ == "__main__":
+  absltest.main()
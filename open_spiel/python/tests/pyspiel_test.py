@@ -15,6 +15,7 @@
 
 import os
 from absl.testing import absltest
+import numpy as np
 
 from open_spiel.python import games  # pylint: disable=unused-import
 from open_spiel.python import policy
@@ -230,6 +231,30 @@ class PyspielTest(absltest.TestCase):
     self.assertFalse(state.is_terminal())
     self.assertEqual(state.legal_actions(), [0, 1, 2, 3, 4, 5, 6, 7, 8])
 
+  def test_write_tensors_into_numpy_buffers(self):
+    game = pyspiel.load_game("kuhn_poker")
+    state = game.new_initial_state()
+    state.apply_action(0)
+    state.apply_action(1)
+    obs_buffer = np.zeros(game.observation_tensor_size(), dtype=np.float32)
+    info_buffer = np.zeros(
+        game.information_state_tensor_size(), dtype=np.float32)
+    for player in range(game.num_players()):
+      state.write_observation_tensor(player, obs_buffer)
+      self.assertEqual(list(obs_buffer), state.observation_tensor(player))
+      state.write_information_state_tensor(player, info_buffer)
+      self.assertEqual(
+          list(info_buffer), state.information_state_tensor(player))
+    # The no-player variants observe for the current player.
+    state.write_observation_tensor(obs_buffer)
+    self.assertEqual(list(obs_buffer), state.observation_tensor())
+    # Wrongly-sized or wrongly-typed buffers are rejected.
+    with self.assertRaises(pyspiel.SpielError):
+      state.write_observation_tensor(0, np.zeros(1, dtype=np.float32))
+    with self.assertRaises(pyspiel.SpielError):
+      state.write_observation_tensor(
+          0, np.zeros(game.observation_tensor_size(), dtype=np.float64))
+
   def test_game_parameters_from_string_empty(self):
     self.assertEqual(pyspiel.game_parameters_from_string(""), {})
 
@@ -64,11 +64,74 @@ pub fn play_tic_tac_toe_with_bots() {
     println!("Terminal state reached:\n{}\n", state.to_string());
 }
 
+pub fn play_batched_tic_tac_toe() {
+    let game = Game::new("tic_tac_toe");
+    let batch_size = 4;
+    let num_actions = game.num_distinct_actions() as usize;
+    let obs_size: usize = game.observation_shape().iter().product::<i32>() as usize;
+
+    let states: Vec<State> = (0..batch_size).map(|_| game.new_initial_state()).collect();
+    let mut players = vec![0; batch_size];
+    let mut terminals = vec![0; batch_size];
+    let mut masks = vec![0; batch_size * num_actions];
+    let mut observations = vec![0.0f32; batch_size * obs_size];
+
+    loop {
+        is_terminal_many(&states, &mut terminals);
+        if terminals.iter().all(|&t| t == 1) {
+            break;
+        }
+        legal_actions_mask_many(&states, num_actions, &mut masks);
+        observation_tensor_many(&states, obs_size, &mut observations);
+        // Take the first legal action everywhere; finished states get -1
+        // and are left untouched.
+        let actions: Vec<i64> = (0..batch_size)
+            .map(|i| {
+                let row = &masks[i * num_actions..(i + 1) * num_actions];
+                match row.iter().position(|&legal| legal == 1) {
+                    Some(action) => action as i64,
+                    None => -1,
+                }
+            })
+            .collect();
+        apply_action_many(&states, &actions);
+        current_player_many(&states, &mut players);
+    }
+
+    let num_players = game.num_players() as usize;
+    let mut returns = vec![0.0f64; batch_size * num_players];
+    returns_many(&states, num_players, &mut returns);
+    for i in 0..batch_size {
+        println!(
+            "Batched game {} finished with returns {:?}",
+            i,
+            &returns[i * num_players..(i + 1) * num_players]
+        );
+    }
+}
+
 #[test]
 fn tic_tac_toe_test() {
     play_tic_tac_toe();
 }
 
+#[test]
+fn batched_tic_tac_toe_test() {
+    play_batched_tic_tac_toe();
+
+    // The batched calls must agree with the per-state API.
+    let game = Game::new("tic_tac_toe");
+    let states = vec![game.new_initial_state(), game.new_initial_state()];
+    apply_action_many(&states, &[4, -1]);
+    assert_eq!(states[0].current_player(), 1);
+    assert_eq!(states[1].current_player(), 0);
+    let obs_size: usize = game.observation_shape().iter().product::<i32>() as usize;
+    let mut observations = vec![0.0f32; 2 * obs_size];
+    observation_tensor_many(&states, obs_size, &mut observations);
+    assert_eq!(&observations[..obs_size], states[0].observation_tensor(1).as_slice());
+    assert_eq!(&observations[obs_size..], states[1].observation_tensor(0).as_slice());
+}
+
 #[test]
 fn tic_tac_toe_with_bots_test() {
     play_tic_tac_toe_with_bots();
@@ -92,4 +155,5 @@ fn new_game_with_parameters_test() {
 fn main() {
     play_tic_tac_toe();
     play_tic_tac_toe_with_bots();
+    play_batched_tic_tac_toe();
 }
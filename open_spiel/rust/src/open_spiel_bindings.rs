@@ -180,6 +180,58 @@ extern "C" {
         length: ::std::os::raw::c_int,
     );
 }
+extern "C" {
+    pub fn StateApplyActionMany(
+        state_ptrs: *const *mut ::std::os::raw::c_void,
+        num_states: ::std::os::raw::c_int,
+        actions: *const ::std::os::raw::c_long,
+    );
+}
+extern "C" {
+    pub fn StateCurrentPlayerMany(
+        state_ptrs: *const *const ::std::os::raw::c_void,
+        num_states: ::std::os::raw::c_int,
+        players_buf: *mut ::std::os::raw::c_int,
+    );
+}
+extern "C" {
+    pub fn StateIsTerminalMany(
+        state_ptrs: *const *const ::std::os::raw::c_void,
+        num_states: ::std::os::raw::c_int,
+        terminals_buf: *mut ::std::os::raw::c_int,
+    );
+}
+extern "C" {
+    pub fn StateReturnsMany(
+        state_ptrs: *const *const ::std::os::raw::c_void,
+        num_states: ::std::os::raw::c_int,
+        returns_buf: *mut ::std::os::raw::c_double,
+    );
+}
+extern "C" {
+    pub fn StateLegalActionsMaskMany(
+        state_ptrs: *const *const ::std::os::raw::c_void,
+        num_states: ::std::os::raw::c_int,
+        num_distinct_actions: ::std::os::raw::c_int,
+        masks_buf: *mut ::std::os::raw::c_int,
+    );
+}
+extern "C" {
+    pub fn StateObservationTensorMany(
+        state_ptrs: *const *const ::std::os::raw::c_void,
+        num_states: ::std::os::raw::c_int,
+        obs_buf: *mut ::std::os::raw::c_float,
+        size_per_state: ::std::os::raw::c_int,
+    );
+}
+extern "C" {
+    pub fn StateInformationStateTensorMany(
+        state_ptrs: *const *const ::std::os::raw::c_void,
+        num_states: ::std::os::raw::c_int,
+        infostate_buf: *mut ::std::os::raw::c_float,
+        size_per_state: ::std::os::raw::c_int,
+    );
+}
 extern "C" {
     pub fn DeleteBot(bot_ptr: *mut ::std::os::raw::c_void);
 }
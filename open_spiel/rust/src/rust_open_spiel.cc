@@ -296,6 +296,84 @@ void StateInformationStateTensor(const void* state_ptr, int player,
   state->InformationStateTensor(player, absl::MakeSpan(infostate_buf, length));
 }
 
+/* Batched state functions. */
+void StateApplyActionMany(void* const* state_ptrs, int num_states,
+                          const long* actions) {  // NOLINT
+  for (int i = 0; i < num_states; ++i) {
+    State* state = reinterpret_cast<State*>(state_ptrs[i]);
+    /* A negative action leaves the state untouched, so a caller can step a
+       subset of the batch in one call. */
+    if (actions[i] >= 0 && !state->IsTerminal()) {
+      state->ApplyAction(actions[i]);
+    }
+  }
+}
+
+void StateCurrentPlayerMany(const void* const* state_ptrs, int num_states,
+                            int* players_buf) {
+  for (int i = 0; i < num_states; ++i) {
+    players_buf[i] =
+        reinterpret_cast<const State*>(state_ptrs[i])->CurrentPlayer();
+  }
+}
+
+void StateIsTerminalMany(const void* const* state_ptrs, int num_states,
+                         int* terminals_buf) {
+  for (int i = 0; i < num_states; ++i) {
+    terminals_buf[i] =
+        reinterpret_cast<const State*>(state_ptrs[i])->IsTerminal() ? 1 : 0;
+  }
+}
+
+void StateReturnsMany(const void* const* state_ptrs, int num_states,
+                      double* returns_buf) {
+  for (int i = 0; i < num_states; ++i) {
+    const State* state = reinterpret_cast<const State*>(state_ptrs[i]);
+    std::vector<double> returns = state->Returns();
+    memcpy(returns_buf + i * returns.size(), returns.data(),
+           returns.size() * sizeof(double));
+  }
+}
+
+void StateLegalActionsMaskMany(const void* const* state_ptrs, int num_states,
+                               int num_distinct_actions, int* masks_buf) {
+  memset(masks_buf, 0, num_states * num_distinct_actions * sizeof(int));
+  for (int i = 0; i < num_states; ++i) {
+    const State* state = reinterpret_cast<const State*>(state_ptrs[i]);
+    int player = state->CurrentPlayer();
+    /* Chance and terminal states keep an all-zero row. */
+    if (player < 0) continue;
+    std::vector<int> mask = state->LegalActionsMask(player);
+    memcpy(masks_buf + i * num_distinct_actions, mask.data(),
+           mask.size() * sizeof(int));
+  }
+}
+
+void StateObservationTensorMany(const void* const* state_ptrs, int num_states,
+                                float* obs_buf, int size_per_state) {
+  for (int i = 0; i < num_states; ++i) {
+    const State* state = reinterpret_cast<const State*>(state_ptrs[i]);
+    int player = state->CurrentPlayer();
+    /* Observe for player 0 where no player is to act. */
+    if (player < 0) player = 0;
+    state->ObservationTensor(
+        player, absl::MakeSpan(obs_buf + i * size_per_state, size_per_state));
+  }
+}
+
+void StateInformationStateTensorMany(const void* const* state_ptrs,
+                                     int num_states, float* infostate_buf,
+                                     int size_per_state) {
+  for (int i = 0; i < num_states; ++i) {
+    const State* state = reinterpret_cast<const State*>(state_ptrs[i]);
+    int player = state->CurrentPlayer();
+    if (player < 0) player = 0;
+    state->InformationStateTensor(
+        player,
+        absl::MakeSpan(infostate_buf + i * size_per_state, size_per_state));
+  }
+}
+
 /* Bot functions */
 void DeleteBot(void* bot_ptr) {
   Bot* bot = reinterpret_cast<Bot*>(bot_ptr);
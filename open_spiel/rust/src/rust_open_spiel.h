@@ -72,6 +72,25 @@ void StateObservationTensor(const void* state_ptr, int player, float* obs_buf,
 void StateInformationStateTensor(const void* state_ptr, int player,
                                  float* infostate_buf, int length);
 
+/* Batched state functions. Each call covers an array of states, so one FFI
+   crossing amortizes over the whole batch. All buffers are caller-allocated
+   and flat ([num_states, per-state size], row-major). */
+void StateApplyActionMany(void* const* state_ptrs, int num_states,
+                          const long* actions); /* NOLINT */
+void StateCurrentPlayerMany(const void* const* state_ptrs, int num_states,
+                            int* players_buf);
+void StateIsTerminalMany(const void* const* state_ptrs, int num_states,
+                         int* terminals_buf);
+void StateReturnsMany(const void* const* state_ptrs, int num_states,
+                      double* returns_buf);
+void StateLegalActionsMaskMany(const void* const* state_ptrs, int num_states,
+                               int num_distinct_actions, int* masks_buf);
+void StateObservationTensorMany(const void* const* state_ptrs, int num_states,
+                                float* obs_buf, int size_per_state);
+void StateInformationStateTensorMany(const void* const* state_ptrs,
+                                     int num_states, float* infostate_buf,
+                                     int size_per_state);
+
 /* Bot functions */
 void DeleteBot(void* bot_ptr);
 long BotStep(void* bot_ptr, const void* state_ptr); /* NOLINT */
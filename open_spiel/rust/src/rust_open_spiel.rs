@@ -215,6 +215,93 @@ impl Drop for State {
     }
 }
 
+// Batched helpers: one FFI crossing covers a whole slice of states, writing
+// into caller-allocated flat buffers ([num_states, per-state size],
+// row-major), so rollout workers avoid a crossing and an allocation per
+// state per step.
+
+fn const_state_ptrs(states: &[State]) -> Vec<*const c_void> {
+    states.iter().map(|s| s.state as *const c_void).collect()
+}
+
+/// Applies `actions[i]` to `states[i]`. A negative action leaves that state
+/// untouched, so a subset of the batch can be stepped in one call.
+pub fn apply_action_many(states: &[State], actions: &[i64]) {
+    assert_eq!(states.len(), actions.len());
+    let ptrs: Vec<*mut c_void> = states.iter().map(|s| s.state).collect();
+    unsafe { StateApplyActionMany(ptrs.as_ptr(), states.len() as i32, actions.as_ptr()) };
+}
+
+pub fn current_player_many(states: &[State], players_buf: &mut [i32]) {
+    assert_eq!(states.len(), players_buf.len());
+    let ptrs = const_state_ptrs(states);
+    unsafe { StateCurrentPlayerMany(ptrs.as_ptr(), states.len() as i32, players_buf.as_mut_ptr()) };
+}
+
+pub fn is_terminal_many(states: &[State], terminals_buf: &mut [i32]) {
+    assert_eq!(states.len(), terminals_buf.len());
+    let ptrs = const_state_ptrs(states);
+    unsafe { StateIsTerminalMany(ptrs.as_ptr(), states.len() as i32, terminals_buf.as_mut_ptr()) };
+}
+
+pub fn returns_many(states: &[State], num_players: usize, returns_buf: &mut [f64]) {
+    assert_eq!(states.len() * num_players, returns_buf.len());
+    let ptrs = const_state_ptrs(states);
+    unsafe { StateReturnsMany(ptrs.as_ptr(), states.len() as i32, returns_buf.as_mut_ptr()) };
+}
+
+/// Fills one row of 0/1 legality per state; rows for chance and terminal
+/// states are all zero.
+pub fn legal_actions_mask_many(
+    states: &[State],
+    num_distinct_actions: usize,
+    masks_buf: &mut [i32],
+) {
+    assert_eq!(states.len() * num_distinct_actions, masks_buf.len());
+    let ptrs = const_state_ptrs(states);
+    unsafe {
+        StateLegalActionsMaskMany(
+            ptrs.as_ptr(),
+            states.len() as i32,
+            num_distinct_actions as i32,
+            masks_buf.as_mut_ptr(),
+        )
+    };
+}
+
+/// Fills one observation tensor per state, observed by each state's current
+/// player (player 0 where no player is to act).
+pub fn observation_tensor_many(states: &[State], size_per_state: usize, obs_buf: &mut [f32]) {
+    assert_eq!(states.len() * size_per_state, obs_buf.len());
+    let ptrs = const_state_ptrs(states);
+    unsafe {
+        StateObservationTensorMany(
+            ptrs.as_ptr(),
+            states.len() as i32,
+            obs_buf.as_mut_ptr(),
+            size_per_state as i32,
+        )
+    };
+}
+
+/// As observation_tensor_many, for information state tensors.
+pub fn information_state_tensor_many(
+    states: &[State],
+    size_per_state: usize,
+    infostate_buf: &mut [f32],
+) {
+    assert_eq!(states.len() * size_per_state, infostate_buf.len());
+    let ptrs = const_state_ptrs(states);
+    unsafe {
+        StateInformationStateTensorMany(
+            ptrs.as_ptr(),
+            states.len() as i32,
+            infostate_buf.as_mut_ptr(),
+            size_per_state as i32,
+        )
+    };
+}
+
 unsafe impl Send for State {}
 unsafe impl Sync for State {}
 
@@ -15,6 +15,9 @@
 #include "open_spiel/spiel.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -26,6 +29,7 @@
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/container/btree_map.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/random/bit_gen_ref.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
 #include "open_spiel/abseil-cpp/absl/strings/ascii.h"
@@ -37,8 +41,10 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
 #include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/game_parameters.h"
+#include "open_spiel/game_plugins.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/profiler.h"
 #include "open_spiel/utils/usage_logging.h"
 
 namespace open_spiel {
@@ -140,6 +146,19 @@ GameRegisterer::GameRegisterer(const GameType& game_type, CreateFunc creator) {
   RegisterGame(game_type, creator);
 }
 
+namespace {
+// Cache of fully-constructed games, keyed on (short_name, parameters).
+// Entries are weak so that a cached game is freed once no caller holds it.
+// Guarded by a mutex: games may be loaded from multiple threads.
+absl::Mutex game_cache_mutex;
+std::map<std::string, std::weak_ptr<const Game>>& GameCache()
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(game_cache_mutex) {
+  static std::map<std::string, std::weak_ptr<const Game>>* cache =
+      new std::map<std::string, std::weak_ptr<const Game>>();
+  return *cache;
+}
+}  // namespace
+
 std::shared_ptr<const Game> GameRegisterer::CreateByName(
     const std::string& short_name, const GameParameters& params) {
   // Check if it's a game with a known issue. If so, output a warning.
@@ -148,20 +167,64 @@ std::shared_ptr<const Game> GameRegisterer::CreateByName(
               << "list on github or the code for details." << std::endl;
   }
 
-  // Find the factory for this game and load it.
-  auto iter = factories().find(short_name);
-  if (iter == factories().end()) {
+  // Find the factory for this game and load it. An unregistered name may
+  // still be available as a shared-library plugin; see game_plugins.h. The
+  // entry is copied out of the registry so that no registry lock is held
+  // across the plugin load (whose initializers call RegisterGame) or the
+  // game construction.
+  absl::optional<std::pair<GameType, CreateFunc>> factory =
+      LookupFactory(short_name);
+  if (!factory.has_value() && LoadGamePlugin(short_name)) {
+    factory = LookupFactory(short_name);
+  }
+  if (!factory.has_value()) {
     SpielFatalError(absl::StrCat("Unknown game '", short_name,
                                  "'. Available games are:\n",
                                  absl::StrJoin(RegisteredNames(), "\n")));
+  }
+  ValidateParams(params, factory->first.parameter_specification);
+
+  // Game objects are immutable once constructed, with one exception: sampled
+  // stochastic games hold internal RNG state. All other games can safely be
+  // shared between callers that request identical parameters, making repeat
+  // loads a pointer copy.
+  const bool cacheable =
+      factory->first.chance_mode != GameType::ChanceMode::kSampledStochastic;
+  const std::string cache_key =
+      absl::StrCat(short_name, "/", GameParametersToString(params));
+  if (cacheable) {
+    absl::MutexLock lock(&game_cache_mutex);
+    auto cache_iter = GameCache().find(cache_key);
+    if (cache_iter != GameCache().end()) {
+      if (std::shared_ptr<const Game> cached = cache_iter->second.lock()) {
+        return cached;
+      }
+    }
+  }
 
-  } else {
-    ValidateParams(params, iter->second.first.parameter_specification);
-    return (iter->second.second)(params);
+  std::shared_ptr<const Game> game = (factory->second)(params);
+  if (cacheable && game != nullptr) {
+    absl::MutexLock lock(&game_cache_mutex);
+    GameCache()[cache_key] = game;
   }
+  return game;
+}
+
+absl::Mutex& GameRegisterer::factories_mutex() {
+  static absl::Mutex* impl = new absl::Mutex();
+  return *impl;
+}
+
+absl::optional<std::pair<GameType, GameRegisterer::CreateFunc>>
+GameRegisterer::LookupFactory(const std::string& short_name) {
+  absl::ReaderMutexLock lock(&factories_mutex());
+  auto iter = factories().find(short_name);
+  if (iter == factories().end()) return absl::nullopt;
+  return iter->second;
 }
 
 std::vector<std::string> GameRegisterer::RegisteredNames() {
+  absl::ReaderMutexLock lock(&factories_mutex());
   std::vector<std::string> names;
   for (const auto& key_val : factories()) {
     names.push_back(key_val.first);
@@ -174,6 +237,7 @@ std::vector<std::string> GameRegisterer::GamesWithKnownIssues() {
 }
 
 std::vector<GameType> GameRegisterer::RegisteredGames() {
+  absl::ReaderMutexLock lock(&factories_mutex());
   std::vector<GameType> games;
   for (const auto& key_val : factories()) {
     games.push_back(key_val.second.first);
@@ -182,11 +246,13 @@ std::vector<GameType> GameRegisterer::RegisteredGames() {
 }
 
 bool GameRegisterer::IsValidName(const std::string& short_name) {
+  absl::ReaderMutexLock lock(&factories_mutex());
   return factories().find(short_name) != factories().end();
 }
 
 void GameRegisterer::RegisterGame(const GameType& game_type,
                                   GameRegisterer::CreateFunc creator) {
+  absl::MutexLock lock(&factories_mutex());
   factories()[game_type.short_name] = std::make_pair(game_type, creator);
 }
 
@@ -255,6 +321,87 @@ std::shared_ptr<const Game> LoadGame(GameParameters params) {
   return result;
 }
 
+namespace {
+// The innermost arena guard (if any) on this thread. Guards link to the next
+// outer one, forming a chain that State::operator delete walks to find the
+// arena owning a pointer.
+thread_local ScopedStateArena* innermost_state_arena_guard = nullptr;
+}  // namespace
+
+StateArena::StateArena(std::size_t block_size) : block_size_(block_size) {
+  SPIEL_CHECK_GT(block_size, 0);
+}
+
+StateArena::~StateArena() {
+  for (const Block& block : blocks_) ::operator delete(block.data);
+}
+
+void StateArena::AddBlock(std::size_t size) {
+  blocks_.push_back({static_cast<char*>(::operator new(size)), size});
+  block_offset_ = 0;
+}
+
+void* StateArena::Allocate(std::size_t size) {
+  // Round up so that successive allocations stay maximally aligned.
+  constexpr std::size_t kAlignment = alignof(std::max_align_t);
+  size = (size + kAlignment - 1) & ~(kAlignment - 1);
+  if (blocks_.empty() || block_offset_ + size > blocks_.back().size) {
+    AddBlock(std::max(size, block_size_));
+  }
+  void* ptr = blocks_.back().data + block_offset_;
+  block_offset_ += size;
+  bytes_allocated_ += size;
+  return ptr;
+}
+
+bool StateArena::Owns(const void* ptr) const {
+  for (const Block& block : blocks_) {
+    if (ptr >= block.data && ptr < block.data + block.size) return true;
+  }
+  return false;
+}
+
+void StateArena::Reset() {
+  // Keep the first block; it is as large as any request seen so far.
+  while (blocks_.size() > 1) {
+    ::operator delete(blocks_.back().data);
+    blocks_.pop_back();
+  }
+  block_offset_ = 0;
+  bytes_allocated_ = 0;
+}
+
+ScopedStateArena::ScopedStateArena(StateArena* arena)
+    : arena_(arena), previous_(innermost_state_arena_guard) {
+  SPIEL_CHECK_TRUE(arena != nullptr);
+  innermost_state_arena_guard = this;
+}
+
+ScopedStateArena::~ScopedStateArena() {
+  innermost_state_arena_guard = previous_;
+}
+
+void* State::operator new(std::size_t size) {
+  if (innermost_state_arena_guard != nullptr) {
+    return innermost_state_arena_guard->arena_->Allocate(size);
+  }
+  return ::operator new(size);
+}
+
+void State::operator delete(void* ptr) {
+  // Arena memory is reclaimed in bulk by StateArena::Reset(); individual
+  // deletes of arena-owned states are no-ops. Walk the whole guard chain, not
+  // just the innermost arena: with nested guards a state allocated from an
+  // outer arena may be deleted while an inner one is installed, and handing
+  // its arena-interior pointer to the global operator delete would corrupt
+  // the heap.
+  for (ScopedStateArena* guard = innermost_state_arena_guard; guard != nullptr;
+       guard = guard->previous_) {
+    if (guard->arena_->Owns(ptr)) return;
+  }
+  ::operator delete(ptr);
+}
+
 State::State(std::shared_ptr<const Game> game)
     : game_(game),
       num_distinct_actions_(game->NumDistinctActions()),
@@ -271,6 +418,28 @@ std::pair<Action, double> SampleAction(const ActionsAndProbs& outcomes,
                                        absl::BitGenRef rng) {
   return SampleAction(outcomes, absl::Uniform(rng, 0.0, 1.0));
 }
+
+int64_t State::MemoryFootprint() const {
+  return sizeof(State) + history_.capacity() * sizeof(PlayerAction) +
+         cached_legal_actions_.capacity() * sizeof(Action);
+}
+
+int64_t Game::MemoryFootprint() const {
+  int64_t bytes = sizeof(Game);
+  for (const ActionsAndProbs& table : chance_outcome_tables_) {
+    bytes += table.capacity() * sizeof(std::pair<Action, double>);
+  }
+  return bytes;
+}
+
+const ActionsAndProbs& ChanceOutcomesRef(const State& state,
+                                         ActionsAndProbs* scratch) {
+  const ActionsAndProbs* table = state.ChanceOutcomeTable();
+  if (table != nullptr) return *table;
+  *scratch = state.ChanceOutcomes();
+  return *scratch;
+}
+
 std::pair<Action, double> SampleAction(const ActionsAndProbs& outcomes,
                                        double z) {
   SPIEL_CHECK_GE(z, 0);
@@ -336,15 +505,45 @@ Action State::StringToAction(Player player,
 }
 
 void State::ApplyAction(Action action_id) {
+  SPIEL_PROF_SCOPE("State::ApplyAction");
   // history_ needs to be modified *after* DoApplyAction which could
   // be using it.
 
   // Cannot apply an invalid action.
-  SPIEL_CHECK_NE(action_id, kInvalidAction);
+  SPIEL_HOT_CHECK_NE(action_id, kInvalidAction);
   Player player = CurrentPlayer();
   DoApplyAction(action_id);
   history_.push_back({player, action_id});
   ++move_number_;
+  cached_legal_actions_history_size_ = -1;
+}
+
+void State::ShrinkToFit() {
+  history_.shrink_to_fit();
+  // Drop the legal-action cache entirely; retained states are rarely the
+  // target of further queries, and the cache is rebuilt on demand.
+  cached_legal_actions_ = std::vector<Action>();
+  cached_legal_actions_history_size_ = -1;
+}
+
+uint64_t State::InformationStateKey(Player player) const {
+  return absl::Hash<std::pair<Player, std::string>>()(
+      {player, InformationStateString(player)});
+}
+
+uint64_t State::Key() const { return absl::Hash<std::string>()(ToString()); }
+
+const std::vector<Action>& State::LegalActionsRef() const {
+  // The history length changes on every apply and undo, so comparing it to
+  // the length recorded when the cache was filled detects both; undo followed
+  // by re-applying a different action is caught by the explicit invalidation
+  // in ApplyAction()/ApplyActions().
+  if (cached_legal_actions_history_size_ !=
+      static_cast<int>(history_.size())) {
+    cached_legal_actions_ = LegalActions();
+    cached_legal_actions_history_size_ = static_cast<int>(history_.size());
+  }
+  return cached_legal_actions_;
 }
 
 void State::ApplyActionWithLegalityCheck(Action action_id) {
@@ -368,6 +567,7 @@ void State::ApplyActions(const std::vector<Action>& actions) {
     history_.push_back({player, actions[player]});
   }
   ++move_number_;
+  cached_legal_actions_history_size_ = -1;
 }
 
 void State::ApplyActionsWithLegalityChecks(const std::vector<Action>& actions) {
@@ -392,6 +592,17 @@ std::vector<int> State::LegalActionsMask(Player player) const {
   return mask;
 }
 
+void Game::BatchStep(absl::Span<State* const> states,
+                     absl::Span<const Action> actions) const {
+  SPIEL_CHECK_EQ(states.size(), actions.size());
+  for (int i = 0; i < states.size(); ++i) {
+    SPIEL_CHECK_TRUE(states[i] != nullptr);
+    if (!states[i]->IsTerminal()) {
+      states[i]->ApplyAction(actions[i]);
+    }
+  }
+}
+
 std::vector<std::unique_ptr<State>> Game::NewInitialStates() const {
   std::vector<std::unique_ptr<State>> states;
   if (GetType().dynamics == GameType::Dynamics::kMeanField &&
@@ -508,6 +719,145 @@ DeserializeGameAndState(const std::string& serialized_state) {
       game, std::move(state));
 }
 
+namespace {
+
+// Binary container layout: magic/version bytes, one compression scheme byte,
+// then the (possibly compressed) payload of length-prefixed game and state
+// strings. As with Observation::Compress, a scheme byte leaves room for
+// additional codecs later.
+constexpr char kPackedSerializationMagic[] = {'O', 'S', 'B'};
+// Version 2 added the state-encoding byte (version 1 always stored the
+// State::Serialize payload).
+constexpr char kPackedSerializationVersion = 2;
+enum BinarySerializationScheme : char {
+  kPackedSerializationNone = 0,
+  kPackedSerializationRunLength = 1,
+};
+enum BinaryStateEncoding : char {
+  kStateEncodingSerialized = 0,
+  kStateEncodingSnapshot = 1,
+};
+
+void AppendLengthPrefixed(const std::string& str, std::string* out) {
+  uint64_t length = str.size();
+  out->append(reinterpret_cast<const char*>(&length), sizeof(length));
+  out->append(str);
+}
+
+std::string ReadLengthPrefixed(const std::string& data, size_t* pos) {
+  SPIEL_CHECK_LE(*pos + sizeof(uint64_t), data.size());
+  uint64_t length;
+  std::memcpy(&length, data.data() + *pos, sizeof(length));
+  *pos += sizeof(length);
+  SPIEL_CHECK_LE(*pos + length, data.size());
+  std::string str = data.substr(*pos, length);
+  *pos += length;
+  return str;
+}
+
+// Byte-level run-length coding: each run of up to 256 equal bytes is stored
+// as (run length - 1, byte).
+std::string RunLengthEncode(const std::string& data) {
+  std::string out;
+  out.reserve(data.size());
+  size_t i = 0;
+  while (i < data.size()) {
+    size_t run = 1;
+    while (run < 256 && i + run < data.size() && data[i + run] == data[i]) {
+      ++run;
+    }
+    out.push_back(static_cast<char>(run - 1));
+    out.push_back(data[i]);
+    i += run;
+  }
+  return out;
+}
+
+std::string RunLengthDecode(const std::string& data) {
+  SPIEL_CHECK_EQ(data.size() % 2, 0);
+  std::string out;
+  for (size_t i = 0; i < data.size(); i += 2) {
+    out.append(static_cast<unsigned char>(data[i]) + 1, data[i + 1]);
+  }
+  return out;
+}
+
+}  // namespace
+
+std::string SerializeGameAndStatePacked(const Game& game, const State& state,
+                                        bool compress) {
+  std::string payload;
+  AppendLengthPrefixed(game.Serialize(), &payload);
+  if (game.SupportsStateSnapshots()) {
+    payload.push_back(kStateEncodingSnapshot);
+    std::string snapshot;
+    state.SnapshotTo(&snapshot);
+    AppendLengthPrefixed(snapshot, &payload);
+  } else {
+    payload.push_back(kStateEncodingSerialized);
+    AppendLengthPrefixed(state.Serialize(), &payload);
+  }
+
+  std::string str(kPackedSerializationMagic,
+                  sizeof(kPackedSerializationMagic));
+  str.push_back(kPackedSerializationVersion);
+  if (compress) {
+    // Adaptively keep the encoding only if it actually shrinks the payload.
+    std::string encoded = RunLengthEncode(payload);
+    if (encoded.size() < payload.size()) {
+      str.push_back(kPackedSerializationRunLength);
+      str.append(encoded);
+      return str;
+    }
+  }
+  str.push_back(kPackedSerializationNone);
+  str.append(payload);
+  return str;
+}
+
+std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
+DeserializeGameAndStatePacked(const std::string& serialized) {
+  // Magic, version byte, compression scheme byte.
+  constexpr size_t kHeaderSize = sizeof(kPackedSerializationMagic) + 2;
+  SPIEL_CHECK_GE(serialized.size(), kHeaderSize);
+  SPIEL_CHECK_EQ(
+      serialized.compare(0, sizeof(kPackedSerializationMagic),
+                         kPackedSerializationMagic,
+                         sizeof(kPackedSerializationMagic)),
+      0);
+  const char version = serialized[sizeof(kPackedSerializationMagic)];
+  SPIEL_CHECK_GE(version, 1);
+  SPIEL_CHECK_LE(version, kPackedSerializationVersion);
+  std::string payload = serialized.substr(kHeaderSize);
+  const char scheme = serialized[sizeof(kPackedSerializationMagic) + 1];
+  if (scheme == kPackedSerializationRunLength) {
+    payload = RunLengthDecode(payload);
+  } else {
+    SPIEL_CHECK_EQ(scheme, kPackedSerializationNone);
+  }
+
+  size_t pos = 0;
+  std::shared_ptr<const Game> game =
+      DeserializeGame(ReadLengthPrefixed(payload, &pos));
+  char state_encoding = kStateEncodingSerialized;
+  if (version >= 2) {
+    SPIEL_CHECK_LT(pos, payload.size());
+    state_encoding = payload[pos++];
+  }
+  const std::string state_payload = ReadLengthPrefixed(payload, &pos);
+  std::unique_ptr<State> state;
+  if (state_encoding == kStateEncodingSnapshot) {
+    state = game->RestoreSnapshot(state_payload);
+  } else {
+    SPIEL_CHECK_EQ(state_encoding, kStateEncodingSerialized);
+    state = game->DeserializeState(state_payload);
+  }
+  SPIEL_CHECK_EQ(pos, payload.size());
+
+  return std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>(
+      game, std::move(state));
+}
+
 std::ostream& operator<<(std::ostream& stream, GameType::Dynamics value) {
   switch (value) {
     case GameType::Dynamics::kSimultaneous:
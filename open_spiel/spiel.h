@@ -15,6 +15,8 @@
 #ifndef OPEN_SPIEL_SPIEL_H_
 #define OPEN_SPIEL_SPIEL_H_
 
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -206,6 +208,85 @@ using HistoryDistribution =
 class Game;
 class Observer;
 
+// A bump-pointer arena used to serve State allocations. Tree search and
+// tabular solvers clone states at every node; when an arena is installed
+// (see ScopedStateArena below) those allocations are served from large
+// contiguous blocks and reclaimed in bulk with Reset() when the search
+// finishes, instead of going through malloc/free once per node.
+//
+// An arena serves allocations for a single thread; use one arena per search
+// thread. Deleting a state allocated from an arena is a no-op (memory is
+// reclaimed by Reset() or the arena destructor), but operator delete can only
+// recognize arena-owned pointers by asking the arenas installed on the
+// current thread: every state drawn from an arena must be destroyed while a
+// ScopedStateArena guard for that arena is still active on this thread.
+// Destroying such a state after its guard has been popped, or on another
+// thread, passes a pointer into the arena's blocks to the global operator
+// delete and corrupts the heap. Guards nest and deletes check every arena in
+// the chain, so an inner guard does not hide an outer arena's states.
+class StateArena {
+ public:
+  static constexpr std::size_t kDefaultBlockSize = 1 << 20;  // 1MiB.
+
+  explicit StateArena(std::size_t block_size = kDefaultBlockSize);
+  ~StateArena();
+
+  // Not copyable nor movable: states hold pointers into the blocks.
+  StateArena(const StateArena&) = delete;
+  StateArena& operator=(const StateArena&) = delete;
+
+  // Returns a pointer to `size` bytes, suitably aligned for any State.
+  // Allocations larger than the block size get a dedicated block.
+  void* Allocate(std::size_t size);
+
+  // Returns true if `ptr` points into one of this arena's blocks.
+  bool Owns(const void* ptr) const;
+
+  // Discards all allocations at once. The first block is kept for reuse so
+  // that repeated searches do not re-pay the block allocation cost.
+  void Reset();
+
+  // Total number of bytes handed out since the last Reset().
+  std::size_t BytesAllocated() const { return bytes_allocated_; }
+
+ private:
+  struct Block {
+    char* data;
+    std::size_t size;
+  };
+
+  void AddBlock(std::size_t size);
+
+  const std::size_t block_size_;
+  std::vector<Block> blocks_;
+  std::size_t block_offset_ = 0;     // Offset into the last block.
+  std::size_t bytes_allocated_ = 0;
+};
+
+// RAII guard that installs `arena` as the allocation source for all states
+// created on the current thread (Game::NewInitialState, State::Clone and
+// State::Child included), for the lifetime of the guard. Guards nest: new
+// states come from the innermost guard's arena, the previous guard (if any)
+// is restored on destruction, and deleting a state checks every arena in the
+// guard chain, so states from an outer arena may safely be destroyed while
+// an inner guard is active. No per-game changes are needed: State overrides
+// operator new/delete below.
+class ScopedStateArena {
+ public:
+  explicit ScopedStateArena(StateArena* arena);
+  ~ScopedStateArena();
+
+  ScopedStateArena(const ScopedStateArena&) = delete;
+  ScopedStateArena& operator=(const ScopedStateArena&) = delete;
+
+ private:
+  // State::operator new/delete walk the guard chain.
+  friend class State;
+
+  StateArena* const arena_;
+  ScopedStateArena* const previous_;  // Next outer guard on this thread.
+};
+
 // An abstract class that represents a state of the game.
 class State {
  public:
@@ -222,6 +303,13 @@ class State {
   State(std::shared_ptr<const Game> game);
   State(const State&) = default;
 
+  // States are allocated from the active thread-local StateArena when one is
+  // installed (see ScopedStateArena), and from the global heap otherwise.
+  // These overloads apply to every derived game state, so all games benefit
+  // from arena allocation without per-game changes.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr);
+
   // Returns current player. Player numbers start from 0.
   // Negative numbers are for chance (-1) or simultaneous (-2).
   // kTerminalPlayerId should be returned on a TerminalNode().
@@ -276,6 +364,16 @@ class State {
   // is added.
   virtual std::vector<Action> LegalActions() const = 0;
 
+  // Returns the legal actions for the current player as a reference into a
+  // cache maintained by this base class. The cache is filled on first use via
+  // LegalActions() and invalidated when the state changes, whether through
+  // ApplyAction()/ApplyActions() or through a game's UndoAction() (detected
+  // via the history length, which every UndoAction implementation must
+  // shrink). Hot loops that query the same unchanged state repeatedly (e.g.
+  // tree policies, CFR tree walks) should prefer this accessor, as repeated
+  // calls avoid both the recomputation and the per-call vector copy.
+  const std::vector<Action>& LegalActionsRef() const;
+
   // Returns a vector containing 1 for legal actions and 0 for illegal actions.
   // The length is `game.NumDistinctActions()` for player nodes, and
   // `game.MaxChanceOutcomes()` for chance nodes.
@@ -309,6 +407,15 @@ class State {
   // implementation of operator==.
   virtual std::string ToString() const = 0;
 
+  // A 64-bit key identifying the world state, for transposition tables and
+  // other caches that should treat states reached by different move orders
+  // as the same. The default implementation hashes ToString(), so the key is
+  // only as Markov as the game's string rendering; games that maintain an
+  // incremental hash (e.g. Zobrist) should override it. As with
+  // InformationStateKey(), distinct states can collide with vanishingly
+  // small probability.
+  virtual uint64_t Key() const;
+
   // Returns true if these states are equal, false otherwise. Two states are
   // equal if they are the same world state; the interpretation might differ
   // across games. For instance, in an imperfect information game, the full
@@ -420,6 +527,14 @@ class State {
   // including chance) and the `State` objects.
   std::string HistoryString() const { return absl::StrJoin(History(), ", "); }
 
+  // Releases excess capacity held by per-state containers (the history
+  // vector's geometric growth leaves up to 2x slack, plus any cached legal
+  // actions). Jobs that retain millions of states (e.g. full-tree
+  // enumeration via GetAllStates) should call this on each retained state;
+  // it roughly halves per-state history memory for long games. Games with
+  // large internal vectors can override it, calling the base version first.
+  virtual void ShrinkToFit();
+
   // Return how many moves have been done so far in the game.
   // When players make simultaneous moves, this counts only as a one move.
   // Chance transitions count also as one move.
@@ -485,6 +600,20 @@ class State {
     return InformationStateString(CurrentPlayer());
   }
 
+  // A 64-bit key identifying the information state, usable as a hash-map key
+  // in tabular solvers in place of InformationStateString(), which allocates
+  // a fresh string on every call. The default implementation hashes the
+  // information state string together with the player (so keys are unique
+  // across players, mirroring the string contract above); games can override
+  // it with an incrementally-maintained hash that avoids the string
+  // altogether. Distinct information states can collide with vanishingly
+  // small probability, so solvers keying on this should verify lookups
+  // against the full string in debug builds (see SPIEL_DCHECK_* macros).
+  virtual uint64_t InformationStateKey(Player player) const;
+  uint64_t InformationStateKey() const {
+    return InformationStateKey(CurrentPlayer());
+  }
+
   // Vector form, useful for neural-net function approximation approaches.
   // The size of the vector must match Game::InformationStateShape()
   // with values in lexicographic order. E.g. for 2x4x3, order would be:
@@ -617,6 +746,20 @@ class State {
     SpielFatalError("ChanceOutcomes unimplemented!");
   }
 
+  // For chance nodes that draw from one of a fixed set of distributions
+  // shared by the whole game (die rolls, a full-deck deal), returns a
+  // pointer, valid for the lifetime of the game, to a table with the same
+  // contents that ChanceOutcomes() would return here. Structurally identical
+  // chance nodes return the same pointer, so callers expanding many chance
+  // nodes (e.g. CFR) can avoid rebuilding the vector each time; see
+  // ChanceOutcomesRef() below. Returns nullptr (the default) when the
+  // distribution depends on the position. Only called at chance nodes.
+  // Games implement this by registering tables with
+  // Game::MakeChanceOutcomeTable in their constructor.
+  virtual const ActionsAndProbs* ChanceOutcomeTable() const {
+    return nullptr;
+  }
+
   // Lists the valid chance outcomes at the current state.
   // Derived classes may substitute this with a more efficient implementation.
   virtual std::vector<Action> LegalChanceOutcomes() const {
@@ -644,6 +787,22 @@ class State {
   // If overridden, this must be the inverse of Game::DeserializeState.
   virtual std::string Serialize() const;
 
+  // Optional binary snapshot hooks bypassing history replay. A game whose
+  // state core is flat data can override both to copy it in and out
+  // directly; restoring then costs O(core size) instead of replaying the
+  // whole action history. Games overriding these should also override
+  // Game::SupportsStateSnapshots to return true.
+  //
+  // Note: Like states built with Game::NewInitialState(string), restored
+  // states do not carry the action history, and the buffer is a raw memory
+  // representation, so write and read on systems with the same layout.
+  virtual void SnapshotTo(std::string* buffer) const {
+    SpielFatalError("SnapshotTo unimplemented!");
+  }
+  virtual void RestoreSnapshot(absl::string_view buffer) {
+    SpielFatalError("RestoreSnapshot unimplemented!");
+  }
+
   // Resamples a new history from the information state from player_id's view.
   // This resamples a private for the other players, but holds player_id's
   // privates constant, and the public information constant.
@@ -713,6 +872,14 @@ class State {
   // should override this function.
   virtual int MeanFieldPopulation() const;
 
+  // Approximate number of bytes held by this state: the object itself plus
+  // the heap storage it owns. For memory telemetry and capacity planning,
+  // not allocator-exact accounting. The base implementation only knows the
+  // base-class members; games whose states own significant storage should
+  // override as
+  //   sizeof(*this) - sizeof(State) + State::MemoryFootprint() + <heap bytes>
+  virtual int64_t MemoryFootprint() const;
+
  protected:
   // See ApplyAction.
   virtual void DoApplyAction(Action action_id) {
@@ -732,6 +899,12 @@ class State {
   // Information that changes over the course of the game.
   std::vector<PlayerAction> history_;
   int move_number_;
+
+ private:
+  // Memoization for LegalActionsRef(): the cached vector and the history
+  // length at which it was computed (-1 when empty or invalidated).
+  mutable std::vector<Action> cached_legal_actions_;
+  mutable int cached_legal_actions_history_size_ = -1;
 };
 
 std::ostream& operator<<(std::ostream& stream, const State& state);
@@ -781,6 +954,21 @@ class Game : public std::enable_shared_from_this<Game> {
   // Maximum number of distinct chance outcomes for chance nodes in the game.
   virtual int MaxChanceOutcomes() const { return 0; }
 
+  // Approximate bytes held by the game object itself (usually small; states
+  // dominate). See State::MemoryFootprint.
+  virtual int64_t MemoryFootprint() const;
+
+  // Advances a batch of states by one action each: states[i] receives
+  // actions[i]. States that are already terminal are left untouched, so that
+  // vectorized environments can keep fixed-size batches across episode
+  // boundaries. The two spans must have the same length.
+  //
+  // The default implementation simply loops over the batch; games with small,
+  // flat state representations can override it with a cache-friendly fast
+  // path that advances all states in one pass.
+  virtual void BatchStep(absl::Span<State* const> states,
+                         absl::Span<const Action> actions) const;
+
   // If the game is parameterizable, returns an object with the current
   // parameter values, including defaulted values. Returns empty parameters
   // otherwise.
@@ -870,6 +1058,19 @@ class Game : public std::enable_shared_from_this<Game> {
   // State::Serialize (i.e. that method should also be overridden).
   virtual std::unique_ptr<State> DeserializeState(const std::string& str) const;
 
+  // Whether states of this game implement the binary snapshot hooks
+  // (State::SnapshotTo / State::RestoreSnapshot). When true,
+  // SerializeGameAndStatePacked stores snapshots, making restore cost
+  // independent of history length.
+  virtual bool SupportsStateSnapshots() const { return false; }
+
+  // Rebuilds a state from a buffer written by State::SnapshotTo.
+  std::unique_ptr<State> RestoreSnapshot(absl::string_view buffer) const {
+    std::unique_ptr<State> state = NewInitialState();
+    state->RestoreSnapshot(buffer);
+    return state;
+  }
+
   // The maximum length of any one game (in terms of number of decision nodes
   // visited in the game tree). For a simultaneous action game, this is the
   // maximum number of joint decisions. In a turn-based game, this is the
@@ -976,9 +1177,36 @@ class Game : public std::enable_shared_from_this<Game> {
     SpielFatalError("NewInitialStateForPopulation is not implemented.");
   }
 
+  // The fully-flattened parameter view: the defaults from the game type's
+  // parameter specification overlaid with any user-supplied values, resolved
+  // once at construction. Unlike GetParameters() this does not track which
+  // defaults have been consulted (and so never touches a mutex), making it
+  // the right accessor for anything that reads parameters after LoadGame
+  // returns, e.g. during state construction.
+  const GameParameters& FlatParameters() const { return flat_parameters_; }
+
+  // Typed lookup into FlatParameters(). Fatal if the key is absent from both
+  // the supplied parameters and the parameter specification.
+  template <typename T>
+  T FlatParameterValue(const std::string& key) const {
+    auto iter = flat_parameters_.find(key);
+    if (iter == flat_parameters_.end()) {
+      SpielFatalError(absl::StrCat("The parameter for ", key,
+                                   " is missing in game ", ToString()));
+    }
+    return iter->second.value<T>();
+  }
+
  protected:
   Game(GameType game_type, GameParameters game_parameters)
-      : game_type_(game_type), game_parameters_(game_parameters) {}
+      : game_type_(game_type), game_parameters_(game_parameters) {
+    // Pre-resolve the flattened parameter view so that post-construction
+    // lookups need no defaulting logic.
+    flat_parameters_ = game_type_.parameter_specification;
+    for (const auto& [key, value] : game_parameters_) {
+      flat_parameters_[key] = value;
+    }
+  }
 
   // Access to game parameters. Returns the value provided by the user. If not:
   // - Defaults to the value stored as the default in
@@ -1028,17 +1256,32 @@ class Game : public std::enable_shared_from_this<Game> {
     return default_game_parameter.value<T>();
   }
 
+  // Stores a fixed chance-outcome distribution for the lifetime of the game
+  // and returns a stable pointer to it; see State::ChanceOutcomeTable().
+  // Call from the game constructor only: it is not thread-safe against
+  // concurrent readers.
+  const ActionsAndProbs* MakeChanceOutcomeTable(ActionsAndProbs outcomes) {
+    chance_outcome_tables_.push_back(std::move(outcomes));
+    return &chance_outcome_tables_.back();
+  }
+
   // The game type.
   GameType game_type_;
 
   // Any parameters supplied when constructing the game.
   GameParameters game_parameters_;
 
+  // See FlatParameters().
+  GameParameters flat_parameters_;
+
   // Track the parameters for which a default value has been used. This
   // enables us to report the actual value used for every parameter.
   mutable GameParameters defaulted_parameters_
       ABSL_GUARDED_BY(mutex_defaulted_parameters_);
   mutable absl::Mutex mutex_defaulted_parameters_;
+
+  // A deque for pointer stability as tables are registered.
+  std::deque<ActionsAndProbs> chance_outcome_tables_;
 };
 
 #define CONCAT_(x, y) x##y
@@ -1063,10 +1306,21 @@ class GameRegisterer {
   static void RegisterGame(const GameType& game_type, CreateFunc creator);
 
  private:
+  // Copies the registered entry for the game out of the map, if there is one.
+  // Takes the registry mutex in shared mode.
+  static absl::optional<std::pair<GameType, CreateFunc>> LookupFactory(
+      const std::string& short_name);
+
+  // Guards factories(). Before game plugins, all registration ran before
+  // main() and the map was effectively read-only; LoadGamePlugin registers
+  // games at runtime, so readers now take this shared and registration takes
+  // it exclusively.
+  static absl::Mutex& factories_mutex();
+
   // Returns a "global" map of registrations (i.e. an object that lives from
   // initialization to the end of the program). Note that we do not just use
   // a static data member, as we want the map to be initialized before first
-  // use.
+  // use. Guarded by factories_mutex().
   static std::map<std::string, std::pair<GameType, CreateFunc>>& factories() {
     static std::map<std::string, std::pair<GameType, CreateFunc>> impl;
     return impl;
@@ -1101,6 +1355,12 @@ std::shared_ptr<const Game> LoadGame(GameParameters params);
 // probabilities sum to 1.
 void NormalizePolicy(ActionsAndProbs* policy);
 
+// Returns the chance outcomes of `state` without copying when the game
+// shares them through State::ChanceOutcomeTable(); `scratch` provides the
+// storage when it does not. The reference is invalidated when `scratch` is.
+const ActionsAndProbs& ChanceOutcomesRef(const State& state,
+                                         ActionsAndProbs* scratch);
+
 // Used to sample a policy or chance outcome distribution.
 // Probabilities of the actions must sum to 1.
 // The parameter z should be a sample from a uniform distribution on the range
@@ -1147,6 +1407,26 @@ std::string SerializeGameAndState(const Game& game, const State& state);
 std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
 DeserializeGameAndState(const std::string& serialized_state);
 
+// A binary counterpart of SerializeGameAndState for bulk state persistence:
+// a versioned, length-prefixed container holding the game and state payloads
+// (the same strings produced by Game::Serialize and State::Serialize), with
+// optional byte-level compression selected by a one-byte scheme header as in
+// Observation::Compress. Restore cost is that of Game::DeserializeState, so
+// games that override State::Serialize / Game::DeserializeState with direct
+// snapshots restore in time independent of the history length. (This is
+// distinct from the libnop-backed SerializeGameAndStateBinary in
+// libnop/binary_serialization.h, which serializes structured game
+// parameters rather than the string payloads.)
+//
+// Note: The container stores lengths in a raw memory representation, so as
+// with Observation::Compress, write and read on systems with the same
+// endianness. The sampled-stochastic caveat of DeserializeGameAndState
+// applies here too.
+std::string SerializeGameAndStatePacked(const Game& game, const State& state,
+                                        bool compress = true);
+std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
+DeserializeGameAndStatePacked(const std::string& serialized);
+
 // Convert GameTypes from and to strings. Used for serialization of objects
 // that contain them.
 // Note: these are not finished! They will be finished by an external
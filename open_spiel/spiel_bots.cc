@@ -22,6 +22,7 @@
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
 #include "open_spiel/abseil-cpp/absl/random/random.h"
 #include "open_spiel/abseil-cpp/absl/random/uniform_int_distribution.h"
@@ -38,6 +39,16 @@
 namespace open_spiel {
 namespace {
 
+// Fills `response->legal_actions` with `player`'s legal actions, reusing its
+// capacity, and returns a reference to it. For the current player this
+// returns the state's own cached vector instead, avoiding the copy entirely.
+const std::vector<Action>& LegalActionsInto(const State& state, Player player,
+                                            BotResponse* response) {
+  if (state.CurrentPlayer() == player) return state.LegalActionsRef();
+  response->legal_actions = state.LegalActions(player);
+  return response->legal_actions;
+}
+
 class UniformRandomBot : public Bot {
  public:
   UniformRandomBot(Player player_id, int seed)
@@ -68,6 +79,19 @@ class UniformRandomBot : public Bot {
     return std::make_pair(policy, policy[selection].first);
   }
 
+  void StepInto(const State& state, BotResponse* response) override {
+    const std::vector<Action>& legal_actions =
+        LegalActionsInto(state, player_id_, response);
+    const int num_legal_actions = legal_actions.size();
+    const double p = 1.0 / num_legal_actions;
+    response->policy.clear();
+    response->policy.reserve(num_legal_actions);
+    for (auto action : legal_actions) response->policy.emplace_back(action, p);
+    int selection =
+        absl::uniform_int_distribution<int>(0, num_legal_actions - 1)(rng_);
+    response->action = legal_actions[selection];
+  }
+
   bool IsClonable() const override { return true; }
   std::unique_ptr<Bot> Clone() override {
     return std::make_unique<UniformRandomBot>(*this);
@@ -104,6 +128,11 @@ class StatefulRandomBot : public UniformRandomBot {
     state_->ApplyAction(ret.second);
     return ret;
   }
+  void StepInto(const State& state, BotResponse* response) override {
+    CheckStatesEqual(state, *state_);
+    UniformRandomBot::StepInto(*state_, response);
+    state_->ApplyAction(response->action);
+  }
 
   std::unique_ptr<Bot> Clone() override {
     return std::make_unique<StatefulRandomBot>(*this);
@@ -144,6 +173,13 @@ class PolicyBot : public Bot {
     return {actions_and_probs, SampleAction(actions_and_probs, rng_).first};
   }
 
+  void StepInto(const State& state, BotResponse* response) override {
+    // The policy lookup itself returns a fresh vector, but moving it into the
+    // response avoids the copy StepWithPolicy would make.
+    response->policy = GetPolicy(state);
+    response->action = SampleAction(response->policy, rng_).first;
+  }
+
   bool IsClonable() const override { return true; }
   std::unique_ptr<Bot> Clone() override {
     return std::make_unique<PolicyBot>(*this);
@@ -184,6 +220,20 @@ class FixedActionPreferenceBot : public Bot {
     return {actions_and_probs, actions_and_probs[0].first};
   }
 
+  void StepInto(const State& state, BotResponse* response) override {
+    const std::vector<Action>& legal_actions =
+        LegalActionsInto(state, player_id_, response);
+    for (Action action : actions_) {
+      if (absl::c_linear_search(legal_actions, action)) {
+        response->policy.clear();
+        response->policy.emplace_back(action, 1.0);
+        response->action = action;
+        return;
+      }
+    }
+    SpielFatalError("No legal actions in action list.");
+  }
+
   bool IsClonable() const override { return true; }
   std::unique_ptr<Bot> Clone() override {
     return std::make_unique<FixedActionPreferenceBot>(*this);
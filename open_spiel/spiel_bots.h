@@ -50,6 +50,18 @@
 
 namespace open_spiel {
 
+// A reusable response buffer for Bot::StepInto. Evaluation loops keep one
+// BotResponse alive across calls; implementations overwrite the fields in
+// place, so the vectors' capacity is reused instead of reallocated per step.
+struct BotResponse {
+  Action action = kInvalidAction;
+  // The policy the action was chosen from, for bots that provide one (see
+  // ProvidesPolicy()); cleared otherwise.
+  ActionsAndProbs policy;
+  // Scratch space for implementations; contents are unspecified after a call.
+  std::vector<Action> legal_actions;
+};
+
 // A simple bot that can play moves and be restarted. The bot may be stateful,
 // thus, one should restart it to provide states from a different history line.
 //
@@ -78,6 +90,23 @@ class Bot {
   // safely assumes the action was played.
   virtual Action Step(const State& state) = 0;
 
+  // Buffer-reusing variant of Step for hot evaluation loops: writes the
+  // chosen action (and, for bots that provide a policy, the policy it was
+  // chosen from) into `response` instead of returning freshly allocated
+  // vectors. Like Step, the bot may assume the chosen action was played.
+  // The default implementation falls back to Step()/StepWithPolicy(), so
+  // overriding it is purely an optimization.
+  virtual void StepInto(const State& state, BotResponse* response) {
+    if (ProvidesPolicy()) {
+      std::pair<ActionsAndProbs, Action> step = StepWithPolicy(state);
+      response->policy = std::move(step.first);
+      response->action = step.second;
+    } else {
+      response->policy.clear();
+      response->action = Step(state);
+    }
+  }
+
   // Let the bot know that a different player made an action at a given state.
   //
   // The state is the state at which the `player_id` player decided to take
@@ -340,6 +340,52 @@ bool StrContainsIgnoreCase(const std::string& haystack,
 
 #endif  // !defined(NDEBUG)
 
+// Tiered checking for per-move hot paths (DoApplyAction bodies, tensor
+// indexing). SPIEL_HOT_CHECK_* behaves exactly like SPIEL_CHECK_* by
+// default, so nothing changes unless a build opts in:
+//
+//   -DOPEN_SPIEL_SAMPLED_HOT_CHECKS: each call site still fires on its first
+//     execution per thread and then once every
+//     OPEN_SPIEL_HOT_CHECK_SAMPLE_PERIOD executions (default 256), keeping a
+//     safety net at a fraction of the cost.
+//   -DOPEN_SPIEL_NO_HOT_CHECKS: hot-path checks compile to nothing.
+//
+// API-boundary validation (argument checking in public entry points) should
+// remain plain SPIEL_CHECK_*, which is unaffected by these flags.
+#if defined(OPEN_SPIEL_NO_HOT_CHECKS)
+
+#define SPIEL_HOT_CHECK(check)
+
+#elif defined(OPEN_SPIEL_SAMPLED_HOT_CHECKS)
+
+#if !defined(OPEN_SPIEL_HOT_CHECK_SAMPLE_PERIOD)
+#define OPEN_SPIEL_HOT_CHECK_SAMPLE_PERIOD 256
+#endif
+
+#define SPIEL_HOT_CHECK(check)                                               \
+  do {                                                                       \
+    static thread_local unsigned int spiel_hot_check_tick_ = 0;              \
+    if (spiel_hot_check_tick_++ % OPEN_SPIEL_HOT_CHECK_SAMPLE_PERIOD == 0) { \
+      check;                                                                 \
+    }                                                                        \
+  } while (false)
+
+#else  // always-on, the default.
+
+#define SPIEL_HOT_CHECK(check) check
+
+#endif
+
+#define SPIEL_HOT_CHECK_GE(x, y) SPIEL_HOT_CHECK(SPIEL_CHECK_GE(x, y))
+#define SPIEL_HOT_CHECK_GT(x, y) SPIEL_HOT_CHECK(SPIEL_CHECK_GT(x, y))
+#define SPIEL_HOT_CHECK_LE(x, y) SPIEL_HOT_CHECK(SPIEL_CHECK_LE(x, y))
+#define SPIEL_HOT_CHECK_LT(x, y) SPIEL_HOT_CHECK(SPIEL_CHECK_LT(x, y))
+#define SPIEL_HOT_CHECK_EQ(x, y) SPIEL_HOT_CHECK(SPIEL_CHECK_EQ(x, y))
+#define SPIEL_HOT_CHECK_NE(x, y) SPIEL_HOT_CHECK(SPIEL_CHECK_NE(x, y))
+#define SPIEL_HOT_CHECK_PROB(x) SPIEL_HOT_CHECK(SPIEL_CHECK_PROB(x))
+#define SPIEL_HOT_CHECK_TRUE(x) SPIEL_HOT_CHECK(SPIEL_CHECK_TRUE(x))
+#define SPIEL_HOT_CHECK_FALSE(x) SPIEL_HOT_CHECK(SPIEL_CHECK_FALSE(x))
+
 // When an error is encountered, OpenSpiel code should call SpielFatalError()
 // which will forward the message to the current error handler.
 // The default error handler outputs the error message to stderr, and exits
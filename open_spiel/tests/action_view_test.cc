@@ -53,10 +53,31 @@ void TestFlatJointActions() {
   SPIEL_CHECK_EQ(expected_joint_action, 2 * 3 * 2);
 }
 
+void TestActionViewCache() {
+  std::shared_ptr<const Game> game = LoadGame("matrix_rps");
+  std::unique_ptr<State> state = game->NewInitialState();
+
+  ActionViewCache cache;
+  const ActionView& view = cache.GetView(*state);
+  SPIEL_CHECK_EQ(view.current_player, state->CurrentPlayer());
+  for (int pl = 0; pl < view.num_players(); ++pl) {
+    SPIEL_CHECK_TRUE(view.legal_actions[pl] == state->LegalActions(pl));
+  }
+
+  // A second query of the same state is a hit and returns the same view.
+  const ActionView& again = cache.GetView(*state);
+  SPIEL_CHECK_EQ(&view, &again);
+  SPIEL_CHECK_EQ(cache.size(), 1);
+
+  cache.Clear();
+  SPIEL_CHECK_EQ(cache.size(), 0);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::TestFixedActions();
   open_spiel::TestFlatJointActions();
+  open_spiel::TestActionViewCache();
 }
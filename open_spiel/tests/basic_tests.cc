@@ -14,6 +14,8 @@
 
 #include "open_spiel/tests/basic_tests.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <memory>
@@ -23,10 +25,13 @@
 #include <string>
 
 #include "open_spiel/abseil-cpp/absl/container/btree_set.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace testing {
@@ -578,6 +583,97 @@ void RandomSimTestCustomObserver(const Game& game,
                    &DefaultStateChecker);
 }
 
+// A random playthrough with no checking, counting the states visited. Used by
+// RandomSimTestParallel for the simulations that are timed rather than
+// checked.
+int UncheckedRandomSimulation(std::mt19937* rng, const Game& game) {
+  std::unique_ptr<State> state = game.NewInitialState();
+  int num_moves = 0;
+  while (!state->IsTerminal()) {
+    if (state->IsChanceNode()) {
+      state->ApplyAction(SampleAction(state->ChanceOutcomes(), *rng).first);
+    } else if (state->CurrentPlayer() == kSimultaneousPlayerId) {
+      std::vector<Action> joint_action;
+      for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
+        std::vector<Action> actions = state->LegalActions(p);
+        Action action = 0;
+        if (!actions.empty()) {
+          std::uniform_int_distribution<int> dis(0, actions.size() - 1);
+          action = actions[dis(*rng)];
+        }
+        joint_action.push_back(action);
+      }
+      state->ApplyActions(joint_action);
+    } else if (state->CurrentPlayer() == kMeanFieldPlayerId) {
+      auto support = state->DistributionSupport();
+      state->UpdateDistribution(RandomDistribution(support.size(), rng));
+    } else {
+      std::vector<Action> actions = state->LegalActions();
+      std::uniform_int_distribution<int> dis(0, actions.size() - 1);
+      state->ApplyAction(actions[dis(*rng)]);
+    }
+    ++num_moves;
+  }
+  return num_moves;
+}
+
+double RandomSimTestParallel(const Game& game, int num_sims, int num_threads,
+                             double check_fraction) {
+  SPIEL_CHECK_GE(num_threads, 1);
+  SPIEL_CHECK_GE(check_fraction, 0.0);
+  SPIEL_CHECK_LE(check_fraction, 1.0);
+  const int num_checked =
+      std::min(num_sims, static_cast<int>(std::ceil(check_fraction * num_sims)));
+
+  auto run_phase = [&game, num_threads](int begin, int end,
+                                        const std::function<int(int)>& sim_fn) {
+    std::atomic<int> next_sim{begin};
+    std::atomic<int64_t> total_moves{0};
+    auto worker = [&]() {
+      while (true) {
+        int sim = next_sim.fetch_add(1, std::memory_order_relaxed);
+        if (sim >= end) break;
+        total_moves.fetch_add(sim_fn(sim), std::memory_order_relaxed);
+      }
+    };
+    if (num_threads == 1) {
+      worker();
+    } else {
+      std::vector<Thread> threads;
+      threads.reserve(num_threads);
+      for (int t = 0; t < num_threads; ++t) threads.emplace_back(worker);
+      for (Thread& thread : threads) thread.join();
+    }
+    return total_moves.load();
+  };
+
+  // Phase 1 (untimed): full checking on a sample of the simulations, so the
+  // game is still exercised with every invariant at scale.
+  run_phase(0, num_checked, [&game](int sim) {
+    std::mt19937 rng(sim);
+    RandomSimulation(&rng, game, /*undo=*/false, /*serialize=*/true,
+                     /*verbose=*/false, /*mask_test=*/true, nullptr,
+                     &DefaultStateChecker);
+    return 0;
+  });
+
+  // Phase 2 (timed): plain playthroughs, giving a clean throughput number.
+  const absl::Time start = absl::Now();
+  int64_t total_moves = run_phase(num_checked, num_sims, [&game](int sim) {
+    std::mt19937 rng(sim);
+    return UncheckedRandomSimulation(&rng, game);
+  });
+  double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  double states_per_second = seconds > 0 ? total_moves / seconds : 0;
+
+  std::cout << "RandomSimTestParallel, game = " << game.GetType().short_name
+            << ", num_sims = " << num_sims << " (" << num_checked
+            << " checked), num_threads = " << num_threads << ": "
+            << total_moves << " states in " << seconds << "s, "
+            << states_per_second << " states/sec" << std::endl;
+  return states_per_second;
+}
+
 // Format chance outcomes as a string, for error messages.
 std::string ChanceOutcomeStr(const ActionsAndProbs& chance_outcomes) {
   std::string str;
@@ -71,6 +71,16 @@ void RandomSimTestNoSerialize(const Game& game, int num_sims);
 
 void RandomSimTestCustomObserver(const Game& game,
                                  const std::shared_ptr<Observer> observer);
+
+// Runs num_sims random simulations spread across num_threads worker threads
+// and returns the measured throughput in states per second. Full consistency
+// checking (as in RandomSimTest) runs on roughly check_fraction of the
+// simulations in an untimed first phase; the remaining simulations are plain
+// playthroughs whose timing gives a clean per-game perf number to track.
+// Simulations are seeded by simulation index, so the episodes played do not
+// depend on the thread count.
+double RandomSimTestParallel(const Game& game, int num_sims, int num_threads,
+                             double check_fraction = 0.1);
 // Verifies that ResampleFromInfostate is correctly implemented.
 void ResampleInfostateTest(const Game& game, int num_sims);
 
@@ -14,12 +14,18 @@
 
 #include "open_spiel/spiel.h"
 
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <memory>
 #include <random>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "open_spiel/canonical_game_strings.h"
+#include "open_spiel/game_plugins.h"
 #include "open_spiel/games/kuhn_poker/kuhn_poker.h"
 #include "open_spiel/games/leduc_poker/leduc_poker.h"
 #include "open_spiel/games/liars_dice/liars_dice.h"
@@ -65,6 +71,15 @@ void TicTacToeTests() {
   RandomSimTest(*tic_tac_toe, /*num_sims=*/100);
 }
 
+void ParallelSimTests() {
+  double states_per_second = RandomSimTestParallel(
+      *LoadGame("tic_tac_toe"), /*num_sims=*/200, /*num_threads=*/4);
+  SPIEL_CHECK_GT(states_per_second, 0);
+  // Also valid single-threaded and for games with chance nodes.
+  RandomSimTestParallel(*LoadGame("kuhn_poker"), /*num_sims=*/50,
+                        /*num_threads=*/1);
+}
+
 // Dummy game to test flat joint action logic.
 class FlatJointActionTestGame : public SimMoveGame {
  public:
@@ -163,6 +178,23 @@ void PolicyTest() {
     }
     TestPoliciesCanPlay(*uniform_policy, *game);
   }
+
+  // In-place policy queries must match the by-value accessors.
+  std::shared_ptr<const Game> kuhn = LoadGame("kuhn_poker");
+  TabularPolicy tabular = GetUniformPolicy(*kuhn);
+  std::unique_ptr<State> state = kuhn->NewInitialState();
+  state->ApplyAction(0);
+  state->ApplyAction(1);
+  std::string info_state = state->InformationStateString();
+  ActionsAndProbs in_place;
+  tabular.GetStatePolicy(info_state, &in_place);
+  SPIEL_CHECK_TRUE(in_place == tabular.GetStatePolicy(info_state));
+  // Call through the base class: UniformPolicy's (state, player) override
+  // hides the other GetStatePolicy overloads from lookup on the derived type.
+  UniformPolicy uniform;
+  const Policy& uniform_policy_ref = uniform;
+  uniform_policy_ref.GetStatePolicy(*state, &in_place);
+  SPIEL_CHECK_TRUE(in_place == uniform_policy_ref.GetStatePolicy(*state));
 }
 
 void LeducPokerDeserializeTest() {
@@ -200,6 +232,41 @@ void LeducPokerDeserializeTest() {
       serialized_game_and_state);
 }
 
+void PackedSerializationTest() {
+  std::shared_ptr<const Game> game = LoadGame("leduc_poker");
+  std::unique_ptr<State> state = game->NewInitialState();
+  for (Action action : {0, 3, 1, 1}) state->ApplyAction(action);
+
+  for (bool compress : {false, true}) {
+    std::string serialized =
+        SerializeGameAndStatePacked(*game, *state, compress);
+    std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
+        game_and_state = DeserializeGameAndStatePacked(serialized);
+    SPIEL_CHECK_EQ(game_and_state.first->ToString(), game->ToString());
+    SPIEL_CHECK_EQ(game_and_state.second->ToString(), state->ToString());
+    SPIEL_CHECK_EQ(game_and_state.second->HistoryString(),
+                   state->HistoryString());
+  }
+
+  // The initial state round-trips too (empty state payload).
+  std::string serialized =
+      SerializeGameAndStatePacked(*game, *game->NewInitialState());
+  SPIEL_CHECK_TRUE(
+      DeserializeGameAndStatePacked(serialized).second->IsInitialState());
+
+  // Games supporting snapshots round-trip through the snapshot encoding,
+  // with restore cost independent of history length.
+  std::shared_ptr<const Game> ttt = LoadGame("tic_tac_toe");
+  SPIEL_CHECK_TRUE(ttt->SupportsStateSnapshots());
+  std::unique_ptr<State> ttt_state = ttt->NewInitialState();
+  for (Action action : {4, 0, 8, 2}) ttt_state->ApplyAction(action);
+  std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>> restored =
+      DeserializeGameAndStatePacked(
+          SerializeGameAndStatePacked(*ttt, *ttt_state));
+  SPIEL_CHECK_EQ(restored.second->ToString(), ttt_state->ToString());
+  SPIEL_CHECK_EQ(restored.second->CurrentPlayer(), ttt_state->CurrentPlayer());
+}
+
 void GameParametersTest() {
   // Basic types
   SPIEL_CHECK_TRUE(GameParameter(1).has_int_value());
@@ -304,6 +371,391 @@ void GameParametersTest() {
   SPIEL_CHECK_EQ(game2["param"].string_value(), "val");
 }
 
+void LegalActionsRefTest() {
+  auto game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+
+  // The cached reference matches LegalActions() and is stable across calls.
+  const std::vector<Action>& legal_actions = state->LegalActionsRef();
+  SPIEL_CHECK_TRUE(legal_actions == state->LegalActions());
+  SPIEL_CHECK_EQ(&legal_actions, &state->LegalActionsRef());
+
+  // Applying an action invalidates the cache.
+  Action action = legal_actions[0];
+  state->ApplyAction(action);
+  SPIEL_CHECK_TRUE(state->LegalActionsRef() == state->LegalActions());
+
+  // Undoing does too: the cache tracks the history length.
+  state->UndoAction(0, action);
+  SPIEL_CHECK_TRUE(state->LegalActionsRef() == state->LegalActions());
+  SPIEL_CHECK_EQ(state->LegalActionsRef().size(), 9);
+}
+
+void ChanceOutcomeTableTest() {
+  // Pig's only chance event is a die roll: every chance node shares one
+  // game-lifetime table that matches ChanceOutcomes().
+  auto game = LoadGame("pig");
+  std::unique_ptr<State> state = game->NewInitialState();
+  SPIEL_CHECK_TRUE(state->ChanceOutcomeTable() == nullptr);  // Decision node.
+  state->ApplyAction(state->LegalActions()[0]);  // Roll.
+  SPIEL_CHECK_TRUE(state->IsChanceNode());
+  const ActionsAndProbs* table = state->ChanceOutcomeTable();
+  SPIEL_CHECK_TRUE(table != nullptr);
+  SPIEL_CHECK_TRUE(*table == state->ChanceOutcomes());
+  SPIEL_CHECK_EQ(table->size(), 6);
+
+  // ChanceOutcomesRef avoids the copy for such games and falls back to the
+  // scratch vector for games without a table.
+  ActionsAndProbs scratch;
+  SPIEL_CHECK_EQ(&ChanceOutcomesRef(*state, &scratch), table);
+  auto kuhn = LoadGame("kuhn_poker");
+  std::unique_ptr<State> kuhn_state = kuhn->NewInitialState();
+  SPIEL_CHECK_TRUE(kuhn_state->IsChanceNode());
+  SPIEL_CHECK_EQ(&ChanceOutcomesRef(*kuhn_state, &scratch), &scratch);
+  SPIEL_CHECK_TRUE(scratch == kuhn_state->ChanceOutcomes());
+}
+
+void MemoryFootprintTest() {
+  // The base implementation accounts for the history vector, so the reported
+  // footprint grows as actions are applied.
+  auto game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  int64_t empty_bytes = state->MemoryFootprint();
+  SPIEL_CHECK_GE(empty_bytes, static_cast<int64_t>(sizeof(State)));
+  for (int i = 0; i < 5; ++i) state->ApplyAction(state->LegalActions()[0]);
+  SPIEL_CHECK_GT(state->MemoryFootprint(), empty_bytes);
+
+  // Overriding games add their own heap members on top of the base estimate.
+  auto chess = LoadGame("chess");
+  std::unique_ptr<State> chess_state = chess->NewInitialState();
+  chess_state->ApplyAction(chess_state->LegalActions()[0]);
+  SPIEL_CHECK_GE(chess_state->MemoryFootprint(),
+                 static_cast<int64_t>(sizeof(State)));
+
+  // Game-level accounting includes registered chance-outcome tables.
+  auto pig = LoadGame("pig");
+  SPIEL_CHECK_GT(pig->MemoryFootprint(), static_cast<int64_t>(sizeof(Game)));
+}
+
+void FlatParametersTest() {
+  // Supplied values overlay the specification defaults.
+  auto game = LoadGame("kuhn_poker(players=3)");
+  SPIEL_CHECK_EQ(game->FlatParameterValue<int>("players"), 3);
+  auto default_game = LoadGame("kuhn_poker");
+  SPIEL_CHECK_EQ(default_game->FlatParameterValue<int>("players"), 2);
+  SPIEL_CHECK_FALSE(default_game->FlatParameters().empty());
+}
+
+void LoadGameCacheTest() {
+  // Repeat loads of the same parameterization share one instance.
+  std::shared_ptr<const Game> a = LoadGame("tic_tac_toe");
+  std::shared_ptr<const Game> b = LoadGame("tic_tac_toe");
+  SPIEL_CHECK_EQ(a.get(), b.get());
+  // Different parameterizations get different instances.
+  SPIEL_CHECK_TRUE(LoadGame("kuhn_poker").get() !=
+                   LoadGame("kuhn_poker(players=3)").get());
+}
+
+void HotCheckTest() {
+  // In the default build SPIEL_HOT_CHECK_* is exactly SPIEL_CHECK_*; these
+  // must all pass. (The sampled and compiled-out modes are build flags and
+  // cannot be exercised from within one binary.)
+  for (int i = 0; i < 3; ++i) {
+    SPIEL_HOT_CHECK_EQ(i, i);
+    SPIEL_HOT_CHECK_NE(i, i + 1);
+    SPIEL_HOT_CHECK_LT(i, 3);
+    SPIEL_HOT_CHECK_TRUE(i >= 0);
+    SPIEL_HOT_CHECK_FALSE(i < 0);
+  }
+}
+
+void CanonicalGameParametersTest() {
+  // The precompiled parameters must resolve to exactly the configuration the
+  // canonical strings parse to. (The poker variants need the ACPC build, so
+  // only the parameter equivalence is checked for them here.)
+  SPIEL_CHECK_EQ(
+      GameParametersToString(TurnBasedGoofspielGameParameters(4)),
+      GameParametersToString(GameParametersFromString(
+          TurnBasedGoofspielGameString(4))));
+  for (const std::string& abstraction : {"fc", "fcpa", "fullgame"}) {
+    SPIEL_CHECK_EQ(GameParametersToString(HunlGameParameters(abstraction)),
+                   GameParametersToString(GameParametersFromString(
+                       HunlGameString(abstraction))));
+    SPIEL_CHECK_EQ(GameParametersToString(HulhGameParameters(abstraction)),
+                   GameParametersToString(GameParametersFromString(
+                       HulhGameString(abstraction))));
+  }
+  // Identical configurations share one instance through the game cache,
+  // whether loaded from the string or the precompiled parameters.
+  SPIEL_CHECK_EQ(LoadGame(TurnBasedGoofspielGameString(4)).get(),
+                 LoadGame(TurnBasedGoofspielGameParameters(4)).get());
+}
+
+void GamePluginTest() {
+  // With no plugin path configured, lookup is a clean miss: no error, no
+  // registration. (Actually loading a plugin needs a built .so, which is an
+  // integration concern; here we only check the search logic.)
+  unsetenv(kGamePluginPathEnvVar);
+  SPIEL_CHECK_FALSE(LoadGamePlugin("there_is_no_such_game"));
+  // A configured path without a matching plugin file is also a clean miss.
+  setenv(kGamePluginPathEnvVar, "/nonexistent_plugin_dir", /*overwrite=*/1);
+  SPIEL_CHECK_FALSE(LoadGamePlugin("there_is_no_such_game"));
+  unsetenv(kGamePluginPathEnvVar);
+  SPIEL_CHECK_FALSE(IsGameRegistered("there_is_no_such_game"));
+}
+
+void BatchedObservationTest() {
+  auto game = LoadGame("tic_tac_toe");
+  std::shared_ptr<Observer> observer =
+      game->MakeObserver(absl::nullopt, /*params=*/{});
+  constexpr int kBatchSize = 4;
+  BatchedObservation batch(*game, observer, kBatchSize);
+  Observation single(*game, observer);
+  SPIEL_CHECK_EQ(batch.Tensor().size(), kBatchSize * batch.row_size());
+
+  // Each row of the batch must match the single-observation path.
+  std::unique_ptr<State> state = game->NewInitialState();
+  for (int row = 0; row < kBatchSize; ++row) {
+    batch.SetFrom(*state, /*player=*/0, row);
+    single.SetFrom(*state, /*player=*/0);
+    absl::Span<float> row_tensor = batch.RowTensor(row);
+    absl::Span<float> expected = single.Tensor();
+    SPIEL_CHECK_EQ(row_tensor.size(), expected.size());
+    for (int i = 0; i < expected.size(); ++i) {
+      SPIEL_CHECK_EQ(row_tensor[i], expected[i]);
+    }
+    if (!state->IsTerminal()) state->ApplyAction(state->LegalActions()[0]);
+  }
+}
+
+void CompiledObservationTest() {
+  // SetFrom replays a compiled write plan for fixed-layout observers; its
+  // output must match the state's own tensor at every step.
+  for (const char* game_name : {"tic_tac_toe", "kuhn_poker"}) {
+    auto game = LoadGame(game_name);
+    std::shared_ptr<Observer> observer =
+        game->MakeObserver(absl::nullopt, /*params=*/{});
+    Observation observation(*game, observer);
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (!state->IsTerminal()) {
+      if (!state->IsChanceNode()) {
+        Player player = state->CurrentPlayer();
+        observation.SetFrom(*state, player);
+        std::vector<float> expected = state->ObservationTensor(player);
+        absl::Span<float> actual = observation.Tensor();
+        SPIEL_CHECK_EQ(actual.size(), expected.size());
+        for (int i = 0; i < expected.size(); ++i) {
+          SPIEL_CHECK_EQ(actual[i], expected[i]);
+        }
+      }
+      state->ApplyAction(state->LegalActions()[0]);
+    }
+  }
+}
+
+void InternedTabularPolicyTest() {
+  auto game = LoadGame("kuhn_poker");
+  TabularPolicy uniform = GetUniformPolicy(*game);
+
+  // Conversion preserves every state policy, queryable through the Policy
+  // interface and by interned id.
+  InternedTabularPolicy interned(uniform);
+  SPIEL_CHECK_EQ(interned.size(), uniform.size());
+  for (const auto& [info_state, state_policy] : uniform.PolicyTable()) {
+    SPIEL_CHECK_TRUE(interned.GetStatePolicy(info_state) == state_policy);
+    int id = interned.Find(info_state);
+    SPIEL_CHECK_GE(id, 0);
+    SPIEL_CHECK_EQ(interned.Intern(info_state), id);  // Stable on re-intern.
+    SPIEL_CHECK_TRUE(interned.StatePolicyById(id) == state_policy);
+  }
+  SPIEL_CHECK_EQ(interned.Find("not an info state"), -1);
+
+  // Bulk construction from entries matches, and round-trips to the
+  // map-backed representation.
+  std::vector<std::pair<std::string, ActionsAndProbs>> entries(
+      uniform.PolicyTable().begin(), uniform.PolicyTable().end());
+  InternedTabularPolicy bulk(std::move(entries));
+  SPIEL_CHECK_EQ(bulk.size(), uniform.size());
+  TabularPolicy round_trip = bulk.ToTabularPolicy();
+  for (const auto& [info_state, state_policy] : uniform.PolicyTable()) {
+    SPIEL_CHECK_TRUE(round_trip.GetStatePolicy(info_state) == state_policy);
+  }
+}
+
+void PartialTabularPolicyFilterTest() {
+  auto game = LoadGame("kuhn_poker");
+  TabularPolicy uniform = GetUniformPolicy(*game);
+
+  // A partial policy holding roughly half the infostates; the rest must be
+  // served by the fallback (uniform over legal actions).
+  std::unordered_map<std::string, ActionsAndProbs> table;
+  bool keep = true;
+  for (const auto& [info_state, state_policy] : uniform.PolicyTable()) {
+    if (keep) table[info_state] = state_policy;
+    keep = !keep;
+  }
+  PartialTabularPolicy partial(table);
+
+  // Walk the game: hits come from the table, misses from the fallback; both
+  // routes agree with the uniform policy here, so every decision node must
+  // match it exactly.
+  std::vector<std::unique_ptr<State>> to_visit;
+  to_visit.push_back(game->NewInitialState());
+  ActionsAndProbs scratch;
+  while (!to_visit.empty()) {
+    std::unique_ptr<State> state = std::move(to_visit.back());
+    to_visit.pop_back();
+    if (state->IsTerminal()) continue;
+    if (!state->IsChanceNode()) {
+      std::string info_state = state->InformationStateString();
+      ActionsAndProbs expected = uniform.GetStatePolicy(info_state);
+      SPIEL_CHECK_TRUE(partial.GetStatePolicy(*state) == expected);
+      if (table.count(info_state) > 0) {
+        // String-keyed lookups, including the in-place variant, on hits.
+        SPIEL_CHECK_TRUE(partial.GetStatePolicy(info_state) == expected);
+        partial.GetStatePolicy(info_state, &scratch);
+        SPIEL_CHECK_TRUE(scratch == expected);
+      }
+    }
+    for (Action action : state->LegalActions()) {
+      to_visit.push_back(state->Child(action));
+    }
+  }
+
+  // Keys added after construction must be found, not routed to the fallback.
+  const std::string added = "added later";
+  ActionsAndProbs deterministic = {{0, 1.}, {1, 0.}};
+  partial.SetStatePolicy(added, deterministic);
+  SPIEL_CHECK_TRUE(partial.GetStatePolicy(added) == deterministic);
+  partial.SetProb(added, 1, 0.5);
+  SPIEL_CHECK_EQ(GetProb(partial.GetStatePolicy(added), 1), 0.5);
+}
+
+void BinaryTabularPolicyTest() {
+  auto game = LoadGame("kuhn_poker");
+  TabularPolicy policy = GetFlatDirichletPolicy(*game, /*seed=*/42);
+  const std::string filename =
+      file::GetTmpDir() + "/spiel_test_binary_policy.bin";
+  for (int bits : {8, 16, 32}) {
+    SaveTabularPolicyBinary(policy, filename, bits);
+    MmapTabularPolicy loaded(filename);
+    SPIEL_CHECK_EQ(loaded.size(), policy.size());
+    // Every entry survives the round trip to within the quantization step.
+    const double tolerance = 1.0 / ((uint64_t{1} << bits) - 1);
+    ActionsAndProbs scratch;
+    for (const auto& [info_state, state_policy] : policy.PolicyTable()) {
+      loaded.GetStatePolicy(info_state, &scratch);
+      SPIEL_CHECK_EQ(scratch.size(), state_policy.size());
+      for (const auto& [action, prob] : state_policy) {
+        const double loaded_prob = GetProb(scratch, action);
+        SPIEL_CHECK_GE(loaded_prob, 0.);
+        SPIEL_CHECK_LT(std::abs(loaded_prob - prob), tolerance);
+      }
+    }
+    // Unknown infostates return an empty list, like TabularPolicy.
+    SPIEL_CHECK_TRUE(
+        loaded.GetStatePolicy(std::string("no such state")).empty());
+    file::Remove(filename);
+  }
+}
+
+void InformationStateKeyTest() {
+  auto game = LoadGame("kuhn_poker");
+  // Two histories that differ only in the opponent's card map to the same
+  // information state for player 0, and must map to the same key.
+  std::unique_ptr<State> state1 = game->NewInitialState();
+  state1->ApplyAction(0);  // Deal card 0 to player 0.
+  state1->ApplyAction(1);  // Deal card 1 to player 1.
+  std::unique_ptr<State> state2 = game->NewInitialState();
+  state2->ApplyAction(0);
+  state2->ApplyAction(2);
+  SPIEL_CHECK_EQ(state1->InformationStateString(0),
+                 state2->InformationStateString(0));
+  SPIEL_CHECK_EQ(state1->InformationStateKey(0),
+                 state2->InformationStateKey(0));
+  // Keys are unique across players, like the strings.
+  SPIEL_CHECK_NE(state1->InformationStateKey(0),
+                 state1->InformationStateKey(1));
+  // And different information states give different keys.
+  SPIEL_CHECK_NE(state1->InformationStateKey(1),
+                 state2->InformationStateKey(1));
+}
+
+void BatchStepTest() {
+  auto game = LoadGame("tic_tac_toe");
+  constexpr int kBatchSize = 32;
+  std::vector<std::unique_ptr<State>> states;
+  states.reserve(kBatchSize);
+  for (int i = 0; i < kBatchSize; ++i) {
+    states.push_back(game->NewInitialState());
+  }
+
+  std::mt19937 rng(1234);
+  std::vector<State*> state_ptrs(kBatchSize);
+  std::vector<Action> actions(kBatchSize);
+  // Step all states to the end of their episodes; terminal states must be
+  // left untouched so the batch can keep a fixed size throughout.
+  for (int step = 0; step < game->MaxGameLength(); ++step) {
+    for (int i = 0; i < kBatchSize; ++i) {
+      state_ptrs[i] = states[i].get();
+      if (states[i]->IsTerminal()) {
+        actions[i] = 0;  // Ignored.
+      } else {
+        std::vector<Action> legal = states[i]->LegalActions();
+        actions[i] = legal[rng() % legal.size()];
+      }
+    }
+    game->BatchStep(state_ptrs, actions);
+  }
+  for (const auto& state : states) {
+    SPIEL_CHECK_TRUE(state->IsTerminal());
+  }
+}
+
+void StateArenaTest() {
+  auto game = LoadGame("tic_tac_toe");
+  StateArena arena;
+  {
+    ScopedStateArena scope(&arena);
+    std::unique_ptr<State> state = game->NewInitialState();
+    SPIEL_CHECK_TRUE(arena.Owns(state.get()));
+    // Simulate the clone-heavy access pattern of a tree search.
+    for (int i = 0; i < 100; ++i) {
+      std::unique_ptr<State> clone = state->Clone();
+      SPIEL_CHECK_TRUE(arena.Owns(clone.get()));
+      clone->ApplyAction(clone->LegalActions()[0]);
+      SPIEL_CHECK_EQ(clone->MoveNumber(), state->MoveNumber() + 1);
+    }
+    SPIEL_CHECK_GT(arena.BytesAllocated(), 0);
+  }
+  // Bulk reclamation once the "search" is done.
+  arena.Reset();
+  SPIEL_CHECK_EQ(arena.BytesAllocated(), 0);
+
+  // Nested guards: new states come from the inner arena, and a state from
+  // the outer arena can be destroyed while the inner guard is installed
+  // (operator delete walks the whole guard chain).
+  {
+    ScopedStateArena outer_scope(&arena);
+    std::unique_ptr<State> outer_state = game->NewInitialState();
+    SPIEL_CHECK_TRUE(arena.Owns(outer_state.get()));
+    {
+      StateArena inner_arena;
+      ScopedStateArena inner_scope(&inner_arena);
+      std::unique_ptr<State> inner_state = game->NewInitialState();
+      SPIEL_CHECK_TRUE(inner_arena.Owns(inner_state.get()));
+      SPIEL_CHECK_FALSE(arena.Owns(inner_state.get()));
+      outer_state.reset();  // Owned by the outer arena; must be a no-op.
+      inner_state.reset();
+    }
+  }
+  arena.Reset();
+
+  // With no arena installed, allocation falls back to the heap.
+  std::unique_ptr<State> heap_state = game->NewInitialState();
+  SPIEL_CHECK_FALSE(arena.Owns(heap_state.get()));
+}
+
 void PolicySerializationTest() {
   // Check empty tabular policy
   auto policy = std::make_unique<TabularPolicy>();
@@ -344,9 +796,27 @@ int main(int argc, char** argv) {
   open_spiel::testing::KuhnTests();
   open_spiel::testing::GameEqualityTests();
   open_spiel::testing::TicTacToeTests();
+  open_spiel::testing::ParallelSimTests();
   open_spiel::testing::FlatJointactionTest();
   open_spiel::testing::PolicyTest();
   open_spiel::testing::LeducPokerDeserializeTest();
+  open_spiel::testing::PackedSerializationTest();
   open_spiel::testing::GameParametersTest();
+  open_spiel::testing::StateArenaTest();
+  open_spiel::testing::BatchStepTest();
+  open_spiel::testing::InternedTabularPolicyTest();
+  open_spiel::testing::PartialTabularPolicyFilterTest();
+  open_spiel::testing::BinaryTabularPolicyTest();
+  open_spiel::testing::InformationStateKeyTest();
+  open_spiel::testing::BatchedObservationTest();
+  open_spiel::testing::CompiledObservationTest();
+  open_spiel::testing::LoadGameCacheTest();
+  open_spiel::testing::CanonicalGameParametersTest();
+  open_spiel::testing::HotCheckTest();
+  open_spiel::testing::GamePluginTest();
+  open_spiel::testing::FlatParametersTest();
+  open_spiel::testing::LegalActionsRefTest();
+  open_spiel::testing::ChanceOutcomeTableTest();
+  open_spiel::testing::MemoryFootprintTest();
   open_spiel::testing::PolicySerializationTest();
 }
@@ -16,8 +16,13 @@
 #define OPEN_SPIEL_UTILS_CIRCULAR_BUFFER_H_
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iterator>
+#include <memory>
+#include <numeric>
 #include <random>
+#include <utility>
 #include <vector>
 
 namespace open_spiel {
@@ -68,6 +73,105 @@ class CircularBuffer {
   std::vector<T> data_;
 };
 
+// A concurrent circular buffer of fixed size, for many producers and
+// sampling readers without a shared mutex. Add claims a slot with a single
+// atomic increment, so producers never serialize behind each other; each
+// slot carries a version word which orders overwrites across laps and lets a
+// reader claim the slot just long enough to copy it. A sampler therefore
+// only ever delays the one producer overwriting the same slot, never
+// ingestion as a whole. Each sampled element is copied atomically with
+// respect to appends; the sampled set as a whole spans the short window of
+// the Sample call rather than a single instant. T must be default
+// constructible and copyable.
+template <class T>
+class ConcurrentCircularBuffer {
+ public:
+  explicit ConcurrentCircularBuffer(int max_size)
+      : max_size_(max_size), slots_(new Slot[max_size]) {}
+
+  // Add one element, replacing the oldest once it's full.
+  void Add(const T& value) {
+    int64_t index = total_added_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots_[index % max_size_];
+    int64_t ready = 2 * (index / max_size_);
+    // Wait until the previous lap's write to this slot has been published
+    // and no reader holds it, then lock it by making the version odd.
+    int64_t expected = ready;
+    while (!slot.version.compare_exchange_weak(expected, ready + 1,
+                                               std::memory_order_acquire)) {
+      expected = ready;
+    }
+    slot.value = value;
+    slot.version.store(ready + 2, std::memory_order_release);
+  }
+
+  // Return up to `num` elements without replacement. May return fewer while
+  // the buffer is still filling and some chosen slots are not yet published.
+  std::vector<T> Sample(std::mt19937* rng, int num) {
+    std::vector<int64_t> indices(Size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::vector<int64_t> chosen;
+    chosen.reserve(num);
+    std::sample(indices.begin(), indices.end(), std::back_inserter(chosen),
+                num, *rng);
+    std::vector<T> out;
+    out.reserve(chosen.size());
+    for (int64_t index : chosen) {
+      T value;
+      if (CopyAt(index, &value)) {
+        out.push_back(std::move(value));
+      }
+    }
+    return out;
+  }
+
+  // How many elements are in the buffer.
+  int Size() const {
+    return std::min<int64_t>(total_added_.load(std::memory_order_acquire),
+                             max_size_);
+  }
+
+  // Is the buffer empty?
+  bool Empty() const { return Size() == 0; }
+
+  // How many elements have ever been added to the buffer.
+  int64_t TotalAdded() const {
+    return total_added_.load(std::memory_order_acquire);
+  }
+
+ private:
+  struct Slot {
+    std::atomic<int64_t> version{0};  // 2*k: k writes published; odd: held.
+    T value;
+  };
+
+  // Copy the slot at index into *out, claiming the slot for the duration of
+  // the copy so no producer can overwrite it mid-read. Returns false if the
+  // slot has never been published.
+  bool CopyAt(int64_t index, T* out) {
+    Slot& slot = slots_[index];
+    while (true) {
+      int64_t version = slot.version.load(std::memory_order_acquire);
+      if (version == 0) {
+        return false;  // Claimed by a producer, but not yet published.
+      }
+      if (version % 2 == 1) {
+        continue;  // A producer or another reader holds the slot.
+      }
+      if (slot.version.compare_exchange_weak(version, version + 1,
+                                             std::memory_order_acquire)) {
+        *out = slot.value;
+        slot.version.store(version, std::memory_order_release);
+        return true;
+      }
+    }
+  }
+
+  const int64_t max_size_;
+  std::atomic<int64_t> total_added_{0};
+  std::unique_ptr<Slot[]> slots_;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_UTILS_CIRCULAR_BUFFER_H_
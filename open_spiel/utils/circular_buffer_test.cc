@@ -15,8 +15,10 @@
 #include "open_spiel/utils/circular_buffer.h"
 
 #include <random>
+#include <vector>
 
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace {
@@ -65,7 +67,84 @@ void TestCircularBuffer() {
   SPIEL_CHECK_LE(sample[0], 18);
 }
 
+void TestConcurrentCircularBuffer() {
+  ConcurrentCircularBuffer<int> buffer(4);
+  std::mt19937 rng;
+  std::vector<int> sample;
+
+  SPIEL_CHECK_TRUE(buffer.Empty());
+  SPIEL_CHECK_EQ(buffer.Size(), 0);
+
+  buffer.Add(13);
+  SPIEL_CHECK_FALSE(buffer.Empty());
+  SPIEL_CHECK_EQ(buffer.Size(), 1);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 1);
+
+  sample = buffer.Sample(&rng, 1);
+  SPIEL_CHECK_EQ(sample.size(), 1);
+  SPIEL_CHECK_EQ(sample[0], 13);
+
+  buffer.Add(14);
+  buffer.Add(15);
+  buffer.Add(16);
+  buffer.Add(17);
+  buffer.Add(18);
+
+  SPIEL_CHECK_EQ(buffer.Size(), 4);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 6);
+
+  sample = buffer.Sample(&rng, 2);
+  SPIEL_CHECK_EQ(sample.size(), 2);
+  SPIEL_CHECK_GE(sample[0], 15);
+  SPIEL_CHECK_LE(sample[0], 18);
+  SPIEL_CHECK_GE(sample[1], 15);
+  SPIEL_CHECK_LE(sample[1], 18);
+}
+
+void TestConcurrentCircularBufferThreaded() {
+  constexpr int kNumProducers = 4;
+  constexpr int kPerProducer = 10000;
+  ConcurrentCircularBuffer<int> buffer(64);
+  std::atomic<bool> done{false};
+
+  std::vector<Thread> producers;
+  for (int p = 0; p < kNumProducers; ++p) {
+    producers.emplace_back([&buffer, p]() {
+      for (int i = 0; i < kPerProducer; ++i) {
+        buffer.Add(p * kPerProducer + i);
+      }
+    });
+  }
+  // Sample continuously while the producers run; every copied element must
+  // be a value some producer actually wrote.
+  Thread sampler([&buffer, &done]() {
+    std::mt19937 rng;
+    while (!done.load()) {
+      std::vector<int> sample = buffer.Sample(&rng, 16);
+      for (int value : sample) {
+        SPIEL_CHECK_GE(value, 0);
+        SPIEL_CHECK_LT(value, kNumProducers * kPerProducer);
+      }
+    }
+  });
+
+  for (Thread& producer : producers) {
+    producer.join();
+  }
+  done.store(true);
+  sampler.join();
+
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), kNumProducers * kPerProducer);
+  SPIEL_CHECK_EQ(buffer.Size(), 64);
+  std::mt19937 rng;
+  SPIEL_CHECK_EQ(buffer.Sample(&rng, 16).size(), 16);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::TestCircularBuffer(); }
+int main(int argc, char** argv) {
+  open_spiel::TestCircularBuffer();
+  open_spiel::TestConcurrentCircularBuffer();
+  open_spiel::TestConcurrentCircularBufferThreaded();
+}
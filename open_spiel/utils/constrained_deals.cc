@@ -0,0 +1,128 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/constrained_deals.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+
+ConstrainedDealSampler::ConstrainedDealSampler(int num_cards, int num_hands)
+    : num_cards_(num_cards),
+      num_hands_(num_hands),
+      allowed_(num_cards, num_hands == 32 ? ~uint32_t{0}
+                                          : (uint32_t{1} << num_hands) - 1),
+      hand_sizes_(num_hands, 0) {
+  SPIEL_CHECK_GT(num_hands_, 0);
+  SPIEL_CHECK_LE(num_hands_, 32);
+}
+
+void ConstrainedDealSampler::SetHandSize(int hand, int size) {
+  hand_sizes_[hand] = size;
+}
+
+void ConstrainedDealSampler::SetKnownHolder(int card, int hand) {
+  allowed_[card] = uint32_t{1} << hand;
+}
+
+void ConstrainedDealSampler::ForbidHolder(int card, int hand) {
+  allowed_[card] &= ~(uint32_t{1} << hand);
+}
+
+void ConstrainedDealSampler::RemoveCard(int card) { allowed_[card] = 0; }
+
+std::vector<int> ConstrainedDealSampler::Sample(
+    const std::function<double()>& rng) const {
+  std::vector<int> assignment(num_cards_, kNoHand);
+  std::vector<int> capacity = hand_sizes_;
+  std::vector<int> open_cards;
+
+  // Cards with a single allowed hand are forced; everything else is left to
+  // the search.
+  for (int card = 0; card < num_cards_; ++card) {
+    if (allowed_[card] == 0) continue;
+    if ((allowed_[card] & (allowed_[card] - 1)) == 0) {
+      int hand = __builtin_ctz(allowed_[card]);
+      assignment[card] = hand;
+      if (--capacity[hand] < 0) return {};
+    } else {
+      open_cards.push_back(card);
+    }
+  }
+
+  if (!SampleRec(&open_cards, &assignment, &capacity, rng)) return {};
+  return assignment;
+}
+
+bool ConstrainedDealSampler::SampleRec(
+    std::vector<int>* open_cards, std::vector<int>* assignment,
+    std::vector<int>* capacity, const std::function<double()>& rng) const {
+  if (open_cards->empty()) return true;
+
+  // Mask of hands that can still take a card.
+  uint32_t open_hands = 0;
+  for (int hand = 0; hand < num_hands_; ++hand) {
+    if ((*capacity)[hand] > 0) open_hands |= uint32_t{1} << hand;
+  }
+
+  // Assign the most constrained card first; this keeps backtracking rare.
+  int best_index = -1;
+  int best_choices = num_hands_ + 1;
+  for (int i = 0; i < open_cards->size(); ++i) {
+    int choices = __builtin_popcount(allowed_[(*open_cards)[i]] & open_hands);
+    if (choices < best_choices) {
+      best_choices = choices;
+      best_index = i;
+    }
+  }
+  if (best_choices == 0) return false;  // Dead end.
+
+  const int card = (*open_cards)[best_index];
+  std::swap((*open_cards)[best_index], open_cards->back());
+  open_cards->pop_back();
+
+  // Try the feasible hands in an order drawn with probability proportional
+  // to their remaining capacity, backtracking into the next one on failure.
+  uint32_t feasible = allowed_[card] & open_hands;
+  while (feasible != 0) {
+    int total_capacity = 0;
+    for (uint32_t m = feasible; m != 0; m &= m - 1) {
+      total_capacity += (*capacity)[__builtin_ctz(m)];
+    }
+    int target = static_cast<int>(rng() * total_capacity);
+    target = std::min(target, total_capacity - 1);
+    int hand = -1;
+    for (uint32_t m = feasible; m != 0; m &= m - 1) {
+      hand = __builtin_ctz(m);
+      target -= (*capacity)[hand];
+      if (target < 0) break;
+    }
+
+    (*assignment)[card] = hand;
+    --(*capacity)[hand];
+    if (SampleRec(open_cards, assignment, capacity, rng)) return true;
+    ++(*capacity)[hand];
+    (*assignment)[card] = kNoHand;
+    feasible &= ~(uint32_t{1} << hand);
+  }
+
+  open_cards->push_back(card);
+  std::swap((*open_cards)[best_index], open_cards->back());
+  return false;
+}
+
+}  // namespace open_spiel
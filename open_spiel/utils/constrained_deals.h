@@ -0,0 +1,79 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_CONSTRAINED_DEALS_H_
+#define OPEN_SPIEL_UTILS_CONSTRAINED_DEALS_H_
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace open_spiel {
+
+// Samples deals of cards to hands subject to a constraint table of who can
+// hold what. This is the common engine behind ResampleFromInfostate in
+// trick-taking card games: an observer typically knows their own hand, the
+// cards already played, and suits in which opponents have shown to be void,
+// and determinized search (e.g. bots/pimc_bot.cc) needs many deals per move
+// that are consistent with all of it. Rejection-sampling complete deals
+// against such constraints degrades badly as the game progresses; this
+// sampler instead assigns cards directly, most-constrained card first, and
+// backtracks on the rare dead end, so no complete deal is ever thrown away.
+//
+// Cards and hands are dense indices chosen by the caller. Supports up to 32
+// hands. Sampling does not mutate the table, so one configured sampler can
+// serve many deals.
+class ConstrainedDealSampler {
+ public:
+  // All cards initially may be held by every hand; all hand sizes are 0.
+  ConstrainedDealSampler(int num_cards, int num_hands);
+
+  // Number of cards the hand must end up with.
+  void SetHandSize(int hand, int size);
+
+  // Constrains the card to exactly this hand (a known location).
+  void SetKnownHolder(int card, int hand);
+
+  // Excludes the hand as a holder of the card (e.g. shown void in a suit).
+  void ForbidHolder(int card, int hand);
+
+  // Excludes the card from the deal entirely (already public, e.g. played
+  // to a trick or turned up as trump).
+  void RemoveCard(int card);
+
+  // Samples an assignment of hands to cards consistent with the table,
+  // using rng() in [0, 1). Returns the holding hand per card (kNoHand for
+  // removed cards), or an empty vector if the table is unsatisfiable. At
+  // every step the next card is drawn for a feasible hand with probability
+  // proportional to the hand's remaining capacity, which reproduces the
+  // uniform deal distribution whenever the constraints do not force
+  // backtracking.
+  std::vector<int> Sample(const std::function<double()>& rng) const;
+
+  static constexpr int kNoHand = -1;
+
+ private:
+  bool SampleRec(std::vector<int>* open_cards, std::vector<int>* assignment,
+                 std::vector<int>* capacity,
+                 const std::function<double()>& rng) const;
+
+  const int num_cards_;
+  const int num_hands_;
+  std::vector<uint32_t> allowed_;  // Bitmask of allowed hands per card.
+  std::vector<int> hand_sizes_;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_CONSTRAINED_DEALS_H_
@@ -0,0 +1,111 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/constrained_deals.h"
+
+#include <random>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+std::function<double()> MakeRng(int seed) {
+  auto rng = std::make_shared<std::mt19937>(seed);
+  return [rng]() {
+    return std::uniform_real_distribution<double>(0.0, 1.0)(*rng);
+  };
+}
+
+void TestUnconstrainedDeal() {
+  ConstrainedDealSampler sampler(/*num_cards=*/52, /*num_hands=*/4);
+  for (int hand = 0; hand < 4; ++hand) sampler.SetHandSize(hand, 13);
+  std::function<double()> rng = MakeRng(17);
+
+  std::vector<int> deal = sampler.Sample(rng);
+  SPIEL_CHECK_EQ(deal.size(), 52);
+  std::vector<int> counts(4, 0);
+  for (int hand : deal) {
+    SPIEL_CHECK_GE(hand, 0);
+    SPIEL_CHECK_LT(hand, 4);
+    ++counts[hand];
+  }
+  for (int hand = 0; hand < 4; ++hand) SPIEL_CHECK_EQ(counts[hand], 13);
+}
+
+void TestConstraintsAreRespected() {
+  std::function<double()> rng = MakeRng(42);
+  for (int trial = 0; trial < 100; ++trial) {
+    ConstrainedDealSampler sampler(/*num_cards=*/12, /*num_hands=*/3);
+    for (int hand = 0; hand < 3; ++hand) sampler.SetHandSize(hand, 3);
+    // Three cards are public, one location is known, and hand 2 has shown a
+    // void holding cards 4 through 7.
+    sampler.RemoveCard(0);
+    sampler.RemoveCard(1);
+    sampler.RemoveCard(2);
+    sampler.SetKnownHolder(3, 1);
+    for (int card = 4; card < 8; ++card) sampler.ForbidHolder(card, 2);
+
+    std::vector<int> deal = sampler.Sample(rng);
+    SPIEL_CHECK_EQ(deal.size(), 12);
+    for (int card = 0; card < 3; ++card) {
+      SPIEL_CHECK_EQ(deal[card], ConstrainedDealSampler::kNoHand);
+    }
+    SPIEL_CHECK_EQ(deal[3], 1);
+    std::vector<int> counts(3, 0);
+    for (int card = 3; card < 12; ++card) ++counts[deal[card]];
+    for (int hand = 0; hand < 3; ++hand) SPIEL_CHECK_EQ(counts[hand], 3);
+    for (int card = 4; card < 8; ++card) SPIEL_CHECK_NE(deal[card], 2);
+  }
+}
+
+void TestForcedCards() {
+  // Cards 0-2 may only go to hand 0, which exactly fills it, so the deal is
+  // fully determined: the unconstrained card 3 must fall to hand 1.
+  ConstrainedDealSampler sampler(/*num_cards=*/4, /*num_hands=*/2);
+  sampler.SetHandSize(0, 3);
+  sampler.SetHandSize(1, 1);
+  for (int card = 0; card < 3; ++card) sampler.ForbidHolder(card, 1);
+  std::function<double()> rng = MakeRng(7);
+
+  for (int trial = 0; trial < 100; ++trial) {
+    std::vector<int> deal = sampler.Sample(rng);
+    SPIEL_CHECK_EQ(deal.size(), 4);
+    SPIEL_CHECK_EQ(deal[0], 0);
+    SPIEL_CHECK_EQ(deal[1], 0);
+    SPIEL_CHECK_EQ(deal[2], 0);
+    SPIEL_CHECK_EQ(deal[3], 1);
+  }
+}
+
+void TestUnsatisfiable() {
+  // Three cards forced into a hand of size two.
+  ConstrainedDealSampler sampler(/*num_cards=*/3, /*num_hands=*/2);
+  sampler.SetHandSize(0, 2);
+  sampler.SetHandSize(1, 1);
+  for (int card = 0; card < 3; ++card) sampler.ForbidHolder(card, 1);
+  std::function<double()> rng = MakeRng(11);
+  SPIEL_CHECK_TRUE(sampler.Sample(rng).empty());
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestUnconstrainedDeal();
+  open_spiel::TestConstraintsAreRespected();
+  open_spiel::TestForcedCards();
+  open_spiel::TestUnsatisfiable();
+}
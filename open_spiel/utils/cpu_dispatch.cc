@@ -0,0 +1,103 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/cpu_dispatch.h"
+
+#include <cstdlib>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+CpuFeatureLevel DetectHardwareLevel() {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+    return CpuFeatureLevel::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return CpuFeatureLevel::kAvx2;
+  }
+  return CpuFeatureLevel::kScalar;
+#elif defined(__aarch64__)
+  // NEON is part of the arm64 baseline.
+  return CpuFeatureLevel::kNeon;
+#else
+  return CpuFeatureLevel::kScalar;
+#endif
+}
+
+CpuFeatureLevel ParseLevelName(const std::string& name) {
+  if (name == "scalar") return CpuFeatureLevel::kScalar;
+  if (name == "avx2") return CpuFeatureLevel::kAvx2;
+  if (name == "avx512") return CpuFeatureLevel::kAvx512;
+  if (name == "neon") return CpuFeatureLevel::kNeon;
+  SpielFatalError(absl::StrCat("Unknown OPEN_SPIEL_CPU_FEATURES level: '",
+                               name, "'"));
+}
+
+// Lower than the hardware level wins, so the variable can only disable
+// variants the machine could run, never enable ones it can't.
+CpuFeatureLevel CapLevel(CpuFeatureLevel hardware, CpuFeatureLevel cap) {
+  // The x86 levels are ordered among themselves; kNeon only relates to
+  // kScalar.
+  if (cap == CpuFeatureLevel::kScalar || hardware == CpuFeatureLevel::kScalar) {
+    return CpuFeatureLevel::kScalar;
+  }
+  if (hardware == CpuFeatureLevel::kNeon || cap == CpuFeatureLevel::kNeon) {
+    return hardware == cap ? hardware : CpuFeatureLevel::kScalar;
+  }
+  return static_cast<int>(cap) < static_cast<int>(hardware) ? cap : hardware;
+}
+
+}  // namespace
+
+CpuFeatureLevel DetectCpuFeatureLevel() {
+  static const CpuFeatureLevel level = []() {
+    CpuFeatureLevel hardware = DetectHardwareLevel();
+    const char* env = std::getenv("OPEN_SPIEL_CPU_FEATURES");
+    if (env == nullptr) return hardware;
+    return CapLevel(hardware, ParseLevelName(env));
+  }();
+  return level;
+}
+
+std::string CpuFeatureLevelName(CpuFeatureLevel level) {
+  switch (level) {
+    case CpuFeatureLevel::kScalar:
+      return "scalar";
+    case CpuFeatureLevel::kAvx2:
+      return "avx2";
+    case CpuFeatureLevel::kAvx512:
+      return "avx512";
+    case CpuFeatureLevel::kNeon:
+      return "neon";
+  }
+  SpielFatalError("Unknown CpuFeatureLevel.");
+}
+
+double TimeKernelNs(const std::function<void()>& fn, int iterations) {
+  SPIEL_CHECK_GT(iterations, 0);
+  absl::Time start = absl::Now();
+  for (int i = 0; i < iterations; ++i) {
+    fn();
+  }
+  return absl::ToDoubleNanoseconds(absl::Now() - start) / iterations;
+}
+
+}  // namespace open_spiel
@@ -0,0 +1,93 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_CPU_DISPATCH_H_
+#define OPEN_SPIEL_UTILS_CPU_DISPATCH_H_
+
+#include <functional>
+#include <string>
+
+namespace open_spiel {
+
+// Runtime selection between scalar and SIMD variants of a hot kernel, so one
+// binary runs well across heterogeneous machines (e.g. AVX2 and AVX-512
+// x86-64 hosts and NEON arm64 hosts) without per-target builds.
+//
+// Usage: compile each variant in a translation unit built with the matching
+// target options, fill a KernelVariants with the function pointers (leaving
+// unavailable ones null), and call SelectKernel once, typically into a
+// static:
+//
+//   static const auto* kernel = SelectKernel<void (*)(const float*, float*,
+//                                                     int)>(
+//       {ScalarUnpack, Avx2Unpack, /*avx512=*/nullptr, NeonUnpack});
+//
+// The environment variable OPEN_SPIEL_CPU_FEATURES caps the detected level
+// ("scalar", "avx2", "avx512" or "neon"), for benchmarking variants against
+// each other and for sidestepping a miscompiled variant in the field.
+
+// Feature levels are cumulative per architecture: a machine at a given x86
+// level supports all lower x86 levels. kNeon is the arm64 baseline.
+enum class CpuFeatureLevel {
+  kScalar = 0,
+  kAvx2 = 1,
+  kAvx512 = 2,
+  kNeon = 3,
+};
+
+// The level of the machine we are running on, detected once at first call
+// (and capped by OPEN_SPIEL_CPU_FEATURES if set).
+CpuFeatureLevel DetectCpuFeatureLevel();
+
+// "scalar", "avx2", "avx512" or "neon".
+std::string CpuFeatureLevelName(CpuFeatureLevel level);
+
+// The variants of one kernel. Only scalar is mandatory.
+template <typename Fn>
+struct KernelVariants {
+  Fn scalar;
+  Fn avx2 = nullptr;
+  Fn avx512 = nullptr;
+  Fn neon = nullptr;
+};
+
+// Returns the best variant available at `level`: on x86 the highest non-null
+// variant at or below the level, on arm64 the NEON variant; the scalar
+// variant whenever nothing better exists. Call once and cache the result;
+// the selection itself is cheap but not free.
+template <typename Fn>
+Fn SelectKernel(const KernelVariants<Fn>& variants,
+                CpuFeatureLevel level = DetectCpuFeatureLevel()) {
+  if (level == CpuFeatureLevel::kAvx512 && variants.avx512 != nullptr) {
+    return variants.avx512;
+  }
+  // An AVX-512 machine runs the AVX2 variant when no AVX-512 one exists.
+  if ((level == CpuFeatureLevel::kAvx512 || level == CpuFeatureLevel::kAvx2) &&
+      variants.avx2 != nullptr) {
+    return variants.avx2;
+  }
+  if (level == CpuFeatureLevel::kNeon && variants.neon != nullptr) {
+    return variants.neon;
+  }
+  return variants.scalar;
+}
+
+// Times `fn` over `iterations` calls and returns the mean nanoseconds per
+// call, for benchmarking kernel variants against each other (run each
+// variant through this and keep the winner, or just log the numbers).
+double TimeKernelNs(const std::function<void()>& fn, int iterations);
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_CPU_DISPATCH_H_
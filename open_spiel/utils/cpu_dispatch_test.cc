@@ -0,0 +1,75 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/cpu_dispatch.h"
+
+#include <string>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+using KernelFn = int (*)();
+
+int Scalar() { return 0; }
+int Avx2() { return 1; }
+int Avx512() { return 2; }
+int Neon() { return 3; }
+
+void TestDetectionRunsAndHasName() {
+  CpuFeatureLevel level = DetectCpuFeatureLevel();
+  std::string name = CpuFeatureLevelName(level);
+  SPIEL_CHECK_FALSE(name.empty());
+  // Detection is cached: the same level every time.
+  SPIEL_CHECK_TRUE(DetectCpuFeatureLevel() == level);
+}
+
+void TestSelectionPerLevel() {
+  KernelVariants<KernelFn> all = {Scalar, Avx2, Avx512, Neon};
+  SPIEL_CHECK_EQ(SelectKernel(all, CpuFeatureLevel::kScalar)(), 0);
+  SPIEL_CHECK_EQ(SelectKernel(all, CpuFeatureLevel::kAvx2)(), 1);
+  SPIEL_CHECK_EQ(SelectKernel(all, CpuFeatureLevel::kAvx512)(), 2);
+  SPIEL_CHECK_EQ(SelectKernel(all, CpuFeatureLevel::kNeon)(), 3);
+}
+
+void TestFallbacks() {
+  // An AVX-512 machine uses the AVX2 variant when that is all there is.
+  KernelVariants<KernelFn> avx2_only = {Scalar, Avx2};
+  SPIEL_CHECK_EQ(SelectKernel(avx2_only, CpuFeatureLevel::kAvx512)(), 1);
+  // Everything falls back to scalar.
+  KernelVariants<KernelFn> scalar_only = {Scalar};
+  SPIEL_CHECK_EQ(SelectKernel(scalar_only, CpuFeatureLevel::kAvx512)(), 0);
+  SPIEL_CHECK_EQ(SelectKernel(scalar_only, CpuFeatureLevel::kNeon)(), 0);
+  // x86 variants are never selected on arm and vice versa.
+  KernelVariants<KernelFn> no_neon = {Scalar, Avx2, Avx512};
+  SPIEL_CHECK_EQ(SelectKernel(no_neon, CpuFeatureLevel::kNeon)(), 0);
+}
+
+void TestTimeKernel() {
+  int calls = 0;
+  double ns = TimeKernelNs([&calls]() { ++calls; }, 100);
+  SPIEL_CHECK_EQ(calls, 100);
+  SPIEL_CHECK_GE(ns, 0);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestDetectionRunsAndHasName();
+  open_spiel::TestSelectionPerLevel();
+  open_spiel::TestFallbacks();
+  open_spiel::TestTimeKernel();
+}
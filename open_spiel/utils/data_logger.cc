@@ -14,6 +14,9 @@
 
 #include "open_spiel/utils/data_logger.h"
 
+#include <memory>
+#include <utility>
+
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/abseil-cpp/absl/time/clock.h"
@@ -50,4 +53,45 @@ void DataLoggerJsonLines::Flush() { fd_.Flush(); }
 
 DataLoggerJsonLines::~DataLoggerJsonLines() { Flush(); }
 
+DataLoggerAsync::DataLoggerAsync(std::unique_ptr<DataLogger> logger,
+                                 int max_queue_size)
+    : queue_(max_queue_size),
+      logger_(std::move(logger)),
+      thread_([this]() { Run(); }) {}
+
+void DataLoggerAsync::Write(DataLogger::Record record) {
+  // Try without a deadline first, so the common case is a single enqueue and
+  // blocked writes are counted.
+  if (!queue_.Push(record, absl::ZeroDuration())) {
+    blocked_writes_.fetch_add(1, std::memory_order_relaxed);
+    queue_.Push(record);
+  }
+}
+
+void DataLoggerAsync::Flush() { queue_.Push(absl::nullopt); }
+
+void DataLoggerAsync::Run() {
+  while (true) {
+    // Block for the next item, then drain whatever else is already queued
+    // before flushing once for the whole batch.
+    absl::optional<absl::optional<Record>> item = queue_.Pop();
+    if (!item.has_value()) {
+      break;  // The queue is closed and drained.
+    }
+    while (item.has_value()) {
+      if (item->has_value()) {
+        logger_->Write(std::move(**item));
+      }
+      item = queue_.Pop(absl::ZeroDuration());
+    }
+    logger_->Flush();
+  }
+}
+
+DataLoggerAsync::~DataLoggerAsync() {
+  queue_.BlockNewValues();
+  thread_.join();
+  logger_->Flush();
+}
+
 }  // namespace open_spiel
@@ -15,13 +15,19 @@
 #ifndef OPEN_SPIEL_UTILS_DATA_LOGGER_H_
 #define OPEN_SPIEL_UTILS_DATA_LOGGER_H_
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/utils/file.h"
 #include "open_spiel/utils/json.h"
+#include "open_spiel/utils/thread.h"
+#include "open_spiel/utils/threaded_queue.h"
 
 namespace open_spiel {
 
@@ -58,6 +64,43 @@ class DataLoggerJsonLines : public DataLogger {
   absl::Time start_time_;
 };
 
+// Moves another logger's writes onto a background thread, so the caller
+// never blocks on disk unless the bounded queue fills up. The wrapped logger
+// is only touched from the background thread, which flushes once per drained
+// batch rather than per record, so wrap it with flush=false. A crash loses at
+// most the queued records. Note that any timestamps the wrapped logger adds
+// are taken when the record is written, not when it was queued.
+class DataLoggerAsync : public DataLogger {
+ public:
+  explicit DataLoggerAsync(std::unique_ptr<DataLogger> logger,
+                           int max_queue_size = 1024);
+  ~DataLoggerAsync() override;  // Drains the queue.
+
+  // Not movable: the background thread holds a pointer to this.
+  DataLoggerAsync(const DataLoggerAsync&) = delete;
+  DataLoggerAsync& operator=(const DataLoggerAsync&) = delete;
+
+  void Write(Record record) override;
+
+  // Asynchronous: requests a flush after the records queued so far.
+  void Flush() override;
+
+  // How often Write found the queue full and had to wait for the writer
+  // thread; if this grows, the actors are outrunning the disk.
+  int64_t BlockedWrites() const {
+    return blocked_writes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  void Run();
+
+  // A queued flush request is represented as nullopt.
+  ThreadedQueue<absl::optional<Record>> queue_;
+  std::unique_ptr<DataLogger> logger_;
+  std::atomic<int64_t> blocked_writes_{0};
+  Thread thread_;
+};
+
 class DataLoggerNoop : public DataLogger {
  public:
   ~DataLoggerNoop() override = default;
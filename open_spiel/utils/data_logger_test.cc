@@ -15,6 +15,7 @@
 #include "open_spiel/utils/data_logger.h"
 
 #include <cstdlib>
+#include <memory>
 #include <string>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
@@ -71,9 +72,46 @@ void TestDataLogger() {
   SPIEL_CHECK_TRUE(file::Remove(dir));
 }
 
+void TestDataLoggerAsync() {
+  std::string val = std::to_string(std::rand());  // NOLINT
+  std::string tmp_dir = file::GetTmpDir();
+  std::string dir = tmp_dir + "/open_spiel-test-" + val;
+  std::string filename = dir + "/async-test.jsonl";
+
+  SPIEL_CHECK_TRUE(file::Mkdir(dir));
+
+  constexpr int kNumRecords = 100;
+  {
+    DataLoggerAsync logger(
+        std::make_unique<DataLoggerJsonLines>(dir, "async-test"),
+        /*max_queue_size=*/4);
+    for (int i = 0; i < kNumRecords; ++i) {
+      logger.Write({{"step", i}});
+    }
+    logger.Flush();
+    SPIEL_CHECK_GE(logger.BlockedWrites(), 0);
+  }  // The destructor drains the queue.
+
+  {
+    file::File f(filename, "r");
+    std::vector<std::string> lines = absl::StrSplit(f.ReadContents(), '\n');
+    SPIEL_CHECK_EQ(lines.size(), kNumRecords + 1);
+    SPIEL_CHECK_EQ(lines[kNumRecords], "");
+    for (int i = 0; i < kNumRecords; ++i) {
+      json::Object obj = json::FromString(lines[i])->GetObject();
+      SPIEL_CHECK_EQ(obj["step"], i);
+      SPIEL_CHECK_TRUE(obj["time_str"].IsString());
+    }
+  }
+
+  SPIEL_CHECK_TRUE(file::Remove(filename));
+  SPIEL_CHECK_TRUE(file::Remove(dir));
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::TestDataLogger();
+  open_spiel::TestDataLoggerAsync();
 }
@@ -0,0 +1,361 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_DISK_BACKED_TABLE_H_
+#define OPEN_SPIEL_UTILS_DISK_BACKED_TABLE_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+
+// A string-keyed table whose bulk lives in memory-mapped shard files on disk,
+// with only a bounded hot set of deserialized values in memory. This is for
+// solver tables (e.g. MCCFR's info-state values) that outgrow RAM: lookups of
+// hot keys cost a hash-map probe as before, cold keys fault in their slot's
+// pages, and the run degrades to IO-bound instead of dying on OOM.
+//
+// Values are kept deserialized in a per-shard LRU hot set and marked dirty
+// when accessed mutably; dirty values are serialized into their mmap'd slot
+// when evicted or on Flush, and the OS page cache writes the mapping behind
+// the run. On-disk slots are fixed size and located by open-addressed linear
+// probing of the key hash, so the capacity is fixed at construction; filling
+// the table beyond it is fatal.
+//
+// The table is single-threaded, and like absl::flat_hash_map, references
+// returned by GetOrCreate/Find are invalidated by any later table operation
+// (the entry may be evicted). Serialization of V is supplied by the caller,
+// e.g. wrapping CFRInfoStateValues::Serialize.
+template <class V>
+class DiskBackedTable {
+ public:
+  using Serializer = std::function<std::string(const V&)>;
+  using Deserializer = std::function<V(absl::string_view)>;
+
+  struct Options {
+    int64_t max_entries;      // Disk capacity, across all shards.
+    int64_t max_entry_bytes;  // Serialized key + value budget per slot.
+    int64_t hot_capacity;     // Deserialized entries kept in memory.
+    int num_shards = 16;
+  };
+
+  // Opens (or creates) the shard files `path`_shard_<i>. Reopening existing
+  // shards with the same options recovers the stored entries.
+  DiskBackedTable(const std::string& path, const Options& options,
+                  Serializer serialize, Deserializer deserialize)
+      : options_(options),
+        serialize_(std::move(serialize)),
+        deserialize_(std::move(deserialize)) {
+    SPIEL_CHECK_GT(options_.max_entries, 0);
+    SPIEL_CHECK_GT(options_.max_entry_bytes, 0);
+    SPIEL_CHECK_GT(options_.hot_capacity, 0);
+    SPIEL_CHECK_GT(options_.num_shards, 0);
+    const int64_t slots_per_shard =
+        (options_.max_entries + options_.num_shards - 1) /
+        options_.num_shards;
+    hot_per_shard_ = (options_.hot_capacity + options_.num_shards - 1) /
+                     options_.num_shards;
+    shards_.reserve(options_.num_shards);
+    for (int i = 0; i < options_.num_shards; ++i) {
+      shards_.push_back(std::make_unique<Shard>(
+          absl::StrFormat("%s_shard_%d", path, i), slots_per_shard,
+          options_.max_entry_bytes));
+    }
+  }
+
+  ~DiskBackedTable() { Flush(); }
+
+  // The mappings are owned exclusively.
+  DiskBackedTable(const DiskBackedTable&) = delete;
+  DiskBackedTable& operator=(const DiskBackedTable&) = delete;
+
+  // Returns the value for the key, default-constructing it on first use (as
+  // operator[] of a map would).
+  V& GetOrCreate(const std::string& key) {
+    Shard& shard = ShardFor(key);
+    HotEntry* hot = Promote(shard, key, /*create_if_absent=*/true);
+    hot->dirty = true;  // The caller may mutate through the reference.
+    return hot->value;
+  }
+
+  // Returns the value for the key, or nullptr if the key was never stored.
+  // The value is writable; it is marked dirty like GetOrCreate's.
+  V* Find(const std::string& key) {
+    Shard& shard = ShardFor(key);
+    HotEntry* hot = Promote(shard, key, /*create_if_absent=*/false);
+    if (hot == nullptr) return nullptr;
+    hot->dirty = true;
+    return &hot->value;
+  }
+
+  bool Contains(const std::string& key) {
+    Shard& shard = ShardFor(key);
+    return shard.hot.contains(key) ||
+           shard.FindSlot(key, /*for_insert=*/false) >= 0;
+  }
+
+  // Number of distinct keys stored (hot or on disk).
+  int64_t Size() const {
+    int64_t size = 0;
+    for (const std::unique_ptr<Shard>& shard : shards_) {
+      size += shard->num_entries;
+    }
+    return size;
+  }
+
+  // Calls fn once per stored entry, in unspecified order. Mutations through
+  // the reference are retained. Cold entries are streamed through without
+  // being promoted, so a full sweep (e.g. regret matching across the whole
+  // table) does not thrash the hot set.
+  void ForEach(const std::function<void(const std::string&, V&)>& fn) {
+    for (std::unique_ptr<Shard>& shard : shards_) {
+      for (auto& [key, hot] : shard->hot) {
+        fn(key, hot.value);
+        hot.dirty = true;
+      }
+      for (int64_t slot = 0; slot < shard->num_slots; ++slot) {
+        std::string key = shard->KeyAt(slot);
+        if (key.empty() || shard->hot.contains(key)) continue;
+        V value = deserialize_(shard->ValueAt(slot));
+        fn(key, value);
+        shard->WriteSlot(slot, key, serialize_(value));
+      }
+    }
+  }
+
+  // Serializes every dirty hot entry into its slot and syncs the mappings.
+  // Called from the destructor; call it explicitly to checkpoint mid-run.
+  void Flush() {
+    for (std::unique_ptr<Shard>& shard : shards_) {
+      for (auto& [key, hot] : shard->hot) {
+        WriteBack(*shard, key, hot);
+      }
+      shard->Sync();
+    }
+  }
+
+ private:
+  struct SlotHeader {
+    uint64_t hash;       // Key hash; 0 marks an empty slot.
+    uint32_t key_size;
+    uint32_t value_size;
+  };
+
+  struct HotEntry {
+    V value;
+    bool dirty = false;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  // One mmap'd open-addressed hash file plus its hot set.
+  struct Shard {
+    // The slot size is rounded up to the header alignment: the file mapping
+    // is page-aligned, so this keeps HeaderAt's cast aligned for the uint64_t
+    // hash in every slot, not just the first (a max_entry_bytes that is not a
+    // multiple of 8 would otherwise make every later header access
+    // misaligned -- UB, and a fault on strict-alignment targets).
+    Shard(const std::string& filename, int64_t slots, int64_t entry_bytes)
+        : num_slots(slots),
+          slot_size(RoundUpToAlignment(
+              static_cast<int64_t>(sizeof(SlotHeader)) + entry_bytes)) {
+      fd = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+      if (fd < 0) {
+        SpielFatalError(absl::StrFormat("Failed to open %s", filename));
+      }
+      file_size = num_slots * slot_size;
+      if (ftruncate(fd, file_size) != 0) {
+        SpielFatalError(absl::StrFormat("Failed to size %s to %d bytes",
+                                        filename, file_size));
+      }
+      data = static_cast<char*>(mmap(nullptr, file_size,
+                                     PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                                     0));
+      if (data == MAP_FAILED) {
+        SpielFatalError(absl::StrFormat("Failed to mmap %s", filename));
+      }
+      // A new file is zero-filled, i.e. all slots empty. For an existing
+      // file, count the occupied slots.
+      for (int64_t slot = 0; slot < num_slots; ++slot) {
+        if (HeaderAt(slot)->hash != 0) ++num_entries;
+      }
+    }
+
+    ~Shard() {
+      if (data != nullptr) munmap(data, file_size);
+      if (fd >= 0) close(fd);
+    }
+
+    SlotHeader* HeaderAt(int64_t slot) const {
+      return reinterpret_cast<SlotHeader*>(data + slot * slot_size);
+    }
+    char* PayloadAt(int64_t slot) const {
+      return data + slot * slot_size + sizeof(SlotHeader);
+    }
+    std::string KeyAt(int64_t slot) const {
+      const SlotHeader* header = HeaderAt(slot);
+      if (header->hash == 0) return "";
+      return std::string(PayloadAt(slot), header->key_size);
+    }
+    absl::string_view ValueAt(int64_t slot) const {
+      const SlotHeader* header = HeaderAt(slot);
+      return absl::string_view(PayloadAt(slot) + header->key_size,
+                               header->value_size);
+    }
+
+    // Linear probing from the key's hash. Returns the slot holding the key,
+    // or (when for_insert) the empty slot where it belongs, or -1.
+    int64_t FindSlot(const std::string& key, bool for_insert) const {
+      const uint64_t hash = KeyHash(key);
+      const int64_t start = ProbeStart(hash);
+      for (int64_t probe = 0; probe < num_slots; ++probe) {
+        const int64_t slot = (start + probe) % num_slots;
+        const SlotHeader* header = HeaderAt(slot);
+        if (header->hash == 0) {
+          return for_insert ? slot : -1;
+        }
+        if (header->hash == hash && KeyAt(slot) == key) {
+          return slot;
+        }
+      }
+      if (for_insert) {
+        SpielFatalError("DiskBackedTable is full; raise max_entries.");
+      }
+      return -1;
+    }
+
+    void WriteSlot(int64_t slot, const std::string& key,
+                   const std::string& value) {
+      if (static_cast<int64_t>(key.size() + value.size()) >
+          slot_size - static_cast<int64_t>(sizeof(SlotHeader))) {
+        SpielFatalError(absl::StrFormat(
+            "Entry of %d bytes exceeds the max entry size of %d.",
+            key.size() + value.size(),
+            slot_size - static_cast<int64_t>(sizeof(SlotHeader))));
+      }
+      SlotHeader* header = HeaderAt(slot);
+      char* payload = PayloadAt(slot);
+      std::memcpy(payload, key.data(), key.size());
+      std::memcpy(payload + key.size(), value.data(), value.size());
+      header->key_size = key.size();
+      header->value_size = value.size();
+      header->hash = KeyHash(key);
+    }
+
+    void Sync() { msync(data, file_size, MS_ASYNC); }
+
+    static uint64_t KeyHash(const std::string& key) {
+      // Reserve 0 for empty slots.
+      uint64_t hash = absl::Hash<std::string>{}(key);
+      return hash == 0 ? 1 : hash;
+    }
+
+    static int64_t RoundUpToAlignment(int64_t size) {
+      const int64_t alignment = alignof(SlotHeader);
+      return (size + alignment - 1) / alignment * alignment;
+    }
+
+    // Probe start within the shard. ShardFor already consumed the raw hash
+    // modulo num_shards, so every key in this shard agrees with it there;
+    // taking the raw hash modulo num_slots again would cluster all probe
+    // starts on 1/num_shards of the slots whenever num_slots and num_shards
+    // share factors (e.g. both powers of two). Remix the bits first (the
+    // murmur3 finalizer) so in-shard probe starts spread over all slots.
+    int64_t ProbeStart(uint64_t hash) const {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      return static_cast<int64_t>(hash % static_cast<uint64_t>(num_slots));
+    }
+
+    const int64_t num_slots;
+    const int64_t slot_size;
+    int fd = -1;
+    int64_t file_size = 0;
+    char* data = nullptr;
+    int64_t num_entries = 0;
+
+    absl::flat_hash_map<std::string, HotEntry> hot;
+    std::list<std::string> lru;  // Front is most recently used.
+  };
+
+  Shard& ShardFor(const std::string& key) {
+    return *shards_[absl::Hash<std::string>{}(key) % shards_.size()];
+  }
+
+  void WriteBack(Shard& shard, const std::string& key, HotEntry& hot) {
+    if (!hot.dirty) return;
+    shard.WriteSlot(shard.FindSlot(key, /*for_insert=*/true), key,
+                    serialize_(hot.value));
+    hot.dirty = false;
+  }
+
+  // Returns the hot entry for the key, loading it from disk (or creating it)
+  // if needed, and evicting the least recently used entry when over budget.
+  HotEntry* Promote(Shard& shard, const std::string& key,
+                    bool create_if_absent) {
+    SPIEL_CHECK_FALSE(key.empty());  // The empty key marks empty slots.
+    auto it = shard.hot.find(key);
+    if (it != shard.hot.end()) {
+      shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru_it);
+      return &it->second;
+    }
+
+    const int64_t slot = shard.FindSlot(key, /*for_insert=*/false);
+    if (slot < 0 && !create_if_absent) return nullptr;
+
+    if (static_cast<int64_t>(shard.hot.size()) >= hot_per_shard_) {
+      const std::string& victim_key = shard.lru.back();
+      auto victim = shard.hot.find(victim_key);
+      WriteBack(shard, victim_key, victim->second);
+      shard.hot.erase(victim);
+      shard.lru.pop_back();
+    }
+
+    shard.lru.push_front(key);
+    HotEntry& hot = shard.hot[key];
+    hot.lru_it = shard.lru.begin();
+    if (slot >= 0) {
+      hot.value = deserialize_(shard.ValueAt(slot));
+    } else {
+      ++shard.num_entries;  // A new key; the value starts default-constructed.
+    }
+    return &hot;
+  }
+
+  const Options options_;
+  const Serializer serialize_;
+  const Deserializer deserialize_;
+  int64_t hot_per_shard_ = 0;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_DISK_BACKED_TABLE_H_
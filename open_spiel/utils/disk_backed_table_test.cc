@@ -0,0 +1,163 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/disk_backed_table.h"
+
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_join.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace {
+
+const char* kTablePath = "disk_backed_table_data";
+
+using Values = std::vector<double>;
+
+DiskBackedTable<Values>::Options DefaultOptions() {
+  DiskBackedTable<Values>::Options options;
+  options.max_entries = 1000;
+  options.max_entry_bytes = 256;
+  // Far smaller than the number of keys used below, so the test exercises
+  // eviction and reloading, not just the hot map.
+  options.hot_capacity = 32;
+  options.num_shards = 4;
+  return options;
+}
+
+DiskBackedTable<Values> MakeTable(
+    DiskBackedTable<Values>::Options options = DefaultOptions()) {
+  return DiskBackedTable<Values>(
+      kTablePath, options,
+      [](const Values& values) { return absl::StrJoin(values, ","); },
+      [](absl::string_view serialized) {
+        Values values;
+        if (serialized.empty()) return values;
+        for (absl::string_view part : absl::StrSplit(serialized, ',')) {
+          double value;
+          SPIEL_CHECK_TRUE(absl::SimpleAtod(part, &value));
+          values.push_back(value);
+        }
+        return values;
+      });
+}
+
+void RemoveShardFiles() {
+  for (int i = 0; i < 4; ++i) {
+    std::string filename = absl::StrCat(kTablePath, "_shard_", i);
+    if (file::Exists(filename)) file::Remove(filename);
+  }
+}
+
+void TestSpillAndReload() {
+  RemoveShardFiles();
+  DiskBackedTable<Values> table = MakeTable();
+  constexpr int kNumKeys = 500;  // Far beyond hot_capacity.
+  for (int i = 0; i < kNumKeys; ++i) {
+    Values& values = table.GetOrCreate(absl::StrCat("infostate ", i));
+    SPIEL_CHECK_TRUE(values.empty());
+    values = {1.0 * i, 2.0 * i};
+  }
+  SPIEL_CHECK_EQ(table.Size(), kNumKeys);
+
+  // Read everything back; most entries must come back from disk.
+  for (int i = 0; i < kNumKeys; ++i) {
+    Values* values = table.Find(absl::StrCat("infostate ", i));
+    SPIEL_CHECK_TRUE(values != nullptr);
+    SPIEL_CHECK_EQ(values->size(), 2);
+    SPIEL_CHECK_FLOAT_EQ((*values)[0], 1.0 * i);
+    SPIEL_CHECK_FLOAT_EQ((*values)[1], 2.0 * i);
+  }
+  SPIEL_CHECK_TRUE(table.Find("never inserted") == nullptr);
+  SPIEL_CHECK_TRUE(table.Contains("infostate 0"));
+  SPIEL_CHECK_FALSE(table.Contains("never inserted"));
+}
+
+void TestForEachMutates() {
+  RemoveShardFiles();
+  DiskBackedTable<Values> table = MakeTable();
+  constexpr int kNumKeys = 200;
+  for (int i = 0; i < kNumKeys; ++i) {
+    table.GetOrCreate(absl::StrCat("key ", i)) = {1.0 * i};
+  }
+  int visited = 0;
+  table.ForEach([&visited](const std::string& key, Values& values) {
+    SPIEL_CHECK_EQ(values.size(), 1);
+    values[0] += 0.5;
+    ++visited;
+  });
+  SPIEL_CHECK_EQ(visited, kNumKeys);
+  for (int i = 0; i < kNumKeys; ++i) {
+    Values* values = table.Find(absl::StrCat("key ", i));
+    SPIEL_CHECK_FLOAT_EQ((*values)[0], 1.0 * i + 0.5);
+  }
+}
+
+void TestPersistsAcrossReopen() {
+  RemoveShardFiles();
+  {
+    DiskBackedTable<Values> table = MakeTable();
+    for (int i = 0; i < 100; ++i) {
+      table.GetOrCreate(absl::StrCat("key ", i)) = {3.0 * i};
+    }
+    // The destructor flushes the dirty hot entries.
+  }
+  DiskBackedTable<Values> reopened = MakeTable();
+  SPIEL_CHECK_EQ(reopened.Size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    Values* values = reopened.Find(absl::StrCat("key ", i));
+    SPIEL_CHECK_TRUE(values != nullptr);
+    SPIEL_CHECK_FLOAT_EQ((*values)[0], 3.0 * i);
+  }
+  RemoveShardFiles();
+}
+
+void TestOddEntrySize() {
+  RemoveShardFiles();
+  // An entry budget that is not a multiple of the slot header alignment;
+  // without padding the slot size, every slot past the first would read and
+  // write its header through a misaligned pointer.
+  DiskBackedTable<Values>::Options options = DefaultOptions();
+  options.max_entries = 200;
+  options.max_entry_bytes = 61;
+  options.hot_capacity = 8;
+  {
+    DiskBackedTable<Values> table = MakeTable(options);
+    for (int i = 0; i < 100; ++i) {
+      table.GetOrCreate(absl::StrCat("key ", i)) = {1.0 * i};
+    }
+    for (int i = 0; i < 100; ++i) {
+      Values* values = table.Find(absl::StrCat("key ", i));
+      SPIEL_CHECK_TRUE(values != nullptr);
+      SPIEL_CHECK_FLOAT_EQ((*values)[0], 1.0 * i);
+    }
+  }
+  RemoveShardFiles();
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestSpillAndReload();
+  open_spiel::TestForEachMutates();
+  open_spiel::TestPersistsAcrossReopen();
+  open_spiel::TestOddEntrySize();
+}
@@ -26,11 +26,15 @@
 #define unlink(file) _unlink(file)
 #define rmdir(dir) _rmdir(dir)
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
 #include <cstdint>
 #include <cstdio>
+#include <string>
+#include <vector>
 
 #include "open_spiel/spiel_utils.h"
 
@@ -77,6 +81,10 @@ bool File::Write(absl::string_view str) {
          str.size();
 }
 
+bool File::SetBufferSize(std::size_t size) {
+  return !std::setvbuf(fd_.get(), nullptr, _IOFBF, size);
+}
+
 std::int64_t File::Length() {
   std::int64_t current = std::ftell(fd_.get());
   std::fseek(fd_.get(), 0, SEEK_END);
@@ -85,6 +93,76 @@ std::int64_t File::Length() {
   return length;
 }
 
+class MappedFile::MappedFileImpl {
+ public:
+  explicit MappedFileImpl(const std::string& filename) {
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    SPIEL_CHECK_GE(fd, 0);
+    struct stat info;
+    SPIEL_CHECK_EQ(fstat(fd, &info), 0);
+    size_ = info.st_size;
+    if (size_ > 0) {
+      void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      SPIEL_CHECK_TRUE(data != MAP_FAILED);
+      data_ = static_cast<const char*>(data);
+    }
+    close(fd);
+#else
+    fallback_ = ReadContentsFromFile(filename, "rb");
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+#endif
+  }
+
+  MappedFileImpl(const MappedFileImpl&) = delete;
+  MappedFileImpl& operator=(const MappedFileImpl&) = delete;
+
+  ~MappedFileImpl() {
+#ifndef _WIN32
+    if (data_ != nullptr) {
+      munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+  }
+
+  absl::string_view contents() const {
+    return absl::string_view(data_, size_);
+  }
+
+ private:
+  const char* data_ = nullptr;
+  std::size_t size_ = 0;
+#ifdef _WIN32
+  std::string fallback_;
+#endif
+};
+
+MappedFile::MappedFile(const std::string& filename)
+    : impl_(new MappedFileImpl(filename)) {}
+
+MappedFile::~MappedFile() = default;
+
+MappedFile::MappedFile(MappedFile&& other) = default;
+MappedFile& MappedFile::operator=(MappedFile&& other) = default;
+
+absl::string_view MappedFile::contents() const { return impl_->contents(); }
+
+std::vector<absl::string_view> MappedFile::Lines() const {
+  std::vector<absl::string_view> lines;
+  absl::string_view remainder = contents();
+  while (!remainder.empty()) {
+    std::size_t pos = remainder.find('\n');
+    if (pos == absl::string_view::npos) {
+      lines.push_back(remainder);
+      break;
+    }
+    lines.push_back(remainder.substr(0, pos));
+    remainder.remove_prefix(pos + 1);
+  }
+  return lines;
+}
+
 std::string ReadContentsFromFile(const std::string& filename,
                                  const std::string& mode) {
   File f(filename, mode);
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 
@@ -46,6 +47,11 @@ class File {
 
   bool Write(absl::string_view str);  // Write to the file.
 
+  // Buffer reads and writes in chunks of `size` bytes instead of the stdio
+  // default. Call before the first read or write. Useful when streaming large
+  // files, eg logs or replay buffers.
+  bool SetBufferSize(std::size_t size);
+
   std::int64_t Length();  // Length of the entire file.
 
  private:
@@ -55,6 +61,34 @@ class File {
   std::unique_ptr<FileImpl> fd_;
 };
 
+// A read-only view of an entire file. Where the platform supports it the file
+// is memory-mapped, so contents() aliases the page cache instead of copying
+// the file through a temporary string; otherwise it falls back to reading the
+// file into an owned buffer. Dies if the file can't be opened. All returned
+// views are invalidated when the MappedFile is destroyed.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& filename);
+
+  // MappedFile is move only.
+  MappedFile(MappedFile&& other);
+  MappedFile& operator=(MappedFile&& other);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile();  // Unmap.
+
+  absl::string_view contents() const;  // The whole file.
+
+  // The lines of the file, without their trailing newlines. Zero-copy: each
+  // view points into the mapping.
+  std::vector<absl::string_view> Lines() const;
+
+ private:
+  class MappedFileImpl;
+  std::unique_ptr<MappedFileImpl> impl_;
+};
+
 // Reads the file at filename to a string. Dies if this doesn't succeed.
 std::string ReadContentsFromFile(const std::string& filename,
                                  const std::string& mode);
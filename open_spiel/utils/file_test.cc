@@ -16,7 +16,10 @@
 
 #include <cstdlib>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/spiel_utils.h"
 
 namespace open_spiel::file {
@@ -69,6 +72,37 @@ void TestFile() {
     File f3(std::move(f2));
   }
 
+  { // Test a mapped read of the same contents.
+    MappedFile m(filename);
+    SPIEL_CHECK_EQ(m.contents(), expected);
+    std::vector<absl::string_view> lines = m.Lines();
+    SPIEL_CHECK_EQ(lines.size(), 1);
+    SPIEL_CHECK_EQ(lines[0], prefix + val);
+
+    MappedFile m2 = std::move(m);
+    SPIEL_CHECK_EQ(m2.contents(), expected);
+  }
+
+  { // Test a buffered write; the contents must come out unchanged.
+    File f(filename, "w");
+    SPIEL_CHECK_TRUE(f.SetBufferSize(1 << 20));
+    SPIEL_CHECK_TRUE(f.Write(prefix));
+    SPIEL_CHECK_TRUE(f.Write(val + "\n"));
+  }
+  SPIEL_CHECK_EQ(ReadContentsFromFile(filename, "r"), expected);
+
+  { // Lines() drops trailing newlines and handles multiple lines.
+    File f(filename, "a");
+    SPIEL_CHECK_TRUE(f.Write("second line"));
+  }
+  {
+    MappedFile m(filename);
+    std::vector<absl::string_view> lines = m.Lines();
+    SPIEL_CHECK_EQ(lines.size(), 2);
+    SPIEL_CHECK_EQ(lines[0], prefix + val);
+    SPIEL_CHECK_EQ(lines[1], "second line");
+  }
+
   SPIEL_CHECK_TRUE(Remove(filename));
   SPIEL_CHECK_FALSE(Remove(filename));  // already gone
   SPIEL_CHECK_FALSE(Exists(filename));
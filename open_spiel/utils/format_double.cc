@@ -0,0 +1,58 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/format_double.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+
+void AppendShortestDouble(double value, std::string* out) {
+  // 17 significant digits, sign, point and exponent all fit well within this.
+  char buf[32];
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const std::to_chars_result result =
+      std::to_chars(buf, buf + sizeof(buf), value);
+  out->append(buf, result.ptr - buf);
+#else
+  // No floating-point to_chars on this toolchain: find the shortest %g that
+  // parses back exactly. 17 significant digits always round-trip a double,
+  // so the loop cannot fall through.
+  for (int precision = 15; precision <= 17; ++precision) {
+    const int len = std::snprintf(buf, sizeof(buf), "%.*g", precision, value);
+    double parsed;
+    if (absl::SimpleAtod(absl::string_view(buf, len), &parsed) &&
+        (parsed == value || (std::isnan(parsed) && std::isnan(value)))) {
+      out->append(buf, len);
+      return;
+    }
+  }
+  SpielFatalError("AppendShortestDouble: no round-trip representation found.");
+#endif
+}
+
+std::string ShortestDoubleToString(double value) {
+  std::string out;
+  AppendShortestDouble(value, &out);
+  return out;
+}
+
+}  // namespace open_spiel
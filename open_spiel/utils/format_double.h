@@ -0,0 +1,40 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_FORMAT_DOUBLE_H_
+#define OPEN_SPIEL_UTILS_FORMAT_DOUBLE_H_
+
+#include <string>
+
+// Fast double-to-string conversion for the text writers (NFG/EFG exports,
+// json, policy serialization). Large exports spend most of their time
+// converting doubles, and the iostream/printf paths both parse a format
+// string per value and produce more digits than needed. The functions here
+// emit the shortest decimal string that parses back to exactly the same
+// double ("shortest round-trip", as in Ryu), using std::to_chars where the
+// toolchain provides it for floating point.
+
+namespace open_spiel {
+
+// Appends the shortest round-trip decimal representation of `value`.
+// Integral values print without a decimal point (e.g. "3"), non-finite
+// values as "inf", "-inf" or "nan". Never uses locale.
+void AppendShortestDouble(double value, std::string* out);
+
+// As above, returning a fresh string.
+std::string ShortestDoubleToString(double value);
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_FORMAT_DOUBLE_H_
@@ -0,0 +1,60 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/format_double.h"
+
+#include <limits>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+void TestRoundTrip() {
+  for (double value : {0.0, 1.0, -1.0, 0.1, -0.1, 1.0 / 3.0, 2.5, 1e-9,
+                       -1e-9, 1e300, -1e300, 1e-300, 5e-324,
+                       std::numeric_limits<double>::max(),
+                       std::numeric_limits<double>::min(),
+                       -1.0 / 18.0, 0.333333333333333}) {
+    const std::string str = ShortestDoubleToString(value);
+    double parsed;
+    SPIEL_CHECK_TRUE(absl::SimpleAtod(str, &parsed));
+    SPIEL_CHECK_EQ(parsed, value);
+  }
+}
+
+void TestShortestForm() {
+  // These must not pick up spurious digits.
+  SPIEL_CHECK_EQ(ShortestDoubleToString(0.1), "0.1");
+  SPIEL_CHECK_EQ(ShortestDoubleToString(2.5), "2.5");
+  SPIEL_CHECK_EQ(ShortestDoubleToString(-2.5), "-2.5");
+  SPIEL_CHECK_EQ(ShortestDoubleToString(3.0), "3");
+}
+
+void TestAppend() {
+  std::string out = "x=";
+  AppendShortestDouble(0.5, &out);
+  SPIEL_CHECK_EQ(out, "x=0.5");
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestRoundTrip();
+  open_spiel::TestShortestForm();
+  open_spiel::TestAppend();
+}
@@ -23,26 +23,49 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/format_double.h"
 
 namespace open_spiel::json {
 
 namespace {
 
-std::string Escape(const std::string& input) {
+// Shortest round-trip representation, with a decimal point forced onto
+// integral values so that the value parses back as a double, not an int.
+void AppendJsonDouble(double value, std::string* out) {
+  const size_t start = out->size();
+  AppendShortestDouble(value, out);
+  // '.' catches fixed notation, 'e' the exponent form, and 'n' both "inf"
+  // and "nan"; anything else is a bare integer.
+  if (out->find_first_of(".en", start) == std::string::npos) {
+    out->append(".0");
+  }
+}
+
+std::string JsonDoubleToString(double value) {
   std::string out;
-  out.reserve(input.length());
+  AppendJsonDouble(value, &out);
+  return out;
+}
+
+void AppendEscaped(absl::string_view input, std::string* out) {
   for (const char c : input) {
     switch (c) {
-      case '"': out.append("\\\""); break;
-      case '\\': out.append("\\\\"); break;
-      case '\b': out.append("\\b"); break;
-      case '\f': out.append("\\f"); break;
-      case '\n': out.append("\\n"); break;
-      case '\r': out.append("\\r"); break;
-      case '\t': out.append("\\t"); break;
-      default: out.push_back(c); break;
+      case '"': out->append("\\\""); break;
+      case '\\': out->append("\\\\"); break;
+      case '\b': out->append("\\b"); break;
+      case '\f': out->append("\\f"); break;
+      case '\n': out->append("\\n"); break;
+      case '\r': out->append("\\r"); break;
+      case '\t': out->append("\\t"); break;
+      default: out->push_back(c); break;
     }
   }
+}
+
+std::string Escape(const std::string& input) {
+  std::string out;
+  out.reserve(input.length());
+  AppendEscaped(input, &out);
   return out;
 }
 
@@ -238,6 +261,213 @@ absl::optional<Value> ParseValue(absl::string_view* str) {
   }
 }
 
+// The streaming counterparts of the Parse* functions above: same grammar and
+// error handling, but events are delivered to a visitor instead of being
+// collected into a Value. Strings without escapes are passed as views into
+// the input; strings with escapes are unescaped into the shared scratch
+// buffer.
+bool StreamString(absl::string_view* str, std::string* scratch,
+                  absl::string_view* out) {
+  if (!ConsumeToken(str, "\"")) {
+    ParseError("Expected '\"'", *str);
+    return false;
+  }
+  size_t end = str->find_first_of("\\\"");
+  if (end == absl::string_view::npos) {
+    ParseError("Unfinished string", *str);
+    return false;
+  }
+  if (str->at(end) == '"') {
+    *out = str->substr(0, end);
+    str->remove_prefix(end + 1);
+    return true;
+  }
+  scratch->clear();
+  bool escape = false;
+  for (auto p = str->begin(); p < str->end(); ++p) {
+    switch (*p) {
+      case '\\':
+        if (escape) {
+          scratch->push_back('\\');
+        }
+        escape = !escape;
+        break;
+      case '"':
+        if (escape) {
+          scratch->push_back('"');
+          escape = false;
+          break;
+        } else {
+          str->remove_prefix(p - str->begin() + 1);
+          *out = *scratch;
+          return true;
+        }
+      default:
+        if (escape) {
+          switch (*p) {
+            case 'b': scratch->append("\b"); break;
+            case 'f': scratch->append("\f"); break;
+            case 'n': scratch->append("\n"); break;
+            case 'r': scratch->append("\r"); break;
+            case 't': scratch->append("\t"); break;
+            default: scratch->push_back(*p); break;
+          }
+          escape = false;
+        } else {
+          scratch->push_back(*p);
+        }
+        break;
+    }
+  }
+  ParseError("Unfinished string", *str);
+  return false;
+}
+
+bool StreamNumber(absl::string_view* str, Visitor* visitor) {
+  size_t valid_double =
+      std::min(str->find_first_not_of("-+.0123456789eE"), str->size());
+  size_t valid_int =
+      std::min(str->find_first_not_of("-0123456789"), str->size());
+  if (valid_double == valid_int) {
+    if (int64_t v; absl::SimpleAtoi(str->substr(0, valid_int), &v)) {
+      str->remove_prefix(valid_int);
+      visitor->OnInt(v);
+      return true;
+    }
+  } else {
+    if (double v; absl::SimpleAtod(str->substr(0, valid_double), &v)) {
+      str->remove_prefix(valid_double);
+      visitor->OnDouble(v);
+      return true;
+    }
+  }
+  ParseError("Invalid number", *str);
+  return false;
+}
+
+bool StreamValue(absl::string_view* str, Visitor* visitor,
+                 std::string* scratch);
+
+bool StreamArray(absl::string_view* str, Visitor* visitor,
+                 std::string* scratch) {
+  if (!ConsumeToken(str, "[")) {
+    ParseError("Expected '['", *str);
+    return false;
+  }
+  visitor->OnStartArray();
+  bool first = true;
+  while (!str->empty()) {
+    ConsumeWhitespace(str);
+    if (ConsumeToken(str, "]")) {
+      visitor->OnEndArray();
+      return true;
+    }
+    if (!first && !ConsumeToken(str, ",")) {
+      ParseError("Expected ','", *str);
+      return false;
+    }
+    first = false;
+    ConsumeWhitespace(str);
+    if (!StreamValue(str, visitor, scratch)) {
+      return false;
+    }
+  }
+  ParseError("Unfinished array", *str);
+  return false;
+}
+
+bool StreamObject(absl::string_view* str, Visitor* visitor,
+                  std::string* scratch) {
+  if (!ConsumeToken(str, "{")) {
+    ParseError("Expected '{'", *str);
+    return false;
+  }
+  visitor->OnStartObject();
+  bool first = true;
+  while (!str->empty()) {
+    ConsumeWhitespace(str);
+    if (ConsumeToken(str, "}")) {
+      visitor->OnEndObject();
+      return true;
+    }
+    if (!first && !ConsumeToken(str, ",")) {
+      ParseError("Expected ','", *str);
+      return false;
+    }
+    first = false;
+    ConsumeWhitespace(str);
+    absl::string_view key;
+    if (!StreamString(str, scratch, &key)) {
+      return false;
+    }
+    visitor->OnKey(key);
+    ConsumeWhitespace(str);
+    if (!ConsumeToken(str, ":")) {
+      ParseError("Expected ':'", *str);
+      return false;
+    }
+    ConsumeWhitespace(str);
+    if (!StreamValue(str, visitor, scratch)) {
+      return false;
+    }
+  }
+  ParseError("Unfinished object", *str);
+  return false;
+}
+
+bool StreamConstant(absl::string_view* str, absl::string_view token) {
+  if (ConsumeToken(str, token)) {
+    return true;
+  }
+  ParseError("Invalid constant: ", *str);
+  return false;
+}
+
+bool StreamValue(absl::string_view* str, Visitor* visitor,
+                 std::string* scratch) {
+  ConsumeWhitespace(str);
+  if (str->empty()) {
+    ParseError("Empty string", *str);
+    return false;
+  }
+  switch (str->at(0)) {
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9': return StreamNumber(str, visitor);
+    case 'n':
+      if (!StreamConstant(str, "null")) return false;
+      visitor->OnNull();
+      return true;
+    case 't':
+      if (!StreamConstant(str, "true")) return false;
+      visitor->OnBool(true);
+      return true;
+    case 'f':
+      if (!StreamConstant(str, "false")) return false;
+      visitor->OnBool(false);
+      return true;
+    case '"': {
+      absl::string_view out;
+      if (!StreamString(str, scratch, &out)) return false;
+      visitor->OnString(out);
+      return true;
+    }
+    case '[': return StreamArray(str, visitor, scratch);
+    case '{': return StreamObject(str, visitor, scratch);
+    default:
+      ParseError("Unexpected char: ", *str);
+      return false;
+  }
+}
+
 }  // namespace
 
 bool Null::operator==(const Null& o) const { return true; }
@@ -299,12 +529,12 @@ std::string ToString(const Value& value, bool wrap, int indent) {
   } else if (value.IsDouble()) {
     double v = value.GetDouble();
     if (std::isfinite(v)) {
-      return std::to_string(v);
+      return JsonDoubleToString(v);
     } else {
       // It'd be nice to show an error with a path, but at least this is
       // debuggable by looking at the json. Crashing doesn't tell you where
       // the problem is.
-      return absl::StrCat("\"", std::to_string(v), "\"");
+      return absl::StrCat("\"", JsonDoubleToString(v), "\"");
     }
   } else if (value.IsString()) {
     return absl::StrCat("\"", Escape(value.GetString()), "\"");
@@ -337,4 +567,89 @@ absl::optional<Value> FromString(absl::string_view str) {
   return ParseValue(&str);
 }
 
+bool Parse(absl::string_view str, Visitor* visitor) {
+  std::string scratch;
+  return StreamValue(&str, visitor, &scratch);
+}
+
+void Writer::BeforeValue() {
+  if (!comma_.empty()) {
+    if (comma_.back()) {
+      out_.append(", ");
+    }
+    comma_.back() = true;
+  }
+}
+
+void Writer::StartObject() {
+  BeforeValue();
+  out_.push_back('{');
+  comma_.push_back(false);
+}
+
+void Writer::EndObject() {
+  comma_.pop_back();
+  out_.push_back('}');
+}
+
+void Writer::StartArray() {
+  BeforeValue();
+  out_.push_back('[');
+  comma_.push_back(false);
+}
+
+void Writer::EndArray() {
+  comma_.pop_back();
+  out_.push_back(']');
+}
+
+void Writer::Key(absl::string_view key) {
+  BeforeValue();
+  out_.push_back('"');
+  AppendEscaped(key, &out_);
+  out_.append("\": ");
+  comma_.back() = false;  // The key's value follows without a separator.
+}
+
+void Writer::Value(Null v) {
+  BeforeValue();
+  out_.append("null");
+}
+
+void Writer::Value(bool v) {
+  BeforeValue();
+  out_.append(v ? "true" : "false");
+}
+
+void Writer::Value(int v) { Value(static_cast<int64_t>(v)); }
+
+void Writer::Value(int64_t v) {
+  BeforeValue();
+  absl::StrAppend(&out_, v);
+}
+
+void Writer::Value(double v) {
+  BeforeValue();
+  if (std::isfinite(v)) {
+    AppendJsonDouble(v, &out_);
+  } else {
+    // Same debuggable-but-invalid encoding as ToString.
+    out_.push_back('"');
+    AppendJsonDouble(v, &out_);
+    out_.push_back('"');
+  }
+}
+
+void Writer::Value(absl::string_view v) {
+  BeforeValue();
+  out_.push_back('"');
+  AppendEscaped(v, &out_);
+  out_.push_back('"');
+}
+
+void Writer::Clear() {
+  out_.clear();
+  comma_.clear();
+}
+
 }  // namespace open_spiel::json
@@ -161,6 +161,62 @@ std::ostream& operator<<(std::ostream& os, const Value& v);
 // Deserialize a string into a JSON value. Returns nullopt on parse failure.
 absl::optional<Value> FromString(absl::string_view str);
 
+// An event-based parser interface for Parse below. One method is called per
+// token, so large documents can be consumed without building the intermediate
+// Value tree of maps and vectors. The string views passed to the callbacks
+// point either into the input or into a scratch buffer reused across calls,
+// and are only valid for the duration of the call.
+class Visitor {
+ public:
+  virtual ~Visitor() = default;
+  virtual void OnNull() = 0;
+  virtual void OnBool(bool value) = 0;
+  virtual void OnInt(int64_t value) = 0;
+  virtual void OnDouble(double value) = 0;
+  virtual void OnString(absl::string_view value) = 0;
+  virtual void OnKey(absl::string_view key) = 0;
+  virtual void OnStartArray() = 0;
+  virtual void OnEndArray() = 0;
+  virtual void OnStartObject() = 0;
+  virtual void OnEndObject() = 0;
+};
+
+// Parse a single JSON value, calling the visitor once per token. Returns
+// false on parse failure, in which case a prefix of the events may already
+// have been delivered.
+bool Parse(absl::string_view str, Visitor* visitor);
+
+// Serializes JSON incrementally into an internal buffer, without building a
+// Value tree. Clear() keeps the buffer's capacity, so a writer reused across
+// records stops allocating once it has seen the largest one. The output
+// matches ToString without wrapping, except that keys are emitted in call
+// order rather than sorted. The caller is responsible for well-formedness:
+// keys only inside objects, one value per key, matched Start/End calls.
+class Writer {
+ public:
+  void StartObject();
+  void EndObject();
+  void StartArray();
+  void EndArray();
+  void Key(absl::string_view key);
+  void Value(Null v);
+  void Value(bool v);
+  void Value(int v);
+  void Value(int64_t v);
+  void Value(double v);
+  void Value(absl::string_view v);
+  void Value(const char* v) { Value(absl::string_view(v)); }
+
+  absl::string_view str() const { return out_; }
+  void Clear();
+
+ private:
+  void BeforeValue();  // Emits the separator between siblings.
+
+  std::string out_;
+  std::vector<bool> comma_;  // Whether the next item at each depth needs one.
+};
+
 }  // namespace open_spiel::json
 
 #endif  // OPEN_SPIEL_UTILS_JSON_H_
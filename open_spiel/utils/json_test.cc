@@ -25,7 +25,10 @@ void TestToString() {
   SPIEL_CHECK_EQ(ToString(true), "true");
   SPIEL_CHECK_EQ(ToString(false), "false");
   SPIEL_CHECK_EQ(ToString(1), "1");
-  SPIEL_CHECK_EQ(ToString(3.1415923), "3.141592");
+  SPIEL_CHECK_EQ(ToString(3.1415923), "3.1415923");
+  SPIEL_CHECK_EQ(ToString(2.5), "2.5");
+  // Integral doubles keep a decimal point so they parse back as doubles.
+  SPIEL_CHECK_EQ(ToString(2.0), "2.0");
   SPIEL_CHECK_EQ(ToString("asdf"), "\"asdf\"");
   SPIEL_CHECK_EQ(ToString(std::string("asdf")), "\"asdf\"");
   SPIEL_CHECK_EQ(ToString(Array({"asdf"})), "[\"asdf\"]");
@@ -212,6 +215,90 @@ void TestValue() {
                  Object({{"asdf", 1}, {"bar", 2}}));
 }
 
+// Forwards every parse event to a Writer, so parsing then re-serializing a
+// document exercises both streaming halves without any Value tree.
+class EchoVisitor : public Visitor {
+ public:
+  void OnNull() override { writer_.Value(Null()); }
+  void OnBool(bool value) override { writer_.Value(value); }
+  void OnInt(int64_t value) override { writer_.Value(value); }
+  void OnDouble(double value) override { writer_.Value(value); }
+  void OnString(absl::string_view value) override { writer_.Value(value); }
+  void OnKey(absl::string_view key) override { writer_.Key(key); }
+  void OnStartArray() override { writer_.StartArray(); }
+  void OnEndArray() override { writer_.EndArray(); }
+  void OnStartObject() override { writer_.StartObject(); }
+  void OnEndObject() override { writer_.EndObject(); }
+
+  Writer& writer() { return writer_; }
+
+ private:
+  Writer writer_;
+};
+
+void TestWriter() {
+  Writer w;
+
+  w.Value(Null());
+  SPIEL_CHECK_EQ(w.str(), "null");
+  w.Clear();
+
+  w.StartArray();
+  w.Value(1);
+  w.Value(Null());
+  w.Value("asdf");
+  w.EndArray();
+  SPIEL_CHECK_EQ(w.str(), ToString(Array({1, Null(), "asdf"})));
+  w.Clear();
+
+  // Matches the tree serializer on a nested record.
+  w.StartObject();
+  w.Key("asdf");
+  w.StartObject();
+  w.Key("bar");
+  w.Value(6);
+  w.EndObject();
+  w.Key("foo");
+  w.StartArray();
+  w.Value(1);
+  w.Value(true);
+  w.Value(false);
+  w.EndArray();
+  w.EndObject();
+  SPIEL_CHECK_EQ(w.str(),
+                 ToString(Object({{"asdf", Object({{"bar", 6}})},
+                                  {"foo", Array({1, true, false})}})));
+  w.Clear();
+
+  w.StartObject();
+  w.Key("a\nb");
+  w.Value("c\"d");
+  w.EndObject();
+  SPIEL_CHECK_EQ(w.str(), "{\"a\\nb\": \"c\\\"d\"}");
+}
+
+void TestStreaming() {
+  // Round trip: parse events straight back into a writer, and compare against
+  // the canonical serialization of the tree parser.
+  for (const char* text : {
+           "null",
+           "[1, 2.500000, true, null, \"asdf\"]",
+           "{\"asdf\": {\"bar\": 6}, \"foo\": [1, 2, 3]}",
+           "{\"escaped\": \"new\\nline\"}",
+       }) {
+    EchoVisitor echo;
+    SPIEL_CHECK_TRUE(Parse(text, &echo));
+    absl::optional<Value> v = FromString(text);
+    SPIEL_CHECK_TRUE(v);
+    SPIEL_CHECK_EQ(echo.writer().str(), ToString(*v));
+  }
+
+  // Whitespace is accepted and does not leak into the events.
+  EchoVisitor echo;
+  SPIEL_CHECK_TRUE(Parse(" { \"a\" : [ 1 , 2 ] } ", &echo));
+  SPIEL_CHECK_EQ(echo.writer().str(), "{\"a\": [1, 2]}");
+}
+
 }  // namespace
 
 }  // namespace open_spiel::json
@@ -221,4 +308,6 @@ int main(int argc, char** argv) {
   open_spiel::json::TestToString();
   open_spiel::json::TestFromString();
   open_spiel::json::TestValue();
+  open_spiel::json::TestWriter();
+  open_spiel::json::TestStreaming();
 }
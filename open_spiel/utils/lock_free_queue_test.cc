@@ -0,0 +1,151 @@
+// Copyright 2022 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/lock_free_queue.h"
+
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+namespace {
+
+// Mirrors the single-threaded ThreadedQueue test: the two queues promise the
+// same semantics.
+void TestLockFreeQueue() {
+  LockFreeQueue<int> q(4);
+
+  auto CheckPopEq = [&q](int expected) {
+    absl::optional<int> v = q.Pop();
+    SPIEL_CHECK_TRUE(v);
+    SPIEL_CHECK_EQ(*v, expected);
+  };
+
+  SPIEL_CHECK_TRUE(q.Empty());
+  SPIEL_CHECK_EQ(q.Size(), 0);
+
+  SPIEL_CHECK_FALSE(q.Pop(absl::Milliseconds(1)));
+  SPIEL_CHECK_FALSE(q.Pop(absl::Now() + absl::Milliseconds(1)));
+
+  SPIEL_CHECK_TRUE(q.Push(10, absl::Now() + absl::Milliseconds(1)));
+  SPIEL_CHECK_FALSE(q.Empty());
+  SPIEL_CHECK_EQ(q.Size(), 1);
+
+  CheckPopEq(10);
+
+  SPIEL_CHECK_TRUE(q.Push(11));
+  SPIEL_CHECK_TRUE(q.Push(12));
+  SPIEL_CHECK_EQ(q.Size(), 2);
+  SPIEL_CHECK_TRUE(q.Push(13));
+  SPIEL_CHECK_TRUE(q.Push(14));
+  SPIEL_CHECK_EQ(q.Size(), 4);
+  SPIEL_CHECK_FALSE(q.Push(15, absl::Milliseconds(1)));
+
+  CheckPopEq(11);
+
+  SPIEL_CHECK_TRUE(q.Push(16, absl::Milliseconds(1)));
+
+  CheckPopEq(12);
+  CheckPopEq(13);
+  CheckPopEq(14);
+  CheckPopEq(16);
+  SPIEL_CHECK_EQ(q.Size(), 0);
+
+  SPIEL_CHECK_TRUE(q.Push(17));
+  SPIEL_CHECK_TRUE(q.Push(18));
+  SPIEL_CHECK_EQ(q.Size(), 2);
+
+  q.Clear();
+
+  SPIEL_CHECK_TRUE(q.Empty());
+  SPIEL_CHECK_EQ(q.Size(), 0);
+
+  SPIEL_CHECK_TRUE(q.Push(19));
+  SPIEL_CHECK_TRUE(q.Push(20));
+
+  q.BlockNewValues();
+
+  SPIEL_CHECK_EQ(q.Size(), 2);
+  SPIEL_CHECK_FALSE(q.Push(21));
+  SPIEL_CHECK_EQ(q.Size(), 2);
+  CheckPopEq(19);
+  CheckPopEq(20);
+  SPIEL_CHECK_FALSE(q.Pop());
+
+  // Both the failed push and the failed pops had to wait.
+  LockFreeQueue<int>::WaitTimes wait_times = q.GetWaitTimes();
+  SPIEL_CHECK_GE(wait_times.push_waits, 1);
+  SPIEL_CHECK_GE(wait_times.pop_waits, 2);
+  SPIEL_CHECK_GT(wait_times.push_wait_time, absl::ZeroDuration());
+  SPIEL_CHECK_GT(wait_times.pop_wait_time, absl::ZeroDuration());
+}
+
+// Several producers and consumers moving many values through a small ring:
+// every pushed value must come out exactly once.
+void TestLockFreeQueueThreaded() {
+  constexpr int kNumProducers = 4;
+  constexpr int kNumConsumers = 4;
+  constexpr int kValuesPerProducer = 10000;
+  LockFreeQueue<int> q(16);
+
+  std::vector<std::atomic<int>> seen(kNumProducers * kValuesPerProducer);
+  for (auto& s : seen) {
+    s = 0;
+  }
+
+  std::vector<Thread> threads;
+  for (int p = 0; p < kNumProducers; ++p) {
+    threads.emplace_back([&q, p]() {
+      for (int i = 0; i < kValuesPerProducer; ++i) {
+        SPIEL_CHECK_TRUE(q.Push(p * kValuesPerProducer + i));
+      }
+    });
+  }
+  for (int c = 0; c < kNumConsumers; ++c) {
+    threads.emplace_back([&q, &seen]() {
+      while (true) {
+        absl::optional<int> v = q.Pop();
+        if (!v) {
+          return;
+        }
+        seen[*v].fetch_add(1);
+      }
+    });
+  }
+
+  for (int p = 0; p < kNumProducers; ++p) {
+    threads[p].join();
+  }
+  // Producers are done; unblock the consumers once the queue drains.
+  q.BlockNewValues();
+  for (int c = 0; c < kNumConsumers; ++c) {
+    threads[kNumProducers + c].join();
+  }
+
+  for (const auto& s : seen) {
+    SPIEL_CHECK_EQ(s.load(), 1);
+  }
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestLockFreeQueue();
+  open_spiel::TestLockFreeQueueThreaded();
+}
@@ -61,9 +61,40 @@ void TestFileLogger() {
   SPIEL_CHECK_TRUE(file::Remove(dir));
 }
 
+void TestAsyncFileLogger() {
+  std::string val = std::to_string(std::rand());  // NOLINT
+  std::string tmp_dir = file::GetTmpDir();
+  std::string dir = tmp_dir + "/open_spiel-test-" + val;
+  std::string filename = dir + "/log-async.txt";
+
+  SPIEL_CHECK_TRUE(file::Mkdir(dir));
+
+  {
+    AsyncFileLogger logger(dir, "async");
+    logger.Print("line 1");
+    logger.Print("line %d", 2);
+    SPIEL_CHECK_EQ(logger.Dropped(), 0);
+  }  // The destructor drains the ring.
+
+  {
+    file::File f(filename, "r");
+    std::vector<std::string> lines = absl::StrSplit(f.ReadContents(), '\n');
+    SPIEL_CHECK_EQ(lines.size(), 5);
+    SPIEL_CHECK_TRUE(absl::StrContains(lines[0], "async started"));
+    SPIEL_CHECK_TRUE(absl::StrContains(lines[1], "line 1"));
+    SPIEL_CHECK_TRUE(absl::StrContains(lines[2], "line 2"));
+    SPIEL_CHECK_TRUE(absl::StrContains(lines[3], "Closing the log"));
+    SPIEL_CHECK_EQ(lines[4], "");
+  }
+
+  SPIEL_CHECK_TRUE(file::Remove(filename));
+  SPIEL_CHECK_TRUE(file::Remove(dir));
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::TestFileLogger();
+  open_spiel::TestAsyncFileLogger();
 }
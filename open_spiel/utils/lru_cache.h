@@ -15,9 +15,11 @@
 #ifndef OPEN_SPIEL_UTILS_LRU_CACHE_H_
 #define OPEN_SPIEL_UTILS_LRU_CACHE_H_
 
+#include <deque>
 #include <list>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 
 namespace open_spiel {
@@ -27,6 +29,7 @@ struct LRUCacheInfo {
   int64_t misses = 0;
   int size = 0;
   int max_size = 0;
+  int64_t evictions = 0;
 
   double Usage() const {
     return max_size == 0 ? 0 : static_cast<double>(size) / max_size;
@@ -41,6 +44,7 @@ struct LRUCacheInfo {
     misses += o.misses;
     size += o.size;
     max_size += o.max_size;
+    evictions += o.evictions;
   }
 };
 
@@ -54,13 +58,11 @@ class LRUCache {  // Least Recently Used Cache.
   // - Use atomics for hits/misses to shorten lock times.
   // - Embed the list directly into the map value to avoid extra indirection.
  public:
-  explicit LRUCache(int max_size) : hits_(0), misses_(0) {
+  explicit LRUCache(int max_size) : hits_(0), misses_(0), evictions_(0) {
     SetMaxSize(max_size);
   }
 
-  // Move only, not copyable.
-  LRUCache(LRUCache&& other) = default;
-  LRUCache& operator=(LRUCache&& other) = default;
+  // Neither copyable nor movable: the mutex pins the cache in place.
   LRUCache(const LRUCache&) = delete;
   LRUCache& operator=(const LRUCache&) = delete;
 
@@ -77,6 +79,7 @@ class LRUCache {  // Least Recently Used Cache.
     map_.clear();
     hits_ = 0;
     misses_ = 0;
+    evictions_ = 0;
   }
 
   void Set(const K& key, const V& value) {
@@ -86,6 +89,7 @@ class LRUCache {  // Least Recently Used Cache.
       if (map_.size() >= max_size_) {  // Make space if needed.
         map_.erase(order_.back());
         order_.pop_back();
+        evictions_ += 1;
       }
       order_.push_front(key);
       map_[key] = Entry{value, order_.begin()};
@@ -114,7 +118,7 @@ class LRUCache {  // Least Recently Used Cache.
   LRUCacheInfo Info() {
     absl::MutexLock lock(&m_);
     return LRUCacheInfo{hits_, misses_, static_cast<int>(map_.size()),
-                        max_size_};
+                        max_size_, evictions_};
   }
 
  private:
@@ -125,12 +129,64 @@ class LRUCache {  // Least Recently Used Cache.
 
   int64_t hits_;
   int64_t misses_;
+  int64_t evictions_;
   int max_size_;
   std::list<K> order_;
   absl::flat_hash_map<K, Entry> map_;
   absl::Mutex m_;
 };
 
+// An LRU cache sharded by key hash. Each shard is an independent LRUCache
+// with its own lock, so concurrent callers only contend when they hit the
+// same shard. Capacity and the hit/miss/eviction counters are kept per shard
+// and aggregated by Info(); eviction is per shard too, which approximates
+// global LRU as long as the hash spreads the keys evenly.
+template <typename K, typename V>
+class ShardedLRUCache {
+ public:
+  ShardedLRUCache(int max_size, int num_shards)
+      : num_shards_(std::max(num_shards, 1)) {
+    for (int i = 0; i < num_shards_; ++i) {
+      shards_.emplace_back(max_size / num_shards_);
+    }
+  }
+
+  void Set(const K& key, const V& value) { Shard(key).Set(key, value); }
+  absl::optional<const V> Get(const K& key) { return Shard(key).Get(key); }
+
+  int Size() {
+    int size = 0;
+    for (LRUCache<K, V>& shard : shards_) {
+      size += shard.Size();
+    }
+    return size;
+  }
+
+  void Clear() {
+    for (LRUCache<K, V>& shard : shards_) {
+      shard.Clear();
+    }
+  }
+
+  LRUCacheInfo Info() {
+    LRUCacheInfo info;
+    for (LRUCache<K, V>& shard : shards_) {
+      info += shard.Info();
+    }
+    return info;
+  }
+
+ private:
+  LRUCache<K, V>& Shard(const K& key) {
+    return shards_[absl::Hash<K>{}(key) % num_shards_];
+  }
+
+  const int num_shards_;
+  // A deque, not a vector: LRUCache is immovable (it holds a mutex), and
+  // deque emplaces the shards in place without ever relocating them.
+  std::deque<LRUCache<K, V>> shards_;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_UTILS_LRU_CACHE_H_
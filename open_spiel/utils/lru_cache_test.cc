@@ -14,6 +14,7 @@
 
 #include "open_spiel/utils/lru_cache.h"
 
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/spiel_utils.h"
 
 namespace open_spiel {
@@ -73,7 +74,52 @@ void TestLRUCache() {
   SPIEL_CHECK_FALSE(cache.Get(18));  // evicted
 }
 
+void TestLRUCacheEvictionCount() {
+  LRUCache<int, std::string> cache(4);
+  for (int i = 0; i < 6; ++i) {
+    cache.Set(i, "value");
+  }
+  LRUCacheInfo info = cache.Info();
+  SPIEL_CHECK_EQ(info.size, 4);
+  SPIEL_CHECK_EQ(info.evictions, 2);
+}
+
+void TestShardedLRUCache() {
+  // Each of the 4 shards gets capacity 8, so the 8 keys below fit however
+  // the hash spreads them.
+  ShardedLRUCache<int, std::string> cache(32, 4);
+
+  SPIEL_CHECK_EQ(cache.Size(), 0);
+  SPIEL_CHECK_FALSE(cache.Get(1));
+
+  for (int i = 0; i < 8; ++i) {
+    cache.Set(i, absl::StrCat(i));
+  }
+  SPIEL_CHECK_EQ(cache.Size(), 8);
+
+  {
+    absl::optional<const std::string> v = cache.Get(5);
+    SPIEL_CHECK_TRUE(v);
+    SPIEL_CHECK_EQ(*v, "5");
+  }
+
+  // Counters and capacity aggregate over the shards.
+  LRUCacheInfo info = cache.Info();
+  SPIEL_CHECK_EQ(info.hits, 1);
+  SPIEL_CHECK_EQ(info.misses, 1);
+  SPIEL_CHECK_EQ(info.size, 8);
+  SPIEL_CHECK_EQ(info.max_size, 32);
+
+  cache.Clear();
+  SPIEL_CHECK_EQ(cache.Size(), 0);
+  SPIEL_CHECK_FALSE(cache.Get(5));
+}
+
 }  // namespace
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::TestLRUCache(); }
+int main(int argc, char** argv) {
+  open_spiel::TestLRUCache();
+  open_spiel::TestLRUCacheEvictionCount();
+  open_spiel::TestShardedLRUCache();
+}
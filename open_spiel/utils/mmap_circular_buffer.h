@@ -0,0 +1,257 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_MMAP_CIRCULAR_BUFFER_H_
+#define OPEN_SPIEL_UTILS_MMAP_CIRCULAR_BUFFER_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <nop/serializer.h>
+#include <nop/utility/stream_reader.h>
+#include <nop/utility/stream_writer.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+
+// A circular buffer with the same usage pattern as CircularBuffer, but backed
+// by a memory-mapped file, so the window size is bounded by disk rather than
+// DRAM. Records are serialized with libnop into fixed-size slots; appends are
+// O(1) and sampling reads only the touched pages through the mapping.
+//
+// The file is the buffer: reopening the same path recovers the window, also
+// after a crash. Each slot carries the record's sequence number and a payload
+// checksum, and recovery trusts only slots whose sequence number matches
+// their position and whose checksum holds, so a write torn mid-append is
+// dropped rather than returned as garbage.
+template <class T>
+class MmapCircularBuffer {
+ public:
+  // Opens (or creates) the buffer at `path`, with room for `max_size` records
+  // of up to `max_record_size` serialized bytes each. Opening an existing
+  // file with different sizes is an error.
+  MmapCircularBuffer(const std::string& path, int64_t max_size,
+                     int64_t max_record_size)
+      : max_size_(max_size),
+        slot_size_(static_cast<int64_t>(sizeof(SlotHeader)) +
+                   max_record_size) {
+    SPIEL_CHECK_GT(max_size, 0);
+    SPIEL_CHECK_GT(max_record_size, 0);
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+      SpielFatalError(absl::StrFormat("Failed to open %s", path));
+    }
+    file_size_ = kHeaderSize + max_size_ * slot_size_;
+    if (ftruncate(fd_, file_size_) != 0) {
+      SpielFatalError(absl::StrFormat("Failed to size %s to %d bytes", path,
+                                      file_size_));
+    }
+    data_ = static_cast<char*>(mmap(nullptr, file_size_,
+                                    PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+                                    0));
+    if (data_ == MAP_FAILED) {
+      SpielFatalError(absl::StrFormat("Failed to mmap %s", path));
+    }
+    valid_.assign(max_size_, false);
+    FileHeader* header = Header();
+    if (header->magic == kMagic) {
+      if (header->version != kVersion || header->max_size != max_size_ ||
+          header->slot_size != slot_size_) {
+        SpielFatalError(absl::StrFormat(
+            "Buffer file %s has max_size %d and record size %d; expected "
+            "%d and %d.",
+            path, header->max_size,
+            header->slot_size - static_cast<int64_t>(sizeof(SlotHeader)),
+            max_size_, max_record_size));
+      }
+      Recover();
+    } else {  // A new file is zero-filled; just stamp the header.
+      header->magic = kMagic;
+      header->version = kVersion;
+      header->max_size = max_size_;
+      header->slot_size = slot_size_;
+      header->total_added = 0;
+    }
+  }
+
+  ~MmapCircularBuffer() {
+    if (data_ != nullptr) {
+      Flush();
+      munmap(data_, file_size_);
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  // The mapping is owned exclusively.
+  MmapCircularBuffer(const MmapCircularBuffer&) = delete;
+  MmapCircularBuffer& operator=(const MmapCircularBuffer&) = delete;
+
+  // Add one element, replacing the oldest once it's full.
+  void Add(const T& value) {
+    nop::Serializer<nop::StreamWriter<std::stringstream>> serializer;
+    serializer.Write(value);
+    const std::string payload = serializer.writer().stream().str();
+    if (static_cast<int64_t>(payload.size()) > PayloadCapacity()) {
+      SpielFatalError(absl::StrFormat(
+          "Record of %d bytes exceeds the max record size of %d.",
+          payload.size(), PayloadCapacity()));
+    }
+    const int64_t slot = total_added_ % max_size_;
+    SlotHeader* header = SlotAt(slot);
+    // Clear the sequence number before touching the payload, and set it
+    // last, so a crash mid-append leaves a slot that recovery discards
+    // rather than a torn record.
+    header->seq = 0;
+    char* dest = PayloadAt(slot);
+    std::memcpy(dest, payload.data(), payload.size());
+    header->size = payload.size();
+    header->checksum = Checksum(dest, payload.size());
+    header->seq = ++total_added_;
+    if (!valid_[slot]) {
+      valid_[slot] = true;
+      ++num_valid_;
+    }
+  }
+
+  // Return `num` elements without replacement.
+  std::vector<T> Sample(std::mt19937* rng, int num) {
+    std::vector<int64_t> slots;
+    slots.reserve(num_valid_);
+    for (int64_t i = 0; i < max_size_; ++i) {
+      if (valid_[i]) slots.push_back(i);
+    }
+    std::vector<int64_t> chosen;
+    chosen.reserve(num);
+    std::sample(slots.begin(), slots.end(), std::back_inserter(chosen), num,
+                *rng);
+    std::vector<T> out;
+    out.reserve(chosen.size());
+    for (int64_t slot : chosen) {
+      out.push_back(Get(slot));
+    }
+    return out;
+  }
+
+  // Read a single element back from its slot in the file.
+  T Get(int64_t slot) const {
+    SPIEL_CHECK_TRUE(valid_[slot]);
+    const SlotHeader* header = SlotAt(slot);
+    nop::Deserializer<nop::StreamReader<std::stringstream>> deserializer{
+        std::string(PayloadAt(slot), header->size)};
+    T value;
+    deserializer.Read(&value);
+    return value;
+  }
+
+  // How many elements are in the buffer.
+  int64_t Size() const { return num_valid_; }
+
+  // Is the buffer empty?
+  bool Empty() const { return num_valid_ == 0; }
+
+  // How many elements have ever been added to the buffer.
+  int64_t TotalAdded() const { return total_added_; }
+
+  // Push outstanding writes to disk. Recovery does not depend on this being
+  // called; it only bounds how much of the newest data a crash (or power
+  // loss) can lose to the page cache.
+  void Flush() {
+    Header()->total_added = total_added_;
+    msync(data_, file_size_, MS_SYNC);
+  }
+
+ private:
+  struct FileHeader {
+    uint64_t magic;
+    uint64_t version;
+    int64_t max_size;
+    int64_t slot_size;
+    int64_t total_added;  // Advisory; recovery rescans the slots.
+  };
+  struct SlotHeader {
+    uint64_t seq;       // 1-based id of the record; 0 marks an empty slot.
+    uint32_t size;      // Payload bytes used.
+    uint32_t checksum;  // FNV-1a over the payload.
+  };
+
+  static constexpr uint64_t kMagic = 0x4f53'4d4d'4150'4231ULL;  // "OSMMAPB1"
+  static constexpr uint64_t kVersion = 1;
+  static constexpr int64_t kHeaderSize = 4096;  // Keeps slots page-aligned.
+
+  // Rebuild the in-memory view from the slots of an existing file. The slot
+  // headers, not the file header, are authoritative.
+  void Recover() {
+    total_added_ = 0;
+    num_valid_ = 0;
+    for (int64_t i = 0; i < max_size_; ++i) {
+      const SlotHeader* slot = SlotAt(i);
+      valid_[i] = slot->seq != 0 &&
+                  static_cast<int64_t>((slot->seq - 1) % max_size_) == i &&
+                  static_cast<int64_t>(slot->size) <= PayloadCapacity() &&
+                  Checksum(PayloadAt(i), slot->size) == slot->checksum;
+      if (valid_[i]) {
+        ++num_valid_;
+        total_added_ =
+            std::max(total_added_, static_cast<int64_t>(slot->seq));
+      }
+    }
+  }
+
+  FileHeader* Header() const { return reinterpret_cast<FileHeader*>(data_); }
+  SlotHeader* SlotAt(int64_t slot) const {
+    return reinterpret_cast<SlotHeader*>(data_ + kHeaderSize +
+                                         slot * slot_size_);
+  }
+  char* PayloadAt(int64_t slot) const {
+    return data_ + kHeaderSize + slot * slot_size_ + sizeof(SlotHeader);
+  }
+  int64_t PayloadCapacity() const {
+    return slot_size_ - static_cast<int64_t>(sizeof(SlotHeader));
+  }
+
+  static uint32_t Checksum(const char* data, int64_t size) {
+    uint32_t hash = 2166136261u;  // FNV-1a.
+    for (int64_t i = 0; i < size; ++i) {
+      hash = (hash ^ static_cast<unsigned char>(data[i])) * 16777619u;
+    }
+    return hash;
+  }
+
+  const int64_t max_size_;
+  const int64_t slot_size_;
+  int fd_ = -1;
+  int64_t file_size_ = 0;
+  char* data_ = nullptr;
+  int64_t total_added_ = 0;
+  int64_t num_valid_ = 0;
+  std::vector<bool> valid_;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_MMAP_CIRCULAR_BUFFER_H_
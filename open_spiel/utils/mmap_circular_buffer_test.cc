@@ -0,0 +1,157 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/mmap_circular_buffer.h"
+
+#include <nop/structure.h>
+
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace {
+
+const char* kBufferFilename = "mmap_buffer_data.nop";
+
+struct TestStruct {
+  std::vector<Action> action_vector;
+  std::vector<float> float_vector;
+  double double_value;
+
+  bool operator==(const TestStruct& other) const {
+    return action_vector == other.action_vector &&
+           float_vector == other.float_vector &&
+           double_value == other.double_value;
+  }
+
+  NOP_STRUCTURE(TestStruct, action_vector, float_vector, double_value);
+};
+
+void TestMmapCircularBuffer() {
+  file::Remove(kBufferFilename);
+  MmapCircularBuffer<int> buffer(kBufferFilename, 4, 64);
+  std::mt19937 rng;
+  std::vector<int> sample;
+
+  SPIEL_CHECK_TRUE(buffer.Empty());
+  SPIEL_CHECK_EQ(buffer.Size(), 0);
+
+  buffer.Add(13);
+  SPIEL_CHECK_FALSE(buffer.Empty());
+  SPIEL_CHECK_EQ(buffer.Size(), 1);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 1);
+  SPIEL_CHECK_EQ(buffer.Get(0), 13);
+
+  sample = buffer.Sample(&rng, 1);
+  SPIEL_CHECK_EQ(sample.size(), 1);
+  SPIEL_CHECK_EQ(sample[0], 13);
+
+  buffer.Add(14);
+  buffer.Add(15);
+  buffer.Add(16);
+
+  SPIEL_CHECK_EQ(buffer.Size(), 4);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 4);
+
+  sample = buffer.Sample(&rng, 2);
+  SPIEL_CHECK_EQ(sample.size(), 2);
+  SPIEL_CHECK_GE(sample[0], 13);
+  SPIEL_CHECK_LE(sample[0], 16);
+  SPIEL_CHECK_GE(sample[1], 13);
+  SPIEL_CHECK_LE(sample[1], 16);
+
+  buffer.Add(17);
+  buffer.Add(18);
+
+  SPIEL_CHECK_EQ(buffer.Size(), 4);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 6);
+
+  sample = buffer.Sample(&rng, 1);
+  SPIEL_CHECK_EQ(sample.size(), 1);
+  SPIEL_CHECK_GE(sample[0], 15);
+  SPIEL_CHECK_LE(sample[0], 18);
+}
+
+void TestMmapCircularBufferPersistence() {
+  file::Remove(kBufferFilename);
+  TestStruct struct1 = {.action_vector = {1, 2, 3},
+                        .float_vector = {1.0f, 2.0f, 3.0f},
+                        .double_value = 1.23};
+  TestStruct struct2 = {.action_vector = {4, 5, 6},
+                        .float_vector = {4.0f, 5.0f, 6.0f},
+                        .double_value = 4.56};
+  {
+    MmapCircularBuffer<TestStruct> buffer(kBufferFilename, 3, 256);
+    buffer.Add(struct1);
+    buffer.Add(struct2);
+  }  // Unmapped; the file is the buffer.
+
+  MmapCircularBuffer<TestStruct> buffer(kBufferFilename, 3, 256);
+  SPIEL_CHECK_EQ(buffer.Size(), 2);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 2);
+  SPIEL_CHECK_TRUE(buffer.Get(0) == struct1);
+  SPIEL_CHECK_TRUE(buffer.Get(1) == struct2);
+}
+
+void TestMmapCircularBufferRecovery() {
+  file::Remove(kBufferFilename);
+  const int64_t max_record_size = 64;
+  {
+    MmapCircularBuffer<int> buffer(kBufferFilename, 4, max_record_size);
+    buffer.Add(13);
+    buffer.Add(14);
+    buffer.Add(15);
+  }
+  {
+    // Corrupt a payload byte of slot 1, as a torn write would. The header
+    // page is 4096 bytes and each slot is a 16 byte header plus the payload.
+    std::fstream fd(kBufferFilename,
+                    std::ios::binary | std::ios::in | std::ios::out);
+    fd.seekp(4096 + 1 * (16 + max_record_size) + 16);
+    fd.put('\xff');
+  }
+
+  MmapCircularBuffer<int> buffer(kBufferFilename, 4, max_record_size);
+  SPIEL_CHECK_EQ(buffer.Size(), 2);  // The torn record is dropped...
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 3);
+  SPIEL_CHECK_EQ(buffer.Get(0), 13);  // ... and the others survive.
+  SPIEL_CHECK_EQ(buffer.Get(2), 15);
+
+  // Appends continue from where the sequence left off.
+  buffer.Add(16);
+  buffer.Add(17);
+  SPIEL_CHECK_EQ(buffer.Size(), 3);  // Slot 1 stays empty until reused.
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 5);
+  SPIEL_CHECK_EQ(buffer.Get(3), 16);
+  SPIEL_CHECK_EQ(buffer.Get(0), 17);
+}
+
+void EndMmapCircularBufferTest() {
+  file::Remove(kBufferFilename);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestMmapCircularBuffer();
+  open_spiel::TestMmapCircularBufferPersistence();
+  open_spiel::TestMmapCircularBufferRecovery();
+  open_spiel::EndMmapCircularBufferTest();
+}
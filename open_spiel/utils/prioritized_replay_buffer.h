@@ -0,0 +1,188 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_PRIORITIZED_REPLAY_BUFFER_H_
+#define OPEN_SPIEL_UTILS_PRIORITIZED_REPLAY_BUFFER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+// A replay buffer with proportional prioritized sampling (Schaul et al.,
+// Prioritized Experience Replay, 2016, https://arxiv.org/abs/1511.05952),
+// backed by a sum tree so that both priority updates and sampling are
+// O(log capacity).
+
+namespace open_spiel {
+
+// A complete binary tree over a fixed number of leaves where each internal
+// node holds the sum of its children. Setting a leaf and sampling a leaf
+// proportionally to its value are both O(log capacity).
+class SumTree {
+ public:
+  explicit SumTree(int capacity) : capacity_(capacity) {
+    SPIEL_CHECK_GT(capacity, 0);
+    nodes_.resize(2 * capacity_, 0.0);
+  }
+
+  void Set(int index, double value) {
+    SPIEL_CHECK_GE(index, 0);
+    SPIEL_CHECK_LT(index, capacity_);
+    SPIEL_CHECK_GE(value, 0);
+    int node = capacity_ + index;
+    const double delta = value - nodes_[node];
+    for (; node >= 1; node /= 2) {
+      nodes_[node] += delta;
+    }
+  }
+
+  double Get(int index) const {
+    SPIEL_CHECK_GE(index, 0);
+    SPIEL_CHECK_LT(index, capacity_);
+    return nodes_[capacity_ + index];
+  }
+
+  double Total() const { return nodes_[1]; }
+
+  // Returns the index of the leaf l for which the sum of all leaves before
+  // it is <= mass < that sum plus the leaf's own value. `mass` must be in
+  // [0, Total()).
+  int FindPrefixSum(double mass) const {
+    SPIEL_CHECK_GE(mass, 0);
+    int node = 1;
+    while (node < capacity_) {
+      const int left = 2 * node;
+      if (mass < nodes_[left]) {
+        node = left;
+      } else {
+        mass -= nodes_[left];
+        node = left + 1;
+      }
+    }
+    return node - capacity_;
+  }
+
+ private:
+  const int capacity_;
+  std::vector<double> nodes_;
+};
+
+// The result of sampling a batch: the transitions, their slots in the
+// buffer (to pass back into SetPriority), and their normalized importance
+// sampling weights (max weight in the batch == 1).
+template <class T>
+struct PrioritizedSample {
+  std::vector<T> items;
+  std::vector<int> indices;
+  std::vector<double> weights;
+};
+
+// A circular replay buffer of fixed size where elements are sampled with
+// probability proportional to priority^alpha. New elements get the maximum
+// priority seen so far, so every transition is sampled at least once before
+// its priority is corrected.
+template <class T>
+class PrioritizedReplayBuffer {
+ public:
+  explicit PrioritizedReplayBuffer(int max_size, double alpha = 0.6)
+      : max_size_(max_size),
+        alpha_(alpha),
+        total_added_(0),
+        max_priority_(1.0),
+        tree_(max_size) {
+    SPIEL_CHECK_GE(alpha, 0);
+  }
+
+  // Add one element with maximal priority, replacing the oldest once full.
+  void Add(const T& value) {
+    const int index = total_added_ % max_size_;
+    if (data_.size() < max_size_) {
+      data_.push_back(value);
+    } else {
+      data_[index] = value;
+    }
+    tree_.Set(index, std::pow(max_priority_, alpha_));
+    total_added_ += 1;
+  }
+
+  // Return `num` elements sampled proportionally to priority, stratified:
+  // the total mass is split into `num` equal segments and one element is
+  // drawn uniformly within each, which keeps the batch spread over the
+  // priority range.
+  PrioritizedSample<T> Sample(std::mt19937* rng, int num, double beta) {
+    SPIEL_CHECK_GT(Size(), 0);
+    SPIEL_CHECK_GE(beta, 0);
+    PrioritizedSample<T> out;
+    out.items.reserve(num);
+    out.indices.reserve(num);
+    out.weights.reserve(num);
+    const double total = tree_.Total();
+    const double segment = total / num;
+    double max_weight = 0;
+    for (int i = 0; i < num; ++i) {
+      const double mass = segment * (i + std::uniform_real_distribution<double>(
+                                             0.0, 1.0)(*rng));
+      const int index = tree_.FindPrefixSum(std::min(
+          mass, std::nextafter(total, 0.0)));
+      const double prob = tree_.Get(index) / total;
+      const double weight = std::pow(Size() * prob, -beta);
+      out.items.push_back(data_[index]);
+      out.indices.push_back(index);
+      out.weights.push_back(weight);
+      max_weight = std::max(max_weight, weight);
+    }
+    // Normalize so weights only scale updates down.
+    for (double& weight : out.weights) weight /= max_weight;
+    return out;
+  }
+
+  // Set the priority of the element at `index` (as returned by Sample).
+  // Priorities must be positive; callers typically use |td_error| + epsilon.
+  void SetPriority(int index, double priority) {
+    SPIEL_CHECK_GT(priority, 0);
+    max_priority_ = std::max(max_priority_, priority);
+    tree_.Set(index, std::pow(priority, alpha_));
+  }
+
+  // Return the full buffer.
+  const std::vector<T>& Data() const { return data_; }
+
+  // Access a single element from the buffer.
+  const T& operator[](int i) const { return data_[i]; }
+
+  // How many elements are in the buffer.
+  int Size() const { return data_.size(); }
+
+  // Is the buffer empty?
+  bool Empty() const { return data_.empty(); }
+
+  // How many elements have ever been added to the buffer.
+  int64_t TotalAdded() const { return total_added_; }
+
+ private:
+  const int max_size_;
+  const double alpha_;
+  int64_t total_added_;
+  double max_priority_;
+  SumTree tree_;
+  std::vector<T> data_;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_PRIORITIZED_REPLAY_BUFFER_H_
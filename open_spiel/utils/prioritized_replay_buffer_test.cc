@@ -0,0 +1,105 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/prioritized_replay_buffer.h"
+
+#include <random>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+void TestSumTree() {
+  SumTree tree(4);
+  SPIEL_CHECK_EQ(tree.Total(), 0.0);
+
+  tree.Set(0, 1.0);
+  tree.Set(1, 2.0);
+  tree.Set(2, 3.0);
+  tree.Set(3, 4.0);
+  SPIEL_CHECK_EQ(tree.Total(), 10.0);
+  SPIEL_CHECK_EQ(tree.Get(2), 3.0);
+
+  // Prefix-sum lookup: leaf i covers [sum of leaves before i, + its value).
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(0.0), 0);
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(0.5), 0);
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(1.0), 1);
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(2.5), 1);
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(3.0), 2);
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(6.0), 3);
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(9.9), 3);
+
+  // Updates propagate to the total.
+  tree.Set(1, 0.0);
+  SPIEL_CHECK_EQ(tree.Total(), 8.0);
+  SPIEL_CHECK_EQ(tree.FindPrefixSum(1.5), 2);
+}
+
+void TestPrioritizedReplayBuffer() {
+  // alpha=1 so the sampling distribution is the raw priorities.
+  PrioritizedReplayBuffer<int> buffer(4, /*alpha=*/1.0);
+  std::mt19937 rng(17);
+
+  SPIEL_CHECK_TRUE(buffer.Empty());
+  buffer.Add(13);
+  SPIEL_CHECK_FALSE(buffer.Empty());
+  SPIEL_CHECK_EQ(buffer.Size(), 1);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 1);
+  SPIEL_CHECK_EQ(buffer[0], 13);
+
+  buffer.Add(14);
+  buffer.Add(15);
+  buffer.Add(16);
+  buffer.Add(17);  // Replaces 13.
+  SPIEL_CHECK_EQ(buffer.Size(), 4);
+  SPIEL_CHECK_EQ(buffer.TotalAdded(), 5);
+  SPIEL_CHECK_EQ(buffer[0], 17);
+
+  // With one priority dominating, essentially every draw is that element.
+  buffer.SetPriority(0, 1e9);
+  PrioritizedSample<int> sample = buffer.Sample(&rng, 32, /*beta=*/1.0);
+  SPIEL_CHECK_EQ(sample.items.size(), 32);
+  int dominant_draws = 0;
+  for (int i = 0; i < 32; ++i) {
+    if (sample.indices[i] == 0) {
+      SPIEL_CHECK_EQ(sample.items[i], 17);
+      ++dominant_draws;
+    }
+  }
+  SPIEL_CHECK_GE(dominant_draws, 30);
+
+  // Weights are normalized so the largest weight in the batch is 1.
+  for (double weight : sample.weights) {
+    SPIEL_CHECK_GT(weight, 0.0);
+    SPIEL_CHECK_LE(weight, 1.0);
+  }
+
+  // Equal priorities sample all elements and weight them equally.
+  for (int i = 0; i < 4; ++i) buffer.SetPriority(i, 1.0);
+  sample = buffer.Sample(&rng, 64, /*beta=*/1.0);
+  std::vector<int> counts(4, 0);
+  for (int index : sample.indices) counts[index] += 1;
+  for (int i = 0; i < 4; ++i) SPIEL_CHECK_GT(counts[i], 0);
+  for (double weight : sample.weights) SPIEL_CHECK_EQ(weight, 1.0);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestSumTree();
+  open_spiel::TestPrioritizedReplayBuffer();
+}
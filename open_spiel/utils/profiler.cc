@@ -0,0 +1,103 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/profiler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+
+namespace open_spiel {
+namespace {
+
+struct SiteTotals {
+  uint64_t count = 0;
+  uint64_t cycles = 0;
+};
+
+struct Registry {
+  absl::Mutex mutex;
+  // Per-thread site objects still alive, and the folded totals of ones
+  // whose thread has exited.
+  std::vector<ProfSite*> live;
+  std::map<std::string, SiteTotals> retired;
+};
+
+// Leaked so sites destroyed during program teardown can still deregister.
+Registry& GetRegistry() {
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+}  // namespace
+
+ProfSite::ProfSite(const char* name) : name_(name) {
+  Registry& registry = GetRegistry();
+  absl::MutexLock lock(&registry.mutex);
+  registry.live.push_back(this);
+}
+
+ProfSite::~ProfSite() {
+  Registry& registry = GetRegistry();
+  absl::MutexLock lock(&registry.mutex);
+  SiteTotals& totals = registry.retired[name_];
+  totals.count += count_.load(std::memory_order_relaxed);
+  totals.cycles += cycles_.load(std::memory_order_relaxed);
+  registry.live.erase(
+      std::remove(registry.live.begin(), registry.live.end(), this),
+      registry.live.end());
+}
+
+json::Object ProfilingJson() {
+  Registry& registry = GetRegistry();
+  std::map<std::string, SiteTotals> merged;
+  {
+    absl::MutexLock lock(&registry.mutex);
+    merged = registry.retired;
+    for (const ProfSite* site : registry.live) {
+      SiteTotals& totals = merged[site->name_];
+      totals.count += site->count_.load(std::memory_order_relaxed);
+      totals.cycles += site->cycles_.load(std::memory_order_relaxed);
+    }
+  }
+  json::Object sites;
+  for (const auto& [name, totals] : merged) {
+    sites[name] = json::Object{
+        {"count", static_cast<int64_t>(totals.count)},
+        {"cycles", static_cast<int64_t>(totals.cycles)},
+    };
+  }
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  const char* unit = "tsc";
+#else
+  const char* unit = "ns";
+#endif
+  return json::Object{{"unit", unit}, {"sites", sites}};
+}
+
+void ResetProfiling() {
+  Registry& registry = GetRegistry();
+  absl::MutexLock lock(&registry.mutex);
+  registry.retired.clear();
+  for (ProfSite* site : registry.live) {
+    site->count_.store(0, std::memory_order_relaxed);
+    site->cycles_.store(0, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace open_spiel
@@ -0,0 +1,91 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Force the macros on so the test covers them even in default builds.
+#ifndef OPEN_SPIEL_ENABLE_PROFILING
+#define OPEN_SPIEL_ENABLE_PROFILING
+#endif
+
+#include "open_spiel/utils/profiler.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>  // NOLINT
+
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/json.h"
+
+namespace open_spiel {
+namespace {
+
+void TimedWork() { SPIEL_PROF_SCOPE("profiler_test/timed"); }
+
+void CountedWork(int n) { SPIEL_PROF_COUNT("profiler_test/counted", n); }
+
+int64_t SiteCount(const json::Object& report, const std::string& name) {
+  const json::Object& sites = report.at("sites").GetObject();
+  auto it = sites.find(name);
+  if (it == sites.end()) return 0;
+  return it->second.GetObject().at("count").GetInt();
+}
+
+void TestScopesAndCountersAggregate() {
+  ResetProfiling();
+  for (int i = 0; i < 10; ++i) TimedWork();
+  CountedWork(3);
+  CountedWork(4);
+  json::Object report = ProfilingJson();
+  SPIEL_CHECK_EQ(SiteCount(report, "profiler_test/timed"), 10);
+  SPIEL_CHECK_EQ(SiteCount(report, "profiler_test/counted"), 7);
+  int64_t cycles = report.at("sites")
+                       .GetObject()
+                       .at("profiler_test/timed")
+                       .GetObject()
+                       .at("cycles")
+                       .GetInt();
+  SPIEL_CHECK_GE(cycles, 0);
+  SPIEL_CHECK_FALSE(report.at("unit").GetString().empty());
+}
+
+void TestThreadsMergeOnExit() {
+  ResetProfiling();
+  // Each thread accumulates into its own site; exited threads fold into the
+  // retired table, and the report merges both with the main thread's.
+  std::thread t1([]() {
+    for (int i = 0; i < 5; ++i) TimedWork();
+  });
+  std::thread t2([]() {
+    for (int i = 0; i < 7; ++i) TimedWork();
+  });
+  t1.join();
+  t2.join();
+  TimedWork();
+  SPIEL_CHECK_EQ(SiteCount(ProfilingJson(), "profiler_test/timed"), 13);
+}
+
+void TestReset() {
+  TimedWork();
+  SPIEL_CHECK_GT(SiteCount(ProfilingJson(), "profiler_test/timed"), 0);
+  ResetProfiling();
+  SPIEL_CHECK_EQ(SiteCount(ProfilingJson(), "profiler_test/timed"), 0);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestScopesAndCountersAggregate();
+  open_spiel::TestThreadsMergeOnExit();
+  open_spiel::TestReset();
+}
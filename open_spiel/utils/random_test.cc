@@ -16,6 +16,8 @@
 #include "open_spiel/utils/random.h"
 
 #include <random>
+#include <utility>
+#include <vector>
 
 #include "open_spiel/spiel_utils.h"
 
@@ -51,7 +53,56 @@ void TestRandomUtility() {
   }
 }
 
+void TestRandomXoshiro() {
+  RandomXoshiro r(0);
+
+  // Same seed, same stream; different seed, different stream.
+  RandomXoshiro r2(0);
+  RandomXoshiro r3(1);
+  SPIEL_CHECK_EQ(r.RandomUint64(), r2.RandomUint64());
+  SPIEL_CHECK_NE(r2.RandomUint64(), r3.RandomUint64());
+
+  double sum = 0;
+  for (int i = 0; i < 1000; ++i) {
+    double v = r.RandomUniform();
+    SPIEL_CHECK_GE(v, 0);
+    SPIEL_CHECK_LT(v, 1);
+    sum += v;
+  }
+  SPIEL_CHECK_GT(sum, 400);  // A uniform mean of 0.5, very loosely.
+  SPIEL_CHECK_LT(sum, 600);
+
+  // A batch fill continues the same stream as single draws.
+  RandomXoshiro a(42), b(42);
+  std::vector<double> batch(10);
+  a.RandomBatch(absl::MakeSpan(batch));
+  for (int i = 0; i < batch.size(); ++i) {
+    SPIEL_CHECK_EQ(batch[i], b.RandomUniform());
+  }
+}
+
+void TestSampleIndexFromProbs() {
+  std::vector<std::pair<int, double>> probs = {
+      {10, 0.25}, {11, 0.0}, {12, 0.5}, {13, 0.25}};
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.0), 0);
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.24), 0);
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.25), 2);  // Skips the zero.
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.74), 2);
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.75), 3);
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.999), 3);
+  // Rounding that leaves the cumulative sum short selects the last positive
+  // entry rather than running off the end.
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 1.0), 3);
+  SPIEL_CHECK_EQ(
+      SampleIndexFromProbs(std::vector<std::pair<int, double>>{{1, 0.0}}, 0.5),
+      -1);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
-int main(int argc, char **argv) { open_spiel::TestRandomUtility(); }
+int main(int argc, char **argv) {
+  open_spiel::TestRandomUtility();
+  open_spiel::TestRandomXoshiro();
+  open_spiel::TestSampleIndexFromProbs();
+}
@@ -16,7 +16,10 @@
 #define OPEN_SPIEL_UTILS_STATS_H_
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/utils/json.h"
@@ -117,6 +120,118 @@ class HistogramNamed {
   std::vector<std::string> names_;
 };
 
+// A thread-safe streaming histogram with quantile queries, for latency-style
+// measurements. Add is a single atomic increment with no external locking, so
+// it is cheap enough to wrap around hot operations (evaluation steps, queue
+// waits) called from many threads at once; per-thread instances can also be
+// kept and merged with += before reporting, like BasicStats. Values are
+// assigned to geometrically growing buckets between min_value and max_value
+// (both > 0), so quantile estimates carry a bounded relative error set by the
+// bucket count; values outside the range land in the first or last bucket.
+class StreamingHistogram {
+ public:
+  StreamingHistogram(double min_value, double max_value, int num_buckets = 64)
+      : min_value_(min_value),
+        max_value_(max_value),
+        log_range_(std::log(max_value / min_value)),
+        counts_(num_buckets) {
+    SPIEL_CHECK_GT(min_value, 0);
+    SPIEL_CHECK_GT(max_value, min_value);
+    SPIEL_CHECK_GT(num_buckets, 1);
+  }
+
+  void Reset() {
+    for (std::atomic<int64_t>& count : counts_) {
+      count.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Merge two histograms with the same bucketing. Useful for merging per
+  // thread stats before printing.
+  StreamingHistogram& operator+=(const StreamingHistogram& o) {
+    SPIEL_CHECK_EQ(counts_.size(), o.counts_.size());
+    for (int b = 0; b < counts_.size(); ++b) {
+      counts_[b].fetch_add(o.counts_[b].load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    }
+    return *this;
+  }
+
+  void Add(double val) {
+    counts_[BucketFor(val)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  int64_t Num() const {
+    int64_t num = 0;
+    for (const std::atomic<int64_t>& count : counts_) {
+      num += count.load(std::memory_order_relaxed);
+    }
+    return num;
+  }
+
+  // An upper bound for the q-quantile (eg 0.5 for the median, 0.99 for P99):
+  // the upper edge of the bucket where the running count passes q * num.
+  double Quantile(double q) const {
+    int64_t num = Num();
+    if (num == 0) {
+      return 0;
+    }
+    double target = q * num;
+    int64_t seen = 0;
+    for (int b = 0; b < counts_.size(); ++b) {
+      seen += counts_[b].load(std::memory_order_relaxed);
+      if (seen >= target) {
+        return BucketUpper(b);
+      }
+    }
+    return max_value_;
+  }
+
+  json::Object ToJson() const {
+    json::Array counts;
+    counts.reserve(counts_.size());
+    for (const std::atomic<int64_t>& count : counts_) {
+      counts.emplace_back(count.load(std::memory_order_relaxed));
+    }
+    return {
+        {"num", Num()},
+        {"p50", Quantile(0.5)},
+        {"p90", Quantile(0.9)},
+        {"p99", Quantile(0.99)},
+        {"counts", std::move(counts)},
+    };
+  }
+
+ private:
+  int BucketFor(double val) const {
+    if (!(val > min_value_)) {
+      return 0;
+    }
+    if (val >= max_value_) {
+      return counts_.size() - 1;
+    }
+    int bucket = static_cast<int>(counts_.size() *
+                                  std::log(val / min_value_) / log_range_);
+    return std::min<int>(bucket, counts_.size() - 1);
+  }
+
+  double BucketUpper(int bucket) const {
+    // The last bucket's upper edge is max_value_ by definition; computing it
+    // through exp() can land just below max_value_ in floating point.
+    if (bucket + 1 == counts_.size()) {
+      return max_value_;
+    }
+    return std::min(max_value_, min_value_ * std::exp(log_range_ *
+                                                      (bucket + 1) /
+                                                      counts_.size()));
+  }
+
+  double min_value_;
+  double max_value_;
+  double log_range_;
+  std::vector<std::atomic<int64_t>> counts_;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_UTILS_STATS_H_
@@ -106,6 +106,48 @@ void TestHistogramNamed() {
   }));
 }
 
+void TestStreamingHistogram() {
+  StreamingHistogram hist(/*min_value=*/1, /*max_value=*/1000);
+
+  SPIEL_CHECK_EQ(hist.Num(), 0);
+  SPIEL_CHECK_EQ(hist.Quantile(0.5), 0);
+
+  for (int i = 1; i <= 100; ++i) {
+    hist.Add(i);
+  }
+  SPIEL_CHECK_EQ(hist.Num(), 100);
+
+  // Quantile estimates are upper bounds with a bounded relative error.
+  SPIEL_CHECK_GE(hist.Quantile(0.5), 50);
+  SPIEL_CHECK_LT(hist.Quantile(0.5), 60);
+  SPIEL_CHECK_GE(hist.Quantile(0.99), 99);
+  SPIEL_CHECK_LT(hist.Quantile(0.99), 120);
+  SPIEL_CHECK_LE(hist.Quantile(0.5), hist.Quantile(0.9));
+  SPIEL_CHECK_LE(hist.Quantile(0.9), hist.Quantile(0.99));
+
+  // Out of range values land in the edge buckets.
+  hist.Add(0.001);
+  hist.Add(1e9);
+  SPIEL_CHECK_EQ(hist.Num(), 102);
+  SPIEL_CHECK_EQ(hist.Quantile(1), 1000);
+
+  // Merging per-thread shards doubles the counts.
+  StreamingHistogram other(1, 1000);
+  other += hist;
+  other += hist;
+  SPIEL_CHECK_EQ(other.Num(), 204);
+  SPIEL_CHECK_EQ(other.Quantile(0.5), hist.Quantile(0.5));
+
+  json::Object report = hist.ToJson();
+  SPIEL_CHECK_EQ(report["num"], 102);
+  SPIEL_CHECK_TRUE(report["p50"].IsDouble());
+  SPIEL_CHECK_TRUE(report["p99"].IsDouble());
+  SPIEL_CHECK_EQ(report["counts"].GetArray().size(), 64);
+
+  hist.Reset();
+  SPIEL_CHECK_EQ(hist.Num(), 0);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -113,4 +155,5 @@ int main(int argc, char** argv) {
   open_spiel::TestBasicStats();
   open_spiel::TestHistogramNumbered();
   open_spiel::TestHistogramNamed();
+  open_spiel::TestStreamingHistogram();
 }
@@ -0,0 +1,134 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/tensor_compression.h"
+
+#include <cstring>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+// We may in the future support multiple compression schemes.
+// CompressTensor() should select the most effective scheme adaptively.
+enum CompressionScheme : char {
+  kCompressionNone,   // We weren't able to compress the data.
+  kCompressionBinary  // Data is binary (all elements zero or one).
+};
+constexpr int kNumHeaderBytes = 1;
+constexpr int kBitsPerByte = 8;
+
+// Maps each byte value to the eight floats its bits unpack to, so
+// decompression expands a whole byte with one table copy instead of eight
+// bit tests.
+const float* ByteToFloats() {
+  static const float* table = []() {
+    float* t = new float[256 * kBitsPerByte];
+    for (int byte = 0; byte < 256; ++byte) {
+      for (int bit = 0; bit < kBitsPerByte; ++bit) {
+        t[byte * kBitsPerByte + bit] = (byte >> bit) & 1;
+      }
+    }
+    return t;
+  }();
+  return table;
+}
+
+// Binary compression.
+struct BinaryCompress {
+  static std::string Compress(absl::Span<const float> buffer) {
+    const int num_bytes =
+        (buffer.size() + kBitsPerByte - 1) / kBitsPerByte;
+    std::string str(num_bytes + kNumHeaderBytes, '\0');
+    str[0] = kCompressionBinary;
+
+    for (int i = 0; i < buffer.size(); ++i) {
+      if (buffer[i]) {
+        const int byte = i / kBitsPerByte;
+        const int bit = i % kBitsPerByte;
+        str[kNumHeaderBytes + byte] += (1 << bit);
+      }
+    }
+    return str;
+  }
+
+  static void Decompress(absl::string_view compressed,
+                         absl::Span<float> buffer) {
+    const int num_bytes =
+        (buffer.size() + kBitsPerByte - 1) / kBitsPerByte;
+    SPIEL_CHECK_EQ(compressed.size(), num_bytes + kNumHeaderBytes);
+    const float* table = ByteToFloats();
+    int i = 0;
+    for (int byte = 0; byte < num_bytes; ++byte) {
+      const float* row = table +
+          static_cast<unsigned char>(compressed[kNumHeaderBytes + byte]) *
+              kBitsPerByte;
+      if (i + kBitsPerByte <= buffer.size()) {
+        std::memcpy(&buffer[i], row, kBitsPerByte * sizeof(float));
+        i += kBitsPerByte;
+      } else {
+        // The final byte may encode fewer than eight elements.
+        for (; i < buffer.size(); ++i) {
+          buffer[i] = row[i % kBitsPerByte];
+        }
+      }
+    }
+  }
+};
+
+// No compression.
+struct NoCompress {
+  static std::string Compress(absl::Span<const float> buffer) {
+    const int num_bytes = sizeof(float) * buffer.size();
+    std::string str(num_bytes + kNumHeaderBytes, '\0');
+    str[0] = kCompressionNone;
+    memcpy(&str[kNumHeaderBytes], &buffer[0], num_bytes);
+    return str;
+  }
+
+  static void Decompress(absl::string_view compressed,
+                         absl::Span<float> buffer) {
+    const int num_bytes = sizeof(float) * buffer.size();
+    SPIEL_CHECK_EQ(compressed.size(), num_bytes + kNumHeaderBytes);
+    memcpy(&buffer[0], &compressed[kNumHeaderBytes], num_bytes);
+  }
+};
+
+}  // namespace
+
+std::string CompressTensor(absl::Span<const float> tensor) {
+  const bool data_is_binary =
+      absl::c_all_of(tensor, [](float x) { return x == 0 || x == 1; });
+  return data_is_binary ? BinaryCompress::Compress(tensor)
+                        : NoCompress::Compress(tensor);
+}
+
+void DecompressTensor(absl::string_view compressed, absl::Span<float> tensor) {
+  SPIEL_CHECK_GT(compressed.size(), 0);
+  switch (compressed[0]) {
+    case kCompressionBinary:
+      return BinaryCompress::Decompress(compressed, tensor);
+    case kCompressionNone:
+      return NoCompress::Decompress(compressed, tensor);
+    default:
+      SpielFatalError(absl::StrCat("Unrecognized compression scheme in '",
+                                   compressed, "'"));
+  }
+}
+
+}  // namespace open_spiel
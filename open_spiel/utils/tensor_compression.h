@@ -0,0 +1,43 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_TENSOR_COMPRESSION_H_
+#define OPEN_SPIEL_UTILS_TENSOR_COMPRESSION_H_
+
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+
+namespace open_spiel {
+
+// A compact encoding for float tensors, aimed at observation tensors that
+// are overwhelmingly binary planes (chess, go, ...): when every element is 0
+// or 1 the tensor is bit-packed eight elements per byte, a 32x reduction;
+// otherwise the raw floats are stored. The first byte of the encoding
+// records which scheme was used, so DecompressTensor handles both.
+//
+// The raw-float fallback is a memory copy, so an encoding is only portable
+// between machines with the same float layout (endianness).
+std::string CompressTensor(absl::Span<const float> tensor);
+
+// Decodes `compressed` into `tensor`, which must have exactly the size the
+// encoded tensor had. The bit-packed scheme is expanded through a
+// byte-to-floats lookup table, eight elements per step, so unpacking a batch
+// is cheap compared to the copies around it.
+void DecompressTensor(absl::string_view compressed, absl::Span<float> tensor);
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_TENSOR_COMPRESSION_H_
@@ -0,0 +1,66 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/tensor_compression.h"
+
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+void TestBinaryRoundTrip() {
+  // Sizes around the byte boundary, including a non-multiple of eight.
+  for (int size : {1, 7, 8, 9, 64, 100}) {
+    std::vector<float> tensor(size);
+    for (int i = 0; i < size; ++i) tensor[i] = (i % 3 == 0) ? 1 : 0;
+    std::string compressed = CompressTensor(tensor);
+    // Header byte plus one bit per element.
+    SPIEL_CHECK_EQ(compressed.size(), 1 + (size + 7) / 8);
+    std::vector<float> decompressed(size, -1);
+    DecompressTensor(compressed, absl::MakeSpan(decompressed));
+    SPIEL_CHECK_EQ(tensor, decompressed);
+  }
+}
+
+void TestNonBinaryFallback() {
+  std::vector<float> tensor = {0, 1, 0.5, -3, 1e6};
+  std::string compressed = CompressTensor(tensor);
+  SPIEL_CHECK_EQ(compressed.size(), 1 + tensor.size() * sizeof(float));
+  std::vector<float> decompressed(tensor.size());
+  DecompressTensor(compressed, absl::MakeSpan(decompressed));
+  SPIEL_CHECK_EQ(tensor, decompressed);
+}
+
+void TestAllZerosAndAllOnes() {
+  for (float fill : {0.0f, 1.0f}) {
+    std::vector<float> tensor(37, fill);
+    std::string compressed = CompressTensor(tensor);
+    std::vector<float> decompressed(tensor.size(), -1);
+    DecompressTensor(compressed, absl::MakeSpan(decompressed));
+    SPIEL_CHECK_EQ(tensor, decompressed);
+  }
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestBinaryRoundTrip();
+  open_spiel::TestNonBinaryFallback();
+  open_spiel::TestAllZerosAndAllOnes();
+}
@@ -31,10 +31,19 @@ namespace open_spiel {
 template <int Rank>
 class TensorView {
  public:
-  constexpr TensorView(absl::Span<float> values,
-                       const std::array<int, Rank>& shape, bool reset)
+  // Not constexpr: the size check may keep per-call-site state under
+  // OPEN_SPIEL_SAMPLED_HOT_CHECKS, which constexpr functions cannot hold.
+  TensorView(absl::Span<float> values, const std::array<int, Rank>& shape,
+             bool reset)
       : values_(values), shape_(shape) {
-    SPIEL_CHECK_EQ(size(), values_.size());
+    // Precompute the row-major strides once, so indexing below is a
+    // fixed-length multiply-add chain the compiler unrolls completely.
+    int stride = 1;
+    for (int i = Rank - 1; i >= 0; --i) {
+      strides_[i] = stride;
+      stride *= shape_[i];
+    }
+    SPIEL_HOT_CHECK_EQ(size(), values_.size());
     if (reset) std::fill(values.begin(), values.end(), 0);
   }
 
@@ -45,10 +54,29 @@ class TensorView {
 
   void clear() { std::fill(values_.begin(), values_.end(), 0.0); }
 
+  // Fill the whole tensor with one value.
+  void Fill(float value) {
+    std::fill(values_.begin(), values_.end(), value);
+  }
+
+  // Fill the contiguous sub-tensor at index `i` of the first dimension, eg
+  // one plane of a planes-by-rows-by-cols observation, in a single pass that
+  // vectorizes instead of a scalar loop over cells.
+  void FillPlane(int i, float value = 1.0) {
+    std::fill(values_.begin() + i * strides_[0],
+              values_.begin() + (i + 1) * strides_[0], value);
+  }
+
+  // Set the given flat indices (as returned by index()) to one; for the
+  // scattered one-hot writes left over after the bulk fills.
+  void SetOnes(absl::Span<const int> indices) {
+    for (int ind : indices) values_[ind] = 1.0;
+  }
+
   constexpr int index(const std::array<int, Rank>& args) const {
     int ind = 0;
     for (int i = 0; i < Rank; ++i) {
-      ind = ind * shape_[i] + args[i];
+      ind += args[i] * strides_[i];
     }
     return ind;
   }
@@ -67,6 +95,44 @@ class TensorView {
  private:
   absl::Span<float> values_;
   const std::array<int, Rank> shape_;
+  std::array<int, Rank> strides_;
+};
+
+// A batch of equally-shaped tensors laid out back to back in one contiguous
+// arena, eg the observations of a whole minibatch written with no per-state
+// allocation. Indexing yields a TensorView over one element of the batch, so
+// the batch axis costs one subspan rather than index arithmetic per element
+// access.
+template <int Rank>
+class BatchTensorView {
+ public:
+  BatchTensorView(absl::Span<float> values, int batch_size,
+                  const std::array<int, Rank>& shape, bool reset)
+      : values_(values),
+        batch_size_(batch_size),
+        element_size_(std::accumulate(shape.begin(), shape.end(), 1,
+                                      std::multiplies<int>())),
+        shape_(shape) {
+    SPIEL_HOT_CHECK_EQ(batch_size_ * element_size_, values_.size());
+    if (reset) std::fill(values.begin(), values.end(), 0);
+  }
+
+  TensorView<Rank> operator[](int batch) const {
+    return TensorView<Rank>(
+        values_.subspan(batch * element_size_, element_size_), shape_,
+        /*reset=*/false);
+  }
+
+  constexpr int batch_size() const { return batch_size_; }
+  constexpr int element_size() const { return element_size_; }
+  constexpr int size() const { return batch_size_ * element_size_; }
+  constexpr const std::array<int, Rank> shape() const { return shape_; }
+
+ private:
+  absl::Span<float> values_;
+  const int batch_size_;
+  const int element_size_;
+  const std::array<int, Rank> shape_;
 };
 
 }  // namespace open_spiel
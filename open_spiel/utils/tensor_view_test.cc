@@ -135,7 +135,66 @@ void TestTensorView() {
   }
 }
 
+void TestTensorViewFill() {
+  std::vector<float> values(2 * 3 * 4);
+  TensorView<3> view(absl::MakeSpan(values), {2, 3, 4}, true);
+
+  view.FillPlane(1);
+  for (int b = 0; b < 3; ++b) {
+    for (int c = 0; c < 4; ++c) {
+      SPIEL_CHECK_EQ((view[{0, b, c}]), 0);
+      SPIEL_CHECK_EQ((view[{1, b, c}]), 1);
+    }
+  }
+
+  view.FillPlane(1, 0.5);
+  SPIEL_CHECK_EQ((view[{1, 2, 3}]), 0.5);
+  SPIEL_CHECK_EQ((view[{0, 0, 0}]), 0);
+
+  view.Fill(2);
+  for (float v : values) SPIEL_CHECK_EQ(v, 2);
+
+  view.clear();
+  std::vector<int> ones = {view.index({0, 1, 2}), view.index({1, 0, 3})};
+  view.SetOnes(ones);
+  SPIEL_CHECK_EQ((view[{0, 1, 2}]), 1);
+  SPIEL_CHECK_EQ((view[{1, 0, 3}]), 1);
+  SPIEL_CHECK_EQ((view[{0, 0, 0}]), 0);
+}
+
+void TestBatchTensorView() {
+  constexpr int kBatch = 3;
+  std::vector<float> values(kBatch * 2 * 4, -1);
+  BatchTensorView<2> batch(absl::MakeSpan(values), kBatch, {2, 4}, true);
+
+  SPIEL_CHECK_EQ(batch.batch_size(), kBatch);
+  SPIEL_CHECK_EQ(batch.element_size(), 8);
+  SPIEL_CHECK_EQ(batch.size(), kBatch * 8);
+  SPIEL_CHECK_EQ(batch.shape(), (std::array<int, 2>{2, 4}));
+  for (float v : values) SPIEL_CHECK_EQ(v, 0);
+
+  // Each element of the batch is an independent window onto the arena.
+  for (int i = 0; i < kBatch; ++i) {
+    TensorView<2> view = batch[i];
+    SPIEL_CHECK_EQ(view.size(), 8);
+    view[{1, 2}] = i + 1;
+  }
+  for (int i = 0; i < kBatch; ++i) {
+    SPIEL_CHECK_EQ(values[i * 8 + 6], i + 1);
+    SPIEL_CHECK_EQ((batch[i][{1, 2}]), i + 1);
+    SPIEL_CHECK_EQ((batch[i][{0, 0}]), 0);
+  }
+
+  batch[1].FillPlane(0);
+  SPIEL_CHECK_EQ(values[8 + 3], 1);
+  SPIEL_CHECK_EQ(values[3], 0);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::TestTensorView(); }
+int main(int argc, char** argv) {
+  open_spiel::TestTensorView();
+  open_spiel::TestTensorViewFill();
+  open_spiel::TestBatchTensorView();
+}
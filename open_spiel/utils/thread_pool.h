@@ -0,0 +1,237 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_THREAD_POOL_H_
+#define OPEN_SPIEL_UTILS_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+
+// A fixed-size pool of worker threads with work stealing: each worker owns a
+// task deque and pops from its back, stealing from the front of another
+// worker's deque only when its own is empty. Submitted tasks are spread
+// round-robin across the deques, so independent submitters do not contend on
+// a single queue and a worker that runs out of work takes it from the busy
+// ones.
+//
+// Each worker also owns a private std::mt19937 stream, seeded once at
+// construction, which SubmitWithRng / ParallelForWithRng hand to the task.
+// Tasks that draw randomness through it need no locking and no per-task
+// seeding.
+//
+// Submitting from inside a task is fine; blocking on a future from inside a
+// task is not (the worker that would complete it may be the one waiting), so
+// call ParallelFor and future.get() only from threads outside the pool.
+class ThreadPool {
+ public:
+  // Creates num_threads workers. The seed is used for the workers' RNG
+  // streams (if 0, uses a random seed).
+  explicit ThreadPool(int num_threads, int rng_seed = 0)
+      : queues_(num_threads) {
+    SPIEL_CHECK_GE(num_threads, 1);
+    std::mt19937 seeder(rng_seed == 0 ? std::random_device{}() : rng_seed);
+    rngs_.reserve(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+      rngs_.emplace_back(seeder());
+    }
+    workers_.reserve(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+      workers_.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+  }
+
+  // Joins the workers after the queued tasks have run.
+  ~ThreadPool() {
+    {
+      absl::MutexLock lock(&wake_mutex_);
+      stop_ = true;
+      wake_cv_.SignalAll();
+    }
+    for (Thread& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Not copyable or movable: workers hold a pointer back to the pool.
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  int num_threads() const { return workers_.size(); }
+
+  // Runs fn() on some worker; the returned future yields its result (or
+  // rethrows what it threw).
+  template <typename Fn>
+  auto Submit(Fn&& fn) -> std::future<decltype(fn())> {
+    using Result = decltype(fn());
+    // Shared because std::function requires a copyable callable.
+    auto task = std::make_shared<std::packaged_task<Result()>>(
+        std::forward<Fn>(fn));
+    std::future<Result> result = task->get_future();
+    Schedule([task](std::mt19937&) { (*task)(); });
+    return result;
+  }
+
+  // Same, for tasks that draw randomness: runs fn(rng) with the executing
+  // worker's private stream.
+  template <typename Fn>
+  auto SubmitWithRng(Fn&& fn)
+      -> std::future<decltype(fn(std::declval<std::mt19937&>()))> {
+    using Result = decltype(fn(std::declval<std::mt19937&>()));
+    auto task = std::make_shared<std::packaged_task<Result(std::mt19937&)>>(
+        std::forward<Fn>(fn));
+    std::future<Result> result = task->get_future();
+    Schedule([task](std::mt19937& rng) { (*task)(rng); });
+    return result;
+  }
+
+  // Runs fn(i) for each i in [begin, end), split into chunks across the
+  // workers, and blocks until all of them are done. Must not be called from
+  // inside a pool task.
+  void ParallelFor(int64_t begin, int64_t end,
+                   const std::function<void(int64_t)>& fn) {
+    ParallelForWithRng(begin, end,
+                       [&fn](int64_t i, std::mt19937&) { fn(i); });
+  }
+
+  // Same, with the executing worker's RNG stream passed to each call.
+  void ParallelForWithRng(
+      int64_t begin, int64_t end,
+      const std::function<void(int64_t, std::mt19937&)>& fn) {
+    if (begin >= end) return;
+    const int64_t range = end - begin;
+    // A few chunks per worker so an unlucky chunk does not serialize the
+    // tail; stealing rebalances the rest.
+    const int64_t num_chunks =
+        std::min<int64_t>(range, 4 * workers_.size());
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_chunks);
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      const int64_t chunk_begin = begin + chunk * range / num_chunks;
+      const int64_t chunk_end = begin + (chunk + 1) * range / num_chunks;
+      futures.push_back(
+          SubmitWithRng([chunk_begin, chunk_end, &fn](std::mt19937& rng) {
+            for (int64_t i = chunk_begin; i < chunk_end; ++i) {
+              fn(i, rng);
+            }
+          }));
+    }
+    for (std::future<void>& future : futures) {
+      future.get();
+    }
+  }
+
+  // Index of the worker running the current task, in [0, num_threads()), or
+  // -1 when called from a thread outside the pool. Useful for indexing
+  // per-worker scratch space. Ids are per pool; do not mix pools.
+  static int CurrentWorkerId() { return current_worker_id_; }
+
+ private:
+  using Task = std::function<void(std::mt19937&)>;
+
+  struct WorkerQueue {
+    absl::Mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void Schedule(Task task) {
+    const uint32_t target =
+        next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+      absl::MutexLock lock(&queues_[target].mutex);
+      queues_[target].tasks.push_back(std::move(task));
+    }
+    {
+      absl::MutexLock lock(&wake_mutex_);
+      ++num_pending_;
+      wake_cv_.Signal();
+    }
+  }
+
+  // Pops from the worker's own deque, or steals from the first non-empty
+  // one. Decrements the pending count on success.
+  absl::optional<Task> PopOrSteal(int worker_id) {
+    for (int attempt = 0; attempt < queues_.size(); ++attempt) {
+      WorkerQueue& queue = queues_[(worker_id + attempt) % queues_.size()];
+      absl::MutexLock lock(&queue.mutex);
+      if (queue.tasks.empty()) continue;
+      Task task;
+      if (attempt == 0) {
+        // Own deque: take the most recently pushed task (better locality).
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        // Steal the oldest task, leaving the owner its recent ones.
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+      {
+        absl::MutexLock wake_lock(&wake_mutex_);
+        --num_pending_;
+      }
+      return task;
+    }
+    return absl::nullopt;
+  }
+
+  void WorkerLoop(int worker_id) {
+    current_worker_id_ = worker_id;
+    std::mt19937& rng = rngs_[worker_id];
+    while (true) {
+      {
+        absl::MutexLock lock(&wake_mutex_);
+        while (num_pending_ == 0 && !stop_) {
+          wake_cv_.Wait(&wake_mutex_);
+        }
+        if (num_pending_ == 0 && stop_) return;
+      }
+      // The task this worker was woken for may already have been taken; in
+      // that case the loop just comes back around to wait.
+      absl::optional<Task> task = PopOrSteal(worker_id);
+      if (task.has_value()) {
+        (*task)(rng);
+      }
+    }
+  }
+
+  std::vector<WorkerQueue> queues_;
+  std::vector<std::mt19937> rngs_;
+  std::vector<Thread> workers_;
+  std::atomic<uint32_t> next_queue_{0};
+
+  absl::Mutex wake_mutex_;
+  absl::CondVar wake_cv_;
+  int num_pending_ = 0;  // Guarded by wake_mutex_.
+  bool stop_ = false;    // Guarded by wake_mutex_.
+
+  static inline thread_local int current_worker_id_ = -1;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_THREAD_POOL_H_
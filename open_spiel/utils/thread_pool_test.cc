@@ -0,0 +1,111 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/thread_pool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <random>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+void TestSubmitFutures() {
+  ThreadPool pool(4);
+  SPIEL_CHECK_EQ(pool.num_threads(), 4);
+
+  std::vector<std::future<int>> futures;
+  futures.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    futures.push_back(pool.Submit([i]() { return i * i; }));
+  }
+  for (int i = 0; i < 100; ++i) {
+    SPIEL_CHECK_EQ(futures[i].get(), i * i);
+  }
+}
+
+void TestParallelFor() {
+  ThreadPool pool(4);
+  constexpr int64_t kSize = 10000;
+  std::vector<int> values(kSize, 0);
+  pool.ParallelFor(0, kSize, [&values](int64_t i) { values[i] = 2 * i; });
+  for (int64_t i = 0; i < kSize; ++i) {
+    SPIEL_CHECK_EQ(values[i], 2 * i);
+  }
+  // An empty range is a no-op.
+  pool.ParallelFor(5, 5, [](int64_t) { SpielFatalError("Unreachable."); });
+}
+
+void TestPerWorkerRng() {
+  ThreadPool pool(4, /*rng_seed=*/1234);
+  constexpr int64_t kSize = 1000;
+  std::vector<int> draws(kSize, -1);
+  std::vector<int> worker_ids(kSize, -1);
+  pool.ParallelForWithRng(0, kSize,
+                          [&draws, &worker_ids](int64_t i, std::mt19937& rng) {
+                            draws[i] = std::uniform_int_distribution<int>(
+                                0, 5)(rng);
+                            worker_ids[i] = ThreadPool::CurrentWorkerId();
+                          });
+  for (int64_t i = 0; i < kSize; ++i) {
+    SPIEL_CHECK_GE(draws[i], 0);
+    SPIEL_CHECK_LE(draws[i], 5);
+    SPIEL_CHECK_GE(worker_ids[i], 0);
+    SPIEL_CHECK_LT(worker_ids[i], pool.num_threads());
+  }
+  SPIEL_CHECK_EQ(ThreadPool::CurrentWorkerId(), -1);
+}
+
+void TestManyTasksFewWorkers() {
+  // All tasks are submitted from one thread, so most of them land in deques
+  // other than the one a given worker owns and must be stolen.
+  ThreadPool pool(2);
+  std::atomic<int> counter{0};
+  std::vector<std::future<void>> futures;
+  futures.reserve(1000);
+  for (int i = 0; i < 1000; ++i) {
+    futures.push_back(pool.Submit([&counter]() { ++counter; }));
+  }
+  for (std::future<void>& future : futures) {
+    future.get();
+  }
+  SPIEL_CHECK_EQ(counter.load(), 1000);
+}
+
+void TestDestructorRunsQueuedTasks() {
+  std::atomic<int> counter{0};
+  {
+    ThreadPool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.Submit([&counter]() { ++counter; });
+    }
+    // The destructor joins only after the queued tasks have run.
+  }
+  SPIEL_CHECK_EQ(counter.load(), 100);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestSubmitFutures();
+  open_spiel::TestParallelFor();
+  open_spiel::TestPerWorkerRng();
+  open_spiel::TestManyTasksFewWorkers();
+  open_spiel::TestDestructorRunsQueuedTasks();
+}